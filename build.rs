@@ -18,6 +18,7 @@ fn main() {
         let target_arch = std::env::var("CARGO_CFG_TARGET_ARCH").unwrap_or_default();
         let flags_to_try = match target_arch.as_str() {
             "arm" | "aarch64" => vec![
+                "SIMSIMD_TARGET_SVE2P1",
                 "SIMSIMD_TARGET_SVE2",
                 "SIMSIMD_TARGET_SVE_BF16",
                 "SIMSIMD_TARGET_SVE_F16",
@@ -31,6 +32,7 @@ fn main() {
             _ => vec![
                 "SIMSIMD_TARGET_SIERRA",
                 "SIMSIMD_TARGET_TURIN",
+                "SIMSIMD_TARGET_SAPPHIRE_AMX",
                 "SIMSIMD_TARGET_SAPPHIRE",
                 "SIMSIMD_TARGET_GENOA",
                 "SIMSIMD_TARGET_ICE",
@@ -61,5 +63,9 @@ fn main() {
     println!("cargo:rerun-if-changed=include/simsimd/spatial.h");
     println!("cargo:rerun-if-changed=include/simsimd/probability.h");
     println!("cargo:rerun-if-changed=include/simsimd/binary.h");
+    println!("cargo:rerun-if-changed=include/simsimd/cdist.h");
+    println!("cargo:rerun-if-changed=include/simsimd/pq.h");
+    println!("cargo:rerun-if-changed=include/simsimd/reduce.h");
+    println!("cargo:rerun-if-changed=include/simsimd/strings.h");
     println!("cargo:rerun-if-changed=include/simsimd/types.h");
 }
@@ -7,10 +7,15 @@
 #define SIMSIMD_NATIVE_F16 0
 #define SIMSIMD_NATIVE_BF16 0
 
+// CPU affinity masks for the built-in thread pool require GNU extensions on Linux
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 /*  Depending on the Operating System, the following intrinsics are available
  *  on recent compiler toolchains:
  *
- *  - Linux: everything is available in GCC 12+ and Clang 16+.
+ *  - Linux: everything is available in GCC 12+ and Clang 16+, except for SVE2.1, needing GCC 14+ and Clang 18+.
  *  - Windows - MSVC: everything except Sapphire Rapids and ARM SVE.
  *  - MacOS - Apple Clang: only Arm NEON and x86 AVX2 Haswell extensions are available.
  */
@@ -20,9 +25,22 @@
 #if !defined(SIMSIMD_TARGET_SVE) && (defined(__linux__))
 #define SIMSIMD_TARGET_SVE 1
 #endif
+#if !defined(SIMSIMD_TARGET_SVE_F16) && (defined(__linux__))
+#define SIMSIMD_TARGET_SVE_F16 1
+#endif
+#if !defined(SIMSIMD_TARGET_SVE_BF16) && (defined(__linux__))
+#define SIMSIMD_TARGET_SVE_BF16 1
+#endif
+#if !defined(SIMSIMD_TARGET_SVE_I8) && (defined(__linux__))
+#define SIMSIMD_TARGET_SVE_I8 1
+#endif
 #if !defined(SIMSIMD_TARGET_SVE2) && (defined(__linux__))
 #define SIMSIMD_TARGET_SVE2 1
 #endif
+#if !defined(SIMSIMD_TARGET_SVE2P1) && (defined(__linux__)) && \
+    ((defined(__clang__) && __clang_major__ >= 18) || (!defined(__clang__) && __GNUC__ >= 14))
+#define SIMSIMD_TARGET_SVE2P1 1
+#endif
 #if !defined(SIMSIMD_TARGET_HASWELL) && (defined(_MSC_VER) || defined(__APPLE__) || defined(__linux__))
 #define SIMSIMD_TARGET_HASWELL 1
 #endif
@@ -38,6 +56,9 @@
 #if !defined(SIMSIMD_TARGET_SAPPHIRE) && (defined(__linux__))
 #define SIMSIMD_TARGET_SAPPHIRE 1
 #endif
+#if !defined(SIMSIMD_TARGET_SAPPHIRE_AMX) && (defined(__linux__))
+#define SIMSIMD_TARGET_SAPPHIRE_AMX 1
+#endif
 #if !defined(SIMSIMD_TARGET_TURIN) && (defined(__linux__))
 #define SIMSIMD_TARGET_TURIN 1
 #endif
@@ -47,97 +68,747 @@
 
 #include <simsimd/simsimd.h>
 
+#include <stdio.h>  // `fopen`, `fprintf`, `fscanf`
+#include <stdlib.h> // `getenv`, `malloc`, `free`
+#include <string.h> // `memset`
+#include <time.h>   // `clock_gettime`
+#if defined(_WIN32)
+#include <windows.h> // `QueryPerformanceCounter`
+#endif
+
+// The built-in thread pool relies on POSIX threads, while on other platforms all tasks run on the calling thread
+#if !defined(SIMSIMD_THREADS_POSIX) && (defined(__linux__) || defined(__APPLE__) || defined(__unix__))
+#define SIMSIMD_THREADS_POSIX 1
+#endif
+#if SIMSIMD_THREADS_POSIX
+#include <pthread.h> // `pthread_create`, `pthread_cond_wait`
+#include <unistd.h>  // `sysconf`
+#if defined(__linux__)
+#include <sched.h> // `sched_getaffinity`, `CPU_SET`
+#endif
+#endif
+
+// Streaming searches over files rely on POSIX memory mapping, and aren't available on other platforms
+#if !defined(SIMSIMD_FILES_POSIX) && (defined(__linux__) || defined(__APPLE__) || defined(__unix__))
+#define SIMSIMD_FILES_POSIX 1
+#endif
+#if SIMSIMD_FILES_POSIX
+#include <fcntl.h>    // `open`
+#include <sys/mman.h> // `mmap`, `madvise`
+#include <sys/stat.h> // `fstat`
+#include <unistd.h>   // `pread`, `close`, `sysconf`
+#endif
+
+/**
+ *  @brief  Number of bytes of a vector file mapped at once by `simsimd_topk_file`, while the next window
+ *          is prefetched. Large windows amortize the system calls, while keeping the resident memory bounded.
+ */
+#if !defined(SIMSIMD_TOPK_FILE_WINDOW)
+#define SIMSIMD_TOPK_FILE_WINDOW (64u * 1024u * 1024u)
+#endif
+
+/**
+ *  @brief  Stack size of the thread pool workers. The packed many-to-many kernels keep about 50 KB of panels
+ *          on the stack, leaving little headroom in the default thread stacks of some C libraries, like musl.
+ */
+#if !defined(SIMSIMD_POOL_STACK_SIZE)
+#define SIMSIMD_POOL_STACK_SIZE (1024u * 1024u)
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-// Every time a function is called, it checks if the metric is already loaded. If not, it fetches it.
-// If no metric is found, it returns NaN. We can obtain NaN by dividing 0.0 by 0.0, but that annoys
+// The executor used by the one-to-many and many-to-many kernels, none by default
+static simsimd_executor_punned_t _simsimd_executor = 0;
+static void *_simsimd_executor_state = 0;
+
+// All kernels are resolved once, when the library is loaded, into an immutable dispatch table, that every
+// function indexes without locks or branchy lookups. Compilers without constructors fill it on first use.
+static simsimd_dispatch_table_t _simsimd_dispatch_table;
+static int _simsimd_dispatch_table_ready = 0;
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void _simsimd_dispatch_table_load(void) {
+    simsimd_dispatch_table_init(&_simsimd_dispatch_table, simsimd_capabilities(), simsimd_cap_any_k);
+    _simsimd_dispatch_table_ready = 1;
+    char const *tuning_path = getenv("SIMSIMD_TUNING_FILE");
+    if (tuning_path && *tuning_path) simsimd_tuning_load(tuning_path);
+    char const *instrumentation_flags = getenv("SIMSIMD_INSTRUMENTATION_FLAGS");
+    if (instrumentation_flags && *instrumentation_flags) simsimd_instrumentation_configure(atoi(instrumentation_flags));
+}
+
+SIMSIMD_INTERNAL simsimd_metric_punned_t _simsimd_dispatch(simsimd_metric_kind_t kind, simsimd_datatype_t datatype) {
+    simsimd_metric_punned_t metric = simsimd_dispatch_table_find(&_simsimd_dispatch_table, kind, datatype);
+    // Only calls preceding the constructor, like ones from constructors of other libraries, take this branch
+    if (!metric && !_simsimd_dispatch_table_ready) {
+        _simsimd_dispatch_table_load();
+        metric = simsimd_dispatch_table_find(&_simsimd_dispatch_table, kind, datatype);
+    }
+    return metric;
+}
+
+// Dense metrics can also be calibrated per length bucket, overriding the dispatch table, when enabled.
+// The kernels of the winners are resolved once, when the tuning table changes.
+static simsimd_tuning_table_t _simsimd_tuning;
+static simsimd_metric_punned_t _simsimd_tuned[simsimd_tuning_kinds_k][simsimd_dispatch_datatypes_k]
+                                             [simsimd_tuning_buckets_k];
+static int _simsimd_tuning_enabled = 0;
+
+SIMSIMD_INTERNAL simsimd_metric_punned_t _simsimd_dispatch_dense(simsimd_metric_kind_t kind,
+                                                                 simsimd_datatype_t datatype, simsimd_size_t n) {
+    if (_simsimd_tuning_enabled) {
+        simsimd_metric_punned_t metric = _simsimd_tuned[simsimd_tuning_kind_slot(kind)]
+                                                       [simsimd_dispatch_datatype_slot(datatype)]
+                                                       [simsimd_tuning_bucket(n)];
+        if (metric) return metric;
+    }
+    return _simsimd_dispatch(kind, datatype);
+}
+
+SIMSIMD_INTERNAL simsimd_capability_t _simsimd_dispatch_capability(simsimd_metric_kind_t kind,
+                                                                   simsimd_datatype_t datatype) {
+    return simsimd_dispatch_table_capability(&_simsimd_dispatch_table, kind, datatype);
+}
+
+SIMSIMD_INTERNAL simsimd_capability_t _simsimd_dispatch_dense_capability(simsimd_metric_kind_t kind,
+                                                                         simsimd_datatype_t datatype,
+                                                                         simsimd_size_t n) {
+    simsimd_size_t const kind_slot = simsimd_tuning_kind_slot(kind);
+    simsimd_size_t const datatype_slot = simsimd_dispatch_datatype_slot(datatype);
+    simsimd_size_t const bucket = simsimd_tuning_bucket(n);
+    // Winners are only resolved into `_simsimd_tuned`, if their capability is available and has the kernel
+    if (_simsimd_tuning_enabled && _simsimd_tuned[kind_slot][datatype_slot][bucket])
+        return _simsimd_tuning.winners[kind_slot][datatype_slot][bucket];
+    return _simsimd_dispatch_capability(kind, datatype);
+}
+
+#if SIMSIMD_INSTRUMENTATION
+
+#if defined(_MSC_VER)
+#include <intrin.h> // `__rdtsc`, `_InterlockedCompareExchange64`
+#endif
+
+/*  The counters live in a fixed-size open-addressing hash table, keyed by the datatype, the metric kind, and
+ *  the capability of the kernel. Slots are claimed with a compare-and-swap and never released, so the hot path
+ *  takes no locks, and only pays for the relaxed increments of a few counters shared by all threads.
+ */
+#define SIMSIMD_INSTRUMENTATION_SLOTS (1024)
+
+typedef struct _simsimd_kernel_counters_t {
+    simsimd_u64_t key; ///< Zero for empty slots, as metric kinds are never zero
+    simsimd_u64_t calls;
+    simsimd_u64_t bytes;
+    simsimd_u64_t cycles;
+} _simsimd_kernel_counters_t;
+
+static _simsimd_kernel_counters_t _simsimd_instrumentation[SIMSIMD_INSTRUMENTATION_SLOTS];
+static int _simsimd_instrumentation_flags = 0;
+
+SIMSIMD_INTERNAL void _simsimd_atomic_add(simsimd_u64_t *counter, simsimd_u64_t value) {
+#if defined(_MSC_VER)
+    _InterlockedExchangeAdd64((__int64 volatile *)counter, (__int64)value);
+#else
+    __atomic_fetch_add(counter, value, __ATOMIC_RELAXED);
+#endif
+}
+
+SIMSIMD_INTERNAL simsimd_u64_t _simsimd_atomic_claim(simsimd_u64_t *slot, simsimd_u64_t key) {
+#if defined(_MSC_VER)
+    return (simsimd_u64_t)_InterlockedCompareExchange64((__int64 volatile *)slot, (__int64)key, 0);
+#else
+    simsimd_u64_t expected = 0;
+    __atomic_compare_exchange_n(slot, &expected, key, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    return expected;
+#endif
+}
+
+SIMSIMD_DYNAMIC int simsimd_instrumentation_enabled(void) { return 1; }
+SIMSIMD_DYNAMIC void simsimd_instrumentation_configure(int flags) { _simsimd_instrumentation_flags = flags; }
+
+SIMSIMD_DYNAMIC simsimd_u64_t simsimd_instrumentation_ticks(void) {
+    if (!(_simsimd_instrumentation_flags & simsimd_instrumentation_cycles_k)) return 0;
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return (simsimd_u64_t)__rdtsc();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    unsigned int low, high;
+    __asm__ __volatile__("rdtsc" : "=a"(low), "=d"(high));
+    return ((simsimd_u64_t)high << 32) | low;
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+    simsimd_u64_t ticks;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return 0;
+#endif
+}
+
+SIMSIMD_DYNAMIC void simsimd_instrumentation_record(simsimd_metric_kind_t kind, simsimd_datatype_t datatype,
+                                                    simsimd_capability_t capability, simsimd_u64_t calls,
+                                                    simsimd_u64_t bytes, simsimd_u64_t cycles) {
+    // Datatypes span 24 bits, metric kinds 7 bits, and capabilities 31 bits
+    simsimd_u64_t const key = ((simsimd_u64_t)datatype << 40) | ((simsimd_u64_t)(kind & 0x7F) << 32) |
+                              ((simsimd_u64_t)capability & 0xFFFFFFFFull);
+    simsimd_size_t slot = (simsimd_size_t)((key * 0x9E3779B97F4A7C15ull) >> 54) % SIMSIMD_INSTRUMENTATION_SLOTS;
+    simsimd_size_t probes;
+    for (probes = 0; probes != SIMSIMD_INSTRUMENTATION_SLOTS; ++probes) {
+        _simsimd_kernel_counters_t *counters = &_simsimd_instrumentation[slot];
+        simsimd_u64_t found = counters->key;
+        if (found == 0) {
+            found = _simsimd_atomic_claim(&counters->key, key);
+            if (found == 0 && (_simsimd_instrumentation_flags & simsimd_instrumentation_trace_k)) {
+                if (capability)
+                    fprintf(stderr, "simsimd: metric '%c' on datatype 0x%x is served by capability 0x%x\n", kind,
+                            (unsigned)datatype, (unsigned)capability);
+                else
+                    fprintf(stderr, "simsimd: metric '%c' on datatype 0x%x has no kernel, exporting NaNs\n", kind,
+                            (unsigned)datatype);
+            }
+            if (found == 0) found = key;
+        }
+        if (found == key) {
+            _simsimd_atomic_add(&counters->calls, calls);
+            _simsimd_atomic_add(&counters->bytes, bytes);
+            if (cycles) _simsimd_atomic_add(&counters->cycles, cycles);
+            return;
+        }
+        slot = (slot + 1) % SIMSIMD_INSTRUMENTATION_SLOTS;
+    }
+}
+
+SIMSIMD_DYNAMIC simsimd_size_t simsimd_instrumentation_usage(simsimd_kernel_usage_t *usage, simsimd_size_t limit) {
+    simsimd_size_t slot, count = 0;
+    for (slot = 0; slot != SIMSIMD_INSTRUMENTATION_SLOTS; ++slot) {
+        _simsimd_kernel_counters_t const *counters = &_simsimd_instrumentation[slot];
+        simsimd_u64_t const key = counters->key;
+        if (!key) continue;
+        if (usage && count < limit) {
+            usage[count].kind = (simsimd_metric_kind_t)((key >> 32) & 0x7F);
+            usage[count].datatype = (simsimd_datatype_t)(key >> 40);
+            usage[count].capability = (simsimd_capability_t)(key & 0xFFFFFFFFull);
+            usage[count].calls = counters->calls;
+            usage[count].bytes = counters->bytes;
+            usage[count].cycles = counters->cycles;
+        }
+        ++count;
+    }
+    return count;
+}
+
+SIMSIMD_DYNAMIC void simsimd_instrumentation_reset(void) {
+    memset(_simsimd_instrumentation, 0, sizeof(_simsimd_instrumentation));
+}
+
+#define SIMSIMD_INSTRUMENT(kind, datatype, capability, bytes, call)                                                \
+    do {                                                                                                           \
+        simsimd_u64_t const _simsimd_start = simsimd_instrumentation_ticks();                                      \
+        call;                                                                                                      \
+        simsimd_instrumentation_record(kind, datatype, capability, 1, (simsimd_u64_t)(bytes),                      \
+                                       _simsimd_start ? simsimd_instrumentation_ticks() - _simsimd_start : 0);     \
+    } while (0)
+#define SIMSIMD_INSTRUMENT_MISS(kind, datatype) simsimd_instrumentation_record(kind, datatype, 0, 1, 0, 0)
+
+#else
+
+SIMSIMD_DYNAMIC int simsimd_instrumentation_enabled(void) { return 0; }
+SIMSIMD_DYNAMIC void simsimd_instrumentation_configure(int flags) { (void)flags; }
+SIMSIMD_DYNAMIC simsimd_u64_t simsimd_instrumentation_ticks(void) { return 0; }
+SIMSIMD_DYNAMIC void simsimd_instrumentation_record(simsimd_metric_kind_t kind, simsimd_datatype_t datatype,
+                                                    simsimd_capability_t capability, simsimd_u64_t calls,
+                                                    simsimd_u64_t bytes, simsimd_u64_t cycles) {
+    (void)kind, (void)datatype, (void)capability, (void)calls, (void)bytes, (void)cycles;
+}
+SIMSIMD_DYNAMIC simsimd_size_t simsimd_instrumentation_usage(simsimd_kernel_usage_t *usage, simsimd_size_t limit) {
+    (void)usage, (void)limit;
+    return 0;
+}
+SIMSIMD_DYNAMIC void simsimd_instrumentation_reset(void) {}
+
+#define SIMSIMD_INSTRUMENT(kind, datatype, capability, bytes, call) call
+#define SIMSIMD_INSTRUMENT_MISS(kind, datatype) ((void)0)
+
+#endif // SIMSIMD_INSTRUMENTATION
+
+/// Sums the lengths of `count` variable-length inputs, to estimate the bytes processed by the batch kernels
+SIMSIMD_INTERNAL simsimd_size_t _simsimd_sum_lengths(simsimd_size_t const *lengths, simsimd_size_t count) {
+    simsimd_size_t i, sum = 0;
+    for (i = 0; i != count; ++i) sum += lengths[i];
+    return sum;
+}
+
+// If no metric is found, functions return NaN. We can obtain NaN by dividing 0.0 by 0.0, but that annoys
 // the MSVC compiler. Instead we can directly write-in the signaling NaN (0x7FF0000000000001)
 // or the qNaN (0x7FF8000000000000).
 #define SIMSIMD_DECLARATION_DENSE(name, extension, type)                                                        \
     SIMSIMD_DYNAMIC void simsimd_##name##_##extension(simsimd_##type##_t const *a, simsimd_##type##_t const *b, \
                                                       simsimd_size_t n, simsimd_distance_t *results) {          \
-        static simsimd_metric_punned_t metric = 0;                                                              \
-        if (metric == 0) {                                                                                      \
-            simsimd_capability_t used_capability;                                                               \
-            simsimd_find_metric_punned(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,             \
-                                       simsimd_capabilities(), simsimd_cap_any_k, &metric, &used_capability);   \
-            if (!metric) {                                                                                      \
-                *(simsimd_u64_t *)results = 0x7FF0000000000001ull;                                              \
-                return;                                                                                         \
-            }                                                                                                   \
+        simsimd_metric_punned_t metric = (simsimd_metric_punned_t)_simsimd_dispatch_dense(                      \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k, n);                                    \
+        if (!metric) {                                                                                          \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);               \
+            *(simsimd_u64_t *)results = 0x7FF0000000000001ull;                                                  \
+            return;                                                                                             \
         }                                                                                                       \
-        metric(a, b, n, results);                                                                               \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                         \
+                           _simsimd_dispatch_dense_capability(simsimd_metric_##name##_k,                        \
+                                                              simsimd_datatype_##extension##_k, n),             \
+                           2 * n * sizeof(simsimd_##type##_t), metric(a, b, n, results));                       \
     }
 
 #define SIMSIMD_DECLARATION_SPARSE(name, extension, type)                                                       \
     SIMSIMD_DYNAMIC void simsimd_##name##_##extension(simsimd_##type##_t const *a, simsimd_##type##_t const *b, \
                                                       simsimd_size_t a_length, simsimd_size_t b_length,         \
                                                       simsimd_distance_t *result) {                             \
-        static simsimd_metric_sparse_punned_t metric = 0;                                                       \
-        if (metric == 0) {                                                                                      \
-            simsimd_capability_t used_capability;                                                               \
-            simsimd_find_metric_punned(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,             \
-                                       simsimd_capabilities(), simsimd_cap_any_k,                               \
-                                       (simsimd_metric_punned_t *)(&metric), &used_capability);                 \
-            if (!metric) {                                                                                      \
-                *(simsimd_u64_t *)result = 0x7FF0000000000001ull;                                               \
-                return;                                                                                         \
-            }                                                                                                   \
+        simsimd_metric_sparse_punned_t metric = (simsimd_metric_sparse_punned_t)_simsimd_dispatch(              \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                                       \
+        if (!metric) {                                                                                          \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);               \
+            *(simsimd_u64_t *)result = 0x7FF0000000000001ull;                                                   \
+            return;                                                                                             \
         }                                                                                                       \
-        metric(a, b, a_length, b_length, result);                                                               \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                         \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_k,                              \
+                                                        simsimd_datatype_##extension##_k),                      \
+                           (a_length + b_length) * sizeof(simsimd_##type##_t),                                  \
+                           metric(a, b, a_length, b_length, result));                                           \
+    }
+
+#define SIMSIMD_DECLARATION_SPDOT(name, extension, type, weight_type)                                         \
+    SIMSIMD_DYNAMIC void simsimd_##name##_##extension(                                                        \
+        simsimd_##type##_t const *a, simsimd_##type##_t const *b, simsimd_##weight_type##_t const *a_weights, \
+        simsimd_##weight_type##_t const *b_weights, simsimd_size_t a_length, simsimd_size_t b_length,         \
+        simsimd_distance_t *results) {                                                                        \
+        simsimd_metric_spdot_punned_t metric = (simsimd_metric_spdot_punned_t)_simsimd_dispatch(              \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                                     \
+        if (!metric) {                                                                                        \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);             \
+            *(simsimd_u64_t *)results = 0x7FF0000000000001ull;                                                \
+            *(simsimd_u64_t *)(results + 1) = 0x7FF0000000000001ull;                                          \
+            return;                                                                                           \
+        }                                                                                                     \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                       \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_k,                            \
+                                                        simsimd_datatype_##extension##_k),                    \
+                           (a_length + b_length) * (sizeof(*a) + sizeof(*a_weights)),                         \
+                           metric(a, b, a_weights, b_weights, a_length, b_length, results));                  \
+    }
+
+#define SIMSIMD_DECLARATION_SPARSE_BATCH(name, extension, type)                                                \
+    SIMSIMD_DYNAMIC void simsimd_##name##_batch_##extension(                                                   \
+        simsimd_##type##_t const *a, simsimd_size_t a_length, simsimd_##type##_t const *b,                     \
+        simsimd_size_t const *b_offsets, simsimd_size_t b_count, simsimd_distance_t *results) {                \
+        simsimd_metric_sparse_batch_punned_t metric = (simsimd_metric_sparse_batch_punned_t)_simsimd_dispatch( \
+            simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k);                                \
+        if (!metric) {                                                                                         \
+            simsimd_size_t i;                                                                                  \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k);        \
+            for (i = 0; i != b_count; ++i) *(simsimd_u64_t *)(results + i) = 0x7FF0000000000001ull;            \
+            return;                                                                                            \
+        }                                                                                                      \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k,                  \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_batch_k,                       \
+                                                        simsimd_datatype_##extension##_k),                     \
+                           (a_length + b_offsets[b_count] - b_offsets[0]) * sizeof(simsimd_##type##_t),        \
+                           metric(a, a_length, b, b_offsets, b_count, results));                               \
+    }
+
+#define SIMSIMD_DECLARATION_SPDOT_BATCH(name, extension, type, weight_type)                                       \
+    SIMSIMD_DYNAMIC void simsimd_##name##_batch_##extension(                                                      \
+        simsimd_##type##_t const *a, simsimd_##weight_type##_t const *a_weights, simsimd_size_t a_length,         \
+        simsimd_##type##_t const *b, simsimd_##weight_type##_t const *b_weights, simsimd_size_t const *b_offsets, \
+        simsimd_size_t b_count, simsimd_distance_t *results) {                                                    \
+        simsimd_metric_spdot_batch_punned_t metric = (simsimd_metric_spdot_batch_punned_t)_simsimd_dispatch(      \
+            simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k);                                   \
+        if (!metric) {                                                                                            \
+            simsimd_size_t i;                                                                                     \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k);           \
+            for (i = 0; i != b_count; ++i) *(simsimd_u64_t *)(results + i) = 0x7FF0000000000001ull;               \
+            return;                                                                                               \
+        }                                                                                                         \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k,                     \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_batch_k,                          \
+                                                        simsimd_datatype_##extension##_k),                        \
+                           (a_length + b_offsets[b_count] - b_offsets[0]) * (sizeof(*a) + sizeof(*a_weights)),    \
+                           metric(a, a_weights, a_length, b, b_weights, b_offsets, b_count, results));            \
+    }
+
+#define SIMSIMD_DECLARATION_LEVENSHTEIN_BATCH(extension, type)                                                  \
+    SIMSIMD_DYNAMIC void simsimd_levenshtein_batch_##extension(                                                 \
+        simsimd_##type##_t const *a, simsimd_size_t a_length, simsimd_##type##_t const *b,                      \
+        simsimd_size_t const *b_lengths, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t bound, \
+        simsimd_distance_t *results) {                                                                          \
+        simsimd_metric_levenshtein_batch_punned_t metric = (simsimd_metric_levenshtein_batch_punned_t)          \
+            _simsimd_dispatch(simsimd_metric_levenshtein_batch_k, simsimd_datatype_##extension##_k);            \
+        if (!metric) {                                                                                          \
+            simsimd_size_t i;                                                                                   \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_levenshtein_batch_k, simsimd_datatype_##extension##_k);      \
+            for (i = 0; i != b_count; ++i) *(simsimd_u64_t *)(results + i) = 0x7FF0000000000001ull;             \
+            return;                                                                                             \
+        }                                                                                                       \
+        SIMSIMD_INSTRUMENT(simsimd_metric_levenshtein_batch_k, simsimd_datatype_##extension##_k,                \
+                           _simsimd_dispatch_capability(simsimd_metric_levenshtein_batch_k,                     \
+                                                        simsimd_datatype_##extension##_k),                      \
+                           a_length + _simsimd_sum_lengths(b_lengths, b_count),                                 \
+                           metric(a, a_length, b, b_lengths, b_count, b_stride, bound, results));               \
+    }
+
+#define SIMSIMD_DECLARATION_ALIGNMENT_BATCH(name, extension, type)                                                   \
+    SIMSIMD_DYNAMIC void simsimd_##name##_batch_##extension(                                                         \
+        simsimd_##type##_t const *a, simsimd_size_t a_length, simsimd_##type##_t const *b,                           \
+        simsimd_size_t const *b_lengths, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_i32_t match,       \
+        simsimd_i32_t mismatch, simsimd_i32_t gap, simsimd_distance_t *results) {                                    \
+        simsimd_metric_alignment_batch_punned_t metric = (simsimd_metric_alignment_batch_punned_t)_simsimd_dispatch( \
+            simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k);                                      \
+        if (!metric) {                                                                                               \
+            simsimd_size_t i;                                                                                        \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k);              \
+            for (i = 0; i != b_count; ++i) *(simsimd_u64_t *)(results + i) = 0x7FF0000000000001ull;                  \
+            return;                                                                                                  \
+        }                                                                                                            \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k,                        \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_batch_k,                             \
+                                                        simsimd_datatype_##extension##_k),                           \
+                           a_length + _simsimd_sum_lengths(b_lengths, b_count),                                      \
+                           metric(a, a_length, b, b_lengths, b_count, b_stride, match, mismatch, gap, results));     \
     }
 
 #define SIMSIMD_DECLARATION_CURVED(name, extension, type)                                                       \
     SIMSIMD_DYNAMIC void simsimd_##name##_##extension(simsimd_##type##_t const *a, simsimd_##type##_t const *b, \
                                                       simsimd_##type##_t const *c, simsimd_size_t n,            \
                                                       simsimd_distance_t *result) {                             \
-        static simsimd_metric_curved_punned_t metric = 0;                                                       \
-        if (metric == 0) {                                                                                      \
-            simsimd_capability_t used_capability;                                                               \
-            simsimd_find_metric_punned(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,             \
-                                       simsimd_capabilities(), simsimd_cap_any_k,                               \
-                                       (simsimd_metric_punned_t *)(&metric), &used_capability);                 \
-            if (!metric) {                                                                                      \
-                *(simsimd_u64_t *)result = 0x7FF0000000000001ull;                                               \
-                return;                                                                                         \
-            }                                                                                                   \
+        simsimd_metric_curved_punned_t metric = (simsimd_metric_curved_punned_t)_simsimd_dispatch(              \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                                       \
+        if (!metric) {                                                                                          \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);               \
+            *(simsimd_u64_t *)result = 0x7FF0000000000001ull;                                                   \
+            return;                                                                                             \
         }                                                                                                       \
-        metric(a, b, c, n, result);                                                                             \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                         \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_k,                              \
+                                                        simsimd_datatype_##extension##_k),                      \
+                           (2 + n) * n * sizeof(simsimd_##type##_t), metric(a, b, c, n, result));               \
+    }
+
+#define SIMSIMD_DECLARATION_WHITEN(extension, type)                                                                    \
+    SIMSIMD_DYNAMIC void simsimd_whiten_##extension(                                                                   \
+        simsimd_##type##_t const *vectors, simsimd_size_t count, simsimd_size_t stride,                                \
+        simsimd_##type##_t const *l, simsimd_size_t n, simsimd_##type##_t *whitened, simsimd_size_t whitened_stride) { \
+        simsimd_kernel_whiten_punned_t kernel = (simsimd_kernel_whiten_punned_t)_simsimd_dispatch(                     \
+            simsimd_metric_whiten_k, simsimd_datatype_##extension##_k);                                                \
+        SIMSIMD_INSTRUMENT(simsimd_metric_whiten_k, simsimd_datatype_##extension##_k,                                  \
+                           _simsimd_dispatch_capability(simsimd_metric_whiten_k, simsimd_datatype_##extension##_k),    \
+                           (count + n) * n * sizeof(simsimd_##type##_t),                                               \
+                           kernel(vectors, count, stride, l, n, whitened, whitened_stride));                           \
+    }
+
+#define SIMSIMD_DECLARATION_BILINEAR_CDIST(extension, type)                                                        \
+    SIMSIMD_DYNAMIC void simsimd_bilinear_cdist_##extension(                                                       \
+        simsimd_##type##_t const *a, simsimd_##type##_t const *b, simsimd_size_t a_count, simsimd_size_t a_stride, \
+        simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_##type##_t const *c, simsimd_size_t n,            \
+        simsimd_distance_t *results, simsimd_size_t results_stride) {                                              \
+        simsimd_metric_bilinear_cdist_punned_t metric = (simsimd_metric_bilinear_cdist_punned_t)_simsimd_dispatch( \
+            simsimd_metric_bilinear_cdist_k, simsimd_datatype_##extension##_k);                                    \
+        SIMSIMD_INSTRUMENT(simsimd_metric_bilinear_cdist_k, simsimd_datatype_##extension##_k,                      \
+                           _simsimd_dispatch_capability(simsimd_metric_bilinear_cdist_k,                           \
+                                                        simsimd_datatype_##extension##_k),                         \
+                           (a_count + b_count + n) * n * sizeof(simsimd_##type##_t),                               \
+                           metric(a, b, a_count, a_stride, b_count, b_stride, c, n, results, results_stride));     \
     }
 
 #define SIMSIMD_DECLARATION_FMA(name, extension, type)                                                           \
     SIMSIMD_DYNAMIC void simsimd_##name##_##extension(                                                           \
         simsimd_##type##_t const *a, simsimd_##type##_t const *b, simsimd_##type##_t const *c, simsimd_size_t n, \
         simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_##type##_t *result) {                         \
-        static simsimd_kernel_fma_punned_t metric = 0;                                                           \
-        if (metric == 0) {                                                                                       \
-            simsimd_capability_t used_capability;                                                                \
-            simsimd_find_metric_punned(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,              \
-                                       simsimd_capabilities(), simsimd_cap_any_k,                                \
-                                       (simsimd_metric_punned_t *)(&metric), &used_capability);                  \
-        }                                                                                                        \
-        metric(a, b, c, n, alpha, beta, result);                                                                 \
+        simsimd_kernel_fma_punned_t metric = (simsimd_kernel_fma_punned_t)_simsimd_dispatch(                     \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                                        \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                          \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_k,                               \
+                                                        simsimd_datatype_##extension##_k),                       \
+                           3 * n * sizeof(simsimd_##type##_t), metric(a, b, c, n, alpha, beta, result));         \
     }
 
 #define SIMSIMD_DECLARATION_WSUM(name, extension, type)                                                         \
     SIMSIMD_DYNAMIC void simsimd_##name##_##extension(simsimd_##type##_t const *a, simsimd_##type##_t const *b, \
                                                       simsimd_size_t n, simsimd_distance_t alpha,               \
                                                       simsimd_distance_t beta, simsimd_##type##_t *result) {    \
-        static simsimd_kernel_wsum_punned_t metric = 0;                                                         \
-        if (metric == 0) {                                                                                      \
-            simsimd_capability_t used_capability;                                                               \
-            simsimd_find_metric_punned(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,             \
-                                       simsimd_capabilities(), simsimd_cap_any_k,                               \
-                                       (simsimd_metric_punned_t *)(&metric), &used_capability);                 \
-        }                                                                                                       \
-        metric(a, b, n, alpha, beta, result);                                                                   \
+        simsimd_kernel_wsum_punned_t metric = (simsimd_kernel_wsum_punned_t)_simsimd_dispatch(                  \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                                       \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                         \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_k,                              \
+                                                        simsimd_datatype_##extension##_k),                      \
+                           2 * n * sizeof(simsimd_##type##_t), metric(a, b, n, alpha, beta, result));           \
+    }
+
+#define SIMSIMD_DECLARATION_SCALE(name, extension, type)                                                 \
+    SIMSIMD_DYNAMIC void simsimd_##name##_##extension(simsimd_##type##_t const *a, simsimd_size_t n,     \
+                                                      simsimd_distance_t alpha, simsimd_distance_t beta, \
+                                                      simsimd_##type##_t *result) {                      \
+        simsimd_kernel_scale_punned_t metric = (simsimd_kernel_scale_punned_t)_simsimd_dispatch(         \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                                \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                  \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_k,                       \
+                                                        simsimd_datatype_##extension##_k),               \
+                           n * sizeof(simsimd_##type##_t), metric(a, n, alpha, beta, result));           \
+    }
+
+#define SIMSIMD_DECLARATION_ELEMENTWISE(name, extension, type)                                                  \
+    SIMSIMD_DYNAMIC void simsimd_##name##_##extension(simsimd_##type##_t const *a, simsimd_##type##_t const *b, \
+                                                      simsimd_size_t n, simsimd_##type##_t *result) {           \
+        simsimd_kernel_elementwise_punned_t metric = (simsimd_kernel_elementwise_punned_t)_simsimd_dispatch(    \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                                       \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                         \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_k,                              \
+                                                        simsimd_datatype_##extension##_k),                      \
+                           2 * n * sizeof(simsimd_##type##_t), metric(a, b, n, result));                        \
+    }
+
+#define SIMSIMD_DECLARATION_CONVERT(name, extension, input_type, output_type)                                        \
+    SIMSIMD_DYNAMIC void simsimd_##name##_##extension(simsimd_##input_type##_t const *a, simsimd_size_t n,           \
+                                                      simsimd_distance_t alpha, simsimd_##output_type##_t *result) { \
+        simsimd_kernel_convert_punned_t metric = (simsimd_kernel_convert_punned_t)_simsimd_dispatch(                 \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                                            \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                              \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_k,                                   \
+                                                        simsimd_datatype_##extension##_k),                           \
+                           n * sizeof(simsimd_##input_type##_t), metric(a, n, alpha, result));                       \
+    }
+
+#define SIMSIMD_DECLARATION_REDUCE(name, extension, type)                                                          \
+    SIMSIMD_DYNAMIC void simsimd_reduce_##name##_##extension(simsimd_##type##_t const *rows, simsimd_size_t count, \
+                                                             simsimd_size_t stride, simsimd_size_t n,              \
+                                                             simsimd_distance_t *results) {                        \
+        simsimd_kernel_reduce_punned_t kernel = (simsimd_kernel_reduce_punned_t)_simsimd_dispatch(                 \
+            simsimd_metric_reduce_##name##_k, simsimd_datatype_##extension##_k);                                   \
+        SIMSIMD_INSTRUMENT(simsimd_metric_reduce_##name##_k, simsimd_datatype_##extension##_k,                     \
+                           _simsimd_dispatch_capability(simsimd_metric_reduce_##name##_k,                          \
+                                                        simsimd_datatype_##extension##_k),                         \
+                           count * n * sizeof(simsimd_##type##_t), kernel(rows, count, stride, n, results));       \
+    }
+
+#define SIMSIMD_DECLARATION_ARGREDUCE(name, extension, type)                                                         \
+    SIMSIMD_DYNAMIC void simsimd_reduce_##name##_##extension(simsimd_##type##_t const *rows, simsimd_size_t count,   \
+                                                             simsimd_size_t stride, simsimd_size_t n,                \
+                                                             simsimd_distance_t *values, simsimd_size_t *indices) {  \
+        simsimd_kernel_argreduce_punned_t kernel = (simsimd_kernel_argreduce_punned_t)_simsimd_dispatch(             \
+            simsimd_metric_reduce_##name##_k, simsimd_datatype_##extension##_k);                                     \
+        SIMSIMD_INSTRUMENT(simsimd_metric_reduce_##name##_k, simsimd_datatype_##extension##_k,                       \
+                           _simsimd_dispatch_capability(simsimd_metric_reduce_##name##_k,                            \
+                                                        simsimd_datatype_##extension##_k),                           \
+                           count * n * sizeof(simsimd_##type##_t), kernel(rows, count, stride, n, values, indices)); \
+    }
+
+#define SIMSIMD_DECLARATION_BATCH(name, extension, type)                                                             \
+    SIMSIMD_DYNAMIC void simsimd_##name##_batch_##extension(                                                         \
+        simsimd_##type##_t const *a, simsimd_##type##_t const *b, simsimd_size_t b_count, simsimd_size_t b_stride,   \
+        simsimd_size_t n, simsimd_distance_t *results) {                                                             \
+        simsimd_metric_batch_punned_t metric = (simsimd_metric_batch_punned_t)_simsimd_dispatch(                     \
+            simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k);                                      \
+        if (!metric) {                                                                                               \
+            simsimd_size_t i;                                                                                        \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k);              \
+            for (i = 0; i != b_count; ++i) *(simsimd_u64_t *)(results + i) = 0x7FF0000000000001ull;                  \
+            return;                                                                                                  \
+        }                                                                                                            \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_batch_k, simsimd_datatype_##extension##_k,                        \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_batch_k,                             \
+                                                        simsimd_datatype_##extension##_k),                           \
+                           (1 + b_count) * n * sizeof(simsimd_##type##_t),                                           \
+                           simsimd_batch_parallel(metric, _simsimd_executor, _simsimd_executor_state, a, b, b_count, \
+                                                  b_stride, n, results));                                            \
+    }
+
+#define SIMSIMD_DECLARATION_CDIST(name, extension, type)                                                             \
+    SIMSIMD_DYNAMIC void simsimd_##name##_cdist_##extension(                                                         \
+        simsimd_##type##_t const *a, simsimd_##type##_t const *b, simsimd_size_t a_count, simsimd_size_t a_stride,   \
+        simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results,              \
+        simsimd_size_t results_stride) {                                                                             \
+        simsimd_metric_cdist_punned_t metric = (simsimd_metric_cdist_punned_t)_simsimd_dispatch(                     \
+            simsimd_metric_##name##_cdist_k, simsimd_datatype_##extension##_k);                                      \
+        if (!metric) {                                                                                               \
+            simsimd_size_t i, j;                                                                                     \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_cdist_k, simsimd_datatype_##extension##_k);              \
+            for (i = 0; i != a_count; ++i)                                                                           \
+                for (j = 0; j != b_count; ++j)                                                                       \
+                    *(simsimd_u64_t *)(SIMSIMD_ROW(simsimd_distance_t, results, results_stride, i) + j) =            \
+                        0x7FF0000000000001ull;                                                                       \
+            return;                                                                                                  \
+        }                                                                                                            \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_cdist_k, simsimd_datatype_##extension##_k,                        \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_cdist_k,                             \
+                                                        simsimd_datatype_##extension##_k),                           \
+                           (a_count + b_count) * n * sizeof(simsimd_##type##_t),                                     \
+                           simsimd_cdist_parallel(metric, _simsimd_executor, _simsimd_executor_state, a, b, a_count, \
+                                                  a_stride, b_count, b_stride, n, results, results_stride));         \
+    }
+
+#define SIMSIMD_DECLARATION_CDIST_TYPED(name, extension, type)                                                     \
+    SIMSIMD_DYNAMIC void simsimd_##name##_cdist_typed_##extension(                                                 \
+        simsimd_##type##_t const *a, simsimd_##type##_t const *b, simsimd_size_t a_count, simsimd_size_t a_stride, \
+        simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void *results,                          \
+        simsimd_size_t results_stride, simsimd_datatype_t results_type) {                                          \
+        simsimd_metric_cdist_typed_punned_t metric = (simsimd_metric_cdist_typed_punned_t)_simsimd_dispatch(       \
+            simsimd_metric_##name##_cdist_typed_k, simsimd_datatype_##extension##_k);                              \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_cdist_typed_k, simsimd_datatype_##extension##_k,                \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_cdist_typed_k,                     \
+                                                        simsimd_datatype_##extension##_k),                         \
+                           (a_count + b_count) * n * sizeof(simsimd_##type##_t),                                   \
+                           simsimd_cdist_typed_parallel(metric, _simsimd_executor, _simsimd_executor_state, a, b,  \
+                                                        a_count, a_stride, b_count, b_stride, n, results,          \
+                                                        results_stride, results_type));                            \
+    }
+
+#define SIMSIMD_DECLARATION_NORMS(extension, type)                                                                 \
+    SIMSIMD_DYNAMIC void simsimd_norms_##extension(simsimd_##type##_t const *rows, simsimd_size_t count,           \
+                                                   simsimd_size_t stride, simsimd_size_t n,                        \
+                                                   simsimd_distance_t *norms) {                                    \
+        simsimd_kernel_norms_punned_t kernel = (simsimd_kernel_norms_punned_t)_simsimd_dispatch(                   \
+            simsimd_metric_norms_k, simsimd_datatype_##extension##_k);                                             \
+        SIMSIMD_INSTRUMENT(simsimd_metric_norms_k, simsimd_datatype_##extension##_k,                               \
+                           _simsimd_dispatch_capability(simsimd_metric_norms_k, simsimd_datatype_##extension##_k), \
+                           count * n * sizeof(simsimd_##type##_t), kernel(rows, count, stride, n, norms));         \
+    }
+
+#define SIMSIMD_DECLARATION_BATCH_NORMED(name, extension, type)                                                    \
+    SIMSIMD_DYNAMIC void simsimd_##name##_batch_normed_##extension(                                                \
+        simsimd_##type##_t const *a, simsimd_##type##_t const *b, simsimd_size_t b_count, simsimd_size_t b_stride, \
+        simsimd_size_t n, simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,                     \
+        simsimd_distance_t *results) {                                                                             \
+        simsimd_metric_batch_normed_punned_t metric = (simsimd_metric_batch_normed_punned_t)_simsimd_dispatch(     \
+            simsimd_metric_##name##_batch_normed_k, simsimd_datatype_##extension##_k);                             \
+        if (!metric) {                                                                                             \
+            simsimd_size_t i;                                                                                      \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_batch_normed_k, simsimd_datatype_##extension##_k);     \
+            for (i = 0; i != b_count; ++i) *(simsimd_u64_t *)(results + i) = 0x7FF0000000000001ull;                \
+            return;                                                                                                \
+        }                                                                                                          \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_batch_normed_k, simsimd_datatype_##extension##_k,               \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_batch_normed_k,                    \
+                                                        simsimd_datatype_##extension##_k),                         \
+                           (1 + b_count) * n * sizeof(simsimd_##type##_t),                                         \
+                           simsimd_batch_normed_parallel(metric, _simsimd_executor, _simsimd_executor_state, a, b, \
+                                                         b_count, b_stride, n, a_norm, b_norms, results));         \
+    }
+
+#define SIMSIMD_DECLARATION_CDIST_NORMED(name, extension, type)                                                     \
+    SIMSIMD_DYNAMIC void simsimd_##name##_cdist_normed_##extension(                                                 \
+        simsimd_##type##_t const *a, simsimd_##type##_t const *b, simsimd_size_t a_count, simsimd_size_t a_stride,  \
+        simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const *a_norms,       \
+        simsimd_distance_t const *b_norms, void *results, simsimd_size_t results_stride,                            \
+        simsimd_datatype_t results_type) {                                                                          \
+        simsimd_metric_cdist_normed_punned_t metric = (simsimd_metric_cdist_normed_punned_t)_simsimd_dispatch(      \
+            simsimd_metric_##name##_cdist_normed_k, simsimd_datatype_##extension##_k);                              \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_cdist_normed_k, simsimd_datatype_##extension##_k,                \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_cdist_normed_k,                     \
+                                                        simsimd_datatype_##extension##_k),                          \
+                           (a_count + b_count) * n * sizeof(simsimd_##type##_t),                                    \
+                           simsimd_cdist_normed_parallel(metric, _simsimd_executor, _simsimd_executor_state, a, b,  \
+                                                         a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, \
+                                                         results, results_stride, results_type));                   \
+    }
+
+#define SIMSIMD_DECLARATION_MESH(name, extension, type)                                                             \
+    SIMSIMD_DYNAMIC void simsimd_##name##_##extension(simsimd_##type##_t const *a, simsimd_##type##_t const *b,     \
+                                                      simsimd_size_t n, simsimd_##type##_t *a_centroid,             \
+                                                      simsimd_##type##_t *b_centroid, simsimd_distance_t *result) { \
+        simsimd_metric_mesh_punned_t metric = (simsimd_metric_mesh_punned_t)_simsimd_dispatch(                      \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                                           \
+        if (!metric) {                                                                                              \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                   \
+            *(simsimd_u64_t *)result = 0x7FF0000000000001ull;                                                       \
+            return;                                                                                                 \
+        }                                                                                                           \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                             \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_k,                                  \
+                                                        simsimd_datatype_##extension##_k),                          \
+                           6 * n * sizeof(simsimd_##type##_t), metric(a, b, n, a_centroid, b_centroid, result));    \
+    }
+
+#define SIMSIMD_DECLARATION_GEOSPATIAL(name, extension, type)                                                       \
+    SIMSIMD_DYNAMIC void simsimd_##name##_##extension(                                                              \
+        simsimd_##type##_t const *a_lats, simsimd_##type##_t const *a_lons, simsimd_##type##_t const *b_lats,       \
+        simsimd_##type##_t const *b_lons, simsimd_size_t n, simsimd_distance_t *results) {                          \
+        simsimd_metric_geospatial_punned_t metric = (simsimd_metric_geospatial_punned_t)_simsimd_dispatch(          \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                                           \
+        if (!metric) {                                                                                              \
+            simsimd_size_t i;                                                                                       \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                   \
+            for (i = 0; i != n; ++i) *(simsimd_u64_t *)(results + i) = 0x7FF0000000000001ull;                       \
+            return;                                                                                                 \
+        }                                                                                                           \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                             \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_k,                                  \
+                                                        simsimd_datatype_##extension##_k),                          \
+                           4 * n * sizeof(simsimd_##type##_t), metric(a_lats, a_lons, b_lats, b_lons, n, results)); \
+    }
+
+#define SIMSIMD_DECLARATION_QUANTIZED(name, extension, query_type, database_type)                                   \
+    SIMSIMD_DYNAMIC void simsimd_##name##_##extension(                                                              \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,                  \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,                \
+        simsimd_distance_t *result) {                                                                               \
+        static simsimd_metric_quantized_punned_t metric = 0;                                                        \
+        static simsimd_capability_t used_capability = (simsimd_capability_t)0;                                      \
+        simsimd_datatype_t const datatype =                                                                         \
+            (simsimd_datatype_t)(simsimd_datatype_##query_type##_k | simsimd_datatype_##database_type##_k);         \
+        if (metric == 0) {                                                                                          \
+            simsimd_find_metric_punned(simsimd_metric_##name##_quantized_k, datatype, simsimd_capabilities(),       \
+                                       simsimd_cap_any_k, (simsimd_metric_punned_t *)(&metric), &used_capability);  \
+            if (!metric) {                                                                                          \
+                SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_quantized_k, datatype);                             \
+                *(simsimd_u64_t *)result = 0x7FF0000000000001ull;                                                   \
+                return;                                                                                             \
+            }                                                                                                       \
+        }                                                                                                           \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_quantized_k, datatype, used_capability,                          \
+                           n * (sizeof(*a) + sizeof(*b)),                                                           \
+                           metric(a, b, n, scales, zero_points, params_stride, result));                            \
+    }
+
+#define SIMSIMD_DECLARATION_PQ(name, extension, type)                                                        \
+    SIMSIMD_DYNAMIC void simsimd_##name##_##extension(simsimd_##type##_t const *codes, simsimd_size_t count, \
+                                                      simsimd_size_t subspaces, simsimd_u8_t const *table,   \
+                                                      simsimd_distance_t scale, simsimd_distance_t bias,     \
+                                                      simsimd_distance_t *results) {                         \
+        simsimd_metric_pq_punned_t metric = (simsimd_metric_pq_punned_t)_simsimd_dispatch(                   \
+            simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);                                    \
+        if (!metric) {                                                                                       \
+            simsimd_size_t i;                                                                                \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k);            \
+            for (i = 0; i != count; ++i) *(simsimd_u64_t *)(results + i) = 0x7FF0000000000001ull;            \
+            return;                                                                                          \
+        }                                                                                                    \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                      \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_k,                           \
+                                                        simsimd_datatype_##extension##_k),                   \
+                           count * subspaces * sizeof(simsimd_##type##_t),                                   \
+                           metric(codes, count, subspaces, table, scale, bias, results));                    \
+    }
+
+#define SIMSIMD_DECLARATION_RADIUS(name, extension, type)                                                          \
+    SIMSIMD_DYNAMIC void simsimd_##name##_radius_##extension(                                                      \
+        simsimd_##type##_t const *a, simsimd_##type##_t const *b, simsimd_size_t b_count, simsimd_size_t b_stride, \
+        simsimd_size_t n, simsimd_distance_t radius, simsimd_size_t *ids, simsimd_distance_t *distances,           \
+        simsimd_size_t *found) {                                                                                   \
+        simsimd_metric_radius_punned_t metric = (simsimd_metric_radius_punned_t)_simsimd_dispatch(                 \
+            simsimd_metric_##name##_radius_k, simsimd_datatype_##extension##_k);                                   \
+        if (!metric) {                                                                                             \
+            SIMSIMD_INSTRUMENT_MISS(simsimd_metric_##name##_radius_k, simsimd_datatype_##extension##_k);           \
+            *found = 0;                                                                                            \
+            return;                                                                                                \
+        }                                                                                                          \
+        SIMSIMD_INSTRUMENT(simsimd_metric_##name##_radius_k, simsimd_datatype_##extension##_k,                     \
+                           _simsimd_dispatch_capability(simsimd_metric_##name##_radius_k,                          \
+                                                        simsimd_datatype_##extension##_k),                         \
+                           (1 + b_count) * n * sizeof(simsimd_##type##_t),                                         \
+                           metric(a, b, b_count, b_stride, n, radius, ids, distances, found));                     \
     }
 
 // Dot products
 SIMSIMD_DECLARATION_DENSE(dot, i8, i8)
 SIMSIMD_DECLARATION_DENSE(dot, u8, u8)
+SIMSIMD_DECLARATION_DENSE(dot, i4x2, i4x2)
 SIMSIMD_DECLARATION_DENSE(dot, f16, f16)
 SIMSIMD_DECLARATION_DENSE(dot, bf16, bf16)
 SIMSIMD_DECLARATION_DENSE(dot, f32, f32)
@@ -154,23 +825,56 @@ SIMSIMD_DECLARATION_DENSE(vdot, f64c, f64)
 // Spatial distances
 SIMSIMD_DECLARATION_DENSE(cos, i8, i8)
 SIMSIMD_DECLARATION_DENSE(cos, u8, u8)
+SIMSIMD_DECLARATION_DENSE(cos, i4x2, i4x2)
 SIMSIMD_DECLARATION_DENSE(cos, f16, f16)
 SIMSIMD_DECLARATION_DENSE(cos, bf16, bf16)
 SIMSIMD_DECLARATION_DENSE(cos, f32, f32)
 SIMSIMD_DECLARATION_DENSE(cos, f64, f64)
 SIMSIMD_DECLARATION_DENSE(l2sq, i8, i8)
 SIMSIMD_DECLARATION_DENSE(l2sq, u8, u8)
+SIMSIMD_DECLARATION_DENSE(l2sq, i4x2, i4x2)
 SIMSIMD_DECLARATION_DENSE(l2sq, f16, f16)
 SIMSIMD_DECLARATION_DENSE(l2sq, bf16, bf16)
 SIMSIMD_DECLARATION_DENSE(l2sq, f32, f32)
 SIMSIMD_DECLARATION_DENSE(l2sq, f64, f64)
 SIMSIMD_DECLARATION_DENSE(l2, i8, i8)
 SIMSIMD_DECLARATION_DENSE(l2, u8, u8)
+SIMSIMD_DECLARATION_DENSE(l2, i4x2, i4x2)
 SIMSIMD_DECLARATION_DENSE(l2, f16, f16)
 SIMSIMD_DECLARATION_DENSE(l2, bf16, bf16)
 SIMSIMD_DECLARATION_DENSE(l2, f32, f32)
 SIMSIMD_DECLARATION_DENSE(l2, f64, f64)
 
+// Asymmetric distances to quantized rows
+SIMSIMD_DECLARATION_QUANTIZED(dot, f32i8, f32, i8)
+SIMSIMD_DECLARATION_QUANTIZED(dot, f32u8, f32, u8)
+SIMSIMD_DECLARATION_QUANTIZED(dot, f32i4x2, f32, i4x2)
+SIMSIMD_DECLARATION_QUANTIZED(dot, f16i8, f16, i8)
+SIMSIMD_DECLARATION_QUANTIZED(dot, f16u8, f16, u8)
+SIMSIMD_DECLARATION_QUANTIZED(dot, f16i4x2, f16, i4x2)
+SIMSIMD_DECLARATION_QUANTIZED(cos, f32i8, f32, i8)
+SIMSIMD_DECLARATION_QUANTIZED(cos, f32u8, f32, u8)
+SIMSIMD_DECLARATION_QUANTIZED(cos, f32i4x2, f32, i4x2)
+SIMSIMD_DECLARATION_QUANTIZED(cos, f16i8, f16, i8)
+SIMSIMD_DECLARATION_QUANTIZED(cos, f16u8, f16, u8)
+SIMSIMD_DECLARATION_QUANTIZED(cos, f16i4x2, f16, i4x2)
+SIMSIMD_DECLARATION_QUANTIZED(l2sq, f32i8, f32, i8)
+SIMSIMD_DECLARATION_QUANTIZED(l2sq, f32u8, f32, u8)
+SIMSIMD_DECLARATION_QUANTIZED(l2sq, f32i4x2, f32, i4x2)
+SIMSIMD_DECLARATION_QUANTIZED(l2sq, f16i8, f16, i8)
+SIMSIMD_DECLARATION_QUANTIZED(l2sq, f16u8, f16, u8)
+SIMSIMD_DECLARATION_QUANTIZED(l2sq, f16i4x2, f16, i4x2)
+SIMSIMD_DECLARATION_QUANTIZED(l2, f32i8, f32, i8)
+SIMSIMD_DECLARATION_QUANTIZED(l2, f32u8, f32, u8)
+SIMSIMD_DECLARATION_QUANTIZED(l2, f32i4x2, f32, i4x2)
+SIMSIMD_DECLARATION_QUANTIZED(l2, f16i8, f16, i8)
+SIMSIMD_DECLARATION_QUANTIZED(l2, f16u8, f16, u8)
+SIMSIMD_DECLARATION_QUANTIZED(l2, f16i4x2, f16, i4x2)
+
+// Product Quantization scans
+SIMSIMD_DECLARATION_PQ(pq_scan, u8, u8)
+SIMSIMD_DECLARATION_PQ(pq_scan, u4x2, u4x2)
+
 // Binary distances
 SIMSIMD_DECLARATION_DENSE(hamming, b8, b8)
 SIMSIMD_DECLARATION_DENSE(jaccard, b8, b8)
@@ -188,6 +892,18 @@ SIMSIMD_DECLARATION_DENSE(js, f64, f64)
 // Sparse sets
 SIMSIMD_DECLARATION_SPARSE(intersect, u16, u16)
 SIMSIMD_DECLARATION_SPARSE(intersect, u32, u32)
+SIMSIMD_DECLARATION_SPDOT(spdot_counts, u16, u16, i16)
+SIMSIMD_DECLARATION_SPDOT(spdot_weights, u16, u16, bf16)
+SIMSIMD_DECLARATION_SPDOT(spdot_weights, u32, u32, bf16)
+SIMSIMD_DECLARATION_SPDOT(spdot_weights_f32, u32, u32, f32)
+SIMSIMD_DECLARATION_SPARSE_BATCH(intersect, u16, u16)
+SIMSIMD_DECLARATION_SPARSE_BATCH(intersect, u32, u32)
+SIMSIMD_DECLARATION_SPDOT_BATCH(spdot_weights, u16, u16, bf16)
+
+// Byte strings
+SIMSIMD_DECLARATION_LEVENSHTEIN_BATCH(u8, u8)
+SIMSIMD_DECLARATION_ALIGNMENT_BATCH(needleman_wunsch, u8, u8)
+SIMSIMD_DECLARATION_ALIGNMENT_BATCH(smith_waterman, u8, u8)
 
 // Curved spaces
 SIMSIMD_DECLARATION_CURVED(bilinear, f64, f64)
@@ -198,6 +914,8 @@ SIMSIMD_DECLARATION_CURVED(bilinear, f16, f16)
 SIMSIMD_DECLARATION_CURVED(mahalanobis, f16, f16)
 SIMSIMD_DECLARATION_CURVED(bilinear, bf16, bf16)
 SIMSIMD_DECLARATION_CURVED(mahalanobis, bf16, bf16)
+SIMSIMD_DECLARATION_WHITEN(f32, f32)
+SIMSIMD_DECLARATION_BILINEAR_CDIST(f32, f32)
 
 // Element-wise operations
 SIMSIMD_DECLARATION_FMA(fma, f64, f64)
@@ -212,6 +930,199 @@ SIMSIMD_DECLARATION_WSUM(wsum, f16, f16)
 SIMSIMD_DECLARATION_WSUM(wsum, bf16, bf16)
 SIMSIMD_DECLARATION_WSUM(wsum, i8, i8)
 SIMSIMD_DECLARATION_WSUM(wsum, u8, u8)
+SIMSIMD_DECLARATION_SCALE(scale, f64, f64)
+SIMSIMD_DECLARATION_SCALE(scale, f32, f32)
+SIMSIMD_DECLARATION_SCALE(scale, f16, f16)
+SIMSIMD_DECLARATION_SCALE(scale, bf16, bf16)
+SIMSIMD_DECLARATION_SCALE(scale, i8, i8)
+SIMSIMD_DECLARATION_SCALE(scale, u8, u8)
+SIMSIMD_DECLARATION_ELEMENTWISE(add, f64, f64)
+SIMSIMD_DECLARATION_ELEMENTWISE(add, f32, f32)
+SIMSIMD_DECLARATION_ELEMENTWISE(add, f16, f16)
+SIMSIMD_DECLARATION_ELEMENTWISE(add, bf16, bf16)
+SIMSIMD_DECLARATION_ELEMENTWISE(add, i8, i8)
+SIMSIMD_DECLARATION_ELEMENTWISE(add, u8, u8)
+SIMSIMD_DECLARATION_ELEMENTWISE(multiply, f64, f64)
+SIMSIMD_DECLARATION_ELEMENTWISE(multiply, f32, f32)
+SIMSIMD_DECLARATION_ELEMENTWISE(multiply, f16, f16)
+SIMSIMD_DECLARATION_ELEMENTWISE(multiply, bf16, bf16)
+SIMSIMD_DECLARATION_ELEMENTWISE(multiply, i8, i8)
+SIMSIMD_DECLARATION_ELEMENTWISE(multiply, u8, u8)
+SIMSIMD_DECLARATION_CONVERT(quantize, f16, f32, f16)
+SIMSIMD_DECLARATION_CONVERT(quantize, bf16, f32, bf16)
+SIMSIMD_DECLARATION_CONVERT(quantize, i8, f32, i8)
+SIMSIMD_DECLARATION_CONVERT(quantize, u8, f32, u8)
+SIMSIMD_DECLARATION_CONVERT(quantize, b8, f32, b8)
+SIMSIMD_DECLARATION_CONVERT(dequantize, f16, f16, f32)
+SIMSIMD_DECLARATION_CONVERT(dequantize, bf16, bf16, f32)
+SIMSIMD_DECLARATION_CONVERT(dequantize, i8, i8, f32)
+SIMSIMD_DECLARATION_CONVERT(dequantize, u8, u8, f32)
+
+// Row-wise reductions
+SIMSIMD_DECLARATION_REDUCE(sum, i8, i8)
+SIMSIMD_DECLARATION_REDUCE(sum, u8, u8)
+SIMSIMD_DECLARATION_REDUCE(sum, f16, f16)
+SIMSIMD_DECLARATION_REDUCE(sum, bf16, bf16)
+SIMSIMD_DECLARATION_REDUCE(sum, f32, f32)
+SIMSIMD_DECLARATION_REDUCE(sum, f64, f64)
+SIMSIMD_DECLARATION_REDUCE(l1, i8, i8)
+SIMSIMD_DECLARATION_REDUCE(l1, u8, u8)
+SIMSIMD_DECLARATION_REDUCE(l1, f16, f16)
+SIMSIMD_DECLARATION_REDUCE(l1, bf16, bf16)
+SIMSIMD_DECLARATION_REDUCE(l1, f32, f32)
+SIMSIMD_DECLARATION_REDUCE(l1, f64, f64)
+SIMSIMD_DECLARATION_REDUCE(l2, i8, i8)
+SIMSIMD_DECLARATION_REDUCE(l2, u8, u8)
+SIMSIMD_DECLARATION_REDUCE(l2, f16, f16)
+SIMSIMD_DECLARATION_REDUCE(l2, bf16, bf16)
+SIMSIMD_DECLARATION_REDUCE(l2, f32, f32)
+SIMSIMD_DECLARATION_REDUCE(l2, f64, f64)
+SIMSIMD_DECLARATION_ARGREDUCE(min, i8, i8)
+SIMSIMD_DECLARATION_ARGREDUCE(min, u8, u8)
+SIMSIMD_DECLARATION_ARGREDUCE(min, f16, f16)
+SIMSIMD_DECLARATION_ARGREDUCE(min, bf16, bf16)
+SIMSIMD_DECLARATION_ARGREDUCE(min, f32, f32)
+SIMSIMD_DECLARATION_ARGREDUCE(min, f64, f64)
+SIMSIMD_DECLARATION_ARGREDUCE(max, i8, i8)
+SIMSIMD_DECLARATION_ARGREDUCE(max, u8, u8)
+SIMSIMD_DECLARATION_ARGREDUCE(max, f16, f16)
+SIMSIMD_DECLARATION_ARGREDUCE(max, bf16, bf16)
+SIMSIMD_DECLARATION_ARGREDUCE(max, f32, f32)
+SIMSIMD_DECLARATION_ARGREDUCE(max, f64, f64)
+
+// One-to-many batches
+SIMSIMD_DECLARATION_BATCH(dot, i8, i8)
+SIMSIMD_DECLARATION_BATCH(dot, u8, u8)
+SIMSIMD_DECLARATION_BATCH(dot, f16, f16)
+SIMSIMD_DECLARATION_BATCH(dot, bf16, bf16)
+SIMSIMD_DECLARATION_BATCH(dot, f32, f32)
+SIMSIMD_DECLARATION_BATCH(dot, f64, f64)
+SIMSIMD_DECLARATION_BATCH(cos, i8, i8)
+SIMSIMD_DECLARATION_BATCH(cos, u8, u8)
+SIMSIMD_DECLARATION_BATCH(cos, f16, f16)
+SIMSIMD_DECLARATION_BATCH(cos, bf16, bf16)
+SIMSIMD_DECLARATION_BATCH(cos, f32, f32)
+SIMSIMD_DECLARATION_BATCH(cos, f64, f64)
+SIMSIMD_DECLARATION_BATCH(l2sq, i8, i8)
+SIMSIMD_DECLARATION_BATCH(l2sq, u8, u8)
+SIMSIMD_DECLARATION_BATCH(l2sq, f16, f16)
+SIMSIMD_DECLARATION_BATCH(l2sq, bf16, bf16)
+SIMSIMD_DECLARATION_BATCH(l2sq, f32, f32)
+SIMSIMD_DECLARATION_BATCH(l2sq, f64, f64)
+SIMSIMD_DECLARATION_BATCH(l2, i8, i8)
+SIMSIMD_DECLARATION_BATCH(l2, u8, u8)
+SIMSIMD_DECLARATION_BATCH(l2, f16, f16)
+SIMSIMD_DECLARATION_BATCH(l2, bf16, bf16)
+SIMSIMD_DECLARATION_BATCH(l2, f32, f32)
+SIMSIMD_DECLARATION_BATCH(l2, f64, f64)
+SIMSIMD_DECLARATION_BATCH(hamming, b8, b8)
+SIMSIMD_DECLARATION_BATCH(jaccard, b8, b8)
+
+// Many-to-many distance matrices
+SIMSIMD_DECLARATION_CDIST(dot, i8, i8)
+SIMSIMD_DECLARATION_CDIST(dot, f16, f16)
+SIMSIMD_DECLARATION_CDIST(dot, bf16, bf16)
+SIMSIMD_DECLARATION_CDIST(dot, f32, f32)
+SIMSIMD_DECLARATION_CDIST(cos, i8, i8)
+SIMSIMD_DECLARATION_CDIST(cos, f16, f16)
+SIMSIMD_DECLARATION_CDIST(cos, bf16, bf16)
+SIMSIMD_DECLARATION_CDIST(cos, f32, f32)
+SIMSIMD_DECLARATION_CDIST(l2sq, i8, i8)
+SIMSIMD_DECLARATION_CDIST(l2sq, f16, f16)
+SIMSIMD_DECLARATION_CDIST(l2sq, bf16, bf16)
+SIMSIMD_DECLARATION_CDIST(l2sq, f32, f32)
+SIMSIMD_DECLARATION_CDIST(l2, i8, i8)
+SIMSIMD_DECLARATION_CDIST(l2, f16, f16)
+SIMSIMD_DECLARATION_CDIST(l2, bf16, bf16)
+SIMSIMD_DECLARATION_CDIST(l2, f32, f32)
+SIMSIMD_DECLARATION_CDIST(hamming, b8, b8)
+SIMSIMD_DECLARATION_CDIST(jaccard, b8, b8)
+
+// Many-to-many distance matrices in a custom output precision
+SIMSIMD_DECLARATION_CDIST_TYPED(dot, i8, i8)
+SIMSIMD_DECLARATION_CDIST_TYPED(dot, f16, f16)
+SIMSIMD_DECLARATION_CDIST_TYPED(dot, bf16, bf16)
+SIMSIMD_DECLARATION_CDIST_TYPED(dot, f32, f32)
+SIMSIMD_DECLARATION_CDIST_TYPED(cos, i8, i8)
+SIMSIMD_DECLARATION_CDIST_TYPED(cos, f16, f16)
+SIMSIMD_DECLARATION_CDIST_TYPED(cos, bf16, bf16)
+SIMSIMD_DECLARATION_CDIST_TYPED(cos, f32, f32)
+SIMSIMD_DECLARATION_CDIST_TYPED(l2sq, i8, i8)
+SIMSIMD_DECLARATION_CDIST_TYPED(l2sq, f16, f16)
+SIMSIMD_DECLARATION_CDIST_TYPED(l2sq, bf16, bf16)
+SIMSIMD_DECLARATION_CDIST_TYPED(l2sq, f32, f32)
+SIMSIMD_DECLARATION_CDIST_TYPED(l2, i8, i8)
+SIMSIMD_DECLARATION_CDIST_TYPED(l2, f16, f16)
+SIMSIMD_DECLARATION_CDIST_TYPED(l2, bf16, bf16)
+SIMSIMD_DECLARATION_CDIST_TYPED(l2, f32, f32)
+
+// Squared norms of many rows and the distances reusing them
+SIMSIMD_DECLARATION_NORMS(i8, i8)
+SIMSIMD_DECLARATION_NORMS(u8, u8)
+SIMSIMD_DECLARATION_NORMS(f16, f16)
+SIMSIMD_DECLARATION_NORMS(bf16, bf16)
+SIMSIMD_DECLARATION_NORMS(f32, f32)
+SIMSIMD_DECLARATION_NORMS(f64, f64)
+SIMSIMD_DECLARATION_BATCH_NORMED(cos, i8, i8)
+SIMSIMD_DECLARATION_BATCH_NORMED(cos, u8, u8)
+SIMSIMD_DECLARATION_BATCH_NORMED(cos, f16, f16)
+SIMSIMD_DECLARATION_BATCH_NORMED(cos, bf16, bf16)
+SIMSIMD_DECLARATION_BATCH_NORMED(cos, f32, f32)
+SIMSIMD_DECLARATION_BATCH_NORMED(cos, f64, f64)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2sq, i8, i8)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2sq, u8, u8)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2sq, f16, f16)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2sq, bf16, bf16)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2sq, f32, f32)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2sq, f64, f64)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2, i8, i8)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2, u8, u8)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2, f16, f16)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2, bf16, bf16)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2, f32, f32)
+SIMSIMD_DECLARATION_BATCH_NORMED(l2, f64, f64)
+SIMSIMD_DECLARATION_CDIST_NORMED(cos, i8, i8)
+SIMSIMD_DECLARATION_CDIST_NORMED(cos, f16, f16)
+SIMSIMD_DECLARATION_CDIST_NORMED(cos, bf16, bf16)
+SIMSIMD_DECLARATION_CDIST_NORMED(cos, f32, f32)
+SIMSIMD_DECLARATION_CDIST_NORMED(l2sq, i8, i8)
+SIMSIMD_DECLARATION_CDIST_NORMED(l2sq, f16, f16)
+SIMSIMD_DECLARATION_CDIST_NORMED(l2sq, bf16, bf16)
+SIMSIMD_DECLARATION_CDIST_NORMED(l2sq, f32, f32)
+SIMSIMD_DECLARATION_CDIST_NORMED(l2, i8, i8)
+SIMSIMD_DECLARATION_CDIST_NORMED(l2, f16, f16)
+SIMSIMD_DECLARATION_CDIST_NORMED(l2, bf16, bf16)
+SIMSIMD_DECLARATION_CDIST_NORMED(l2, f32, f32)
+
+// Threshold searches
+SIMSIMD_DECLARATION_RADIUS(hamming, b8, b8)
+SIMSIMD_DECLARATION_RADIUS(jaccard, b8, b8)
+
+// Geospatial distances
+SIMSIMD_DECLARATION_GEOSPATIAL(haversine, f64, f64)
+SIMSIMD_DECLARATION_GEOSPATIAL(haversine, f32, f32)
+SIMSIMD_DECLARATION_GEOSPATIAL(hav, f64, f64)
+SIMSIMD_DECLARATION_GEOSPATIAL(hav, f32, f32)
+SIMSIMD_DECLARATION_GEOSPATIAL(vincenty, f64, f64)
+SIMSIMD_DECLARATION_GEOSPATIAL(vincenty, f32, f32)
+
+// Rigid 3D point clouds
+SIMSIMD_DECLARATION_MESH(rmsd, f64, f64)
+SIMSIMD_DECLARATION_MESH(rmsd, f32, f32)
+SIMSIMD_DECLARATION_MESH(rmsd, f16, f16)
+SIMSIMD_DECLARATION_MESH(rmsd, bf16, bf16)
+SIMSIMD_DECLARATION_MESH(kabsch, f64, f64)
+SIMSIMD_DECLARATION_MESH(kabsch, f32, f32)
+SIMSIMD_DECLARATION_MESH(kabsch, f16, f16)
+SIMSIMD_DECLARATION_MESH(kabsch, bf16, bf16)
+SIMSIMD_DECLARATION_BATCH(rmsd, f64, f64)
+SIMSIMD_DECLARATION_BATCH(rmsd, f32, f32)
+SIMSIMD_DECLARATION_BATCH(rmsd, f16, f16)
+SIMSIMD_DECLARATION_BATCH(rmsd, bf16, bf16)
+SIMSIMD_DECLARATION_BATCH(kabsch, f64, f64)
+SIMSIMD_DECLARATION_BATCH(kabsch, f32, f32)
+SIMSIMD_DECLARATION_BATCH(kabsch, f16, f16)
+SIMSIMD_DECLARATION_BATCH(kabsch, bf16, bf16)
 
 SIMSIMD_DYNAMIC int simsimd_uses_neon(void) { return (simsimd_capabilities() & simsimd_cap_neon_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_neon_f16(void) { return (simsimd_capabilities() & simsimd_cap_neon_f16_k) != 0; }
@@ -221,11 +1132,16 @@ SIMSIMD_DYNAMIC int simsimd_uses_sve(void) { return (simsimd_capabilities() & si
 SIMSIMD_DYNAMIC int simsimd_uses_sve_f16(void) { return (simsimd_capabilities() & simsimd_cap_sve_f16_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_sve_bf16(void) { return (simsimd_capabilities() & simsimd_cap_sve_bf16_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_sve_i8(void) { return (simsimd_capabilities() & simsimd_cap_sve_i8_k) != 0; }
+SIMSIMD_DYNAMIC int simsimd_uses_sve2(void) { return (simsimd_capabilities() & simsimd_cap_sve2_k) != 0; }
+SIMSIMD_DYNAMIC int simsimd_uses_sve2p1(void) { return (simsimd_capabilities() & simsimd_cap_sve2p1_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_haswell(void) { return (simsimd_capabilities() & simsimd_cap_haswell_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_skylake(void) { return (simsimd_capabilities() & simsimd_cap_skylake_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_ice(void) { return (simsimd_capabilities() & simsimd_cap_ice_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_genoa(void) { return (simsimd_capabilities() & simsimd_cap_genoa_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_sapphire(void) { return (simsimd_capabilities() & simsimd_cap_sapphire_k) != 0; }
+SIMSIMD_DYNAMIC int simsimd_uses_sapphire_amx(void) {
+    return (simsimd_capabilities() & simsimd_cap_sapphire_amx_k) != 0;
+}
 SIMSIMD_DYNAMIC int simsimd_uses_turin(void) { return (simsimd_capabilities() & simsimd_cap_turin_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_sierra(void) { return (simsimd_capabilities() & simsimd_cap_sierra_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_dynamic_dispatch(void) { return 1; }
@@ -237,95 +1153,841 @@ SIMSIMD_DYNAMIC simsimd_capability_t simsimd_capabilities(void) {
 
     static_capabilities = _simsimd_capabilities_implementation();
 
-    // In multithreaded applications we need to ensure that the function pointers are pre-initialized,
-    // so the first time we are probing for capabilities, we should also probe all of our metrics
-    // with dummy inputs:
+    // Most kernels come from the `_simsimd_dispatch_table`, but the asymmetric ones are cached lazily,
+    // as their datatypes combine two bits. In multithreaded applications we need to ensure that those
+    // function pointers are pre-initialized, so we probe them with dummy inputs:
     simsimd_distance_t dummy_results_buffer[2];
     simsimd_distance_t *dummy_results = &dummy_results_buffer[0];
     void *x = 0;
 
-    // Dense:
-    simsimd_dot_i8((simsimd_i8_t *)x, (simsimd_i8_t *)x, 0, dummy_results);
-    simsimd_dot_u8((simsimd_u8_t *)x, (simsimd_u8_t *)x, 0, dummy_results);
-    simsimd_dot_f16((simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, dummy_results);
-    simsimd_dot_bf16((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, dummy_results);
-    simsimd_dot_f32((simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, dummy_results);
-    simsimd_dot_f64((simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, dummy_results);
-
-    simsimd_dot_f16c((simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, dummy_results);
-    simsimd_dot_bf16c((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, dummy_results);
-    simsimd_dot_f32c((simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, dummy_results);
-    simsimd_dot_f64c((simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, dummy_results);
-    simsimd_vdot_f16c((simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, dummy_results);
-    simsimd_vdot_bf16c((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, dummy_results);
-    simsimd_vdot_f32c((simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, dummy_results);
-    simsimd_vdot_f64c((simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, dummy_results);
-
-    simsimd_cos_i8((simsimd_i8_t *)x, (simsimd_i8_t *)x, 0, dummy_results);
-    simsimd_cos_u8((simsimd_u8_t *)x, (simsimd_u8_t *)x, 0, dummy_results);
-    simsimd_cos_f16((simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, dummy_results);
-    simsimd_cos_bf16((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, dummy_results);
-    simsimd_cos_f32((simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, dummy_results);
-    simsimd_cos_f64((simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, dummy_results);
-
-    simsimd_l2sq_i8((simsimd_i8_t *)x, (simsimd_i8_t *)x, 0, dummy_results);
-    simsimd_l2sq_u8((simsimd_u8_t *)x, (simsimd_u8_t *)x, 0, dummy_results);
-    simsimd_l2sq_f16((simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, dummy_results);
-    simsimd_l2sq_bf16((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, dummy_results);
-    simsimd_l2sq_f32((simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, dummy_results);
-    simsimd_l2sq_f64((simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, dummy_results);
-
-    simsimd_l2_i8((simsimd_i8_t *)x, (simsimd_i8_t *)x, 0, dummy_results);
-    simsimd_l2_i8((simsimd_i8_t *)x, (simsimd_i8_t *)x, 0, dummy_results);
-    simsimd_l2_u8((simsimd_u8_t *)x, (simsimd_u8_t *)x, 0, dummy_results);
-    simsimd_l2_f16((simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, dummy_results);
-    simsimd_l2_bf16((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, dummy_results);
-    simsimd_l2_f32((simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, dummy_results);
-    simsimd_l2_f64((simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, dummy_results);
-
-    simsimd_hamming_b8((simsimd_b8_t *)x, (simsimd_b8_t *)x, 0, dummy_results);
-    simsimd_jaccard_b8((simsimd_b8_t *)x, (simsimd_b8_t *)x, 0, dummy_results);
-
-    simsimd_kl_f16((simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, dummy_results);
-    simsimd_kl_bf16((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, dummy_results);
-    simsimd_kl_f32((simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, dummy_results);
-    simsimd_kl_f64((simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, dummy_results);
-    simsimd_js_f16((simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, dummy_results);
-    simsimd_js_bf16((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, dummy_results);
-    simsimd_js_f32((simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, dummy_results);
-    simsimd_js_f64((simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, dummy_results);
-
-    // Sparse
-    simsimd_intersect_u16((simsimd_u16_t *)x, (simsimd_u16_t *)x, 0, 0, dummy_results);
-    simsimd_intersect_u32((simsimd_u32_t *)x, (simsimd_u32_t *)x, 0, 0, dummy_results);
-
-    // Curved:
-    simsimd_bilinear_f64((simsimd_f64_t *)x, (simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, dummy_results);
-    simsimd_mahalanobis_f64((simsimd_f64_t *)x, (simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, dummy_results);
-    simsimd_bilinear_f32((simsimd_f32_t *)x, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, dummy_results);
-    simsimd_mahalanobis_f32((simsimd_f32_t *)x, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, dummy_results);
-    simsimd_bilinear_f16((simsimd_f16_t *)x, (simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, dummy_results);
-    simsimd_mahalanobis_f16((simsimd_f16_t *)x, (simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, dummy_results);
-    simsimd_bilinear_bf16((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, dummy_results);
-    simsimd_mahalanobis_bf16((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, dummy_results);
-
-    // Elementwise
-    simsimd_wsum_f64((simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, 0, 0, (simsimd_f64_t *)x);
-    simsimd_wsum_f32((simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, 0, 0, (simsimd_f32_t *)x);
-    simsimd_wsum_f16((simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, 0, 0, (simsimd_f16_t *)x);
-    simsimd_wsum_bf16((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, 0, 0, (simsimd_bf16_t *)x);
-    simsimd_wsum_i8((simsimd_i8_t *)x, (simsimd_i8_t *)x, 0, 0, 0, (simsimd_i8_t *)x);
-    simsimd_wsum_u8((simsimd_u8_t *)x, (simsimd_u8_t *)x, 0, 0, 0, (simsimd_u8_t *)x);
-    simsimd_fma_f64((simsimd_f64_t *)x, (simsimd_f64_t *)x, (simsimd_f64_t *)x, 0, 0, 0, (simsimd_f64_t *)x);
-    simsimd_fma_f32((simsimd_f32_t *)x, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0, 0, 0, (simsimd_f32_t *)x);
-    simsimd_fma_f16((simsimd_f16_t *)x, (simsimd_f16_t *)x, (simsimd_f16_t *)x, 0, 0, 0, (simsimd_f16_t *)x);
-    simsimd_fma_bf16((simsimd_bf16_t *)x, (simsimd_bf16_t *)x, (simsimd_bf16_t *)x, 0, 0, 0, (simsimd_bf16_t *)x);
-    simsimd_fma_i8((simsimd_i8_t *)x, (simsimd_i8_t *)x, (simsimd_i8_t *)x, 0, 0, 0, (simsimd_i8_t *)x);
-    simsimd_fma_u8((simsimd_u8_t *)x, (simsimd_u8_t *)x, (simsimd_u8_t *)x, 0, 0, 0, (simsimd_u8_t *)x);
+    simsimd_dot_f32i8((simsimd_f32_t *)x, (simsimd_i8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                      dummy_results);
+    simsimd_dot_f32u8((simsimd_f32_t *)x, (simsimd_u8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                      dummy_results);
+    simsimd_dot_f32i4x2((simsimd_f32_t *)x, (simsimd_i4x2_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                        dummy_results);
+    simsimd_dot_f16i8((simsimd_f16_t *)x, (simsimd_i8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                      dummy_results);
+    simsimd_dot_f16u8((simsimd_f16_t *)x, (simsimd_u8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                      dummy_results);
+    simsimd_dot_f16i4x2((simsimd_f16_t *)x, (simsimd_i4x2_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                        dummy_results);
+    simsimd_cos_f32i8((simsimd_f32_t *)x, (simsimd_i8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                      dummy_results);
+    simsimd_cos_f32u8((simsimd_f32_t *)x, (simsimd_u8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                      dummy_results);
+    simsimd_cos_f32i4x2((simsimd_f32_t *)x, (simsimd_i4x2_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                        dummy_results);
+    simsimd_cos_f16i8((simsimd_f16_t *)x, (simsimd_i8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                      dummy_results);
+    simsimd_cos_f16u8((simsimd_f16_t *)x, (simsimd_u8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                      dummy_results);
+    simsimd_cos_f16i4x2((simsimd_f16_t *)x, (simsimd_i4x2_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                        dummy_results);
+    simsimd_l2sq_f32i8((simsimd_f32_t *)x, (simsimd_i8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                       dummy_results);
+    simsimd_l2sq_f32u8((simsimd_f32_t *)x, (simsimd_u8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                       dummy_results);
+    simsimd_l2sq_f32i4x2((simsimd_f32_t *)x, (simsimd_i4x2_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                         dummy_results);
+    simsimd_l2sq_f16i8((simsimd_f16_t *)x, (simsimd_i8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                       dummy_results);
+    simsimd_l2sq_f16u8((simsimd_f16_t *)x, (simsimd_u8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                       dummy_results);
+    simsimd_l2sq_f16i4x2((simsimd_f16_t *)x, (simsimd_i4x2_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                         dummy_results);
+    simsimd_l2_f32i8((simsimd_f32_t *)x, (simsimd_i8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                     dummy_results);
+    simsimd_l2_f32u8((simsimd_f32_t *)x, (simsimd_u8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                     dummy_results);
+    simsimd_l2_f32i4x2((simsimd_f32_t *)x, (simsimd_i4x2_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                       dummy_results);
+    simsimd_l2_f16i8((simsimd_f16_t *)x, (simsimd_i8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                     dummy_results);
+    simsimd_l2_f16u8((simsimd_f16_t *)x, (simsimd_u8_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                     dummy_results);
+    simsimd_l2_f16i4x2((simsimd_f16_t *)x, (simsimd_i4x2_t *)x, 0, (simsimd_f32_t *)x, (simsimd_f32_t *)x, 0,
+                       dummy_results);
 
+    // The warm-up calls above shouldn't show up in the usage counters.
+    simsimd_instrumentation_reset();
     return static_capabilities;
 }
 
+SIMSIMD_DYNAMIC simsimd_dispatch_table_t const *simsimd_dispatch_table(void) {
+    if (!_simsimd_dispatch_table_ready) _simsimd_dispatch_table_load();
+    return &_simsimd_dispatch_table;
+}
+
+SIMSIMD_INTERNAL simsimd_f64_t _simsimd_tuning_seconds(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER ticks, frequency;
+    QueryPerformanceCounter(&ticks);
+    QueryPerformanceFrequency(&frequency);
+    return (simsimd_f64_t)ticks.QuadPart / (simsimd_f64_t)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (simsimd_f64_t)now.tv_sec + (simsimd_f64_t)now.tv_nsec * 1e-9;
+#endif
+}
+
+/**
+ *  @brief  Measures the best of a few rounds of `repetitions` calls, to filter out preemptions and page faults.
+ */
+SIMSIMD_INTERNAL simsimd_f64_t _simsimd_tuning_measure(simsimd_metric_dense_punned_t metric, void const *a,
+                                                      void const *b, simsimd_size_t n,
+                                                      simsimd_size_t repetitions) {
+    simsimd_distance_t results[2]; // Complex products export two scalars
+    simsimd_f64_t best = 0;
+    simsimd_size_t round, i;
+    metric(a, b, n, results);
+    for (round = 0; round != 3; ++round) {
+        simsimd_f64_t const start = _simsimd_tuning_seconds();
+        for (i = 0; i != repetitions; ++i) metric(a, b, n, results);
+        simsimd_f64_t const elapsed = _simsimd_tuning_seconds() - start;
+        if (round == 0 || elapsed < best) best = elapsed;
+    }
+    return best;
+}
+
+/**
+ *  @brief  Resolves the kernels of the winners in `_simsimd_tuning`, ignoring the ones this machine lacks,
+ *          like those loaded from a file calibrated elsewhere.
+ */
+SIMSIMD_INTERNAL void _simsimd_tuning_apply(void) {
+    simsimd_capability_t const supported = simsimd_capabilities();
+    simsimd_size_t kind, kind_slot, datatype_slot, bucket;
+    int enabled = 0;
+    memset(_simsimd_tuned, 0, sizeof(_simsimd_tuned));
+    for (kind = 0; kind != simsimd_dispatch_kinds_k; ++kind) {
+        if (!(kind_slot = simsimd_tuning_kind_slot((simsimd_metric_kind_t)kind))) continue;
+        for (datatype_slot = 1; datatype_slot != simsimd_dispatch_datatypes_k; ++datatype_slot)
+            for (bucket = 0; bucket != simsimd_tuning_buckets_k; ++bucket) {
+                simsimd_capability_t const winner = _simsimd_tuning.winners[kind_slot][datatype_slot][bucket];
+                simsimd_metric_punned_t metric = 0;
+                simsimd_capability_t used_capability = simsimd_cap_serial_k;
+                if (!winner) continue;
+                simsimd_find_metric_punned((simsimd_metric_kind_t)kind, (simsimd_datatype_t)(1 << datatype_slot),
+                                           supported, winner, &metric, &used_capability);
+                if (!metric || used_capability != winner) continue;
+                _simsimd_tuned[kind_slot][datatype_slot][bucket] = metric;
+                enabled = 1;
+            }
+    }
+    _simsimd_tuning_enabled = enabled;
+}
+
+SIMSIMD_DYNAMIC void simsimd_tuning_calibrate(simsimd_capability_t allowed, simsimd_size_t repetitions) {
+    simsimd_capability_t const supported = simsimd_capabilities();
+    simsimd_size_t const longest = (simsimd_size_t)32 << (simsimd_tuning_buckets_k - 1);
+    simsimd_size_t const bytes = longest * sizeof(simsimd_f64_t);
+    simsimd_size_t kind, kind_slot, datatype_slot, bucket, i;
+    simsimd_metric_punned_t metrics[32];
+    simsimd_capability_t capabilities[32];
+
+    // The inputs are filled with bytes that decode into small positive numbers in every datatype,
+    // as required by the probability divergences
+    void *a = malloc(bytes), *b = malloc(bytes);
+    if (!a || !b) {
+        free(a), free(b);
+        return;
+    }
+    memset(a, 0x3C, bytes), memset(b, 0x3D, bytes);
+    if (!repetitions) repetitions = 1;
+
+    memset(&_simsimd_tuning, 0, sizeof(_simsimd_tuning));
+    for (kind = 0; kind != simsimd_dispatch_kinds_k; ++kind) {
+        if (!(kind_slot = simsimd_tuning_kind_slot((simsimd_metric_kind_t)kind))) continue;
+        for (datatype_slot = 1; datatype_slot != simsimd_dispatch_datatypes_k; ++datatype_slot) {
+            simsimd_size_t const count = simsimd_find_metric_candidates(
+                (simsimd_metric_kind_t)kind, (simsimd_datatype_t)(1 << datatype_slot), supported, allowed, metrics,
+                capabilities, sizeof(metrics) / sizeof(metrics[0]));
+            if (count < 2) continue; // Nothing to choose from
+            for (bucket = 0; bucket != simsimd_tuning_buckets_k; ++bucket) {
+                simsimd_size_t const n = (simsimd_size_t)32 << bucket;
+                simsimd_f64_t best_seconds = 0;
+                simsimd_capability_t winner = capabilities[0];
+                for (i = 0; i != count; ++i) {
+                    simsimd_f64_t const seconds = _simsimd_tuning_measure(metrics[i], a, b, n, repetitions);
+                    if (i == 0 || seconds < best_seconds) best_seconds = seconds, winner = capabilities[i];
+                }
+                _simsimd_tuning.winners[kind_slot][datatype_slot][bucket] = winner;
+            }
+        }
+    }
+    free(a), free(b);
+    _simsimd_tuning_apply();
+}
+
+SIMSIMD_DYNAMIC int simsimd_tuning_save(char const *path) {
+    simsimd_size_t kind, kind_slot, datatype_slot, bucket;
+    FILE *file = fopen(path, "w");
+    if (!file) return 0;
+
+    // One line per winner, listing the metric kind, datatype, length bucket, and capability
+    fprintf(file, "simsimd-tuning 1\n");
+    for (kind = 0; kind != simsimd_dispatch_kinds_k; ++kind) {
+        if (!(kind_slot = simsimd_tuning_kind_slot((simsimd_metric_kind_t)kind))) continue;
+        for (datatype_slot = 1; datatype_slot != simsimd_dispatch_datatypes_k; ++datatype_slot)
+            for (bucket = 0; bucket != simsimd_tuning_buckets_k; ++bucket) {
+                simsimd_capability_t const winner = _simsimd_tuning.winners[kind_slot][datatype_slot][bucket];
+                if (winner)
+                    fprintf(file, "%u %u %u %u\n", (unsigned)kind, 1u << datatype_slot, (unsigned)bucket,
+                            (unsigned)winner);
+            }
+    }
+    return fclose(file) == 0;
+}
+
+SIMSIMD_DYNAMIC int simsimd_tuning_load(char const *path) {
+    simsimd_tuning_table_t loaded;
+    unsigned version, kind, datatype, bucket, winner;
+    simsimd_size_t kind_slot, datatype_slot;
+    int complete;
+    FILE *file = fopen(path, "r");
+    if (!file) return 0;
+    if (fscanf(file, "simsimd-tuning %u", &version) != 1 || version != 1) {
+        fclose(file);
+        return 0;
+    }
+
+    memset(&loaded, 0, sizeof(loaded));
+    while (fscanf(file, "%u %u %u %u", &kind, &datatype, &bucket, &winner) == 4) {
+        kind_slot = kind < simsimd_dispatch_kinds_k ? simsimd_tuning_kind_slot((simsimd_metric_kind_t)kind) : 0;
+        datatype_slot = simsimd_dispatch_datatype_slot((simsimd_datatype_t)datatype);
+        if (!kind_slot || !datatype_slot || bucket >= simsimd_tuning_buckets_k) continue;
+        loaded.winners[kind_slot][datatype_slot][bucket] = (simsimd_capability_t)winner;
+    }
+    complete = feof(file) != 0;
+    fclose(file);
+    if (!complete) return 0;
+
+    _simsimd_tuning = loaded;
+    _simsimd_tuning_apply();
+    return 1;
+}
+
+SIMSIMD_DYNAMIC void simsimd_tuning_reset(void) {
+    _simsimd_tuning_enabled = 0;
+    memset(&_simsimd_tuning, 0, sizeof(_simsimd_tuning));
+    memset(_simsimd_tuned, 0, sizeof(_simsimd_tuned));
+}
+
+SIMSIMD_DYNAMIC simsimd_tuning_table_t const *simsimd_tuning_table(void) { return &_simsimd_tuning; }
+
+/**
+ *  @brief  State shared by the top-k searches of many queries, that split every block of candidates
+ *          into `slices` parts with their own heaps, if there are fewer queries than threads.
+ */
+typedef struct {
+    simsimd_metric_punned_t metric;
+    simsimd_metric_batch_punned_t batch;
+    simsimd_metric_kind_t used_kind; //< The one-to-many kind, if `batch` is available, or the pairwise one
+    int largest;
+    simsimd_u8_t const *queries;
+    simsimd_size_t queries_count, queries_stride;
+    simsimd_u8_t const *rows;
+    simsimd_size_t rows_count, first_id, stride, n;
+    simsimd_size_t k, slices, heaps; //< Every query has `slices` heaps, each scanning a part of the block
+    simsimd_size_t *counts;
+    simsimd_size_t *ids;
+    simsimd_distance_t *distances;
+} _simsimd_topk_tasks_t;
+
+SIMSIMD_INTERNAL void _simsimd_topk_task(void *context, simsimd_size_t task) {
+    _simsimd_topk_tasks_t const *tasks = (_simsimd_topk_tasks_t const *)context;
+    simsimd_size_t const query = task / tasks->slices, slice = task % tasks->slices;
+    simsimd_size_t const slice_size = (tasks->rows_count + tasks->slices - 1) / tasks->slices;
+    simsimd_size_t const first = slice * slice_size;
+    if (first >= tasks->rows_count) return;
+    simsimd_size_t const count = tasks->rows_count - first < slice_size ? tasks->rows_count - first : slice_size;
+    simsimd_topk_scan(tasks->metric, tasks->batch, tasks->largest, tasks->queries + query * tasks->queries_stride,
+                      tasks->rows + first * tasks->stride, count, tasks->stride, tasks->n, tasks->first_id + first,
+                      tasks->k, tasks->counts + task, tasks->ids + task * tasks->k,
+                      tasks->distances + task * tasks->k);
+}
+
+/**
+ *  @brief  Resolves the kernels and allocates the heaps, returning 0 if the metric isn't supported
+ *          or the memory is exhausted. The heaps must be released with `_simsimd_topk_tasks_free`.
+ */
+SIMSIMD_INTERNAL int _simsimd_topk_tasks_init(_simsimd_topk_tasks_t *tasks, simsimd_metric_kind_t kind,
+                                              simsimd_datatype_t datatype, void const *queries,
+                                              simsimd_size_t queries_count, simsimd_size_t queries_stride,
+                                              simsimd_size_t stride, simsimd_size_t n, simsimd_size_t k) {
+    simsimd_metric_kind_t const batch_kind = simsimd_metric_batch_kind(kind);
+    simsimd_size_t const threads = _simsimd_executor ? simsimd_get_threads() : 1;
+    memset(tasks, 0, sizeof(*tasks));
+    tasks->metric = _simsimd_dispatch(kind, datatype);
+    if (!tasks->metric) return 0;
+    tasks->batch = batch_kind != simsimd_metric_unknown_k
+                       ? (simsimd_metric_batch_punned_t)_simsimd_dispatch(batch_kind, datatype)
+                       : NULL;
+    tasks->used_kind = tasks->batch ? batch_kind : kind;
+    tasks->largest = kind == simsimd_metric_dot_k || kind == simsimd_metric_vdot_k;
+    tasks->queries = (simsimd_u8_t const *)queries, tasks->queries_count = queries_count;
+    tasks->queries_stride = queries_stride, tasks->stride = stride, tasks->n = n, tasks->k = k;
+    tasks->slices = queries_count < threads ? (threads + queries_count - 1) / queries_count : 1;
+    tasks->heaps = queries_count * tasks->slices;
+    tasks->counts = (simsimd_size_t *)calloc(tasks->heaps, sizeof(simsimd_size_t));
+    tasks->ids = (simsimd_size_t *)malloc(tasks->heaps * k * sizeof(simsimd_size_t));
+    tasks->distances = (simsimd_distance_t *)malloc(tasks->heaps * k * sizeof(simsimd_distance_t));
+    return tasks->counts && tasks->ids && tasks->distances;
+}
+
+SIMSIMD_INTERNAL void _simsimd_topk_tasks_free(_simsimd_topk_tasks_t *tasks) {
+    free(tasks->counts), free(tasks->ids), free(tasks->distances);
+}
+
+/**
+ *  @brief  Offers `rows_count` candidates, starting with `first_id`, to the heaps of all queries.
+ */
+SIMSIMD_INTERNAL void _simsimd_topk_tasks_scan(_simsimd_topk_tasks_t *tasks, void const *rows,
+                                               simsimd_size_t rows_count, simsimd_size_t first_id) {
+    simsimd_size_t i;
+    tasks->rows = (simsimd_u8_t const *)rows, tasks->rows_count = rows_count, tasks->first_id = first_id;
+    if (_simsimd_executor && tasks->heaps > 1)
+        _simsimd_executor(_simsimd_executor_state, &_simsimd_topk_task, tasks, tasks->heaps);
+    else
+        for (i = 0; i != tasks->heaps; ++i) _simsimd_topk_task(tasks, i);
+}
+
+/**
+ *  @brief  Merges the slices into the first heap of every query and exports them sorted.
+ */
+SIMSIMD_INTERNAL void _simsimd_topk_tasks_export(_simsimd_topk_tasks_t *tasks, simsimd_size_t *ids,
+                                                 simsimd_distance_t *distances, simsimd_size_t *counts) {
+    simsimd_size_t const k = tasks->k;
+    simsimd_size_t i, slice;
+    for (i = 0; i != tasks->queries_count; ++i) {
+        simsimd_size_t const heap = i * tasks->slices;
+        simsimd_size_t *found_ids = tasks->ids + heap * k;
+        simsimd_distance_t *found_distances = tasks->distances + heap * k;
+        for (slice = 1; slice < tasks->slices; ++slice)
+            simsimd_topk_merge(k, tasks->counts + heap, found_ids, found_distances, tasks->counts[heap + slice],
+                               found_ids + slice * k, found_distances + slice * k);
+        simsimd_topk_sort(tasks->counts[heap], found_ids, found_distances, tasks->largest);
+        counts[i] = tasks->counts[heap];
+        memcpy(ids + i * k, found_ids, counts[i] * sizeof(simsimd_size_t));
+        memcpy(distances + i * k, found_distances, counts[i] * sizeof(simsimd_distance_t));
+    }
+}
+
+SIMSIMD_DYNAMIC int simsimd_topk_cdist(                                                                //
+    simsimd_metric_kind_t kind, simsimd_datatype_t datatype,                                           //
+    void const *queries, simsimd_size_t queries_count, simsimd_size_t queries_stride,                  //
+    void const *b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_size_t k, //
+    simsimd_size_t *ids, simsimd_distance_t *distances, simsimd_size_t *counts) {
+    _simsimd_topk_tasks_t tasks;
+    simsimd_size_t i;
+    for (i = 0; i != queries_count; ++i) counts[i] = 0;
+    if (!_simsimd_dispatch(kind, datatype)) {
+        SIMSIMD_INSTRUMENT_MISS(kind, datatype);
+        return 0;
+    }
+    if (!k || !queries_count) return 1;
+    if (!_simsimd_topk_tasks_init(&tasks, kind, datatype, queries, queries_count, queries_stride, b_stride, n, k)) {
+        _simsimd_topk_tasks_free(&tasks);
+        return 0;
+    }
+    SIMSIMD_INSTRUMENT(tasks.used_kind, datatype, _simsimd_dispatch_capability(tasks.used_kind, datatype),
+                       queries_count * queries_stride + b_count * b_stride,
+                       _simsimd_topk_tasks_scan(&tasks, b, b_count, 0));
+    _simsimd_topk_tasks_export(&tasks, ids, distances, counts);
+    _simsimd_topk_tasks_free(&tasks);
+    return 1;
+}
+
+SIMSIMD_DYNAMIC int simsimd_pdist(                                                //
+    simsimd_metric_kind_t kind, simsimd_datatype_t datatype,                      //
+    void const *a, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, //
+    void *d, simsimd_datatype_t d_type) {
+    simsimd_metric_kind_t const cdist_kind = simsimd_metric_cdist_kind(kind);
+    simsimd_metric_cdist_punned_t metric =
+        cdist_kind != simsimd_metric_unknown_k
+            ? (simsimd_metric_cdist_punned_t)_simsimd_dispatch(cdist_kind, datatype)
+            : NULL;
+    if (!metric) {
+        SIMSIMD_INSTRUMENT_MISS(cdist_kind != simsimd_metric_unknown_k ? cdist_kind : kind, datatype);
+        return 0;
+    }
+    if (d_type != simsimd_datatype_f64_k && d_type != simsimd_datatype_f32_k && d_type != simsimd_datatype_f16_k &&
+        d_type != simsimd_datatype_bf16_k)
+        return 0;
+    SIMSIMD_INSTRUMENT(cdist_kind, datatype, _simsimd_dispatch_capability(cdist_kind, datatype), count * stride,
+                       simsimd_pdist_parallel(metric, _simsimd_executor, _simsimd_executor_state, a, count, stride, n,
+                                              d, d_type));
+    return 1;
+}
+
+#if SIMSIMD_FILES_POSIX
+
+/**
+ *  @brief  Reads exactly `length` bytes at `offset`, retrying on short reads.
+ */
+SIMSIMD_INTERNAL int _simsimd_file_read(int file, void *buffer, simsimd_size_t length, simsimd_size_t offset) {
+    simsimd_u8_t *target = (simsimd_u8_t *)buffer;
+    while (length) {
+        ssize_t const read_bytes = pread(file, target, length, (off_t)offset);
+        if (read_bytes <= 0) return 0;
+        target += read_bytes, offset += (simsimd_size_t)read_bytes, length -= (simsimd_size_t)read_bytes;
+    }
+    return 1;
+}
+
+/**
+ *  @brief  Parses the dictionary of a `.npy` header, like `{'descr': '<f2', 'fortran_order': False, 'shape': (9, 4)}`.
+ *          Only little-endian C-ordered real matrices and vectors are accepted.
+ */
+SIMSIMD_INTERNAL int _simsimd_file_parse_npy(char const *header, simsimd_file_matrix_t *matrix) {
+    char const *descr = strstr(header, "'descr':");
+    char const *order = strstr(header, "'fortran_order':");
+    char const *shape = strstr(header, "'shape':");
+    simsimd_size_t extents[2] = {1, 1}, count = 0, bytes;
+    if (!descr || !order || !shape) return 0;
+
+    descr = strchr(descr + 8, '\'');
+    if (!descr) return 0;
+    if (strncmp(descr, "'<f8'", 5) == 0) matrix->datatype = simsimd_datatype_f64_k, bytes = 8;
+    else if (strncmp(descr, "'<f4'", 5) == 0) matrix->datatype = simsimd_datatype_f32_k, bytes = 4;
+    else if (strncmp(descr, "'<f2'", 5) == 0) matrix->datatype = simsimd_datatype_f16_k, bytes = 2;
+    else if (strncmp(descr, "'|i1'", 5) == 0) matrix->datatype = simsimd_datatype_i8_k, bytes = 1;
+    else if (strncmp(descr, "'|u1'", 5) == 0) matrix->datatype = simsimd_datatype_u8_k, bytes = 1;
+    else return 0;
+
+    order += 16;
+    while (*order == ' ') ++order;
+    if (strncmp(order, "False", 5) != 0) return 0;
+
+    shape += 8;
+    while (*shape == ' ') ++shape;
+    if (*shape++ != '(') return 0;
+    for (;;) {
+        while (*shape == ' ' || *shape == ',') ++shape;
+        if (*shape == ')') break;
+        if (*shape < '0' || *shape > '9' || count == 2) return 0;
+        extents[count] = 0;
+        while (*shape >= '0' && *shape <= '9') extents[count] = extents[count] * 10 + (simsimd_size_t)(*shape++ - '0');
+        ++count;
+    }
+    if (count == 0) return 0;
+    matrix->rows = count == 2 ? extents[0] : 1;
+    matrix->dimensions = count == 2 ? extents[1] : extents[0];
+    matrix->stride = matrix->dimensions * bytes;
+    return 1;
+}
+
+SIMSIMD_DYNAMIC int simsimd_file_matrix_inspect(char const *path, simsimd_file_matrix_t *matrix) {
+    simsimd_u8_t prefix[12];
+    char header[4096];
+    simsimd_size_t const path_length = strlen(path);
+    struct stat status;
+    int success = 0;
+    int const file = open(path, O_RDONLY);
+    if (file < 0) return 0;
+    if (fstat(file, &status) != 0 || !_simsimd_file_read(file, prefix, 8, 0)) goto cleanup;
+
+    if (memcmp(prefix, "\x93NUMPY", 6) == 0) {
+        // Version 1 headers have a 2-byte length, versions 2 and 3 have a 4-byte length
+        simsimd_size_t header_length;
+        if (prefix[6] == 1) {
+            if (!_simsimd_file_read(file, prefix + 8, 2, 8)) goto cleanup;
+            header_length = prefix[8] | (prefix[9] << 8), matrix->offset = 10;
+        }
+        else {
+            if (!_simsimd_file_read(file, prefix + 8, 4, 8)) goto cleanup;
+            header_length = prefix[8] | (prefix[9] << 8) | ((simsimd_size_t)prefix[10] << 16) |
+                            ((simsimd_size_t)prefix[11] << 24);
+            matrix->offset = 12;
+        }
+        if (header_length >= sizeof(header) || !_simsimd_file_read(file, header, header_length, matrix->offset))
+            goto cleanup;
+        header[header_length] = 0;
+        matrix->offset += header_length;
+        if (!_simsimd_file_parse_npy(header, matrix)) goto cleanup;
+    }
+    else {
+        // Big-ANN files start with the 32-bit little-endian numbers of rows and dimensions
+        simsimd_size_t bytes;
+        if (path_length > 5 && strcmp(path + path_length - 5, ".fbin") == 0)
+            matrix->datatype = simsimd_datatype_f32_k, bytes = 4;
+        else if (path_length > 6 && strcmp(path + path_length - 6, ".u8bin") == 0)
+            matrix->datatype = simsimd_datatype_u8_k, bytes = 1;
+        else if (path_length > 6 && strcmp(path + path_length - 6, ".i8bin") == 0)
+            matrix->datatype = simsimd_datatype_i8_k, bytes = 1;
+        else goto cleanup;
+        matrix->rows = prefix[0] | (prefix[1] << 8) | ((simsimd_size_t)prefix[2] << 16) |
+                       ((simsimd_size_t)prefix[3] << 24);
+        matrix->dimensions = prefix[4] | (prefix[5] << 8) | ((simsimd_size_t)prefix[6] << 16) |
+                             ((simsimd_size_t)prefix[7] << 24);
+        matrix->offset = 8, matrix->stride = matrix->dimensions * bytes;
+    }
+    success = matrix->offset + matrix->rows * matrix->stride <= (simsimd_size_t)status.st_size;
+
+cleanup:
+    close(file);
+    return success;
+}
+
+/**
+ *  @brief  A page-aligned mapping of consecutive rows of a file.
+ */
+typedef struct {
+    void *mapping;
+    simsimd_size_t length;
+    simsimd_u8_t const *rows;
+} _simsimd_file_window_t;
+
+/**
+ *  @brief  Maps `count` rows starting from `first` and asks the kernel to start reading them in the background.
+ */
+SIMSIMD_INTERNAL int _simsimd_file_window_map(int file, simsimd_file_matrix_t const *matrix, simsimd_size_t first,
+                                              simsimd_size_t count, simsimd_size_t page,
+                                              _simsimd_file_window_t *window) {
+    simsimd_size_t const begin = matrix->offset + first * matrix->stride;
+    simsimd_size_t const aligned = begin - begin % page;
+    window->length = begin + count * matrix->stride - aligned;
+    window->mapping = mmap(NULL, window->length, PROT_READ, MAP_SHARED, file, (off_t)aligned);
+    if (window->mapping == MAP_FAILED) {
+        window->mapping = NULL;
+        return 0;
+    }
+    madvise(window->mapping, window->length, MADV_SEQUENTIAL);
+    madvise(window->mapping, window->length, MADV_WILLNEED);
+    window->rows = (simsimd_u8_t const *)window->mapping + (begin - aligned);
+    return 1;
+}
+
+SIMSIMD_DYNAMIC int simsimd_topk_file(                                                           //
+    simsimd_metric_kind_t kind, void const *queries, simsimd_size_t queries_count,               //
+    simsimd_size_t queries_stride, char const *path, simsimd_file_matrix_t const *matrix,        //
+    simsimd_size_t k, simsimd_size_t *ids, simsimd_distance_t *distances, simsimd_size_t *counts) {
+
+    _simsimd_topk_tasks_t tasks;
+    _simsimd_file_window_t current = {0}, next = {0};
+    simsimd_size_t i, first;
+    struct stat status;
+    int success = 0;
+
+    for (i = 0; i != queries_count; ++i) counts[i] = 0;
+    if (!_simsimd_dispatch(kind, matrix->datatype)) {
+        SIMSIMD_INSTRUMENT_MISS(kind, matrix->datatype);
+        return 0;
+    }
+    if (!matrix->stride) return 0;
+    if (!k || !queries_count) return 1;
+
+    int const file = open(path, O_RDONLY);
+    if (file < 0) return 0;
+    if (fstat(file, &status) != 0 ||
+        matrix->offset + matrix->rows * matrix->stride > (simsimd_size_t)status.st_size) {
+        close(file);
+        return 0;
+    }
+
+    // Windows hold whole rows, and are mapped with page-aligned offsets
+    long const page_size = sysconf(_SC_PAGESIZE);
+    simsimd_size_t const page = page_size > 0 ? (simsimd_size_t)page_size : 4096;
+    simsimd_size_t window_rows = SIMSIMD_TOPK_FILE_WINDOW / matrix->stride;
+    if (!window_rows) window_rows = 1;
+    if (!_simsimd_topk_tasks_init(&tasks, kind, matrix->datatype, queries, queries_count, queries_stride,
+                                  matrix->stride, matrix->dimensions, k))
+        goto cleanup;
+
+    // The next window is mapped before the current one is scored, so that reading overlaps with compute
+    simsimd_size_t const first_rows = matrix->rows < window_rows ? matrix->rows : window_rows;
+    if (matrix->rows && !_simsimd_file_window_map(file, matrix, 0, first_rows, page, &current)) goto cleanup;
+    for (first = 0; first < matrix->rows; first += window_rows) {
+        simsimd_size_t const next_first = first + window_rows;
+        if (next_first < matrix->rows) {
+            simsimd_size_t const next_rows =
+                matrix->rows - next_first < window_rows ? matrix->rows - next_first : window_rows;
+            if (!_simsimd_file_window_map(file, matrix, next_first, next_rows, page, &next)) goto cleanup;
+        }
+        simsimd_size_t const rows = matrix->rows - first < window_rows ? matrix->rows - first : window_rows;
+        SIMSIMD_INSTRUMENT(tasks.used_kind, matrix->datatype,
+                           _simsimd_dispatch_capability(tasks.used_kind, matrix->datatype), rows * matrix->stride,
+                           _simsimd_topk_tasks_scan(&tasks, current.rows, rows, first));
+        munmap(current.mapping, current.length);
+        current = next, next.mapping = NULL;
+    }
+    _simsimd_topk_tasks_export(&tasks, ids, distances, counts);
+    success = 1;
+
+cleanup:
+    if (current.mapping) munmap(current.mapping, current.length);
+    if (next.mapping) munmap(next.mapping, next.length);
+    _simsimd_topk_tasks_free(&tasks);
+    close(file);
+    return success;
+}
+
+#else
+
+SIMSIMD_DYNAMIC int simsimd_file_matrix_inspect(char const *path, simsimd_file_matrix_t *matrix) {
+    (void)path, (void)matrix;
+    return 0;
+}
+
+SIMSIMD_DYNAMIC int simsimd_topk_file(                                                           //
+    simsimd_metric_kind_t kind, void const *queries, simsimd_size_t queries_count,               //
+    simsimd_size_t queries_stride, char const *path, simsimd_file_matrix_t const *matrix,        //
+    simsimd_size_t k, simsimd_size_t *ids, simsimd_distance_t *distances, simsimd_size_t *counts) {
+    (void)kind, (void)queries, (void)queries_count, (void)queries_stride, (void)path, (void)matrix;
+    (void)k, (void)ids, (void)distances, (void)counts;
+    return 0;
+}
+
+#endif // SIMSIMD_FILES_POSIX
+
+#if SIMSIMD_THREADS_POSIX
+
+/**
+ *  @brief  State of the built-in thread pool. The calling thread always participates in the work,
+ *          so a pool of `threads` has only `threads - 1` background workers.
+ */
+typedef struct {
+    pthread_t *workers;
+    simsimd_size_t threads;
+    pthread_mutex_t submission; //< Serializes concurrent callers, the losers compute on their own thread
+    pthread_mutex_t mutex;      //< Guards all of the following fields
+    pthread_cond_t wake, done;
+    simsimd_size_t generation; //< Incremented on every submission to wake the workers
+    simsimd_size_t busy;       //< Number of workers still processing the current submission
+    int stop;
+    simsimd_task_punned_t task;
+    void *context;
+    simsimd_size_t count;
+    simsimd_size_t next; //< The next unclaimed task, incremented atomically
+} _simsimd_pool_t;
+
+static _simsimd_pool_t _simsimd_pool = {
+    .workers = NULL,
+    .threads = 1,
+    .submission = PTHREAD_MUTEX_INITIALIZER,
+    .mutex = PTHREAD_MUTEX_INITIALIZER,
+    .wake = PTHREAD_COND_INITIALIZER,
+    .done = PTHREAD_COND_INITIALIZER,
+    .generation = 0,
+    .busy = 0,
+    .stop = 0,
+    .task = NULL,
+    .context = NULL,
+    .count = 0,
+    .next = 0,
+};
+
+SIMSIMD_INTERNAL void _simsimd_pool_drain(_simsimd_pool_t *pool, simsimd_task_punned_t task, void *context,
+                                          simsimd_size_t count) {
+    for (;;) {
+        simsimd_size_t const i = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED);
+        if (i >= count) break;
+        task(context, i);
+    }
+}
+
+static void *_simsimd_pool_worker(void *argument) {
+    _simsimd_pool_t *pool = (_simsimd_pool_t *)argument;
+    simsimd_size_t seen = 0; // Matches the generation at start, even if a submission has already arrived
+    pthread_mutex_lock(&pool->mutex);
+    for (;;) {
+        while (!pool->stop && pool->generation == seen) pthread_cond_wait(&pool->wake, &pool->mutex);
+        if (pool->stop) break;
+        seen = pool->generation;
+        simsimd_task_punned_t const task = pool->task;
+        void *const context = pool->context;
+        simsimd_size_t const count = pool->count;
+        pthread_mutex_unlock(&pool->mutex);
+        _simsimd_pool_drain(pool, task, context, count);
+        pthread_mutex_lock(&pool->mutex);
+        if (--pool->busy == 0) pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+    return NULL;
+}
+
+/**
+ *  @brief  Joins all the workers. The caller must hold the `submission` mutex, so that no submission
+ *          is in flight, as the workers leaving mid-task would never decrement `busy`.
+ */
+SIMSIMD_INTERNAL void _simsimd_pool_stop(_simsimd_pool_t *pool) {
+    simsimd_size_t i;
+    if (!pool->workers) return;
+    pthread_mutex_lock(&pool->mutex);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->mutex);
+    for (i = 0; i + 1 < pool->threads; ++i) pthread_join(pool->workers[i], NULL);
+    free(pool->workers);
+    pool->workers = NULL, pool->threads = 1, pool->stop = 0;
+}
+
+#if defined(__linux__)
+
+/**
+ *  @brief  Parses a Linux CPU or node list, like "0-15,32-47", from a `/sys` file into a set.
+ *  @return 1 if the file was found and parsed, 0 otherwise.
+ */
+SIMSIMD_INTERNAL int _simsimd_read_cpulist(char const *path, cpu_set_t *set) {
+    FILE *file = fopen(path, "r");
+    int first, last, separator;
+    if (!file) return 0;
+    CPU_ZERO(set);
+    while (fscanf(file, "%d", &first) == 1) {
+        last = first;
+        separator = fgetc(file);
+        if (separator == '-') {
+            if (fscanf(file, "%d", &last) != 1) break;
+            separator = fgetc(file);
+        }
+        for (; first <= last && first < CPU_SETSIZE; ++first) CPU_SET(first, set);
+        if (separator != ',') break;
+    }
+    fclose(file);
+    return 1;
+}
+
+/**
+ *  @brief  Orders the `allowed` CPUs node by node, so that consecutive workers share a NUMA node, even if
+ *          the kernel interleaves the CPU numbers of different nodes. Without the `/sys` topology, or for CPUs
+ *          missing from it, the plain CPU numbering is used.
+ *  @return The number of CPUs written into `cpus`.
+ */
+SIMSIMD_INTERNAL int _simsimd_pool_cpus(cpu_set_t const *allowed, int *cpus) {
+    cpu_set_t nodes, node_cpus, listed;
+    char path[64];
+    int count = 0;
+    CPU_ZERO(&listed);
+    if (_simsimd_read_cpulist("/sys/devices/system/node/online", &nodes))
+        for (int node = 0; node != CPU_SETSIZE; ++node) {
+            if (!CPU_ISSET(node, &nodes)) continue;
+            snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+            if (!_simsimd_read_cpulist(path, &node_cpus)) continue;
+            for (int cpu = 0; cpu != CPU_SETSIZE; ++cpu)
+                if (CPU_ISSET(cpu, &node_cpus) && CPU_ISSET(cpu, allowed) && !CPU_ISSET(cpu, &listed))
+                    CPU_SET(cpu, &listed), cpus[count++] = cpu;
+        }
+    for (int cpu = 0; cpu != CPU_SETSIZE; ++cpu)
+        if (CPU_ISSET(cpu, allowed) && !CPU_ISSET(cpu, &listed)) cpus[count++] = cpu;
+    return count;
+}
+
+#endif // defined(__linux__)
+
+SIMSIMD_INTERNAL simsimd_size_t _simsimd_pool_start(_simsimd_pool_t *pool, simsimd_size_t threads, int pinned) {
+    simsimd_size_t i;
+    pool->workers = (pthread_t *)malloc((threads - 1) * sizeof(pthread_t));
+    if (!pool->workers) return 1;
+    pool->generation = 0;
+
+#if defined(__linux__)
+    // Enumerate the CPUs this process may run on, grouped by NUMA node, to assign them to workers in order
+    cpu_set_t allowed;
+    int cpus[CPU_SETSIZE];
+    int cpus_count = 0;
+    if (pinned && sched_getaffinity(0, sizeof(allowed), &allowed) == 0) cpus_count = _simsimd_pool_cpus(&allowed, cpus);
+    if (!cpus_count) pinned = 0;
+#endif
+
+    for (i = 0; i + 1 < threads; ++i) {
+        pthread_attr_t attributes;
+        pthread_attr_init(&attributes);
+        pthread_attr_setstacksize(&attributes, SIMSIMD_POOL_STACK_SIZE);
+#if defined(__linux__)
+        if (pinned) {
+            // The first CPU is left to the calling thread, and we wrap around if oversubscribed
+            cpu_set_t single;
+            CPU_ZERO(&single);
+            CPU_SET(cpus[(i + 1) % cpus_count], &single);
+            pthread_attr_setaffinity_np(&attributes, sizeof(single), &single);
+        }
+#endif
+        int const failed = pthread_create(&pool->workers[i], &attributes, &_simsimd_pool_worker, pool);
+        pthread_attr_destroy(&attributes);
+        if (failed) break;
+    }
+    pool->threads = i + 1;
+    return pool->threads;
+}
+
+SIMSIMD_DYNAMIC void simsimd_pool_execute(void *pool_state, simsimd_task_punned_t task, void *context,
+                                          simsimd_size_t count) {
+    _simsimd_pool_t *pool = (_simsimd_pool_t *)pool_state;
+    simsimd_size_t i;
+
+    // Nested calls from within tasks and concurrent callers can't wait for the pool, so they compute alone
+    if (!pool || pool->threads < 2 || count < 2 || pthread_mutex_trylock(&pool->submission) != 0) {
+        for (i = 0; i != count; ++i) task(context, i);
+        return;
+    }
+    // The pool may have been shrunk between the check above and taking the lock
+    if (pool->threads < 2) {
+        pthread_mutex_unlock(&pool->submission);
+        for (i = 0; i != count; ++i) task(context, i);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->task = task, pool->context = context, pool->count = count, pool->next = 0;
+    pool->busy = pool->threads - 1;
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->mutex);
+
+    _simsimd_pool_drain(pool, task, context, count);
+
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->busy) pthread_cond_wait(&pool->done, &pool->mutex);
+    pthread_mutex_unlock(&pool->mutex);
+    pthread_mutex_unlock(&pool->submission);
+}
+
+SIMSIMD_DYNAMIC simsimd_size_t simsimd_set_threads(simsimd_size_t threads, int pinned) {
+    if (threads == 0) {
+        long const online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (simsimd_size_t)online : 1;
+    }
+    // Wait for the in-flight submission, if any, and keep new ones from starting while resizing
+    pthread_mutex_lock(&_simsimd_pool.submission);
+    _simsimd_pool_stop(&_simsimd_pool);
+    if (threads > 1) threads = _simsimd_pool_start(&_simsimd_pool, threads, pinned);
+    pthread_mutex_unlock(&_simsimd_pool.submission);
+    if (threads > 1) simsimd_set_executor(&simsimd_pool_execute, &_simsimd_pool);
+    else simsimd_set_executor(0, 0);
+    return threads;
+}
+
+SIMSIMD_DYNAMIC simsimd_size_t simsimd_get_threads(void) { return _simsimd_pool.threads; }
+
+#else
+
+SIMSIMD_DYNAMIC void simsimd_pool_execute(void *pool_state, simsimd_task_punned_t task, void *context,
+                                          simsimd_size_t count) {
+    simsimd_size_t i;
+    (void)pool_state;
+    for (i = 0; i != count; ++i) task(context, i);
+}
+
+SIMSIMD_DYNAMIC simsimd_size_t simsimd_set_threads(simsimd_size_t threads, int pinned) {
+    (void)threads, (void)pinned;
+    return 1;
+}
+
+SIMSIMD_DYNAMIC simsimd_size_t simsimd_get_threads(void) { return 1; }
+
+#endif // SIMSIMD_THREADS_POSIX
+
+SIMSIMD_DYNAMIC void simsimd_set_executor(simsimd_executor_punned_t executor, void *executor_state) {
+    _simsimd_executor = executor;
+    _simsimd_executor_state = executor_state;
+}
+
+SIMSIMD_DYNAMIC void simsimd_get_executor(simsimd_executor_punned_t *executor, void **executor_state) {
+    *executor = _simsimd_executor;
+    *executor_state = _simsimd_executor_state;
+}
+
 SIMSIMD_DYNAMIC void simsimd_find_metric_punned( //
     simsimd_metric_kind_t kind,                  //
     simsimd_datatype_t datatype,                 //
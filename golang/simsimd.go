@@ -8,15 +8,17 @@ package simsimd
 #include "../include/simsimd/simsimd.h"
 #include <stdlib.h>
 
-inline static simsimd_f32_t cosine_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t d) { return simsimd_metric_punned(simsimd_metric_cosine_k, simsimd_datatype_i8_k, simsimd_cap_any_k)(a, b, d, d); }
-inline static simsimd_f32_t cosine_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t d) { return simsimd_metric_punned(simsimd_metric_cosine_k, simsimd_datatype_f32_k, simsimd_cap_any_k)(a, b, d, d); }
-inline static simsimd_f32_t inner_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t d) { return simsimd_metric_punned(simsimd_metric_inner_k, simsimd_datatype_i8_k, simsimd_cap_any_k)(a, b, d, d); }
-inline static simsimd_f32_t inner_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t d) { return simsimd_metric_punned(simsimd_metric_inner_k, simsimd_datatype_f32_k, simsimd_cap_any_k)(a, b, d, d); }
-inline static simsimd_f32_t sqeuclidean_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t d) { return simsimd_metric_punned(simsimd_metric_sqeuclidean_k, simsimd_datatype_i8_k, simsimd_cap_any_k)(a, b, d, d); }
-inline static simsimd_f32_t sqeuclidean_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t d) { return simsimd_metric_punned(simsimd_metric_sqeuclidean_k, simsimd_datatype_f32_k, simsimd_cap_any_k)(a, b, d, d); }
+inline static simsimd_f32_t cosine_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t d) { simsimd_distance_t r; simsimd_cos_i8(a, b, d, &r); return (simsimd_f32_t)r; }
+inline static simsimd_f32_t cosine_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t d) { simsimd_distance_t r; simsimd_cos_f32(a, b, d, &r); return (simsimd_f32_t)r; }
+inline static simsimd_f32_t inner_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t d) { simsimd_distance_t r; simsimd_dot_i8(a, b, d, &r); return (simsimd_f32_t)r; }
+inline static simsimd_f32_t inner_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t d) { simsimd_distance_t r; simsimd_dot_f32(a, b, d, &r); return (simsimd_f32_t)r; }
+inline static simsimd_f32_t sqeuclidean_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t d) { simsimd_distance_t r; simsimd_l2sq_i8(a, b, d, &r); return (simsimd_f32_t)r; }
+inline static simsimd_f32_t sqeuclidean_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t d) { simsimd_distance_t r; simsimd_l2sq_f32(a, b, d, &r); return (simsimd_f32_t)r; }
 */
 import "C"
 
+import "unsafe"
+
 // CosineI8 computes the cosine distance between two i8 vectors using the most suitable SIMD instruction set available.
 func CosineI8(a, b []int8) float32 {
 	if len(a) != len(b) {
@@ -70,3 +72,177 @@ func SqEuclideanF32(a, b []float32) float32 {
 
 	return float32(C.sqeuclidean_f32((*C.simsimd_f32_t)(&a[0]), (*C.simsimd_f32_t)(&b[0]), C.simsimd_size_t(len(a))))
 }
+
+// batchRows validates the shapes of a one-to-many call, returning the number of rows in the matrix.
+func batchRows(dimensions, matrixLength, resultsLength int) int {
+	if dimensions == 0 || matrixLength%dimensions != 0 {
+		panic("matrix length must be a multiple of the query length")
+	}
+	rows := matrixLength / dimensions
+	if resultsLength < rows {
+		panic("results must have an entry for every row of the matrix")
+	}
+	return rows
+}
+
+// cdistRows validates the shapes of a many-to-many call, returning the number of rows in both matrices.
+func cdistRows(dimensions, aLength, bLength, resultsLength int) (int, int) {
+	if dimensions <= 0 || aLength%dimensions != 0 || bLength%dimensions != 0 {
+		panic("matrix lengths must be multiples of the number of dimensions")
+	}
+	aRows, bRows := aLength/dimensions, bLength/dimensions
+	if resultsLength < aRows*bRows {
+		panic("results must have an entry for every pair of rows")
+	}
+	return aRows, bRows
+}
+
+// CosineBatchI8 computes the cosine distances between an i8 query and every row of a row-major matrix,
+// writing one result per row.
+func CosineBatchI8(query, matrix []int8, results []float64) {
+	rows := batchRows(len(query), len(matrix), len(results))
+	if rows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(len(query) * int(unsafe.Sizeof(query[0])))
+	C.simsimd_cos_batch_i8((*C.simsimd_i8_t)(&query[0]), (*C.simsimd_i8_t)(&matrix[0]), C.simsimd_size_t(rows), stride,
+		C.simsimd_size_t(len(query)), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])))
+}
+
+// InnerBatchI8 computes the inner-product similarities between an i8 query and every row of a row-major matrix,
+// writing one result per row.
+func InnerBatchI8(query, matrix []int8, results []float64) {
+	rows := batchRows(len(query), len(matrix), len(results))
+	if rows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(len(query) * int(unsafe.Sizeof(query[0])))
+	C.simsimd_dot_batch_i8((*C.simsimd_i8_t)(&query[0]), (*C.simsimd_i8_t)(&matrix[0]), C.simsimd_size_t(rows), stride,
+		C.simsimd_size_t(len(query)), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])))
+}
+
+// SqEuclideanBatchI8 computes the squared euclidean distances between an i8 query and every row of a row-major matrix,
+// writing one result per row.
+func SqEuclideanBatchI8(query, matrix []int8, results []float64) {
+	rows := batchRows(len(query), len(matrix), len(results))
+	if rows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(len(query) * int(unsafe.Sizeof(query[0])))
+	C.simsimd_l2sq_batch_i8((*C.simsimd_i8_t)(&query[0]), (*C.simsimd_i8_t)(&matrix[0]), C.simsimd_size_t(rows), stride,
+		C.simsimd_size_t(len(query)), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])))
+}
+
+// CosineCdistI8 computes the cosine distances between every pair of rows of two row-major i8 matrices,
+// writing them into a row-major results matrix with a row per vector of `a`.
+func CosineCdistI8(a, b []int8, dimensions int, results []float64) {
+	aRows, bRows := cdistRows(dimensions, len(a), len(b), len(results))
+	if aRows == 0 || bRows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(dimensions * int(unsafe.Sizeof(a[0])))
+	C.simsimd_cos_cdist_i8((*C.simsimd_i8_t)(&a[0]), (*C.simsimd_i8_t)(&b[0]), C.simsimd_size_t(aRows), stride,
+		C.simsimd_size_t(bRows), stride, C.simsimd_size_t(dimensions), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])),
+		C.simsimd_size_t(bRows*int(unsafe.Sizeof(results[0]))))
+}
+
+// InnerCdistI8 computes the inner-product similarities between every pair of rows of two row-major i8 matrices,
+// writing them into a row-major results matrix with a row per vector of `a`.
+func InnerCdistI8(a, b []int8, dimensions int, results []float64) {
+	aRows, bRows := cdistRows(dimensions, len(a), len(b), len(results))
+	if aRows == 0 || bRows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(dimensions * int(unsafe.Sizeof(a[0])))
+	C.simsimd_dot_cdist_i8((*C.simsimd_i8_t)(&a[0]), (*C.simsimd_i8_t)(&b[0]), C.simsimd_size_t(aRows), stride,
+		C.simsimd_size_t(bRows), stride, C.simsimd_size_t(dimensions), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])),
+		C.simsimd_size_t(bRows*int(unsafe.Sizeof(results[0]))))
+}
+
+// SqEuclideanCdistI8 computes the squared euclidean distances between every pair of rows of two row-major i8 matrices,
+// writing them into a row-major results matrix with a row per vector of `a`.
+func SqEuclideanCdistI8(a, b []int8, dimensions int, results []float64) {
+	aRows, bRows := cdistRows(dimensions, len(a), len(b), len(results))
+	if aRows == 0 || bRows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(dimensions * int(unsafe.Sizeof(a[0])))
+	C.simsimd_l2sq_cdist_i8((*C.simsimd_i8_t)(&a[0]), (*C.simsimd_i8_t)(&b[0]), C.simsimd_size_t(aRows), stride,
+		C.simsimd_size_t(bRows), stride, C.simsimd_size_t(dimensions), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])),
+		C.simsimd_size_t(bRows*int(unsafe.Sizeof(results[0]))))
+}
+
+// CosineBatchF32 computes the cosine distances between an f32 query and every row of a row-major matrix,
+// writing one result per row.
+func CosineBatchF32(query, matrix []float32, results []float64) {
+	rows := batchRows(len(query), len(matrix), len(results))
+	if rows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(len(query) * int(unsafe.Sizeof(query[0])))
+	C.simsimd_cos_batch_f32((*C.simsimd_f32_t)(&query[0]), (*C.simsimd_f32_t)(&matrix[0]), C.simsimd_size_t(rows), stride,
+		C.simsimd_size_t(len(query)), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])))
+}
+
+// InnerBatchF32 computes the inner-product similarities between an f32 query and every row of a row-major matrix,
+// writing one result per row.
+func InnerBatchF32(query, matrix []float32, results []float64) {
+	rows := batchRows(len(query), len(matrix), len(results))
+	if rows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(len(query) * int(unsafe.Sizeof(query[0])))
+	C.simsimd_dot_batch_f32((*C.simsimd_f32_t)(&query[0]), (*C.simsimd_f32_t)(&matrix[0]), C.simsimd_size_t(rows), stride,
+		C.simsimd_size_t(len(query)), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])))
+}
+
+// SqEuclideanBatchF32 computes the squared euclidean distances between an f32 query and every row of a row-major matrix,
+// writing one result per row.
+func SqEuclideanBatchF32(query, matrix []float32, results []float64) {
+	rows := batchRows(len(query), len(matrix), len(results))
+	if rows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(len(query) * int(unsafe.Sizeof(query[0])))
+	C.simsimd_l2sq_batch_f32((*C.simsimd_f32_t)(&query[0]), (*C.simsimd_f32_t)(&matrix[0]), C.simsimd_size_t(rows), stride,
+		C.simsimd_size_t(len(query)), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])))
+}
+
+// CosineCdistF32 computes the cosine distances between every pair of rows of two row-major f32 matrices,
+// writing them into a row-major results matrix with a row per vector of `a`.
+func CosineCdistF32(a, b []float32, dimensions int, results []float64) {
+	aRows, bRows := cdistRows(dimensions, len(a), len(b), len(results))
+	if aRows == 0 || bRows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(dimensions * int(unsafe.Sizeof(a[0])))
+	C.simsimd_cos_cdist_f32((*C.simsimd_f32_t)(&a[0]), (*C.simsimd_f32_t)(&b[0]), C.simsimd_size_t(aRows), stride,
+		C.simsimd_size_t(bRows), stride, C.simsimd_size_t(dimensions), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])),
+		C.simsimd_size_t(bRows*int(unsafe.Sizeof(results[0]))))
+}
+
+// InnerCdistF32 computes the inner-product similarities between every pair of rows of two row-major f32 matrices,
+// writing them into a row-major results matrix with a row per vector of `a`.
+func InnerCdistF32(a, b []float32, dimensions int, results []float64) {
+	aRows, bRows := cdistRows(dimensions, len(a), len(b), len(results))
+	if aRows == 0 || bRows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(dimensions * int(unsafe.Sizeof(a[0])))
+	C.simsimd_dot_cdist_f32((*C.simsimd_f32_t)(&a[0]), (*C.simsimd_f32_t)(&b[0]), C.simsimd_size_t(aRows), stride,
+		C.simsimd_size_t(bRows), stride, C.simsimd_size_t(dimensions), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])),
+		C.simsimd_size_t(bRows*int(unsafe.Sizeof(results[0]))))
+}
+
+// SqEuclideanCdistF32 computes the squared euclidean distances between every pair of rows of two row-major f32 matrices,
+// writing them into a row-major results matrix with a row per vector of `a`.
+func SqEuclideanCdistF32(a, b []float32, dimensions int, results []float64) {
+	aRows, bRows := cdistRows(dimensions, len(a), len(b), len(results))
+	if aRows == 0 || bRows == 0 {
+		return
+	}
+	stride := C.simsimd_size_t(dimensions * int(unsafe.Sizeof(a[0])))
+	C.simsimd_l2sq_cdist_f32((*C.simsimd_f32_t)(&a[0]), (*C.simsimd_f32_t)(&b[0]), C.simsimd_size_t(aRows), stride,
+		C.simsimd_size_t(bRows), stride, C.simsimd_size_t(dimensions), (*C.simsimd_distance_t)(unsafe.Pointer(&results[0])),
+		C.simsimd_size_t(bRows*int(unsafe.Sizeof(results[0]))))
+}
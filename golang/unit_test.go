@@ -38,3 +38,45 @@ func TestVectorLengthMismatch(t *testing.T) {
 	b := []int8{0}
 	_ = CosineI8(a, b) // This should panic
 }
+
+func TestCosineBatchF32(t *testing.T) {
+	query := []float32{1, 0}
+	matrix := []float32{0, 1, 1, 0, 2, 2}
+	results := make([]float64, 3)
+
+	CosineBatchF32(query, matrix, results)
+	for i := range results {
+		expected := float64(CosineF32(query, matrix[i*2:i*2+2]))
+		if math.Abs(results[i]-expected) > 1e-3 {
+			t.Errorf("Expected %v, got %v", expected, results[i])
+		}
+	}
+}
+
+func TestSqEuclideanCdistI8(t *testing.T) {
+	a := []int8{1, 2, 3, -1, 0, 4}
+	b := []int8{0, 0, 0, 1, 2, 3}
+	results := make([]float64, 4)
+
+	SqEuclideanCdistI8(a, b, 3, results)
+	for i := 0; i < 2; i++ {
+		for j := 0; j < 2; j++ {
+			expected := float64(SqEuclideanI8(a[i*3:i*3+3], b[j*3:j*3+3]))
+			if math.Abs(results[i*2+j]-expected) > 1e-3 {
+				t.Errorf("Expected %v, got %v", expected, results[i*2+j])
+			}
+		}
+	}
+}
+
+func TestBatchShapeMismatch(t *testing.T) {
+	defer func() {
+		if r := recover(); r == nil {
+			t.Errorf("The code did not panic")
+		}
+	}()
+
+	query := []float32{1, 0}
+	matrix := []float32{0, 1, 1}
+	InnerBatchF32(query, matrix, make([]float64, 2)) // This should panic
+}
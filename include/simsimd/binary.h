@@ -7,6 +7,7 @@
  *  Contains:
  *  - Hamming distance
  *  - Jaccard similarity (Tanimoto coefficient)
+ *  - One-to-many, many-to-many, and threshold searches for both
  *
  *  For hardware architectures:
  *  - Arm: NEON, SVE
@@ -20,6 +21,14 @@
 
 #include "types.h"
 
+/**
+ *  @brief  Number of rows of `b` compared at once by the many-to-many and the threshold kernels.
+ *          The radius searches keep as many distances on the stack, so the default occupies 1 KB.
+ */
+#if !defined(SIMSIMD_BINARY_BLOCK)
+#define SIMSIMD_BINARY_BLOCK 128
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -45,6 +54,49 @@ SIMSIMD_PUBLIC void simsimd_jaccard_b8_haswell(simsimd_b8_t const* a, simsimd_b8
 /*  x86 AVX512 backend for bitsets for Intel Ice Lake CPUs and newer, using VPOPCNTDQ extensions. */
 SIMSIMD_PUBLIC void simsimd_hamming_b8_ice(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t n_words, simsimd_distance_t* distance);
 SIMSIMD_PUBLIC void simsimd_jaccard_b8_ice(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t n_words, simsimd_distance_t* distance);
+
+/*  One-to-many backends, comparing a single query `a` against `b_count` rows of `b`, separated by `b_stride` bytes.
+ *  For Jaccard the query population count is computed once, deriving the union as `|a| + |b| - |a & b|`.
+ */
+SIMSIMD_PUBLIC void simsimd_hamming_batch_b8_serial(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_jaccard_batch_b8_serial(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_hamming_batch_b8_haswell(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_jaccard_batch_b8_haswell(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_hamming_batch_b8_ice(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_jaccard_batch_b8_ice(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_hamming_batch_b8_neon(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_jaccard_batch_b8_neon(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_hamming_batch_b8_sve(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_jaccard_batch_b8_sve(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results);
+
+/*  Many-to-many backends, following the `cdist.h` signature, but streaming blocks of `SIMSIMD_BINARY_BLOCK` rows
+ *  of `b` through the one-to-many kernels above, so that every block is reused from L1 for all the rows of `a`.
+ */
+SIMSIMD_PUBLIC void simsimd_hamming_cdist_b8_serial(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_hamming_cdist_b8_neon(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_hamming_cdist_b8_sve(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_hamming_cdist_b8_haswell(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_hamming_cdist_b8_ice(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_jaccard_cdist_b8_serial(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_jaccard_cdist_b8_neon(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_jaccard_cdist_b8_sve(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_jaccard_cdist_b8_haswell(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_jaccard_cdist_b8_ice(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t* results, simsimd_size_t results_stride);
+
+/*  Threshold searches, reporting only the rows of `b` within `radius` of the query, useful for near-duplicate
+ *  detection. The `ids` of the matches are exported in ascending order, alongside their `distances`, unless
+ *  the latter is NULL. Both arrays must fit `b_count` entries, and the number of matches is written to `found`.
+ */
+SIMSIMD_PUBLIC void simsimd_hamming_radius_b8_serial(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t radius, simsimd_size_t* ids, simsimd_distance_t* distances, simsimd_size_t* found);
+SIMSIMD_PUBLIC void simsimd_hamming_radius_b8_neon(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t radius, simsimd_size_t* ids, simsimd_distance_t* distances, simsimd_size_t* found);
+SIMSIMD_PUBLIC void simsimd_hamming_radius_b8_sve(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t radius, simsimd_size_t* ids, simsimd_distance_t* distances, simsimd_size_t* found);
+SIMSIMD_PUBLIC void simsimd_hamming_radius_b8_haswell(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t radius, simsimd_size_t* ids, simsimd_distance_t* distances, simsimd_size_t* found);
+SIMSIMD_PUBLIC void simsimd_hamming_radius_b8_ice(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t radius, simsimd_size_t* ids, simsimd_distance_t* distances, simsimd_size_t* found);
+SIMSIMD_PUBLIC void simsimd_jaccard_radius_b8_serial(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t radius, simsimd_size_t* ids, simsimd_distance_t* distances, simsimd_size_t* found);
+SIMSIMD_PUBLIC void simsimd_jaccard_radius_b8_neon(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t radius, simsimd_size_t* ids, simsimd_distance_t* distances, simsimd_size_t* found);
+SIMSIMD_PUBLIC void simsimd_jaccard_radius_b8_sve(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t radius, simsimd_size_t* ids, simsimd_distance_t* distances, simsimd_size_t* found);
+SIMSIMD_PUBLIC void simsimd_jaccard_radius_b8_haswell(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t radius, simsimd_size_t* ids, simsimd_distance_t* distances, simsimd_size_t* found);
+SIMSIMD_PUBLIC void simsimd_jaccard_radius_b8_ice(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t radius, simsimd_size_t* ids, simsimd_distance_t* distances, simsimd_size_t* found);
 // clang-format on
 
 SIMSIMD_PUBLIC unsigned char simsimd_popcount_b8(simsimd_b8_t x) {
@@ -75,6 +127,83 @@ SIMSIMD_PUBLIC void simsimd_jaccard_b8_serial(simsimd_b8_t const *a, simsimd_b8_
     *result = (union_ != 0) ? 1 - (simsimd_f64_t)intersection / (simsimd_f64_t)union_ : 1;
 }
 
+SIMSIMD_PUBLIC void simsimd_hamming_batch_b8_serial(simsimd_b8_t const *a, simsimd_b8_t const *b,
+                                                    simsimd_size_t b_count, simsimd_size_t b_stride,
+                                                    simsimd_size_t n_words, simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_b8_t const *b0 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 0);
+        simsimd_b8_t const *b1 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 1);
+        simsimd_b8_t const *b2 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 2);
+        simsimd_b8_t const *b3 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 3);
+        simsimd_i32_t differences0 = 0, differences1 = 0, differences2 = 0, differences3 = 0;
+        for (simsimd_size_t i = 0; i != n_words; ++i) {
+            simsimd_b8_t ai = a[i];
+            differences0 += simsimd_popcount_b8(ai ^ b0[i]), differences1 += simsimd_popcount_b8(ai ^ b1[i]);
+            differences2 += simsimd_popcount_b8(ai ^ b2[i]), differences3 += simsimd_popcount_b8(ai ^ b3[i]);
+        }
+        results[j + 0] = differences0, results[j + 1] = differences1;
+        results[j + 2] = differences2, results[j + 3] = differences3;
+    }
+    for (; j != b_count; ++j)
+        simsimd_hamming_b8_serial(a, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j), n_words, results + j);
+}
+
+SIMSIMD_PUBLIC void simsimd_jaccard_batch_b8_serial(simsimd_b8_t const *a, simsimd_b8_t const *b,
+                                                    simsimd_size_t b_count, simsimd_size_t b_stride,
+                                                    simsimd_size_t n_words, simsimd_distance_t *results) {
+    simsimd_i32_t a_count = 0;
+    for (simsimd_size_t i = 0; i != n_words; ++i) a_count += simsimd_popcount_b8(a[i]);
+    for (simsimd_size_t j = 0; j != b_count; ++j) {
+        simsimd_b8_t const *b_row = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j);
+        simsimd_i32_t intersection = 0, b_count_bits = 0;
+        for (simsimd_size_t i = 0; i != n_words; ++i)
+            intersection += simsimd_popcount_b8(a[i] & b_row[i]), b_count_bits += simsimd_popcount_b8(b_row[i]);
+        simsimd_i32_t union_ = a_count + b_count_bits - intersection;
+        results[j] = (union_ != 0) ? 1 - (simsimd_f64_t)intersection / (simsimd_f64_t)union_ : 1;
+    }
+}
+
+#define SIMSIMD_MAKE_BINARY_CDIST(name, extension)                                                                \
+    SIMSIMD_PUBLIC void simsimd_##name##_cdist_b8_##extension(                                                    \
+        simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t a_count, simsimd_size_t a_stride,            \
+        simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n_words, simsimd_distance_t *results,     \
+        simsimd_size_t results_stride) {                                                                          \
+        for (simsimd_size_t j = 0; j < b_count; j += SIMSIMD_BINARY_BLOCK) {                                      \
+            simsimd_size_t const block = b_count - j < SIMSIMD_BINARY_BLOCK ? b_count - j : SIMSIMD_BINARY_BLOCK; \
+            simsimd_b8_t const *b_block = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j);                              \
+            for (simsimd_size_t i = 0; i != a_count; ++i)                                                         \
+                simsimd_##name##_batch_b8_##extension(                                                            \
+                    SIMSIMD_ROW(simsimd_b8_t, a, a_stride, i), b_block, block, b_stride, n_words,                 \
+                    (simsimd_distance_t *)SIMSIMD_ROW(simsimd_distance_t, results, results_stride, i) + j);       \
+        }                                                                                                         \
+    }
+
+#define SIMSIMD_MAKE_BINARY_RADIUS(name, extension)                                                               \
+    SIMSIMD_PUBLIC void simsimd_##name##_radius_b8_##extension(                                                   \
+        simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count, simsimd_size_t b_stride,            \
+        simsimd_size_t n_words, simsimd_distance_t radius, simsimd_size_t *ids, simsimd_distance_t *distances,    \
+        simsimd_size_t *found) {                                                                                  \
+        simsimd_distance_t block_distances[SIMSIMD_BINARY_BLOCK];                                                 \
+        simsimd_size_t count = 0;                                                                                 \
+        for (simsimd_size_t j = 0; j < b_count; j += SIMSIMD_BINARY_BLOCK) {                                      \
+            simsimd_size_t const block = b_count - j < SIMSIMD_BINARY_BLOCK ? b_count - j : SIMSIMD_BINARY_BLOCK; \
+            simsimd_##name##_batch_b8_##extension(a, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j), block, b_stride,  \
+                                                  n_words, block_distances);                                      \
+            for (simsimd_size_t k = 0; k != block; ++k) {                                                         \
+                if (block_distances[k] > radius) continue;                                                        \
+                if (distances) distances[count] = block_distances[k];                                             \
+                ids[count++] = j + k;                                                                             \
+            }                                                                                                     \
+        }                                                                                                         \
+        *found = count;                                                                                           \
+    }
+
+SIMSIMD_MAKE_BINARY_CDIST(hamming, serial)  // simsimd_hamming_cdist_b8_serial
+SIMSIMD_MAKE_BINARY_CDIST(jaccard, serial)  // simsimd_jaccard_cdist_b8_serial
+SIMSIMD_MAKE_BINARY_RADIUS(hamming, serial) // simsimd_hamming_radius_b8_serial
+SIMSIMD_MAKE_BINARY_RADIUS(jaccard, serial) // simsimd_jaccard_radius_b8_serial
+
 #if _SIMSIMD_TARGET_ARM
 #if SIMSIMD_TARGET_NEON
 #pragma GCC push_options
@@ -139,7 +268,7 @@ SIMSIMD_PUBLIC void simsimd_jaccard_b8_neon(simsimd_b8_t const *a, simsimd_b8_t
             unions_cycle_vec = vaddq_u8(unions_cycle_vec, or_count_vec);
         }
         intersection += _simsimd_reduce_u8x16_neon(intersections_cycle_vec);
-        union_ += _simsimd_reduce_u8x16_neon(intersections_cycle_vec);
+        union_ += _simsimd_reduce_u8x16_neon(unions_cycle_vec);
     }
     // Handle the tail
     for (; i != n_words; ++i)
@@ -147,6 +276,110 @@ SIMSIMD_PUBLIC void simsimd_jaccard_b8_neon(simsimd_b8_t const *a, simsimd_b8_t
     *result = (union_ != 0) ? 1 - (simsimd_f64_t)intersection / (simsimd_f64_t)union_ : 1;
 }
 
+SIMSIMD_PUBLIC void simsimd_hamming_batch_b8_neon(simsimd_b8_t const *a, simsimd_b8_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride,
+                                                  simsimd_size_t n_words, simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_b8_t const *b0 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 0);
+        simsimd_b8_t const *b1 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 1);
+        simsimd_b8_t const *b2 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 2);
+        simsimd_b8_t const *b3 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 3);
+        simsimd_u32_t differences0 = 0, differences1 = 0, differences2 = 0, differences3 = 0;
+        simsimd_size_t i = 0;
+        // Same as in `simsimd_hamming_b8_neon`, the 8-bit counters can absorb up to 31 cycles.
+        while (i + 16 <= n_words) {
+            uint8x16_t xor0_count_vec = vdupq_n_u8(0), xor1_count_vec = vdupq_n_u8(0);
+            uint8x16_t xor2_count_vec = vdupq_n_u8(0), xor3_count_vec = vdupq_n_u8(0);
+            for (simsimd_size_t cycle = 0; cycle < 31 && i + 16 <= n_words; ++cycle, i += 16) {
+                uint8x16_t a_vec = vld1q_u8(a + i);
+                xor0_count_vec = vaddq_u8(xor0_count_vec, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b0 + i))));
+                xor1_count_vec = vaddq_u8(xor1_count_vec, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b1 + i))));
+                xor2_count_vec = vaddq_u8(xor2_count_vec, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b2 + i))));
+                xor3_count_vec = vaddq_u8(xor3_count_vec, vcntq_u8(veorq_u8(a_vec, vld1q_u8(b3 + i))));
+            }
+            differences0 += _simsimd_reduce_u8x16_neon(xor0_count_vec);
+            differences1 += _simsimd_reduce_u8x16_neon(xor1_count_vec);
+            differences2 += _simsimd_reduce_u8x16_neon(xor2_count_vec);
+            differences3 += _simsimd_reduce_u8x16_neon(xor3_count_vec);
+        }
+        for (; i != n_words; ++i)
+            differences0 += simsimd_popcount_b8(a[i] ^ b0[i]), differences1 += simsimd_popcount_b8(a[i] ^ b1[i]),
+                differences2 += simsimd_popcount_b8(a[i] ^ b2[i]), differences3 += simsimd_popcount_b8(a[i] ^ b3[i]);
+        results[j + 0] = differences0, results[j + 1] = differences1;
+        results[j + 2] = differences2, results[j + 3] = differences3;
+    }
+    for (; j != b_count; ++j)
+        simsimd_hamming_b8_neon(a, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j), n_words, results + j);
+}
+
+SIMSIMD_PUBLIC void simsimd_jaccard_batch_b8_neon(simsimd_b8_t const *a, simsimd_b8_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride,
+                                                  simsimd_size_t n_words, simsimd_distance_t *results) {
+    simsimd_u32_t a_count = 0;
+    simsimd_size_t i = 0;
+    while (i + 16 <= n_words) {
+        uint8x16_t a_count_vec = vdupq_n_u8(0);
+        for (simsimd_size_t cycle = 0; cycle < 31 && i + 16 <= n_words; ++cycle, i += 16)
+            a_count_vec = vaddq_u8(a_count_vec, vcntq_u8(vld1q_u8(a + i)));
+        a_count += _simsimd_reduce_u8x16_neon(a_count_vec);
+    }
+    for (; i != n_words; ++i) a_count += simsimd_popcount_b8(a[i]);
+
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_b8_t const *b0 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 0);
+        simsimd_b8_t const *b1 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 1);
+        simsimd_b8_t const *b2 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 2);
+        simsimd_b8_t const *b3 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 3);
+        simsimd_u32_t intersection0 = 0, intersection1 = 0, intersection2 = 0, intersection3 = 0;
+        simsimd_u32_t b0_count = 0, b1_count = 0, b2_count = 0, b3_count = 0;
+        for (i = 0; i + 16 <= n_words;) {
+            uint8x16_t and0_count_vec = vdupq_n_u8(0), and1_count_vec = vdupq_n_u8(0);
+            uint8x16_t and2_count_vec = vdupq_n_u8(0), and3_count_vec = vdupq_n_u8(0);
+            uint8x16_t b0_count_vec = vdupq_n_u8(0), b1_count_vec = vdupq_n_u8(0);
+            uint8x16_t b2_count_vec = vdupq_n_u8(0), b3_count_vec = vdupq_n_u8(0);
+            for (simsimd_size_t cycle = 0; cycle < 31 && i + 16 <= n_words; ++cycle, i += 16) {
+                uint8x16_t a_vec = vld1q_u8(a + i);
+                uint8x16_t b0_vec = vld1q_u8(b0 + i), b1_vec = vld1q_u8(b1 + i);
+                uint8x16_t b2_vec = vld1q_u8(b2 + i), b3_vec = vld1q_u8(b3 + i);
+                and0_count_vec = vaddq_u8(and0_count_vec, vcntq_u8(vandq_u8(a_vec, b0_vec)));
+                and1_count_vec = vaddq_u8(and1_count_vec, vcntq_u8(vandq_u8(a_vec, b1_vec)));
+                and2_count_vec = vaddq_u8(and2_count_vec, vcntq_u8(vandq_u8(a_vec, b2_vec)));
+                and3_count_vec = vaddq_u8(and3_count_vec, vcntq_u8(vandq_u8(a_vec, b3_vec)));
+                b0_count_vec = vaddq_u8(b0_count_vec, vcntq_u8(b0_vec));
+                b1_count_vec = vaddq_u8(b1_count_vec, vcntq_u8(b1_vec));
+                b2_count_vec = vaddq_u8(b2_count_vec, vcntq_u8(b2_vec));
+                b3_count_vec = vaddq_u8(b3_count_vec, vcntq_u8(b3_vec));
+            }
+            intersection0 += _simsimd_reduce_u8x16_neon(and0_count_vec);
+            intersection1 += _simsimd_reduce_u8x16_neon(and1_count_vec);
+            intersection2 += _simsimd_reduce_u8x16_neon(and2_count_vec);
+            intersection3 += _simsimd_reduce_u8x16_neon(and3_count_vec);
+            b0_count += _simsimd_reduce_u8x16_neon(b0_count_vec), b1_count += _simsimd_reduce_u8x16_neon(b1_count_vec);
+            b2_count += _simsimd_reduce_u8x16_neon(b2_count_vec), b3_count += _simsimd_reduce_u8x16_neon(b3_count_vec);
+        }
+        for (; i != n_words; ++i)
+            intersection0 += simsimd_popcount_b8(a[i] & b0[i]), b0_count += simsimd_popcount_b8(b0[i]),
+                intersection1 += simsimd_popcount_b8(a[i] & b1[i]), b1_count += simsimd_popcount_b8(b1[i]),
+                intersection2 += simsimd_popcount_b8(a[i] & b2[i]), b2_count += simsimd_popcount_b8(b2[i]),
+                intersection3 += simsimd_popcount_b8(a[i] & b3[i]), b3_count += simsimd_popcount_b8(b3[i]);
+        simsimd_u32_t union0 = a_count + b0_count - intersection0, union1 = a_count + b1_count - intersection1;
+        simsimd_u32_t union2 = a_count + b2_count - intersection2, union3 = a_count + b3_count - intersection3;
+        results[j + 0] = (union0 != 0) ? 1 - (simsimd_f64_t)intersection0 / (simsimd_f64_t)union0 : 1;
+        results[j + 1] = (union1 != 0) ? 1 - (simsimd_f64_t)intersection1 / (simsimd_f64_t)union1 : 1;
+        results[j + 2] = (union2 != 0) ? 1 - (simsimd_f64_t)intersection2 / (simsimd_f64_t)union2 : 1;
+        results[j + 3] = (union3 != 0) ? 1 - (simsimd_f64_t)intersection3 / (simsimd_f64_t)union3 : 1;
+    }
+    for (; j != b_count; ++j)
+        simsimd_jaccard_b8_neon(a, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j), n_words, results + j);
+}
+
+SIMSIMD_MAKE_BINARY_CDIST(hamming, neon)  // simsimd_hamming_cdist_b8_neon
+SIMSIMD_MAKE_BINARY_CDIST(jaccard, neon)  // simsimd_jaccard_cdist_b8_neon
+SIMSIMD_MAKE_BINARY_RADIUS(hamming, neon) // simsimd_hamming_radius_b8_neon
+SIMSIMD_MAKE_BINARY_RADIUS(jaccard, neon) // simsimd_jaccard_radius_b8_neon
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_NEON
@@ -227,6 +460,126 @@ SIMSIMD_PUBLIC void simsimd_jaccard_b8_sve(simsimd_b8_t const *a, simsimd_b8_t c
     *result = (union_ != 0) ? 1 - (simsimd_f64_t)intersection / (simsimd_f64_t)union_ : 1;
 }
 
+SIMSIMD_PUBLIC void simsimd_hamming_batch_b8_sve(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n_words,
+                                                 simsimd_distance_t *results) {
+
+    // On very small register sizes, NEON is at least as fast as SVE.
+    simsimd_size_t const words_per_register = svcntb();
+    if (words_per_register <= 32) {
+        simsimd_hamming_batch_b8_neon(a, b, b_count, b_stride, n_words, results);
+        return;
+    }
+
+    svbool_t const all_vec = svptrue_b8();
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_b8_t const *b0 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 0);
+        simsimd_b8_t const *b1 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 1);
+        simsimd_b8_t const *b2 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 2);
+        simsimd_b8_t const *b3 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 3);
+        simsimd_u64_t differences0 = 0, differences1 = 0, differences2 = 0, differences3 = 0;
+        simsimd_size_t i = 0;
+        while (i < n_words) {
+            svuint8_t xor0_count_vec = svdup_n_u8(0), xor1_count_vec = svdup_n_u8(0);
+            svuint8_t xor2_count_vec = svdup_n_u8(0), xor3_count_vec = svdup_n_u8(0);
+            for (simsimd_size_t cycle = 0; cycle < 31 && i < n_words; ++cycle, i += words_per_register) {
+                svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n_words);
+                svuint8_t a_vec = svld1_u8(pg_vec, a + i);
+                svuint8_t xor0_vec = sveor_u8_x(all_vec, a_vec, svld1_u8(pg_vec, b0 + i));
+                svuint8_t xor1_vec = sveor_u8_x(all_vec, a_vec, svld1_u8(pg_vec, b1 + i));
+                svuint8_t xor2_vec = sveor_u8_x(all_vec, a_vec, svld1_u8(pg_vec, b2 + i));
+                svuint8_t xor3_vec = sveor_u8_x(all_vec, a_vec, svld1_u8(pg_vec, b3 + i));
+                xor0_count_vec = svadd_u8_x(all_vec, xor0_count_vec, svcnt_u8_x(all_vec, xor0_vec));
+                xor1_count_vec = svadd_u8_x(all_vec, xor1_count_vec, svcnt_u8_x(all_vec, xor1_vec));
+                xor2_count_vec = svadd_u8_x(all_vec, xor2_count_vec, svcnt_u8_x(all_vec, xor2_vec));
+                xor3_count_vec = svadd_u8_x(all_vec, xor3_count_vec, svcnt_u8_x(all_vec, xor3_vec));
+            }
+            differences0 += svaddv_u8(all_vec, xor0_count_vec), differences1 += svaddv_u8(all_vec, xor1_count_vec);
+            differences2 += svaddv_u8(all_vec, xor2_count_vec), differences3 += svaddv_u8(all_vec, xor3_count_vec);
+        }
+        results[j + 0] = differences0, results[j + 1] = differences1;
+        results[j + 2] = differences2, results[j + 3] = differences3;
+    }
+    for (; j != b_count; ++j)
+        simsimd_hamming_b8_sve(a, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j), n_words, results + j);
+}
+
+SIMSIMD_PUBLIC void simsimd_jaccard_batch_b8_sve(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n_words,
+                                                 simsimd_distance_t *results) {
+
+    // On very small register sizes, NEON is at least as fast as SVE.
+    simsimd_size_t const words_per_register = svcntb();
+    if (words_per_register <= 32) {
+        simsimd_jaccard_batch_b8_neon(a, b, b_count, b_stride, n_words, results);
+        return;
+    }
+
+    svbool_t const all_vec = svptrue_b8();
+    simsimd_u64_t a_count = 0;
+    simsimd_size_t i = 0;
+    while (i < n_words) {
+        svuint8_t a_count_vec = svdup_n_u8(0);
+        for (simsimd_size_t cycle = 0; cycle < 31 && i < n_words; ++cycle, i += words_per_register) {
+            svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n_words);
+            a_count_vec = svadd_u8_x(all_vec, a_count_vec, svcnt_u8_x(all_vec, svld1_u8(pg_vec, a + i)));
+        }
+        a_count += svaddv_u8(all_vec, a_count_vec);
+    }
+
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_b8_t const *b0 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 0);
+        simsimd_b8_t const *b1 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 1);
+        simsimd_b8_t const *b2 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 2);
+        simsimd_b8_t const *b3 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 3);
+        simsimd_u64_t intersection0 = 0, intersection1 = 0, intersection2 = 0, intersection3 = 0;
+        simsimd_u64_t b0_count = 0, b1_count = 0, b2_count = 0, b3_count = 0;
+        for (i = 0; i < n_words;) {
+            svuint8_t and0_count_vec = svdup_n_u8(0), and1_count_vec = svdup_n_u8(0);
+            svuint8_t and2_count_vec = svdup_n_u8(0), and3_count_vec = svdup_n_u8(0);
+            svuint8_t b0_count_vec = svdup_n_u8(0), b1_count_vec = svdup_n_u8(0);
+            svuint8_t b2_count_vec = svdup_n_u8(0), b3_count_vec = svdup_n_u8(0);
+            for (simsimd_size_t cycle = 0; cycle < 31 && i < n_words; ++cycle, i += words_per_register) {
+                svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n_words);
+                svuint8_t a_vec = svld1_u8(pg_vec, a + i);
+                svuint8_t b0_vec = svld1_u8(pg_vec, b0 + i), b1_vec = svld1_u8(pg_vec, b1 + i);
+                svuint8_t b2_vec = svld1_u8(pg_vec, b2 + i), b3_vec = svld1_u8(pg_vec, b3 + i);
+                and0_count_vec =
+                    svadd_u8_x(all_vec, and0_count_vec, svcnt_u8_x(all_vec, svand_u8_x(all_vec, a_vec, b0_vec)));
+                and1_count_vec =
+                    svadd_u8_x(all_vec, and1_count_vec, svcnt_u8_x(all_vec, svand_u8_x(all_vec, a_vec, b1_vec)));
+                and2_count_vec =
+                    svadd_u8_x(all_vec, and2_count_vec, svcnt_u8_x(all_vec, svand_u8_x(all_vec, a_vec, b2_vec)));
+                and3_count_vec =
+                    svadd_u8_x(all_vec, and3_count_vec, svcnt_u8_x(all_vec, svand_u8_x(all_vec, a_vec, b3_vec)));
+                b0_count_vec = svadd_u8_x(all_vec, b0_count_vec, svcnt_u8_x(all_vec, b0_vec));
+                b1_count_vec = svadd_u8_x(all_vec, b1_count_vec, svcnt_u8_x(all_vec, b1_vec));
+                b2_count_vec = svadd_u8_x(all_vec, b2_count_vec, svcnt_u8_x(all_vec, b2_vec));
+                b3_count_vec = svadd_u8_x(all_vec, b3_count_vec, svcnt_u8_x(all_vec, b3_vec));
+            }
+            intersection0 += svaddv_u8(all_vec, and0_count_vec), b0_count += svaddv_u8(all_vec, b0_count_vec);
+            intersection1 += svaddv_u8(all_vec, and1_count_vec), b1_count += svaddv_u8(all_vec, b1_count_vec);
+            intersection2 += svaddv_u8(all_vec, and2_count_vec), b2_count += svaddv_u8(all_vec, b2_count_vec);
+            intersection3 += svaddv_u8(all_vec, and3_count_vec), b3_count += svaddv_u8(all_vec, b3_count_vec);
+        }
+        simsimd_u64_t union0 = a_count + b0_count - intersection0, union1 = a_count + b1_count - intersection1;
+        simsimd_u64_t union2 = a_count + b2_count - intersection2, union3 = a_count + b3_count - intersection3;
+        results[j + 0] = (union0 != 0) ? 1 - (simsimd_f64_t)intersection0 / (simsimd_f64_t)union0 : 1;
+        results[j + 1] = (union1 != 0) ? 1 - (simsimd_f64_t)intersection1 / (simsimd_f64_t)union1 : 1;
+        results[j + 2] = (union2 != 0) ? 1 - (simsimd_f64_t)intersection2 / (simsimd_f64_t)union2 : 1;
+        results[j + 3] = (union3 != 0) ? 1 - (simsimd_f64_t)intersection3 / (simsimd_f64_t)union3 : 1;
+    }
+    for (; j != b_count; ++j)
+        simsimd_jaccard_b8_sve(a, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j), n_words, results + j);
+}
+
+SIMSIMD_MAKE_BINARY_CDIST(hamming, sve)  // simsimd_hamming_cdist_b8_sve
+SIMSIMD_MAKE_BINARY_CDIST(jaccard, sve)  // simsimd_jaccard_cdist_b8_sve
+SIMSIMD_MAKE_BINARY_RADIUS(hamming, sve) // simsimd_hamming_radius_b8_sve
+SIMSIMD_MAKE_BINARY_RADIUS(jaccard, sve) // simsimd_jaccard_radius_b8_sve
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_SVE
@@ -427,6 +780,155 @@ SIMSIMD_PUBLIC void simsimd_jaccard_b8_ice(simsimd_b8_t const *a, simsimd_b8_t c
     *result = (union_ != 0) ? 1 - (simsimd_f64_t)intersection / (simsimd_f64_t)union_ : 1;
 }
 
+SIMSIMD_PUBLIC void simsimd_hamming_batch_b8_ice(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n_words,
+                                                 simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+
+    // Binary codes of up to 512 bits fit into a single register, so we load the query once
+    // and stream the rows with a single masked load each.
+    if (n_words <= 64) {
+        __mmask64 mask = (__mmask64)_bzhi_u64(0xFFFFFFFFFFFFFFFF, n_words);
+        __m512i a_vec = _mm512_maskz_loadu_epi8(mask, a);
+        for (; j + 4 <= b_count; j += 4) {
+            __m512i b0_vec = _mm512_maskz_loadu_epi8(mask, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 0));
+            __m512i b1_vec = _mm512_maskz_loadu_epi8(mask, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 1));
+            __m512i b2_vec = _mm512_maskz_loadu_epi8(mask, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 2));
+            __m512i b3_vec = _mm512_maskz_loadu_epi8(mask, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 3));
+            results[j + 0] = _mm512_reduce_add_epi64(_mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b0_vec)));
+            results[j + 1] = _mm512_reduce_add_epi64(_mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b1_vec)));
+            results[j + 2] = _mm512_reduce_add_epi64(_mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b2_vec)));
+            results[j + 3] = _mm512_reduce_add_epi64(_mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b3_vec)));
+        }
+        for (; j != b_count; ++j) {
+            __m512i b_vec = _mm512_maskz_loadu_epi8(mask, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j));
+            results[j] = _mm512_reduce_add_epi64(_mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b_vec)));
+        }
+        return;
+    }
+
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_b8_t const *b0 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 0);
+        simsimd_b8_t const *b1 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 1);
+        simsimd_b8_t const *b2 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 2);
+        simsimd_b8_t const *b3 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 3);
+        __m512i xor0_count_vec = _mm512_setzero_si512(), xor1_count_vec = _mm512_setzero_si512();
+        __m512i xor2_count_vec = _mm512_setzero_si512(), xor3_count_vec = _mm512_setzero_si512();
+        __m512i a_vec, b0_vec, b1_vec, b2_vec, b3_vec;
+        simsimd_size_t i = 0;
+
+    simsimd_hamming_batch_b8_ice_cycle:
+        if (n_words - i < 64) {
+            __mmask64 mask = (__mmask64)_bzhi_u64(0xFFFFFFFFFFFFFFFF, n_words - i);
+            a_vec = _mm512_maskz_loadu_epi8(mask, a + i);
+            b0_vec = _mm512_maskz_loadu_epi8(mask, b0 + i), b1_vec = _mm512_maskz_loadu_epi8(mask, b1 + i);
+            b2_vec = _mm512_maskz_loadu_epi8(mask, b2 + i), b3_vec = _mm512_maskz_loadu_epi8(mask, b3 + i);
+            i = n_words;
+        }
+        else {
+            a_vec = _mm512_loadu_epi8(a + i);
+            b0_vec = _mm512_loadu_epi8(b0 + i), b1_vec = _mm512_loadu_epi8(b1 + i);
+            b2_vec = _mm512_loadu_epi8(b2 + i), b3_vec = _mm512_loadu_epi8(b3 + i);
+            i += 64;
+        }
+        xor0_count_vec = _mm512_add_epi64(xor0_count_vec, _mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b0_vec)));
+        xor1_count_vec = _mm512_add_epi64(xor1_count_vec, _mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b1_vec)));
+        xor2_count_vec = _mm512_add_epi64(xor2_count_vec, _mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b2_vec)));
+        xor3_count_vec = _mm512_add_epi64(xor3_count_vec, _mm512_popcnt_epi64(_mm512_xor_si512(a_vec, b3_vec)));
+        if (i < n_words) goto simsimd_hamming_batch_b8_ice_cycle;
+
+        results[j + 0] = _mm512_reduce_add_epi64(xor0_count_vec);
+        results[j + 1] = _mm512_reduce_add_epi64(xor1_count_vec);
+        results[j + 2] = _mm512_reduce_add_epi64(xor2_count_vec);
+        results[j + 3] = _mm512_reduce_add_epi64(xor3_count_vec);
+    }
+    for (; j != b_count; ++j)
+        simsimd_hamming_b8_ice(a, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j), n_words, results + j);
+}
+
+SIMSIMD_PUBLIC void simsimd_jaccard_batch_b8_ice(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n_words,
+                                                 simsimd_distance_t *results) {
+    // The union is derived from the population counts of both arguments and their intersection,
+    // so per row we only need `|a & b|` and `|b|`, while `|a|` is computed once.
+    __m512i a_count_vec = _mm512_setzero_si512();
+    for (simsimd_size_t i = 0; i < n_words; i += 64) {
+        __mmask64 mask = (__mmask64)_bzhi_u64(0xFFFFFFFFFFFFFFFF, n_words - i < 64 ? n_words - i : 64);
+        a_count_vec = _mm512_add_epi64(a_count_vec, _mm512_popcnt_epi64(_mm512_maskz_loadu_epi8(mask, a + i)));
+    }
+    simsimd_size_t a_count = _mm512_reduce_add_epi64(a_count_vec);
+
+    simsimd_size_t j = 0;
+    if (n_words <= 64) {
+        __mmask64 mask = (__mmask64)_bzhi_u64(0xFFFFFFFFFFFFFFFF, n_words);
+        __m512i a_vec = _mm512_maskz_loadu_epi8(mask, a);
+        for (; j != b_count; ++j) {
+            __m512i b_vec = _mm512_maskz_loadu_epi8(mask, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j));
+            simsimd_size_t intersection = _mm512_reduce_add_epi64(_mm512_popcnt_epi64(_mm512_and_si512(a_vec, b_vec)));
+            simsimd_size_t union_ = a_count + _mm512_reduce_add_epi64(_mm512_popcnt_epi64(b_vec)) - intersection;
+            results[j] = (union_ != 0) ? 1 - (simsimd_f64_t)intersection / (simsimd_f64_t)union_ : 1;
+        }
+        return;
+    }
+
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_b8_t const *b0 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 0);
+        simsimd_b8_t const *b1 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 1);
+        simsimd_b8_t const *b2 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 2);
+        simsimd_b8_t const *b3 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 3);
+        __m512i and0_count_vec = _mm512_setzero_si512(), and1_count_vec = _mm512_setzero_si512();
+        __m512i and2_count_vec = _mm512_setzero_si512(), and3_count_vec = _mm512_setzero_si512();
+        __m512i b0_count_vec = _mm512_setzero_si512(), b1_count_vec = _mm512_setzero_si512();
+        __m512i b2_count_vec = _mm512_setzero_si512(), b3_count_vec = _mm512_setzero_si512();
+        __m512i a_vec, b0_vec, b1_vec, b2_vec, b3_vec;
+        simsimd_size_t i = 0;
+
+    simsimd_jaccard_batch_b8_ice_cycle:
+        if (n_words - i < 64) {
+            __mmask64 mask = (__mmask64)_bzhi_u64(0xFFFFFFFFFFFFFFFF, n_words - i);
+            a_vec = _mm512_maskz_loadu_epi8(mask, a + i);
+            b0_vec = _mm512_maskz_loadu_epi8(mask, b0 + i), b1_vec = _mm512_maskz_loadu_epi8(mask, b1 + i);
+            b2_vec = _mm512_maskz_loadu_epi8(mask, b2 + i), b3_vec = _mm512_maskz_loadu_epi8(mask, b3 + i);
+            i = n_words;
+        }
+        else {
+            a_vec = _mm512_loadu_epi8(a + i);
+            b0_vec = _mm512_loadu_epi8(b0 + i), b1_vec = _mm512_loadu_epi8(b1 + i);
+            b2_vec = _mm512_loadu_epi8(b2 + i), b3_vec = _mm512_loadu_epi8(b3 + i);
+            i += 64;
+        }
+        and0_count_vec = _mm512_add_epi64(and0_count_vec, _mm512_popcnt_epi64(_mm512_and_si512(a_vec, b0_vec)));
+        and1_count_vec = _mm512_add_epi64(and1_count_vec, _mm512_popcnt_epi64(_mm512_and_si512(a_vec, b1_vec)));
+        and2_count_vec = _mm512_add_epi64(and2_count_vec, _mm512_popcnt_epi64(_mm512_and_si512(a_vec, b2_vec)));
+        and3_count_vec = _mm512_add_epi64(and3_count_vec, _mm512_popcnt_epi64(_mm512_and_si512(a_vec, b3_vec)));
+        b0_count_vec = _mm512_add_epi64(b0_count_vec, _mm512_popcnt_epi64(b0_vec));
+        b1_count_vec = _mm512_add_epi64(b1_count_vec, _mm512_popcnt_epi64(b1_vec));
+        b2_count_vec = _mm512_add_epi64(b2_count_vec, _mm512_popcnt_epi64(b2_vec));
+        b3_count_vec = _mm512_add_epi64(b3_count_vec, _mm512_popcnt_epi64(b3_vec));
+        if (i < n_words) goto simsimd_jaccard_batch_b8_ice_cycle;
+
+        simsimd_size_t intersection0 = _mm512_reduce_add_epi64(and0_count_vec);
+        simsimd_size_t intersection1 = _mm512_reduce_add_epi64(and1_count_vec);
+        simsimd_size_t intersection2 = _mm512_reduce_add_epi64(and2_count_vec);
+        simsimd_size_t intersection3 = _mm512_reduce_add_epi64(and3_count_vec);
+        simsimd_size_t union0 = a_count + _mm512_reduce_add_epi64(b0_count_vec) - intersection0;
+        simsimd_size_t union1 = a_count + _mm512_reduce_add_epi64(b1_count_vec) - intersection1;
+        simsimd_size_t union2 = a_count + _mm512_reduce_add_epi64(b2_count_vec) - intersection2;
+        simsimd_size_t union3 = a_count + _mm512_reduce_add_epi64(b3_count_vec) - intersection3;
+        results[j + 0] = (union0 != 0) ? 1 - (simsimd_f64_t)intersection0 / (simsimd_f64_t)union0 : 1;
+        results[j + 1] = (union1 != 0) ? 1 - (simsimd_f64_t)intersection1 / (simsimd_f64_t)union1 : 1;
+        results[j + 2] = (union2 != 0) ? 1 - (simsimd_f64_t)intersection2 / (simsimd_f64_t)union2 : 1;
+        results[j + 3] = (union3 != 0) ? 1 - (simsimd_f64_t)intersection3 / (simsimd_f64_t)union3 : 1;
+    }
+    for (; j != b_count; ++j)
+        simsimd_jaccard_b8_ice(a, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j), n_words, results + j);
+}
+
+SIMSIMD_MAKE_BINARY_CDIST(hamming, ice)  // simsimd_hamming_cdist_b8_ice
+SIMSIMD_MAKE_BINARY_CDIST(jaccard, ice)  // simsimd_jaccard_cdist_b8_ice
+SIMSIMD_MAKE_BINARY_RADIUS(hamming, ice) // simsimd_hamming_radius_b8_ice
+SIMSIMD_MAKE_BINARY_RADIUS(jaccard, ice) // simsimd_jaccard_radius_b8_ice
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_ICE
@@ -457,6 +959,60 @@ SIMSIMD_PUBLIC void simsimd_jaccard_b8_haswell(simsimd_b8_t const *a, simsimd_b8
     *result = (union_ != 0) ? 1 - (simsimd_f64_t)intersection / (simsimd_f64_t)union_ : 1;
 }
 
+SIMSIMD_PUBLIC void simsimd_hamming_batch_b8_haswell(simsimd_b8_t const *a, simsimd_b8_t const *b,
+                                                     simsimd_size_t b_count, simsimd_size_t b_stride,
+                                                     simsimd_size_t n_words, simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_b8_t const *b0 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 0);
+        simsimd_b8_t const *b1 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 1);
+        simsimd_b8_t const *b2 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 2);
+        simsimd_b8_t const *b3 = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j + 3);
+        simsimd_size_t differences0 = 0, differences1 = 0, differences2 = 0, differences3 = 0;
+        simsimd_size_t i = 0;
+        for (; i + 8 <= n_words; i += 8) {
+            simsimd_u64_t a_word = *(simsimd_u64_t const *)(a + i);
+            differences0 += _mm_popcnt_u64(a_word ^ *(simsimd_u64_t const *)(b0 + i));
+            differences1 += _mm_popcnt_u64(a_word ^ *(simsimd_u64_t const *)(b1 + i));
+            differences2 += _mm_popcnt_u64(a_word ^ *(simsimd_u64_t const *)(b2 + i));
+            differences3 += _mm_popcnt_u64(a_word ^ *(simsimd_u64_t const *)(b3 + i));
+        }
+        for (; i != n_words; ++i)
+            differences0 += _mm_popcnt_u32(a[i] ^ b0[i]), differences1 += _mm_popcnt_u32(a[i] ^ b1[i]),
+                differences2 += _mm_popcnt_u32(a[i] ^ b2[i]), differences3 += _mm_popcnt_u32(a[i] ^ b3[i]);
+        results[j + 0] = differences0, results[j + 1] = differences1;
+        results[j + 2] = differences2, results[j + 3] = differences3;
+    }
+    for (; j != b_count; ++j)
+        simsimd_hamming_b8_haswell(a, SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j), n_words, results + j);
+}
+
+SIMSIMD_PUBLIC void simsimd_jaccard_batch_b8_haswell(simsimd_b8_t const *a, simsimd_b8_t const *b,
+                                                     simsimd_size_t b_count, simsimd_size_t b_stride,
+                                                     simsimd_size_t n_words, simsimd_distance_t *results) {
+    simsimd_size_t a_count = 0, i = 0;
+    for (; i + 8 <= n_words; i += 8) a_count += _mm_popcnt_u64(*(simsimd_u64_t const *)(a + i));
+    for (; i != n_words; ++i) a_count += _mm_popcnt_u32(a[i]);
+    for (simsimd_size_t j = 0; j != b_count; ++j) {
+        simsimd_b8_t const *b_row = SIMSIMD_ROW(simsimd_b8_t, b, b_stride, j);
+        simsimd_size_t intersection = 0, b_count_bits = 0;
+        for (i = 0; i + 8 <= n_words; i += 8) {
+            simsimd_u64_t b_word = *(simsimd_u64_t const *)(b_row + i);
+            intersection += _mm_popcnt_u64(*(simsimd_u64_t const *)(a + i) & b_word);
+            b_count_bits += _mm_popcnt_u64(b_word);
+        }
+        for (; i != n_words; ++i)
+            intersection += _mm_popcnt_u32(a[i] & b_row[i]), b_count_bits += _mm_popcnt_u32(b_row[i]);
+        simsimd_size_t union_ = a_count + b_count_bits - intersection;
+        results[j] = (union_ != 0) ? 1 - (simsimd_f64_t)intersection / (simsimd_f64_t)union_ : 1;
+    }
+}
+
+SIMSIMD_MAKE_BINARY_CDIST(hamming, haswell)  // simsimd_hamming_cdist_b8_haswell
+SIMSIMD_MAKE_BINARY_CDIST(jaccard, haswell)  // simsimd_jaccard_cdist_b8_haswell
+SIMSIMD_MAKE_BINARY_RADIUS(hamming, haswell) // simsimd_hamming_radius_b8_haswell
+SIMSIMD_MAKE_BINARY_RADIUS(jaccard, haswell) // simsimd_jaccard_radius_b8_haswell
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_HASWELL
@@ -0,0 +1,1680 @@
+/**
+ *  @file       cdist.h
+ *  @brief      SIMD-accelerated many-to-many Distance Matrices.
+ *  @author     Ash Vardanian
+ *  @date       October 14, 2026
+ *
+ *  Contains:
+ *  - Inner product matrices
+ *  - Cosine (Angular) distance matrices
+ *  - L2 (Euclidean) regular and squared distance matrices
+ *
+ *  For datatypes:
+ *  - 32-bit IEEE floating point numbers
+ *  - 16-bit IEEE floating point numbers
+ *  - 16-bit brain floating point numbers
+ *  - 8-bit signed integral numbers
+ *
+ *  For hardware architectures:
+ *  - Arm: NEON, SVE, SVE2.1
+ *  - x86: Haswell, Skylake, Ice Lake, Genoa, Sapphire Rapids AMX
+ *
+ *  A distance matrix between `a_count` rows of `a` and `b_count` rows of `b` is a matrix multiplication
+ *  `a * b^T` followed by a norm correction for every cell. So instead of streaming both vectors for every
+ *  pair, these kernels follow the layout of GEMM libraries:
+ *
+ *  - Inputs are split into blocks of `SIMSIMD_CDIST_MC` rows of `a`, `SIMSIMD_CDIST_NC` rows of `b`, and
+ *    `SIMSIMD_CDIST_KC` dimensions, sized to fit the packed panels into the L1/L2 caches.
+ *  - Each block is packed into a contiguous zero-padded panel, upcasting `f16` and `bf16` into `f32`
+ *    once per panel instead of once per pair, unless the hardware has a native dot-product for them.
+ *  - Every packed panel of `b` and its norms are shared by up to `SIMSIMD_CDIST_MB` rows of `a`, so for
+ *    inputs of that size, including every task of `simsimd_cdist_parallel`, `b` is packed only once.
+ *  - A 4x4 micro-kernel multiplies 4 rows of `a` by 4 rows of `b`, reusing every loaded register 4 times.
+ *    On CPUs with AMX, a 32x32 micro-kernel multiplies tiles of 16 rows, once the inputs are large enough.
+ *  - Squared norms of every packed row are accumulated alongside, to derive the cosine and L2 distances.
+ *
+ *  For L2 distances the result is derived as `|a|^2 + |b|^2 - 2 * a * b`, which loses precision for
+ *  almost identical vectors, the same way SciPy and BLAS-based implementations do.
+ *
+ *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
+ *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
+ */
+#ifndef SIMSIMD_CDIST_H
+#define SIMSIMD_CDIST_H
+
+#include "types.h"
+
+#include "dot.h"     // `simsimd_dot_f32_skylake`, used to compute the norms of packed rows
+#include "spatial.h" // `_simsimd_cos_normalize_f64_serial`
+
+/**
+ *  @brief  Number of rows of `a` and `b` packed at once, and the number of dimensions in each panel.
+ *          The rows must be multiples of 4, or of 32 with AMX, and the dimensions must be a multiple of 64.
+ *          The defaults result in two 16 KB panels on the stack.
+ */
+#if !defined(SIMSIMD_CDIST_MC)
+#define SIMSIMD_CDIST_MC 32
+#endif
+#if !defined(SIMSIMD_CDIST_NC)
+#define SIMSIMD_CDIST_NC 32
+#endif
+#if !defined(SIMSIMD_CDIST_KC)
+#define SIMSIMD_CDIST_KC 128
+#endif
+
+/**
+ *  @brief  Number of rows of `a` sharing every packed panel of `b`, a multiple of `SIMSIMD_CDIST_MC`.
+ *          Their dot-products with `SIMSIMD_CDIST_NC` rows of `b` are accumulated in a 16 KB buffer on the stack.
+ *          With the panels, the defaults keep the scratch space of every call under 50 KB, as the kernels may run
+ *          on threads with small stacks, like the 128 KB default of musl.
+ */
+#if !defined(SIMSIMD_CDIST_MB)
+#define SIMSIMD_CDIST_MB 64
+#endif
+#if SIMSIMD_CDIST_MB % SIMSIMD_CDIST_MC
+#error "`SIMSIMD_CDIST_MB` must be a multiple of `SIMSIMD_CDIST_MC`"
+#endif
+
+/**
+ *  @brief  Minimum number of rows in both `a` and `b` to use the AMX kernels. Every AMX call configures the tiles
+ *          and transposes every panel of `b`, so smaller inputs are forwarded to AVX-512.
+ */
+#if !defined(SIMSIMD_CDIST_AMX_MIN_ROWS)
+#define SIMSIMD_CDIST_AMX_MIN_ROWS 32
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// clang-format off
+
+/*  All of the many-to-many kernels share the same signature, comparing `a_count` rows of `a` against `b_count`
+ *  rows of `b`, separated by `a_stride` and `b_stride` bytes. The output is a row-major `a_count` by `b_count`
+ *  matrix, with consecutive rows separated by `results_stride` bytes.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+
+/*  SIMD-powered backends for Arm NEON, mostly using 32-bit arithmetic over 128-bit words.
+ *  Half-precision inputs are upcast while packing, so a single `f32` micro-kernel serves all float types.
+ *  The `i8` micro-kernel relies on the `vdotq_s32` instruction from the "dotprod" extension.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+
+/*  SIMD-powered backends for Arm SVE, mostly using 32-bit arithmetic over variable-length platform-defined word sizes.
+ *  The panels are padded to 4 dimensions, and the micro-kernel uses predicated loads for the rest.
+ *  With `i8mm` and `bf16` extensions, the `i8` and `bf16` panels are multiplied in 2x2 blocks with `smmla` and
+ *  `bfmmla`, and with SVE2.1 the `f16` panels are consumed by `fdot`, without upcasting to `f32`.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+
+/*  SIMD-powered backends for AVX2 CPUs of Haswell generation and newer, using 32-bit arithmetic over 256-bit words.
+ *  With only 16 registers available, the 4x4 micro-kernel is evaluated as two 2x4 halves.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+
+/*  SIMD-powered backends for AVX512 CPUs of Skylake generation and newer, using 32-bit arithmetic over 512-bit words.
+ *  Ice Lake uses `vpdpbusd` for `i8`, biasing the rows of `a` into unsigned integers and correcting the result.
+ *  Genoa keeps `bf16` panels unpacked and uses `vdpbf16ps`, processing 32 dimensions per instruction.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_bf16_sapphire_amx(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_bf16_sapphire_amx(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_bf16_sapphire_amx(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_bf16_sapphire_amx(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_i8_sapphire_amx(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_i8_sapphire_amx(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_i8_sapphire_amx(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_i8_sapphire_amx(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+
+/*  Variants of all the kernels above, writing the output matrix directly in the `results_type` precision, which
+ *  must be one of `simsimd_datatype_f64_k`, `simsimd_datatype_f32_k`, `simsimd_datatype_f16_k`, or
+ *  `simsimd_datatype_bf16_k`. The narrowing is vectorized and fused into the export of every cache block.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_bf16_sapphire_amx(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_bf16_sapphire_amx(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_bf16_sapphire_amx(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_bf16_sapphire_amx(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_i8_sapphire_amx(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_i8_sapphire_amx(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_i8_sapphire_amx(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_i8_sapphire_amx(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+
+/*  Variants of the angular and Euclidean kernels above, reusing the squared norms of the rows, precomputed with
+ *  `simsimd_norms_*`, instead of accumulating them alongside the dot-products. Either of `a_norms` and `b_norms`
+ *  can be null, in which case the norms of that side are computed on the fly, as in the `_typed` kernels.
+ */
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_bf16_sapphire_amx(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_bf16_sapphire_amx(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_bf16_sapphire_amx(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_i8_sapphire_amx(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_i8_sapphire_amx(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_i8_sapphire_amx(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norms, simsimd_distance_t const* b_norms, void* results, simsimd_size_t results_stride, simsimd_datatype_t results_type);
+// clang-format on
+
+/**
+ *  @brief  Packs `count` rows of `depth` scalars, starting at dimension `offset`, into a contiguous panel.
+ *          Every row in the panel is zero-padded to `depth_padded` scalars, and `count_padded - count`
+ *          rows of zeros are appended, so that the micro-kernels never have to handle the tails.
+ */
+typedef void (*_simsimd_cdist_pack_t)(void const *rows, simsimd_size_t stride, simsimd_size_t count,
+                                      simsimd_size_t count_padded, simsimd_size_t offset, simsimd_size_t depth,
+                                      simsimd_size_t depth_padded, void *panel);
+
+/**
+ *  @brief  Multiplies 4 packed rows of `a` by 4 packed rows of `b`, adding the 4x4 dot-products to the `block`,
+ *          where consecutive rows are separated by `block_stride` entries. The AMX kernels handle 32 rows at once.
+ */
+typedef void (*_simsimd_cdist_tile_t)(void const *a_panel, void const *b_panel, simsimd_size_t depth_padded,
+                                      simsimd_distance_t *block, simsimd_size_t block_stride);
+
+/**
+ *  @brief  Rearranges `tile_rows` packed rows of `b` into the layout consumed by the micro-kernel, if it can't
+ *          use the rows directly. Called once per panel of `b`, rather than once per micro-kernel call.
+ */
+typedef void (*_simsimd_cdist_interleave_t)(void const *rows, simsimd_size_t row_bytes, void *interleaved);
+
+/**
+ *  @brief  Dot-product of a single pair of packed rows, used to compute the squared norms.
+ *          Matches the signature of `simsimd_metric_dense_punned_t`.
+ */
+typedef void (*_simsimd_cdist_norm_t)(void const *a, void const *b, simsimd_size_t n, simsimd_distance_t *result);
+
+/**
+ *  @brief  Exports `count` finished distances into a row of the output matrix, narrowing them to `type`,
+ *          which must be `f64`, `f32`, `f16`, or `bf16`.
+ */
+typedef void (*_simsimd_cdist_cast_t)(simsimd_distance_t const *distances, simsimd_size_t count,
+                                      simsimd_datatype_t type, void *results);
+
+typedef enum {
+    _simsimd_cdist_dot_k = 0,
+    _simsimd_cdist_cos_k = 1,
+    _simsimd_cdist_l2sq_k = 2,
+    _simsimd_cdist_l2_k = 3,
+} _simsimd_cdist_metric_t;
+
+/**
+ *  @brief  Blocked driver shared by all of the many-to-many kernels.
+ *  @param  tile_rows The number of rows of `a` and `b` multiplied by every `tile` call, dividing both
+ *                  `SIMSIMD_CDIST_MC` and `SIMSIMD_CDIST_NC`.
+ *  @param  interleave Optional layout change of the `b` panels, only for packed scalars of up to 2 bytes,
+ *                  as the result is stored in the upper half of the `f32` panel.
+ *  @param  norm    Single-pair dot-product over the packed panels, used to compute the squared norms.
+ *  @param  depth_alignment The number of scalars every packed row is padded to, matching the micro-kernel.
+ *  @param  panel_scalar_size The size of a single packed scalar in bytes.
+ *  @param  cast    Exports the rows of finished distances, narrowing them to the `results_type`.
+ *  @param  a_cached_norms  Optional precomputed squared norms of all `a` rows, skipping their accumulation.
+ *  @param  b_cached_norms  Optional precomputed squared norms of all `b` rows, skipping their accumulation.
+ */
+SIMSIMD_INTERNAL void _simsimd_cdist_engine(                                                             //
+    void const *a, void const *b, simsimd_size_t a_count, simsimd_size_t a_stride,                       //
+    simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,                                   //
+    void *results, simsimd_size_t results_stride, simsimd_datatype_t results_type,                       //
+    _simsimd_cdist_metric_t metric, _simsimd_cdist_pack_t pack, _simsimd_cdist_tile_t tile,              //
+    simsimd_size_t tile_rows, _simsimd_cdist_interleave_t interleave,                                    //
+    _simsimd_cdist_norm_t norm, _simsimd_cdist_cast_t cast,                                              //
+    simsimd_size_t depth_alignment,                                                                      //
+    simsimd_size_t panel_scalar_size, simsimd_distance_t const *a_cached_norms,                          //
+    simsimd_distance_t const *b_cached_norms) {
+
+    // The panels are declared as `f32` arrays for alignment, but may contain narrower scalars.
+    simsimd_f32_t a_panel[SIMSIMD_CDIST_MC * SIMSIMD_CDIST_KC];
+    simsimd_f32_t b_panel[SIMSIMD_CDIST_NC * SIMSIMD_CDIST_KC];
+    simsimd_distance_t block[SIMSIMD_CDIST_MB * SIMSIMD_CDIST_NC];
+    simsimd_distance_t a_norms[SIMSIMD_CDIST_MB], b_norms[SIMSIMD_CDIST_NC];
+    int const needs_norms = metric != _simsimd_cdist_dot_k;
+    int const needs_a_norms = needs_norms && !a_cached_norms, needs_b_norms = needs_norms && !b_cached_norms;
+    simsimd_size_t const results_scalar_size = results_type == simsimd_datatype_f64_k   ? sizeof(simsimd_f64_t)
+                                               : results_type == simsimd_datatype_f32_k ? sizeof(simsimd_f32_t)
+                                                                                        : sizeof(simsimd_f16_t);
+
+    for (simsimd_size_t g0 = 0; g0 < a_count; g0 += SIMSIMD_CDIST_MB) {
+        simsimd_size_t const mb = a_count - g0 < SIMSIMD_CDIST_MB ? a_count - g0 : SIMSIMD_CDIST_MB;
+        simsimd_size_t const mb_padded = (mb + tile_rows - 1) / tile_rows * tile_rows;
+        // The cached norms are copied into the local buffers, so the correction below stays uniform
+        for (simsimd_size_t i = 0; i != mb; ++i) a_norms[i] = a_cached_norms ? a_cached_norms[g0 + i] : 0;
+
+        for (simsimd_size_t j0 = 0; j0 < b_count; j0 += SIMSIMD_CDIST_NC) {
+            simsimd_size_t const nc = b_count - j0 < SIMSIMD_CDIST_NC ? b_count - j0 : SIMSIMD_CDIST_NC;
+            simsimd_size_t const nc_padded = (nc + tile_rows - 1) / tile_rows * tile_rows;
+            void const *b_rows = (simsimd_u8_t const *)b + j0 * b_stride;
+
+            for (simsimd_size_t i = 0; i != mb_padded * SIMSIMD_CDIST_NC; ++i) block[i] = 0;
+            for (simsimd_size_t j = 0; j != nc; ++j) b_norms[j] = b_cached_norms ? b_cached_norms[j0 + j] : 0;
+
+            for (simsimd_size_t k0 = 0; k0 < n; k0 += SIMSIMD_CDIST_KC) {
+                simsimd_size_t const kc = n - k0 < SIMSIMD_CDIST_KC ? n - k0 : SIMSIMD_CDIST_KC;
+                simsimd_size_t const kc_padded = (kc + depth_alignment - 1) / depth_alignment * depth_alignment;
+                simsimd_size_t const row_bytes = kc_padded * panel_scalar_size;
+                simsimd_distance_t norm_part;
+
+                // The panel of `b` and its norms are shared by all blocks of `a` in the group
+                pack(b_rows, b_stride, nc, nc_padded, k0, kc, kc_padded, b_panel);
+                for (simsimd_size_t j = 0; j != nc && needs_b_norms; ++j) {
+                    void const *row = (simsimd_u8_t const *)b_panel + j * row_bytes;
+                    norm(row, row, kc_padded, &norm_part);
+                    b_norms[j] += norm_part;
+                }
+                // Micro-kernels with their own layout get a copy of the panel, rearranged once for all blocks of `a`
+                simsimd_u8_t *b_tiles = (simsimd_u8_t *)b_panel;
+                if (interleave) {
+                    b_tiles += SIMSIMD_CDIST_NC * SIMSIMD_CDIST_KC * panel_scalar_size;
+                    for (simsimd_size_t j = 0; j != nc_padded; j += tile_rows)
+                        interleave((simsimd_u8_t const *)b_panel + j * row_bytes, row_bytes, b_tiles + j * row_bytes);
+                }
+
+                for (simsimd_size_t i0 = 0; i0 < mb; i0 += SIMSIMD_CDIST_MC) {
+                    simsimd_size_t const mc = mb - i0 < SIMSIMD_CDIST_MC ? mb - i0 : SIMSIMD_CDIST_MC;
+                    simsimd_size_t const mc_padded = (mc + tile_rows - 1) / tile_rows * tile_rows;
+                    void const *a_rows = (simsimd_u8_t const *)a + (g0 + i0) * a_stride;
+                    pack(a_rows, a_stride, mc, mc_padded, k0, kc, kc_padded, a_panel);
+
+                    // The norms of `a` rows are reused across all blocks of `b`
+                    for (simsimd_size_t i = 0; i != mc && j0 == 0 && needs_a_norms; ++i) {
+                        void const *row = (simsimd_u8_t const *)a_panel + i * row_bytes;
+                        norm(row, row, kc_padded, &norm_part);
+                        a_norms[i0 + i] += norm_part;
+                    }
+
+                    for (simsimd_size_t i = 0; i != mc_padded; i += tile_rows)
+                        for (simsimd_size_t j = 0; j != nc_padded; j += tile_rows)
+                            tile((simsimd_u8_t const *)a_panel + i * row_bytes, b_tiles + j * row_bytes, kc_padded,
+                                 block + (i0 + i) * SIMSIMD_CDIST_NC + j, SIMSIMD_CDIST_NC);
+                }
+            }
+
+            // Apply the norm corrections in place, and export the block row by row
+            for (simsimd_size_t i = 0; i != mb; ++i) {
+                void *results_row = (simsimd_u8_t *)results + (g0 + i) * results_stride + j0 * results_scalar_size;
+                simsimd_distance_t *block_row = block + i * SIMSIMD_CDIST_NC;
+                simsimd_distance_t const a2 = a_norms[i];
+                for (simsimd_size_t j = 0; j != nc && metric != _simsimd_cdist_dot_k; ++j) {
+                    simsimd_distance_t ab = block_row[j], b2 = b_norms[j];
+                    simsimd_distance_t d2;
+                    switch (metric) {
+                    case _simsimd_cdist_dot_k: break;
+                    case _simsimd_cdist_cos_k: block_row[j] = _simsimd_cos_normalize_f64_serial(ab, a2, b2); break;
+                    case _simsimd_cdist_l2sq_k:
+                    case _simsimd_cdist_l2_k:
+                        d2 = a2 + b2 - 2 * ab;
+                        d2 = d2 > 0 ? d2 : 0;
+                        block_row[j] = metric == _simsimd_cdist_l2_k ? SIMSIMD_SQRT(d2) : d2;
+                        break;
+                    }
+                }
+                cast(block_row, nc, results_type, results_row);
+            }
+        }
+    }
+}
+
+#define SIMSIMD_MAKE_CDIST_PACK(name, input_type, panel_type, load_and_convert)                                    \
+    SIMSIMD_INTERNAL void _simsimd_cdist_pack_##input_type##_##panel_type##_##name(                                \
+        void const *rows, simsimd_size_t stride, simsimd_size_t count, simsimd_size_t count_padded,                \
+        simsimd_size_t offset, simsimd_size_t depth, simsimd_size_t depth_padded, void *panel_punned) {            \
+        simsimd_##panel_type##_t *panel = (simsimd_##panel_type##_t *)panel_punned;                                \
+        simsimd_size_t r = 0, k;                                                                                   \
+        for (; r != count; ++r, panel += depth_padded) {                                                           \
+            simsimd_##input_type##_t const *row = SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, r) + offset; \
+            for (k = 0; k != depth; ++k) panel[k] = load_and_convert(row + k);                                     \
+            for (; k != depth_padded; ++k) panel[k] = 0;                                                           \
+        }                                                                                                          \
+        for (; r != count_padded; ++r, panel += depth_padded)                                                      \
+            for (k = 0; k != depth_padded; ++k) panel[k] = 0;                                                      \
+    }
+
+#define SIMSIMD_MAKE_CDIST_TILE(name, panel_type, accumulator_type)                                                 \
+    SIMSIMD_INTERNAL void _simsimd_cdist_tile_##panel_type##_##name(void const *a_punned, void const *b_punned,     \
+                                                                    simsimd_size_t depth, simsimd_distance_t *block, \
+                                                                    simsimd_size_t block_stride) {                  \
+        simsimd_##panel_type##_t const *a = (simsimd_##panel_type##_t const *)a_punned;                             \
+        simsimd_##panel_type##_t const *b = (simsimd_##panel_type##_t const *)b_punned;                             \
+        simsimd_##accumulator_type##_t ab[4][4] = {{0}};                                                            \
+        for (simsimd_size_t k = 0; k != depth; ++k) {                                                               \
+            simsimd_##accumulator_type##_t a_k[4], b_k[4];                                                          \
+            for (int r = 0; r != 4; ++r) a_k[r] = a[r * depth + k], b_k[r] = b[r * depth + k];                      \
+            for (int r = 0; r != 4; ++r)                                                                            \
+                for (int c = 0; c != 4; ++c) ab[r][c] += a_k[r] * b_k[c];                                           \
+        }                                                                                                           \
+        for (int r = 0; r != 4; ++r)                                                                                \
+            for (int c = 0; c != 4; ++c) block[r * block_stride + c] += ab[r][c];                                   \
+    }
+
+#define SIMSIMD_MAKE_CDIST_METRIC(name, input_type, metric, pack, tile, norm, cast, depth_alignment, panel_type)       \
+    SIMSIMD_PUBLIC void simsimd_##metric##_cdist_##input_type##_##name(                                                \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t a_count,                  \
+        simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,                    \
+        simsimd_distance_t *results, simsimd_size_t results_stride) {                                                  \
+        _simsimd_cdist_engine(a, b, a_count, a_stride, b_count, b_stride, n, results, results_stride,                  \
+                              simsimd_datatype_f64_k, _simsimd_cdist_##metric##_k, pack, tile, 4, 0,                   \
+                              (_simsimd_cdist_norm_t)norm, cast, depth_alignment, sizeof(simsimd_##panel_type##_t), 0, \
+                              0);                                                                                      \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC void simsimd_##metric##_cdist_typed_##input_type##_##name(                                          \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t a_count,                  \
+        simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void *results,     \
+        simsimd_size_t results_stride, simsimd_datatype_t results_type) {                                              \
+        _simsimd_cdist_engine(a, b, a_count, a_stride, b_count, b_stride, n, results, results_stride, results_type,    \
+                              _simsimd_cdist_##metric##_k, pack, tile, 4, 0, (_simsimd_cdist_norm_t)norm, cast,        \
+                              depth_alignment, sizeof(simsimd_##panel_type##_t), 0, 0);                                \
+    }
+
+#define SIMSIMD_MAKE_CDIST_NORMED(name, input_type, metric, pack, tile, norm, cast, depth_alignment, panel_type)       \
+    SIMSIMD_PUBLIC void simsimd_##metric##_cdist_normed_##input_type##_##name(                                         \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t a_count,                  \
+        simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,                    \
+        simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms, void *results,                           \
+        simsimd_size_t results_stride, simsimd_datatype_t results_type) {                                              \
+        _simsimd_cdist_engine(a, b, a_count, a_stride, b_count, b_stride, n, results, results_stride, results_type,    \
+                              _simsimd_cdist_##metric##_k, pack, tile, 4, 0, (_simsimd_cdist_norm_t)norm, cast,        \
+                              depth_alignment, sizeof(simsimd_##panel_type##_t), a_norms, b_norms);                    \
+    }
+
+#define SIMSIMD_MAKE_CDIST(name, input_type, pack, tile, norm, cast, depth_alignment, panel_type)                      \
+    SIMSIMD_MAKE_CDIST_METRIC(name, input_type, dot, pack, tile, norm, cast, depth_alignment, panel_type)              \
+    SIMSIMD_MAKE_CDIST_METRIC(name, input_type, cos, pack, tile, norm, cast, depth_alignment, panel_type)              \
+    SIMSIMD_MAKE_CDIST_METRIC(name, input_type, l2sq, pack, tile, norm, cast, depth_alignment, panel_type)             \
+    SIMSIMD_MAKE_CDIST_METRIC(name, input_type, l2, pack, tile, norm, cast, depth_alignment, panel_type)               \
+    SIMSIMD_MAKE_CDIST_NORMED(name, input_type, cos, pack, tile, norm, cast, depth_alignment, panel_type)              \
+    SIMSIMD_MAKE_CDIST_NORMED(name, input_type, l2sq, pack, tile, norm, cast, depth_alignment, panel_type)             \
+    SIMSIMD_MAKE_CDIST_NORMED(name, input_type, l2, pack, tile, norm, cast, depth_alignment, panel_type)
+
+/*  The AMX variants multiply 32x32 tiles, and forward the inputs with fewer than `SIMSIMD_CDIST_AMX_MIN_ROWS` rows
+ *  in either `a` or `b` to the `fallback` kernels of the same metric, as the tiles would be mostly padding.
+ *  The tiles are configured once before the engine runs, and released once it returns.
+ */
+#define SIMSIMD_MAKE_CDIST_AMX_METRIC(name, input_type, metric, fallback, pack, tile, interleave, norm, cast, align)   \
+    SIMSIMD_PUBLIC void simsimd_##metric##_cdist_##input_type##_##name(                                                \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t a_count,                  \
+        simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,                    \
+        simsimd_distance_t *results, simsimd_size_t results_stride) {                                                  \
+        if (a_count < SIMSIMD_CDIST_AMX_MIN_ROWS || b_count < SIMSIMD_CDIST_AMX_MIN_ROWS) {                            \
+            simsimd_##metric##_cdist_##input_type##_##fallback(a, b, a_count, a_stride, b_count, b_stride, n, results, \
+                                                               results_stride);                                        \
+            return;                                                                                                    \
+        }                                                                                                              \
+        _simsimd_tile_configure_##name();                                                                              \
+        _simsimd_cdist_engine(a, b, a_count, a_stride, b_count, b_stride, n, results, results_stride,                  \
+                              simsimd_datatype_f64_k, _simsimd_cdist_##metric##_k, pack, tile, 32, interleave,         \
+                              (_simsimd_cdist_norm_t)norm, cast, align, sizeof(simsimd_##input_type##_t), 0, 0);       \
+        _tile_release();                                                                                               \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC void simsimd_##metric##_cdist_typed_##input_type##_##name(                                          \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t a_count,                  \
+        simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, void *results,     \
+        simsimd_size_t results_stride, simsimd_datatype_t results_type) {                                              \
+        if (a_count < SIMSIMD_CDIST_AMX_MIN_ROWS || b_count < SIMSIMD_CDIST_AMX_MIN_ROWS) {                            \
+            simsimd_##metric##_cdist_typed_##input_type##_##fallback(a, b, a_count, a_stride, b_count, b_stride, n,    \
+                                                                     results, results_stride, results_type);           \
+            return;                                                                                                    \
+        }                                                                                                              \
+        _simsimd_tile_configure_##name();                                                                              \
+        _simsimd_cdist_engine(a, b, a_count, a_stride, b_count, b_stride, n, results, results_stride, results_type,    \
+                              _simsimd_cdist_##metric##_k, pack, tile, 32, interleave, (_simsimd_cdist_norm_t)norm,    \
+                              cast, align, sizeof(simsimd_##input_type##_t), 0, 0);                                    \
+        _tile_release();                                                                                               \
+    }
+
+#define SIMSIMD_MAKE_CDIST_AMX_NORMED(name, input_type, metric, fallback, pack, tile, interleave, norm, cast, align)   \
+    SIMSIMD_PUBLIC void simsimd_##metric##_cdist_normed_##input_type##_##name(                                         \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t a_count,                  \
+        simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,                    \
+        simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms, void *results,                           \
+        simsimd_size_t results_stride, simsimd_datatype_t results_type) {                                              \
+        if (a_count < SIMSIMD_CDIST_AMX_MIN_ROWS || b_count < SIMSIMD_CDIST_AMX_MIN_ROWS) {                            \
+            simsimd_##metric##_cdist_normed_##input_type##_##fallback(a, b, a_count, a_stride, b_count, b_stride, n,   \
+                                                                      a_norms, b_norms, results, results_stride,       \
+                                                                      results_type);                                   \
+            return;                                                                                                    \
+        }                                                                                                              \
+        _simsimd_tile_configure_##name();                                                                              \
+        _simsimd_cdist_engine(a, b, a_count, a_stride, b_count, b_stride, n, results, results_stride, results_type,    \
+                              _simsimd_cdist_##metric##_k, pack, tile, 32, interleave, (_simsimd_cdist_norm_t)norm,    \
+                              cast, align, sizeof(simsimd_##input_type##_t), a_norms, b_norms);                        \
+        _tile_release();                                                                                               \
+    }
+
+#define SIMSIMD_MAKE_CDIST_AMX(name, input_type, fallback, pack, tile, interleave, norm, cast, align)                  \
+    SIMSIMD_MAKE_CDIST_AMX_METRIC(name, input_type, dot, fallback, pack, tile, interleave, norm, cast, align)          \
+    SIMSIMD_MAKE_CDIST_AMX_METRIC(name, input_type, cos, fallback, pack, tile, interleave, norm, cast, align)          \
+    SIMSIMD_MAKE_CDIST_AMX_METRIC(name, input_type, l2sq, fallback, pack, tile, interleave, norm, cast, align)         \
+    SIMSIMD_MAKE_CDIST_AMX_METRIC(name, input_type, l2, fallback, pack, tile, interleave, norm, cast, align)           \
+    SIMSIMD_MAKE_CDIST_AMX_NORMED(name, input_type, cos, fallback, pack, tile, interleave, norm, cast, align)          \
+    SIMSIMD_MAKE_CDIST_AMX_NORMED(name, input_type, l2sq, fallback, pack, tile, interleave, norm, cast, align)         \
+    SIMSIMD_MAKE_CDIST_AMX_NORMED(name, input_type, l2, fallback, pack, tile, interleave, norm, cast, align)
+
+/**
+ *  @brief  Exports a row of distances one scalar at a time, relying on the compiler to vectorize the `f32` case.
+ */
+SIMSIMD_INTERNAL void _simsimd_cdist_cast_serial(simsimd_distance_t const *distances, simsimd_size_t count,
+                                                 simsimd_datatype_t type, void *results) {
+    simsimd_size_t i = 0;
+    switch (type) {
+    case simsimd_datatype_f64_k:
+        for (; i != count; ++i) ((simsimd_f64_t *)results)[i] = distances[i];
+        break;
+    case simsimd_datatype_f32_k:
+        for (; i != count; ++i) ((simsimd_f32_t *)results)[i] = (simsimd_f32_t)distances[i];
+        break;
+    case simsimd_datatype_f16_k:
+        for (; i != count; ++i) SIMSIMD_F32_TO_F16((simsimd_f32_t)distances[i], (simsimd_f16_t *)results + i);
+        break;
+    case simsimd_datatype_bf16_k:
+        for (; i != count; ++i) SIMSIMD_F32_TO_BF16((simsimd_f32_t)distances[i], (simsimd_bf16_t *)results + i);
+        break;
+    default: break;
+    }
+}
+
+SIMSIMD_MAKE_CDIST_PACK(serial, f32, f32, SIMSIMD_DEREFERENCE)   // _simsimd_cdist_pack_f32_f32_serial
+SIMSIMD_MAKE_CDIST_PACK(serial, f16, f32, SIMSIMD_F16_TO_F32)    // _simsimd_cdist_pack_f16_f32_serial
+SIMSIMD_MAKE_CDIST_PACK(serial, bf16, f32, SIMSIMD_BF16_TO_F32)  // _simsimd_cdist_pack_bf16_f32_serial
+SIMSIMD_MAKE_CDIST_PACK(serial, bf16, bf16, SIMSIMD_DEREFERENCE) // _simsimd_cdist_pack_bf16_bf16_serial
+SIMSIMD_MAKE_CDIST_PACK(serial, f16, f16, SIMSIMD_DEREFERENCE)   // _simsimd_cdist_pack_f16_f16_serial
+SIMSIMD_MAKE_CDIST_PACK(serial, i8, i8, SIMSIMD_DEREFERENCE)     // _simsimd_cdist_pack_i8_i8_serial
+
+SIMSIMD_MAKE_CDIST_TILE(serial, f32, f32) // _simsimd_cdist_tile_f32_serial
+SIMSIMD_MAKE_CDIST_TILE(serial, i8, i32)  // _simsimd_cdist_tile_i8_serial
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_f32_serial
+SIMSIMD_MAKE_CDIST(serial, f32, _simsimd_cdist_pack_f32_f32_serial, _simsimd_cdist_tile_f32_serial,
+                   simsimd_dot_f32_serial, _simsimd_cdist_cast_serial, 1, f32)
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_f16_serial
+SIMSIMD_MAKE_CDIST(serial, f16, _simsimd_cdist_pack_f16_f32_serial, _simsimd_cdist_tile_f32_serial,
+                   simsimd_dot_f32_serial, _simsimd_cdist_cast_serial, 1, f32)
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_bf16_serial
+SIMSIMD_MAKE_CDIST(serial, bf16, _simsimd_cdist_pack_bf16_f32_serial, _simsimd_cdist_tile_f32_serial,
+                   simsimd_dot_f32_serial, _simsimd_cdist_cast_serial, 1, f32)
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_i8_serial
+SIMSIMD_MAKE_CDIST(serial, i8, _simsimd_cdist_pack_i8_i8_serial, _simsimd_cdist_tile_i8_serial, simsimd_dot_i8_serial,
+                   _simsimd_cdist_cast_serial, 1, i8)
+
+#if _SIMSIMD_TARGET_ARM
+#if SIMSIMD_TARGET_NEON
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+simd")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+simd"))), apply_to = function)
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_f32_neon(void const *a_punned, void const *b_punned, simsimd_size_t depth,
+                                                   simsimd_distance_t *block, simsimd_size_t block_stride) {
+    simsimd_f32_t const *a = (simsimd_f32_t const *)a_punned;
+    simsimd_f32_t const *b = (simsimd_f32_t const *)b_punned;
+    float32x4_t ab00_vec = vdupq_n_f32(0), ab01_vec = vdupq_n_f32(0);
+    float32x4_t ab02_vec = vdupq_n_f32(0), ab03_vec = vdupq_n_f32(0);
+    float32x4_t ab10_vec = vdupq_n_f32(0), ab11_vec = vdupq_n_f32(0);
+    float32x4_t ab12_vec = vdupq_n_f32(0), ab13_vec = vdupq_n_f32(0);
+    float32x4_t ab20_vec = vdupq_n_f32(0), ab21_vec = vdupq_n_f32(0);
+    float32x4_t ab22_vec = vdupq_n_f32(0), ab23_vec = vdupq_n_f32(0);
+    float32x4_t ab30_vec = vdupq_n_f32(0), ab31_vec = vdupq_n_f32(0);
+    float32x4_t ab32_vec = vdupq_n_f32(0), ab33_vec = vdupq_n_f32(0);
+    for (simsimd_size_t k = 0; k != depth; k += 4) {
+        float32x4_t a0_vec = vld1q_f32(a + k), a1_vec = vld1q_f32(a + depth + k);
+        float32x4_t a2_vec = vld1q_f32(a + 2 * depth + k), a3_vec = vld1q_f32(a + 3 * depth + k);
+        float32x4_t b0_vec = vld1q_f32(b + k), b1_vec = vld1q_f32(b + depth + k);
+        float32x4_t b2_vec = vld1q_f32(b + 2 * depth + k), b3_vec = vld1q_f32(b + 3 * depth + k);
+        ab00_vec = vfmaq_f32(ab00_vec, a0_vec, b0_vec), ab01_vec = vfmaq_f32(ab01_vec, a0_vec, b1_vec);
+        ab02_vec = vfmaq_f32(ab02_vec, a0_vec, b2_vec), ab03_vec = vfmaq_f32(ab03_vec, a0_vec, b3_vec);
+        ab10_vec = vfmaq_f32(ab10_vec, a1_vec, b0_vec), ab11_vec = vfmaq_f32(ab11_vec, a1_vec, b1_vec);
+        ab12_vec = vfmaq_f32(ab12_vec, a1_vec, b2_vec), ab13_vec = vfmaq_f32(ab13_vec, a1_vec, b3_vec);
+        ab20_vec = vfmaq_f32(ab20_vec, a2_vec, b0_vec), ab21_vec = vfmaq_f32(ab21_vec, a2_vec, b1_vec);
+        ab22_vec = vfmaq_f32(ab22_vec, a2_vec, b2_vec), ab23_vec = vfmaq_f32(ab23_vec, a2_vec, b3_vec);
+        ab30_vec = vfmaq_f32(ab30_vec, a3_vec, b0_vec), ab31_vec = vfmaq_f32(ab31_vec, a3_vec, b1_vec);
+        ab32_vec = vfmaq_f32(ab32_vec, a3_vec, b2_vec), ab33_vec = vfmaq_f32(ab33_vec, a3_vec, b3_vec);
+    }
+    block[0] += vaddvq_f32(ab00_vec), block[1] += vaddvq_f32(ab01_vec);
+    block[2] += vaddvq_f32(ab02_vec), block[3] += vaddvq_f32(ab03_vec);
+    block += block_stride;
+    block[0] += vaddvq_f32(ab10_vec), block[1] += vaddvq_f32(ab11_vec);
+    block[2] += vaddvq_f32(ab12_vec), block[3] += vaddvq_f32(ab13_vec);
+    block += block_stride;
+    block[0] += vaddvq_f32(ab20_vec), block[1] += vaddvq_f32(ab21_vec);
+    block[2] += vaddvq_f32(ab22_vec), block[3] += vaddvq_f32(ab23_vec);
+    block += block_stride;
+    block[0] += vaddvq_f32(ab30_vec), block[1] += vaddvq_f32(ab31_vec);
+    block[2] += vaddvq_f32(ab32_vec), block[3] += vaddvq_f32(ab33_vec);
+}
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_f32_neon
+SIMSIMD_MAKE_CDIST(neon, f32, _simsimd_cdist_pack_f32_f32_serial, _simsimd_cdist_tile_f32_neon, simsimd_dot_f32_neon,
+                   _simsimd_cdist_cast_serial, 4, f32)
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_f16_neon
+SIMSIMD_MAKE_CDIST(neon, f16, _simsimd_cdist_pack_f16_f32_serial, _simsimd_cdist_tile_f32_neon, simsimd_dot_f32_neon,
+                   _simsimd_cdist_cast_serial, 4, f32)
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_bf16_neon
+SIMSIMD_MAKE_CDIST(neon, bf16, _simsimd_cdist_pack_bf16_f32_serial, _simsimd_cdist_tile_f32_neon, simsimd_dot_f32_neon,
+                   _simsimd_cdist_cast_serial, 4, f32)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON
+
+#if SIMSIMD_TARGET_NEON_I8
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+dotprod")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+dotprod"))), apply_to = function)
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_i8_neon(void const *a_punned, void const *b_punned, simsimd_size_t depth,
+                                                  simsimd_distance_t *block, simsimd_size_t block_stride) {
+    simsimd_i8_t const *a = (simsimd_i8_t const *)a_punned;
+    simsimd_i8_t const *b = (simsimd_i8_t const *)b_punned;
+    int32x4_t ab00_vec = vdupq_n_s32(0), ab01_vec = vdupq_n_s32(0);
+    int32x4_t ab02_vec = vdupq_n_s32(0), ab03_vec = vdupq_n_s32(0);
+    int32x4_t ab10_vec = vdupq_n_s32(0), ab11_vec = vdupq_n_s32(0);
+    int32x4_t ab12_vec = vdupq_n_s32(0), ab13_vec = vdupq_n_s32(0);
+    int32x4_t ab20_vec = vdupq_n_s32(0), ab21_vec = vdupq_n_s32(0);
+    int32x4_t ab22_vec = vdupq_n_s32(0), ab23_vec = vdupq_n_s32(0);
+    int32x4_t ab30_vec = vdupq_n_s32(0), ab31_vec = vdupq_n_s32(0);
+    int32x4_t ab32_vec = vdupq_n_s32(0), ab33_vec = vdupq_n_s32(0);
+    for (simsimd_size_t k = 0; k != depth; k += 16) {
+        int8x16_t a0_vec = vld1q_s8(a + k), a1_vec = vld1q_s8(a + depth + k);
+        int8x16_t a2_vec = vld1q_s8(a + 2 * depth + k), a3_vec = vld1q_s8(a + 3 * depth + k);
+        int8x16_t b0_vec = vld1q_s8(b + k), b1_vec = vld1q_s8(b + depth + k);
+        int8x16_t b2_vec = vld1q_s8(b + 2 * depth + k), b3_vec = vld1q_s8(b + 3 * depth + k);
+        ab00_vec = vdotq_s32(ab00_vec, a0_vec, b0_vec), ab01_vec = vdotq_s32(ab01_vec, a0_vec, b1_vec);
+        ab02_vec = vdotq_s32(ab02_vec, a0_vec, b2_vec), ab03_vec = vdotq_s32(ab03_vec, a0_vec, b3_vec);
+        ab10_vec = vdotq_s32(ab10_vec, a1_vec, b0_vec), ab11_vec = vdotq_s32(ab11_vec, a1_vec, b1_vec);
+        ab12_vec = vdotq_s32(ab12_vec, a1_vec, b2_vec), ab13_vec = vdotq_s32(ab13_vec, a1_vec, b3_vec);
+        ab20_vec = vdotq_s32(ab20_vec, a2_vec, b0_vec), ab21_vec = vdotq_s32(ab21_vec, a2_vec, b1_vec);
+        ab22_vec = vdotq_s32(ab22_vec, a2_vec, b2_vec), ab23_vec = vdotq_s32(ab23_vec, a2_vec, b3_vec);
+        ab30_vec = vdotq_s32(ab30_vec, a3_vec, b0_vec), ab31_vec = vdotq_s32(ab31_vec, a3_vec, b1_vec);
+        ab32_vec = vdotq_s32(ab32_vec, a3_vec, b2_vec), ab33_vec = vdotq_s32(ab33_vec, a3_vec, b3_vec);
+    }
+    block[0] += vaddvq_s32(ab00_vec), block[1] += vaddvq_s32(ab01_vec);
+    block[2] += vaddvq_s32(ab02_vec), block[3] += vaddvq_s32(ab03_vec);
+    block += block_stride;
+    block[0] += vaddvq_s32(ab10_vec), block[1] += vaddvq_s32(ab11_vec);
+    block[2] += vaddvq_s32(ab12_vec), block[3] += vaddvq_s32(ab13_vec);
+    block += block_stride;
+    block[0] += vaddvq_s32(ab20_vec), block[1] += vaddvq_s32(ab21_vec);
+    block[2] += vaddvq_s32(ab22_vec), block[3] += vaddvq_s32(ab23_vec);
+    block += block_stride;
+    block[0] += vaddvq_s32(ab30_vec), block[1] += vaddvq_s32(ab31_vec);
+    block[2] += vaddvq_s32(ab32_vec), block[3] += vaddvq_s32(ab33_vec);
+}
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_i8_neon
+SIMSIMD_MAKE_CDIST(neon, i8, _simsimd_cdist_pack_i8_i8_serial, _simsimd_cdist_tile_i8_neon, simsimd_dot_i8_neon,
+                   _simsimd_cdist_cast_serial, 16, i8)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON_I8
+
+#if SIMSIMD_TARGET_SVE
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+sve")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+sve"))), apply_to = function)
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_f32_sve(void const *a_punned, void const *b_punned, simsimd_size_t depth,
+                                                  simsimd_distance_t *block, simsimd_size_t block_stride) {
+    simsimd_f32_t const *a = (simsimd_f32_t const *)a_punned;
+    simsimd_f32_t const *b = (simsimd_f32_t const *)b_punned;
+    svfloat32_t ab00_vec = svdup_f32(0.f), ab01_vec = svdup_f32(0.f);
+    svfloat32_t ab02_vec = svdup_f32(0.f), ab03_vec = svdup_f32(0.f);
+    svfloat32_t ab10_vec = svdup_f32(0.f), ab11_vec = svdup_f32(0.f);
+    svfloat32_t ab12_vec = svdup_f32(0.f), ab13_vec = svdup_f32(0.f);
+    svfloat32_t ab20_vec = svdup_f32(0.f), ab21_vec = svdup_f32(0.f);
+    svfloat32_t ab22_vec = svdup_f32(0.f), ab23_vec = svdup_f32(0.f);
+    svfloat32_t ab30_vec = svdup_f32(0.f), ab31_vec = svdup_f32(0.f);
+    svfloat32_t ab32_vec = svdup_f32(0.f), ab33_vec = svdup_f32(0.f);
+    for (simsimd_size_t k = 0; k < depth; k += svcntw()) {
+        svbool_t pg_vec = svwhilelt_b32((unsigned int)k, (unsigned int)depth);
+        svfloat32_t a0_vec = svld1_f32(pg_vec, a + k), a1_vec = svld1_f32(pg_vec, a + depth + k);
+        svfloat32_t a2_vec = svld1_f32(pg_vec, a + 2 * depth + k), a3_vec = svld1_f32(pg_vec, a + 3 * depth + k);
+        svfloat32_t b0_vec = svld1_f32(pg_vec, b + k), b1_vec = svld1_f32(pg_vec, b + depth + k);
+        svfloat32_t b2_vec = svld1_f32(pg_vec, b + 2 * depth + k), b3_vec = svld1_f32(pg_vec, b + 3 * depth + k);
+        ab00_vec = svmla_f32_m(pg_vec, ab00_vec, a0_vec, b0_vec);
+        ab01_vec = svmla_f32_m(pg_vec, ab01_vec, a0_vec, b1_vec);
+        ab02_vec = svmla_f32_m(pg_vec, ab02_vec, a0_vec, b2_vec);
+        ab03_vec = svmla_f32_m(pg_vec, ab03_vec, a0_vec, b3_vec);
+        ab10_vec = svmla_f32_m(pg_vec, ab10_vec, a1_vec, b0_vec);
+        ab11_vec = svmla_f32_m(pg_vec, ab11_vec, a1_vec, b1_vec);
+        ab12_vec = svmla_f32_m(pg_vec, ab12_vec, a1_vec, b2_vec);
+        ab13_vec = svmla_f32_m(pg_vec, ab13_vec, a1_vec, b3_vec);
+        ab20_vec = svmla_f32_m(pg_vec, ab20_vec, a2_vec, b0_vec);
+        ab21_vec = svmla_f32_m(pg_vec, ab21_vec, a2_vec, b1_vec);
+        ab22_vec = svmla_f32_m(pg_vec, ab22_vec, a2_vec, b2_vec);
+        ab23_vec = svmla_f32_m(pg_vec, ab23_vec, a2_vec, b3_vec);
+        ab30_vec = svmla_f32_m(pg_vec, ab30_vec, a3_vec, b0_vec);
+        ab31_vec = svmla_f32_m(pg_vec, ab31_vec, a3_vec, b1_vec);
+        ab32_vec = svmla_f32_m(pg_vec, ab32_vec, a3_vec, b2_vec);
+        ab33_vec = svmla_f32_m(pg_vec, ab33_vec, a3_vec, b3_vec);
+    }
+    svbool_t all_vec = svptrue_b32();
+    block[0] += svaddv_f32(all_vec, ab00_vec), block[1] += svaddv_f32(all_vec, ab01_vec);
+    block[2] += svaddv_f32(all_vec, ab02_vec), block[3] += svaddv_f32(all_vec, ab03_vec);
+    block += block_stride;
+    block[0] += svaddv_f32(all_vec, ab10_vec), block[1] += svaddv_f32(all_vec, ab11_vec);
+    block[2] += svaddv_f32(all_vec, ab12_vec), block[3] += svaddv_f32(all_vec, ab13_vec);
+    block += block_stride;
+    block[0] += svaddv_f32(all_vec, ab20_vec), block[1] += svaddv_f32(all_vec, ab21_vec);
+    block[2] += svaddv_f32(all_vec, ab22_vec), block[3] += svaddv_f32(all_vec, ab23_vec);
+    block += block_stride;
+    block[0] += svaddv_f32(all_vec, ab30_vec), block[1] += svaddv_f32(all_vec, ab31_vec);
+    block[2] += svaddv_f32(all_vec, ab32_vec), block[3] += svaddv_f32(all_vec, ab33_vec);
+}
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_f32_sve
+SIMSIMD_MAKE_CDIST(sve, f32, _simsimd_cdist_pack_f32_f32_serial, _simsimd_cdist_tile_f32_sve, simsimd_dot_f32_sve,
+                   _simsimd_cdist_cast_serial, 4, f32)
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_f16_sve
+SIMSIMD_MAKE_CDIST(sve, f16, _simsimd_cdist_pack_f16_f32_serial, _simsimd_cdist_tile_f32_sve, simsimd_dot_f32_sve,
+                   _simsimd_cdist_cast_serial, 4, f32)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SVE
+
+/*  The `svmmla_s32` and `svbfmmla_f32` multiply a 2xK block of `a` by a Kx2 block of `b` in every 128-bit segment,
+ *  producing a 2x2 block of the output. To feed them, the rows of the packed panels are interleaved in pairs, with
+ *  `svzip1_u64` and `svzip2_u64` placing the same 8-byte chunk of both rows into one segment. The `abXY` accumulators
+ *  hold the X-th pair of `a` rows multiplied by the Y-th pair of `b` rows, with every segment ordered as
+ *  `(a0 * b0, a0 * b1, a1 * b0, a1 * b1)`, so the final reduction sums every 4th lane.
+ */
+#define _SIMSIMD_CDIST_SVE_MMLA_STORE(addv, ab00_vec, ab01_vec, ab10_vec, ab11_vec)                                    \
+    do {                                                                                                               \
+        svbool_t all_vec = svptrue_b32();                                                                              \
+        svuint32_t lanes_vec = svand_n_u32_x(all_vec, svindex_u32(0, 1), 3);                                           \
+        svbool_t c0_vec = svcmpeq_n_u32(all_vec, lanes_vec, 0);                                                        \
+        svbool_t c1_vec = svcmpeq_n_u32(all_vec, lanes_vec, 1);                                                        \
+        svbool_t c2_vec = svcmpeq_n_u32(all_vec, lanes_vec, 2);                                                        \
+        svbool_t c3_vec = svcmpeq_n_u32(all_vec, lanes_vec, 3);                                                        \
+        block[0] += addv(c0_vec, ab00_vec), block[1] += addv(c1_vec, ab00_vec);                                        \
+        block[2] += addv(c0_vec, ab01_vec), block[3] += addv(c1_vec, ab01_vec);                                        \
+        block += block_stride;                                                                                         \
+        block[0] += addv(c2_vec, ab00_vec), block[1] += addv(c3_vec, ab00_vec);                                        \
+        block[2] += addv(c2_vec, ab01_vec), block[3] += addv(c3_vec, ab01_vec);                                        \
+        block += block_stride;                                                                                         \
+        block[0] += addv(c0_vec, ab10_vec), block[1] += addv(c1_vec, ab10_vec);                                        \
+        block[2] += addv(c0_vec, ab11_vec), block[3] += addv(c1_vec, ab11_vec);                                        \
+        block += block_stride;                                                                                         \
+        block[0] += addv(c2_vec, ab10_vec), block[1] += addv(c3_vec, ab10_vec);                                        \
+        block[2] += addv(c2_vec, ab11_vec), block[3] += addv(c3_vec, ab11_vec);                                        \
+    } while (0)
+
+#if SIMSIMD_TARGET_SVE_I8
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+sve+i8mm")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+sve+i8mm"))), apply_to = function)
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_i8_sve(void const *a_punned, void const *b_punned, simsimd_size_t depth,
+                                                 simsimd_distance_t *block, simsimd_size_t block_stride) {
+    simsimd_i8_t const *a = (simsimd_i8_t const *)a_punned;
+    simsimd_i8_t const *b = (simsimd_i8_t const *)b_punned;
+    // The "low" and "high" accumulators consume the two halves of the zipped rows, doubling the independent chains
+    svint32_t ab00_low_vec = svdup_n_s32(0), ab01_low_vec = svdup_n_s32(0);
+    svint32_t ab10_low_vec = svdup_n_s32(0), ab11_low_vec = svdup_n_s32(0);
+    svint32_t ab00_high_vec = svdup_n_s32(0), ab01_high_vec = svdup_n_s32(0);
+    svint32_t ab10_high_vec = svdup_n_s32(0), ab11_high_vec = svdup_n_s32(0);
+    // The `depth` is a multiple of 16, so every 128-bit segment is either fully active or fully zeroed
+    for (simsimd_size_t k = 0; k < depth; k += svcntb()) {
+        svbool_t pg_vec = svwhilelt_b8((unsigned int)k, (unsigned int)depth);
+        svuint64_t a0_vec = svreinterpret_u64_s8(svld1_s8(pg_vec, a + k));
+        svuint64_t a1_vec = svreinterpret_u64_s8(svld1_s8(pg_vec, a + depth + k));
+        svuint64_t a2_vec = svreinterpret_u64_s8(svld1_s8(pg_vec, a + 2 * depth + k));
+        svuint64_t a3_vec = svreinterpret_u64_s8(svld1_s8(pg_vec, a + 3 * depth + k));
+        svuint64_t b0_vec = svreinterpret_u64_s8(svld1_s8(pg_vec, b + k));
+        svuint64_t b1_vec = svreinterpret_u64_s8(svld1_s8(pg_vec, b + depth + k));
+        svuint64_t b2_vec = svreinterpret_u64_s8(svld1_s8(pg_vec, b + 2 * depth + k));
+        svuint64_t b3_vec = svreinterpret_u64_s8(svld1_s8(pg_vec, b + 3 * depth + k));
+        svint8_t a01_low_vec = svreinterpret_s8_u64(svzip1_u64(a0_vec, a1_vec));
+        svint8_t a01_high_vec = svreinterpret_s8_u64(svzip2_u64(a0_vec, a1_vec));
+        svint8_t a23_low_vec = svreinterpret_s8_u64(svzip1_u64(a2_vec, a3_vec));
+        svint8_t a23_high_vec = svreinterpret_s8_u64(svzip2_u64(a2_vec, a3_vec));
+        svint8_t b01_low_vec = svreinterpret_s8_u64(svzip1_u64(b0_vec, b1_vec));
+        svint8_t b01_high_vec = svreinterpret_s8_u64(svzip2_u64(b0_vec, b1_vec));
+        svint8_t b23_low_vec = svreinterpret_s8_u64(svzip1_u64(b2_vec, b3_vec));
+        svint8_t b23_high_vec = svreinterpret_s8_u64(svzip2_u64(b2_vec, b3_vec));
+        ab00_low_vec = svmmla_s32(ab00_low_vec, a01_low_vec, b01_low_vec);
+        ab01_low_vec = svmmla_s32(ab01_low_vec, a01_low_vec, b23_low_vec);
+        ab10_low_vec = svmmla_s32(ab10_low_vec, a23_low_vec, b01_low_vec);
+        ab11_low_vec = svmmla_s32(ab11_low_vec, a23_low_vec, b23_low_vec);
+        ab00_high_vec = svmmla_s32(ab00_high_vec, a01_high_vec, b01_high_vec);
+        ab01_high_vec = svmmla_s32(ab01_high_vec, a01_high_vec, b23_high_vec);
+        ab10_high_vec = svmmla_s32(ab10_high_vec, a23_high_vec, b01_high_vec);
+        ab11_high_vec = svmmla_s32(ab11_high_vec, a23_high_vec, b23_high_vec);
+    }
+    svbool_t all_vec = svptrue_b32();
+    svint32_t ab00_vec = svadd_s32_x(all_vec, ab00_low_vec, ab00_high_vec);
+    svint32_t ab01_vec = svadd_s32_x(all_vec, ab01_low_vec, ab01_high_vec);
+    svint32_t ab10_vec = svadd_s32_x(all_vec, ab10_low_vec, ab10_high_vec);
+    svint32_t ab11_vec = svadd_s32_x(all_vec, ab11_low_vec, ab11_high_vec);
+    _SIMSIMD_CDIST_SVE_MMLA_STORE(svaddv_s32, ab00_vec, ab01_vec, ab10_vec, ab11_vec);
+}
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_i8_sve
+SIMSIMD_MAKE_CDIST(sve, i8, _simsimd_cdist_pack_i8_i8_serial, _simsimd_cdist_tile_i8_sve, simsimd_dot_i8_sve,
+                   _simsimd_cdist_cast_serial, 16, i8)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SVE_I8
+
+#if SIMSIMD_TARGET_SVE_BF16
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+sve+bf16")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+sve+bf16"))), apply_to = function)
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_bf16_sve(void const *a_punned, void const *b_punned, simsimd_size_t depth,
+                                                   simsimd_distance_t *block, simsimd_size_t block_stride) {
+    simsimd_u16_t const *a = (simsimd_u16_t const *)a_punned;
+    simsimd_u16_t const *b = (simsimd_u16_t const *)b_punned;
+    svfloat32_t ab00_low_vec = svdup_f32(0.f), ab01_low_vec = svdup_f32(0.f);
+    svfloat32_t ab10_low_vec = svdup_f32(0.f), ab11_low_vec = svdup_f32(0.f);
+    svfloat32_t ab00_high_vec = svdup_f32(0.f), ab01_high_vec = svdup_f32(0.f);
+    svfloat32_t ab10_high_vec = svdup_f32(0.f), ab11_high_vec = svdup_f32(0.f);
+    // The `depth` is a multiple of 8, so every 128-bit segment is either fully active or fully zeroed
+    for (simsimd_size_t k = 0; k < depth; k += svcnth()) {
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)k, (unsigned int)depth);
+        svuint64_t a0_vec = svreinterpret_u64_u16(svld1_u16(pg_vec, a + k));
+        svuint64_t a1_vec = svreinterpret_u64_u16(svld1_u16(pg_vec, a + depth + k));
+        svuint64_t a2_vec = svreinterpret_u64_u16(svld1_u16(pg_vec, a + 2 * depth + k));
+        svuint64_t a3_vec = svreinterpret_u64_u16(svld1_u16(pg_vec, a + 3 * depth + k));
+        svuint64_t b0_vec = svreinterpret_u64_u16(svld1_u16(pg_vec, b + k));
+        svuint64_t b1_vec = svreinterpret_u64_u16(svld1_u16(pg_vec, b + depth + k));
+        svuint64_t b2_vec = svreinterpret_u64_u16(svld1_u16(pg_vec, b + 2 * depth + k));
+        svuint64_t b3_vec = svreinterpret_u64_u16(svld1_u16(pg_vec, b + 3 * depth + k));
+        svbfloat16_t a01_low_vec = svreinterpret_bf16_u64(svzip1_u64(a0_vec, a1_vec));
+        svbfloat16_t a01_high_vec = svreinterpret_bf16_u64(svzip2_u64(a0_vec, a1_vec));
+        svbfloat16_t a23_low_vec = svreinterpret_bf16_u64(svzip1_u64(a2_vec, a3_vec));
+        svbfloat16_t a23_high_vec = svreinterpret_bf16_u64(svzip2_u64(a2_vec, a3_vec));
+        svbfloat16_t b01_low_vec = svreinterpret_bf16_u64(svzip1_u64(b0_vec, b1_vec));
+        svbfloat16_t b01_high_vec = svreinterpret_bf16_u64(svzip2_u64(b0_vec, b1_vec));
+        svbfloat16_t b23_low_vec = svreinterpret_bf16_u64(svzip1_u64(b2_vec, b3_vec));
+        svbfloat16_t b23_high_vec = svreinterpret_bf16_u64(svzip2_u64(b2_vec, b3_vec));
+        ab00_low_vec = svbfmmla_f32(ab00_low_vec, a01_low_vec, b01_low_vec);
+        ab01_low_vec = svbfmmla_f32(ab01_low_vec, a01_low_vec, b23_low_vec);
+        ab10_low_vec = svbfmmla_f32(ab10_low_vec, a23_low_vec, b01_low_vec);
+        ab11_low_vec = svbfmmla_f32(ab11_low_vec, a23_low_vec, b23_low_vec);
+        ab00_high_vec = svbfmmla_f32(ab00_high_vec, a01_high_vec, b01_high_vec);
+        ab01_high_vec = svbfmmla_f32(ab01_high_vec, a01_high_vec, b23_high_vec);
+        ab10_high_vec = svbfmmla_f32(ab10_high_vec, a23_high_vec, b01_high_vec);
+        ab11_high_vec = svbfmmla_f32(ab11_high_vec, a23_high_vec, b23_high_vec);
+    }
+    svbool_t all_vec = svptrue_b32();
+    svfloat32_t ab00_vec = svadd_f32_x(all_vec, ab00_low_vec, ab00_high_vec);
+    svfloat32_t ab01_vec = svadd_f32_x(all_vec, ab01_low_vec, ab01_high_vec);
+    svfloat32_t ab10_vec = svadd_f32_x(all_vec, ab10_low_vec, ab10_high_vec);
+    svfloat32_t ab11_vec = svadd_f32_x(all_vec, ab11_low_vec, ab11_high_vec);
+    _SIMSIMD_CDIST_SVE_MMLA_STORE(svaddv_f32, ab00_vec, ab01_vec, ab10_vec, ab11_vec);
+}
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_bf16_sve
+SIMSIMD_MAKE_CDIST(sve, bf16, _simsimd_cdist_pack_bf16_bf16_serial, _simsimd_cdist_tile_bf16_sve,
+                   simsimd_dot_bf16_sve, _simsimd_cdist_cast_serial, 8, bf16)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SVE_BF16
+
+#if SIMSIMD_TARGET_SVE2P1
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+sve+sve2+sve2p1")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+sve+sve2+sve2p1"))), apply_to = function)
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_f16_sve2p1(void const *a_punned, void const *b_punned, simsimd_size_t depth,
+                                                     simsimd_distance_t *block, simsimd_size_t block_stride) {
+    simsimd_f16_for_arm_simd_t const *a = (simsimd_f16_for_arm_simd_t const *)a_punned;
+    simsimd_f16_for_arm_simd_t const *b = (simsimd_f16_for_arm_simd_t const *)b_punned;
+    svfloat32_t ab00_vec = svdup_f32(0.f), ab01_vec = svdup_f32(0.f);
+    svfloat32_t ab02_vec = svdup_f32(0.f), ab03_vec = svdup_f32(0.f);
+    svfloat32_t ab10_vec = svdup_f32(0.f), ab11_vec = svdup_f32(0.f);
+    svfloat32_t ab12_vec = svdup_f32(0.f), ab13_vec = svdup_f32(0.f);
+    svfloat32_t ab20_vec = svdup_f32(0.f), ab21_vec = svdup_f32(0.f);
+    svfloat32_t ab22_vec = svdup_f32(0.f), ab23_vec = svdup_f32(0.f);
+    svfloat32_t ab30_vec = svdup_f32(0.f), ab31_vec = svdup_f32(0.f);
+    svfloat32_t ab32_vec = svdup_f32(0.f), ab33_vec = svdup_f32(0.f);
+    // The predicated loads zero the inactive lanes, so that the unpredicated `svdot` can consume them
+    for (simsimd_size_t k = 0; k < depth; k += svcnth()) {
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)k, (unsigned int)depth);
+        svfloat16_t a0_vec = svld1_f16(pg_vec, a + k), a1_vec = svld1_f16(pg_vec, a + depth + k);
+        svfloat16_t a2_vec = svld1_f16(pg_vec, a + 2 * depth + k), a3_vec = svld1_f16(pg_vec, a + 3 * depth + k);
+        svfloat16_t b0_vec = svld1_f16(pg_vec, b + k), b1_vec = svld1_f16(pg_vec, b + depth + k);
+        svfloat16_t b2_vec = svld1_f16(pg_vec, b + 2 * depth + k), b3_vec = svld1_f16(pg_vec, b + 3 * depth + k);
+        ab00_vec = svdot_f32_f16(ab00_vec, a0_vec, b0_vec), ab01_vec = svdot_f32_f16(ab01_vec, a0_vec, b1_vec);
+        ab02_vec = svdot_f32_f16(ab02_vec, a0_vec, b2_vec), ab03_vec = svdot_f32_f16(ab03_vec, a0_vec, b3_vec);
+        ab10_vec = svdot_f32_f16(ab10_vec, a1_vec, b0_vec), ab11_vec = svdot_f32_f16(ab11_vec, a1_vec, b1_vec);
+        ab12_vec = svdot_f32_f16(ab12_vec, a1_vec, b2_vec), ab13_vec = svdot_f32_f16(ab13_vec, a1_vec, b3_vec);
+        ab20_vec = svdot_f32_f16(ab20_vec, a2_vec, b0_vec), ab21_vec = svdot_f32_f16(ab21_vec, a2_vec, b1_vec);
+        ab22_vec = svdot_f32_f16(ab22_vec, a2_vec, b2_vec), ab23_vec = svdot_f32_f16(ab23_vec, a2_vec, b3_vec);
+        ab30_vec = svdot_f32_f16(ab30_vec, a3_vec, b0_vec), ab31_vec = svdot_f32_f16(ab31_vec, a3_vec, b1_vec);
+        ab32_vec = svdot_f32_f16(ab32_vec, a3_vec, b2_vec), ab33_vec = svdot_f32_f16(ab33_vec, a3_vec, b3_vec);
+    }
+    svbool_t all_vec = svptrue_b32();
+    block[0] += svaddv_f32(all_vec, ab00_vec), block[1] += svaddv_f32(all_vec, ab01_vec);
+    block[2] += svaddv_f32(all_vec, ab02_vec), block[3] += svaddv_f32(all_vec, ab03_vec);
+    block += block_stride;
+    block[0] += svaddv_f32(all_vec, ab10_vec), block[1] += svaddv_f32(all_vec, ab11_vec);
+    block[2] += svaddv_f32(all_vec, ab12_vec), block[3] += svaddv_f32(all_vec, ab13_vec);
+    block += block_stride;
+    block[0] += svaddv_f32(all_vec, ab20_vec), block[1] += svaddv_f32(all_vec, ab21_vec);
+    block[2] += svaddv_f32(all_vec, ab22_vec), block[3] += svaddv_f32(all_vec, ab23_vec);
+    block += block_stride;
+    block[0] += svaddv_f32(all_vec, ab30_vec), block[1] += svaddv_f32(all_vec, ab31_vec);
+    block[2] += svaddv_f32(all_vec, ab32_vec), block[3] += svaddv_f32(all_vec, ab33_vec);
+}
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_f16_sve2p1
+SIMSIMD_MAKE_CDIST(sve2p1, f16, _simsimd_cdist_pack_f16_f16_serial, _simsimd_cdist_tile_f16_sve2p1,
+                   simsimd_dot_f16_sve2p1, _simsimd_cdist_cast_serial, 8, f16)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SVE2P1
+#endif // _SIMSIMD_TARGET_ARM
+
+#if _SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_HASWELL
+#pragma GCC push_options
+#pragma GCC target("avx2", "f16c", "fma")
+#pragma clang attribute push(__attribute__((target("avx2,f16c,fma"))), apply_to = function)
+
+/**
+ *  @brief  Horizontally sums four vectors at once, returning the four sums in order.
+ */
+SIMSIMD_INTERNAL __m128 _simsimd_reduce_f32x8x4_haswell(__m256 a, __m256 b, __m256 c, __m256 d) {
+    // After the two horizontal additions, each 128-bit lane holds partial sums of `a`, `b`, `c`, `d`
+    __m256 abcd = _mm256_hadd_ps(_mm256_hadd_ps(a, b), _mm256_hadd_ps(c, d));
+    return _mm_add_ps(_mm256_castps256_ps128(abcd), _mm256_extractf128_ps(abcd, 1));
+}
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_f32_haswell(void const *a_punned, void const *b_punned, simsimd_size_t depth,
+                                                      simsimd_distance_t *block, simsimd_size_t block_stride) {
+    simsimd_f32_t const *b = (simsimd_f32_t const *)b_punned;
+    // With 16 registers, we process 2 rows of `a` at a time, keeping 8 accumulators and 2 rows of `a` in registers
+    for (int r = 0; r != 4; r += 2, block += 2 * block_stride) {
+        simsimd_f32_t const *a = (simsimd_f32_t const *)a_punned + r * depth;
+        __m256 ab00_vec = _mm256_setzero_ps(), ab01_vec = _mm256_setzero_ps();
+        __m256 ab02_vec = _mm256_setzero_ps(), ab03_vec = _mm256_setzero_ps();
+        __m256 ab10_vec = _mm256_setzero_ps(), ab11_vec = _mm256_setzero_ps();
+        __m256 ab12_vec = _mm256_setzero_ps(), ab13_vec = _mm256_setzero_ps();
+        for (simsimd_size_t k = 0; k != depth; k += 8) {
+            __m256 a0_vec = _mm256_loadu_ps(a + k), a1_vec = _mm256_loadu_ps(a + depth + k);
+            __m256 b_vec = _mm256_loadu_ps(b + k);
+            ab00_vec = _mm256_fmadd_ps(a0_vec, b_vec, ab00_vec), ab10_vec = _mm256_fmadd_ps(a1_vec, b_vec, ab10_vec);
+            b_vec = _mm256_loadu_ps(b + depth + k);
+            ab01_vec = _mm256_fmadd_ps(a0_vec, b_vec, ab01_vec), ab11_vec = _mm256_fmadd_ps(a1_vec, b_vec, ab11_vec);
+            b_vec = _mm256_loadu_ps(b + 2 * depth + k);
+            ab02_vec = _mm256_fmadd_ps(a0_vec, b_vec, ab02_vec), ab12_vec = _mm256_fmadd_ps(a1_vec, b_vec, ab12_vec);
+            b_vec = _mm256_loadu_ps(b + 3 * depth + k);
+            ab03_vec = _mm256_fmadd_ps(a0_vec, b_vec, ab03_vec), ab13_vec = _mm256_fmadd_ps(a1_vec, b_vec, ab13_vec);
+        }
+        __m128 ab0_vec = _simsimd_reduce_f32x8x4_haswell(ab00_vec, ab01_vec, ab02_vec, ab03_vec);
+        __m128 ab1_vec = _simsimd_reduce_f32x8x4_haswell(ab10_vec, ab11_vec, ab12_vec, ab13_vec);
+        _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtps_pd(ab0_vec)));
+        _mm256_storeu_pd(block + block_stride,
+                         _mm256_add_pd(_mm256_loadu_pd(block + block_stride), _mm256_cvtps_pd(ab1_vec)));
+    }
+}
+
+SIMSIMD_INTERNAL void _simsimd_cdist_pack_f16_f32_haswell(void const *rows, simsimd_size_t stride, simsimd_size_t count,
+                                                          simsimd_size_t count_padded, simsimd_size_t offset,
+                                                          simsimd_size_t depth, simsimd_size_t depth_padded,
+                                                          void *panel_punned) {
+    simsimd_f32_t *panel = (simsimd_f32_t *)panel_punned;
+    simsimd_size_t r = 0, k;
+    for (; r != count; ++r, panel += depth_padded) {
+        simsimd_f16_t const *row = SIMSIMD_ROW(simsimd_f16_t, rows, stride, r) + offset;
+        for (k = 0; k + 8 <= depth; k += 8)
+            _mm256_storeu_ps(panel + k, _mm256_cvtph_ps(_mm_lddqu_si128((__m128i const *)(row + k))));
+        for (; k != depth; ++k) panel[k] = simsimd_f16_to_f32(row + k);
+        for (; k != depth_padded; ++k) panel[k] = 0;
+    }
+    for (; r != count_padded; ++r, panel += depth_padded)
+        for (k = 0; k != depth_padded; k += 8) _mm256_storeu_ps(panel + k, _mm256_setzero_ps());
+}
+
+SIMSIMD_INTERNAL void _simsimd_cdist_pack_bf16_f32_haswell(void const *rows, simsimd_size_t stride,
+                                                           simsimd_size_t count, simsimd_size_t count_padded,
+                                                           simsimd_size_t offset, simsimd_size_t depth,
+                                                           simsimd_size_t depth_padded, void *panel_punned) {
+    simsimd_f32_t *panel = (simsimd_f32_t *)panel_punned;
+    simsimd_size_t r = 0, k;
+    for (; r != count; ++r, panel += depth_padded) {
+        simsimd_bf16_t const *row = SIMSIMD_ROW(simsimd_bf16_t, rows, stride, r) + offset;
+        for (k = 0; k + 8 <= depth; k += 8)
+            _mm256_storeu_ps(panel + k, _simsimd_bf16x8_to_f32x8_haswell(_mm_lddqu_si128((__m128i const *)(row + k))));
+        for (; k != depth; ++k) panel[k] = simsimd_bf16_to_f32(row + k);
+        for (; k != depth_padded; ++k) panel[k] = 0;
+    }
+    for (; r != count_padded; ++r, panel += depth_padded)
+        for (k = 0; k != depth_padded; k += 8) _mm256_storeu_ps(panel + k, _mm256_setzero_ps());
+}
+
+/**
+ *  @brief  Exports a row of distances, narrowing 4 `f64` scalars to `f32` at a time, and pairing those up
+ *          to write 8 `f16` or `bf16` scalars with every 128-bit store.
+ */
+SIMSIMD_INTERNAL void _simsimd_cdist_cast_haswell(simsimd_distance_t const *distances, simsimd_size_t count,
+                                                  simsimd_datatype_t type, void *results) {
+    simsimd_size_t i = 0;
+    switch (type) {
+    case simsimd_datatype_f32_k:
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_ps((simsimd_f32_t *)results + i, _mm256_cvtpd_ps(_mm256_loadu_pd(distances + i)));
+        _simsimd_cdist_cast_serial(distances + i, count - i, type, (simsimd_f32_t *)results + i);
+        break;
+    case simsimd_datatype_f16_k:
+        for (; i + 8 <= count; i += 8) {
+            __m256 f32_vec = _mm256_set_m128(_mm256_cvtpd_ps(_mm256_loadu_pd(distances + i + 4)),
+                                             _mm256_cvtpd_ps(_mm256_loadu_pd(distances + i)));
+            _mm_storeu_si128((__m128i *)((simsimd_f16_t *)results + i),
+                             _mm256_cvtps_ph(f32_vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        }
+        _simsimd_cdist_cast_serial(distances + i, count - i, type, (simsimd_f16_t *)results + i);
+        break;
+    case simsimd_datatype_bf16_k:
+        for (; i + 8 <= count; i += 8) {
+            // Round the same way as `simsimd_f32_to_bf16`, and pack the top halves of the words
+            __m256i lo_vec = _mm256_castsi128_si256(_mm_castps_si128(_mm256_cvtpd_ps(_mm256_loadu_pd(distances + i))));
+            __m128i hi_vec = _mm_castps_si128(_mm256_cvtpd_ps(_mm256_loadu_pd(distances + i + 4)));
+            __m256i bits_vec = _mm256_inserti128_si256(lo_vec, hi_vec, 1);
+            bits_vec = _mm256_srli_epi32(_mm256_add_epi32(bits_vec, _mm256_set1_epi32(0x8000)), 16);
+            _mm_storeu_si128((__m128i *)((simsimd_bf16_t *)results + i),
+                             _mm_packus_epi32(_mm256_castsi256_si128(bits_vec), _mm256_extracti128_si256(bits_vec, 1)));
+        }
+        _simsimd_cdist_cast_serial(distances + i, count - i, type, (simsimd_bf16_t *)results + i);
+        break;
+    default: _simsimd_cdist_cast_serial(distances, count, type, results); break;
+    }
+}
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_f32_haswell
+SIMSIMD_MAKE_CDIST(haswell, f32, _simsimd_cdist_pack_f32_f32_serial, _simsimd_cdist_tile_f32_haswell,
+                   simsimd_dot_f32_haswell, _simsimd_cdist_cast_haswell, 8, f32)
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_f16_haswell
+SIMSIMD_MAKE_CDIST(haswell, f16, _simsimd_cdist_pack_f16_f32_haswell, _simsimd_cdist_tile_f32_haswell,
+                   simsimd_dot_f32_haswell, _simsimd_cdist_cast_haswell, 8, f32)
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_bf16_haswell
+SIMSIMD_MAKE_CDIST(haswell, bf16, _simsimd_cdist_pack_bf16_f32_haswell, _simsimd_cdist_tile_f32_haswell,
+                   simsimd_dot_f32_haswell, _simsimd_cdist_cast_haswell, 8, f32)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_HASWELL
+
+#if SIMSIMD_TARGET_SKYLAKE
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "avx512bw", "bmi2")
+#pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512vl,avx512bw,bmi2"))), apply_to = function)
+
+/**
+ *  @brief  Horizontally sums four vectors at once, returning the four sums in order.
+ */
+SIMSIMD_INTERNAL __m128 _simsimd_reduce_f32x16x4_skylake(__m512 a, __m512 b, __m512 c, __m512 d) {
+    // Interleave and add pairs, so that every 128-bit lane holds partial sums of all four inputs
+    __m512 ab = _mm512_add_ps(_mm512_unpacklo_ps(a, b), _mm512_unpackhi_ps(a, b));
+    __m512 cd = _mm512_add_ps(_mm512_unpacklo_ps(c, d), _mm512_unpackhi_ps(c, d));
+    __m512d ab_f64 = _mm512_castps_pd(ab), cd_f64 = _mm512_castps_pd(cd);
+    __m512 abcd = _mm512_add_ps(_mm512_castpd_ps(_mm512_unpacklo_pd(ab_f64, cd_f64)),
+                                _mm512_castpd_ps(_mm512_unpackhi_pd(ab_f64, cd_f64)));
+    // Sum the four 128-bit lanes
+    __m256 abcd_f32x8 = _mm256_add_ps(_mm512_castps512_ps256(abcd),
+                                      _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(abcd), 1)));
+    return _mm_add_ps(_mm256_castps256_ps128(abcd_f32x8), _mm256_extractf128_ps(abcd_f32x8, 1));
+}
+
+/**
+ *  @brief  Horizontally sums four vectors of 32-bit integers at once, returning the four sums in order.
+ */
+SIMSIMD_INTERNAL __m128i _simsimd_reduce_i32x16x4_skylake(__m512i a, __m512i b, __m512i c, __m512i d) {
+    __m512i ab = _mm512_add_epi32(_mm512_unpacklo_epi32(a, b), _mm512_unpackhi_epi32(a, b));
+    __m512i cd = _mm512_add_epi32(_mm512_unpacklo_epi32(c, d), _mm512_unpackhi_epi32(c, d));
+    __m512i abcd = _mm512_add_epi32(_mm512_unpacklo_epi64(ab, cd), _mm512_unpackhi_epi64(ab, cd));
+    __m256i abcd_i32x8 = _mm256_add_epi32(_mm512_castsi512_si256(abcd), _mm512_extracti64x4_epi64(abcd, 1));
+    return _mm_add_epi32(_mm256_castsi256_si128(abcd_i32x8), _mm256_extracti128_si256(abcd_i32x8, 1));
+}
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_f32_skylake(void const *a_punned, void const *b_punned, simsimd_size_t depth,
+                                                      simsimd_distance_t *block, simsimd_size_t block_stride) {
+    simsimd_f32_t const *a = (simsimd_f32_t const *)a_punned;
+    simsimd_f32_t const *b = (simsimd_f32_t const *)b_punned;
+    // 16 accumulators and 8 loaded registers out of 32 available
+    __m512 ab00_vec = _mm512_setzero_ps(), ab01_vec = _mm512_setzero_ps();
+    __m512 ab02_vec = _mm512_setzero_ps(), ab03_vec = _mm512_setzero_ps();
+    __m512 ab10_vec = _mm512_setzero_ps(), ab11_vec = _mm512_setzero_ps();
+    __m512 ab12_vec = _mm512_setzero_ps(), ab13_vec = _mm512_setzero_ps();
+    __m512 ab20_vec = _mm512_setzero_ps(), ab21_vec = _mm512_setzero_ps();
+    __m512 ab22_vec = _mm512_setzero_ps(), ab23_vec = _mm512_setzero_ps();
+    __m512 ab30_vec = _mm512_setzero_ps(), ab31_vec = _mm512_setzero_ps();
+    __m512 ab32_vec = _mm512_setzero_ps(), ab33_vec = _mm512_setzero_ps();
+    for (simsimd_size_t k = 0; k != depth; k += 16) {
+        __m512 a0_vec = _mm512_loadu_ps(a + k), a1_vec = _mm512_loadu_ps(a + depth + k);
+        __m512 a2_vec = _mm512_loadu_ps(a + 2 * depth + k), a3_vec = _mm512_loadu_ps(a + 3 * depth + k);
+        __m512 b0_vec = _mm512_loadu_ps(b + k), b1_vec = _mm512_loadu_ps(b + depth + k);
+        __m512 b2_vec = _mm512_loadu_ps(b + 2 * depth + k), b3_vec = _mm512_loadu_ps(b + 3 * depth + k);
+        ab00_vec = _mm512_fmadd_ps(a0_vec, b0_vec, ab00_vec), ab01_vec = _mm512_fmadd_ps(a0_vec, b1_vec, ab01_vec);
+        ab02_vec = _mm512_fmadd_ps(a0_vec, b2_vec, ab02_vec), ab03_vec = _mm512_fmadd_ps(a0_vec, b3_vec, ab03_vec);
+        ab10_vec = _mm512_fmadd_ps(a1_vec, b0_vec, ab10_vec), ab11_vec = _mm512_fmadd_ps(a1_vec, b1_vec, ab11_vec);
+        ab12_vec = _mm512_fmadd_ps(a1_vec, b2_vec, ab12_vec), ab13_vec = _mm512_fmadd_ps(a1_vec, b3_vec, ab13_vec);
+        ab20_vec = _mm512_fmadd_ps(a2_vec, b0_vec, ab20_vec), ab21_vec = _mm512_fmadd_ps(a2_vec, b1_vec, ab21_vec);
+        ab22_vec = _mm512_fmadd_ps(a2_vec, b2_vec, ab22_vec), ab23_vec = _mm512_fmadd_ps(a2_vec, b3_vec, ab23_vec);
+        ab30_vec = _mm512_fmadd_ps(a3_vec, b0_vec, ab30_vec), ab31_vec = _mm512_fmadd_ps(a3_vec, b1_vec, ab31_vec);
+        ab32_vec = _mm512_fmadd_ps(a3_vec, b2_vec, ab32_vec), ab33_vec = _mm512_fmadd_ps(a3_vec, b3_vec, ab33_vec);
+    }
+    __m128 ab0_vec = _simsimd_reduce_f32x16x4_skylake(ab00_vec, ab01_vec, ab02_vec, ab03_vec);
+    __m128 ab1_vec = _simsimd_reduce_f32x16x4_skylake(ab10_vec, ab11_vec, ab12_vec, ab13_vec);
+    __m128 ab2_vec = _simsimd_reduce_f32x16x4_skylake(ab20_vec, ab21_vec, ab22_vec, ab23_vec);
+    __m128 ab3_vec = _simsimd_reduce_f32x16x4_skylake(ab30_vec, ab31_vec, ab32_vec, ab33_vec);
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtps_pd(ab0_vec)));
+    block += block_stride;
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtps_pd(ab1_vec)));
+    block += block_stride;
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtps_pd(ab2_vec)));
+    block += block_stride;
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtps_pd(ab3_vec)));
+}
+
+SIMSIMD_INTERNAL void _simsimd_cdist_pack_f32_f32_skylake(void const *rows, simsimd_size_t stride, simsimd_size_t count,
+                                                          simsimd_size_t count_padded, simsimd_size_t offset,
+                                                          simsimd_size_t depth, simsimd_size_t depth_padded,
+                                                          void *panel_punned) {
+    simsimd_f32_t *panel = (simsimd_f32_t *)panel_punned;
+    simsimd_size_t r = 0, k;
+    for (; r != count; ++r, panel += depth_padded) {
+        simsimd_f32_t const *row = SIMSIMD_ROW(simsimd_f32_t, rows, stride, r) + offset;
+        for (k = 0; k != depth_padded; k += 16) {
+            simsimd_size_t const left = k < depth ? depth - k : 0;
+            __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFF, left < 16 ? left : 16);
+            _mm512_storeu_ps(panel + k, _mm512_maskz_loadu_ps(mask, row + k));
+        }
+    }
+    for (; r != count_padded; ++r, panel += depth_padded)
+        for (k = 0; k != depth_padded; k += 16) _mm512_storeu_ps(panel + k, _mm512_setzero_ps());
+}
+
+SIMSIMD_INTERNAL void _simsimd_cdist_pack_f16_f32_skylake(void const *rows, simsimd_size_t stride, simsimd_size_t count,
+                                                          simsimd_size_t count_padded, simsimd_size_t offset,
+                                                          simsimd_size_t depth, simsimd_size_t depth_padded,
+                                                          void *panel_punned) {
+    simsimd_f32_t *panel = (simsimd_f32_t *)panel_punned;
+    simsimd_size_t r = 0, k;
+    for (; r != count; ++r, panel += depth_padded) {
+        simsimd_f16_t const *row = SIMSIMD_ROW(simsimd_f16_t, rows, stride, r) + offset;
+        for (k = 0; k != depth_padded; k += 16) {
+            simsimd_size_t const left = k < depth ? depth - k : 0;
+            __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFF, left < 16 ? left : 16);
+            _mm512_storeu_ps(panel + k, _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, row + k)));
+        }
+    }
+    for (; r != count_padded; ++r, panel += depth_padded)
+        for (k = 0; k != depth_padded; k += 16) _mm512_storeu_ps(panel + k, _mm512_setzero_ps());
+}
+
+SIMSIMD_INTERNAL void _simsimd_cdist_pack_bf16_f32_skylake(void const *rows, simsimd_size_t stride,
+                                                           simsimd_size_t count, simsimd_size_t count_padded,
+                                                           simsimd_size_t offset, simsimd_size_t depth,
+                                                           simsimd_size_t depth_padded, void *panel_punned) {
+    simsimd_f32_t *panel = (simsimd_f32_t *)panel_punned;
+    simsimd_size_t r = 0, k;
+    for (; r != count; ++r, panel += depth_padded) {
+        simsimd_bf16_t const *row = SIMSIMD_ROW(simsimd_bf16_t, rows, stride, r) + offset;
+        for (k = 0; k != depth_padded; k += 16) {
+            simsimd_size_t const left = k < depth ? depth - k : 0;
+            __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFF, left < 16 ? left : 16);
+            _mm512_storeu_ps(panel + k, _simsimd_bf16x16_to_f32x16_skylake(_mm256_maskz_loadu_epi16(mask, row + k)));
+        }
+    }
+    for (; r != count_padded; ++r, panel += depth_padded)
+        for (k = 0; k != depth_padded; k += 16) _mm512_storeu_ps(panel + k, _mm512_setzero_ps());
+}
+
+/**
+ *  @brief  Exports a row of distances 16 at a time, narrowing `f64` to `f32` and then to `f16` or `bf16`,
+ *          handling the tails with masked loads and stores.
+ */
+SIMSIMD_INTERNAL void _simsimd_cdist_cast_skylake(simsimd_distance_t const *distances, simsimd_size_t count,
+                                                  simsimd_datatype_t type, void *results) {
+    if (type != simsimd_datatype_f32_k && type != simsimd_datatype_f16_k && type != simsimd_datatype_bf16_k) {
+        _simsimd_cdist_cast_serial(distances, count, type, results);
+        return;
+    }
+    for (simsimd_size_t i = 0; i < count; i += 16) {
+        simsimd_size_t const tail = count - i < 16 ? count - i : 16;
+        __mmask16 const mask = (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)tail);
+        __m256 lo_vec = _mm512_cvtpd_ps(_mm512_maskz_loadu_pd((__mmask8)mask, distances + i));
+        __m256 hi_vec = _mm512_cvtpd_ps(_mm512_maskz_loadu_pd((__mmask8)(mask >> 8), distances + i + 8));
+        if (type == simsimd_datatype_f32_k) {
+            _mm256_mask_storeu_ps((simsimd_f32_t *)results + i, (__mmask8)mask, lo_vec);
+            _mm256_mask_storeu_ps((simsimd_f32_t *)results + i + 8, (__mmask8)(mask >> 8), hi_vec);
+            continue;
+        }
+        __m512 f32_vec = _mm512_castpd_ps(
+            _mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(lo_vec)), _mm256_castps_pd(hi_vec), 1));
+        __m256i narrow_vec;
+        if (type == simsimd_datatype_f16_k)
+            narrow_vec = _mm512_cvtps_ph(f32_vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        else // Round the same way as `simsimd_f32_to_bf16`, and keep the top halves of the words
+            narrow_vec = _mm512_cvtepi32_epi16(
+                _mm512_srli_epi32(_mm512_add_epi32(_mm512_castps_si512(f32_vec), _mm512_set1_epi32(0x8000)), 16));
+        _mm256_mask_storeu_epi16((simsimd_u16_t *)results + i, mask, narrow_vec);
+    }
+}
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_f32_skylake
+SIMSIMD_MAKE_CDIST(skylake, f32, _simsimd_cdist_pack_f32_f32_skylake, _simsimd_cdist_tile_f32_skylake,
+                   simsimd_dot_f32_skylake, _simsimd_cdist_cast_skylake, 16, f32)
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_f16_skylake
+SIMSIMD_MAKE_CDIST(skylake, f16, _simsimd_cdist_pack_f16_f32_skylake, _simsimd_cdist_tile_f32_skylake,
+                   simsimd_dot_f32_skylake, _simsimd_cdist_cast_skylake, 16, f32)
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_bf16_skylake
+SIMSIMD_MAKE_CDIST(skylake, bf16, _simsimd_cdist_pack_bf16_f32_skylake, _simsimd_cdist_tile_f32_skylake,
+                   simsimd_dot_f32_skylake, _simsimd_cdist_cast_skylake, 16, f32)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SKYLAKE
+
+/*  The Genoa and Ice Lake kernels reuse the AVX-512 export of the Skylake kernels, when those are compiled.
+ */
+#if SIMSIMD_TARGET_SKYLAKE
+#define _SIMSIMD_CDIST_CAST_AVX512 _simsimd_cdist_cast_skylake
+#else
+#define _SIMSIMD_CDIST_CAST_AVX512 _simsimd_cdist_cast_serial
+#endif
+
+#if SIMSIMD_TARGET_GENOA
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "bmi2", "avx512bw", "avx512bf16")
+#pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512vl,bmi2,avx512bw,avx512bf16"))), \
+                             apply_to = function)
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_bf16_genoa(void const *a_punned, void const *b_punned, simsimd_size_t depth,
+                                                     simsimd_distance_t *block, simsimd_size_t block_stride) {
+    simsimd_bf16_t const *a = (simsimd_bf16_t const *)a_punned;
+    simsimd_bf16_t const *b = (simsimd_bf16_t const *)b_punned;
+    __m512 ab00_vec = _mm512_setzero_ps(), ab01_vec = _mm512_setzero_ps();
+    __m512 ab02_vec = _mm512_setzero_ps(), ab03_vec = _mm512_setzero_ps();
+    __m512 ab10_vec = _mm512_setzero_ps(), ab11_vec = _mm512_setzero_ps();
+    __m512 ab12_vec = _mm512_setzero_ps(), ab13_vec = _mm512_setzero_ps();
+    __m512 ab20_vec = _mm512_setzero_ps(), ab21_vec = _mm512_setzero_ps();
+    __m512 ab22_vec = _mm512_setzero_ps(), ab23_vec = _mm512_setzero_ps();
+    __m512 ab30_vec = _mm512_setzero_ps(), ab31_vec = _mm512_setzero_ps();
+    __m512 ab32_vec = _mm512_setzero_ps(), ab33_vec = _mm512_setzero_ps();
+    for (simsimd_size_t k = 0; k != depth; k += 32) {
+        __m512bh a0_vec = (__m512bh)_mm512_loadu_epi16(a + k), a1_vec = (__m512bh)_mm512_loadu_epi16(a + depth + k);
+        __m512bh a2_vec = (__m512bh)_mm512_loadu_epi16(a + 2 * depth + k);
+        __m512bh a3_vec = (__m512bh)_mm512_loadu_epi16(a + 3 * depth + k);
+        __m512bh b0_vec = (__m512bh)_mm512_loadu_epi16(b + k), b1_vec = (__m512bh)_mm512_loadu_epi16(b + depth + k);
+        __m512bh b2_vec = (__m512bh)_mm512_loadu_epi16(b + 2 * depth + k);
+        __m512bh b3_vec = (__m512bh)_mm512_loadu_epi16(b + 3 * depth + k);
+        ab00_vec = _mm512_dpbf16_ps(ab00_vec, a0_vec, b0_vec), ab01_vec = _mm512_dpbf16_ps(ab01_vec, a0_vec, b1_vec);
+        ab02_vec = _mm512_dpbf16_ps(ab02_vec, a0_vec, b2_vec), ab03_vec = _mm512_dpbf16_ps(ab03_vec, a0_vec, b3_vec);
+        ab10_vec = _mm512_dpbf16_ps(ab10_vec, a1_vec, b0_vec), ab11_vec = _mm512_dpbf16_ps(ab11_vec, a1_vec, b1_vec);
+        ab12_vec = _mm512_dpbf16_ps(ab12_vec, a1_vec, b2_vec), ab13_vec = _mm512_dpbf16_ps(ab13_vec, a1_vec, b3_vec);
+        ab20_vec = _mm512_dpbf16_ps(ab20_vec, a2_vec, b0_vec), ab21_vec = _mm512_dpbf16_ps(ab21_vec, a2_vec, b1_vec);
+        ab22_vec = _mm512_dpbf16_ps(ab22_vec, a2_vec, b2_vec), ab23_vec = _mm512_dpbf16_ps(ab23_vec, a2_vec, b3_vec);
+        ab30_vec = _mm512_dpbf16_ps(ab30_vec, a3_vec, b0_vec), ab31_vec = _mm512_dpbf16_ps(ab31_vec, a3_vec, b1_vec);
+        ab32_vec = _mm512_dpbf16_ps(ab32_vec, a3_vec, b2_vec), ab33_vec = _mm512_dpbf16_ps(ab33_vec, a3_vec, b3_vec);
+    }
+    __m128 ab0_vec = _simsimd_reduce_f32x16x4_skylake(ab00_vec, ab01_vec, ab02_vec, ab03_vec);
+    __m128 ab1_vec = _simsimd_reduce_f32x16x4_skylake(ab10_vec, ab11_vec, ab12_vec, ab13_vec);
+    __m128 ab2_vec = _simsimd_reduce_f32x16x4_skylake(ab20_vec, ab21_vec, ab22_vec, ab23_vec);
+    __m128 ab3_vec = _simsimd_reduce_f32x16x4_skylake(ab30_vec, ab31_vec, ab32_vec, ab33_vec);
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtps_pd(ab0_vec)));
+    block += block_stride;
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtps_pd(ab1_vec)));
+    block += block_stride;
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtps_pd(ab2_vec)));
+    block += block_stride;
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtps_pd(ab3_vec)));
+}
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_bf16_genoa
+SIMSIMD_MAKE_CDIST(genoa, bf16, _simsimd_cdist_pack_bf16_bf16_serial, _simsimd_cdist_tile_bf16_genoa,
+                   simsimd_dot_bf16_genoa, _SIMSIMD_CDIST_CAST_AVX512, 32, bf16)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_GENOA
+
+#if SIMSIMD_TARGET_ICE
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "bmi2", "avx512bw", "avx512vnni")
+#pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512vl,bmi2,avx512bw,avx512vnni"))), \
+                             apply_to = function)
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_i8_ice(void const *a_punned, void const *b_punned, simsimd_size_t depth,
+                                                 simsimd_distance_t *block, simsimd_size_t block_stride) {
+    simsimd_i8_t const *a = (simsimd_i8_t const *)a_punned;
+    simsimd_i8_t const *b = (simsimd_i8_t const *)b_punned;
+    // The `vpdpbusd` instruction multiplies unsigned bytes by signed bytes. Flipping the sign bit of `a`
+    // maps it into `a + 128`, so we later subtract `128 * sum(b)`, accumulating the sums with the same instruction.
+    __m512i const bias_vec = _mm512_set1_epi8((char)0x80);
+    __m512i const ones_vec = _mm512_set1_epi8(1);
+    __m512i ab00_vec = _mm512_setzero_si512(), ab01_vec = _mm512_setzero_si512();
+    __m512i ab02_vec = _mm512_setzero_si512(), ab03_vec = _mm512_setzero_si512();
+    __m512i ab10_vec = _mm512_setzero_si512(), ab11_vec = _mm512_setzero_si512();
+    __m512i ab12_vec = _mm512_setzero_si512(), ab13_vec = _mm512_setzero_si512();
+    __m512i ab20_vec = _mm512_setzero_si512(), ab21_vec = _mm512_setzero_si512();
+    __m512i ab22_vec = _mm512_setzero_si512(), ab23_vec = _mm512_setzero_si512();
+    __m512i ab30_vec = _mm512_setzero_si512(), ab31_vec = _mm512_setzero_si512();
+    __m512i ab32_vec = _mm512_setzero_si512(), ab33_vec = _mm512_setzero_si512();
+    __m512i b0_sum_vec = _mm512_setzero_si512(), b1_sum_vec = _mm512_setzero_si512();
+    __m512i b2_sum_vec = _mm512_setzero_si512(), b3_sum_vec = _mm512_setzero_si512();
+    for (simsimd_size_t k = 0; k != depth; k += 64) {
+        __m512i a0_vec = _mm512_xor_si512(_mm512_loadu_si512(a + k), bias_vec);
+        __m512i a1_vec = _mm512_xor_si512(_mm512_loadu_si512(a + depth + k), bias_vec);
+        __m512i a2_vec = _mm512_xor_si512(_mm512_loadu_si512(a + 2 * depth + k), bias_vec);
+        __m512i a3_vec = _mm512_xor_si512(_mm512_loadu_si512(a + 3 * depth + k), bias_vec);
+        __m512i b0_vec = _mm512_loadu_si512(b + k), b1_vec = _mm512_loadu_si512(b + depth + k);
+        __m512i b2_vec = _mm512_loadu_si512(b + 2 * depth + k), b3_vec = _mm512_loadu_si512(b + 3 * depth + k);
+        ab00_vec = _mm512_dpbusd_epi32(ab00_vec, a0_vec, b0_vec);
+        ab01_vec = _mm512_dpbusd_epi32(ab01_vec, a0_vec, b1_vec);
+        ab02_vec = _mm512_dpbusd_epi32(ab02_vec, a0_vec, b2_vec);
+        ab03_vec = _mm512_dpbusd_epi32(ab03_vec, a0_vec, b3_vec);
+        ab10_vec = _mm512_dpbusd_epi32(ab10_vec, a1_vec, b0_vec);
+        ab11_vec = _mm512_dpbusd_epi32(ab11_vec, a1_vec, b1_vec);
+        ab12_vec = _mm512_dpbusd_epi32(ab12_vec, a1_vec, b2_vec);
+        ab13_vec = _mm512_dpbusd_epi32(ab13_vec, a1_vec, b3_vec);
+        ab20_vec = _mm512_dpbusd_epi32(ab20_vec, a2_vec, b0_vec);
+        ab21_vec = _mm512_dpbusd_epi32(ab21_vec, a2_vec, b1_vec);
+        ab22_vec = _mm512_dpbusd_epi32(ab22_vec, a2_vec, b2_vec);
+        ab23_vec = _mm512_dpbusd_epi32(ab23_vec, a2_vec, b3_vec);
+        ab30_vec = _mm512_dpbusd_epi32(ab30_vec, a3_vec, b0_vec);
+        ab31_vec = _mm512_dpbusd_epi32(ab31_vec, a3_vec, b1_vec);
+        ab32_vec = _mm512_dpbusd_epi32(ab32_vec, a3_vec, b2_vec);
+        ab33_vec = _mm512_dpbusd_epi32(ab33_vec, a3_vec, b3_vec);
+        b0_sum_vec = _mm512_dpbusd_epi32(b0_sum_vec, ones_vec, b0_vec);
+        b1_sum_vec = _mm512_dpbusd_epi32(b1_sum_vec, ones_vec, b1_vec);
+        b2_sum_vec = _mm512_dpbusd_epi32(b2_sum_vec, ones_vec, b2_vec);
+        b3_sum_vec = _mm512_dpbusd_epi32(b3_sum_vec, ones_vec, b3_vec);
+    }
+    __m128i correction_vec =
+        _mm_slli_epi32(_simsimd_reduce_i32x16x4_skylake(b0_sum_vec, b1_sum_vec, b2_sum_vec, b3_sum_vec), 7);
+    __m128i ab0_vec = _simsimd_reduce_i32x16x4_skylake(ab00_vec, ab01_vec, ab02_vec, ab03_vec);
+    __m128i ab1_vec = _simsimd_reduce_i32x16x4_skylake(ab10_vec, ab11_vec, ab12_vec, ab13_vec);
+    __m128i ab2_vec = _simsimd_reduce_i32x16x4_skylake(ab20_vec, ab21_vec, ab22_vec, ab23_vec);
+    __m128i ab3_vec = _simsimd_reduce_i32x16x4_skylake(ab30_vec, ab31_vec, ab32_vec, ab33_vec);
+    ab0_vec = _mm_sub_epi32(ab0_vec, correction_vec), ab1_vec = _mm_sub_epi32(ab1_vec, correction_vec);
+    ab2_vec = _mm_sub_epi32(ab2_vec, correction_vec), ab3_vec = _mm_sub_epi32(ab3_vec, correction_vec);
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtepi32_pd(ab0_vec)));
+    block += block_stride;
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtepi32_pd(ab1_vec)));
+    block += block_stride;
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtepi32_pd(ab2_vec)));
+    block += block_stride;
+    _mm256_storeu_pd(block, _mm256_add_pd(_mm256_loadu_pd(block), _mm256_cvtepi32_pd(ab3_vec)));
+}
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_i8_ice
+SIMSIMD_MAKE_CDIST(ice, i8, _simsimd_cdist_pack_i8_i8_serial, _simsimd_cdist_tile_i8_ice, simsimd_dot_i8_ice,
+                   _SIMSIMD_CDIST_CAST_AVX512, 64, i8)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_ICE
+
+#if SIMSIMD_TARGET_SAPPHIRE_AMX
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "bmi2", "avx512bw", "avx512bf16", "avx512vnni", "amx-tile", \
+                   "amx-bf16", "amx-int8")
+#pragma clang attribute push(                                                                                        \
+    __attribute__((target("avx2,avx512f,avx512vl,bmi2,avx512bw,avx512bf16,avx512vnni,amx-tile,amx-bf16,amx-int8"))), \
+    apply_to = function)
+
+#if SIMSIMD_CDIST_MC % 32 || SIMSIMD_CDIST_NC % 32
+#error "The AMX kernels multiply 32x32 tiles, so `SIMSIMD_CDIST_MC` and `SIMSIMD_CDIST_NC` must be multiples of 32"
+#endif
+
+/*  Every AMX micro-kernel call multiplies 32 packed rows of `a` by 32 packed rows of `b`, using all 8 tile registers
+ *  configured as 16 rows of 64 bytes: 4 accumulators for the 2x2 output tiles, 2 tiles of `a`, and 2 tiles of `b`.
+ *  The `tdpbf16ps` and `tdpbssd` instructions expect the right-hand side in a "VNNI" layout, where every row of the
+ *  tile holds the same 32-bit word, a pair of `bf16` or a quad of `i8` scalars, from 16 different rows of `b`.
+ *  So the `b` panel is transposed as a matrix of 32-bit words, 16 rows by 16 words at a time, once per panel.
+ *  The micro-kernels expect the tiles to be configured by the caller, which releases them after the last call.
+ *  On Linux, the tiles can only be used after `simsimd_capabilities` has requested them from the kernel.
+ */
+SIMSIMD_INTERNAL void _simsimd_tile_configure_sapphire_amx(void) {
+    // GCC declares only the first 8 bytes of the configuration as the input of `ldtilecfg`,
+    // so the buffer is `volatile` to keep the compiler from dropping the other stores
+    simsimd_u8_t volatile config[64] = {0};
+    config[0] = 1; // Palette 1 is the only one defined so far
+    // The 16-bit row widths in bytes start at offset 16, and the 8-bit row counts at offset 48
+    for (int t = 0; t != 8; ++t) config[16 + t * 2] = 64, config[48 + t] = 16;
+    _tile_loadconfig((void const *)config);
+}
+
+SIMSIMD_INTERNAL void _simsimd_cdist_interleave_sapphire_amx(void const *rows_punned, simsimd_size_t row_bytes,
+                                                             void *interleaved_punned) {
+    simsimd_u8_t const *rows = (simsimd_u8_t const *)rows_punned;
+    simsimd_u8_t *interleaved = (simsimd_u8_t *)interleaved_punned;
+    __m512i r[16], t[16];
+    for (simsimd_size_t g = 0; g != 32; g += 16) {
+        for (simsimd_size_t k = 0; k != row_bytes; k += 64) {
+            for (int i = 0; i != 16; ++i) r[i] = _mm512_loadu_si512(rows + (g + i) * row_bytes + k);
+            // Interleave the words and then the double-words of the neighboring rows within every 128-bit lane,
+            // so that the lane `l` of `r[4 * q + j]` holds the word `4 * l + j` of the rows `4 * q` to `4 * q + 3`.
+            for (int i = 0; i != 16; i += 2)
+                t[i] = _mm512_unpacklo_epi32(r[i], r[i + 1]), t[i + 1] = _mm512_unpackhi_epi32(r[i], r[i + 1]);
+            for (int i = 0; i != 16; i += 4) {
+                r[i + 0] = _mm512_unpacklo_epi64(t[i + 0], t[i + 2]);
+                r[i + 1] = _mm512_unpackhi_epi64(t[i + 0], t[i + 2]);
+                r[i + 2] = _mm512_unpacklo_epi64(t[i + 1], t[i + 3]);
+                r[i + 3] = _mm512_unpackhi_epi64(t[i + 1], t[i + 3]);
+            }
+            // Gather the matching 128-bit lanes of the 4 groups of rows in two more steps
+            for (int j = 0; j != 4; ++j) {
+                t[j + 0] = _mm512_shuffle_i32x4(r[j + 0], r[j + 4], 0x88);
+                t[j + 4] = _mm512_shuffle_i32x4(r[j + 0], r[j + 4], 0xDD);
+                t[j + 8] = _mm512_shuffle_i32x4(r[j + 8], r[j + 12], 0x88);
+                t[j + 12] = _mm512_shuffle_i32x4(r[j + 8], r[j + 12], 0xDD);
+            }
+            simsimd_u8_t *tile = interleaved + g * row_bytes + k * 16;
+            for (int j = 0; j != 4; ++j) {
+                _mm512_storeu_si512(tile + (j + 0) * 64, _mm512_shuffle_i32x4(t[j + 0], t[j + 8], 0x88));
+                _mm512_storeu_si512(tile + (j + 4) * 64, _mm512_shuffle_i32x4(t[j + 4], t[j + 12], 0x88));
+                _mm512_storeu_si512(tile + (j + 8) * 64, _mm512_shuffle_i32x4(t[j + 0], t[j + 8], 0xDD));
+                _mm512_storeu_si512(tile + (j + 12) * 64, _mm512_shuffle_i32x4(t[j + 4], t[j + 12], 0xDD));
+            }
+        }
+    }
+}
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_bf16_sapphire_amx(void const *a_punned, void const *b_punned,
+                                                            simsimd_size_t depth, simsimd_distance_t *block,
+                                                            simsimd_size_t block_stride) {
+    simsimd_u8_t const *a = (simsimd_u8_t const *)a_punned, *b = (simsimd_u8_t const *)b_punned;
+    simsimd_size_t const row_bytes = depth * sizeof(simsimd_bf16_t);
+    simsimd_f32_t ab[32][32];
+    _tile_zero(0);
+    _tile_zero(1);
+    _tile_zero(2);
+    _tile_zero(3);
+    for (simsimd_size_t k = 0; k != row_bytes; k += 64) {
+        _tile_loadd(4, a + k, row_bytes);
+        _tile_loadd(5, a + 16 * row_bytes + k, row_bytes);
+        _tile_loadd(6, b + k * 16, 64);
+        _tile_loadd(7, b + 16 * row_bytes + k * 16, 64);
+        _tile_dpbf16ps(0, 4, 6);
+        _tile_dpbf16ps(1, 4, 7);
+        _tile_dpbf16ps(2, 5, 6);
+        _tile_dpbf16ps(3, 5, 7);
+    }
+    _tile_stored(0, &ab[0][0], 128);
+    _tile_stored(1, &ab[0][16], 128);
+    _tile_stored(2, &ab[16][0], 128);
+    _tile_stored(3, &ab[16][16], 128);
+
+    for (int r = 0; r != 32; ++r, block += block_stride)
+        for (int c = 0; c != 32; c += 8)
+            _mm512_storeu_pd(block + c,
+                             _mm512_add_pd(_mm512_loadu_pd(block + c), _mm512_cvtps_pd(_mm256_loadu_ps(ab[r] + c))));
+}
+
+SIMSIMD_INTERNAL void _simsimd_cdist_tile_i8_sapphire_amx(void const *a_punned, void const *b_punned,
+                                                          simsimd_size_t depth, simsimd_distance_t *block,
+                                                          simsimd_size_t block_stride) {
+    simsimd_u8_t const *a = (simsimd_u8_t const *)a_punned, *b = (simsimd_u8_t const *)b_punned;
+    simsimd_size_t const row_bytes = depth * sizeof(simsimd_i8_t);
+    simsimd_i32_t ab[32][32];
+    _tile_zero(0);
+    _tile_zero(1);
+    _tile_zero(2);
+    _tile_zero(3);
+    for (simsimd_size_t k = 0; k != row_bytes; k += 64) {
+        _tile_loadd(4, a + k, row_bytes);
+        _tile_loadd(5, a + 16 * row_bytes + k, row_bytes);
+        _tile_loadd(6, b + k * 16, 64);
+        _tile_loadd(7, b + 16 * row_bytes + k * 16, 64);
+        _tile_dpbssd(0, 4, 6);
+        _tile_dpbssd(1, 4, 7);
+        _tile_dpbssd(2, 5, 6);
+        _tile_dpbssd(3, 5, 7);
+    }
+    _tile_stored(0, &ab[0][0], 128);
+    _tile_stored(1, &ab[0][16], 128);
+    _tile_stored(2, &ab[16][0], 128);
+    _tile_stored(3, &ab[16][16], 128);
+
+    for (int r = 0; r != 32; ++r, block += block_stride)
+        for (int c = 0; c != 32; c += 8)
+            _mm512_storeu_pd(block + c, _mm512_add_pd(_mm512_loadu_pd(block + c),
+                                                      _mm512_cvtepi32_pd(_mm256_loadu_si256((__m256i *)(ab[r] + c)))));
+}
+
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_bf16_sapphire_amx
+SIMSIMD_MAKE_CDIST_AMX(sapphire_amx, bf16, genoa, _simsimd_cdist_pack_bf16_bf16_serial,
+                       _simsimd_cdist_tile_bf16_sapphire_amx, _simsimd_cdist_interleave_sapphire_amx,
+                       simsimd_dot_bf16_genoa, _SIMSIMD_CDIST_CAST_AVX512, 32)
+// simsimd_{dot,cos,l2sq,l2}_cdist{,_typed}_i8_sapphire_amx
+SIMSIMD_MAKE_CDIST_AMX(sapphire_amx, i8, ice, _simsimd_cdist_pack_i8_i8_serial, _simsimd_cdist_tile_i8_sapphire_amx,
+                       _simsimd_cdist_interleave_sapphire_amx, simsimd_dot_i8_ice, _SIMSIMD_CDIST_CAST_AVX512, 64)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SAPPHIRE_AMX
+#endif // _SIMSIMD_TARGET_X86
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -7,6 +7,7 @@
  *  Contains:
  *  - Bilinear form multiplication
  *  - Mahalanobis distance
+ *  - Batched projections by a factorized metric tensor, and bilinear form matrices
  *
  *  For datatypes:
  *  - 32-bit floating point numbers
@@ -28,6 +29,14 @@
 #include "dot.h"     // `_simsimd_partial_load_f16x4_neon` and friends
 #include "spatial.h" // `_simsimd_substract_bf16x32_genoa`
 
+/**
+ *  @brief  Number of columns of the metric tensor, by which every 4 rows of `a` are projected at once
+ *          in the `simsimd_bilinear_cdist_*` kernels. The default results in a 4 KB buffer on the stack.
+ */
+#if !defined(SIMSIMD_CURVED_KC)
+#define SIMSIMD_CURVED_KC 256
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -90,6 +99,22 @@ SIMSIMD_PUBLIC void simsimd_bilinear_bf16_genoa(simsimd_bf16_t const* a, simsimd
 SIMSIMD_PUBLIC void simsimd_mahalanobis_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_bf16_t const* c, simsimd_size_t n, simsimd_distance_t* result);
 SIMSIMD_PUBLIC void simsimd_bilinear_f16_sapphire(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_f16_t const* c, simsimd_size_t n, simsimd_distance_t* result);
 SIMSIMD_PUBLIC void simsimd_mahalanobis_f16_sapphire(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_f16_t const* c, simsimd_size_t n, simsimd_distance_t* result);
+
+/*  Batched backends, streaming the `n` by `n` metric tensor once for many vectors instead of once for every pair.
+ *  Given a factor `l` of the metric tensor `c = l * l^T`, like its Cholesky decomposition, the Mahalanobis distance
+ *  between `a` and `b` is the Euclidean distance between `l^T * a` and `l^T * b`. So `simsimd_whiten_f32_*` projects
+ *  a collection once, and the results can be compared with any `l2` batch, distance matrix, or top-k routine.
+ *  A whitening transform `w` with `c = w^T * w` is passed as `l = w^T`, or as is, if symmetric.
+ *  The `simsimd_bilinear_cdist_f32_*` kernels compute `a_i^T * c * b_j` for all pairs of rows, projecting 4 rows
+ *  of `a` by `SIMSIMD_CURVED_KC` columns of `c` at a time, and reusing the projection for every row of `b`.
+ */
+SIMSIMD_PUBLIC int simsimd_cholesky_f32_serial(simsimd_f32_t const* c, simsimd_size_t n, simsimd_f32_t* l);
+SIMSIMD_PUBLIC void simsimd_whiten_f32_serial(simsimd_f32_t const* vectors, simsimd_size_t count, simsimd_size_t stride, simsimd_f32_t const* l, simsimd_size_t n, simsimd_f32_t* whitened, simsimd_size_t whitened_stride);
+SIMSIMD_PUBLIC void simsimd_bilinear_cdist_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_f32_t const* c, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_whiten_f32_neon(simsimd_f32_t const* vectors, simsimd_size_t count, simsimd_size_t stride, simsimd_f32_t const* l, simsimd_size_t n, simsimd_f32_t* whitened, simsimd_size_t whitened_stride);
+SIMSIMD_PUBLIC void simsimd_bilinear_cdist_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_f32_t const* c, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
+SIMSIMD_PUBLIC void simsimd_whiten_f32_skylake(simsimd_f32_t const* vectors, simsimd_size_t count, simsimd_size_t stride, simsimd_f32_t const* l, simsimd_size_t n, simsimd_f32_t* whitened, simsimd_size_t whitened_stride);
+SIMSIMD_PUBLIC void simsimd_bilinear_cdist_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_f32_t const* c, simsimd_size_t n, simsimd_distance_t* results, simsimd_size_t results_stride);
 // clang-format on
 
 #define SIMSIMD_MAKE_BILINEAR(name, input_type, accumulator_type, load_and_convert)                              \
@@ -149,6 +174,99 @@ SIMSIMD_MAKE_MAHALANOBIS(accurate, f16, f64, SIMSIMD_F16_TO_F32) // simsimd_maha
 SIMSIMD_MAKE_BILINEAR(accurate, bf16, f64, SIMSIMD_BF16_TO_F32)    // simsimd_bilinear_bf16_accurate
 SIMSIMD_MAKE_MAHALANOBIS(accurate, bf16, f64, SIMSIMD_BF16_TO_F32) // simsimd_mahalanobis_bf16_accurate
 
+/**
+ *  @brief  Factorizes a symmetric positive-definite metric tensor into a lower-triangular `l`, so that
+ *          `c = l * l^T`, accumulating in double precision. Meant to be called once per metric tensor.
+ *  @return 1 on success, 0 if `c` is not positive-definite.
+ */
+SIMSIMD_PUBLIC int simsimd_cholesky_f32_serial(simsimd_f32_t const *c, simsimd_size_t n, simsimd_f32_t *l) {
+    for (simsimd_size_t i = 0; i != n; ++i) {
+        for (simsimd_size_t j = 0; j <= i; ++j) {
+            simsimd_f64_t sum = c[i * n + j];
+            for (simsimd_size_t k = 0; k != j; ++k) sum -= (simsimd_f64_t)l[i * n + k] * l[j * n + k];
+            if (i != j) { l[i * n + j] = (simsimd_f32_t)(sum / l[j * n + j]); }
+            else if (sum > 0) { l[i * n + i] = (simsimd_f32_t)SIMSIMD_SQRT(sum); }
+            else { return 0; }
+        }
+        for (simsimd_size_t j = i + 1; j != n; ++j) l[i * n + j] = 0;
+    }
+    return 1;
+}
+
+/**
+ *  @brief  Projects 4 rows by `columns_count` columns of the `n` by `n` matrix `l`, starting at `columns_begin`:
+ *          `outputs[r][j] = sum(rows[r][i] * l[i][columns_begin + j])`. The rows may repeat, as the outputs
+ *          are accumulated in registers and only stored at the end.
+ */
+SIMSIMD_INTERNAL void _simsimd_project_f32x4_serial(simsimd_f32_t const *rows[4], simsimd_f32_t const *l,
+                                                    simsimd_size_t n, simsimd_size_t columns_begin,
+                                                    simsimd_size_t columns_count, simsimd_f32_t *outputs[4]) {
+    for (simsimd_size_t j0 = 0; j0 < columns_count; j0 += 16) {
+        simsimd_size_t const block = columns_count - j0 < 16 ? columns_count - j0 : 16;
+        simsimd_f32_t sums[4][16] = {{0}};
+        for (simsimd_size_t i = 0; i != n; ++i) {
+            simsimd_f32_t const *l_row = l + i * n + columns_begin + j0;
+            for (simsimd_size_t r = 0; r != 4; ++r) {
+                simsimd_f32_t const x = rows[r][i];
+                for (simsimd_size_t j = 0; j != block; ++j) sums[r][j] += x * l_row[j];
+            }
+        }
+        for (simsimd_size_t r = 0; r != 4; ++r)
+            for (simsimd_size_t j = 0; j != block; ++j) outputs[r][j0 + j] = sums[r][j];
+    }
+}
+
+/*  The batched kernels are identical for all backends, differing only in the 4-row projection micro-kernel
+ *  and the dot-product used to reduce the projected rows of `a` against the rows of `b`.
+ */
+#define SIMSIMD_MAKE_CURVED_BATCH(name)                                                                              \
+    SIMSIMD_PUBLIC void simsimd_whiten_f32_##name(simsimd_f32_t const *vectors, simsimd_size_t count,                \
+                                                  simsimd_size_t stride, simsimd_f32_t const *l, simsimd_size_t n,   \
+                                                  simsimd_f32_t *whitened, simsimd_size_t whitened_stride) {         \
+        simsimd_f32_t const *rows[4];                                                                                \
+        simsimd_f32_t *outputs[4];                                                                                   \
+        for (simsimd_size_t i = 0; i < count; i += 4) {                                                              \
+            /* The last rows are repeated, storing the same values into the same outputs */                          \
+            for (simsimd_size_t r = 0; r != 4; ++r) {                                                                \
+                simsimd_size_t const row = i + r < count ? i + r : count - 1;                                        \
+                rows[r] = SIMSIMD_ROW(simsimd_f32_t, vectors, stride, row);                                          \
+                outputs[r] = (simsimd_f32_t *)((simsimd_u8_t *)whitened + row * whitened_stride);                    \
+            }                                                                                                        \
+            _simsimd_project_f32x4_##name(rows, l, n, 0, n, outputs);                                                \
+        }                                                                                                            \
+    }                                                                                                                \
+    SIMSIMD_PUBLIC void simsimd_bilinear_cdist_f32_##name(                                                           \
+        simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count, simsimd_size_t a_stride,             \
+        simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_f32_t const *c, simsimd_size_t n,                   \
+        simsimd_distance_t *results, simsimd_size_t results_stride) {                                                \
+        simsimd_f32_t projected[4][SIMSIMD_CURVED_KC];                                                               \
+        simsimd_f32_t const *rows[4];                                                                                \
+        simsimd_f32_t *outputs[4] = {projected[0], projected[1], projected[2], projected[3]};                        \
+        for (simsimd_size_t i = 0; i < a_count; i += 4) {                                                            \
+            simsimd_size_t const rows_count = a_count - i < 4 ? a_count - i : 4;                                     \
+            for (simsimd_size_t r = 0; r != 4; ++r)                                                                  \
+                rows[r] = SIMSIMD_ROW(simsimd_f32_t, a, a_stride, r < rows_count ? i + r : i);                       \
+            simsimd_size_t k = 0;                                                                                    \
+            do {                                                                                                     \
+                simsimd_size_t const depth = n - k < SIMSIMD_CURVED_KC ? n - k : SIMSIMD_CURVED_KC;                  \
+                _simsimd_project_f32x4_##name(rows, c, n, k, depth, outputs);                                        \
+                for (simsimd_size_t j = 0; j != b_count; ++j) {                                                      \
+                    simsimd_f32_t const *b_row = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j) + k;                     \
+                    for (simsimd_size_t r = 0; r != rows_count; ++r) {                                               \
+                        simsimd_distance_t *result =                                                                 \
+                            (simsimd_distance_t *)((simsimd_u8_t *)results + (i + r) * results_stride) + j;          \
+                        simsimd_distance_t partial;                                                                  \
+                        simsimd_dot_f32_##name(projected[r], b_row, depth, &partial);                                \
+                        *result = k ? *result + partial : partial;                                                   \
+                    }                                                                                                \
+                }                                                                                                    \
+                k += SIMSIMD_CURVED_KC;                                                                              \
+            } while (k < n);                                                                                         \
+        }                                                                                                            \
+    }
+
+SIMSIMD_MAKE_CURVED_BATCH(serial) // simsimd_whiten_f32_serial, simsimd_bilinear_cdist_f32_serial
+
 #if _SIMSIMD_TARGET_ARM
 #if SIMSIMD_TARGET_NEON
 #pragma GCC push_options
@@ -219,6 +337,37 @@ SIMSIMD_PUBLIC void simsimd_mahalanobis_f32_neon(simsimd_f32_t const *a, simsimd
     *result = _simsimd_sqrt_f64_neon(sum);
 }
 
+SIMSIMD_INTERNAL void _simsimd_project_f32x4_neon(simsimd_f32_t const *rows[4], simsimd_f32_t const *l,
+                                                  simsimd_size_t n, simsimd_size_t columns_begin,
+                                                  simsimd_size_t columns_count, simsimd_f32_t *outputs[4]) {
+    // Every step multiplies 4 rows by 16 columns, keeping all 16 accumulators in registers
+    simsimd_size_t j0 = 0;
+    for (; j0 + 16 <= columns_count; j0 += 16) {
+        float32x4_t sums_vec[4][4];
+        for (simsimd_size_t r = 0; r != 4; ++r)
+            for (simsimd_size_t q = 0; q != 4; ++q) sums_vec[r][q] = vdupq_n_f32(0);
+        for (simsimd_size_t i = 0; i != n; ++i) {
+            simsimd_f32_t const *l_row = l + i * n + columns_begin + j0;
+            float32x4_t l_vecs[4] = {vld1q_f32(l_row), vld1q_f32(l_row + 4), vld1q_f32(l_row + 8),
+                                     vld1q_f32(l_row + 12)};
+            for (simsimd_size_t r = 0; r != 4; ++r) {
+                simsimd_f32_t const x = rows[r][i];
+                for (simsimd_size_t q = 0; q != 4; ++q) sums_vec[r][q] = vfmaq_n_f32(sums_vec[r][q], l_vecs[q], x);
+            }
+        }
+        for (simsimd_size_t r = 0; r != 4; ++r)
+            for (simsimd_size_t q = 0; q != 4; ++q) vst1q_f32(outputs[r] + j0 + q * 4, sums_vec[r][q]);
+    }
+
+    // Handle the remaining columns
+    if (j0 < columns_count) {
+        simsimd_f32_t *tails[4] = {outputs[0] + j0, outputs[1] + j0, outputs[2] + j0, outputs[3] + j0};
+        _simsimd_project_f32x4_serial(rows, l, n, columns_begin + j0, columns_count - j0, tails);
+    }
+}
+
+SIMSIMD_MAKE_CURVED_BATCH(neon) // simsimd_whiten_f32_neon, simsimd_bilinear_cdist_f32_neon
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_NEON
@@ -633,6 +782,35 @@ SIMSIMD_PUBLIC void simsimd_mahalanobis_f32_skylake(simsimd_f32_t const *a, sims
     *result = _simsimd_sqrt_f64_haswell(_mm512_reduce_add_ps(sum_vec));
 }
 
+SIMSIMD_INTERNAL void _simsimd_project_f32x4_skylake(simsimd_f32_t const *rows[4], simsimd_f32_t const *l,
+                                                     simsimd_size_t n, simsimd_size_t columns_begin,
+                                                     simsimd_size_t columns_count, simsimd_f32_t *outputs[4]) {
+    // Every step multiplies 4 rows by 32 columns, masking the columns past the end
+    for (simsimd_size_t j0 = 0; j0 < columns_count; j0 += 32) {
+        simsimd_size_t const block = columns_count - j0 < 32 ? columns_count - j0 : 32;
+        __mmask16 const low_mask = (__mmask16)_bzhi_u32(0xFFFF, block < 16 ? block : 16);
+        __mmask16 const high_mask = (__mmask16)_bzhi_u32(0xFFFF, block > 16 ? block - 16 : 0);
+        __m512 sums_low_vec[4], sums_high_vec[4];
+        for (simsimd_size_t r = 0; r != 4; ++r) sums_low_vec[r] = sums_high_vec[r] = _mm512_setzero_ps();
+        for (simsimd_size_t i = 0; i != n; ++i) {
+            simsimd_f32_t const *l_row = l + i * n + columns_begin + j0;
+            __m512 l_low_vec = _mm512_maskz_loadu_ps(low_mask, l_row);
+            __m512 l_high_vec = _mm512_maskz_loadu_ps(high_mask, l_row + 16);
+            for (simsimd_size_t r = 0; r != 4; ++r) {
+                __m512 x_vec = _mm512_set1_ps(rows[r][i]);
+                sums_low_vec[r] = _mm512_fmadd_ps(x_vec, l_low_vec, sums_low_vec[r]);
+                sums_high_vec[r] = _mm512_fmadd_ps(x_vec, l_high_vec, sums_high_vec[r]);
+            }
+        }
+        for (simsimd_size_t r = 0; r != 4; ++r) {
+            _mm512_mask_storeu_ps(outputs[r] + j0, low_mask, sums_low_vec[r]);
+            _mm512_mask_storeu_ps(outputs[r] + j0 + 16, high_mask, sums_high_vec[r]);
+        }
+    }
+}
+
+SIMSIMD_MAKE_CURVED_BATCH(skylake) // simsimd_whiten_f32_skylake, simsimd_bilinear_cdist_f32_skylake
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_SKYLAKE
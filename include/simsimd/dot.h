@@ -15,9 +15,10 @@
  *  - 16-bit brain floating point numbers
  *  - 8-bit unsigned integers
  *  - 8-bit signed integers
+ *  - 4-bit signed integers, packed in pairs
  *
  *  For hardware architectures:
- *  - Arm: NEON, SVE
+ *  - Arm: NEON, SVE, SVE2.1
  *  - x86: Haswell, Ice Lake, Skylake, Genoa, Sapphire
  *
  *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
@@ -56,6 +57,7 @@ SIMSIMD_PUBLIC void simsimd_vdot_bf16c_serial(simsimd_bf16_t const* a, simsimd_b
 
 SIMSIMD_PUBLIC void simsimd_dot_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 SIMSIMD_PUBLIC void simsimd_dot_u8_serial(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_i4x2_serial(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 
 /*  Double-precision serial backends for all numeric types.
  *  For single-precision computation check out the "*_serial" counterparts of those "*_accurate" functions.
@@ -86,6 +88,7 @@ SIMSIMD_PUBLIC void simsimd_vdot_f16c_neon(simsimd_f16_t const* a, simsimd_f16_t
 
 SIMSIMD_PUBLIC void simsimd_dot_i8_neon(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 SIMSIMD_PUBLIC void simsimd_dot_u8_neon(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_i4x2_neon(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 
 SIMSIMD_PUBLIC void simsimd_dot_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 SIMSIMD_PUBLIC void simsimd_dot_bf16c_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t* results);
@@ -106,6 +109,15 @@ SIMSIMD_PUBLIC void simsimd_dot_f64_sve(simsimd_f64_t const* a, simsimd_f64_t co
 SIMSIMD_PUBLIC void simsimd_dot_f64c_sve(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t* results);
 SIMSIMD_PUBLIC void simsimd_vdot_f64c_sve(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t* results);
 
+SIMSIMD_PUBLIC void simsimd_dot_i4x2_sve(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+
+/*  SIMD-powered backends for Arm SVE2.1, accumulating pairs of `f16` products directly into `f32` lanes.
+ *  Designed for Arm Neoverse V3 and newer CPUs, and requires GCC 14 or Clang 18 to compile.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+
 /*  SIMD-powered backends for AVX2 CPUs of Haswell generation and newer, using 32-bit arithmetic over 256-bit words.
  *  First demonstrated in 2011, at least one Haswell-based processor was still being sold in 2022 — the Pentium G3420.
  *  Practically all modern x86 CPUs support AVX2, FMA, and F16C, making it a perfect baseline for SIMD algorithms.
@@ -124,6 +136,7 @@ SIMSIMD_PUBLIC void simsimd_dot_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf
 
 SIMSIMD_PUBLIC void simsimd_dot_i8_haswell(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 SIMSIMD_PUBLIC void simsimd_dot_u8_haswell(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_i4x2_haswell(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 
 /*  SIMD-powered backends for various generations of AVX512 CPUs.
  *  Skylake is handy, as it supports masked loads and other operations, avoiding the need for the tail loop.
@@ -141,6 +154,7 @@ SIMSIMD_PUBLIC void simsimd_vdot_f32c_skylake(simsimd_f32_t const* a, simsimd_f3
 
 SIMSIMD_PUBLIC void simsimd_dot_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 SIMSIMD_PUBLIC void simsimd_dot_u8_ice(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_i4x2_ice(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 
 SIMSIMD_PUBLIC void simsimd_dot_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 SIMSIMD_PUBLIC void simsimd_dot_bf16c_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t* result);
@@ -151,6 +165,55 @@ SIMSIMD_PUBLIC void simsimd_dot_f16c_sapphire(simsimd_f16_t const* a, simsimd_f1
 SIMSIMD_PUBLIC void simsimd_vdot_f16c_sapphire(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 
 SIMSIMD_PUBLIC void simsimd_dot_i8_sierra(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+
+/*  One-to-many backends, comparing a single query `a` against `b_count` rows of `b`, separated by `b_stride` bytes.
+ *  The query is loaded once per 4 candidate rows, which are consumed in lock-step, amortizing the load
+ *  and the horizontal reduction costs, that dominate the one-to-one kernels for short vectors.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_batch_f64_serial(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_u8_serial(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_f16_sve2p1(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_dot_batch_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+
+/*  Asymmetric backends, comparing an `f32` or `f16` query `a` against a quantized `i8`, `u8`, or `i4x2` row `b`,
+ *  that is reconstructed inside the loop as `(b[i] - zero_points[j]) * scales[j]`, where `j == i * params_stride`.
+ *  A zero `params_stride` applies a single scale and zero-point to the whole row, and a unit one - per dimension.
+ *  Unlike the symmetric kernels, `n` counts dimensions rather than words, so an `i4x2` row spans `(n + 1) / 2` bytes.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_f32i8_serial(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f32u8_serial(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f32i4x2_serial(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16i8_serial(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16u8_serial(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16i4x2_serial(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f32i8_neon(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f32u8_neon(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f32i4x2_neon(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16i8_neon(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16u8_neon(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16i4x2_neon(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f32i8_haswell(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f32u8_haswell(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f32i4x2_haswell(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16i8_haswell(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16u8_haswell(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16i4x2_haswell(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f32i8_skylake(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f32u8_skylake(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f32i4x2_skylake(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16i8_skylake(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16u8_skylake(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_f16i4x2_skylake(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
 // clang-format on
 
 #define SIMSIMD_MAKE_DOT(name, input_type, accumulator_type, load_and_convert)                                 \
@@ -200,6 +263,31 @@ SIMSIMD_PUBLIC void simsimd_dot_i8_sierra(simsimd_i8_t const* a, simsimd_i8_t co
         results[1] = ab_imag;                                                                                    \
     }
 
+#define SIMSIMD_MAKE_DOT_BATCH(name, input_type, accumulator_type, load_and_convert)                           \
+    SIMSIMD_PUBLIC void simsimd_dot_batch_##input_type##_##name(                                                 \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t b_count,          \
+        simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results) {                              \
+        simsimd_size_t j = 0;                                                                                  \
+        for (; j + 4 <= b_count; j += 4) {                                                                     \
+            simsimd_##input_type##_t const *b0 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 0);     \
+            simsimd_##input_type##_t const *b1 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 1);     \
+            simsimd_##input_type##_t const *b2 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 2);     \
+            simsimd_##input_type##_t const *b3 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 3);     \
+            simsimd_##accumulator_type##_t ab0 = 0, ab1 = 0, ab2 = 0, ab3 = 0;                                 \
+            for (simsimd_size_t i = 0; i != n; ++i) {                                                          \
+                simsimd_##accumulator_type##_t ai = load_and_convert(a + i);                                   \
+                ab0 += ai * (simsimd_##accumulator_type##_t)load_and_convert(b0 + i);                          \
+                ab1 += ai * (simsimd_##accumulator_type##_t)load_and_convert(b1 + i);                          \
+                ab2 += ai * (simsimd_##accumulator_type##_t)load_and_convert(b2 + i);                          \
+                ab3 += ai * (simsimd_##accumulator_type##_t)load_and_convert(b3 + i);                          \
+            }                                                                                                  \
+            results[j + 0] = ab0, results[j + 1] = ab1, results[j + 2] = ab2, results[j + 3] = ab3;            \
+        }                                                                                                      \
+        for (; j != b_count; ++j)                                                                              \
+            simsimd_dot_##input_type##_##name(a, SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j), n,     \
+                                              results + j);                                                    \
+    }
+
 SIMSIMD_MAKE_DOT(serial, f64, f64, SIMSIMD_DEREFERENCE)          // simsimd_dot_f64_serial
 SIMSIMD_MAKE_COMPLEX_DOT(serial, f64, f64, SIMSIMD_DEREFERENCE)  // simsimd_dot_f64c_serial
 SIMSIMD_MAKE_COMPLEX_VDOT(serial, f64, f64, SIMSIMD_DEREFERENCE) // simsimd_vdot_f64c_serial
@@ -219,6 +307,46 @@ SIMSIMD_MAKE_COMPLEX_VDOT(serial, bf16, f32, SIMSIMD_BF16_TO_F32) // simsimd_vdo
 SIMSIMD_MAKE_DOT(serial, i8, i64, SIMSIMD_DEREFERENCE) // simsimd_dot_i8_serial
 SIMSIMD_MAKE_DOT(serial, u8, i64, SIMSIMD_DEREFERENCE) // simsimd_dot_u8_serial
 
+#define SIMSIMD_MAKE_QUANTIZED_DOT(name, query_type, database_type, load_query, load_database)                 \
+    SIMSIMD_PUBLIC void simsimd_dot_##query_type##database_type##_##name(                                      \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,             \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,          \
+        simsimd_distance_t *result) {                                                                         \
+        simsimd_f32_t ab = 0;                                                                                 \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                             \
+            simsimd_f32_t ai = load_query(a + i);                                                             \
+            simsimd_f32_t bi = SIMSIMD_DEQUANTIZE(load_database(b, i), scales, zero_points, i * params_stride); \
+            ab += ai * bi;                                                                                    \
+        }                                                                                                     \
+        *result = ab;                                                                                         \
+    }
+
+SIMSIMD_MAKE_QUANTIZED_DOT(serial, f32, i8, SIMSIMD_DEREFERENCE, SIMSIMD_INDEX)        // simsimd_dot_f32i8_serial
+SIMSIMD_MAKE_QUANTIZED_DOT(serial, f32, u8, SIMSIMD_DEREFERENCE, SIMSIMD_INDEX)        // simsimd_dot_f32u8_serial
+SIMSIMD_MAKE_QUANTIZED_DOT(serial, f32, i4x2, SIMSIMD_DEREFERENCE, SIMSIMD_I4X2_INDEX) // simsimd_dot_f32i4x2_serial
+SIMSIMD_MAKE_QUANTIZED_DOT(serial, f16, i8, SIMSIMD_F16_TO_F32, SIMSIMD_INDEX)         // simsimd_dot_f16i8_serial
+SIMSIMD_MAKE_QUANTIZED_DOT(serial, f16, u8, SIMSIMD_F16_TO_F32, SIMSIMD_INDEX)         // simsimd_dot_f16u8_serial
+SIMSIMD_MAKE_QUANTIZED_DOT(serial, f16, i4x2, SIMSIMD_F16_TO_F32, SIMSIMD_I4X2_INDEX)  // simsimd_dot_f16i4x2_serial
+
+/**
+ *  @brief  Inner product of two vectors of 4-bit signed integers, packed in pairs into `n_words` bytes.
+ *          The low nibble of every byte holds the first scalar, and the high nibble holds the second one.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_i4x2_serial(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                            simsimd_distance_t *result) {
+    simsimd_i64_t ab = 0;
+    for (simsimd_size_t i = 0; i != n_words; ++i)
+        ab += SIMSIMD_I4X2_LOW(a[i]) * SIMSIMD_I4X2_LOW(b[i]) + SIMSIMD_I4X2_HIGH(a[i]) * SIMSIMD_I4X2_HIGH(b[i]);
+    *result = (simsimd_distance_t)ab;
+}
+
+SIMSIMD_MAKE_DOT_BATCH(serial, f64, f64, SIMSIMD_DEREFERENCE)    // simsimd_dot_batch_f64_serial
+SIMSIMD_MAKE_DOT_BATCH(serial, f32, f32, SIMSIMD_DEREFERENCE)    // simsimd_dot_batch_f32_serial
+SIMSIMD_MAKE_DOT_BATCH(serial, f16, f32, SIMSIMD_F16_TO_F32)     // simsimd_dot_batch_f16_serial
+SIMSIMD_MAKE_DOT_BATCH(serial, bf16, f32, SIMSIMD_BF16_TO_F32)   // simsimd_dot_batch_bf16_serial
+SIMSIMD_MAKE_DOT_BATCH(serial, i8, i64, SIMSIMD_DEREFERENCE)     // simsimd_dot_batch_i8_serial
+SIMSIMD_MAKE_DOT_BATCH(serial, u8, i64, SIMSIMD_DEREFERENCE)     // simsimd_dot_batch_u8_serial
+
 SIMSIMD_MAKE_DOT(accurate, f32, f64, SIMSIMD_DEREFERENCE)          // simsimd_dot_f32_accurate
 SIMSIMD_MAKE_COMPLEX_DOT(accurate, f32, f64, SIMSIMD_DEREFERENCE)  // simsimd_dot_f32c_accurate
 SIMSIMD_MAKE_COMPLEX_VDOT(accurate, f32, f64, SIMSIMD_DEREFERENCE) // simsimd_vdot_f32c_accurate
@@ -262,6 +390,36 @@ SIMSIMD_PUBLIC void simsimd_dot_f32_neon(simsimd_f32_t const *a, simsimd_f32_t c
     *result = ab;
 }
 
+SIMSIMD_PUBLIC void simsimd_dot_batch_f32_neon(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                               simsimd_size_t b_stride, simsimd_size_t n,
+                                               simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        float32x4_t ab0_vec = vdupq_n_f32(0), ab1_vec = vdupq_n_f32(0);
+        float32x4_t ab2_vec = vdupq_n_f32(0), ab3_vec = vdupq_n_f32(0);
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t a_vec = vld1q_f32(a + i);
+            ab0_vec = vfmaq_f32(ab0_vec, a_vec, vld1q_f32(b0 + i));
+            ab1_vec = vfmaq_f32(ab1_vec, a_vec, vld1q_f32(b1 + i));
+            ab2_vec = vfmaq_f32(ab2_vec, a_vec, vld1q_f32(b2 + i));
+            ab3_vec = vfmaq_f32(ab3_vec, a_vec, vld1q_f32(b3 + i));
+        }
+        simsimd_f32_t ab0 = vaddvq_f32(ab0_vec), ab1 = vaddvq_f32(ab1_vec);
+        simsimd_f32_t ab2 = vaddvq_f32(ab2_vec), ab3 = vaddvq_f32(ab3_vec);
+        for (; i < n; ++i) {
+            simsimd_f32_t ai = a[i];
+            ab0 += ai * b0[i], ab1 += ai * b1[i], ab2 += ai * b2[i], ab3 += ai * b3[i];
+        }
+        results[j + 0] = ab0, results[j + 1] = ab1, results[j + 2] = ab2, results[j + 3] = ab3;
+    }
+    for (; j != b_count; ++j) simsimd_dot_f32_neon(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
 SIMSIMD_PUBLIC void simsimd_dot_f32c_neon(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n, //
                                           simsimd_distance_t *results) {
     float32x4_t ab_real_vec = vdupq_n_f32(0);
@@ -332,6 +490,78 @@ SIMSIMD_PUBLIC void simsimd_vdot_f32c_neon(simsimd_f32_t const *a, simsimd_f32_t
     results[1] = ab_imag;
 }
 
+/*  Loaders for the asymmetric kernels, upcasting 8 consecutive scalars, starting from the `i`-th one,
+ *  into two halves of `f32` values. The `i4x2` words are duplicated, so that every byte lane holds one nibble.
+ */
+SIMSIMD_INTERNAL void _simsimd_load_f32x8_neon(simsimd_f32_t const *a, simsimd_size_t i, float32x4_t *low,
+                                               float32x4_t *high) {
+    *low = vld1q_f32(a + i), *high = vld1q_f32(a + i + 4);
+}
+SIMSIMD_INTERNAL void _simsimd_load_i8x8_neon(simsimd_i8_t const *b, simsimd_size_t i, float32x4_t *low,
+                                              float32x4_t *high) {
+    int16x8_t b_i16_vec = vmovl_s8(vld1_s8(b + i));
+    *low = vcvtq_f32_s32(vmovl_s16(vget_low_s16(b_i16_vec)));
+    *high = vcvtq_f32_s32(vmovl_high_s16(b_i16_vec));
+}
+SIMSIMD_INTERNAL void _simsimd_load_u8x8_neon(simsimd_u8_t const *b, simsimd_size_t i, float32x4_t *low,
+                                              float32x4_t *high) {
+    uint16x8_t b_u16_vec = vmovl_u8(vld1_u8(b + i));
+    *low = vcvtq_f32_u32(vmovl_u16(vget_low_u16(b_u16_vec)));
+    *high = vcvtq_f32_u32(vmovl_high_u16(b_u16_vec));
+}
+SIMSIMD_INTERNAL void _simsimd_load_i4x8_neon(simsimd_i4x2_t const *b, simsimd_size_t i, float32x4_t *low,
+                                              float32x4_t *high) {
+    uint8x8_t words_vec = vreinterpret_u8_u32(vld1_dup_u32((uint32_t const *)(b + i / 2)));
+    int8x8_t pairs_vec = vreinterpret_s8_u8(vzip1_u8(words_vec, words_vec));
+    // Move the low nibbles of even lanes to the top, then sign-extend both kinds with an arithmetic shift
+    int8x8_t nibbles_vec = vshr_n_s8(vshl_s8(pairs_vec, vreinterpret_s8_u16(vdup_n_u16(4))), 4);
+    int16x8_t b_i16_vec = vmovl_s8(nibbles_vec);
+    *low = vcvtq_f32_s32(vmovl_s16(vget_low_s16(b_i16_vec)));
+    *high = vcvtq_f32_s32(vmovl_high_s16(b_i16_vec));
+}
+SIMSIMD_INTERNAL void _simsimd_dequantize_f32x8_neon(simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                                     simsimd_size_t params_stride, simsimd_size_t i, float32x4_t *low,
+                                                     float32x4_t *high) {
+    if (params_stride) {
+        *low = vmulq_f32(vsubq_f32(*low, vld1q_f32(zero_points + i)), vld1q_f32(scales + i));
+        *high = vmulq_f32(vsubq_f32(*high, vld1q_f32(zero_points + i + 4)), vld1q_f32(scales + i + 4));
+    }
+    else {
+        float32x4_t scale_vec = vdupq_n_f32(scales[0]), zero_vec = vdupq_n_f32(zero_points[0]);
+        *low = vmulq_f32(vsubq_f32(*low, zero_vec), scale_vec);
+        *high = vmulq_f32(vsubq_f32(*high, zero_vec), scale_vec);
+    }
+}
+
+#define SIMSIMD_MAKE_QUANTIZED_DOT_NEON(query_type, database_type, load_query, load_database, load_query_scalar, \
+                                        load_database_scalar)                                                     \
+    SIMSIMD_PUBLIC void simsimd_dot_##query_type##database_type##_neon(                                          \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,               \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,            \
+        simsimd_distance_t *result) {                                                                           \
+        float32x4_t a_low_vec, a_high_vec, b_low_vec, b_high_vec;                                               \
+        float32x4_t ab_vec = vdupq_n_f32(0);                                                                    \
+        simsimd_size_t i = 0;                                                                                   \
+        for (; i + 8 <= n; i += 8) {                                                                            \
+            load_query(a, i, &a_low_vec, &a_high_vec);                                                          \
+            load_database(b, i, &b_low_vec, &b_high_vec);                                                       \
+            _simsimd_dequantize_f32x8_neon(scales, zero_points, params_stride, i, &b_low_vec, &b_high_vec);     \
+            ab_vec = vfmaq_f32(vfmaq_f32(ab_vec, a_low_vec, b_low_vec), a_high_vec, b_high_vec);                \
+        }                                                                                                       \
+        simsimd_f32_t ab = vaddvq_f32(ab_vec);                                                                  \
+        for (; i < n; ++i)                                                                                      \
+            ab += load_query_scalar(a + i) *                                                                    \
+                  SIMSIMD_DEQUANTIZE(load_database_scalar(b, i), scales, zero_points, i * params_stride);       \
+        *result = ab;                                                                                           \
+    }
+
+SIMSIMD_MAKE_QUANTIZED_DOT_NEON(f32, i8, _simsimd_load_f32x8_neon, _simsimd_load_i8x8_neon, SIMSIMD_DEREFERENCE,
+                                SIMSIMD_INDEX) // simsimd_dot_f32i8_neon
+SIMSIMD_MAKE_QUANTIZED_DOT_NEON(f32, u8, _simsimd_load_f32x8_neon, _simsimd_load_u8x8_neon, SIMSIMD_DEREFERENCE,
+                                SIMSIMD_INDEX) // simsimd_dot_f32u8_neon
+SIMSIMD_MAKE_QUANTIZED_DOT_NEON(f32, i4x2, _simsimd_load_f32x8_neon, _simsimd_load_i4x8_neon, SIMSIMD_DEREFERENCE,
+                                SIMSIMD_I4X2_INDEX) // simsimd_dot_f32i4x2_neon
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_NEON
@@ -392,6 +622,25 @@ SIMSIMD_PUBLIC void simsimd_dot_u8_neon(simsimd_u8_t const *a, simsimd_u8_t cons
     *result = ab;
 }
 
+SIMSIMD_PUBLIC void simsimd_dot_i4x2_neon(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                          simsimd_distance_t *result) {
+    int32x4_t ab_vec = vdupq_n_s32(0);
+    simsimd_size_t i = 0;
+    for (; i + 16 <= n_words; i += 16) {
+        int8x16_t a_vec = vreinterpretq_s8_u8(vld1q_u8(a + i));
+        int8x16_t b_vec = vreinterpretq_s8_u8(vld1q_u8(b + i));
+        // Arithmetic shifts sign-extend the nibbles for free: the low one is moved up first
+        ab_vec = vdotq_s32(ab_vec, vshrq_n_s8(vshlq_n_s8(a_vec, 4), 4), vshrq_n_s8(vshlq_n_s8(b_vec, 4), 4));
+        ab_vec = vdotq_s32(ab_vec, vshrq_n_s8(a_vec, 4), vshrq_n_s8(b_vec, 4));
+    }
+
+    // Take care of the tail:
+    int32_t ab = vaddvq_s32(ab_vec);
+    for (; i < n_words; ++i)
+        ab += SIMSIMD_I4X2_LOW(a[i]) * SIMSIMD_I4X2_LOW(b[i]) + SIMSIMD_I4X2_HIGH(a[i]) * SIMSIMD_I4X2_HIGH(b[i]);
+    *result = ab;
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_NEON_I8
@@ -507,6 +756,20 @@ SIMSIMD_PUBLIC void simsimd_vdot_f16c_neon(simsimd_f16_t const *a, simsimd_f16_t
     results[1] += vaddvq_f32(ab_imag_vec);
 }
 
+SIMSIMD_INTERNAL void _simsimd_load_f16x8_neon(simsimd_f16_t const *a, simsimd_size_t i, float32x4_t *low,
+                                               float32x4_t *high) {
+    float16x8_t a_f16_vec = vld1q_f16((simsimd_f16_for_arm_simd_t const *)(a + i));
+    *low = vcvt_f32_f16(vget_low_f16(a_f16_vec));
+    *high = vcvt_high_f32_f16(a_f16_vec);
+}
+
+SIMSIMD_MAKE_QUANTIZED_DOT_NEON(f16, i8, _simsimd_load_f16x8_neon, _simsimd_load_i8x8_neon, SIMSIMD_F16_TO_F32,
+                                SIMSIMD_INDEX) // simsimd_dot_f16i8_neon
+SIMSIMD_MAKE_QUANTIZED_DOT_NEON(f16, u8, _simsimd_load_f16x8_neon, _simsimd_load_u8x8_neon, SIMSIMD_F16_TO_F32,
+                                SIMSIMD_INDEX) // simsimd_dot_f16u8_neon
+SIMSIMD_MAKE_QUANTIZED_DOT_NEON(f16, i4x2, _simsimd_load_f16x8_neon, _simsimd_load_i4x8_neon, SIMSIMD_F16_TO_F32,
+                                SIMSIMD_I4X2_INDEX) // simsimd_dot_f16i4x2_neon
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_NEON_F16
@@ -643,6 +906,114 @@ SIMSIMD_PUBLIC void simsimd_dot_f32_sve(simsimd_f32_t const *a, simsimd_f32_t co
     *result = svaddv_f32(svptrue_b32(), ab_vec);
 }
 
+SIMSIMD_PUBLIC void simsimd_dot_batch_f32_sve(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n,
+                                              simsimd_distance_t *results) {
+    // Every row gets two independent accumulators, so that the 8 chains of `svmla` hide the 4-cycle FMA latency
+    // on cores with 2 or 4 SVE pipes, like Neoverse V1 and V2, instead of stalling on a single chain per row.
+    simsimd_size_t const step = svcntw();
+    svbool_t const all_vec = svptrue_b32();
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        svfloat32_t ab0_first_vec = svdup_f32(0.f), ab1_first_vec = svdup_f32(0.f);
+        svfloat32_t ab2_first_vec = svdup_f32(0.f), ab3_first_vec = svdup_f32(0.f);
+        svfloat32_t ab0_second_vec = svdup_f32(0.f), ab1_second_vec = svdup_f32(0.f);
+        svfloat32_t ab2_second_vec = svdup_f32(0.f), ab3_second_vec = svdup_f32(0.f);
+        simsimd_size_t i = 0;
+        for (; i + 2 * step <= n; i += 2 * step) {
+            svfloat32_t a_first_vec = svld1_f32(all_vec, a + i);
+            svfloat32_t a_second_vec = svld1_f32(all_vec, a + i + step);
+            ab0_first_vec = svmla_f32_x(all_vec, ab0_first_vec, a_first_vec, svld1_f32(all_vec, b0 + i));
+            ab1_first_vec = svmla_f32_x(all_vec, ab1_first_vec, a_first_vec, svld1_f32(all_vec, b1 + i));
+            ab2_first_vec = svmla_f32_x(all_vec, ab2_first_vec, a_first_vec, svld1_f32(all_vec, b2 + i));
+            ab3_first_vec = svmla_f32_x(all_vec, ab3_first_vec, a_first_vec, svld1_f32(all_vec, b3 + i));
+            ab0_second_vec = svmla_f32_x(all_vec, ab0_second_vec, a_second_vec, svld1_f32(all_vec, b0 + i + step));
+            ab1_second_vec = svmla_f32_x(all_vec, ab1_second_vec, a_second_vec, svld1_f32(all_vec, b1 + i + step));
+            ab2_second_vec = svmla_f32_x(all_vec, ab2_second_vec, a_second_vec, svld1_f32(all_vec, b2 + i + step));
+            ab3_second_vec = svmla_f32_x(all_vec, ab3_second_vec, a_second_vec, svld1_f32(all_vec, b3 + i + step));
+        }
+        for (; i < n; i += step) {
+            svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+            svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+            ab0_first_vec = svmla_f32_m(pg_vec, ab0_first_vec, a_vec, svld1_f32(pg_vec, b0 + i));
+            ab1_first_vec = svmla_f32_m(pg_vec, ab1_first_vec, a_vec, svld1_f32(pg_vec, b1 + i));
+            ab2_first_vec = svmla_f32_m(pg_vec, ab2_first_vec, a_vec, svld1_f32(pg_vec, b2 + i));
+            ab3_first_vec = svmla_f32_m(pg_vec, ab3_first_vec, a_vec, svld1_f32(pg_vec, b3 + i));
+        }
+        results[j + 0] = svaddv_f32(all_vec, svadd_f32_x(all_vec, ab0_first_vec, ab0_second_vec));
+        results[j + 1] = svaddv_f32(all_vec, svadd_f32_x(all_vec, ab1_first_vec, ab1_second_vec));
+        results[j + 2] = svaddv_f32(all_vec, svadd_f32_x(all_vec, ab2_first_vec, ab2_second_vec));
+        results[j + 3] = svaddv_f32(all_vec, svadd_f32_x(all_vec, ab3_first_vec, ab3_second_vec));
+    }
+    for (; j != b_count; ++j) simsimd_dot_f32_sve(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_i8_sve(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                       simsimd_distance_t *result) {
+    simsimd_size_t const step = svcntb();
+    svbool_t const all_vec = svptrue_b8();
+    svint32_t ab_first_vec = svdup_n_s32(0), ab_second_vec = svdup_n_s32(0);
+    simsimd_size_t i = 0;
+    for (; i + 2 * step <= n; i += 2 * step) {
+        ab_first_vec = svdot_s32(ab_first_vec, svld1_s8(all_vec, a + i), svld1_s8(all_vec, b + i));
+        ab_second_vec = svdot_s32(ab_second_vec, svld1_s8(all_vec, a + i + step), svld1_s8(all_vec, b + i + step));
+    }
+    // The predicated loads zero the inactive lanes, so that the unpredicated `svdot` can consume them
+    for (; i < n; i += step) {
+        svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n);
+        ab_first_vec = svdot_s32(ab_first_vec, svld1_s8(pg_vec, a + i), svld1_s8(pg_vec, b + i));
+    }
+    *result = svaddv_s32(svptrue_b32(), svadd_s32_x(svptrue_b32(), ab_first_vec, ab_second_vec));
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_batch_i8_sve(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                             simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results) {
+    simsimd_size_t const step = svcntb();
+    svbool_t const all_vec = svptrue_b8();
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_i8_t const *b0 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 0);
+        simsimd_i8_t const *b1 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 1);
+        simsimd_i8_t const *b2 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 2);
+        simsimd_i8_t const *b3 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 3);
+        svint32_t ab0_first_vec = svdup_n_s32(0), ab1_first_vec = svdup_n_s32(0);
+        svint32_t ab2_first_vec = svdup_n_s32(0), ab3_first_vec = svdup_n_s32(0);
+        svint32_t ab0_second_vec = svdup_n_s32(0), ab1_second_vec = svdup_n_s32(0);
+        svint32_t ab2_second_vec = svdup_n_s32(0), ab3_second_vec = svdup_n_s32(0);
+        simsimd_size_t i = 0;
+        for (; i + 2 * step <= n; i += 2 * step) {
+            svint8_t a_first_vec = svld1_s8(all_vec, a + i);
+            svint8_t a_second_vec = svld1_s8(all_vec, a + i + step);
+            ab0_first_vec = svdot_s32(ab0_first_vec, a_first_vec, svld1_s8(all_vec, b0 + i));
+            ab1_first_vec = svdot_s32(ab1_first_vec, a_first_vec, svld1_s8(all_vec, b1 + i));
+            ab2_first_vec = svdot_s32(ab2_first_vec, a_first_vec, svld1_s8(all_vec, b2 + i));
+            ab3_first_vec = svdot_s32(ab3_first_vec, a_first_vec, svld1_s8(all_vec, b3 + i));
+            ab0_second_vec = svdot_s32(ab0_second_vec, a_second_vec, svld1_s8(all_vec, b0 + i + step));
+            ab1_second_vec = svdot_s32(ab1_second_vec, a_second_vec, svld1_s8(all_vec, b1 + i + step));
+            ab2_second_vec = svdot_s32(ab2_second_vec, a_second_vec, svld1_s8(all_vec, b2 + i + step));
+            ab3_second_vec = svdot_s32(ab3_second_vec, a_second_vec, svld1_s8(all_vec, b3 + i + step));
+        }
+        for (; i < n; i += step) {
+            svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n);
+            svint8_t a_vec = svld1_s8(pg_vec, a + i);
+            ab0_first_vec = svdot_s32(ab0_first_vec, a_vec, svld1_s8(pg_vec, b0 + i));
+            ab1_first_vec = svdot_s32(ab1_first_vec, a_vec, svld1_s8(pg_vec, b1 + i));
+            ab2_first_vec = svdot_s32(ab2_first_vec, a_vec, svld1_s8(pg_vec, b2 + i));
+            ab3_first_vec = svdot_s32(ab3_first_vec, a_vec, svld1_s8(pg_vec, b3 + i));
+        }
+        svbool_t const all_words_vec = svptrue_b32();
+        results[j + 0] = svaddv_s32(all_words_vec, svadd_s32_x(all_words_vec, ab0_first_vec, ab0_second_vec));
+        results[j + 1] = svaddv_s32(all_words_vec, svadd_s32_x(all_words_vec, ab1_first_vec, ab1_second_vec));
+        results[j + 2] = svaddv_s32(all_words_vec, svadd_s32_x(all_words_vec, ab2_first_vec, ab2_second_vec));
+        results[j + 3] = svaddv_s32(all_words_vec, svadd_s32_x(all_words_vec, ab3_first_vec, ab3_second_vec));
+    }
+    for (; j != b_count; ++j) simsimd_dot_i8_sve(a, SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j), n, results + j);
+}
+
 SIMSIMD_PUBLIC void simsimd_dot_f32c_sve(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
                                          simsimd_distance_t *results) {
     simsimd_size_t i = 0;
@@ -819,9 +1190,185 @@ SIMSIMD_PUBLIC void simsimd_vdot_f16c_sve(simsimd_f16_t const *a, simsimd_f16_t
     results[1] = svaddv_f16(svptrue_b16(), ab_imag_vec);
 }
 
+SIMSIMD_PUBLIC void simsimd_dot_i4x2_sve(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                         simsimd_distance_t *result) {
+    simsimd_size_t i = 0;
+    svint32_t ab_vec = svdup_n_s32(0);
+    do {
+        svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n_words);
+        svint8_t a_vec = svreinterpret_s8_u8(svld1_u8(pg_vec, a + i));
+        svint8_t b_vec = svreinterpret_s8_u8(svld1_u8(pg_vec, b + i));
+        // Zeroing the inactive lanes, so that the unpredicated `svdot` can consume them
+        svint8_t a_low_vec = svasr_n_s8_z(pg_vec, svlsl_n_s8_z(pg_vec, a_vec, 4), 4);
+        svint8_t b_low_vec = svasr_n_s8_z(pg_vec, svlsl_n_s8_z(pg_vec, b_vec, 4), 4);
+        svint8_t a_high_vec = svasr_n_s8_z(pg_vec, a_vec, 4);
+        svint8_t b_high_vec = svasr_n_s8_z(pg_vec, b_vec, 4);
+        ab_vec = svdot_s32(svdot_s32(ab_vec, a_low_vec, b_low_vec), a_high_vec, b_high_vec);
+        i += svcntb();
+    } while (i < n_words);
+    *result = svaddv_s32(svptrue_b32(), ab_vec);
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_SVE
+
+#if SIMSIMD_TARGET_SVE_BF16
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+sve+bf16")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+sve+bf16"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_dot_bf16_sve(simsimd_bf16_t const *a_enum, simsimd_bf16_t const *b_enum, simsimd_size_t n,
+                                         simsimd_distance_t *result) {
+    simsimd_bf16_for_arm_simd_t const *a = (simsimd_bf16_for_arm_simd_t const *)(a_enum);
+    simsimd_bf16_for_arm_simd_t const *b = (simsimd_bf16_for_arm_simd_t const *)(b_enum);
+    simsimd_size_t const step = svcnth();
+    svbool_t const all_vec = svptrue_b16();
+    svfloat32_t ab_first_vec = svdup_f32(0.f), ab_second_vec = svdup_f32(0.f);
+    simsimd_size_t i = 0;
+    for (; i + 2 * step <= n; i += 2 * step) {
+        ab_first_vec = svbfdot_f32(ab_first_vec, svld1_bf16(all_vec, a + i), svld1_bf16(all_vec, b + i));
+        ab_second_vec = svbfdot_f32(ab_second_vec, svld1_bf16(all_vec, a + i + step),
+                                    svld1_bf16(all_vec, b + i + step));
+    }
+    // The predicated loads zero the inactive lanes, so that the unpredicated `svbfdot` can consume them
+    for (; i < n; i += step) {
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+        ab_first_vec = svbfdot_f32(ab_first_vec, svld1_bf16(pg_vec, a + i), svld1_bf16(pg_vec, b + i));
+    }
+    *result = svaddv_f32(svptrue_b32(), svadd_f32_x(svptrue_b32(), ab_first_vec, ab_second_vec));
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_batch_bf16_sve(simsimd_bf16_t const *a_enum, simsimd_bf16_t const *b_enum,
+                                               simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                               simsimd_distance_t *results) {
+    simsimd_bf16_for_arm_simd_t const *a = (simsimd_bf16_for_arm_simd_t const *)(a_enum);
+    simsimd_size_t const step = svcnth();
+    svbool_t const all_vec = svptrue_b16();
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_bf16_for_arm_simd_t const *b0 = SIMSIMD_ROW(simsimd_bf16_for_arm_simd_t, b_enum, b_stride, j + 0);
+        simsimd_bf16_for_arm_simd_t const *b1 = SIMSIMD_ROW(simsimd_bf16_for_arm_simd_t, b_enum, b_stride, j + 1);
+        simsimd_bf16_for_arm_simd_t const *b2 = SIMSIMD_ROW(simsimd_bf16_for_arm_simd_t, b_enum, b_stride, j + 2);
+        simsimd_bf16_for_arm_simd_t const *b3 = SIMSIMD_ROW(simsimd_bf16_for_arm_simd_t, b_enum, b_stride, j + 3);
+        svfloat32_t ab0_first_vec = svdup_f32(0.f), ab1_first_vec = svdup_f32(0.f);
+        svfloat32_t ab2_first_vec = svdup_f32(0.f), ab3_first_vec = svdup_f32(0.f);
+        svfloat32_t ab0_second_vec = svdup_f32(0.f), ab1_second_vec = svdup_f32(0.f);
+        svfloat32_t ab2_second_vec = svdup_f32(0.f), ab3_second_vec = svdup_f32(0.f);
+        simsimd_size_t i = 0;
+        for (; i + 2 * step <= n; i += 2 * step) {
+            svbfloat16_t a_first_vec = svld1_bf16(all_vec, a + i);
+            svbfloat16_t a_second_vec = svld1_bf16(all_vec, a + i + step);
+            ab0_first_vec = svbfdot_f32(ab0_first_vec, a_first_vec, svld1_bf16(all_vec, b0 + i));
+            ab1_first_vec = svbfdot_f32(ab1_first_vec, a_first_vec, svld1_bf16(all_vec, b1 + i));
+            ab2_first_vec = svbfdot_f32(ab2_first_vec, a_first_vec, svld1_bf16(all_vec, b2 + i));
+            ab3_first_vec = svbfdot_f32(ab3_first_vec, a_first_vec, svld1_bf16(all_vec, b3 + i));
+            ab0_second_vec = svbfdot_f32(ab0_second_vec, a_second_vec, svld1_bf16(all_vec, b0 + i + step));
+            ab1_second_vec = svbfdot_f32(ab1_second_vec, a_second_vec, svld1_bf16(all_vec, b1 + i + step));
+            ab2_second_vec = svbfdot_f32(ab2_second_vec, a_second_vec, svld1_bf16(all_vec, b2 + i + step));
+            ab3_second_vec = svbfdot_f32(ab3_second_vec, a_second_vec, svld1_bf16(all_vec, b3 + i + step));
+        }
+        for (; i < n; i += step) {
+            svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+            svbfloat16_t a_vec = svld1_bf16(pg_vec, a + i);
+            ab0_first_vec = svbfdot_f32(ab0_first_vec, a_vec, svld1_bf16(pg_vec, b0 + i));
+            ab1_first_vec = svbfdot_f32(ab1_first_vec, a_vec, svld1_bf16(pg_vec, b1 + i));
+            ab2_first_vec = svbfdot_f32(ab2_first_vec, a_vec, svld1_bf16(pg_vec, b2 + i));
+            ab3_first_vec = svbfdot_f32(ab3_first_vec, a_vec, svld1_bf16(pg_vec, b3 + i));
+        }
+        svbool_t const all_words_vec = svptrue_b32();
+        results[j + 0] = svaddv_f32(all_words_vec, svadd_f32_x(all_words_vec, ab0_first_vec, ab0_second_vec));
+        results[j + 1] = svaddv_f32(all_words_vec, svadd_f32_x(all_words_vec, ab1_first_vec, ab1_second_vec));
+        results[j + 2] = svaddv_f32(all_words_vec, svadd_f32_x(all_words_vec, ab2_first_vec, ab2_second_vec));
+        results[j + 3] = svaddv_f32(all_words_vec, svadd_f32_x(all_words_vec, ab3_first_vec, ab3_second_vec));
+    }
+    for (; j != b_count; ++j)
+        simsimd_dot_bf16_sve(a_enum, SIMSIMD_ROW(simsimd_bf16_t, b_enum, b_stride, j), n, results + j);
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SVE_BF16
+
+#if SIMSIMD_TARGET_SVE2P1
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+sve+sve2+sve2p1")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+sve+sve2+sve2p1"))), apply_to = function)
+
+/*  Unlike the `svmla_f16` in the `simsimd_dot_f16_sve`, the SVE2.1 `svdot_f32_f16` multiplies pairs of adjacent
+ *  `f16` values and accumulates them into `f32` lanes, avoiding both the precision loss and the widening conversions.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_f16_sve2p1(simsimd_f16_t const *a_enum, simsimd_f16_t const *b_enum, simsimd_size_t n,
+                                           simsimd_distance_t *result) {
+    simsimd_f16_for_arm_simd_t const *a = (simsimd_f16_for_arm_simd_t const *)(a_enum);
+    simsimd_f16_for_arm_simd_t const *b = (simsimd_f16_for_arm_simd_t const *)(b_enum);
+    simsimd_size_t const step = svcnth();
+    svbool_t const all_vec = svptrue_b16();
+    svfloat32_t ab_first_vec = svdup_f32(0.f), ab_second_vec = svdup_f32(0.f);
+    simsimd_size_t i = 0;
+    for (; i + 2 * step <= n; i += 2 * step) {
+        ab_first_vec = svdot_f32_f16(ab_first_vec, svld1_f16(all_vec, a + i), svld1_f16(all_vec, b + i));
+        ab_second_vec = svdot_f32_f16(ab_second_vec, svld1_f16(all_vec, a + i + step),
+                                      svld1_f16(all_vec, b + i + step));
+    }
+    // The predicated loads zero the inactive lanes, so that the unpredicated `svdot` can consume them
+    for (; i < n; i += step) {
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+        ab_first_vec = svdot_f32_f16(ab_first_vec, svld1_f16(pg_vec, a + i), svld1_f16(pg_vec, b + i));
+    }
+    *result = svaddv_f32(svptrue_b32(), svadd_f32_x(svptrue_b32(), ab_first_vec, ab_second_vec));
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_batch_f16_sve2p1(simsimd_f16_t const *a_enum, simsimd_f16_t const *b_enum,
+                                                 simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t *results) {
+    simsimd_f16_for_arm_simd_t const *a = (simsimd_f16_for_arm_simd_t const *)(a_enum);
+    simsimd_size_t const step = svcnth();
+    svbool_t const all_vec = svptrue_b16();
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f16_for_arm_simd_t const *b0 = SIMSIMD_ROW(simsimd_f16_for_arm_simd_t, b_enum, b_stride, j + 0);
+        simsimd_f16_for_arm_simd_t const *b1 = SIMSIMD_ROW(simsimd_f16_for_arm_simd_t, b_enum, b_stride, j + 1);
+        simsimd_f16_for_arm_simd_t const *b2 = SIMSIMD_ROW(simsimd_f16_for_arm_simd_t, b_enum, b_stride, j + 2);
+        simsimd_f16_for_arm_simd_t const *b3 = SIMSIMD_ROW(simsimd_f16_for_arm_simd_t, b_enum, b_stride, j + 3);
+        svfloat32_t ab0_first_vec = svdup_f32(0.f), ab1_first_vec = svdup_f32(0.f);
+        svfloat32_t ab2_first_vec = svdup_f32(0.f), ab3_first_vec = svdup_f32(0.f);
+        svfloat32_t ab0_second_vec = svdup_f32(0.f), ab1_second_vec = svdup_f32(0.f);
+        svfloat32_t ab2_second_vec = svdup_f32(0.f), ab3_second_vec = svdup_f32(0.f);
+        simsimd_size_t i = 0;
+        for (; i + 2 * step <= n; i += 2 * step) {
+            svfloat16_t a_first_vec = svld1_f16(all_vec, a + i);
+            svfloat16_t a_second_vec = svld1_f16(all_vec, a + i + step);
+            ab0_first_vec = svdot_f32_f16(ab0_first_vec, a_first_vec, svld1_f16(all_vec, b0 + i));
+            ab1_first_vec = svdot_f32_f16(ab1_first_vec, a_first_vec, svld1_f16(all_vec, b1 + i));
+            ab2_first_vec = svdot_f32_f16(ab2_first_vec, a_first_vec, svld1_f16(all_vec, b2 + i));
+            ab3_first_vec = svdot_f32_f16(ab3_first_vec, a_first_vec, svld1_f16(all_vec, b3 + i));
+            ab0_second_vec = svdot_f32_f16(ab0_second_vec, a_second_vec, svld1_f16(all_vec, b0 + i + step));
+            ab1_second_vec = svdot_f32_f16(ab1_second_vec, a_second_vec, svld1_f16(all_vec, b1 + i + step));
+            ab2_second_vec = svdot_f32_f16(ab2_second_vec, a_second_vec, svld1_f16(all_vec, b2 + i + step));
+            ab3_second_vec = svdot_f32_f16(ab3_second_vec, a_second_vec, svld1_f16(all_vec, b3 + i + step));
+        }
+        for (; i < n; i += step) {
+            svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+            svfloat16_t a_vec = svld1_f16(pg_vec, a + i);
+            ab0_first_vec = svdot_f32_f16(ab0_first_vec, a_vec, svld1_f16(pg_vec, b0 + i));
+            ab1_first_vec = svdot_f32_f16(ab1_first_vec, a_vec, svld1_f16(pg_vec, b1 + i));
+            ab2_first_vec = svdot_f32_f16(ab2_first_vec, a_vec, svld1_f16(pg_vec, b2 + i));
+            ab3_first_vec = svdot_f32_f16(ab3_first_vec, a_vec, svld1_f16(pg_vec, b3 + i));
+        }
+        svbool_t const all_words_vec = svptrue_b32();
+        results[j + 0] = svaddv_f32(all_words_vec, svadd_f32_x(all_words_vec, ab0_first_vec, ab0_second_vec));
+        results[j + 1] = svaddv_f32(all_words_vec, svadd_f32_x(all_words_vec, ab1_first_vec, ab1_second_vec));
+        results[j + 2] = svaddv_f32(all_words_vec, svadd_f32_x(all_words_vec, ab2_first_vec, ab2_second_vec));
+        results[j + 3] = svaddv_f32(all_words_vec, svadd_f32_x(all_words_vec, ab3_first_vec, ab3_second_vec));
+    }
+    for (; j != b_count; ++j)
+        simsimd_dot_f16_sve2p1(a_enum, SIMSIMD_ROW(simsimd_f16_t, b_enum, b_stride, j), n, results + j);
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SVE2P1
 #endif // _SIMSIMD_TARGET_ARM
 
 #if _SIMSIMD_TARGET_X86
@@ -882,6 +1429,36 @@ SIMSIMD_PUBLIC void simsimd_dot_f32_haswell(simsimd_f32_t const *a, simsimd_f32_
     *results = ab;
 }
 
+SIMSIMD_PUBLIC void simsimd_dot_batch_f32_haswell(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        __m256 ab0_vec = _mm256_setzero_ps(), ab1_vec = _mm256_setzero_ps();
+        __m256 ab2_vec = _mm256_setzero_ps(), ab3_vec = _mm256_setzero_ps();
+        simsimd_size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256 a_vec = _mm256_loadu_ps(a + i);
+            ab0_vec = _mm256_fmadd_ps(a_vec, _mm256_loadu_ps(b0 + i), ab0_vec);
+            ab1_vec = _mm256_fmadd_ps(a_vec, _mm256_loadu_ps(b1 + i), ab1_vec);
+            ab2_vec = _mm256_fmadd_ps(a_vec, _mm256_loadu_ps(b2 + i), ab2_vec);
+            ab3_vec = _mm256_fmadd_ps(a_vec, _mm256_loadu_ps(b3 + i), ab3_vec);
+        }
+        simsimd_f64_t ab0 = _simsimd_reduce_f32x8_haswell(ab0_vec), ab1 = _simsimd_reduce_f32x8_haswell(ab1_vec);
+        simsimd_f64_t ab2 = _simsimd_reduce_f32x8_haswell(ab2_vec), ab3 = _simsimd_reduce_f32x8_haswell(ab3_vec);
+        for (; i < n; ++i) {
+            simsimd_f32_t ai = a[i];
+            ab0 += ai * b0[i], ab1 += ai * b1[i], ab2 += ai * b2[i], ab3 += ai * b3[i];
+        }
+        results[j + 0] = ab0, results[j + 1] = ab1, results[j + 2] = ab2, results[j + 3] = ab3;
+    }
+    for (; j != b_count; ++j) simsimd_dot_f32_haswell(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
 SIMSIMD_PUBLIC void simsimd_dot_f32c_haswell(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
                                              simsimd_distance_t *results) {
 
@@ -1247,6 +1824,135 @@ simsimd_dot_bf16_haswell_cycle:
     *result = _simsimd_reduce_f32x8_haswell(ab_vec);
 }
 
+/**
+ *  @brief  Unpacks 64 scalars of 32 `i4x2` words into two vectors of sign-extended `i8` values,
+ *          the first holding the low nibbles, and the second holding the high ones.
+ */
+SIMSIMD_INTERNAL void _simsimd_i4x2_to_i8x32_haswell(__m256i words, __m256i *low, __m256i *high) {
+    __m256i const i4_to_i8_lookup_vec = _mm256_setr_epi8(                    //
+        0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1,              //
+        0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1);
+    __m256i const nibble_vec = _mm256_set1_epi8(0x0F);
+    *low = _mm256_shuffle_epi8(i4_to_i8_lookup_vec, _mm256_and_si256(words, nibble_vec));
+    *high = _mm256_shuffle_epi8(i4_to_i8_lookup_vec, _mm256_and_si256(_mm256_srli_epi16(words, 4), nibble_vec));
+}
+
+/**
+ *  @brief  Multiplies signed `i8` values, that must be in the [-8, 7] range, and adds adjacent pairs into `i16`.
+ *          The `_mm256_maddubs_epi16` expects the first argument to be unsigned, so we move the sign of `a` to `b`.
+ */
+SIMSIMD_INTERNAL __m256i _simsimd_i4x32_dot_i16x16_haswell(__m256i a_i8_vec, __m256i b_i8_vec) {
+    return _mm256_maddubs_epi16(_mm256_abs_epi8(a_i8_vec), _mm256_sign_epi8(b_i8_vec, a_i8_vec));
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_i4x2_haswell(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                             simsimd_distance_t *result) {
+    __m256i const ones_i16_vec = _mm256_set1_epi16(1);
+    __m256i ab_i32_vec = _mm256_setzero_si256();
+    __m256i a_low_vec, a_high_vec, b_low_vec, b_high_vec;
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n_words; i += 32) {
+        _simsimd_i4x2_to_i8x32_haswell(_mm256_lddqu_si256((__m256i const *)(a + i)), &a_low_vec, &a_high_vec);
+        _simsimd_i4x2_to_i8x32_haswell(_mm256_lddqu_si256((__m256i const *)(b + i)), &b_low_vec, &b_high_vec);
+        // Every 16-bit lane sums 4 products, each at most 64 in magnitude, so it can't overflow
+        __m256i ab_i16_vec = _mm256_add_epi16(_simsimd_i4x32_dot_i16x16_haswell(a_low_vec, b_low_vec),
+                                              _simsimd_i4x32_dot_i16x16_haswell(a_high_vec, b_high_vec));
+        ab_i32_vec = _mm256_add_epi32(ab_i32_vec, _mm256_madd_epi16(ab_i16_vec, ones_i16_vec));
+    }
+
+    // Take care of the tail:
+    int ab = _simsimd_reduce_i32x8_haswell(ab_i32_vec);
+    for (; i < n_words; ++i)
+        ab += SIMSIMD_I4X2_LOW(a[i]) * SIMSIMD_I4X2_LOW(b[i]) + SIMSIMD_I4X2_HIGH(a[i]) * SIMSIMD_I4X2_HIGH(b[i]);
+    *result = ab;
+}
+
+/*  Loaders for the asymmetric kernels, upcasting 16 consecutive scalars, starting from the `i`-th one,
+ *  into two halves of `f32` values. The `i4x2` words are duplicated, so that every 32-bit lane holds one nibble.
+ */
+SIMSIMD_INTERNAL void _simsimd_load_f32x16_haswell(simsimd_f32_t const *a, simsimd_size_t i, __m256 *low,
+                                                   __m256 *high) {
+    *low = _mm256_loadu_ps(a + i), *high = _mm256_loadu_ps(a + i + 8);
+}
+SIMSIMD_INTERNAL void _simsimd_load_f16x16_haswell(simsimd_f16_t const *a, simsimd_size_t i, __m256 *low,
+                                                   __m256 *high) {
+    *low = _mm256_cvtph_ps(_mm_lddqu_si128((__m128i const *)(a + i)));
+    *high = _mm256_cvtph_ps(_mm_lddqu_si128((__m128i const *)(a + i + 8)));
+}
+SIMSIMD_INTERNAL void _simsimd_load_i8x16_haswell(simsimd_i8_t const *b, simsimd_size_t i, __m256 *low,
+                                                  __m256 *high) {
+    __m128i b_i8_vec = _mm_lddqu_si128((__m128i const *)(b + i));
+    *low = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(b_i8_vec));
+    *high = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_unpackhi_epi64(b_i8_vec, b_i8_vec)));
+}
+SIMSIMD_INTERNAL void _simsimd_load_u8x16_haswell(simsimd_u8_t const *b, simsimd_size_t i, __m256 *low,
+                                                  __m256 *high) {
+    __m128i b_u8_vec = _mm_lddqu_si128((__m128i const *)(b + i));
+    *low = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(b_u8_vec));
+    *high = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_unpackhi_epi64(b_u8_vec, b_u8_vec)));
+}
+SIMSIMD_INTERNAL void _simsimd_load_i4x16_haswell(simsimd_i4x2_t const *b, simsimd_size_t i, __m256 *low,
+                                                  __m256 *high) {
+    __m128i words_vec = _mm_loadl_epi64((__m128i const *)(b + i / 2));
+    __m128i pairs_vec = _mm_unpacklo_epi8(words_vec, words_vec);
+    // Move the low nibbles of even lanes to the top, then sign-extend both kinds with an arithmetic shift
+    __m256i const shifts_vec = _mm256_setr_epi32(28, 24, 28, 24, 28, 24, 28, 24);
+    __m256i low_i32_vec = _mm256_sllv_epi32(_mm256_cvtepu8_epi32(pairs_vec), shifts_vec);
+    __m256i high_i32_vec = _mm256_sllv_epi32(_mm256_cvtepu8_epi32(_mm_unpackhi_epi64(pairs_vec, pairs_vec)), //
+                                             shifts_vec);
+    *low = _mm256_cvtepi32_ps(_mm256_srai_epi32(low_i32_vec, 28));
+    *high = _mm256_cvtepi32_ps(_mm256_srai_epi32(high_i32_vec, 28));
+}
+SIMSIMD_INTERNAL void _simsimd_dequantize_f32x16_haswell(simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                                         simsimd_size_t params_stride, simsimd_size_t i, __m256 *low,
+                                                         __m256 *high) {
+    if (params_stride) {
+        *low = _mm256_mul_ps(_mm256_sub_ps(*low, _mm256_loadu_ps(zero_points + i)), _mm256_loadu_ps(scales + i));
+        *high = _mm256_mul_ps(_mm256_sub_ps(*high, _mm256_loadu_ps(zero_points + i + 8)),
+                              _mm256_loadu_ps(scales + i + 8));
+    }
+    else {
+        __m256 scale_vec = _mm256_set1_ps(scales[0]), zero_vec = _mm256_set1_ps(zero_points[0]);
+        *low = _mm256_mul_ps(_mm256_sub_ps(*low, zero_vec), scale_vec);
+        *high = _mm256_mul_ps(_mm256_sub_ps(*high, zero_vec), scale_vec);
+    }
+}
+
+#define SIMSIMD_MAKE_QUANTIZED_DOT_HASWELL(query_type, database_type, load_query, load_database, load_query_scalar, \
+                                           load_database_scalar)                                                     \
+    SIMSIMD_PUBLIC void simsimd_dot_##query_type##database_type##_haswell(                                          \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,                  \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,               \
+        simsimd_distance_t *result) {                                                                              \
+        __m256 a_low_vec, a_high_vec, b_low_vec, b_high_vec;                                                       \
+        __m256 ab_vec = _mm256_setzero_ps();                                                                       \
+        simsimd_size_t i = 0;                                                                                      \
+        for (; i + 16 <= n; i += 16) {                                                                             \
+            load_query(a, i, &a_low_vec, &a_high_vec);                                                             \
+            load_database(b, i, &b_low_vec, &b_high_vec);                                                          \
+            _simsimd_dequantize_f32x16_haswell(scales, zero_points, params_stride, i, &b_low_vec, &b_high_vec);    \
+            ab_vec = _mm256_fmadd_ps(a_high_vec, b_high_vec, _mm256_fmadd_ps(a_low_vec, b_low_vec, ab_vec));       \
+        }                                                                                                          \
+        simsimd_f64_t ab = _simsimd_reduce_f32x8_haswell(ab_vec);                                                  \
+        for (; i < n; ++i)                                                                                         \
+            ab += load_query_scalar(a + i) *                                                                       \
+                  SIMSIMD_DEQUANTIZE(load_database_scalar(b, i), scales, zero_points, i * params_stride);          \
+        *result = ab;                                                                                              \
+    }
+
+SIMSIMD_MAKE_QUANTIZED_DOT_HASWELL(f32, i8, _simsimd_load_f32x16_haswell, _simsimd_load_i8x16_haswell,
+                                   SIMSIMD_DEREFERENCE, SIMSIMD_INDEX) // simsimd_dot_f32i8_haswell
+SIMSIMD_MAKE_QUANTIZED_DOT_HASWELL(f32, u8, _simsimd_load_f32x16_haswell, _simsimd_load_u8x16_haswell,
+                                   SIMSIMD_DEREFERENCE, SIMSIMD_INDEX) // simsimd_dot_f32u8_haswell
+SIMSIMD_MAKE_QUANTIZED_DOT_HASWELL(f32, i4x2, _simsimd_load_f32x16_haswell, _simsimd_load_i4x16_haswell,
+                                   SIMSIMD_DEREFERENCE, SIMSIMD_I4X2_INDEX) // simsimd_dot_f32i4x2_haswell
+SIMSIMD_MAKE_QUANTIZED_DOT_HASWELL(f16, i8, _simsimd_load_f16x16_haswell, _simsimd_load_i8x16_haswell,
+                                   SIMSIMD_F16_TO_F32, SIMSIMD_INDEX) // simsimd_dot_f16i8_haswell
+SIMSIMD_MAKE_QUANTIZED_DOT_HASWELL(f16, u8, _simsimd_load_f16x16_haswell, _simsimd_load_u8x16_haswell,
+                                   SIMSIMD_F16_TO_F32, SIMSIMD_INDEX) // simsimd_dot_f16u8_haswell
+SIMSIMD_MAKE_QUANTIZED_DOT_HASWELL(f16, i4x2, _simsimd_load_f16x16_haswell, _simsimd_load_i4x16_haswell,
+                                   SIMSIMD_F16_TO_F32, SIMSIMD_I4X2_INDEX) // simsimd_dot_f16i4x2_haswell
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_HASWELL
@@ -1297,6 +2003,48 @@ simsimd_dot_f32_skylake_cycle:
     *result = _simsimd_reduce_f32x16_skylake(ab_vec);
 }
 
+SIMSIMD_PUBLIC void simsimd_dot_batch_f32_skylake(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        __m512 ab0_vec = _mm512_setzero(), ab1_vec = _mm512_setzero();
+        __m512 ab2_vec = _mm512_setzero(), ab3_vec = _mm512_setzero();
+        __m512 a_vec, b0_vec, b1_vec, b2_vec, b3_vec;
+        simsimd_size_t i = 0;
+
+    simsimd_dot_batch_f32_skylake_cycle:
+        if (n - i < 16) {
+            __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n - i);
+            a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+            b0_vec = _mm512_maskz_loadu_ps(mask, b0 + i), b1_vec = _mm512_maskz_loadu_ps(mask, b1 + i);
+            b2_vec = _mm512_maskz_loadu_ps(mask, b2 + i), b3_vec = _mm512_maskz_loadu_ps(mask, b3 + i);
+            i = n;
+        }
+        else {
+            a_vec = _mm512_loadu_ps(a + i);
+            b0_vec = _mm512_loadu_ps(b0 + i), b1_vec = _mm512_loadu_ps(b1 + i);
+            b2_vec = _mm512_loadu_ps(b2 + i), b3_vec = _mm512_loadu_ps(b3 + i);
+            i += 16;
+        }
+        ab0_vec = _mm512_fmadd_ps(a_vec, b0_vec, ab0_vec);
+        ab1_vec = _mm512_fmadd_ps(a_vec, b1_vec, ab1_vec);
+        ab2_vec = _mm512_fmadd_ps(a_vec, b2_vec, ab2_vec);
+        ab3_vec = _mm512_fmadd_ps(a_vec, b3_vec, ab3_vec);
+        if (i < n) goto simsimd_dot_batch_f32_skylake_cycle;
+
+        results[j + 0] = _simsimd_reduce_f32x16_skylake(ab0_vec);
+        results[j + 1] = _simsimd_reduce_f32x16_skylake(ab1_vec);
+        results[j + 2] = _simsimd_reduce_f32x16_skylake(ab2_vec);
+        results[j + 3] = _simsimd_reduce_f32x16_skylake(ab3_vec);
+    }
+    for (; j != b_count; ++j) simsimd_dot_f32_skylake(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
 SIMSIMD_PUBLIC void simsimd_dot_f64_skylake(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
                                             simsimd_distance_t *result) {
     __m512d ab_vec = _mm512_setzero_pd();
@@ -1502,6 +2250,72 @@ simsimd_vdot_f64c_skylake_cycle:
     results[1] = _mm512_reduce_add_pd(ab_imag_vec);
 }
 
+/*  Loaders for the asymmetric kernels, upcasting up to 16 consecutive scalars, starting from the `i`-th one,
+ *  into `f32` values. The lanes outside of the `mask` are zeroed, and the `i4x2` words are duplicated,
+ *  so that every 32-bit lane holds one nibble.
+ */
+SIMSIMD_INTERNAL __m512 _simsimd_load_f32x16_skylake(simsimd_f32_t const *a, simsimd_size_t i, __mmask16 mask) {
+    return _mm512_maskz_loadu_ps(mask, a + i);
+}
+SIMSIMD_INTERNAL __m512 _simsimd_load_f16x16_skylake(simsimd_f16_t const *a, simsimd_size_t i, __mmask16 mask) {
+    return _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, a + i));
+}
+SIMSIMD_INTERNAL __m512 _simsimd_load_i8x16_skylake(simsimd_i8_t const *b, simsimd_size_t i, __mmask16 mask) {
+    return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_maskz_loadu_epi8(mask, b + i)));
+}
+SIMSIMD_INTERNAL __m512 _simsimd_load_u8x16_skylake(simsimd_u8_t const *b, simsimd_size_t i, __mmask16 mask) {
+    return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(mask, b + i)));
+}
+SIMSIMD_INTERNAL __m512 _simsimd_load_i4x16_skylake(simsimd_i4x2_t const *b, simsimd_size_t i, __mmask16 mask) {
+    // Every even bit of the scalars mask marks a word, that must be loaded
+    __mmask16 words_mask = (__mmask16)_pext_u32(mask, 0x5555);
+    __m128i words_vec = _mm_maskz_loadu_epi8(words_mask, b + i / 2);
+    __m512i pairs_vec = _mm512_cvtepu8_epi32(_mm_unpacklo_epi8(words_vec, words_vec));
+    // Move the low nibbles of even lanes to the top, then sign-extend both kinds with an arithmetic shift
+    __m512i const shifts_vec = _mm512_set_epi32(24, 28, 24, 28, 24, 28, 24, 28, 24, 28, 24, 28, 24, 28, 24, 28);
+    return _mm512_cvtepi32_ps(_mm512_srai_epi32(_mm512_sllv_epi32(pairs_vec, shifts_vec), 28));
+}
+SIMSIMD_INTERNAL __m512 _simsimd_dequantize_f32x16_skylake(simsimd_f32_t const *scales,
+                                                           simsimd_f32_t const *zero_points,
+                                                           simsimd_size_t params_stride, simsimd_size_t i,
+                                                           __mmask16 mask, __m512 x) {
+    // The masked multiplication zeroes the tail, where `(0 - zero_point) * scale` would otherwise appear
+    if (params_stride)
+        return _mm512_maskz_mul_ps(mask, _mm512_sub_ps(x, _mm512_maskz_loadu_ps(mask, zero_points + i)),
+                                   _mm512_maskz_loadu_ps(mask, scales + i));
+    else
+        return _mm512_maskz_mul_ps(mask, _mm512_sub_ps(x, _mm512_set1_ps(zero_points[0])), _mm512_set1_ps(scales[0]));
+}
+
+#define SIMSIMD_MAKE_QUANTIZED_DOT_SKYLAKE(query_type, database_type, load_query, load_database)                \
+    SIMSIMD_PUBLIC void simsimd_dot_##query_type##database_type##_skylake(                                      \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,              \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,           \
+        simsimd_distance_t *result) {                                                                          \
+        __m512 ab_vec = _mm512_setzero_ps();                                                                   \
+        for (simsimd_size_t i = 0; i < n; i += 16) {                                                           \
+            __mmask16 mask = n - i < 16 ? (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)(n - i)) : 0xFFFF;        \
+            __m512 a_vec = load_query(a, i, mask);                                                             \
+            __m512 b_vec = _simsimd_dequantize_f32x16_skylake(scales, zero_points, params_stride, i, mask,     \
+                                                              load_database(b, i, mask));                      \
+            ab_vec = _mm512_fmadd_ps(a_vec, b_vec, ab_vec);                                                    \
+        }                                                                                                      \
+        *result = _simsimd_reduce_f32x16_skylake(ab_vec);                                                      \
+    }
+
+SIMSIMD_MAKE_QUANTIZED_DOT_SKYLAKE(f32, i8, _simsimd_load_f32x16_skylake,
+                                   _simsimd_load_i8x16_skylake) // simsimd_dot_f32i8_skylake
+SIMSIMD_MAKE_QUANTIZED_DOT_SKYLAKE(f32, u8, _simsimd_load_f32x16_skylake,
+                                   _simsimd_load_u8x16_skylake) // simsimd_dot_f32u8_skylake
+SIMSIMD_MAKE_QUANTIZED_DOT_SKYLAKE(f32, i4x2, _simsimd_load_f32x16_skylake,
+                                   _simsimd_load_i4x16_skylake) // simsimd_dot_f32i4x2_skylake
+SIMSIMD_MAKE_QUANTIZED_DOT_SKYLAKE(f16, i8, _simsimd_load_f16x16_skylake,
+                                   _simsimd_load_i8x16_skylake) // simsimd_dot_f16i8_skylake
+SIMSIMD_MAKE_QUANTIZED_DOT_SKYLAKE(f16, u8, _simsimd_load_f16x16_skylake,
+                                   _simsimd_load_u8x16_skylake) // simsimd_dot_f16u8_skylake
+SIMSIMD_MAKE_QUANTIZED_DOT_SKYLAKE(f16, i4x2, _simsimd_load_f16x16_skylake,
+                                   _simsimd_load_i4x16_skylake) // simsimd_dot_f16i4x2_skylake
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_SKYLAKE
@@ -1779,6 +2593,53 @@ simsimd_dot_i8_ice_cycle:
     *result = _mm512_reduce_add_epi32(ab_i32_vec);
 }
 
+SIMSIMD_PUBLIC void simsimd_dot_batch_i8_ice(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                             simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_i8_t const *b0 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 0);
+        simsimd_i8_t const *b1 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 1);
+        simsimd_i8_t const *b2 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 2);
+        simsimd_i8_t const *b3 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 3);
+        __m512i ab0_i32_vec = _mm512_setzero_si512(), ab1_i32_vec = _mm512_setzero_si512();
+        __m512i ab2_i32_vec = _mm512_setzero_si512(), ab3_i32_vec = _mm512_setzero_si512();
+        __m512i a_i16_vec, b0_i16_vec, b1_i16_vec, b2_i16_vec, b3_i16_vec;
+        simsimd_size_t i = 0;
+
+    simsimd_dot_batch_i8_ice_cycle:
+        if (n - i < 32) {
+            __mmask32 mask = (__mmask32)_bzhi_u32(0xFFFFFFFF, n - i);
+            a_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, a + i));
+            b0_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b0 + i));
+            b1_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b1 + i));
+            b2_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b2 + i));
+            b3_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b3 + i));
+            i = n;
+        }
+        else {
+            a_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(a + i)));
+            b0_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b0 + i)));
+            b1_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b1 + i)));
+            b2_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b2 + i)));
+            b3_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b3 + i)));
+            i += 32;
+        }
+        // The query is upcast to 16-bit once and reused for all 4 rows, see `simsimd_dot_i8_ice` for
+        // the reasons behind `_mm512_dpwssd_epi32` instead of `_mm512_dpbusd_epi32`.
+        ab0_i32_vec = _mm512_dpwssd_epi32(ab0_i32_vec, a_i16_vec, b0_i16_vec);
+        ab1_i32_vec = _mm512_dpwssd_epi32(ab1_i32_vec, a_i16_vec, b1_i16_vec);
+        ab2_i32_vec = _mm512_dpwssd_epi32(ab2_i32_vec, a_i16_vec, b2_i16_vec);
+        ab3_i32_vec = _mm512_dpwssd_epi32(ab3_i32_vec, a_i16_vec, b3_i16_vec);
+        if (i < n) goto simsimd_dot_batch_i8_ice_cycle;
+
+        results[j + 0] = _mm512_reduce_add_epi32(ab0_i32_vec);
+        results[j + 1] = _mm512_reduce_add_epi32(ab1_i32_vec);
+        results[j + 2] = _mm512_reduce_add_epi32(ab2_i32_vec);
+        results[j + 3] = _mm512_reduce_add_epi32(ab3_i32_vec);
+    }
+    for (; j != b_count; ++j) simsimd_dot_i8_ice(a, SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j), n, results + j);
+}
+
 SIMSIMD_PUBLIC void simsimd_dot_u8_ice(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
                                        simsimd_distance_t *result) {
     __m512i ab_i32_low_vec = _mm512_setzero_si512();
@@ -1818,6 +2679,58 @@ simsimd_dot_u8_ice_cycle:
     *result = _mm512_reduce_add_epi32(_mm512_add_epi32(ab_i32_low_vec, ab_i32_high_vec));
 }
 
+/**
+ *  @brief  Unpacks 128 scalars of 64 `i4x2` words into two vectors of sign-extended `i8` values,
+ *          the first holding the low nibbles, and the second holding the high ones.
+ */
+SIMSIMD_INTERNAL void _simsimd_i4x2_to_i8x64_ice(__m512i words, __m512i *low, __m512i *high) {
+    __m512i const i4_to_i8_lookup_vec = _mm512_set_epi8(        //
+        -1, -2, -3, -4, -5, -6, -7, -8, 7, 6, 5, 4, 3, 2, 1, 0, //
+        -1, -2, -3, -4, -5, -6, -7, -8, 7, 6, 5, 4, 3, 2, 1, 0, //
+        -1, -2, -3, -4, -5, -6, -7, -8, 7, 6, 5, 4, 3, 2, 1, 0, //
+        -1, -2, -3, -4, -5, -6, -7, -8, 7, 6, 5, 4, 3, 2, 1, 0);
+    __m512i const nibble_vec = _mm512_set1_epi8(0x0F);
+    *low = _mm512_shuffle_epi8(i4_to_i8_lookup_vec, _mm512_and_si512(words, nibble_vec));
+    *high = _mm512_shuffle_epi8(i4_to_i8_lookup_vec, _mm512_and_si512(_mm512_srli_epi64(words, 4), nibble_vec));
+}
+
+/**
+ *  @brief  Accumulates the products of signed `i8` values, that must be in the [-8, 7] range, into `i32` lanes.
+ *          The `_mm512_dpbusd_epi32` expects the first argument to be unsigned, so we move the sign of `a` to `b`.
+ *          Unlike the full `i8` range, the magnitudes of 4-bit integers always fit into the signed argument.
+ */
+SIMSIMD_INTERNAL __m512i _simsimd_i4x64_dot_i32x16_ice(__m512i ab_i32_vec, __m512i a_i8_vec, __m512i b_i8_vec) {
+    __mmask64 a_negative = _mm512_movepi8_mask(a_i8_vec);
+    __m512i b_flipped_vec = _mm512_mask_sub_epi8(b_i8_vec, a_negative, _mm512_setzero_si512(), b_i8_vec);
+    return _mm512_dpbusd_epi32(ab_i32_vec, _mm512_abs_epi8(a_i8_vec), b_flipped_vec);
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_i4x2_ice(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                         simsimd_distance_t *result) {
+    __m512i ab_i32_vec = _mm512_setzero_si512();
+    __m512i a_i4x2_vec, b_i4x2_vec, a_low_vec, a_high_vec, b_low_vec, b_high_vec;
+
+simsimd_dot_i4x2_ice_cycle:
+    if (n_words < 64) {
+        __mmask64 mask = (__mmask64)_bzhi_u64(0xFFFFFFFFFFFFFFFF, n_words);
+        a_i4x2_vec = _mm512_maskz_loadu_epi8(mask, a);
+        b_i4x2_vec = _mm512_maskz_loadu_epi8(mask, b);
+        n_words = 0;
+    }
+    else {
+        a_i4x2_vec = _mm512_loadu_epi8(a);
+        b_i4x2_vec = _mm512_loadu_epi8(b);
+        a += 64, b += 64, n_words -= 64;
+    }
+    _simsimd_i4x2_to_i8x64_ice(a_i4x2_vec, &a_low_vec, &a_high_vec);
+    _simsimd_i4x2_to_i8x64_ice(b_i4x2_vec, &b_low_vec, &b_high_vec);
+    ab_i32_vec = _simsimd_i4x64_dot_i32x16_ice(ab_i32_vec, a_low_vec, b_low_vec);
+    ab_i32_vec = _simsimd_i4x64_dot_i32x16_ice(ab_i32_vec, a_high_vec, b_high_vec);
+    if (n_words) goto simsimd_dot_i4x2_ice_cycle;
+
+    *result = _mm512_reduce_add_epi32(ab_i32_vec);
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_ICE
@@ -7,12 +7,17 @@
  *  Contains following element-wise operations:
  *  - WSum or Weighted-Sum: R[i] = Alpha * A[i] + Beta * B[i]
  *  - FMA or Fused-Multiply-Add: R[i] = Alpha * A[i] * B[i] + Beta * C[i]
+ *  - Scale: R[i] = Alpha * A[i] + Beta
+ *  - Add: R[i] = A[i] + B[i]
+ *  - Multiply: R[i] = A[i] * B[i]
+ *  - Quantize: R[i] = Alpha * A[i], converted from `f32` into `f16`, `bf16`, `i8`, `u8`, or sign bits of `b8`
+ *  - Dequantize: R[i] = Alpha * A[i], converted from `f16`, `bf16`, `i8`, or `u8` into `f32`
  *
  *  This tiny set of operations if enough to implement a wide range of algorithms.
- *  To scale a vector by a scalar, just call WSum with $Beta$ = 0.
- *  To sum two vectors, just call WSum with $Alpha$ = $Beta$ = 1.
  *  To average two vectors, just call WSum with $Alpha$ = $Beta$ = 0.5.
- *  To multiply vectors element-wise, just call FMA with $Beta$ = 0.
+ *  Scale, Add, and Multiply could also be expressed through WSum and FMA, but would stream a redundant
+ *  input and produce NaNs for infinite inputs multiplied by a zero weight, so they have dedicated kernels.
+ *  All of them process every element independently, so `result` may alias `a` or `b` for in-place updates.
  *
  *  For datatypes:
  *  - 64-bit IEEE floating point numbers
@@ -85,6 +90,92 @@ SIMSIMD_PUBLIC void simsimd_fma_u8_serial(
     simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_u8_t const *c, simsimd_size_t n, //
     simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_u8_t *result);
 
+SIMSIMD_PUBLIC void simsimd_scale_f64_serial( //
+    simsimd_f64_t const *a, simsimd_size_t n, //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t *result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_serial( //
+    simsimd_f32_t const *a, simsimd_size_t n, //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_scale_f16_serial( //
+    simsimd_f16_t const *a, simsimd_size_t n, //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t *result);
+SIMSIMD_PUBLIC void simsimd_scale_bf16_serial( //
+    simsimd_bf16_t const *a, simsimd_size_t n, //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t *result);
+SIMSIMD_PUBLIC void simsimd_scale_i8_serial( //
+    simsimd_i8_t const *a, simsimd_size_t n, //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t *result);
+SIMSIMD_PUBLIC void simsimd_scale_u8_serial( //
+    simsimd_u8_t const *a, simsimd_size_t n, //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_u8_t *result);
+
+SIMSIMD_PUBLIC void simsimd_add_f64_serial(                           //
+    simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n, //
+    simsimd_f64_t *result);
+SIMSIMD_PUBLIC void simsimd_add_f32_serial(                           //
+    simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n, //
+    simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_add_f16_serial(                           //
+    simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n, //
+    simsimd_f16_t *result);
+SIMSIMD_PUBLIC void simsimd_add_bf16_serial(                            //
+    simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n, //
+    simsimd_bf16_t *result);
+SIMSIMD_PUBLIC void simsimd_add_i8_serial(                          //
+    simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t n, //
+    simsimd_i8_t *result);
+SIMSIMD_PUBLIC void simsimd_add_u8_serial(                          //
+    simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n, //
+    simsimd_u8_t *result);
+
+SIMSIMD_PUBLIC void simsimd_multiply_f64_serial(                      //
+    simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n, //
+    simsimd_f64_t *result);
+SIMSIMD_PUBLIC void simsimd_multiply_f32_serial(                      //
+    simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n, //
+    simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_multiply_f16_serial(                      //
+    simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n, //
+    simsimd_f16_t *result);
+SIMSIMD_PUBLIC void simsimd_multiply_bf16_serial(                       //
+    simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n, //
+    simsimd_bf16_t *result);
+SIMSIMD_PUBLIC void simsimd_multiply_i8_serial(                     //
+    simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t n, //
+    simsimd_i8_t *result);
+SIMSIMD_PUBLIC void simsimd_multiply_u8_serial(                     //
+    simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n, //
+    simsimd_u8_t *result);
+
+SIMSIMD_PUBLIC void simsimd_quantize_f16_serial( //
+    simsimd_f32_t const *a, simsimd_size_t n,    //
+    simsimd_distance_t alpha, simsimd_f16_t *result);
+SIMSIMD_PUBLIC void simsimd_quantize_bf16_serial( //
+    simsimd_f32_t const *a, simsimd_size_t n,     //
+    simsimd_distance_t alpha, simsimd_bf16_t *result);
+SIMSIMD_PUBLIC void simsimd_quantize_i8_serial( //
+    simsimd_f32_t const *a, simsimd_size_t n,   //
+    simsimd_distance_t alpha, simsimd_i8_t *result);
+SIMSIMD_PUBLIC void simsimd_quantize_u8_serial( //
+    simsimd_f32_t const *a, simsimd_size_t n,   //
+    simsimd_distance_t alpha, simsimd_u8_t *result);
+SIMSIMD_PUBLIC void simsimd_quantize_b8_serial( //
+    simsimd_f32_t const *a, simsimd_size_t n,   //
+    simsimd_distance_t alpha, simsimd_b8_t *result);
+
+SIMSIMD_PUBLIC void simsimd_dequantize_f16_serial( //
+    simsimd_f16_t const *a, simsimd_size_t n,      //
+    simsimd_distance_t alpha, simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_dequantize_bf16_serial( //
+    simsimd_bf16_t const *a, simsimd_size_t n,      //
+    simsimd_distance_t alpha, simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_dequantize_i8_serial( //
+    simsimd_i8_t const *a, simsimd_size_t n,      //
+    simsimd_distance_t alpha, simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_dequantize_u8_serial( //
+    simsimd_u8_t const *a, simsimd_size_t n,      //
+    simsimd_distance_t alpha, simsimd_f32_t *result);
+
 #define SIMSIMD_MAKE_WSUM(name, input_type, accumulator_type, load_and_convert, convert_and_store)   \
     SIMSIMD_PUBLIC void simsimd_wsum_##input_type##_##name(                                          \
         simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t n,      \
@@ -114,6 +205,59 @@ SIMSIMD_PUBLIC void simsimd_fma_u8_serial(
         }                                                                                                        \
     }
 
+#define SIMSIMD_MAKE_SCALE(name, input_type, accumulator_type, load_and_convert, convert_and_store) \
+    SIMSIMD_PUBLIC void simsimd_scale_##input_type##_##name(                                        \
+        simsimd_##input_type##_t const *a, simsimd_size_t n, simsimd_distance_t alpha,              \
+        simsimd_distance_t beta, simsimd_##input_type##_t *result) {                                \
+        simsimd_##accumulator_type##_t alpha_cast = (simsimd_##accumulator_type##_t)alpha;          \
+        simsimd_##accumulator_type##_t beta_cast = (simsimd_##accumulator_type##_t)beta;            \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                   \
+            simsimd_##accumulator_type##_t ai = load_and_convert(a + i);                            \
+            simsimd_##accumulator_type##_t scaled = alpha_cast * ai + beta_cast;                    \
+            convert_and_store(scaled, result + i);                                                  \
+        }                                                                                           \
+    }
+
+#define SIMSIMD_MAKE_ADD(name, input_type, accumulator_type, load_and_convert, convert_and_store) \
+    SIMSIMD_PUBLIC void simsimd_add_##input_type##_##name(                                        \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t n,   \
+        simsimd_##input_type##_t *result) {                                                       \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                 \
+            simsimd_##accumulator_type##_t ai = load_and_convert(a + i);                          \
+            simsimd_##accumulator_type##_t bi = load_and_convert(b + i);                          \
+            simsimd_##accumulator_type##_t sum = ai + bi;                                         \
+            convert_and_store(sum, result + i);                                                   \
+        }                                                                                         \
+    }
+
+#define SIMSIMD_MAKE_MULTIPLY(name, input_type, accumulator_type, load_and_convert, convert_and_store) \
+    SIMSIMD_PUBLIC void simsimd_multiply_##input_type##_##name(                                        \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t n,        \
+        simsimd_##input_type##_t *result) {                                                            \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                      \
+            simsimd_##accumulator_type##_t ai = load_and_convert(a + i);                               \
+            simsimd_##accumulator_type##_t bi = load_and_convert(b + i);                               \
+            simsimd_##accumulator_type##_t product = ai * bi;                                          \
+            convert_and_store(product, result + i);                                                    \
+        }                                                                                              \
+    }
+
+#define SIMSIMD_MAKE_QUANTIZE(name, output_type, convert_and_store)                              \
+    SIMSIMD_PUBLIC void simsimd_quantize_##output_type##_##name(                                 \
+        simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,                      \
+        simsimd_##output_type##_t *result) {                                                     \
+        simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;                                          \
+        for (simsimd_size_t i = 0; i != n; ++i) convert_and_store(alpha_f32 * a[i], result + i); \
+    }
+
+#define SIMSIMD_MAKE_DEQUANTIZE(name, input_type, load_and_convert)                              \
+    SIMSIMD_PUBLIC void simsimd_dequantize_##input_type##_##name(                                \
+        simsimd_##input_type##_t const *a, simsimd_size_t n, simsimd_distance_t alpha,           \
+        simsimd_f32_t *result) {                                                                 \
+        simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;                                          \
+        for (simsimd_size_t i = 0; i != n; ++i) result[i] = alpha_f32 * load_and_convert(a + i); \
+    }
+
 SIMSIMD_MAKE_WSUM(serial, f64, f64, SIMSIMD_DEREFERENCE, SIMSIMD_EXPORT)       // simsimd_wsum_f64_serial
 SIMSIMD_MAKE_WSUM(serial, f32, f32, SIMSIMD_DEREFERENCE, SIMSIMD_EXPORT)       // simsimd_wsum_f32_serial
 SIMSIMD_MAKE_WSUM(serial, f16, f32, SIMSIMD_F16_TO_F32, SIMSIMD_F32_TO_F16)    // simsimd_wsum_f16_serial
@@ -140,6 +284,49 @@ SIMSIMD_MAKE_FMA(accurate, bf16, f64, SIMSIMD_BF16_TO_F32, SIMSIMD_F32_TO_BF16)
 SIMSIMD_MAKE_FMA(accurate, i8, f64, SIMSIMD_DEREFERENCE, SIMSIMD_F64_TO_I8)     // simsimd_fma_i8_accurate
 SIMSIMD_MAKE_FMA(accurate, u8, f64, SIMSIMD_DEREFERENCE, SIMSIMD_F64_TO_U8)     // simsimd_fma_u8_accurate
 
+SIMSIMD_MAKE_SCALE(serial, f64, f64, SIMSIMD_DEREFERENCE, SIMSIMD_EXPORT)       // simsimd_scale_f64_serial
+SIMSIMD_MAKE_SCALE(serial, f32, f32, SIMSIMD_DEREFERENCE, SIMSIMD_EXPORT)       // simsimd_scale_f32_serial
+SIMSIMD_MAKE_SCALE(serial, f16, f32, SIMSIMD_F16_TO_F32, SIMSIMD_F32_TO_F16)    // simsimd_scale_f16_serial
+SIMSIMD_MAKE_SCALE(serial, bf16, f32, SIMSIMD_BF16_TO_F32, SIMSIMD_F32_TO_BF16) // simsimd_scale_bf16_serial
+SIMSIMD_MAKE_SCALE(serial, i8, f32, SIMSIMD_DEREFERENCE, SIMSIMD_F32_TO_I8)     // simsimd_scale_i8_serial
+SIMSIMD_MAKE_SCALE(serial, u8, f32, SIMSIMD_DEREFERENCE, SIMSIMD_F32_TO_U8)     // simsimd_scale_u8_serial
+
+SIMSIMD_MAKE_ADD(serial, f64, f64, SIMSIMD_DEREFERENCE, SIMSIMD_EXPORT)       // simsimd_add_f64_serial
+SIMSIMD_MAKE_ADD(serial, f32, f32, SIMSIMD_DEREFERENCE, SIMSIMD_EXPORT)       // simsimd_add_f32_serial
+SIMSIMD_MAKE_ADD(serial, f16, f32, SIMSIMD_F16_TO_F32, SIMSIMD_F32_TO_F16)    // simsimd_add_f16_serial
+SIMSIMD_MAKE_ADD(serial, bf16, f32, SIMSIMD_BF16_TO_F32, SIMSIMD_F32_TO_BF16) // simsimd_add_bf16_serial
+SIMSIMD_MAKE_ADD(serial, i8, f32, SIMSIMD_DEREFERENCE, SIMSIMD_F32_TO_I8)     // simsimd_add_i8_serial
+SIMSIMD_MAKE_ADD(serial, u8, f32, SIMSIMD_DEREFERENCE, SIMSIMD_F32_TO_U8)     // simsimd_add_u8_serial
+
+SIMSIMD_MAKE_MULTIPLY(serial, f64, f64, SIMSIMD_DEREFERENCE, SIMSIMD_EXPORT)       // simsimd_multiply_f64_serial
+SIMSIMD_MAKE_MULTIPLY(serial, f32, f32, SIMSIMD_DEREFERENCE, SIMSIMD_EXPORT)       // simsimd_multiply_f32_serial
+SIMSIMD_MAKE_MULTIPLY(serial, f16, f32, SIMSIMD_F16_TO_F32, SIMSIMD_F32_TO_F16)    // simsimd_multiply_f16_serial
+SIMSIMD_MAKE_MULTIPLY(serial, bf16, f32, SIMSIMD_BF16_TO_F32, SIMSIMD_F32_TO_BF16) // simsimd_multiply_bf16_serial
+SIMSIMD_MAKE_MULTIPLY(serial, i8, f32, SIMSIMD_DEREFERENCE, SIMSIMD_F32_TO_I8)     // simsimd_multiply_i8_serial
+SIMSIMD_MAKE_MULTIPLY(serial, u8, f32, SIMSIMD_DEREFERENCE, SIMSIMD_F32_TO_U8)     // simsimd_multiply_u8_serial
+
+SIMSIMD_MAKE_QUANTIZE(serial, f16, SIMSIMD_F32_TO_F16)   // simsimd_quantize_f16_serial
+SIMSIMD_MAKE_QUANTIZE(serial, bf16, SIMSIMD_F32_TO_BF16) // simsimd_quantize_bf16_serial
+SIMSIMD_MAKE_QUANTIZE(serial, i8, SIMSIMD_F32_TO_I8)     // simsimd_quantize_i8_serial
+SIMSIMD_MAKE_QUANTIZE(serial, u8, SIMSIMD_F32_TO_U8)     // simsimd_quantize_u8_serial
+
+SIMSIMD_MAKE_DEQUANTIZE(serial, f16, SIMSIMD_F16_TO_F32)   // simsimd_dequantize_f16_serial
+SIMSIMD_MAKE_DEQUANTIZE(serial, bf16, SIMSIMD_BF16_TO_F32) // simsimd_dequantize_bf16_serial
+SIMSIMD_MAKE_DEQUANTIZE(serial, i8, SIMSIMD_DEREFERENCE)   // simsimd_dequantize_i8_serial
+SIMSIMD_MAKE_DEQUANTIZE(serial, u8, SIMSIMD_DEREFERENCE)   // simsimd_dequantize_u8_serial
+
+SIMSIMD_PUBLIC void simsimd_quantize_b8_serial(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                               simsimd_b8_t *result) {
+    // The first scalar goes into the most significant bit, matching `numpy.packbits`
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    for (simsimd_size_t i = 0; i < n; i += 8) {
+        simsimd_b8_t byte = 0;
+        for (simsimd_size_t j = 0; j != 8 && i + j < n; ++j)
+            byte |= (simsimd_b8_t)((alpha_f32 * a[i + j] > 0) << (7 - j));
+        result[i / 8] = byte;
+    }
+}
+
 /*  SIMD-powered backends for Arm NEON, mostly using 32-bit arithmetic over 128-bit words.
  *  By far the most portable backend, covering most Arm v8 devices, over a billion phones, and almost all
  *  server CPUs produced before 2023.
@@ -176,6 +363,41 @@ SIMSIMD_PUBLIC void simsimd_fma_i8_neon(                                 //
     simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_i8_t const *c, //
     simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t *result);
 
+SIMSIMD_PUBLIC void simsimd_scale_f32_neon(   //
+    simsimd_f32_t const *a, simsimd_size_t n, //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t *result);
+
+SIMSIMD_PUBLIC void simsimd_add_f32_neon(                             //
+    simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n, //
+    simsimd_f32_t *result);
+
+SIMSIMD_PUBLIC void simsimd_multiply_f32_neon(                        //
+    simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n, //
+    simsimd_f32_t *result);
+
+SIMSIMD_PUBLIC void simsimd_quantize_f16_neon( //
+    simsimd_f32_t const *a, simsimd_size_t n,  //
+    simsimd_distance_t alpha, simsimd_f16_t *result);
+SIMSIMD_PUBLIC void simsimd_quantize_i8_neon( //
+    simsimd_f32_t const *a, simsimd_size_t n, //
+    simsimd_distance_t alpha, simsimd_i8_t *result);
+SIMSIMD_PUBLIC void simsimd_quantize_u8_neon( //
+    simsimd_f32_t const *a, simsimd_size_t n, //
+    simsimd_distance_t alpha, simsimd_u8_t *result);
+SIMSIMD_PUBLIC void simsimd_quantize_b8_neon( //
+    simsimd_f32_t const *a, simsimd_size_t n, //
+    simsimd_distance_t alpha, simsimd_b8_t *result);
+
+SIMSIMD_PUBLIC void simsimd_dequantize_f16_neon( //
+    simsimd_f16_t const *a, simsimd_size_t n,    //
+    simsimd_distance_t alpha, simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_dequantize_i8_neon( //
+    simsimd_i8_t const *a, simsimd_size_t n,    //
+    simsimd_distance_t alpha, simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_dequantize_u8_neon( //
+    simsimd_u8_t const *a, simsimd_size_t n,    //
+    simsimd_distance_t alpha, simsimd_f32_t *result);
+
 /*  SIMD-powered backends for AVX2 CPUs of Haswell generation and newer, using 32-bit arithmetic over 256-bit words.
  *  First demonstrated in 2011, at least one Haswell-based processor was still being sold in 2022 — the Pentium G3420.
  *  Practically all modern x86 CPUs support AVX2, FMA, and F16C, making it a perfect baseline for SIMD algorithms.
@@ -219,6 +441,74 @@ SIMSIMD_PUBLIC void simsimd_fma_u8_haswell(
     simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_u8_t const *c, simsimd_size_t n, //
     simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_u8_t *result);
 
+SIMSIMD_PUBLIC void simsimd_scale_f64_haswell( //
+    simsimd_f64_t const *a, simsimd_size_t n,  //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t *result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_haswell( //
+    simsimd_f32_t const *a, simsimd_size_t n,  //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_scale_f16_haswell( //
+    simsimd_f16_t const *a, simsimd_size_t n,  //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t *result);
+SIMSIMD_PUBLIC void simsimd_scale_bf16_haswell( //
+    simsimd_bf16_t const *a, simsimd_size_t n,  //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t *result);
+
+SIMSIMD_PUBLIC void simsimd_add_f64_haswell(                          //
+    simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n, //
+    simsimd_f64_t *result);
+SIMSIMD_PUBLIC void simsimd_add_f32_haswell(                          //
+    simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n, //
+    simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_add_f16_haswell(                          //
+    simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n, //
+    simsimd_f16_t *result);
+SIMSIMD_PUBLIC void simsimd_add_bf16_haswell(                           //
+    simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n, //
+    simsimd_bf16_t *result);
+
+SIMSIMD_PUBLIC void simsimd_multiply_f64_haswell(                     //
+    simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n, //
+    simsimd_f64_t *result);
+SIMSIMD_PUBLIC void simsimd_multiply_f32_haswell(                     //
+    simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n, //
+    simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_multiply_f16_haswell(                     //
+    simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n, //
+    simsimd_f16_t *result);
+SIMSIMD_PUBLIC void simsimd_multiply_bf16_haswell(                      //
+    simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n, //
+    simsimd_bf16_t *result);
+
+SIMSIMD_PUBLIC void simsimd_quantize_f16_haswell( //
+    simsimd_f32_t const *a, simsimd_size_t n,     //
+    simsimd_distance_t alpha, simsimd_f16_t *result);
+SIMSIMD_PUBLIC void simsimd_quantize_bf16_haswell( //
+    simsimd_f32_t const *a, simsimd_size_t n,      //
+    simsimd_distance_t alpha, simsimd_bf16_t *result);
+SIMSIMD_PUBLIC void simsimd_quantize_i8_haswell( //
+    simsimd_f32_t const *a, simsimd_size_t n,    //
+    simsimd_distance_t alpha, simsimd_i8_t *result);
+SIMSIMD_PUBLIC void simsimd_quantize_u8_haswell( //
+    simsimd_f32_t const *a, simsimd_size_t n,    //
+    simsimd_distance_t alpha, simsimd_u8_t *result);
+SIMSIMD_PUBLIC void simsimd_quantize_b8_haswell( //
+    simsimd_f32_t const *a, simsimd_size_t n,    //
+    simsimd_distance_t alpha, simsimd_b8_t *result);
+
+SIMSIMD_PUBLIC void simsimd_dequantize_f16_haswell( //
+    simsimd_f16_t const *a, simsimd_size_t n,       //
+    simsimd_distance_t alpha, simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_dequantize_bf16_haswell( //
+    simsimd_bf16_t const *a, simsimd_size_t n,       //
+    simsimd_distance_t alpha, simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_dequantize_i8_haswell( //
+    simsimd_i8_t const *a, simsimd_size_t n,       //
+    simsimd_distance_t alpha, simsimd_f32_t *result);
+SIMSIMD_PUBLIC void simsimd_dequantize_u8_haswell( //
+    simsimd_u8_t const *a, simsimd_size_t n,       //
+    simsimd_distance_t alpha, simsimd_f32_t *result);
+
 /*  SIMD-powered backends for various generations of AVX512 CPUs.
  *  Unlike the distance metrics, the SIMD implementation of FMA and WSum benefits from aligned stores.
  *  Assuming the size of ZMM register matches the width of the cache line, we skip the unaligned head
@@ -244,6 +534,27 @@ SIMSIMD_PUBLIC void simsimd_fma_bf16_skylake(
     simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_bf16_t const *c, simsimd_size_t n, //
     simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t *result);
 
+SIMSIMD_PUBLIC void simsimd_scale_f64_skylake( //
+    simsimd_f64_t const *a, simsimd_size_t n,  //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t *result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_skylake( //
+    simsimd_f32_t const *a, simsimd_size_t n,  //
+    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t *result);
+
+SIMSIMD_PUBLIC void simsimd_add_f64_skylake(                          //
+    simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n, //
+    simsimd_f64_t *result);
+SIMSIMD_PUBLIC void simsimd_add_f32_skylake(                          //
+    simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n, //
+    simsimd_f32_t *result);
+
+SIMSIMD_PUBLIC void simsimd_multiply_f64_skylake(                     //
+    simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n, //
+    simsimd_f64_t *result);
+SIMSIMD_PUBLIC void simsimd_multiply_f32_skylake(                     //
+    simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n, //
+    simsimd_f32_t *result);
+
 SIMSIMD_PUBLIC void simsimd_wsum_f16_sapphire(                        //
     simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n, //
     simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t *result);
@@ -706,6 +1017,395 @@ SIMSIMD_PUBLIC void simsimd_fma_u8_haswell(
     }
 }
 
+SIMSIMD_PUBLIC void simsimd_scale_f32_haswell(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f32_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    simsimd_f32_t beta_f32 = (simsimd_f32_t)beta;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+    __m256 beta_vec = _mm256_set1_ps(beta_f32);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_loadu_ps(a + i);
+        __m256 scaled_vec = _mm256_fmadd_ps(a_vec, alpha_vec, beta_vec);
+        _mm256_storeu_ps(result + i, scaled_vec);
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = alpha_f32 * a[i] + beta_f32;
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f64_haswell(simsimd_f64_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f64_t *result) {
+    __m256d alpha_vec = _mm256_set1_pd(alpha);
+    __m256d beta_vec = _mm256_set1_pd(beta);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d a_vec = _mm256_loadu_pd(a + i);
+        __m256d scaled_vec = _mm256_fmadd_pd(a_vec, alpha_vec, beta_vec);
+        _mm256_storeu_pd(result + i, scaled_vec);
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = alpha * a[i] + beta;
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f16_haswell(simsimd_f16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f16_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    simsimd_f32_t beta_f32 = (simsimd_f32_t)beta;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+    __m256 beta_vec = _mm256_set1_ps(beta_f32);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const *)(a + i)));
+        __m256 scaled_vec = _mm256_fmadd_ps(a_vec, alpha_vec, beta_vec);
+        __m128i scaled_f16 = _mm256_cvtps_ph(scaled_vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128((__m128i *)(result + i), scaled_f16);
+    }
+
+    // The tail:
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_F16_TO_F32(a + i);
+        SIMSIMD_F32_TO_F16(alpha_f32 * ai + beta_f32, result + i);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_bf16_haswell(simsimd_bf16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                               simsimd_distance_t beta, simsimd_bf16_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    simsimd_f32_t beta_f32 = (simsimd_f32_t)beta;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+    __m256 beta_vec = _mm256_set1_ps(beta_f32);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _simsimd_bf16x8_to_f32x8_haswell(_mm_loadu_si128((__m128i const *)(a + i)));
+        __m256 scaled_vec = _mm256_fmadd_ps(a_vec, alpha_vec, beta_vec);
+        _mm_storeu_si128((__m128i *)(result + i), _simsimd_f32x8_to_bf16x8_haswell(scaled_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_BF16_TO_F32(a + i);
+        SIMSIMD_F32_TO_BF16(alpha_f32 * ai + beta_f32, result + i);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_add_f32_haswell(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                            simsimd_f32_t *result) {
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_loadu_ps(a + i);
+        __m256 b_vec = _mm256_loadu_ps(b + i);
+        _mm256_storeu_ps(result + i, _mm256_add_ps(a_vec, b_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = a[i] + b[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_add_f64_haswell(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                            simsimd_f64_t *result) {
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d a_vec = _mm256_loadu_pd(a + i);
+        __m256d b_vec = _mm256_loadu_pd(b + i);
+        _mm256_storeu_pd(result + i, _mm256_add_pd(a_vec, b_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = a[i] + b[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_add_f16_haswell(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
+                                            simsimd_f16_t *result) {
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const *)(a + i)));
+        __m256 b_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const *)(b + i)));
+        __m128i sum_f16 = _mm256_cvtps_ph(_mm256_add_ps(a_vec, b_vec), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128((__m128i *)(result + i), sum_f16);
+    }
+
+    // The tail:
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_F16_TO_F32(a + i);
+        simsimd_f32_t bi = SIMSIMD_F16_TO_F32(b + i);
+        SIMSIMD_F32_TO_F16(ai + bi, result + i);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_add_bf16_haswell(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
+                                             simsimd_bf16_t *result) {
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _simsimd_bf16x8_to_f32x8_haswell(_mm_loadu_si128((__m128i const *)(a + i)));
+        __m256 b_vec = _simsimd_bf16x8_to_f32x8_haswell(_mm_loadu_si128((__m128i const *)(b + i)));
+        _mm_storeu_si128((__m128i *)(result + i), _simsimd_f32x8_to_bf16x8_haswell(_mm256_add_ps(a_vec, b_vec)));
+    }
+
+    // The tail:
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_BF16_TO_F32(a + i);
+        simsimd_f32_t bi = SIMSIMD_BF16_TO_F32(b + i);
+        SIMSIMD_F32_TO_BF16(ai + bi, result + i);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_f32_haswell(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                                 simsimd_f32_t *result) {
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_loadu_ps(a + i);
+        __m256 b_vec = _mm256_loadu_ps(b + i);
+        _mm256_storeu_ps(result + i, _mm256_mul_ps(a_vec, b_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = a[i] * b[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_f64_haswell(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                                 simsimd_f64_t *result) {
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d a_vec = _mm256_loadu_pd(a + i);
+        __m256d b_vec = _mm256_loadu_pd(b + i);
+        _mm256_storeu_pd(result + i, _mm256_mul_pd(a_vec, b_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = a[i] * b[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_f16_haswell(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
+                                                 simsimd_f16_t *result) {
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const *)(a + i)));
+        __m256 b_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const *)(b + i)));
+        __m128i product_f16 =
+            _mm256_cvtps_ph(_mm256_mul_ps(a_vec, b_vec), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128((__m128i *)(result + i), product_f16);
+    }
+
+    // The tail:
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_F16_TO_F32(a + i);
+        simsimd_f32_t bi = SIMSIMD_F16_TO_F32(b + i);
+        SIMSIMD_F32_TO_F16(ai * bi, result + i);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_bf16_haswell(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
+                                                  simsimd_bf16_t *result) {
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _simsimd_bf16x8_to_f32x8_haswell(_mm_loadu_si128((__m128i const *)(a + i)));
+        __m256 b_vec = _simsimd_bf16x8_to_f32x8_haswell(_mm_loadu_si128((__m128i const *)(b + i)));
+        _mm_storeu_si128((__m128i *)(result + i), _simsimd_f32x8_to_bf16x8_haswell(_mm256_mul_ps(a_vec, b_vec)));
+    }
+
+    // The tail:
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = SIMSIMD_BF16_TO_F32(a + i);
+        simsimd_f32_t bi = SIMSIMD_BF16_TO_F32(b + i);
+        SIMSIMD_F32_TO_BF16(ai * bi, result + i);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_f16_haswell(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                 simsimd_f16_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_mul_ps(_mm256_loadu_ps(a + i), alpha_vec);
+        __m128i a_f16 = _mm256_cvtps_ph(a_vec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128((__m128i *)(result + i), a_f16);
+    }
+
+    // The tail:
+    for (; i < n; ++i) SIMSIMD_F32_TO_F16(alpha_f32 * a[i], result + i);
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_bf16_haswell(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                  simsimd_bf16_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+    // Unlike the arithmetic kernels, round the dropped half of the mantissa, matching `simsimd_f32_to_bf16`
+    __m256i rounding_vec = _mm256_set1_epi32(0x8000);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_mul_ps(_mm256_loadu_ps(a + i), alpha_vec);
+        a_vec = _mm256_castsi256_ps(_mm256_add_epi32(_mm256_castps_si256(a_vec), rounding_vec));
+        _mm_storeu_si128((__m128i *)(result + i), _simsimd_f32x8_to_bf16x8_haswell(a_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) SIMSIMD_F32_TO_BF16(alpha_f32 * a[i], result + i);
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_i8_haswell(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                simsimd_i8_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+    __m256 min_vec = _mm256_set1_ps(-128), max_vec = _mm256_set1_ps(127);
+    // Packing instructions interleave the 128-bit lanes, so the 32-bit words have to be reordered at the end
+    __m256i order_vec = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    // The main loop, clamping before the conversion, as out-of-range floats become `INT_MIN`:
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256 a0_vec =
+            _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(a + i), alpha_vec), min_vec), max_vec);
+        __m256 a1_vec =
+            _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(a + i + 8), alpha_vec), min_vec), max_vec);
+        __m256 a2_vec =
+            _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(a + i + 16), alpha_vec), min_vec), max_vec);
+        __m256 a3_vec =
+            _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(a + i + 24), alpha_vec), min_vec), max_vec);
+        __m256i a01_i16_vec = _mm256_packs_epi32(_mm256_cvtps_epi32(a0_vec), _mm256_cvtps_epi32(a1_vec));
+        __m256i a23_i16_vec = _mm256_packs_epi32(_mm256_cvtps_epi32(a2_vec), _mm256_cvtps_epi32(a3_vec));
+        __m256i a_i8_vec = _mm256_packs_epi16(a01_i16_vec, a23_i16_vec);
+        _mm256_storeu_si256((__m256i *)(result + i), _mm256_permutevar8x32_epi32(a_i8_vec, order_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) SIMSIMD_F32_TO_I8(alpha_f32 * a[i], result + i);
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_u8_haswell(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                simsimd_u8_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+    __m256 min_vec = _mm256_setzero_ps(), max_vec = _mm256_set1_ps(255);
+    __m256i order_vec = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    // The main loop, mirroring `simsimd_quantize_i8_haswell` with an unsigned final pack:
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256 a0_vec =
+            _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(a + i), alpha_vec), min_vec), max_vec);
+        __m256 a1_vec =
+            _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(a + i + 8), alpha_vec), min_vec), max_vec);
+        __m256 a2_vec =
+            _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(a + i + 16), alpha_vec), min_vec), max_vec);
+        __m256 a3_vec =
+            _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(a + i + 24), alpha_vec), min_vec), max_vec);
+        __m256i a01_i16_vec = _mm256_packs_epi32(_mm256_cvtps_epi32(a0_vec), _mm256_cvtps_epi32(a1_vec));
+        __m256i a23_i16_vec = _mm256_packs_epi32(_mm256_cvtps_epi32(a2_vec), _mm256_cvtps_epi32(a3_vec));
+        __m256i a_u8_vec = _mm256_packus_epi16(a01_i16_vec, a23_i16_vec);
+        _mm256_storeu_si256((__m256i *)(result + i), _mm256_permutevar8x32_epi32(a_u8_vec, order_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) SIMSIMD_F32_TO_U8(alpha_f32 * a[i], result + i);
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_b8_haswell(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                simsimd_b8_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+    __m256 zeros_vec = _mm256_setzero_ps();
+    // The first scalar goes into the most significant bit, so the lanes are reversed before the `movemask`
+    __m256i reverse_vec = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_mul_ps(_mm256_loadu_ps(a + i), alpha_vec);
+        __m256 positive_vec = _mm256_cmp_ps(a_vec, zeros_vec, _CMP_GT_OQ);
+        result[i / 8] = (simsimd_b8_t)_mm256_movemask_ps(_mm256_permutevar8x32_ps(positive_vec, reverse_vec));
+    }
+
+    // The tail:
+    if (i < n) simsimd_quantize_b8_serial(a + i, n - i, alpha, result + i / 8);
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_f16_haswell(simsimd_f16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                   simsimd_f32_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_cvtph_ps(_mm_loadu_si128((__m128i const *)(a + i)));
+        _mm256_storeu_ps(result + i, _mm256_mul_ps(a_vec, alpha_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = alpha_f32 * SIMSIMD_F16_TO_F32(a + i);
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_bf16_haswell(simsimd_bf16_t const *a, simsimd_size_t n,
+                                                    simsimd_distance_t alpha, simsimd_f32_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _simsimd_bf16x8_to_f32x8_haswell(_mm_loadu_si128((__m128i const *)(a + i)));
+        _mm256_storeu_ps(result + i, _mm256_mul_ps(a_vec, alpha_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = alpha_f32 * SIMSIMD_BF16_TO_F32(a + i);
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_i8_haswell(simsimd_i8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                  simsimd_f32_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i a_i32_vec = _mm256_cvtepi8_epi32(_mm_loadl_epi64((__m128i const *)(a + i)));
+        _mm256_storeu_ps(result + i, _mm256_mul_ps(_mm256_cvtepi32_ps(a_i32_vec), alpha_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = alpha_f32 * a[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_u8_haswell(simsimd_u8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                  simsimd_f32_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i a_i32_vec = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i const *)(a + i)));
+        _mm256_storeu_ps(result + i, _mm256_mul_ps(_mm256_cvtepi32_ps(a_i32_vec), alpha_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = alpha_f32 * a[i];
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_HASWELL
@@ -895,6 +1595,140 @@ simsimd_fma_bf16_skylake_cycle:
     if (n) goto simsimd_fma_bf16_skylake_cycle;
 }
 
+SIMSIMD_PUBLIC void simsimd_scale_f64_skylake(simsimd_f64_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f64_t *result) {
+    __m512d alpha_vec = _mm512_set1_pd(alpha);
+    __m512d beta_vec = _mm512_set1_pd(beta);
+    __m512d a_vec, scaled_vec;
+    __mmask8 mask = 0xFF;
+
+simsimd_scale_f64_skylake_cycle:
+    if (n < 8) {
+        mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        n = 0;
+    }
+    else {
+        a_vec = _mm512_loadu_pd(a);
+        a += 8, n -= 8;
+    }
+    scaled_vec = _mm512_fmadd_pd(a_vec, alpha_vec, beta_vec);
+    _mm512_mask_storeu_pd(result, mask, scaled_vec);
+    result += 8;
+    if (n) goto simsimd_scale_f64_skylake_cycle;
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f32_skylake(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f32_t *result) {
+    __m512 alpha_vec = _mm512_set1_ps(alpha);
+    __m512 beta_vec = _mm512_set1_ps(beta);
+    __m512 a_vec, scaled_vec;
+    __mmask16 mask = 0xFFFF;
+
+simsimd_scale_f32_skylake_cycle:
+    if (n < 16) {
+        mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_ps(mask, a);
+        n = 0;
+    }
+    else {
+        a_vec = _mm512_loadu_ps(a);
+        a += 16, n -= 16;
+    }
+    scaled_vec = _mm512_fmadd_ps(a_vec, alpha_vec, beta_vec);
+    _mm512_mask_storeu_ps(result, mask, scaled_vec);
+    result += 16;
+    if (n) goto simsimd_scale_f32_skylake_cycle;
+}
+
+SIMSIMD_PUBLIC void simsimd_add_f64_skylake(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                            simsimd_f64_t *result) {
+    __m512d a_vec, b_vec;
+    __mmask8 mask = 0xFF;
+
+simsimd_add_f64_skylake_cycle:
+    if (n < 8) {
+        mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        b_vec = _mm512_maskz_loadu_pd(mask, b);
+        n = 0;
+    }
+    else {
+        a_vec = _mm512_loadu_pd(a);
+        b_vec = _mm512_loadu_pd(b);
+        a += 8, b += 8, n -= 8;
+    }
+    _mm512_mask_storeu_pd(result, mask, _mm512_add_pd(a_vec, b_vec));
+    result += 8;
+    if (n) goto simsimd_add_f64_skylake_cycle;
+}
+
+SIMSIMD_PUBLIC void simsimd_add_f32_skylake(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                            simsimd_f32_t *result) {
+    __m512 a_vec, b_vec;
+    __mmask16 mask = 0xFFFF;
+
+simsimd_add_f32_skylake_cycle:
+    if (n < 16) {
+        mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_ps(mask, a);
+        b_vec = _mm512_maskz_loadu_ps(mask, b);
+        n = 0;
+    }
+    else {
+        a_vec = _mm512_loadu_ps(a);
+        b_vec = _mm512_loadu_ps(b);
+        a += 16, b += 16, n -= 16;
+    }
+    _mm512_mask_storeu_ps(result, mask, _mm512_add_ps(a_vec, b_vec));
+    result += 16;
+    if (n) goto simsimd_add_f32_skylake_cycle;
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_f64_skylake(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                                 simsimd_f64_t *result) {
+    __m512d a_vec, b_vec;
+    __mmask8 mask = 0xFF;
+
+simsimd_multiply_f64_skylake_cycle:
+    if (n < 8) {
+        mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        b_vec = _mm512_maskz_loadu_pd(mask, b);
+        n = 0;
+    }
+    else {
+        a_vec = _mm512_loadu_pd(a);
+        b_vec = _mm512_loadu_pd(b);
+        a += 8, b += 8, n -= 8;
+    }
+    _mm512_mask_storeu_pd(result, mask, _mm512_mul_pd(a_vec, b_vec));
+    result += 8;
+    if (n) goto simsimd_multiply_f64_skylake_cycle;
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_f32_skylake(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                                 simsimd_f32_t *result) {
+    __m512 a_vec, b_vec;
+    __mmask16 mask = 0xFFFF;
+
+simsimd_multiply_f32_skylake_cycle:
+    if (n < 16) {
+        mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_ps(mask, a);
+        b_vec = _mm512_maskz_loadu_ps(mask, b);
+        n = 0;
+    }
+    else {
+        a_vec = _mm512_loadu_ps(a);
+        b_vec = _mm512_loadu_ps(b);
+        a += 16, b += 16, n -= 16;
+    }
+    _mm512_mask_storeu_ps(result, mask, _mm512_mul_ps(a_vec, b_vec));
+    result += 16;
+    if (n) goto simsimd_multiply_f32_skylake_cycle;
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_SKYLAKE
@@ -1214,6 +2048,134 @@ SIMSIMD_PUBLIC void simsimd_fma_f32_neon(                                   //
     for (; i < n; ++i) result[i] = alpha_f32 * a[i] * b[i] + beta_f32 * c[i];
 }
 
+SIMSIMD_PUBLIC void simsimd_scale_f32_neon(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                           simsimd_distance_t beta, simsimd_f32_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    simsimd_f32_t beta_f32 = (simsimd_f32_t)beta;
+    float32x4_t beta_vec = vdupq_n_f32(beta_f32);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vld1q_f32(a + i);
+        vst1q_f32(result + i, vfmaq_n_f32(beta_vec, a_vec, alpha_f32));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = alpha_f32 * a[i] + beta_f32;
+}
+
+SIMSIMD_PUBLIC void simsimd_add_f32_neon(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                         simsimd_f32_t *result) {
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) vst1q_f32(result + i, vaddq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+
+    // The tail:
+    for (; i < n; ++i) result[i] = a[i] + b[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_f32_neon(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                              simsimd_f32_t *result) {
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) vst1q_f32(result + i, vmulq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+
+    // The tail:
+    for (; i < n; ++i) result[i] = a[i] * b[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_i8_neon(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                             simsimd_i8_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+
+    // The main loop, where `vcvtaq` rounds half away from zero, like `roundf`, and the narrowing moves saturate:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        int32x4_t low_i32_vec = vcvtaq_s32_f32(vmulq_n_f32(vld1q_f32(a + i), alpha_f32));
+        int32x4_t high_i32_vec = vcvtaq_s32_f32(vmulq_n_f32(vld1q_f32(a + i + 4), alpha_f32));
+        int16x8_t a_i16_vec = vcombine_s16(vqmovn_s32(low_i32_vec), vqmovn_s32(high_i32_vec));
+        vst1_s8(result + i, vqmovn_s16(a_i16_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) SIMSIMD_F32_TO_I8(alpha_f32 * a[i], result + i);
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_u8_neon(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                             simsimd_u8_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+
+    // The main loop, where negative inputs saturate to zero in the unsigned conversion:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint32x4_t low_u32_vec = vcvtaq_u32_f32(vmulq_n_f32(vld1q_f32(a + i), alpha_f32));
+        uint32x4_t high_u32_vec = vcvtaq_u32_f32(vmulq_n_f32(vld1q_f32(a + i + 4), alpha_f32));
+        uint16x8_t a_u16_vec = vcombine_u16(vqmovn_u32(low_u32_vec), vqmovn_u32(high_u32_vec));
+        vst1_u8(result + i, vqmovn_u16(a_u16_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) SIMSIMD_F32_TO_U8(alpha_f32 * a[i], result + i);
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_b8_neon(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                             simsimd_b8_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+    // The first scalar goes into the most significant bit, so every lane is masked with its own weight
+    simsimd_u32_t const low_weights[4] = {128, 64, 32, 16}, high_weights[4] = {8, 4, 2, 1};
+    uint32x4_t low_weights_vec = vld1q_u32(low_weights), high_weights_vec = vld1q_u32(high_weights);
+    float32x4_t zeros_vec = vdupq_n_f32(0);
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint32x4_t low_vec = vcgtq_f32(vmulq_n_f32(vld1q_f32(a + i), alpha_f32), zeros_vec);
+        uint32x4_t high_vec = vcgtq_f32(vmulq_n_f32(vld1q_f32(a + i + 4), alpha_f32), zeros_vec);
+        uint32x4_t bits_vec = vorrq_u32(vandq_u32(low_vec, low_weights_vec), vandq_u32(high_vec, high_weights_vec));
+        result[i / 8] = (simsimd_b8_t)vaddvq_u32(bits_vec);
+    }
+
+    // The tail:
+    if (i < n) simsimd_quantize_b8_serial(a + i, n - i, alpha, result + i / 8);
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_i8_neon(simsimd_i8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                               simsimd_f32_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        int16x8_t a_i16_vec = vmovl_s8(vld1_s8(a + i));
+        float32x4_t low_vec = vcvtq_f32_s32(vmovl_s16(vget_low_s16(a_i16_vec)));
+        float32x4_t high_vec = vcvtq_f32_s32(vmovl_s16(vget_high_s16(a_i16_vec)));
+        vst1q_f32(result + i, vmulq_n_f32(low_vec, alpha_f32));
+        vst1q_f32(result + i + 4, vmulq_n_f32(high_vec, alpha_f32));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = alpha_f32 * a[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_u8_neon(simsimd_u8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                               simsimd_f32_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint16x8_t a_u16_vec = vmovl_u8(vld1_u8(a + i));
+        float32x4_t low_vec = vcvtq_f32_u32(vmovl_u16(vget_low_u16(a_u16_vec)));
+        float32x4_t high_vec = vcvtq_f32_u32(vmovl_u16(vget_high_u16(a_u16_vec)));
+        vst1q_f32(result + i, vmulq_n_f32(low_vec, alpha_f32));
+        vst1q_f32(result + i + 4, vmulq_n_f32(high_vec, alpha_f32));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = alpha_f32 * a[i];
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_NEON
@@ -1425,6 +2387,36 @@ SIMSIMD_PUBLIC void simsimd_fma_i8_neon(                                 //
     for (; i < n; ++i) { SIMSIMD_F32_TO_I8(alpha_f16 * a[i] * b[i] + beta_f16 * c[i], result + i); }
 }
 
+SIMSIMD_PUBLIC void simsimd_quantize_f16_neon(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_f16_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vmulq_n_f32(vld1q_f32(a + i), alpha_f32);
+        vst1_f16((float16_t *)result + i, vcvt_f16_f32(a_vec));
+    }
+
+    // The tail:
+    for (; i < n; ++i) ((float16_t *)result)[i] = (float16_t)(alpha_f32 * a[i]);
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_f16_neon(simsimd_f16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                simsimd_f32_t *result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha;
+
+    // The main loop:
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vcvt_f32_f16(vld1_f16((float16_t const *)a + i));
+        vst1q_f32(result + i, vmulq_n_f32(a_vec, alpha_f32));
+    }
+
+    // The tail:
+    for (; i < n; ++i) result[i] = alpha_f32 * ((float16_t const *)a)[i];
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_NEON_F16
@@ -6,6 +6,7 @@
  *
  *  Contains:
  *  - Haversine (Great Circle) distance
+ *  - Haversine of the central angle, monotonic in the Great Circle distance
  *  - Vincenty's distance function for Oblate Spheroid Geodesics
  *
  *  For datatypes:
@@ -20,7 +21,14 @@
  *  The very last part of the computation applies `asin(sqrt(x))` non-linear transformation.
  *  Both `asin` and `sqrt` are monotonically increasing functions, so their product is also
  *  monotonically increasing. This means, for relative similarity/closeness computation we
- *  can avoid that expensive last step.
+ *  can avoid that expensive last step. That's what the `simsimd_hav_*` kernels do.
+ *
+ *  All kernels take coordinates in radians in a Structure-of-Arrays layout: four arrays of `n` latitudes
+ *  and longitudes for the first and second points of each pair, producing `n` results.
+ *  The Haversine distance assumes a sphere with the mean Earth radius, the Vincenty distance - the WGS-84
+ *  ellipsoid, both returning meters. The serial backends rely on `SIMSIMD_SIN`, `SIMSIMD_COS`, and
+ *  `SIMSIMD_ATAN2`, which default to the C standard library. The SIMD backends use polynomial approximations
+ *  with Cody-Waite range reduction, accurate to a few ULPs in the range of valid coordinates.
  *
  *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
  *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
@@ -36,6 +44,770 @@
 extern "C" {
 #endif
 
+// clang-format off
+
+/*  Serial backends for both numeric types, computing in double precision.
+ */
+SIMSIMD_PUBLIC void simsimd_hav_f64_serial(simsimd_f64_t const* a_lats, simsimd_f64_t const* a_lons, simsimd_f64_t const* b_lats, simsimd_f64_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_haversine_f64_serial(simsimd_f64_t const* a_lats, simsimd_f64_t const* a_lons, simsimd_f64_t const* b_lats, simsimd_f64_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_vincenty_f64_serial(simsimd_f64_t const* a_lats, simsimd_f64_t const* a_lons, simsimd_f64_t const* b_lats, simsimd_f64_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_hav_f32_serial(simsimd_f32_t const* a_lats, simsimd_f32_t const* a_lons, simsimd_f32_t const* b_lats, simsimd_f32_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_haversine_f32_serial(simsimd_f32_t const* a_lats, simsimd_f32_t const* a_lons, simsimd_f32_t const* b_lats, simsimd_f32_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_vincenty_f32_serial(simsimd_f32_t const* a_lats, simsimd_f32_t const* a_lons, simsimd_f32_t const* b_lats, simsimd_f32_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+
+/*  SIMD-powered backends for Arm NEON, mostly using 64-bit arithmetic over 128-bit words.
+ *  By far the most portable backend, covering most Arm v8 devices, over a billion iPhones, and almost all
+ *  server CPUs produced before 2023.
+ */
+SIMSIMD_PUBLIC void simsimd_hav_f64_neon(simsimd_f64_t const* a_lats, simsimd_f64_t const* a_lons, simsimd_f64_t const* b_lats, simsimd_f64_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_haversine_f64_neon(simsimd_f64_t const* a_lats, simsimd_f64_t const* a_lons, simsimd_f64_t const* b_lats, simsimd_f64_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_vincenty_f64_neon(simsimd_f64_t const* a_lats, simsimd_f64_t const* a_lons, simsimd_f64_t const* b_lats, simsimd_f64_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_hav_f32_neon(simsimd_f32_t const* a_lats, simsimd_f32_t const* a_lons, simsimd_f32_t const* b_lats, simsimd_f32_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_haversine_f32_neon(simsimd_f32_t const* a_lats, simsimd_f32_t const* a_lons, simsimd_f32_t const* b_lats, simsimd_f32_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_vincenty_f32_neon(simsimd_f32_t const* a_lats, simsimd_f32_t const* a_lons, simsimd_f32_t const* b_lats, simsimd_f32_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+
+/*  SIMD-powered backends for AVX2 CPUs of Haswell generation and newer, using 32-bit arithmetic over 256-bit words.
+ *  First demonstrated in 2011, at least one Haswell-based processor was still being sold in 2022 — the Pentium G3420.
+ *  Practically all modern x86 CPUs support AVX2, FMA, and F16C, making it a perfect baseline for SIMD algorithms.
+ *  The Vincenty kernels always compute in double precision, as its iterative solution diverges in single precision.
+ */
+SIMSIMD_PUBLIC void simsimd_hav_f64_haswell(simsimd_f64_t const* a_lats, simsimd_f64_t const* a_lons, simsimd_f64_t const* b_lats, simsimd_f64_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_haversine_f64_haswell(simsimd_f64_t const* a_lats, simsimd_f64_t const* a_lons, simsimd_f64_t const* b_lats, simsimd_f64_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_vincenty_f64_haswell(simsimd_f64_t const* a_lats, simsimd_f64_t const* a_lons, simsimd_f64_t const* b_lats, simsimd_f64_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_hav_f32_haswell(simsimd_f32_t const* a_lats, simsimd_f32_t const* a_lons, simsimd_f32_t const* b_lats, simsimd_f32_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_haversine_f32_haswell(simsimd_f32_t const* a_lats, simsimd_f32_t const* a_lons, simsimd_f32_t const* b_lats, simsimd_f32_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_vincenty_f32_haswell(simsimd_f32_t const* a_lats, simsimd_f32_t const* a_lons, simsimd_f32_t const* b_lats, simsimd_f32_t const* b_lons, simsimd_size_t n, simsimd_distance_t* results);
+// clang-format on
+
+/**
+ *  @brief  Mean radius of the Earth in meters, used by the Haversine distance.
+ */
+#if !defined(SIMSIMD_EARTH_RADIUS)
+#define SIMSIMD_EARTH_RADIUS 6371008.8
+#endif
+
+/**
+ *  @brief  Semi-major axis of the WGS-84 ellipsoid in meters, and its flattening, used by the Vincenty distance.
+ */
+#if !defined(SIMSIMD_EARTH_EQUATORIAL_RADIUS)
+#define SIMSIMD_EARTH_EQUATORIAL_RADIUS 6378137.0
+#endif
+#if !defined(SIMSIMD_EARTH_FLATTENING)
+#define SIMSIMD_EARTH_FLATTENING (1 / 298.257223563)
+#endif
+
+/**
+ *  @brief  Maximum number of iterations of the Vincenty inverse solution. It converges in a few iterations
+ *          for most pairs, and the limit only affects nearly antipodal points.
+ */
+#if !defined(SIMSIMD_VINCENTY_ITERATIONS)
+#define SIMSIMD_VINCENTY_ITERATIONS 100
+#endif
+
+#if !defined(SIMSIMD_VINCENTY_EPSILON)
+#define SIMSIMD_VINCENTY_EPSILON 1e-12
+#endif
+
+#define SIMSIMD_MAKE_HAV(name, input_type, accumulator_type)                                                  \
+    SIMSIMD_PUBLIC void simsimd_hav_##input_type##_##name(                                                    \
+        simsimd_##input_type##_t const *a_lats, simsimd_##input_type##_t const *a_lons,                       \
+        simsimd_##input_type##_t const *b_lats, simsimd_##input_type##_t const *b_lons, simsimd_size_t n,     \
+        simsimd_distance_t *results) {                                                                        \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                             \
+            simsimd_##accumulator_type##_t a_lat = a_lats[i], a_lon = a_lons[i];                              \
+            simsimd_##accumulator_type##_t b_lat = b_lats[i], b_lon = b_lons[i];                              \
+            simsimd_##accumulator_type##_t sin_half_lat = SIMSIMD_SIN((b_lat - a_lat) / 2);                   \
+            simsimd_##accumulator_type##_t sin_half_lon = SIMSIMD_SIN((b_lon - a_lon) / 2);                   \
+            results[i] = sin_half_lat * sin_half_lat +                                                        \
+                         SIMSIMD_COS(a_lat) * SIMSIMD_COS(b_lat) * sin_half_lon * sin_half_lon;               \
+        }                                                                                                     \
+    }
+
+#define SIMSIMD_MAKE_HAVERSINE(name, input_type, accumulator_type)                                            \
+    SIMSIMD_PUBLIC void simsimd_haversine_##input_type##_##name(                                              \
+        simsimd_##input_type##_t const *a_lats, simsimd_##input_type##_t const *a_lons,                       \
+        simsimd_##input_type##_t const *b_lats, simsimd_##input_type##_t const *b_lons, simsimd_size_t n,     \
+        simsimd_distance_t *results) {                                                                        \
+        simsimd_hav_##input_type##_##name(a_lats, a_lons, b_lats, b_lons, n, results);                        \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                             \
+            simsimd_distance_t hav = results[i] < 0 ? 0 : results[i] > 1 ? 1 : results[i];                   \
+            results[i] = 2 * SIMSIMD_EARTH_RADIUS * SIMSIMD_ATAN2(SIMSIMD_SQRT(hav), SIMSIMD_SQRT(1 - hav));  \
+        }                                                                                                     \
+    }
+
+/**
+ *  @brief  Vincenty's inverse solution for a single pair of points on the WGS-84 ellipsoid.
+ *  @see    https://en.wikipedia.org/wiki/Vincenty%27s_formulae#Inverse_problem
+ */
+SIMSIMD_INTERNAL simsimd_distance_t _simsimd_vincenty_f64_serial( //
+    simsimd_f64_t a_lat, simsimd_f64_t a_lon, simsimd_f64_t b_lat, simsimd_f64_t b_lon) {
+    simsimd_f64_t const f = SIMSIMD_EARTH_FLATTENING, major = SIMSIMD_EARTH_EQUATORIAL_RADIUS;
+    simsimd_f64_t const minor = (1 - f) * major;
+
+    // Reduced latitudes, avoiding the tangent to stay finite at the poles
+    simsimd_f64_t const a_sin = (1 - f) * SIMSIMD_SIN(a_lat), a_cos = SIMSIMD_COS(a_lat);
+    simsimd_f64_t const b_sin = (1 - f) * SIMSIMD_SIN(b_lat), b_cos = SIMSIMD_COS(b_lat);
+    simsimd_f64_t const a_norm = SIMSIMD_SQRT(a_sin * a_sin + a_cos * a_cos);
+    simsimd_f64_t const b_norm = SIMSIMD_SQRT(b_sin * b_sin + b_cos * b_cos);
+    simsimd_f64_t const sin_u1 = a_sin / a_norm, cos_u1 = a_cos / a_norm;
+    simsimd_f64_t const sin_u2 = b_sin / b_norm, cos_u2 = b_cos / b_norm;
+
+    simsimd_f64_t const l = b_lon - a_lon;
+    simsimd_f64_t lambda = l, sin_sigma = 0, cos_sigma = 1, sigma = 0, cos2_alpha = 1, cos_2sigma_m = 0;
+    for (simsimd_size_t iteration = 0; iteration != SIMSIMD_VINCENTY_ITERATIONS; ++iteration) {
+        simsimd_f64_t const sin_lambda = SIMSIMD_SIN(lambda), cos_lambda = SIMSIMD_COS(lambda);
+        simsimd_f64_t const t1 = cos_u2 * sin_lambda, t2 = cos_u1 * sin_u2 - sin_u1 * cos_u2 * cos_lambda;
+        sin_sigma = SIMSIMD_SQRT(t1 * t1 + t2 * t2);
+        if (sin_sigma == 0) return 0; // Coincident points
+        cos_sigma = sin_u1 * sin_u2 + cos_u1 * cos_u2 * cos_lambda;
+        sigma = SIMSIMD_ATAN2(sin_sigma, cos_sigma);
+        simsimd_f64_t const sin_alpha = cos_u1 * cos_u2 * sin_lambda / sin_sigma;
+        cos2_alpha = 1 - sin_alpha * sin_alpha;
+        cos_2sigma_m = cos2_alpha != 0 ? cos_sigma - 2 * sin_u1 * sin_u2 / cos2_alpha : 0; // Equatorial line
+        simsimd_f64_t const c = f / 16 * cos2_alpha * (4 + f * (4 - 3 * cos2_alpha));
+        simsimd_f64_t const previous = lambda;
+        simsimd_f64_t const inner = cos_2sigma_m + c * cos_sigma * (2 * cos_2sigma_m * cos_2sigma_m - 1);
+        lambda = l + (1 - c) * f * sin_alpha * (sigma + c * sin_sigma * inner);
+        simsimd_f64_t const change = lambda - previous;
+        if (change < SIMSIMD_VINCENTY_EPSILON && change > -SIMSIMD_VINCENTY_EPSILON) break;
+    }
+
+    simsimd_f64_t const u2 = cos2_alpha * (major * major - minor * minor) / (minor * minor);
+    simsimd_f64_t const big_a = 1 + u2 / 16384 * (4096 + u2 * (-768 + u2 * (320 - 175 * u2)));
+    simsimd_f64_t const big_b = u2 / 1024 * (256 + u2 * (-128 + u2 * (74 - 47 * u2)));
+    simsimd_f64_t const cos2 = cos_2sigma_m * cos_2sigma_m;
+    simsimd_f64_t const delta_sigma =
+        big_b * sin_sigma *
+        (cos_2sigma_m + big_b / 4 *
+                            (cos_sigma * (2 * cos2 - 1) -
+                             big_b / 6 * cos_2sigma_m * (4 * sin_sigma * sin_sigma - 3) * (4 * cos2 - 3)));
+    return minor * big_a * (sigma - delta_sigma);
+}
+
+#define SIMSIMD_MAKE_VINCENTY(name, input_type)                                                               \
+    SIMSIMD_PUBLIC void simsimd_vincenty_##input_type##_##name(                                               \
+        simsimd_##input_type##_t const *a_lats, simsimd_##input_type##_t const *a_lons,                       \
+        simsimd_##input_type##_t const *b_lats, simsimd_##input_type##_t const *b_lons, simsimd_size_t n,     \
+        simsimd_distance_t *results) {                                                                        \
+        for (simsimd_size_t i = 0; i != n; ++i)                                                               \
+            results[i] = _simsimd_vincenty_f64_serial(a_lats[i], a_lons[i], b_lats[i], b_lons[i]);            \
+    }
+
+SIMSIMD_MAKE_HAV(serial, f64, f64)       // simsimd_hav_f64_serial
+SIMSIMD_MAKE_HAVERSINE(serial, f64, f64) // simsimd_haversine_f64_serial
+SIMSIMD_MAKE_VINCENTY(serial, f64)       // simsimd_vincenty_f64_serial
+
+SIMSIMD_MAKE_HAV(serial, f32, f64)       // simsimd_hav_f32_serial
+SIMSIMD_MAKE_HAVERSINE(serial, f32, f64) // simsimd_haversine_f32_serial
+SIMSIMD_MAKE_VINCENTY(serial, f32)       // simsimd_vincenty_f32_serial
+
+/*  Coefficients shared by the SIMD backends:
+ *  - `sin` and `cos` on [-pi/4, pi/4] are minimax polynomials from FDLIBM and Cephes.
+ *  - `atan` on [0, 0.66] in double precision is a rational approximation from Cephes,
+ *    and on [0, tan(pi/8)] in single precision - a polynomial from Cephes.
+ *  - Range reduction subtracts a multiple of pi/2 split into several parts, which is exact for |x| < 2^20.
+ */
+#define SIMSIMD_GEO_PI 3.14159265358979323846
+#define SIMSIMD_GEO_PI_2 1.57079632679489661923
+#define SIMSIMD_GEO_PI_4 0.78539816339744830962
+#define SIMSIMD_GEO_2_PI 0.63661977236758134308
+
+#if _SIMSIMD_TARGET_ARM
+#if SIMSIMD_TARGET_NEON
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+simd")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+simd"))), apply_to = function)
+
+/**
+ *  @brief  Computes both the sine and cosine of every lane, reducing the argument by multiples of pi/2.
+ */
+SIMSIMD_INTERNAL void _simsimd_sincos_f64x2_neon(float64x2_t x, float64x2_t *sin_out, float64x2_t *cos_out) {
+    float64x2_t k = vrndnq_f64(vmulq_n_f64(x, SIMSIMD_GEO_2_PI));
+    float64x2_t r = vfmsq_f64(x, k, vdupq_n_f64(1.57079632673412561417e+00));
+    r = vfmsq_f64(r, k, vdupq_n_f64(6.07710050650619224932e-11));
+    float64x2_t z = vmulq_f64(r, r);
+
+    float64x2_t s = vfmaq_f64(vdupq_n_f64(-2.50507602534068634195e-08), z, vdupq_n_f64(1.58969099521155010221e-10));
+    s = vfmaq_f64(vdupq_n_f64(2.75573137070700676789e-06), z, s);
+    s = vfmaq_f64(vdupq_n_f64(-1.98412698298579493134e-04), z, s);
+    s = vfmaq_f64(vdupq_n_f64(8.33333333332248946124e-03), z, s);
+    s = vfmaq_f64(vdupq_n_f64(-1.66666666666666324348e-01), z, s);
+    s = vfmaq_f64(r, vmulq_f64(r, z), s);
+
+    float64x2_t c = vfmaq_f64(vdupq_n_f64(2.08757232129817482790e-09), z, vdupq_n_f64(-1.13596475577881948265e-11));
+    c = vfmaq_f64(vdupq_n_f64(-2.75573143513906633035e-07), z, c);
+    c = vfmaq_f64(vdupq_n_f64(2.48015872894767294178e-05), z, c);
+    c = vfmaq_f64(vdupq_n_f64(-1.38888888888741095749e-03), z, c);
+    c = vfmaq_f64(vdupq_n_f64(4.16666666666666019037e-02), z, c);
+    c = vfmaq_f64(vfmsq_f64(vdupq_n_f64(1), z, vdupq_n_f64(0.5)), vmulq_f64(z, z), c);
+
+    // Odd quadrants swap the sine and cosine, and the sign bits follow the quadrant
+    int64x2_t q = vcvtq_s64_f64(k);
+    uint64x2_t swap = vtstq_s64(q, vdupq_n_s64(1));
+    uint64x2_t sin_sign = vshlq_n_u64(vreinterpretq_u64_s64(vandq_s64(q, vdupq_n_s64(2))), 62);
+    uint64x2_t cos_sign =
+        vshlq_n_u64(vreinterpretq_u64_s64(vandq_s64(vaddq_s64(q, vdupq_n_s64(1)), vdupq_n_s64(2))), 62);
+    float64x2_t sin_r = vbslq_f64(swap, c, s), cos_r = vbslq_f64(swap, s, c);
+    *sin_out = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(sin_r), sin_sign));
+    *cos_out = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(cos_r), cos_sign));
+}
+
+/**
+ *  @brief  Computes the four-quadrant arctangent of `y / x` in every lane.
+ */
+SIMSIMD_INTERNAL float64x2_t _simsimd_atan2_f64x2_neon(float64x2_t y, float64x2_t x) {
+    float64x2_t abs_x = vabsq_f64(x), abs_y = vabsq_f64(y);
+    float64x2_t max_xy = vmaxq_f64(abs_x, abs_y), min_xy = vminq_f64(abs_x, abs_y);
+    uint64x2_t is_zero = vceqzq_f64(max_xy);
+    float64x2_t t = vdivq_f64(min_xy, vbslq_f64(is_zero, vdupq_n_f64(1), max_xy));
+
+    // Reduce [0.66, 1] to [-0.2, 0] with `atan(t) = pi/4 + atan((t - 1) / (t + 1))`
+    uint64x2_t is_big = vcgtq_f64(t, vdupq_n_f64(0.66));
+    float64x2_t one = vdupq_n_f64(1);
+    t = vbslq_f64(is_big, vdivq_f64(vsubq_f64(t, one), vaddq_f64(t, one)), t);
+    float64x2_t z = vmulq_f64(t, t);
+    float64x2_t p = vfmaq_f64(vdupq_n_f64(-1.615753718733365076637e1), z, vdupq_n_f64(-8.750608600031904122785e-1));
+    p = vfmaq_f64(vdupq_n_f64(-7.500855792314704667340e1), z, p);
+    p = vfmaq_f64(vdupq_n_f64(-1.228866684490136173410e2), z, p);
+    p = vfmaq_f64(vdupq_n_f64(-6.485021904942025371773e1), z, p);
+    float64x2_t q = vaddq_f64(z, vdupq_n_f64(2.485846490142306297962e1));
+    q = vfmaq_f64(vdupq_n_f64(1.650270098316988542046e2), z, q);
+    q = vfmaq_f64(vdupq_n_f64(4.328810604912902668951e2), z, q);
+    q = vfmaq_f64(vdupq_n_f64(4.853903996359136964868e2), z, q);
+    q = vfmaq_f64(vdupq_n_f64(1.945506571482613964425e2), z, q);
+    float64x2_t r = vfmaq_f64(t, vmulq_f64(t, z), vdivq_f64(p, q));
+    r = vaddq_f64(r, vbslq_f64(is_big, vdupq_n_f64(SIMSIMD_GEO_PI_4), vdupq_n_f64(0)));
+
+    // Unfold the octants back into the full circle
+    r = vbslq_f64(vcgtq_f64(abs_y, abs_x), vsubq_f64(vdupq_n_f64(SIMSIMD_GEO_PI_2), r), r);
+    r = vbslq_f64(vcltzq_f64(x), vsubq_f64(vdupq_n_f64(SIMSIMD_GEO_PI), r), r);
+    r = vbslq_f64(is_zero, vdupq_n_f64(0), r);
+    uint64x2_t sign_y = vandq_u64(vreinterpretq_u64_f64(y), vdupq_n_u64(0x8000000000000000ull));
+    return vreinterpretq_f64_u64(vorrq_u64(vreinterpretq_u64_f64(r), sign_y));
+}
+
+SIMSIMD_INTERNAL void _simsimd_sincos_f32x4_neon(float32x4_t x, float32x4_t *sin_out, float32x4_t *cos_out) {
+    float32x4_t k = vrndnq_f32(vmulq_n_f32(x, (simsimd_f32_t)SIMSIMD_GEO_2_PI));
+    float32x4_t r = vfmsq_f32(x, k, vdupq_n_f32(1.5703125f));
+    r = vfmsq_f32(r, k, vdupq_n_f32(4.837512969970703125e-4f));
+    r = vfmsq_f32(r, k, vdupq_n_f32(7.54978995489188216e-8f));
+    float32x4_t z = vmulq_f32(r, r);
+
+    float32x4_t s = vfmaq_f32(vdupq_n_f32(8.3321608736e-3f), z, vdupq_n_f32(-1.9515295891e-4f));
+    s = vfmaq_f32(vdupq_n_f32(-1.6666654611e-1f), z, s);
+    s = vfmaq_f32(r, vmulq_f32(r, z), s);
+    float32x4_t c = vfmaq_f32(vdupq_n_f32(-1.388731625493765e-3f), z, vdupq_n_f32(2.443315711809948e-5f));
+    c = vfmaq_f32(vdupq_n_f32(4.166664568298827e-2f), z, c);
+    c = vfmaq_f32(vfmsq_f32(vdupq_n_f32(1), z, vdupq_n_f32(0.5f)), vmulq_f32(z, z), c);
+
+    int32x4_t q = vcvtq_s32_f32(k);
+    uint32x4_t swap = vtstq_s32(q, vdupq_n_s32(1));
+    uint32x4_t sin_sign = vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(q, vdupq_n_s32(2))), 30);
+    uint32x4_t cos_sign =
+        vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(vaddq_s32(q, vdupq_n_s32(1)), vdupq_n_s32(2))), 30);
+    float32x4_t sin_r = vbslq_f32(swap, c, s), cos_r = vbslq_f32(swap, s, c);
+    *sin_out = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(sin_r), sin_sign));
+    *cos_out = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(cos_r), cos_sign));
+}
+
+SIMSIMD_INTERNAL float32x4_t _simsimd_atan2_f32x4_neon(float32x4_t y, float32x4_t x) {
+    float32x4_t abs_x = vabsq_f32(x), abs_y = vabsq_f32(y);
+    float32x4_t max_xy = vmaxq_f32(abs_x, abs_y), min_xy = vminq_f32(abs_x, abs_y);
+    uint32x4_t is_zero = vceqzq_f32(max_xy);
+    float32x4_t t = vdivq_f32(min_xy, vbslq_f32(is_zero, vdupq_n_f32(1), max_xy));
+
+    // Reduce [tan(pi/8), 1] to [-0.17, 0.17] with `atan(t) = pi/4 + atan((t - 1) / (t + 1))`
+    uint32x4_t is_big = vcgtq_f32(t, vdupq_n_f32(0.4142135623730950f));
+    float32x4_t one = vdupq_n_f32(1);
+    t = vbslq_f32(is_big, vdivq_f32(vsubq_f32(t, one), vaddq_f32(t, one)), t);
+    float32x4_t z = vmulq_f32(t, t);
+    float32x4_t p = vfmaq_f32(vdupq_n_f32(-1.38776856032e-1f), z, vdupq_n_f32(8.05374449538e-2f));
+    p = vfmaq_f32(vdupq_n_f32(1.99777106478e-1f), z, p);
+    p = vfmaq_f32(vdupq_n_f32(-3.33329491539e-1f), z, p);
+    float32x4_t r = vfmaq_f32(t, vmulq_f32(t, z), p);
+    r = vaddq_f32(r, vbslq_f32(is_big, vdupq_n_f32((simsimd_f32_t)SIMSIMD_GEO_PI_4), vdupq_n_f32(0)));
+
+    r = vbslq_f32(vcgtq_f32(abs_y, abs_x), vsubq_f32(vdupq_n_f32((simsimd_f32_t)SIMSIMD_GEO_PI_2), r), r);
+    r = vbslq_f32(vcltzq_f32(x), vsubq_f32(vdupq_n_f32((simsimd_f32_t)SIMSIMD_GEO_PI), r), r);
+    r = vbslq_f32(is_zero, vdupq_n_f32(0), r);
+    uint32x4_t sign_y = vandq_u32(vreinterpretq_u32_f32(y), vdupq_n_u32(0x80000000u));
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(r), sign_y));
+}
+
+SIMSIMD_INTERNAL float64x2_t _simsimd_hav_f64x2_neon(float64x2_t a_lat, float64x2_t a_lon, float64x2_t b_lat,
+                                                     float64x2_t b_lon) {
+    float64x2_t sin_half_lat, sin_half_lon, sin_unused, a_cos, b_cos, cos_unused;
+    _simsimd_sincos_f64x2_neon(vmulq_n_f64(vsubq_f64(b_lat, a_lat), 0.5), &sin_half_lat, &cos_unused);
+    _simsimd_sincos_f64x2_neon(vmulq_n_f64(vsubq_f64(b_lon, a_lon), 0.5), &sin_half_lon, &cos_unused);
+    _simsimd_sincos_f64x2_neon(a_lat, &sin_unused, &a_cos);
+    _simsimd_sincos_f64x2_neon(b_lat, &sin_unused, &b_cos);
+    float64x2_t cos_product = vmulq_f64(a_cos, b_cos);
+    return vfmaq_f64(vmulq_f64(sin_half_lat, sin_half_lat), cos_product, vmulq_f64(sin_half_lon, sin_half_lon));
+}
+
+SIMSIMD_INTERNAL float64x2_t _simsimd_haversine_f64x2_neon(float64x2_t a_lat, float64x2_t a_lon, float64x2_t b_lat,
+                                                           float64x2_t b_lon) {
+    float64x2_t hav = _simsimd_hav_f64x2_neon(a_lat, a_lon, b_lat, b_lon);
+    hav = vminq_f64(vmaxq_f64(hav, vdupq_n_f64(0)), vdupq_n_f64(1));
+    float64x2_t angle = _simsimd_atan2_f64x2_neon(vsqrtq_f64(hav), vsqrtq_f64(vsubq_f64(vdupq_n_f64(1), hav)));
+    return vmulq_n_f64(angle, 2 * SIMSIMD_EARTH_RADIUS);
+}
+
+SIMSIMD_INTERNAL float64x2_t _simsimd_vincenty_f64x2_neon(float64x2_t a_lat, float64x2_t a_lon, float64x2_t b_lat,
+                                                          float64x2_t b_lon) {
+    simsimd_f64_t const f = SIMSIMD_EARTH_FLATTENING, major = SIMSIMD_EARTH_EQUATORIAL_RADIUS;
+    simsimd_f64_t const minor = (1 - f) * major;
+    float64x2_t const one = vdupq_n_f64(1);
+
+    // Reduced latitudes, avoiding the tangent to stay finite at the poles
+    float64x2_t a_sin, a_cos, b_sin, b_cos;
+    _simsimd_sincos_f64x2_neon(a_lat, &a_sin, &a_cos);
+    _simsimd_sincos_f64x2_neon(b_lat, &b_sin, &b_cos);
+    a_sin = vmulq_n_f64(a_sin, 1 - f), b_sin = vmulq_n_f64(b_sin, 1 - f);
+    float64x2_t a_norm = vsqrtq_f64(vfmaq_f64(vmulq_f64(a_sin, a_sin), a_cos, a_cos));
+    float64x2_t b_norm = vsqrtq_f64(vfmaq_f64(vmulq_f64(b_sin, b_sin), b_cos, b_cos));
+    float64x2_t sin_u1 = vdivq_f64(a_sin, a_norm), cos_u1 = vdivq_f64(a_cos, a_norm);
+    float64x2_t sin_u2 = vdivq_f64(b_sin, b_norm), cos_u2 = vdivq_f64(b_cos, b_norm);
+    float64x2_t sin_u12 = vmulq_f64(sin_u1, sin_u2), cos_u12 = vmulq_f64(cos_u1, cos_u2);
+
+    // Converged lanes stay at their fixed point, so we iterate all of them until the slowest converges
+    float64x2_t l = vsubq_f64(b_lon, a_lon), lambda = l;
+    float64x2_t sin_sigma, cos_sigma, sigma, cos2_alpha, cos_2sigma_m;
+    for (simsimd_size_t iteration = 0; iteration != SIMSIMD_VINCENTY_ITERATIONS; ++iteration) {
+        float64x2_t sin_lambda, cos_lambda;
+        _simsimd_sincos_f64x2_neon(lambda, &sin_lambda, &cos_lambda);
+        float64x2_t t1 = vmulq_f64(cos_u2, sin_lambda);
+        float64x2_t t2 = vfmsq_f64(vmulq_f64(cos_u1, sin_u2), vmulq_f64(sin_u1, cos_u2), cos_lambda);
+        sin_sigma = vsqrtq_f64(vfmaq_f64(vmulq_f64(t1, t1), t2, t2));
+        cos_sigma = vfmaq_f64(sin_u12, cos_u12, cos_lambda);
+        sigma = _simsimd_atan2_f64x2_neon(sin_sigma, cos_sigma);
+        uint64x2_t coincident = vceqzq_f64(sin_sigma);
+        float64x2_t sin_alpha = vdivq_f64(vmulq_f64(cos_u12, sin_lambda), vbslq_f64(coincident, one, sin_sigma));
+        cos2_alpha = vfmsq_f64(one, sin_alpha, sin_alpha);
+        uint64x2_t equatorial = vceqzq_f64(cos2_alpha);
+        cos_2sigma_m = vfmsq_f64(cos_sigma, vmulq_n_f64(sin_u12, 2), vbslq_f64(equatorial, one, cos2_alpha));
+        cos_2sigma_m = vbslq_f64(equatorial, vdupq_n_f64(0), cos_2sigma_m);
+        float64x2_t c = vmulq_n_f64(cos2_alpha, f / 16);
+        c = vmulq_f64(c, vfmaq_f64(vdupq_n_f64(4 + 4 * f), cos2_alpha, vdupq_n_f64(-3 * f)));
+        float64x2_t inner = vfmaq_f64(vdupq_n_f64(-1), vmulq_n_f64(cos_2sigma_m, 2), cos_2sigma_m);
+        inner = vfmaq_f64(cos_2sigma_m, vmulq_f64(c, cos_sigma), inner);
+        inner = vfmaq_f64(sigma, vmulq_f64(c, sin_sigma), inner);
+        float64x2_t previous = lambda;
+        lambda = vfmaq_f64(l, vmulq_n_f64(vmulq_f64(vsubq_f64(one, c), sin_alpha), f), inner);
+        uint64x2_t converged = vcaltq_f64(vsubq_f64(lambda, previous), vdupq_n_f64(SIMSIMD_VINCENTY_EPSILON));
+        if (vminvq_u32(vreinterpretq_u32_u64(converged)) != 0) break;
+    }
+
+    float64x2_t u2 = vmulq_n_f64(cos2_alpha, (major * major - minor * minor) / (minor * minor));
+    float64x2_t big_a = vfmaq_f64(vdupq_n_f64(320), u2, vdupq_n_f64(-175));
+    big_a = vfmaq_f64(vdupq_n_f64(-768), u2, big_a);
+    big_a = vfmaq_f64(vdupq_n_f64(4096), u2, big_a);
+    big_a = vfmaq_f64(one, vmulq_n_f64(u2, 1.0 / 16384), big_a);
+    float64x2_t big_b = vfmaq_f64(vdupq_n_f64(74), u2, vdupq_n_f64(-47));
+    big_b = vfmaq_f64(vdupq_n_f64(-128), u2, big_b);
+    big_b = vfmaq_f64(vdupq_n_f64(256), u2, big_b);
+    big_b = vmulq_f64(vmulq_n_f64(u2, 1.0 / 1024), big_b);
+    float64x2_t cos2 = vmulq_f64(cos_2sigma_m, cos_2sigma_m);
+    float64x2_t last = vmulq_f64(vmulq_f64(vmulq_n_f64(big_b, 1.0 / 6), cos_2sigma_m),
+                                 vmulq_f64(vfmaq_f64(vdupq_n_f64(-3), vmulq_n_f64(sin_sigma, 4), sin_sigma),
+                                           vfmaq_f64(vdupq_n_f64(-3), vdupq_n_f64(4), cos2)));
+    float64x2_t middle = vfmsq_f64(vmulq_f64(cos_sigma, vfmaq_f64(vdupq_n_f64(-1), vdupq_n_f64(2), cos2)), one, last);
+    float64x2_t delta_sigma =
+        vmulq_f64(vmulq_f64(big_b, sin_sigma), vfmaq_f64(cos_2sigma_m, vmulq_n_f64(big_b, 0.25), middle));
+    float64x2_t distance = vmulq_f64(vmulq_n_f64(big_a, minor), vsubq_f64(sigma, delta_sigma));
+    return vbslq_f64(vceqzq_f64(sin_sigma), vdupq_n_f64(0), distance);
+}
+
+SIMSIMD_INTERNAL float32x4_t _simsimd_hav_f32x4_neon(float32x4_t a_lat, float32x4_t a_lon, float32x4_t b_lat,
+                                                     float32x4_t b_lon) {
+    float32x4_t sin_half_lat, sin_half_lon, sin_unused, a_cos, b_cos, cos_unused;
+    _simsimd_sincos_f32x4_neon(vmulq_n_f32(vsubq_f32(b_lat, a_lat), 0.5f), &sin_half_lat, &cos_unused);
+    _simsimd_sincos_f32x4_neon(vmulq_n_f32(vsubq_f32(b_lon, a_lon), 0.5f), &sin_half_lon, &cos_unused);
+    _simsimd_sincos_f32x4_neon(a_lat, &sin_unused, &a_cos);
+    _simsimd_sincos_f32x4_neon(b_lat, &sin_unused, &b_cos);
+    float32x4_t cos_product = vmulq_f32(a_cos, b_cos);
+    return vfmaq_f32(vmulq_f32(sin_half_lat, sin_half_lat), cos_product, vmulq_f32(sin_half_lon, sin_half_lon));
+}
+
+SIMSIMD_INTERNAL float32x4_t _simsimd_haversine_f32x4_neon(float32x4_t a_lat, float32x4_t a_lon, float32x4_t b_lat,
+                                                           float32x4_t b_lon) {
+    float32x4_t hav = _simsimd_hav_f32x4_neon(a_lat, a_lon, b_lat, b_lon);
+    hav = vminq_f32(vmaxq_f32(hav, vdupq_n_f32(0)), vdupq_n_f32(1));
+    float32x4_t angle = _simsimd_atan2_f32x4_neon(vsqrtq_f32(hav), vsqrtq_f32(vsubq_f32(vdupq_n_f32(1), hav)));
+    return vmulq_n_f32(angle, (simsimd_f32_t)(2 * SIMSIMD_EARTH_RADIUS));
+}
+
+/*  Every kernel processes full registers, copying the tail into zero-padded buffers, so that the last few
+ *  results are computed with the same approximations as the rest. Zero padding forms coincident pairs.
+ */
+#define SIMSIMD_MAKE_GEOSPATIAL_F64X2_NEON(name, kernel)                                                      \
+    SIMSIMD_PUBLIC void simsimd_##name##_f64_neon(simsimd_f64_t const *a_lats, simsimd_f64_t const *a_lons,   \
+                                                  simsimd_f64_t const *b_lats, simsimd_f64_t const *b_lons,   \
+                                                  simsimd_size_t n, simsimd_distance_t *results) {            \
+        simsimd_f64_t tails[4][2] = {{0}};                                                                    \
+        simsimd_size_t i = 0;                                                                                 \
+        for (; i + 2 <= n; i += 2)                                                                            \
+            vst1q_f64(results + i, kernel(vld1q_f64(a_lats + i), vld1q_f64(a_lons + i), vld1q_f64(b_lats + i), \
+                                          vld1q_f64(b_lons + i)));                                            \
+        if (i == n) return;                                                                                   \
+        tails[0][0] = a_lats[i], tails[1][0] = a_lons[i], tails[2][0] = b_lats[i], tails[3][0] = b_lons[i];   \
+        results[i] = vgetq_lane_f64(                                                                          \
+            kernel(vld1q_f64(tails[0]), vld1q_f64(tails[1]), vld1q_f64(tails[2]), vld1q_f64(tails[3])), 0);   \
+    }
+
+#define SIMSIMD_MAKE_GEOSPATIAL_F32X4_NEON(name, kernel)                                                      \
+    SIMSIMD_PUBLIC void simsimd_##name##_f32_neon(simsimd_f32_t const *a_lats, simsimd_f32_t const *a_lons,   \
+                                                  simsimd_f32_t const *b_lats, simsimd_f32_t const *b_lons,   \
+                                                  simsimd_size_t n, simsimd_distance_t *results) {            \
+        simsimd_f32_t tails[4][4] = {{0}};                                                                    \
+        simsimd_f32_t tail_results[4];                                                                        \
+        simsimd_size_t i = 0, j;                                                                              \
+        for (; i + 4 <= n; i += 4) {                                                                          \
+            float32x4_t r = kernel(vld1q_f32(a_lats + i), vld1q_f32(a_lons + i), vld1q_f32(b_lats + i),       \
+                                   vld1q_f32(b_lons + i));                                                    \
+            vst1q_f64(results + i, vcvt_f64_f32(vget_low_f32(r)));                                            \
+            vst1q_f64(results + i + 2, vcvt_high_f64_f32(r));                                                 \
+        }                                                                                                     \
+        if (i == n) return;                                                                                   \
+        for (j = 0; i + j != n; ++j)                                                                          \
+            tails[0][j] = a_lats[i + j], tails[1][j] = a_lons[i + j], tails[2][j] = b_lats[i + j],            \
+            tails[3][j] = b_lons[i + j];                                                                      \
+        vst1q_f32(tail_results,                                                                               \
+                  kernel(vld1q_f32(tails[0]), vld1q_f32(tails[1]), vld1q_f32(tails[2]), vld1q_f32(tails[3]))); \
+        for (j = 0; i + j != n; ++j) results[i + j] = tail_results[j];                                        \
+    }
+
+SIMSIMD_MAKE_GEOSPATIAL_F64X2_NEON(hav, _simsimd_hav_f64x2_neon)             // simsimd_hav_f64_neon
+SIMSIMD_MAKE_GEOSPATIAL_F64X2_NEON(haversine, _simsimd_haversine_f64x2_neon) // simsimd_haversine_f64_neon
+SIMSIMD_MAKE_GEOSPATIAL_F64X2_NEON(vincenty, _simsimd_vincenty_f64x2_neon)   // simsimd_vincenty_f64_neon
+SIMSIMD_MAKE_GEOSPATIAL_F32X4_NEON(hav, _simsimd_hav_f32x4_neon)             // simsimd_hav_f32_neon
+SIMSIMD_MAKE_GEOSPATIAL_F32X4_NEON(haversine, _simsimd_haversine_f32x4_neon) // simsimd_haversine_f32_neon
+
+SIMSIMD_PUBLIC void simsimd_vincenty_f32_neon(simsimd_f32_t const *a_lats, simsimd_f32_t const *a_lons,
+                                              simsimd_f32_t const *b_lats, simsimd_f32_t const *b_lons,
+                                              simsimd_size_t n, simsimd_distance_t *results) {
+    simsimd_f32_t tails[4][2] = {{0}};
+    simsimd_size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        vst1q_f64(results + i, _simsimd_vincenty_f64x2_neon(
+                                   vcvt_f64_f32(vld1_f32(a_lats + i)), vcvt_f64_f32(vld1_f32(a_lons + i)),
+                                   vcvt_f64_f32(vld1_f32(b_lats + i)), vcvt_f64_f32(vld1_f32(b_lons + i))));
+    if (i == n) return;
+    tails[0][0] = a_lats[i], tails[1][0] = a_lons[i], tails[2][0] = b_lats[i], tails[3][0] = b_lons[i];
+    results[i] = vgetq_lane_f64(_simsimd_vincenty_f64x2_neon(vcvt_f64_f32(vld1_f32(tails[0])),
+                                                             vcvt_f64_f32(vld1_f32(tails[1])),
+                                                             vcvt_f64_f32(vld1_f32(tails[2])),
+                                                             vcvt_f64_f32(vld1_f32(tails[3]))),
+                                0);
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON
+#endif // _SIMSIMD_TARGET_ARM
+
+#if _SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_HASWELL
+#pragma GCC push_options
+#pragma GCC target("avx2", "f16c", "fma")
+#pragma clang attribute push(__attribute__((target("avx2,f16c,fma"))), apply_to = function)
+
+/**
+ *  @brief  Computes both the sine and cosine of every lane, reducing the argument by multiples of pi/2.
+ */
+SIMSIMD_INTERNAL void _simsimd_sincos_f64x4_haswell(__m256d x, __m256d *sin_out, __m256d *cos_out) {
+    __m256d k = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(SIMSIMD_GEO_2_PI)),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_fnmadd_pd(k, _mm256_set1_pd(1.57079632673412561417e+00), x);
+    r = _mm256_fnmadd_pd(k, _mm256_set1_pd(6.07710050650619224932e-11), r);
+    __m256d z = _mm256_mul_pd(r, r);
+
+    __m256d s = _mm256_set1_pd(1.58969099521155010221e-10);
+    s = _mm256_fmadd_pd(z, s, _mm256_set1_pd(-2.50507602534068634195e-08));
+    s = _mm256_fmadd_pd(z, s, _mm256_set1_pd(2.75573137070700676789e-06));
+    s = _mm256_fmadd_pd(z, s, _mm256_set1_pd(-1.98412698298579493134e-04));
+    s = _mm256_fmadd_pd(z, s, _mm256_set1_pd(8.33333333332248946124e-03));
+    s = _mm256_fmadd_pd(z, s, _mm256_set1_pd(-1.66666666666666324348e-01));
+    s = _mm256_fmadd_pd(_mm256_mul_pd(r, z), s, r);
+
+    __m256d c = _mm256_set1_pd(-1.13596475577881948265e-11);
+    c = _mm256_fmadd_pd(z, c, _mm256_set1_pd(2.08757232129817482790e-09));
+    c = _mm256_fmadd_pd(z, c, _mm256_set1_pd(-2.75573143513906633035e-07));
+    c = _mm256_fmadd_pd(z, c, _mm256_set1_pd(2.48015872894767294178e-05));
+    c = _mm256_fmadd_pd(z, c, _mm256_set1_pd(-1.38888888888741095749e-03));
+    c = _mm256_fmadd_pd(z, c, _mm256_set1_pd(4.16666666666666019037e-02));
+    c = _mm256_fmadd_pd(_mm256_mul_pd(z, z), c, _mm256_fnmadd_pd(z, _mm256_set1_pd(0.5), _mm256_set1_pd(1)));
+
+    // Odd quadrants swap the sine and cosine, and the sign bits follow the quadrant
+    __m256i q = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(k));
+    __m256i one = _mm256_set1_epi64x(1), two = _mm256_set1_epi64x(2);
+    __m256d swap = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(q, one), one));
+    __m256d sin_sign = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_and_si256(q, two), 62));
+    __m256d cos_sign = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_and_si256(_mm256_add_epi64(q, one), two), 62));
+    *sin_out = _mm256_xor_pd(_mm256_blendv_pd(s, c, swap), sin_sign);
+    *cos_out = _mm256_xor_pd(_mm256_blendv_pd(c, s, swap), cos_sign);
+}
+
+/**
+ *  @brief  Computes the four-quadrant arctangent of `y / x` in every lane.
+ */
+SIMSIMD_INTERNAL __m256d _simsimd_atan2_f64x4_haswell(__m256d y, __m256d x) {
+    __m256d const sign_mask = _mm256_set1_pd(-0.0), one = _mm256_set1_pd(1), zero = _mm256_setzero_pd();
+    __m256d abs_x = _mm256_andnot_pd(sign_mask, x), abs_y = _mm256_andnot_pd(sign_mask, y);
+    __m256d max_xy = _mm256_max_pd(abs_x, abs_y), min_xy = _mm256_min_pd(abs_x, abs_y);
+    __m256d is_zero = _mm256_cmp_pd(max_xy, zero, _CMP_EQ_OQ);
+    __m256d t = _mm256_div_pd(min_xy, _mm256_blendv_pd(max_xy, one, is_zero));
+
+    // Reduce [0.66, 1] to [-0.2, 0] with `atan(t) = pi/4 + atan((t - 1) / (t + 1))`
+    __m256d is_big = _mm256_cmp_pd(t, _mm256_set1_pd(0.66), _CMP_GT_OQ);
+    t = _mm256_blendv_pd(t, _mm256_div_pd(_mm256_sub_pd(t, one), _mm256_add_pd(t, one)), is_big);
+    __m256d z = _mm256_mul_pd(t, t);
+    __m256d p = _mm256_set1_pd(-8.750608600031904122785e-1);
+    p = _mm256_fmadd_pd(z, p, _mm256_set1_pd(-1.615753718733365076637e1));
+    p = _mm256_fmadd_pd(z, p, _mm256_set1_pd(-7.500855792314704667340e1));
+    p = _mm256_fmadd_pd(z, p, _mm256_set1_pd(-1.228866684490136173410e2));
+    p = _mm256_fmadd_pd(z, p, _mm256_set1_pd(-6.485021904942025371773e1));
+    __m256d q = _mm256_add_pd(z, _mm256_set1_pd(2.485846490142306297962e1));
+    q = _mm256_fmadd_pd(z, q, _mm256_set1_pd(1.650270098316988542046e2));
+    q = _mm256_fmadd_pd(z, q, _mm256_set1_pd(4.328810604912902668951e2));
+    q = _mm256_fmadd_pd(z, q, _mm256_set1_pd(4.853903996359136964868e2));
+    q = _mm256_fmadd_pd(z, q, _mm256_set1_pd(1.945506571482613964425e2));
+    __m256d r = _mm256_fmadd_pd(_mm256_mul_pd(t, z), _mm256_div_pd(p, q), t);
+    r = _mm256_add_pd(r, _mm256_and_pd(is_big, _mm256_set1_pd(SIMSIMD_GEO_PI_4)));
+
+    // Unfold the octants back into the full circle
+    r = _mm256_blendv_pd(r, _mm256_sub_pd(_mm256_set1_pd(SIMSIMD_GEO_PI_2), r),
+                         _mm256_cmp_pd(abs_y, abs_x, _CMP_GT_OQ));
+    r = _mm256_blendv_pd(r, _mm256_sub_pd(_mm256_set1_pd(SIMSIMD_GEO_PI), r), x);
+    r = _mm256_andnot_pd(is_zero, r);
+    return _mm256_or_pd(r, _mm256_and_pd(y, sign_mask));
+}
+
+SIMSIMD_INTERNAL void _simsimd_sincos_f32x8_haswell(__m256 x, __m256 *sin_out, __m256 *cos_out) {
+    __m256 k = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps((simsimd_f32_t)SIMSIMD_GEO_2_PI)),
+                               _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_fnmadd_ps(k, _mm256_set1_ps(1.5703125f), x);
+    r = _mm256_fnmadd_ps(k, _mm256_set1_ps(4.837512969970703125e-4f), r);
+    r = _mm256_fnmadd_ps(k, _mm256_set1_ps(7.54978995489188216e-8f), r);
+    __m256 z = _mm256_mul_ps(r, r);
+
+    __m256 s = _mm256_fmadd_ps(z, _mm256_set1_ps(-1.9515295891e-4f), _mm256_set1_ps(8.3321608736e-3f));
+    s = _mm256_fmadd_ps(z, s, _mm256_set1_ps(-1.6666654611e-1f));
+    s = _mm256_fmadd_ps(_mm256_mul_ps(r, z), s, r);
+    __m256 c = _mm256_fmadd_ps(z, _mm256_set1_ps(2.443315711809948e-5f), _mm256_set1_ps(-1.388731625493765e-3f));
+    c = _mm256_fmadd_ps(z, c, _mm256_set1_ps(4.166664568298827e-2f));
+    c = _mm256_fmadd_ps(_mm256_mul_ps(z, z), c, _mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), _mm256_set1_ps(1)));
+
+    __m256i q = _mm256_cvtps_epi32(k);
+    __m256i one = _mm256_set1_epi32(1), two = _mm256_set1_epi32(2);
+    __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, one), one));
+    __m256 sin_sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, two), 30));
+    __m256 cos_sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, one), two), 30));
+    *sin_out = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), sin_sign);
+    *cos_out = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), cos_sign);
+}
+
+SIMSIMD_INTERNAL __m256 _simsimd_atan2_f32x8_haswell(__m256 y, __m256 x) {
+    __m256 const sign_mask = _mm256_set1_ps(-0.0f), one = _mm256_set1_ps(1), zero = _mm256_setzero_ps();
+    __m256 abs_x = _mm256_andnot_ps(sign_mask, x), abs_y = _mm256_andnot_ps(sign_mask, y);
+    __m256 max_xy = _mm256_max_ps(abs_x, abs_y), min_xy = _mm256_min_ps(abs_x, abs_y);
+    __m256 is_zero = _mm256_cmp_ps(max_xy, zero, _CMP_EQ_OQ);
+    __m256 t = _mm256_div_ps(min_xy, _mm256_blendv_ps(max_xy, one, is_zero));
+
+    // Reduce [tan(pi/8), 1] to [-0.17, 0.17] with `atan(t) = pi/4 + atan((t - 1) / (t + 1))`
+    __m256 is_big = _mm256_cmp_ps(t, _mm256_set1_ps(0.4142135623730950f), _CMP_GT_OQ);
+    t = _mm256_blendv_ps(t, _mm256_div_ps(_mm256_sub_ps(t, one), _mm256_add_ps(t, one)), is_big);
+    __m256 z = _mm256_mul_ps(t, t);
+    __m256 p = _mm256_fmadd_ps(z, _mm256_set1_ps(8.05374449538e-2f), _mm256_set1_ps(-1.38776856032e-1f));
+    p = _mm256_fmadd_ps(z, p, _mm256_set1_ps(1.99777106478e-1f));
+    p = _mm256_fmadd_ps(z, p, _mm256_set1_ps(-3.33329491539e-1f));
+    __m256 r = _mm256_fmadd_ps(_mm256_mul_ps(t, z), p, t);
+    r = _mm256_add_ps(r, _mm256_and_ps(is_big, _mm256_set1_ps((simsimd_f32_t)SIMSIMD_GEO_PI_4)));
+
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps((simsimd_f32_t)SIMSIMD_GEO_PI_2), r),
+                         _mm256_cmp_ps(abs_y, abs_x, _CMP_GT_OQ));
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps((simsimd_f32_t)SIMSIMD_GEO_PI), r), x);
+    r = _mm256_andnot_ps(is_zero, r);
+    return _mm256_or_ps(r, _mm256_and_ps(y, sign_mask));
+}
+
+SIMSIMD_INTERNAL __m256d _simsimd_hav_f64x4_haswell(__m256d a_lat, __m256d a_lon, __m256d b_lat, __m256d b_lon) {
+    __m256d const half = _mm256_set1_pd(0.5);
+    __m256d sin_half_lat, sin_half_lon, sin_unused, a_cos, b_cos, cos_unused;
+    _simsimd_sincos_f64x4_haswell(_mm256_mul_pd(_mm256_sub_pd(b_lat, a_lat), half), &sin_half_lat, &cos_unused);
+    _simsimd_sincos_f64x4_haswell(_mm256_mul_pd(_mm256_sub_pd(b_lon, a_lon), half), &sin_half_lon, &cos_unused);
+    _simsimd_sincos_f64x4_haswell(a_lat, &sin_unused, &a_cos);
+    _simsimd_sincos_f64x4_haswell(b_lat, &sin_unused, &b_cos);
+    return _mm256_fmadd_pd(_mm256_mul_pd(a_cos, b_cos), _mm256_mul_pd(sin_half_lon, sin_half_lon),
+                           _mm256_mul_pd(sin_half_lat, sin_half_lat));
+}
+
+SIMSIMD_INTERNAL __m256d _simsimd_haversine_f64x4_haswell(__m256d a_lat, __m256d a_lon, __m256d b_lat,
+                                                          __m256d b_lon) {
+    __m256d const one = _mm256_set1_pd(1);
+    __m256d hav = _simsimd_hav_f64x4_haswell(a_lat, a_lon, b_lat, b_lon);
+    hav = _mm256_min_pd(_mm256_max_pd(hav, _mm256_setzero_pd()), one);
+    __m256d angle = _simsimd_atan2_f64x4_haswell(_mm256_sqrt_pd(hav), _mm256_sqrt_pd(_mm256_sub_pd(one, hav)));
+    return _mm256_mul_pd(angle, _mm256_set1_pd(2 * SIMSIMD_EARTH_RADIUS));
+}
+
+SIMSIMD_INTERNAL __m256d _simsimd_vincenty_f64x4_haswell(__m256d a_lat, __m256d a_lon, __m256d b_lat, __m256d b_lon) {
+    simsimd_f64_t const f = SIMSIMD_EARTH_FLATTENING, major = SIMSIMD_EARTH_EQUATORIAL_RADIUS;
+    simsimd_f64_t const minor = (1 - f) * major;
+    __m256d const one = _mm256_set1_pd(1), zero = _mm256_setzero_pd(), sign_mask = _mm256_set1_pd(-0.0);
+
+    // Reduced latitudes, avoiding the tangent to stay finite at the poles
+    __m256d a_sin, a_cos, b_sin, b_cos;
+    _simsimd_sincos_f64x4_haswell(a_lat, &a_sin, &a_cos);
+    _simsimd_sincos_f64x4_haswell(b_lat, &b_sin, &b_cos);
+    a_sin = _mm256_mul_pd(a_sin, _mm256_set1_pd(1 - f)), b_sin = _mm256_mul_pd(b_sin, _mm256_set1_pd(1 - f));
+    __m256d a_norm = _mm256_sqrt_pd(_mm256_fmadd_pd(a_cos, a_cos, _mm256_mul_pd(a_sin, a_sin)));
+    __m256d b_norm = _mm256_sqrt_pd(_mm256_fmadd_pd(b_cos, b_cos, _mm256_mul_pd(b_sin, b_sin)));
+    __m256d sin_u1 = _mm256_div_pd(a_sin, a_norm), cos_u1 = _mm256_div_pd(a_cos, a_norm);
+    __m256d sin_u2 = _mm256_div_pd(b_sin, b_norm), cos_u2 = _mm256_div_pd(b_cos, b_norm);
+    __m256d sin_u12 = _mm256_mul_pd(sin_u1, sin_u2), cos_u12 = _mm256_mul_pd(cos_u1, cos_u2);
+
+    // Converged lanes stay at their fixed point, so we iterate all of them until the slowest converges
+    __m256d l = _mm256_sub_pd(b_lon, a_lon), lambda = l;
+    __m256d sin_sigma = zero, cos_sigma = one, sigma = zero, cos2_alpha = one, cos_2sigma_m = zero;
+    for (simsimd_size_t iteration = 0; iteration != SIMSIMD_VINCENTY_ITERATIONS; ++iteration) {
+        __m256d sin_lambda, cos_lambda;
+        _simsimd_sincos_f64x4_haswell(lambda, &sin_lambda, &cos_lambda);
+        __m256d t1 = _mm256_mul_pd(cos_u2, sin_lambda);
+        __m256d t2 = _mm256_fnmadd_pd(_mm256_mul_pd(sin_u1, cos_u2), cos_lambda, _mm256_mul_pd(cos_u1, sin_u2));
+        sin_sigma = _mm256_sqrt_pd(_mm256_fmadd_pd(t2, t2, _mm256_mul_pd(t1, t1)));
+        cos_sigma = _mm256_fmadd_pd(cos_u12, cos_lambda, sin_u12);
+        sigma = _simsimd_atan2_f64x4_haswell(sin_sigma, cos_sigma);
+        __m256d coincident = _mm256_cmp_pd(sin_sigma, zero, _CMP_EQ_OQ);
+        __m256d sin_alpha =
+            _mm256_div_pd(_mm256_mul_pd(cos_u12, sin_lambda), _mm256_blendv_pd(sin_sigma, one, coincident));
+        cos2_alpha = _mm256_fnmadd_pd(sin_alpha, sin_alpha, one);
+        __m256d equatorial = _mm256_cmp_pd(cos2_alpha, zero, _CMP_EQ_OQ);
+        cos_2sigma_m = _mm256_fnmadd_pd(_mm256_add_pd(sin_u12, sin_u12),
+                                        _mm256_div_pd(one, _mm256_blendv_pd(cos2_alpha, one, equatorial)), cos_sigma);
+        cos_2sigma_m = _mm256_andnot_pd(equatorial, cos_2sigma_m);
+        __m256d c = _mm256_mul_pd(_mm256_mul_pd(cos2_alpha, _mm256_set1_pd(f / 16)),
+                                  _mm256_fmadd_pd(cos2_alpha, _mm256_set1_pd(-3 * f), _mm256_set1_pd(4 + 4 * f)));
+        __m256d inner = _mm256_fmsub_pd(_mm256_add_pd(cos_2sigma_m, cos_2sigma_m), cos_2sigma_m, one);
+        inner = _mm256_fmadd_pd(_mm256_mul_pd(c, cos_sigma), inner, cos_2sigma_m);
+        inner = _mm256_fmadd_pd(_mm256_mul_pd(c, sin_sigma), inner, sigma);
+        __m256d previous = lambda;
+        lambda = _mm256_fmadd_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_sub_pd(one, c), sin_alpha), _mm256_set1_pd(f)),
+                                 inner, l);
+        __m256d change = _mm256_andnot_pd(sign_mask, _mm256_sub_pd(lambda, previous));
+        __m256d converged = _mm256_cmp_pd(change, _mm256_set1_pd(SIMSIMD_VINCENTY_EPSILON), _CMP_LT_OQ);
+        if (_mm256_movemask_pd(converged) == 0xF) break;
+    }
+
+    __m256d u2 = _mm256_mul_pd(cos2_alpha, _mm256_set1_pd((major * major - minor * minor) / (minor * minor)));
+    __m256d big_a = _mm256_fmadd_pd(u2, _mm256_set1_pd(-175), _mm256_set1_pd(320));
+    big_a = _mm256_fmadd_pd(u2, big_a, _mm256_set1_pd(-768));
+    big_a = _mm256_fmadd_pd(u2, big_a, _mm256_set1_pd(4096));
+    big_a = _mm256_fmadd_pd(_mm256_mul_pd(u2, _mm256_set1_pd(1.0 / 16384)), big_a, one);
+    __m256d big_b = _mm256_fmadd_pd(u2, _mm256_set1_pd(-47), _mm256_set1_pd(74));
+    big_b = _mm256_fmadd_pd(u2, big_b, _mm256_set1_pd(-128));
+    big_b = _mm256_fmadd_pd(u2, big_b, _mm256_set1_pd(256));
+    big_b = _mm256_mul_pd(_mm256_mul_pd(u2, _mm256_set1_pd(1.0 / 1024)), big_b);
+    __m256d cos2 = _mm256_mul_pd(cos_2sigma_m, cos_2sigma_m);
+    __m256d last = _mm256_mul_pd(
+        _mm256_mul_pd(_mm256_mul_pd(big_b, _mm256_set1_pd(1.0 / 6)), cos_2sigma_m),
+        _mm256_mul_pd(_mm256_fmsub_pd(_mm256_mul_pd(sin_sigma, _mm256_set1_pd(4)), sin_sigma, _mm256_set1_pd(3)),
+                      _mm256_fmsub_pd(cos2, _mm256_set1_pd(4), _mm256_set1_pd(3))));
+    __m256d middle = _mm256_sub_pd(_mm256_mul_pd(cos_sigma, _mm256_fmsub_pd(cos2, _mm256_set1_pd(2), one)), last);
+    __m256d quarter_b = _mm256_mul_pd(big_b, _mm256_set1_pd(0.25));
+    __m256d delta_sigma =
+        _mm256_mul_pd(_mm256_mul_pd(big_b, sin_sigma), _mm256_fmadd_pd(quarter_b, middle, cos_2sigma_m));
+    __m256d distance = _mm256_mul_pd(_mm256_mul_pd(big_a, _mm256_set1_pd(minor)), _mm256_sub_pd(sigma, delta_sigma));
+    return _mm256_andnot_pd(_mm256_cmp_pd(sin_sigma, zero, _CMP_EQ_OQ), distance);
+}
+
+SIMSIMD_INTERNAL __m256 _simsimd_hav_f32x8_haswell(__m256 a_lat, __m256 a_lon, __m256 b_lat, __m256 b_lon) {
+    __m256 const half = _mm256_set1_ps(0.5f);
+    __m256 sin_half_lat, sin_half_lon, sin_unused, a_cos, b_cos, cos_unused;
+    _simsimd_sincos_f32x8_haswell(_mm256_mul_ps(_mm256_sub_ps(b_lat, a_lat), half), &sin_half_lat, &cos_unused);
+    _simsimd_sincos_f32x8_haswell(_mm256_mul_ps(_mm256_sub_ps(b_lon, a_lon), half), &sin_half_lon, &cos_unused);
+    _simsimd_sincos_f32x8_haswell(a_lat, &sin_unused, &a_cos);
+    _simsimd_sincos_f32x8_haswell(b_lat, &sin_unused, &b_cos);
+    return _mm256_fmadd_ps(_mm256_mul_ps(a_cos, b_cos), _mm256_mul_ps(sin_half_lon, sin_half_lon),
+                           _mm256_mul_ps(sin_half_lat, sin_half_lat));
+}
+
+SIMSIMD_INTERNAL __m256 _simsimd_haversine_f32x8_haswell(__m256 a_lat, __m256 a_lon, __m256 b_lat, __m256 b_lon) {
+    __m256 const one = _mm256_set1_ps(1);
+    __m256 hav = _simsimd_hav_f32x8_haswell(a_lat, a_lon, b_lat, b_lon);
+    hav = _mm256_min_ps(_mm256_max_ps(hav, _mm256_setzero_ps()), one);
+    __m256 angle = _simsimd_atan2_f32x8_haswell(_mm256_sqrt_ps(hav), _mm256_sqrt_ps(_mm256_sub_ps(one, hav)));
+    return _mm256_mul_ps(angle, _mm256_set1_ps((simsimd_f32_t)(2 * SIMSIMD_EARTH_RADIUS)));
+}
+
+/*  Every kernel processes full registers, copying the tail into zero-padded buffers, so that the last few
+ *  results are computed with the same approximations as the rest. Zero padding forms coincident pairs.
+ */
+#define SIMSIMD_MAKE_GEOSPATIAL_F64X4_HASWELL(name, input_type, load, kernel)                                    \
+    SIMSIMD_PUBLIC void simsimd_##name##_##input_type##_haswell(                                                 \
+        simsimd_##input_type##_t const *a_lats, simsimd_##input_type##_t const *a_lons,                          \
+        simsimd_##input_type##_t const *b_lats, simsimd_##input_type##_t const *b_lons, simsimd_size_t n,        \
+        simsimd_distance_t *results) {                                                                           \
+        simsimd_##input_type##_t tails[4][4] = {{0}};                                                            \
+        simsimd_distance_t tail_results[4];                                                                      \
+        simsimd_size_t i = 0, j;                                                                                 \
+        for (; i + 4 <= n; i += 4)                                                                               \
+            _mm256_storeu_pd(results + i,                                                                        \
+                             kernel(load(a_lats + i), load(a_lons + i), load(b_lats + i), load(b_lons + i)));    \
+        if (i == n) return;                                                                                      \
+        for (j = 0; i + j != n; ++j)                                                                             \
+            tails[0][j] = a_lats[i + j], tails[1][j] = a_lons[i + j], tails[2][j] = b_lats[i + j],               \
+            tails[3][j] = b_lons[i + j];                                                                         \
+        _mm256_storeu_pd(tail_results, kernel(load(tails[0]), load(tails[1]), load(tails[2]), load(tails[3])));  \
+        for (j = 0; i + j != n; ++j) results[i + j] = tail_results[j];                                           \
+    }
+
+#define SIMSIMD_MAKE_GEOSPATIAL_F32X8_HASWELL(name, kernel)                                                      \
+    SIMSIMD_PUBLIC void simsimd_##name##_f32_haswell(simsimd_f32_t const *a_lats, simsimd_f32_t const *a_lons,   \
+                                                     simsimd_f32_t const *b_lats, simsimd_f32_t const *b_lons,   \
+                                                     simsimd_size_t n, simsimd_distance_t *results) {            \
+        simsimd_f32_t tails[4][8] = {{0}};                                                                       \
+        simsimd_distance_t tail_results[8];                                                                      \
+        simsimd_size_t i = 0, j;                                                                                 \
+        for (; i + 8 <= n; i += 8) {                                                                             \
+            __m256 r = kernel(_mm256_loadu_ps(a_lats + i), _mm256_loadu_ps(a_lons + i),                          \
+                              _mm256_loadu_ps(b_lats + i), _mm256_loadu_ps(b_lons + i));                         \
+            _mm256_storeu_pd(results + i, _mm256_cvtps_pd(_mm256_castps256_ps128(r)));                           \
+            _mm256_storeu_pd(results + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(r, 1)));                     \
+        }                                                                                                        \
+        if (i == n) return;                                                                                      \
+        for (j = 0; i + j != n; ++j)                                                                             \
+            tails[0][j] = a_lats[i + j], tails[1][j] = a_lons[i + j], tails[2][j] = b_lats[i + j],               \
+            tails[3][j] = b_lons[i + j];                                                                         \
+        __m256 r = kernel(_mm256_loadu_ps(tails[0]), _mm256_loadu_ps(tails[1]), _mm256_loadu_ps(tails[2]),       \
+                          _mm256_loadu_ps(tails[3]));                                                            \
+        _mm256_storeu_pd(tail_results, _mm256_cvtps_pd(_mm256_castps256_ps128(r)));                              \
+        _mm256_storeu_pd(tail_results + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(r, 1)));                        \
+        for (j = 0; i + j != n; ++j) results[i + j] = tail_results[j];                                           \
+    }
+
+#define _simsimd_load_f64x4_haswell(ptr) _mm256_loadu_pd(ptr)
+#define _simsimd_load_f32x4_as_f64x4_haswell(ptr) _mm256_cvtps_pd(_mm_loadu_ps(ptr))
+
+SIMSIMD_MAKE_GEOSPATIAL_F64X4_HASWELL(hav, f64, _simsimd_load_f64x4_haswell,
+                                      _simsimd_hav_f64x4_haswell) // simsimd_hav_f64_haswell
+SIMSIMD_MAKE_GEOSPATIAL_F64X4_HASWELL(haversine, f64, _simsimd_load_f64x4_haswell,
+                                      _simsimd_haversine_f64x4_haswell) // simsimd_haversine_f64_haswell
+SIMSIMD_MAKE_GEOSPATIAL_F64X4_HASWELL(vincenty, f64, _simsimd_load_f64x4_haswell,
+                                      _simsimd_vincenty_f64x4_haswell) // simsimd_vincenty_f64_haswell
+SIMSIMD_MAKE_GEOSPATIAL_F32X8_HASWELL(hav, _simsimd_hav_f32x8_haswell)             // simsimd_hav_f32_haswell
+SIMSIMD_MAKE_GEOSPATIAL_F32X8_HASWELL(haversine, _simsimd_haversine_f32x8_haswell) // simsimd_haversine_f32_haswell
+SIMSIMD_MAKE_GEOSPATIAL_F64X4_HASWELL(vincenty, f32, _simsimd_load_f32x4_as_f64x4_haswell,
+                                      _simsimd_vincenty_f64x4_haswell) // simsimd_vincenty_f32_haswell
+
+#undef _simsimd_load_f64x4_haswell
+#undef _simsimd_load_f32x4_as_f64x4_haswell
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_HASWELL
+#endif // _SIMSIMD_TARGET_X86
+
 #ifdef __cplusplus
 }
 #endif
@@ -7,6 +7,7 @@
  *  Contains:
  *  - Root Mean Square Deviation (RMSD) for rigid body superposition
  *  - Kabsch algorithm for optimal rigid body superposition
+ *  - One-to-many batches of both, comparing a reference against many conformers
  *
  *  For datatypes:
  *  - 64-bit IEEE-754 floating point
@@ -16,16 +17,32 @@
  *
  *  For hardware architectures:
  *  - Arm: Neon
- *  - x86: Genoa, Sapphire
+ *  - x86: Skylake, Genoa, Sapphire
+ *
+ *  Both point clouds contain `n` points with interleaved `x, y, z` coordinates, so `3 * n` scalars each.
+ *  The RMSD is computed after translating both clouds to their centroids, without rotation, while the
+ *  Kabsch variant also applies the optimal rotation of the first cloud onto the second.
+ *
+ *  Every kernel reads the inputs exactly once, accumulating the raw moments of both clouds: the sums of
+ *  coordinates, the sums of squared norms, and the 3x3 sums of outer products of corresponding points.
+ *  The centroids, the cross-covariance matrix, and the residual are derived from those moments in double
+ *  precision. Only the singular values of the 3x3 cross-covariance matrix H are needed, not the rotation itself,
+ *  so a few sweeps of the one-sided Jacobi SVD suffice, with the sign of det(H) handling the reflections:
+ *
+ *      RMSD² = (Σ|aᵢ - ā|² + Σ|bᵢ - b̄|² - 2 * (σ₁ + σ₂ + sign(det H) * σ₃)) / n
  *
  *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
  *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
+ *  Kabsch algorithm: https://en.wikipedia.org/wiki/Kabsch_algorithm
+ *  One-sided Jacobi SVD: https://en.wikipedia.org/wiki/Singular_value_decomposition#One-sided_Jacobi_algorithm
  */
 #ifndef SIMSIMD_MESH_H
 #define SIMSIMD_MESH_H
 
 #include "types.h"
 
+#include "dot.h" // `_simsimd_reduce_f32x16_skylake`, `_simsimd_bf16x16_to_f32x16_skylake`
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -60,8 +77,635 @@ SIMSIMD_PUBLIC void simsimd_kabsch_f16_accurate(simsimd_f16_t const* a, simsimd_
 SIMSIMD_PUBLIC void simsimd_rmsd_bf16_accurate(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_bf16_t* a_centroid, simsimd_bf16_t* b_centroid, simsimd_distance_t* result);
 SIMSIMD_PUBLIC void simsimd_kabsch_bf16_accurate(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_bf16_t* a_centroid, simsimd_bf16_t* b_centroid, simsimd_distance_t* result);
 
+/*  SIMD-powered backends for Arm NEON, using 32-bit arithmetic over 128-bit words for all types except `f64`.
+ *  The interleaved coordinates are split into separate registers with the structured `vld3` loads.
+ */
+SIMSIMD_PUBLIC void simsimd_rmsd_f64_neon(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_f64_t* a_centroid, simsimd_f64_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_kabsch_f64_neon(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_f64_t* a_centroid, simsimd_f64_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_rmsd_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n, simsimd_f32_t* a_centroid, simsimd_f32_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_kabsch_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n, simsimd_f32_t* a_centroid, simsimd_f32_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_rmsd_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_f16_t* a_centroid, simsimd_f16_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_kabsch_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_f16_t* a_centroid, simsimd_f16_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_rmsd_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_bf16_t* a_centroid, simsimd_bf16_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_kabsch_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_bf16_t* a_centroid, simsimd_bf16_t* b_centroid, simsimd_distance_t* result);
+
+/*  SIMD-powered backends for AVX512 CPUs of Skylake generation and newer, using 32-bit arithmetic over 512-bit words
+ *  for all types except `f64`. The interleaved coordinates are split into separate registers with two-source
+ *  permutations. Genoa and Sapphire Rapids kernels upcast `bf16` and `f16` inputs into the same `f32` pipeline.
+ */
+SIMSIMD_PUBLIC void simsimd_rmsd_f64_skylake(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_f64_t* a_centroid, simsimd_f64_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_kabsch_f64_skylake(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_f64_t* a_centroid, simsimd_f64_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_rmsd_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n, simsimd_f32_t* a_centroid, simsimd_f32_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_kabsch_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n, simsimd_f32_t* a_centroid, simsimd_f32_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_rmsd_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_bf16_t* a_centroid, simsimd_bf16_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_kabsch_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_bf16_t* a_centroid, simsimd_bf16_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_rmsd_f16_sapphire(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_f16_t* a_centroid, simsimd_f16_t* b_centroid, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_kabsch_f16_sapphire(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_f16_t* a_centroid, simsimd_f16_t* b_centroid, simsimd_distance_t* result);
+
+/*  One-to-many batches, comparing the reference cloud `a` against `b_count` clouds, each `b_stride` bytes apart.
+ *  They follow the signature of the one-to-many spatial kernels, with `n` being the number of points.
+ */
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f64_serial(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f64_serial(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f64_neon(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f64_neon(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f64_skylake(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f64_skylake(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f16_sapphire(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f16_sapphire(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+
 // clang-format on
 
+/**
+ *  @brief  Maximum number of Jacobi sweeps for the 3x3 SVD, which typically converges in 4 or 5 sweeps,
+ *          and the squared cosine between two columns, below which they are considered orthogonal.
+ */
+#if !defined(SIMSIMD_KABSCH_SWEEPS)
+#define SIMSIMD_KABSCH_SWEEPS 16
+#endif
+#if !defined(SIMSIMD_KABSCH_EPSILON)
+#define SIMSIMD_KABSCH_EPSILON 1e-30
+#endif
+
+/**
+ *  @brief  Raw moments of a pair of point clouds, accumulated in a single pass over both of them.
+ */
+typedef struct {
+    simsimd_f64_t a_sum[3]; //< Sums of the `x, y, z` coordinates of the first cloud
+    simsimd_f64_t b_sum[3]; //< Sums of the `x, y, z` coordinates of the second cloud
+    simsimd_f64_t norms;    //< Sum of squared norms of all points in both clouds
+    simsimd_f64_t ab[9];    //< Row-major sum of outer products `aᵢ * bᵢᵀ` of the corresponding points
+} _simsimd_mesh_moments_t;
+
+/**
+ *  @brief  Given the 3x3 cross-covariance matrix H, computes the trace of the optimal rotation applied to it,
+ *          which is the sum of its singular values, with the smallest one negated if H contains a reflection.
+ *
+ *  Uses the one-sided Jacobi method, orthogonalizing the columns of H with plane rotations, so that the singular
+ *  values become the column norms. Unlike the eigenvalues of HᵀH, it keeps the small singular values accurate.
+ */
+SIMSIMD_INTERNAL simsimd_f64_t _simsimd_kabsch_trace_f64(simsimd_f64_t const *h) {
+    simsimd_f64_t u[9], sigma[3], smallest;
+    int i, p, q, sweep, rotated;
+    for (i = 0; i != 9; ++i) u[i] = h[i];
+    for (sweep = 0, rotated = 1; rotated && sweep != SIMSIMD_KABSCH_SWEEPS; ++sweep) {
+        rotated = 0;
+        for (p = 0; p != 2; ++p)
+            for (q = p + 1; q != 3; ++q) {
+                simsimd_f64_t alpha = 0, beta = 0, gamma = 0;
+                for (i = 0; i != 3; ++i)
+                    alpha += u[i * 3 + p] * u[i * 3 + p], beta += u[i * 3 + q] * u[i * 3 + q],
+                        gamma += u[i * 3 + p] * u[i * 3 + q];
+                if (gamma == 0 || gamma * gamma <= SIMSIMD_KABSCH_EPSILON * alpha * beta) continue;
+                simsimd_f64_t const zeta = (beta - alpha) / (2 * gamma);
+                simsimd_f64_t const zeta_abs = zeta < 0 ? -zeta : zeta;
+                simsimd_f64_t const t = (zeta < 0 ? -1 : 1) / (zeta_abs + SIMSIMD_SQRT(1 + zeta * zeta));
+                simsimd_f64_t const c = 1 / SIMSIMD_SQRT(1 + t * t), s = c * t;
+                for (i = 0; i != 3; ++i) {
+                    simsimd_f64_t const up = u[i * 3 + p], uq = u[i * 3 + q];
+                    u[i * 3 + p] = c * up - s * uq, u[i * 3 + q] = s * up + c * uq;
+                }
+                rotated = 1;
+            }
+    }
+    for (p = 0; p != 3; ++p)
+        sigma[p] = SIMSIMD_SQRT(u[p] * u[p] + u[3 + p] * u[3 + p] + u[6 + p] * u[6 + p]);
+    smallest = sigma[0] < sigma[1] ? sigma[0] : sigma[1];
+    smallest = smallest < sigma[2] ? smallest : sigma[2];
+
+    // A negative determinant means the optimal orthogonal transform is a reflection, so we flip the weakest axis
+    simsimd_f64_t const det_h = h[0] * (h[4] * h[8] - h[5] * h[7]) - h[1] * (h[3] * h[8] - h[5] * h[6]) +
+                                h[2] * (h[3] * h[7] - h[4] * h[6]);
+    return sigma[0] + sigma[1] + sigma[2] - (det_h < 0 ? 2 * smallest : 0);
+}
+
+/**
+ *  @brief  Derives the centroids and the RMSD of two point clouds from their raw moments.
+ *  @param  rotate  Whether to apply the optimal Kabsch rotation, or just the translation.
+ */
+SIMSIMD_INTERNAL simsimd_distance_t _simsimd_mesh_finalize_f64(_simsimd_mesh_moments_t const *moments,
+                                                               simsimd_size_t n, int rotate,
+                                                               simsimd_f64_t *a_centroid, simsimd_f64_t *b_centroid) {
+    simsimd_f64_t h[9], residual, trace;
+    simsimd_size_t i, j;
+    if (n == 0) {
+        for (i = 0; i != 3; ++i) a_centroid[i] = b_centroid[i] = 0;
+        return 0;
+    }
+    for (i = 0; i != 3; ++i) a_centroid[i] = moments->a_sum[i] / n, b_centroid[i] = moments->b_sum[i] / n;
+
+    // Centering the moments: H = Σ aᵢbᵢᵀ - n * ā * b̄ᵀ, and Σ|aᵢ - ā|² = Σ|aᵢ|² - n * |ā|²
+    residual = moments->norms;
+    for (i = 0; i != 3; ++i) {
+        residual -= a_centroid[i] * moments->a_sum[i] + b_centroid[i] * moments->b_sum[i];
+        for (j = 0; j != 3; ++j) h[i * 3 + j] = moments->ab[i * 3 + j] - a_centroid[i] * moments->b_sum[j];
+    }
+    trace = rotate ? _simsimd_kabsch_trace_f64(h) : h[0] + h[4] + h[8];
+    residual = (residual - 2 * trace) / n;
+    return residual > 0 ? SIMSIMD_SQRT(residual) : 0;
+}
+
+#define SIMSIMD_MAKE_MESH_MOMENTS(name, input_type, accumulator_type, load_and_convert)                         \
+    SIMSIMD_INTERNAL void _simsimd_mesh_moments_##input_type##_##name(                                          \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t n,                 \
+        _simsimd_mesh_moments_t *moments) {                                                                     \
+        simsimd_##accumulator_type##_t a_sum[3] = {0, 0, 0}, b_sum[3] = {0, 0, 0}, norms = 0;                   \
+        simsimd_##accumulator_type##_t ab[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};                                     \
+        simsimd_size_t i, j, k;                                                                                 \
+        for (i = 0; i != n; ++i, a += 3, b += 3) {                                                              \
+            simsimd_##accumulator_type##_t ai[3], bi[3];                                                        \
+            for (j = 0; j != 3; ++j) ai[j] = load_and_convert(a + j), bi[j] = load_and_convert(b + j);          \
+            for (j = 0; j != 3; ++j) {                                                                          \
+                a_sum[j] += ai[j], b_sum[j] += bi[j];                                                           \
+                norms += ai[j] * ai[j] + bi[j] * bi[j];                                                         \
+                for (k = 0; k != 3; ++k) ab[j * 3 + k] += ai[j] * bi[k];                                        \
+            }                                                                                                   \
+        }                                                                                                       \
+        for (j = 0; j != 3; ++j) moments->a_sum[j] = a_sum[j], moments->b_sum[j] = b_sum[j];                    \
+        for (j = 0; j != 9; ++j) moments->ab[j] = ab[j];                                                        \
+        moments->norms = norms;                                                                                 \
+    }
+
+#define SIMSIMD_MAKE_MESH(metric, rotate, name, input_type, convert_and_export)                                 \
+    SIMSIMD_PUBLIC void simsimd_##metric##_##input_type##_##name(                                               \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t n,                 \
+        simsimd_##input_type##_t *a_centroid, simsimd_##input_type##_t *b_centroid, simsimd_distance_t *result) { \
+        _simsimd_mesh_moments_t moments;                                                                        \
+        simsimd_f64_t a_mean[3], b_mean[3];                                                                     \
+        simsimd_size_t i;                                                                                       \
+        _simsimd_mesh_moments_##input_type##_##name(a, b, n, &moments);                                         \
+        *result = _simsimd_mesh_finalize_f64(&moments, n, rotate, a_mean, b_mean);                              \
+        if (a_centroid)                                                                                         \
+            for (i = 0; i != 3; ++i) convert_and_export(a_mean[i], a_centroid + i);                             \
+        if (b_centroid)                                                                                         \
+            for (i = 0; i != 3; ++i) convert_and_export(b_mean[i], b_centroid + i);                             \
+    }
+
+#define SIMSIMD_MAKE_RMSD(name, input_type, convert_and_export) \
+    SIMSIMD_MAKE_MESH(rmsd, 0, name, input_type, convert_and_export)
+
+#define SIMSIMD_MAKE_KABSCH(name, input_type, convert_and_export) \
+    SIMSIMD_MAKE_MESH(kabsch, 1, name, input_type, convert_and_export)
+
+/*  The one-to-many batches reuse the pairwise kernels, as the reference is small enough to stay in the L1 cache,
+ *  and the moments of every pair have to be accumulated separately anyways.
+ */
+#define SIMSIMD_MAKE_MESH_BATCH(metric, name, input_type)                                                        \
+    SIMSIMD_PUBLIC void simsimd_##metric##_batch_##input_type##_##name(                                          \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t b_count,            \
+        simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results) {                                \
+        simsimd_size_t j;                                                                                        \
+        for (j = 0; j != b_count; ++j)                                                                           \
+            simsimd_##metric##_##input_type##_##name(a, SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j), n, \
+                                                     0, 0, results + j);                                         \
+    }
+
+SIMSIMD_MAKE_MESH_MOMENTS(serial, f64, f64, SIMSIMD_DEREFERENCE) // _simsimd_mesh_moments_f64_serial
+SIMSIMD_MAKE_RMSD(serial, f64, SIMSIMD_EXPORT)                   // simsimd_rmsd_f64_serial
+SIMSIMD_MAKE_KABSCH(serial, f64, SIMSIMD_EXPORT)                 // simsimd_kabsch_f64_serial
+SIMSIMD_MAKE_MESH_BATCH(rmsd, serial, f64)                       // simsimd_rmsd_batch_f64_serial
+SIMSIMD_MAKE_MESH_BATCH(kabsch, serial, f64)                     // simsimd_kabsch_batch_f64_serial
+
+SIMSIMD_MAKE_MESH_MOMENTS(serial, f32, f32, SIMSIMD_DEREFERENCE) // _simsimd_mesh_moments_f32_serial
+SIMSIMD_MAKE_RMSD(serial, f32, SIMSIMD_EXPORT)                   // simsimd_rmsd_f32_serial
+SIMSIMD_MAKE_KABSCH(serial, f32, SIMSIMD_EXPORT)                 // simsimd_kabsch_f32_serial
+SIMSIMD_MAKE_MESH_BATCH(rmsd, serial, f32)                       // simsimd_rmsd_batch_f32_serial
+SIMSIMD_MAKE_MESH_BATCH(kabsch, serial, f32)                     // simsimd_kabsch_batch_f32_serial
+
+SIMSIMD_MAKE_MESH_MOMENTS(serial, f16, f32, SIMSIMD_F16_TO_F32) // _simsimd_mesh_moments_f16_serial
+SIMSIMD_MAKE_RMSD(serial, f16, SIMSIMD_F32_TO_F16)              // simsimd_rmsd_f16_serial
+SIMSIMD_MAKE_KABSCH(serial, f16, SIMSIMD_F32_TO_F16)            // simsimd_kabsch_f16_serial
+SIMSIMD_MAKE_MESH_BATCH(rmsd, serial, f16)                      // simsimd_rmsd_batch_f16_serial
+SIMSIMD_MAKE_MESH_BATCH(kabsch, serial, f16)                    // simsimd_kabsch_batch_f16_serial
+
+SIMSIMD_MAKE_MESH_MOMENTS(serial, bf16, f32, SIMSIMD_BF16_TO_F32) // _simsimd_mesh_moments_bf16_serial
+SIMSIMD_MAKE_RMSD(serial, bf16, SIMSIMD_F32_TO_BF16)              // simsimd_rmsd_bf16_serial
+SIMSIMD_MAKE_KABSCH(serial, bf16, SIMSIMD_F32_TO_BF16)            // simsimd_kabsch_bf16_serial
+SIMSIMD_MAKE_MESH_BATCH(rmsd, serial, bf16)                       // simsimd_rmsd_batch_bf16_serial
+SIMSIMD_MAKE_MESH_BATCH(kabsch, serial, bf16)                     // simsimd_kabsch_batch_bf16_serial
+
+SIMSIMD_MAKE_MESH_MOMENTS(accurate, f32, f64, SIMSIMD_DEREFERENCE) // _simsimd_mesh_moments_f32_accurate
+SIMSIMD_MAKE_RMSD(accurate, f32, SIMSIMD_EXPORT)                   // simsimd_rmsd_f32_accurate
+SIMSIMD_MAKE_KABSCH(accurate, f32, SIMSIMD_EXPORT)                 // simsimd_kabsch_f32_accurate
+
+SIMSIMD_MAKE_MESH_MOMENTS(accurate, f16, f64, SIMSIMD_F16_TO_F32) // _simsimd_mesh_moments_f16_accurate
+SIMSIMD_MAKE_RMSD(accurate, f16, SIMSIMD_F32_TO_F16)              // simsimd_rmsd_f16_accurate
+SIMSIMD_MAKE_KABSCH(accurate, f16, SIMSIMD_F32_TO_F16)            // simsimd_kabsch_f16_accurate
+
+SIMSIMD_MAKE_MESH_MOMENTS(accurate, bf16, f64, SIMSIMD_BF16_TO_F32) // _simsimd_mesh_moments_bf16_accurate
+SIMSIMD_MAKE_RMSD(accurate, bf16, SIMSIMD_F32_TO_BF16)              // simsimd_rmsd_bf16_accurate
+SIMSIMD_MAKE_KABSCH(accurate, bf16, SIMSIMD_F32_TO_BF16)            // simsimd_kabsch_bf16_accurate
+
+#if _SIMSIMD_TARGET_ARM
+#if SIMSIMD_TARGET_NEON
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+simd")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+simd"))), apply_to = function)
+
+/**
+ *  @brief  Accumulates the moments of 4 pairs of points, already split into coordinates.
+ *          The `sums` hold 3 + 3 coordinate sums, the squared norms, and 9 outer products.
+ */
+SIMSIMD_INTERNAL void _simsimd_mesh_update_f32x4_neon(float32x4_t *sums, float32x4x3_t a, float32x4x3_t b) {
+    int i, j;
+    for (i = 0; i != 3; ++i) {
+        sums[i] = vaddq_f32(sums[i], a.val[i]);
+        sums[3 + i] = vaddq_f32(sums[3 + i], b.val[i]);
+        sums[6] = vfmaq_f32(vfmaq_f32(sums[6], a.val[i], a.val[i]), b.val[i], b.val[i]);
+        for (j = 0; j != 3; ++j) sums[7 + i * 3 + j] = vfmaq_f32(sums[7 + i * 3 + j], a.val[i], b.val[j]);
+    }
+}
+
+SIMSIMD_INTERNAL void _simsimd_mesh_export_f32x4_neon(float32x4_t const *sums, _simsimd_mesh_moments_t *moments) {
+    int i;
+    for (i = 0; i != 3; ++i) moments->a_sum[i] = vaddvq_f32(sums[i]), moments->b_sum[i] = vaddvq_f32(sums[3 + i]);
+    moments->norms = vaddvq_f32(sums[6]);
+    for (i = 0; i != 9; ++i) moments->ab[i] = vaddvq_f32(sums[7 + i]);
+}
+
+SIMSIMD_INTERNAL void _simsimd_mesh_moments_f32_neon(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                                     _simsimd_mesh_moments_t *moments) {
+    float32x4_t sums[16];
+    simsimd_size_t i;
+    for (i = 0; i != 16; ++i) sums[i] = vdupq_n_f32(0);
+    for (; n >= 4; n -= 4, a += 12, b += 12) _simsimd_mesh_update_f32x4_neon(sums, vld3q_f32(a), vld3q_f32(b));
+    if (n) {
+        simsimd_f32_t a_tail[12] = {0}, b_tail[12] = {0};
+        for (i = 0; i != n * 3; ++i) a_tail[i] = a[i], b_tail[i] = b[i];
+        _simsimd_mesh_update_f32x4_neon(sums, vld3q_f32(a_tail), vld3q_f32(b_tail));
+    }
+    _simsimd_mesh_export_f32x4_neon(sums, moments);
+}
+
+SIMSIMD_INTERNAL void _simsimd_mesh_moments_f64_neon(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                                     _simsimd_mesh_moments_t *moments) {
+    float64x2_t sums[16];
+    float64x2x3_t a_vec, b_vec;
+    simsimd_size_t i, j;
+    for (i = 0; i != 16; ++i) sums[i] = vdupq_n_f64(0);
+    for (; n; a += 6, b += 6) {
+        if (n < 2) {
+            simsimd_f64_t a_tail[6] = {0}, b_tail[6] = {0};
+            for (i = 0; i != 3; ++i) a_tail[i] = a[i], b_tail[i] = b[i];
+            a_vec = vld3q_f64(a_tail), b_vec = vld3q_f64(b_tail);
+            n = 0;
+        }
+        else { a_vec = vld3q_f64(a), b_vec = vld3q_f64(b), n -= 2; }
+        for (i = 0; i != 3; ++i) {
+            sums[i] = vaddq_f64(sums[i], a_vec.val[i]);
+            sums[3 + i] = vaddq_f64(sums[3 + i], b_vec.val[i]);
+            sums[6] = vfmaq_f64(vfmaq_f64(sums[6], a_vec.val[i], a_vec.val[i]), b_vec.val[i], b_vec.val[i]);
+            for (j = 0; j != 3; ++j)
+                sums[7 + i * 3 + j] = vfmaq_f64(sums[7 + i * 3 + j], a_vec.val[i], b_vec.val[j]);
+        }
+    }
+    for (i = 0; i != 3; ++i) moments->a_sum[i] = vaddvq_f64(sums[i]), moments->b_sum[i] = vaddvq_f64(sums[3 + i]);
+    moments->norms = vaddvq_f64(sums[6]);
+    for (i = 0; i != 9; ++i) moments->ab[i] = vaddvq_f64(sums[7 + i]);
+}
+
+SIMSIMD_MAKE_RMSD(neon, f64, SIMSIMD_EXPORT)   // simsimd_rmsd_f64_neon
+SIMSIMD_MAKE_KABSCH(neon, f64, SIMSIMD_EXPORT) // simsimd_kabsch_f64_neon
+SIMSIMD_MAKE_MESH_BATCH(rmsd, neon, f64)       // simsimd_rmsd_batch_f64_neon
+SIMSIMD_MAKE_MESH_BATCH(kabsch, neon, f64)     // simsimd_kabsch_batch_f64_neon
+
+SIMSIMD_MAKE_RMSD(neon, f32, SIMSIMD_EXPORT)   // simsimd_rmsd_f32_neon
+SIMSIMD_MAKE_KABSCH(neon, f32, SIMSIMD_EXPORT) // simsimd_kabsch_f32_neon
+SIMSIMD_MAKE_MESH_BATCH(rmsd, neon, f32)       // simsimd_rmsd_batch_f32_neon
+SIMSIMD_MAKE_MESH_BATCH(kabsch, neon, f32)     // simsimd_kabsch_batch_f32_neon
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON
+
+#if SIMSIMD_TARGET_NEON_F16
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+simd+fp16")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+simd+fp16"))), apply_to = function)
+
+SIMSIMD_INTERNAL float32x4x3_t _simsimd_mesh_load_f16x4x3_neon(simsimd_u16_t const *x) {
+    uint16x4x3_t raw = vld3_u16(x);
+    float32x4x3_t result;
+    result.val[0] = vcvt_f32_f16(vreinterpret_f16_u16(raw.val[0]));
+    result.val[1] = vcvt_f32_f16(vreinterpret_f16_u16(raw.val[1]));
+    result.val[2] = vcvt_f32_f16(vreinterpret_f16_u16(raw.val[2]));
+    return result;
+}
+
+SIMSIMD_INTERNAL void _simsimd_mesh_moments_f16_neon(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
+                                                     _simsimd_mesh_moments_t *moments) {
+    simsimd_u16_t const *a_u16 = (simsimd_u16_t const *)a, *b_u16 = (simsimd_u16_t const *)b;
+    float32x4_t sums[16];
+    simsimd_size_t i;
+    for (i = 0; i != 16; ++i) sums[i] = vdupq_n_f32(0);
+    for (; n >= 4; n -= 4, a_u16 += 12, b_u16 += 12)
+        _simsimd_mesh_update_f32x4_neon(sums, _simsimd_mesh_load_f16x4x3_neon(a_u16),
+                                        _simsimd_mesh_load_f16x4x3_neon(b_u16));
+    if (n) {
+        simsimd_u16_t a_tail[12] = {0}, b_tail[12] = {0};
+        for (i = 0; i != n * 3; ++i) a_tail[i] = a_u16[i], b_tail[i] = b_u16[i];
+        _simsimd_mesh_update_f32x4_neon(sums, _simsimd_mesh_load_f16x4x3_neon(a_tail),
+                                        _simsimd_mesh_load_f16x4x3_neon(b_tail));
+    }
+    _simsimd_mesh_export_f32x4_neon(sums, moments);
+}
+
+SIMSIMD_MAKE_RMSD(neon, f16, SIMSIMD_F32_TO_F16)   // simsimd_rmsd_f16_neon
+SIMSIMD_MAKE_KABSCH(neon, f16, SIMSIMD_F32_TO_F16) // simsimd_kabsch_f16_neon
+SIMSIMD_MAKE_MESH_BATCH(rmsd, neon, f16)           // simsimd_rmsd_batch_f16_neon
+SIMSIMD_MAKE_MESH_BATCH(kabsch, neon, f16)         // simsimd_kabsch_batch_f16_neon
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON_F16
+
+#if SIMSIMD_TARGET_NEON_BF16
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.6-a+simd+bf16")
+#pragma clang attribute push(__attribute__((target("arch=armv8.6-a+simd+bf16"))), apply_to = function)
+
+SIMSIMD_INTERNAL float32x4x3_t _simsimd_mesh_load_bf16x4x3_neon(simsimd_u16_t const *x) {
+    // Upcasting from `bf16` to `f32` is done by shifting the `bf16` values by 16 bits to the left
+    uint16x4x3_t raw = vld3_u16(x);
+    float32x4x3_t result;
+    result.val[0] = vreinterpretq_f32_u32(vshll_n_u16(raw.val[0], 16));
+    result.val[1] = vreinterpretq_f32_u32(vshll_n_u16(raw.val[1], 16));
+    result.val[2] = vreinterpretq_f32_u32(vshll_n_u16(raw.val[2], 16));
+    return result;
+}
+
+SIMSIMD_INTERNAL void _simsimd_mesh_moments_bf16_neon(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                      simsimd_size_t n, _simsimd_mesh_moments_t *moments) {
+    simsimd_u16_t const *a_u16 = (simsimd_u16_t const *)a, *b_u16 = (simsimd_u16_t const *)b;
+    float32x4_t sums[16];
+    simsimd_size_t i;
+    for (i = 0; i != 16; ++i) sums[i] = vdupq_n_f32(0);
+    for (; n >= 4; n -= 4, a_u16 += 12, b_u16 += 12)
+        _simsimd_mesh_update_f32x4_neon(sums, _simsimd_mesh_load_bf16x4x3_neon(a_u16),
+                                        _simsimd_mesh_load_bf16x4x3_neon(b_u16));
+    if (n) {
+        simsimd_u16_t a_tail[12] = {0}, b_tail[12] = {0};
+        for (i = 0; i != n * 3; ++i) a_tail[i] = a_u16[i], b_tail[i] = b_u16[i];
+        _simsimd_mesh_update_f32x4_neon(sums, _simsimd_mesh_load_bf16x4x3_neon(a_tail),
+                                        _simsimd_mesh_load_bf16x4x3_neon(b_tail));
+    }
+    _simsimd_mesh_export_f32x4_neon(sums, moments);
+}
+
+SIMSIMD_MAKE_RMSD(neon, bf16, SIMSIMD_F32_TO_BF16)   // simsimd_rmsd_bf16_neon
+SIMSIMD_MAKE_KABSCH(neon, bf16, SIMSIMD_F32_TO_BF16) // simsimd_kabsch_bf16_neon
+SIMSIMD_MAKE_MESH_BATCH(rmsd, neon, bf16)            // simsimd_rmsd_batch_bf16_neon
+SIMSIMD_MAKE_MESH_BATCH(kabsch, neon, bf16)          // simsimd_kabsch_batch_bf16_neon
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON_BF16
+#endif // _SIMSIMD_TARGET_ARM
+
+#if _SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_SKYLAKE
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "avx512bw", "bmi2")
+#pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512vl,avx512bw,bmi2"))), apply_to = function)
+
+/**
+ *  @brief  Splits 16 interleaved `x, y, z` points from 3 registers into 3 registers of separate coordinates.
+ *          Every coordinate is gathered with two permutations: the first covers the first 32 scalars,
+ *          the second replaces the remaining lanes with the scalars of the third register.
+ */
+SIMSIMD_INTERNAL void _simsimd_mesh_deinterleave_f32x16_skylake(__m512 v0, __m512 v1, __m512 v2, __m512 *xyz) {
+    __m512i const x01 = _mm512_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0);
+    __m512i const x2 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29);
+    __m512i const y01 = _mm512_setr_epi32(1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0);
+    __m512i const y2 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30);
+    __m512i const z01 = _mm512_setr_epi32(2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0);
+    __m512i const z2 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31);
+    xyz[0] = _mm512_permutex2var_ps(_mm512_permutex2var_ps(v0, x01, v1), x2, v2);
+    xyz[1] = _mm512_permutex2var_ps(_mm512_permutex2var_ps(v0, y01, v1), y2, v2);
+    xyz[2] = _mm512_permutex2var_ps(_mm512_permutex2var_ps(v0, z01, v1), z2, v2);
+}
+
+/**
+ *  @brief  Accumulates the moments of 16 pairs of interleaved points, passed in 3 registers per cloud.
+ *          The `sums` hold 3 + 3 coordinate sums, the squared norms, and 9 outer products.
+ */
+SIMSIMD_INTERNAL void _simsimd_mesh_update_f32x16_skylake(__m512 *sums, __m512 a0, __m512 a1, __m512 a2, __m512 b0,
+                                                           __m512 b1, __m512 b2) {
+    __m512 a[3], b[3];
+    int i, j;
+    _simsimd_mesh_deinterleave_f32x16_skylake(a0, a1, a2, a);
+    _simsimd_mesh_deinterleave_f32x16_skylake(b0, b1, b2, b);
+    for (i = 0; i != 3; ++i) {
+        sums[i] = _mm512_add_ps(sums[i], a[i]);
+        sums[3 + i] = _mm512_add_ps(sums[3 + i], b[i]);
+        sums[6] = _mm512_fmadd_ps(b[i], b[i], _mm512_fmadd_ps(a[i], a[i], sums[6]));
+        for (j = 0; j != 3; ++j) sums[7 + i * 3 + j] = _mm512_fmadd_ps(a[i], b[j], sums[7 + i * 3 + j]);
+    }
+}
+
+SIMSIMD_INTERNAL void _simsimd_mesh_export_f32x16_skylake(__m512 const *sums, _simsimd_mesh_moments_t *moments) {
+    int i;
+    for (i = 0; i != 3; ++i)
+        moments->a_sum[i] = _simsimd_reduce_f32x16_skylake(sums[i]),
+        moments->b_sum[i] = _simsimd_reduce_f32x16_skylake(sums[3 + i]);
+    moments->norms = _simsimd_reduce_f32x16_skylake(sums[6]);
+    for (i = 0; i != 9; ++i) moments->ab[i] = _simsimd_reduce_f32x16_skylake(sums[7 + i]);
+}
+
+/**
+ *  @brief  Masks for the 3 registers covering the last `scalars` entries, fewer than 3 full registers.
+ */
+SIMSIMD_INTERNAL void _simsimd_mesh_tail_masks_skylake(simsimd_size_t scalars, simsimd_size_t width,
+                                                       __mmask16 *masks) {
+    masks[0] = (__mmask16)_bzhi_u32(0xFFFF, (unsigned)scalars);
+    masks[1] = (__mmask16)_bzhi_u32(0xFFFF, (unsigned)(scalars > width ? scalars - width : 0));
+    masks[2] = (__mmask16)_bzhi_u32(0xFFFF, (unsigned)(scalars > 2 * width ? scalars - 2 * width : 0));
+}
+
+SIMSIMD_INTERNAL void _simsimd_mesh_moments_f32_skylake(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                        simsimd_size_t n, _simsimd_mesh_moments_t *moments) {
+    __m512 sums[16];
+    __mmask16 masks[3];
+    simsimd_size_t i, scalars = n * 3;
+    for (i = 0; i != 16; ++i) sums[i] = _mm512_setzero_ps();
+    for (; scalars >= 48; scalars -= 48, a += 48, b += 48)
+        _simsimd_mesh_update_f32x16_skylake(sums, _mm512_loadu_ps(a), _mm512_loadu_ps(a + 16),
+                                            _mm512_loadu_ps(a + 32), _mm512_loadu_ps(b), _mm512_loadu_ps(b + 16),
+                                            _mm512_loadu_ps(b + 32));
+    if (scalars) {
+        _simsimd_mesh_tail_masks_skylake(scalars, 16, masks);
+        _simsimd_mesh_update_f32x16_skylake(
+            sums, _mm512_maskz_loadu_ps(masks[0], a), _mm512_maskz_loadu_ps(masks[1], a + 16),
+            _mm512_maskz_loadu_ps(masks[2], a + 32), _mm512_maskz_loadu_ps(masks[0], b),
+            _mm512_maskz_loadu_ps(masks[1], b + 16), _mm512_maskz_loadu_ps(masks[2], b + 32));
+    }
+    _simsimd_mesh_export_f32x16_skylake(sums, moments);
+}
+
+SIMSIMD_INTERNAL void _simsimd_mesh_deinterleave_f64x8_skylake(__m512d v0, __m512d v1, __m512d v2, __m512d *xyz) {
+    __m512i const x01 = _mm512_setr_epi64(0, 3, 6, 9, 12, 15, 0, 0);
+    __m512i const x2 = _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 10, 13);
+    __m512i const y01 = _mm512_setr_epi64(1, 4, 7, 10, 13, 0, 0, 0);
+    __m512i const y2 = _mm512_setr_epi64(0, 1, 2, 3, 4, 8, 11, 14);
+    __m512i const z01 = _mm512_setr_epi64(2, 5, 8, 11, 14, 0, 0, 0);
+    __m512i const z2 = _mm512_setr_epi64(0, 1, 2, 3, 4, 9, 12, 15);
+    xyz[0] = _mm512_permutex2var_pd(_mm512_permutex2var_pd(v0, x01, v1), x2, v2);
+    xyz[1] = _mm512_permutex2var_pd(_mm512_permutex2var_pd(v0, y01, v1), y2, v2);
+    xyz[2] = _mm512_permutex2var_pd(_mm512_permutex2var_pd(v0, z01, v1), z2, v2);
+}
+
+SIMSIMD_INTERNAL void _simsimd_mesh_moments_f64_skylake(simsimd_f64_t const *a, simsimd_f64_t const *b,
+                                                        simsimd_size_t n, _simsimd_mesh_moments_t *moments) {
+    __m512d sums[16], a_vec[3], b_vec[3];
+    __mmask16 masks[3];
+    simsimd_size_t i, j, scalars = n * 3;
+    for (i = 0; i != 16; ++i) sums[i] = _mm512_setzero_pd();
+    while (scalars) {
+        if (scalars < 24) {
+            _simsimd_mesh_tail_masks_skylake(scalars, 8, masks);
+            _simsimd_mesh_deinterleave_f64x8_skylake(
+                _mm512_maskz_loadu_pd((__mmask8)masks[0], a), _mm512_maskz_loadu_pd((__mmask8)masks[1], a + 8),
+                _mm512_maskz_loadu_pd((__mmask8)masks[2], a + 16), a_vec);
+            _simsimd_mesh_deinterleave_f64x8_skylake(
+                _mm512_maskz_loadu_pd((__mmask8)masks[0], b), _mm512_maskz_loadu_pd((__mmask8)masks[1], b + 8),
+                _mm512_maskz_loadu_pd((__mmask8)masks[2], b + 16), b_vec);
+            scalars = 0;
+        }
+        else {
+            _simsimd_mesh_deinterleave_f64x8_skylake(_mm512_loadu_pd(a), _mm512_loadu_pd(a + 8),
+                                                     _mm512_loadu_pd(a + 16), a_vec);
+            _simsimd_mesh_deinterleave_f64x8_skylake(_mm512_loadu_pd(b), _mm512_loadu_pd(b + 8),
+                                                     _mm512_loadu_pd(b + 16), b_vec);
+            scalars -= 24, a += 24, b += 24;
+        }
+        for (i = 0; i != 3; ++i) {
+            sums[i] = _mm512_add_pd(sums[i], a_vec[i]);
+            sums[3 + i] = _mm512_add_pd(sums[3 + i], b_vec[i]);
+            sums[6] = _mm512_fmadd_pd(b_vec[i], b_vec[i], _mm512_fmadd_pd(a_vec[i], a_vec[i], sums[6]));
+            for (j = 0; j != 3; ++j) sums[7 + i * 3 + j] = _mm512_fmadd_pd(a_vec[i], b_vec[j], sums[7 + i * 3 + j]);
+        }
+    }
+    for (i = 0; i != 3; ++i)
+        moments->a_sum[i] = _mm512_reduce_add_pd(sums[i]), moments->b_sum[i] = _mm512_reduce_add_pd(sums[3 + i]);
+    moments->norms = _mm512_reduce_add_pd(sums[6]);
+    for (i = 0; i != 9; ++i) moments->ab[i] = _mm512_reduce_add_pd(sums[7 + i]);
+}
+
+SIMSIMD_MAKE_RMSD(skylake, f64, SIMSIMD_EXPORT)   // simsimd_rmsd_f64_skylake
+SIMSIMD_MAKE_KABSCH(skylake, f64, SIMSIMD_EXPORT) // simsimd_kabsch_f64_skylake
+SIMSIMD_MAKE_MESH_BATCH(rmsd, skylake, f64)       // simsimd_rmsd_batch_f64_skylake
+SIMSIMD_MAKE_MESH_BATCH(kabsch, skylake, f64)     // simsimd_kabsch_batch_f64_skylake
+
+SIMSIMD_MAKE_RMSD(skylake, f32, SIMSIMD_EXPORT)   // simsimd_rmsd_f32_skylake
+SIMSIMD_MAKE_KABSCH(skylake, f32, SIMSIMD_EXPORT) // simsimd_kabsch_f32_skylake
+SIMSIMD_MAKE_MESH_BATCH(rmsd, skylake, f32)       // simsimd_rmsd_batch_f32_skylake
+SIMSIMD_MAKE_MESH_BATCH(kabsch, skylake, f32)     // simsimd_kabsch_batch_f32_skylake
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SKYLAKE
+
+#if SIMSIMD_TARGET_GENOA
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "bmi2", "avx512bw", "avx512bf16")
+#pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512vl,bmi2,avx512bw,avx512bf16"))), \
+                             apply_to = function)
+
+SIMSIMD_INTERNAL void _simsimd_mesh_moments_bf16_genoa(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                       simsimd_size_t n, _simsimd_mesh_moments_t *moments) {
+    __m512 sums[16];
+    __mmask16 masks[3];
+    simsimd_size_t i, scalars = n * 3;
+    for (i = 0; i != 16; ++i) sums[i] = _mm512_setzero_ps();
+    for (; scalars >= 48; scalars -= 48, a += 48, b += 48)
+        _simsimd_mesh_update_f32x16_skylake(sums, //
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_loadu_si256((__m256i const *)a)),
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_loadu_si256((__m256i const *)(a + 16))),
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_loadu_si256((__m256i const *)(a + 32))),
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_loadu_si256((__m256i const *)b)),
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_loadu_si256((__m256i const *)(b + 16))),
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_loadu_si256((__m256i const *)(b + 32))));
+    if (scalars) {
+        _simsimd_mesh_tail_masks_skylake(scalars, 16, masks);
+        _simsimd_mesh_update_f32x16_skylake(sums, //
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_maskz_loadu_epi16(masks[0], a)),
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_maskz_loadu_epi16(masks[1], a + 16)),
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_maskz_loadu_epi16(masks[2], a + 32)),
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_maskz_loadu_epi16(masks[0], b)),
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_maskz_loadu_epi16(masks[1], b + 16)),
+                                            _mm512_cvtpbh_ps((__m256bh)_mm256_maskz_loadu_epi16(masks[2], b + 32)));
+    }
+    _simsimd_mesh_export_f32x16_skylake(sums, moments);
+}
+
+SIMSIMD_MAKE_RMSD(genoa, bf16, SIMSIMD_F32_TO_BF16)   // simsimd_rmsd_bf16_genoa
+SIMSIMD_MAKE_KABSCH(genoa, bf16, SIMSIMD_F32_TO_BF16) // simsimd_kabsch_bf16_genoa
+SIMSIMD_MAKE_MESH_BATCH(rmsd, genoa, bf16)            // simsimd_rmsd_batch_bf16_genoa
+SIMSIMD_MAKE_MESH_BATCH(kabsch, genoa, bf16)          // simsimd_kabsch_batch_bf16_genoa
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_GENOA
+
+#if SIMSIMD_TARGET_SAPPHIRE
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "bmi2", "avx512bw", "avx512fp16")
+#pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512vl,bmi2,avx512bw,avx512fp16"))), \
+                             apply_to = function)
+
+SIMSIMD_INTERNAL void _simsimd_mesh_moments_f16_sapphire(simsimd_f16_t const *a, simsimd_f16_t const *b,
+                                                         simsimd_size_t n, _simsimd_mesh_moments_t *moments) {
+    __m512 sums[16];
+    __mmask16 masks[3];
+    simsimd_size_t i, scalars = n * 3;
+    for (i = 0; i != 16; ++i) sums[i] = _mm512_setzero_ps();
+    for (; scalars >= 48; scalars -= 48, a += 48, b += 48)
+        _simsimd_mesh_update_f32x16_skylake(sums, //
+                                            _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const *)a)),
+                                            _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const *)(a + 16))),
+                                            _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const *)(a + 32))),
+                                            _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const *)b)),
+                                            _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const *)(b + 16))),
+                                            _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const *)(b + 32))));
+    if (scalars) {
+        _simsimd_mesh_tail_masks_skylake(scalars, 16, masks);
+        _simsimd_mesh_update_f32x16_skylake(sums, //
+                                            _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(masks[0], a)),
+                                            _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(masks[1], a + 16)),
+                                            _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(masks[2], a + 32)),
+                                            _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(masks[0], b)),
+                                            _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(masks[1], b + 16)),
+                                            _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(masks[2], b + 32)));
+    }
+    _simsimd_mesh_export_f32x16_skylake(sums, moments);
+}
+
+SIMSIMD_MAKE_RMSD(sapphire, f16, SIMSIMD_F32_TO_F16)   // simsimd_rmsd_f16_sapphire
+SIMSIMD_MAKE_KABSCH(sapphire, f16, SIMSIMD_F32_TO_F16) // simsimd_kabsch_f16_sapphire
+SIMSIMD_MAKE_MESH_BATCH(rmsd, sapphire, f16)           // simsimd_rmsd_batch_f16_sapphire
+SIMSIMD_MAKE_MESH_BATCH(kabsch, sapphire, f16)         // simsimd_kabsch_batch_f16_sapphire
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SAPPHIRE
+#endif // _SIMSIMD_TARGET_X86
+
 #ifdef __cplusplus
 }
 #endif
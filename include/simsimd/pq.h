@@ -0,0 +1,446 @@
+/**
+ *  @file       pq.h
+ *  @brief      SIMD-accelerated Product Quantization scans with Asymmetric Distance Computation.
+ *  @author     Ash Vardanian
+ *  @date       October 14, 2026
+ *
+ *  Contains:
+ *  - Packing of row-major PQ codes into interleaved blocks
+ *  - Quantization of per-query floating-point ADC tables into 8-bit ones
+ *  - Fast-scan of packed codes, summing one table entry per subspace
+ *
+ *  For datatypes:
+ *  - 8-bit codes, for 256 centroids per subspace
+ *  - 4-bit codes packed in pairs, for 16 centroids per subspace
+ *
+ *  For hardware architectures:
+ *  - Arm: NEON, SVE
+ *  - x86: Haswell, Skylake, Ice Lake
+ *
+ *  A PQ code assigns one of `centroids` per subspace to every database vector. Given a query, the distances
+ *  from every query sub-vector to every centroid form the ADC table, and the distance to a database vector
+ *  is approximated by the sum of `subspaces` table entries, selected by its codes. The tables are built with
+ *  the existing `dot` and `l2sq` kernels by `simsimd_pq_table_f32` and `simsimd_pq_table_f16` in `simsimd.h`.
+ *
+ *  The scans follow the "fast-scan" approach of Quicker ADC and FAISS, keeping the whole table in registers:
+ *
+ *  - The table is quantized to `u8` entries with `simsimd_pq_quantize_table`, so a 16-entry table per subspace
+ *    fits a 128-bit register, and byte shuffles like `pshufb` and `tbl` replace scalar gathers.
+ *  - Codes are transposed into blocks of `SIMSIMD_PQ_BLOCK` vectors, so every load brings the codes of the
+ *    same subspace for 32 different vectors, and every shuffle produces 32 table entries at once.
+ *  - Entries are summed with unsigned 16-bit saturating additions, and exported as `bias + scale * sum`.
+ *
+ *  For 4-bit codes a block stores `(subspaces + 1) / 2` rows of 32 bytes, the low nibble of byte `v` in row `j`
+ *  holding the code of vector `v` in subspace `2 * j`, and the high nibble - in subspace `2 * j + 1`.
+ *  For 8-bit codes a block stores `subspaces` rows of 32 bytes, one code per vector. The last block is
+ *  zero-padded, and `simsimd_pq_pack_u4x2` and `simsimd_pq_pack_u8` produce both layouts from row-major codes.
+ *
+ *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
+ *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
+ *  Quicker ADC: https://arxiv.org/abs/1812.09162
+ */
+#ifndef SIMSIMD_PQ_H
+#define SIMSIMD_PQ_H
+
+#include "types.h"
+
+/**
+ *  @brief  Number of database vectors interleaved in a single block of packed codes.
+ *          It's a property of the memory layout, matching the width of an AVX2 register, and can't be changed.
+ */
+#define SIMSIMD_PQ_BLOCK 32
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// clang-format off
+
+/*  Layout helpers, transposing `count` row-major codes with `subspaces` bytes each into blocks of
+ *  `SIMSIMD_PQ_BLOCK` vectors, and quantizing a floating-point ADC table with `centroids` entries per subspace
+ *  into `u8` entries, so that any sum of `table[j][c]` is close to `bias + scale * sum(quantized[j][c])`.
+ */
+SIMSIMD_PUBLIC void simsimd_pq_pack_u8(simsimd_u8_t const* codes, simsimd_size_t count, simsimd_size_t subspaces, simsimd_u8_t* packed);
+SIMSIMD_PUBLIC void simsimd_pq_pack_u4x2(simsimd_u8_t const* codes, simsimd_size_t count, simsimd_size_t subspaces, simsimd_u4x2_t* packed);
+SIMSIMD_PUBLIC void simsimd_pq_quantize_table(simsimd_f32_t const* table, simsimd_size_t subspaces, simsimd_size_t centroids, simsimd_u8_t* quantized, simsimd_distance_t* scale, simsimd_distance_t* bias);
+
+/*  Serial backends for both code sizes, exporting `count` approximate distances `bias + scale * sum`.
+ *  The `table` contains 256 entries per subspace for `u8` codes, and 16 entries per subspace for `u4x2` codes.
+ */
+SIMSIMD_PUBLIC void simsimd_pq_scan_u8_serial(simsimd_u8_t const* codes, simsimd_size_t count, simsimd_size_t subspaces, simsimd_u8_t const* table, simsimd_distance_t scale, simsimd_distance_t bias, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_pq_scan_u4x2_serial(simsimd_u4x2_t const* codes, simsimd_size_t count, simsimd_size_t subspaces, simsimd_u8_t const* table, simsimd_distance_t scale, simsimd_distance_t bias, simsimd_distance_t* results);
+
+/*  SIMD-powered backends for Arm NEON and SVE, using `tbl` lookups, with four chained lookups covering
+ *  the 256-entry tables of `u8` codes.
+ */
+SIMSIMD_PUBLIC void simsimd_pq_scan_u8_neon(simsimd_u8_t const* codes, simsimd_size_t count, simsimd_size_t subspaces, simsimd_u8_t const* table, simsimd_distance_t scale, simsimd_distance_t bias, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_pq_scan_u4x2_neon(simsimd_u4x2_t const* codes, simsimd_size_t count, simsimd_size_t subspaces, simsimd_u8_t const* table, simsimd_distance_t scale, simsimd_distance_t bias, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_pq_scan_u4x2_sve(simsimd_u4x2_t const* codes, simsimd_size_t count, simsimd_size_t subspaces, simsimd_u8_t const* table, simsimd_distance_t scale, simsimd_distance_t bias, simsimd_distance_t* results);
+
+/*  SIMD-powered backends for AVX2 and AVX512 CPUs, using `vpshufb` for the 16-entry tables of `u4x2` codes,
+ *  and two `vpermi2b` lookups, available since Ice Lake, for the 256-entry tables of `u8` codes.
+ */
+SIMSIMD_PUBLIC void simsimd_pq_scan_u4x2_haswell(simsimd_u4x2_t const* codes, simsimd_size_t count, simsimd_size_t subspaces, simsimd_u8_t const* table, simsimd_distance_t scale, simsimd_distance_t bias, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_pq_scan_u4x2_skylake(simsimd_u4x2_t const* codes, simsimd_size_t count, simsimd_size_t subspaces, simsimd_u8_t const* table, simsimd_distance_t scale, simsimd_distance_t bias, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_pq_scan_u8_ice(simsimd_u8_t const* codes, simsimd_size_t count, simsimd_size_t subspaces, simsimd_u8_t const* table, simsimd_distance_t scale, simsimd_distance_t bias, simsimd_distance_t* results);
+// clang-format on
+
+SIMSIMD_PUBLIC void simsimd_pq_pack_u8(simsimd_u8_t const *codes, simsimd_size_t count, simsimd_size_t subspaces,
+                                       simsimd_u8_t *packed) {
+    simsimd_size_t const blocks = (count + SIMSIMD_PQ_BLOCK - 1) / SIMSIMD_PQ_BLOCK;
+    for (simsimd_size_t i = 0; i != blocks * SIMSIMD_PQ_BLOCK * subspaces; ++i) packed[i] = 0;
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        simsimd_u8_t *block = packed + i / SIMSIMD_PQ_BLOCK * SIMSIMD_PQ_BLOCK * subspaces + i % SIMSIMD_PQ_BLOCK;
+        for (simsimd_size_t j = 0; j != subspaces; ++j) block[j * SIMSIMD_PQ_BLOCK] = codes[i * subspaces + j];
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_pq_pack_u4x2(simsimd_u8_t const *codes, simsimd_size_t count, simsimd_size_t subspaces,
+                                         simsimd_u4x2_t *packed) {
+    simsimd_size_t const blocks = (count + SIMSIMD_PQ_BLOCK - 1) / SIMSIMD_PQ_BLOCK;
+    simsimd_size_t const pairs = (subspaces + 1) / 2;
+    for (simsimd_size_t i = 0; i != blocks * SIMSIMD_PQ_BLOCK * pairs; ++i) packed[i] = 0;
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        simsimd_u4x2_t *block = packed + i / SIMSIMD_PQ_BLOCK * SIMSIMD_PQ_BLOCK * pairs + i % SIMSIMD_PQ_BLOCK;
+        for (simsimd_size_t j = 0; j != subspaces; ++j)
+            block[j / 2 * SIMSIMD_PQ_BLOCK] |= (simsimd_u4x2_t)((codes[i * subspaces + j] & 0x0F) << (j % 2 * 4));
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_pq_quantize_table(simsimd_f32_t const *table, simsimd_size_t subspaces,
+                                              simsimd_size_t centroids, simsimd_u8_t *quantized,
+                                              simsimd_distance_t *scale, simsimd_distance_t *bias) {
+    // Every subspace is shifted by its own minimum, and all of them share the same scale, chosen so that
+    // the largest entry fits into 8 bits and the sum of the largest entries fits into 16 bits.
+    simsimd_distance_t min_sum = 0, max_range = 0, range_sum = 0;
+    for (simsimd_size_t j = 0; j != subspaces; ++j) {
+        simsimd_f32_t const *row = table + j * centroids;
+        simsimd_f32_t min = row[0], max = row[0];
+        for (simsimd_size_t c = 1; c != centroids; ++c)
+            min = row[c] < min ? row[c] : min, max = row[c] > max ? row[c] : max;
+        min_sum += min, range_sum += max - min, max_range = max - min > max_range ? max - min : max_range;
+    }
+    simsimd_distance_t inverse = 1;
+    if (max_range > 0) {
+        inverse = 255 / max_range;
+        if (range_sum * inverse > 65535) inverse = 65535 / range_sum;
+    }
+    for (simsimd_size_t j = 0; j != subspaces; ++j) {
+        simsimd_f32_t const *row = table + j * centroids;
+        simsimd_f32_t min = row[0];
+        for (simsimd_size_t c = 1; c != centroids; ++c) min = row[c] < min ? row[c] : min;
+        for (simsimd_size_t c = 0; c != centroids; ++c) {
+            simsimd_distance_t entry = (row[c] - min) * inverse + 0.5;
+            quantized[j * centroids + c] = (simsimd_u8_t)(entry > 255 ? 255 : entry);
+        }
+    }
+    *scale = 1 / inverse, *bias = min_sum;
+}
+
+/**
+ *  @brief  Exports the 16-bit sums of a single block of codes, as approximate distances.
+ */
+SIMSIMD_INTERNAL void _simsimd_pq_export_serial(simsimd_u16_t const *sums, simsimd_size_t count,
+                                                simsimd_distance_t scale, simsimd_distance_t bias,
+                                                simsimd_distance_t *results) {
+    if (count > SIMSIMD_PQ_BLOCK) count = SIMSIMD_PQ_BLOCK;
+    for (simsimd_size_t i = 0; i != count; ++i) results[i] = bias + scale * sums[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_pq_scan_u8_serial(simsimd_u8_t const *codes, simsimd_size_t count, simsimd_size_t subspaces,
+                                              simsimd_u8_t const *table, simsimd_distance_t scale,
+                                              simsimd_distance_t bias, simsimd_distance_t *results) {
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        simsimd_u8_t const *block = codes + i / SIMSIMD_PQ_BLOCK * SIMSIMD_PQ_BLOCK * subspaces + i % SIMSIMD_PQ_BLOCK;
+        simsimd_u32_t sum = 0;
+        for (simsimd_size_t j = 0; j != subspaces; ++j) sum += table[j * 256 + block[j * SIMSIMD_PQ_BLOCK]];
+        // Saturating every addition of non-negative terms is identical to saturating the total
+        results[i] = bias + scale * (sum > 65535 ? 65535 : sum);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_pq_scan_u4x2_serial(simsimd_u4x2_t const *codes, simsimd_size_t count,
+                                                simsimd_size_t subspaces, simsimd_u8_t const *table,
+                                                simsimd_distance_t scale, simsimd_distance_t bias,
+                                                simsimd_distance_t *results) {
+    simsimd_size_t const pairs = (subspaces + 1) / 2;
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        simsimd_u4x2_t const *block = codes + i / SIMSIMD_PQ_BLOCK * SIMSIMD_PQ_BLOCK * pairs + i % SIMSIMD_PQ_BLOCK;
+        simsimd_u32_t sum = 0;
+        for (simsimd_size_t j = 0; j != subspaces; ++j) {
+            simsimd_u4x2_t code = block[j / 2 * SIMSIMD_PQ_BLOCK];
+            sum += table[j * 16 + (j % 2 ? code >> 4 : code & 0x0F)];
+        }
+        results[i] = bias + scale * (sum > 65535 ? 65535 : sum);
+    }
+}
+
+#if _SIMSIMD_TARGET_ARM
+#if SIMSIMD_TARGET_NEON
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+simd")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+simd"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_pq_scan_u8_neon(simsimd_u8_t const *codes, simsimd_size_t count, simsimd_size_t subspaces,
+                                            simsimd_u8_t const *table, simsimd_distance_t scale,
+                                            simsimd_distance_t bias, simsimd_distance_t *results) {
+    simsimd_u16_t sums[SIMSIMD_PQ_BLOCK];
+    uint8x16_t const offset_vec = vdupq_n_u8(64);
+    for (simsimd_size_t i = 0; i < count; i += SIMSIMD_PQ_BLOCK, codes += SIMSIMD_PQ_BLOCK * subspaces) {
+        uint16x8_t sums_vecs[4] = {vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0)};
+        for (simsimd_size_t j = 0; j != subspaces; ++j) {
+            simsimd_u8_t const *row = table + j * 256;
+            uint8x16x4_t first_vecs = vld1q_u8_x4(row), second_vecs = vld1q_u8_x4(row + 64);
+            uint8x16x4_t third_vecs = vld1q_u8_x4(row + 128), fourth_vecs = vld1q_u8_x4(row + 192);
+            for (simsimd_size_t half = 0; half != 2; ++half) {
+                // Every lookup covers 64 entries, and out-of-range indices keep the previous result
+                uint8x16_t codes_vec = vld1q_u8(codes + j * SIMSIMD_PQ_BLOCK + half * 16);
+                uint8x16_t entries_vec = vqtbl4q_u8(first_vecs, codes_vec);
+                codes_vec = vsubq_u8(codes_vec, offset_vec);
+                entries_vec = vqtbx4q_u8(entries_vec, second_vecs, codes_vec);
+                codes_vec = vsubq_u8(codes_vec, offset_vec);
+                entries_vec = vqtbx4q_u8(entries_vec, third_vecs, codes_vec);
+                codes_vec = vsubq_u8(codes_vec, offset_vec);
+                entries_vec = vqtbx4q_u8(entries_vec, fourth_vecs, codes_vec);
+                sums_vecs[half * 2] = vqaddq_u16(sums_vecs[half * 2], vmovl_u8(vget_low_u8(entries_vec)));
+                sums_vecs[half * 2 + 1] = vqaddq_u16(sums_vecs[half * 2 + 1], vmovl_high_u8(entries_vec));
+            }
+        }
+        for (simsimd_size_t k = 0; k != 4; ++k) vst1q_u16(sums + k * 8, sums_vecs[k]);
+        _simsimd_pq_export_serial(sums, count - i, scale, bias, results + i);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_pq_scan_u4x2_neon(simsimd_u4x2_t const *codes, simsimd_size_t count,
+                                              simsimd_size_t subspaces, simsimd_u8_t const *table,
+                                              simsimd_distance_t scale, simsimd_distance_t bias,
+                                              simsimd_distance_t *results) {
+    simsimd_size_t const pairs = (subspaces + 1) / 2;
+    simsimd_u16_t sums[SIMSIMD_PQ_BLOCK];
+    uint8x16_t const nibble_mask_vec = vdupq_n_u8(0x0F);
+    for (simsimd_size_t i = 0; i < count; i += SIMSIMD_PQ_BLOCK, codes += SIMSIMD_PQ_BLOCK * pairs) {
+        uint16x8_t sums_vecs[4] = {vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0)};
+        for (simsimd_size_t j = 0; j != pairs; ++j) {
+            // With an odd number of subspaces, the high nibbles of the last row select from an empty table
+            uint8x16_t low_table_vec = vld1q_u8(table + j * 32);
+            uint8x16_t high_table_vec = j * 2 + 1 < subspaces ? vld1q_u8(table + j * 32 + 16) : vdupq_n_u8(0);
+            for (simsimd_size_t half = 0; half != 2; ++half) {
+                uint8x16_t codes_vec = vld1q_u8(codes + j * SIMSIMD_PQ_BLOCK + half * 16);
+                uint8x16_t low_vec = vqtbl1q_u8(low_table_vec, vandq_u8(codes_vec, nibble_mask_vec));
+                uint8x16_t high_vec = vqtbl1q_u8(high_table_vec, vshrq_n_u8(codes_vec, 4));
+                uint16x8_t first_vec = vqaddq_u16(sums_vecs[half * 2], vmovl_u8(vget_low_u8(low_vec)));
+                uint16x8_t second_vec = vqaddq_u16(sums_vecs[half * 2 + 1], vmovl_high_u8(low_vec));
+                sums_vecs[half * 2] = vqaddq_u16(first_vec, vmovl_u8(vget_low_u8(high_vec)));
+                sums_vecs[half * 2 + 1] = vqaddq_u16(second_vec, vmovl_high_u8(high_vec));
+            }
+        }
+        for (simsimd_size_t k = 0; k != 4; ++k) vst1q_u16(sums + k * 8, sums_vecs[k]);
+        _simsimd_pq_export_serial(sums, count - i, scale, bias, results + i);
+    }
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON
+
+#if SIMSIMD_TARGET_SVE
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+sve")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+sve"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_pq_scan_u4x2_sve(simsimd_u4x2_t const *codes, simsimd_size_t count,
+                                             simsimd_size_t subspaces, simsimd_u8_t const *table,
+                                             simsimd_distance_t scale, simsimd_distance_t bias,
+                                             simsimd_distance_t *results) {
+    simsimd_size_t const pairs = (subspaces + 1) / 2;
+    simsimd_size_t const step = svcntb(), half = svcnth();
+    simsimd_u16_t sums[SIMSIMD_PQ_BLOCK];
+    // The tables occupy the first 16 lanes of a vector, and the rest of the lanes are zeroed
+    svbool_t const table_pg_vec = svwhilelt_b8((unsigned int)0, (unsigned int)16);
+    for (simsimd_size_t i = 0; i < count; i += SIMSIMD_PQ_BLOCK, codes += SIMSIMD_PQ_BLOCK * pairs) {
+        // A block of 32 codes may span several vectors on 128-bit implementations, or a part of one
+        for (simsimd_size_t k = 0; k < SIMSIMD_PQ_BLOCK; k += step) {
+            svbool_t pg_vec = svwhilelt_b8((unsigned int)k, (unsigned int)SIMSIMD_PQ_BLOCK);
+            svuint16_t low_sums_vec = svdup_n_u16(0), high_sums_vec = svdup_n_u16(0);
+            for (simsimd_size_t j = 0; j != pairs; ++j) {
+                svuint8_t low_table_vec = svld1_u8(table_pg_vec, table + j * 32);
+                svuint8_t high_table_vec =
+                    j * 2 + 1 < subspaces ? svld1_u8(table_pg_vec, table + j * 32 + 16) : svdup_n_u8(0);
+                svuint8_t codes_vec = svld1_u8(pg_vec, codes + j * SIMSIMD_PQ_BLOCK + k);
+                svuint8_t low_vec = svtbl_u8(low_table_vec, svand_n_u8_x(pg_vec, codes_vec, 0x0F));
+                svuint8_t high_vec = svtbl_u8(high_table_vec, svlsr_n_u8_x(pg_vec, codes_vec, 4));
+                low_sums_vec = svqadd_u16(svqadd_u16(low_sums_vec, svunpklo_u16(low_vec)), svunpklo_u16(high_vec));
+                high_sums_vec = svqadd_u16(svqadd_u16(high_sums_vec, svunpkhi_u16(low_vec)), svunpkhi_u16(high_vec));
+            }
+            svst1_u16(svwhilelt_b16((unsigned int)k, (unsigned int)SIMSIMD_PQ_BLOCK), sums + k, low_sums_vec);
+            svst1_u16(svwhilelt_b16((unsigned int)(k + half), (unsigned int)SIMSIMD_PQ_BLOCK), sums + k + half,
+                      high_sums_vec);
+        }
+        _simsimd_pq_export_serial(sums, count - i, scale, bias, results + i);
+    }
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SVE
+#endif // _SIMSIMD_TARGET_ARM
+
+#if _SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_HASWELL
+#pragma GCC push_options
+#pragma GCC target("avx2", "f16c", "fma")
+#pragma clang attribute push(__attribute__((target("avx2,f16c,fma"))), apply_to = function)
+
+/**
+ *  @brief  Reorders the 16-bit sums of interleaved bytes, accumulated with `unpacklo` and `unpackhi` within
+ *          128-bit lanes, back into the order of the 32 vectors in a block, and exports them.
+ */
+SIMSIMD_INTERNAL void _simsimd_pq_export_haswell(__m256i low_sums_vec, __m256i high_sums_vec, simsimd_size_t count,
+                                                 simsimd_distance_t scale, simsimd_distance_t bias,
+                                                 simsimd_distance_t *results) {
+    simsimd_u16_t sums[SIMSIMD_PQ_BLOCK];
+    _mm256_storeu_si256((__m256i *)sums, _mm256_permute2x128_si256(low_sums_vec, high_sums_vec, 0x20));
+    _mm256_storeu_si256((__m256i *)(sums + 16), _mm256_permute2x128_si256(low_sums_vec, high_sums_vec, 0x31));
+    _simsimd_pq_export_serial(sums, count, scale, bias, results);
+}
+
+SIMSIMD_PUBLIC void simsimd_pq_scan_u4x2_haswell(simsimd_u4x2_t const *codes, simsimd_size_t count,
+                                                 simsimd_size_t subspaces, simsimd_u8_t const *table,
+                                                 simsimd_distance_t scale, simsimd_distance_t bias,
+                                                 simsimd_distance_t *results) {
+    simsimd_size_t const pairs = (subspaces + 1) / 2;
+    __m256i const nibble_mask_vec = _mm256_set1_epi8(0x0F);
+    __m256i const zeros_vec = _mm256_setzero_si256();
+    for (simsimd_size_t i = 0; i < count; i += SIMSIMD_PQ_BLOCK, codes += SIMSIMD_PQ_BLOCK * pairs) {
+        __m256i low_sums_vec = _mm256_setzero_si256(), high_sums_vec = _mm256_setzero_si256();
+        for (simsimd_size_t j = 0; j != pairs; ++j) {
+            // With an odd number of subspaces, the high nibbles of the last row select from an empty table
+            __m256i low_table_vec = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)(table + j * 32)));
+            __m256i high_table_vec =
+                j * 2 + 1 < subspaces
+                    ? _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)(table + j * 32 + 16)))
+                    : zeros_vec;
+            __m256i codes_vec = _mm256_loadu_si256((__m256i const *)(codes + j * SIMSIMD_PQ_BLOCK));
+            __m256i low_vec = _mm256_shuffle_epi8(low_table_vec, _mm256_and_si256(codes_vec, nibble_mask_vec));
+            __m256i high_vec = _mm256_shuffle_epi8(
+                high_table_vec, _mm256_and_si256(_mm256_srli_epi16(codes_vec, 4), nibble_mask_vec));
+            low_sums_vec = _mm256_adds_epu16(low_sums_vec, _mm256_unpacklo_epi8(low_vec, zeros_vec));
+            high_sums_vec = _mm256_adds_epu16(high_sums_vec, _mm256_unpackhi_epi8(low_vec, zeros_vec));
+            low_sums_vec = _mm256_adds_epu16(low_sums_vec, _mm256_unpacklo_epi8(high_vec, zeros_vec));
+            high_sums_vec = _mm256_adds_epu16(high_sums_vec, _mm256_unpackhi_epi8(high_vec, zeros_vec));
+        }
+        _simsimd_pq_export_haswell(low_sums_vec, high_sums_vec, count - i, scale, bias, results + i);
+    }
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_HASWELL
+
+#if SIMSIMD_TARGET_SKYLAKE
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "avx512bw", "bmi2")
+#pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512vl,avx512bw,bmi2"))), apply_to = function)
+
+/**
+ *  @brief  Reorders and exports the 16-bit sums of a block, like `_simsimd_pq_export_haswell`,
+ *          compiled for the AVX512 targets, which don't imply the F16C and FMA extensions of Haswell.
+ */
+SIMSIMD_INTERNAL void _simsimd_pq_export_skylake(__m256i low_sums_vec, __m256i high_sums_vec, simsimd_size_t count,
+                                                 simsimd_distance_t scale, simsimd_distance_t bias,
+                                                 simsimd_distance_t *results) {
+    simsimd_u16_t sums[SIMSIMD_PQ_BLOCK];
+    _mm256_storeu_si256((__m256i *)sums, _mm256_permute2x128_si256(low_sums_vec, high_sums_vec, 0x20));
+    _mm256_storeu_si256((__m256i *)(sums + 16), _mm256_permute2x128_si256(low_sums_vec, high_sums_vec, 0x31));
+    _simsimd_pq_export_serial(sums, count, scale, bias, results);
+}
+
+SIMSIMD_PUBLIC void simsimd_pq_scan_u4x2_skylake(simsimd_u4x2_t const *codes, simsimd_size_t count,
+                                                 simsimd_size_t subspaces, simsimd_u8_t const *table,
+                                                 simsimd_distance_t scale, simsimd_distance_t bias,
+                                                 simsimd_distance_t *results) {
+    simsimd_size_t const pairs = (subspaces + 1) / 2;
+    __m512i const nibble_mask_vec = _mm512_set1_epi8(0x0F);
+    __m512i const zeros_vec = _mm512_setzero_si512();
+    for (simsimd_size_t i = 0; i < count; i += SIMSIMD_PQ_BLOCK, codes += SIMSIMD_PQ_BLOCK * pairs) {
+        __m512i low_sums_vec = _mm512_setzero_si512(), high_sums_vec = _mm512_setzero_si512();
+        // Two rows of codes at a time, with the tables of 4 consecutive subspaces in one register,
+        // so that the lower 256 bits hold the row `j`, and the upper 256 bits hold the row `j + 1`
+        for (simsimd_size_t j = 0; j < pairs; j += 2) {
+            __mmask64 codes_mask = j + 1 < pairs ? 0xFFFFFFFFFFFFFFFFull : 0x00000000FFFFFFFFull;
+            simsimd_size_t tables_bytes = (subspaces - j * 2) * 16;
+            __mmask64 tables_mask = (__mmask64)_bzhi_u64(0xFFFFFFFFFFFFFFFFull, tables_bytes < 64 ? tables_bytes : 64);
+            __m512i tables_vec = _mm512_maskz_loadu_epi8(tables_mask, table + j * 32);
+            __m512i low_table_vec = _mm512_shuffle_i64x2(tables_vec, tables_vec, _MM_SHUFFLE(2, 2, 0, 0));
+            __m512i high_table_vec = _mm512_shuffle_i64x2(tables_vec, tables_vec, _MM_SHUFFLE(3, 3, 1, 1));
+            __m512i codes_vec = _mm512_maskz_loadu_epi8(codes_mask, codes + j * SIMSIMD_PQ_BLOCK);
+            __m512i low_vec = _mm512_shuffle_epi8(low_table_vec, _mm512_and_si512(codes_vec, nibble_mask_vec));
+            __m512i high_vec = _mm512_shuffle_epi8(
+                high_table_vec, _mm512_and_si512(_mm512_srli_epi16(codes_vec, 4), nibble_mask_vec));
+            low_sums_vec = _mm512_adds_epu16(low_sums_vec, _mm512_unpacklo_epi8(low_vec, zeros_vec));
+            high_sums_vec = _mm512_adds_epu16(high_sums_vec, _mm512_unpackhi_epi8(low_vec, zeros_vec));
+            low_sums_vec = _mm512_adds_epu16(low_sums_vec, _mm512_unpacklo_epi8(high_vec, zeros_vec));
+            high_sums_vec = _mm512_adds_epu16(high_sums_vec, _mm512_unpackhi_epi8(high_vec, zeros_vec));
+        }
+        __m256i low_sums_ymm = _mm256_adds_epu16(_mm512_castsi512_si256(low_sums_vec),
+                                                 _mm512_extracti64x4_epi64(low_sums_vec, 1));
+        __m256i high_sums_ymm = _mm256_adds_epu16(_mm512_castsi512_si256(high_sums_vec),
+                                                  _mm512_extracti64x4_epi64(high_sums_vec, 1));
+        _simsimd_pq_export_skylake(low_sums_ymm, high_sums_ymm, count - i, scale, bias, results + i);
+    }
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SKYLAKE
+
+#if SIMSIMD_TARGET_ICE
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "bmi2", "avx512bw", "avx512vnni", "avx512vbmi")
+#pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512vl,bmi2,avx512bw,avx512vnni,avx512vbmi"))), \
+                             apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_pq_scan_u8_ice(simsimd_u8_t const *codes, simsimd_size_t count, simsimd_size_t subspaces,
+                                           simsimd_u8_t const *table, simsimd_distance_t scale,
+                                           simsimd_distance_t bias, simsimd_distance_t *results) {
+    __m512i const zeros_vec = _mm512_setzero_si512();
+    simsimd_size_t const block_bytes = SIMSIMD_PQ_BLOCK * subspaces;
+    // Two blocks at a time, so that the lower 256 bits hold the codes of the first block,
+    // and the upper 256 bits hold the same subspace for the next block
+    for (simsimd_size_t i = 0; i < count; i += SIMSIMD_PQ_BLOCK * 2, codes += block_bytes * 2) {
+        int const has_next = i + SIMSIMD_PQ_BLOCK < count;
+        __m512i low_sums_vec = _mm512_setzero_si512(), high_sums_vec = _mm512_setzero_si512();
+        for (simsimd_size_t j = 0; j != subspaces; ++j) {
+            simsimd_u8_t const *row = table + j * 256;
+            simsimd_u8_t const *first = codes + j * SIMSIMD_PQ_BLOCK, *next = first + block_bytes;
+            __m256i first_vec = _mm256_loadu_si256((__m256i const *)first);
+            __m256i next_vec = has_next ? _mm256_loadu_si256((__m256i const *)next) : _mm256_setzero_si256();
+            __m512i codes_vec = _mm512_inserti64x4(_mm512_castsi256_si512(first_vec), next_vec, 1);
+            // Each `vpermi2b` covers 128 entries with the lower 7 bits, and the top bit selects between them
+            __m512i bottom_vec = _mm512_permutex2var_epi8(_mm512_loadu_si512(row), codes_vec,
+                                                          _mm512_loadu_si512(row + 64));
+            __m512i top_vec = _mm512_permutex2var_epi8(_mm512_loadu_si512(row + 128), codes_vec,
+                                                       _mm512_loadu_si512(row + 192));
+            __m512i entries_vec = _mm512_mask_blend_epi8(_mm512_movepi8_mask(codes_vec), bottom_vec, top_vec);
+            low_sums_vec = _mm512_adds_epu16(low_sums_vec, _mm512_unpacklo_epi8(entries_vec, zeros_vec));
+            high_sums_vec = _mm512_adds_epu16(high_sums_vec, _mm512_unpackhi_epi8(entries_vec, zeros_vec));
+        }
+        _simsimd_pq_export_skylake(_mm512_castsi512_si256(low_sums_vec), _mm512_castsi512_si256(high_sums_vec),
+                                   count - i, scale, bias, results + i);
+        if (has_next)
+            _simsimd_pq_export_skylake(_mm512_extracti64x4_epi64(low_sums_vec, 1),
+                                       _mm512_extracti64x4_epi64(high_sums_vec, 1), count - i - SIMSIMD_PQ_BLOCK,
+                                       scale, bias, results + i + SIMSIMD_PQ_BLOCK);
+    }
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_ICE
+#endif // _SIMSIMD_TARGET_X86
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1010 @@
+/**
+ *  @file       reduce.h
+ *  @brief      SIMD-accelerated horizontal reductions of dense vectors.
+ *  @author     Ash Vardanian
+ *  @date       October 15, 2026
+ *
+ *  Contains:
+ *  - Sum of all elements
+ *  - L1 norm, or the sum of absolute values
+ *  - L2 norm, or the square root of the sum of squares
+ *  - Minimum and maximum, along with the index of their first occurrence
+ *
+ *  For datatypes:
+ *  - 64-bit IEEE floating point numbers
+ *  - 32-bit IEEE floating point numbers
+ *  - 16-bit IEEE floating point numbers
+ *  - 16-bit brain floating point numbers
+ *  - 8-bit unsigned integers
+ *  - 8-bit signed integers
+ *
+ *  For hardware architectures:
+ *  - Arm: NEON
+ *  - x86: Haswell, Skylake
+ *
+ *  Every kernel reduces `count` rows of `n` elements, each `stride` bytes apart, producing one result per row,
+ *  so a single vector is just a batch of one, and the rows of a `cdist` output can be searched in one call.
+ *  Sums and norms are exported in double precision. Like the dot-products, `f32`, `f16`, and `bf16` inputs are
+ *  accumulated in single precision, while integers are accumulated exactly. The `min` and `max` kernels also
+ *  export the index of the first occurrence of the extremum in every row, unless `indices` is null.
+ *  NaNs are skipped, and rows without comparable elements, including empty ones, report an infinity at index 0.
+ *
+ *  The SIMD `max` kernels reuse the `min` ones, reversing the order of the inputs on the fly: flipping the sign bit
+ *  of floats and all the bits of integers. Floating-point kernels track the minimum in every lane along with the
+ *  iteration it was last updated on, and only resolve the ties between lanes at the end. Integer kernels find the
+ *  minimum first, and then search for its first occurrence, which costs a second pass over the row prefix.
+ *
+ *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
+ *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
+ */
+#ifndef SIMSIMD_REDUCE_H
+#define SIMSIMD_REDUCE_H
+
+#include "types.h"
+
+#include "dot.h"     // `_simsimd_reduce_f32x8_haswell`, `_simsimd_partial_load_f16x8_haswell`
+#include "spatial.h" // `_simsimd_sqrt_f64_haswell`, `_simsimd_sqrt_f64_neon`
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// clang-format off
+
+/*  Serial backends for all numeric types.
+ *  By default they use 32-bit arithmetic, unless the arguments themselves contain 64-bit floats.
+ *  For double-precision computation check out the "*_accurate" variants of those "*_serial" functions.
+ */
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f64_serial(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f64_serial(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f64_serial(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_f64_serial(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_f64_serial(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f32_serial(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f32_serial(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f32_serial(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_f32_serial(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_f32_serial(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f16_serial(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f16_serial(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f16_serial(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_f16_serial(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_f16_serial(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_bf16_serial(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_bf16_serial(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_bf16_serial(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_bf16_serial(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_bf16_serial(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_i8_serial(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_i8_serial(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_i8_serial(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_i8_serial(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_i8_serial(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_u8_serial(simsimd_u8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_u8_serial(simsimd_u8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_u8_serial(simsimd_u8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_u8_serial(simsimd_u8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_u8_serial(simsimd_u8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+/*  Double-precision serial backends for all numeric types.
+ *  For single-precision computation check out the "*_serial" counterparts of those "*_accurate" functions.
+ */
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f32_accurate(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f32_accurate(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f32_accurate(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f16_accurate(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f16_accurate(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f16_accurate(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_bf16_accurate(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_bf16_accurate(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_bf16_accurate(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+
+/*  SIMD-powered backends for Arm NEON, mostly using 32-bit arithmetic over 128-bit words.
+ *  By far the most portable backend, covering most Arm v8 devices, over a billion iPhones, and almost all
+ *  server CPUs produced before 2023.
+ */
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f32_neon(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f32_neon(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f32_neon(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_f32_neon(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_f32_neon(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+/*  SIMD-powered backends for AVX2 CPUs of Haswell generation and newer, using 32-bit arithmetic over 256-bit words.
+ *  First demonstrated in 2011, at least one Haswell-based processor was still being sold in 2022 — the Pentium G3420.
+ *  Practically all modern x86 CPUs support AVX2, FMA, and F16C, making it a perfect baseline for SIMD algorithms.
+ *  Integer sums rely on `vpsadbw` against zero, producing 64-bit partial sums that never overflow.
+ */
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f64_haswell(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f64_haswell(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f64_haswell(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_f64_haswell(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_f64_haswell(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f32_haswell(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f32_haswell(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f32_haswell(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_f32_haswell(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_f32_haswell(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f16_haswell(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f16_haswell(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f16_haswell(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_f16_haswell(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_f16_haswell(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_bf16_haswell(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_bf16_haswell(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_bf16_haswell(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_bf16_haswell(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_bf16_haswell(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_i8_haswell(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_i8_haswell(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_i8_haswell(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_i8_haswell(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_i8_haswell(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_u8_haswell(simsimd_u8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_u8_haswell(simsimd_u8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_u8_haswell(simsimd_u8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_u8_haswell(simsimd_u8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_u8_haswell(simsimd_u8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+/*  SIMD-powered backends for AVX512 CPUs of Skylake generation and newer, using masked loads for the tails
+ *  and the built-in horizontal reductions of 512-bit registers.
+ */
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f64_skylake(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f64_skylake(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f64_skylake(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_f64_skylake(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_f64_skylake(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f32_skylake(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f32_skylake(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f32_skylake(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_reduce_min_f32_skylake(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+SIMSIMD_PUBLIC void simsimd_reduce_max_f32_skylake(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* values, simsimd_size_t* indices);
+// clang-format on
+
+#define SIMSIMD_MAKE_REDUCE_SUM(name, input_type, accumulator_type, load_and_convert)                             \
+    SIMSIMD_PUBLIC void simsimd_reduce_sum_##input_type##_##name(simsimd_##input_type##_t const *rows,            \
+                                                                 simsimd_size_t count, simsimd_size_t stride,     \
+                                                                 simsimd_size_t n, simsimd_distance_t *results) { \
+        for (simsimd_size_t i = 0; i != count; ++i) {                                                             \
+            simsimd_##input_type##_t const *row = SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, i);         \
+            simsimd_##accumulator_type##_t sum = 0;                                                               \
+            for (simsimd_size_t j = 0; j != n; ++j) {                                                             \
+                simsimd_##accumulator_type##_t x = load_and_convert(row + j);                                     \
+                sum += x;                                                                                         \
+            }                                                                                                     \
+            results[i] = (simsimd_distance_t)sum;                                                                 \
+        }                                                                                                         \
+    }
+
+#define SIMSIMD_MAKE_REDUCE_L1(name, input_type, accumulator_type, load_and_convert)                             \
+    SIMSIMD_PUBLIC void simsimd_reduce_l1_##input_type##_##name(simsimd_##input_type##_t const *rows,            \
+                                                                simsimd_size_t count, simsimd_size_t stride,     \
+                                                                simsimd_size_t n, simsimd_distance_t *results) { \
+        for (simsimd_size_t i = 0; i != count; ++i) {                                                            \
+            simsimd_##input_type##_t const *row = SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, i);        \
+            simsimd_##accumulator_type##_t sum = 0;                                                              \
+            for (simsimd_size_t j = 0; j != n; ++j) {                                                            \
+                simsimd_##accumulator_type##_t x = load_and_convert(row + j);                                    \
+                sum += x < 0 ? -x : x;                                                                           \
+            }                                                                                                    \
+            results[i] = (simsimd_distance_t)sum;                                                                \
+        }                                                                                                        \
+    }
+
+#define SIMSIMD_MAKE_REDUCE_L2(name, input_type, accumulator_type, load_and_convert)                             \
+    SIMSIMD_PUBLIC void simsimd_reduce_l2_##input_type##_##name(simsimd_##input_type##_t const *rows,            \
+                                                                simsimd_size_t count, simsimd_size_t stride,     \
+                                                                simsimd_size_t n, simsimd_distance_t *results) { \
+        for (simsimd_size_t i = 0; i != count; ++i) {                                                            \
+            simsimd_##input_type##_t const *row = SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, i);        \
+            simsimd_##accumulator_type##_t sum = 0;                                                              \
+            for (simsimd_size_t j = 0; j != n; ++j) {                                                            \
+                simsimd_##accumulator_type##_t x = load_and_convert(row + j);                                    \
+                sum += x * x;                                                                                    \
+            }                                                                                                    \
+            results[i] = SIMSIMD_SQRT((simsimd_distance_t)sum);                                                  \
+        }                                                                                                        \
+    }
+
+#define SIMSIMD_MAKE_REDUCE_MINMAX(name, input_type, load_and_convert)                                       \
+    SIMSIMD_PUBLIC void simsimd_reduce_min_##input_type##_##name(                                            \
+        simsimd_##input_type##_t const *rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, \
+        simsimd_distance_t *values, simsimd_size_t *indices) {                                               \
+        for (simsimd_size_t i = 0; i != count; ++i) {                                                        \
+            simsimd_##input_type##_t const *row = SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, i);    \
+            simsimd_distance_t best = _simsimd_f64_infinity();                                               \
+            simsimd_size_t best_index = 0;                                                                   \
+            for (simsimd_size_t j = 0; j != n; ++j) {                                                        \
+                simsimd_distance_t x = load_and_convert(row + j);                                            \
+                if (x < best) best = x, best_index = j;                                                      \
+            }                                                                                                \
+            values[i] = best;                                                                                \
+            if (indices) indices[i] = best_index;                                                            \
+        }                                                                                                    \
+    }                                                                                                        \
+    SIMSIMD_PUBLIC void simsimd_reduce_max_##input_type##_##name(                                            \
+        simsimd_##input_type##_t const *rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, \
+        simsimd_distance_t *values, simsimd_size_t *indices) {                                               \
+        for (simsimd_size_t i = 0; i != count; ++i) {                                                        \
+            simsimd_##input_type##_t const *row = SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, i);    \
+            simsimd_distance_t best = -_simsimd_f64_infinity();                                              \
+            simsimd_size_t best_index = 0;                                                                   \
+            for (simsimd_size_t j = 0; j != n; ++j) {                                                        \
+                simsimd_distance_t x = load_and_convert(row + j);                                            \
+                if (x > best) best = x, best_index = j;                                                      \
+            }                                                                                                \
+            values[i] = best;                                                                                \
+            if (indices) indices[i] = best_index;                                                            \
+        }                                                                                                    \
+    }
+
+SIMSIMD_MAKE_REDUCE_SUM(serial, f64, f64, SIMSIMD_DEREFERENCE) // simsimd_reduce_sum_f64_serial
+SIMSIMD_MAKE_REDUCE_L1(serial, f64, f64, SIMSIMD_DEREFERENCE)  // simsimd_reduce_l1_f64_serial
+SIMSIMD_MAKE_REDUCE_L2(serial, f64, f64, SIMSIMD_DEREFERENCE)  // simsimd_reduce_l2_f64_serial
+SIMSIMD_MAKE_REDUCE_MINMAX(serial, f64, SIMSIMD_DEREFERENCE)   // simsimd_reduce_min_f64_serial
+
+SIMSIMD_MAKE_REDUCE_SUM(serial, f32, f32, SIMSIMD_DEREFERENCE) // simsimd_reduce_sum_f32_serial
+SIMSIMD_MAKE_REDUCE_L1(serial, f32, f32, SIMSIMD_DEREFERENCE)  // simsimd_reduce_l1_f32_serial
+SIMSIMD_MAKE_REDUCE_L2(serial, f32, f32, SIMSIMD_DEREFERENCE)  // simsimd_reduce_l2_f32_serial
+SIMSIMD_MAKE_REDUCE_MINMAX(serial, f32, SIMSIMD_DEREFERENCE)   // simsimd_reduce_min_f32_serial
+
+SIMSIMD_MAKE_REDUCE_SUM(serial, f16, f32, SIMSIMD_F16_TO_F32) // simsimd_reduce_sum_f16_serial
+SIMSIMD_MAKE_REDUCE_L1(serial, f16, f32, SIMSIMD_F16_TO_F32)  // simsimd_reduce_l1_f16_serial
+SIMSIMD_MAKE_REDUCE_L2(serial, f16, f32, SIMSIMD_F16_TO_F32)  // simsimd_reduce_l2_f16_serial
+SIMSIMD_MAKE_REDUCE_MINMAX(serial, f16, SIMSIMD_F16_TO_F32)   // simsimd_reduce_min_f16_serial
+
+SIMSIMD_MAKE_REDUCE_SUM(serial, bf16, f32, SIMSIMD_BF16_TO_F32) // simsimd_reduce_sum_bf16_serial
+SIMSIMD_MAKE_REDUCE_L1(serial, bf16, f32, SIMSIMD_BF16_TO_F32)  // simsimd_reduce_l1_bf16_serial
+SIMSIMD_MAKE_REDUCE_L2(serial, bf16, f32, SIMSIMD_BF16_TO_F32)  // simsimd_reduce_l2_bf16_serial
+SIMSIMD_MAKE_REDUCE_MINMAX(serial, bf16, SIMSIMD_BF16_TO_F32)   // simsimd_reduce_min_bf16_serial
+
+SIMSIMD_MAKE_REDUCE_SUM(serial, i8, i64, SIMSIMD_DEREFERENCE) // simsimd_reduce_sum_i8_serial
+SIMSIMD_MAKE_REDUCE_L1(serial, i8, i64, SIMSIMD_DEREFERENCE)  // simsimd_reduce_l1_i8_serial
+SIMSIMD_MAKE_REDUCE_L2(serial, i8, i64, SIMSIMD_DEREFERENCE)  // simsimd_reduce_l2_i8_serial
+SIMSIMD_MAKE_REDUCE_MINMAX(serial, i8, SIMSIMD_DEREFERENCE)   // simsimd_reduce_min_i8_serial
+
+SIMSIMD_MAKE_REDUCE_SUM(serial, u8, i64, SIMSIMD_DEREFERENCE) // simsimd_reduce_sum_u8_serial
+SIMSIMD_MAKE_REDUCE_L1(serial, u8, i64, SIMSIMD_DEREFERENCE)  // simsimd_reduce_l1_u8_serial
+SIMSIMD_MAKE_REDUCE_L2(serial, u8, i64, SIMSIMD_DEREFERENCE)  // simsimd_reduce_l2_u8_serial
+SIMSIMD_MAKE_REDUCE_MINMAX(serial, u8, SIMSIMD_DEREFERENCE)   // simsimd_reduce_min_u8_serial
+
+SIMSIMD_MAKE_REDUCE_SUM(accurate, f32, f64, SIMSIMD_DEREFERENCE) // simsimd_reduce_sum_f32_accurate
+SIMSIMD_MAKE_REDUCE_L1(accurate, f32, f64, SIMSIMD_DEREFERENCE)  // simsimd_reduce_l1_f32_accurate
+SIMSIMD_MAKE_REDUCE_L2(accurate, f32, f64, SIMSIMD_DEREFERENCE)  // simsimd_reduce_l2_f32_accurate
+
+SIMSIMD_MAKE_REDUCE_SUM(accurate, f16, f64, SIMSIMD_F16_TO_F32) // simsimd_reduce_sum_f16_accurate
+SIMSIMD_MAKE_REDUCE_L1(accurate, f16, f64, SIMSIMD_F16_TO_F32)  // simsimd_reduce_l1_f16_accurate
+SIMSIMD_MAKE_REDUCE_L2(accurate, f16, f64, SIMSIMD_F16_TO_F32)  // simsimd_reduce_l2_f16_accurate
+
+SIMSIMD_MAKE_REDUCE_SUM(accurate, bf16, f64, SIMSIMD_BF16_TO_F32) // simsimd_reduce_sum_bf16_accurate
+SIMSIMD_MAKE_REDUCE_L1(accurate, bf16, f64, SIMSIMD_BF16_TO_F32)  // simsimd_reduce_l1_bf16_accurate
+SIMSIMD_MAKE_REDUCE_L2(accurate, bf16, f64, SIMSIMD_BF16_TO_F32)  // simsimd_reduce_l2_bf16_accurate
+
+/**
+ *  @brief  Resolves the ties between the lanes of a vectorized `argmin`, given the minimum of every lane, and the
+ *          iteration it was found on. Shared by all SIMD backends, as it only runs once per row.
+ */
+SIMSIMD_INTERNAL void _simsimd_reduce_argmin_lanes(simsimd_f64_t const *mins, simsimd_u64_t const *iterations,
+                                                   simsimd_size_t lanes, simsimd_distance_t *value,
+                                                   simsimd_size_t *index) {
+    simsimd_f64_t best = mins[0];
+    simsimd_size_t best_index = (simsimd_size_t)iterations[0] * lanes;
+    for (simsimd_size_t lane = 1; lane != lanes; ++lane) {
+        simsimd_size_t lane_index = (simsimd_size_t)iterations[lane] * lanes + lane;
+        if (mins[lane] < best || (mins[lane] == best && lane_index < best_index))
+            best = mins[lane], best_index = lane_index;
+    }
+    *value = best, *index = best_index;
+}
+
+#if _SIMSIMD_TARGET_ARM
+#if SIMSIMD_TARGET_NEON
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+simd")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+simd"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f32_neon(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                                simsimd_size_t n, simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f32_t const *row = SIMSIMD_ROW(simsimd_f32_t, rows, stride, r);
+        float32x4_t sum_vec = vdupq_n_f32(0);
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4) sum_vec = vaddq_f32(sum_vec, vld1q_f32(row + i));
+        if (i < n) sum_vec = vaddq_f32(sum_vec, _simsimd_partial_load_f32x4_neon(row + i, n - i));
+        results[r] = vaddvq_f32(sum_vec);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f32_neon(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                               simsimd_size_t n, simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f32_t const *row = SIMSIMD_ROW(simsimd_f32_t, rows, stride, r);
+        float32x4_t sum_vec = vdupq_n_f32(0);
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4) sum_vec = vaddq_f32(sum_vec, vabsq_f32(vld1q_f32(row + i)));
+        if (i < n) sum_vec = vaddq_f32(sum_vec, vabsq_f32(_simsimd_partial_load_f32x4_neon(row + i, n - i)));
+        results[r] = vaddvq_f32(sum_vec);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f32_neon(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                               simsimd_size_t n, simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f32_t const *row = SIMSIMD_ROW(simsimd_f32_t, rows, stride, r);
+        float32x4_t sum_vec = vdupq_n_f32(0), x_vec;
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4) x_vec = vld1q_f32(row + i), sum_vec = vfmaq_f32(sum_vec, x_vec, x_vec);
+        if (i < n) x_vec = _simsimd_partial_load_f32x4_neon(row + i, n - i), sum_vec = vfmaq_f32(sum_vec, x_vec, x_vec);
+        results[r] = _simsimd_sqrt_f64_neon(vaddvq_f32(sum_vec));
+    }
+}
+
+/**
+ *  @brief  Minimum of a row and the index of its first occurrence, with every input XOR-ed with `flip`,
+ *          to search for the maximum with the same code, when only the sign bit is set.
+ */
+SIMSIMD_INTERNAL void _simsimd_reduce_argmin_f32_neon(simsimd_f32_t const *a, simsimd_size_t n, uint32x4_t flip_vec,
+                                                      simsimd_distance_t *value, simsimd_size_t *index) {
+    float32x4_t min_vec = vdupq_n_f32((simsimd_f32_t)_simsimd_f64_infinity());
+    uint32x4_t iterations_vec = vdupq_n_u32(0), iteration_vec = vdupq_n_u32(0);
+    uint32x4_t const one_vec = vdupq_n_u32(1);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t x_vec = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vld1q_f32(a + i)), flip_vec));
+        uint32x4_t less_vec = vcltq_f32(x_vec, min_vec);
+        min_vec = vbslq_f32(less_vec, x_vec, min_vec);
+        iterations_vec = vbslq_u32(less_vec, iteration_vec, iterations_vec);
+        iteration_vec = vaddq_u32(iteration_vec, one_vec);
+    }
+    if (i < n) {
+        simsimd_u32_t const lanes[4] = {0, 1, 2, 3};
+        uint32x4_t tail_vec = vcltq_u32(vld1q_u32(lanes), vdupq_n_u32((simsimd_u32_t)(n - i)));
+        float32x4_t x_vec = _simsimd_partial_load_f32x4_neon(a + i, n - i);
+        x_vec = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(x_vec), flip_vec));
+        uint32x4_t less_vec = vandq_u32(vcltq_f32(x_vec, min_vec), tail_vec);
+        min_vec = vbslq_f32(less_vec, x_vec, min_vec);
+        iterations_vec = vbslq_u32(less_vec, iteration_vec, iterations_vec);
+    }
+    simsimd_f32_t mins_f32[4];
+    simsimd_u32_t iterations_u32[4];
+    simsimd_f64_t mins[4];
+    simsimd_u64_t iterations[4];
+    vst1q_f32(mins_f32, min_vec);
+    vst1q_u32(iterations_u32, iterations_vec);
+    for (int lane = 0; lane != 4; ++lane) mins[lane] = mins_f32[lane], iterations[lane] = iterations_u32[lane];
+    _simsimd_reduce_argmin_lanes(mins, iterations, 4, value, index);
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_min_f32_neon(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                                simsimd_size_t n, simsimd_distance_t *values,
+                                                simsimd_size_t *indices) {
+    simsimd_size_t index;
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        _simsimd_reduce_argmin_f32_neon(SIMSIMD_ROW(simsimd_f32_t, rows, stride, r), n, vdupq_n_u32(0), values + r,
+                                        &index);
+        if (indices) indices[r] = index;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_max_f32_neon(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                                simsimd_size_t n, simsimd_distance_t *values,
+                                                simsimd_size_t *indices) {
+    simsimd_size_t index;
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        _simsimd_reduce_argmin_f32_neon(SIMSIMD_ROW(simsimd_f32_t, rows, stride, r), n, vdupq_n_u32(0x80000000u),
+                                        values + r, &index);
+        values[r] = -values[r];
+        if (indices) indices[r] = index;
+    }
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON
+#endif // _SIMSIMD_TARGET_ARM
+
+#if _SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_HASWELL
+#pragma GCC push_options
+#pragma GCC target("avx2", "f16c", "fma")
+#pragma clang attribute push(__attribute__((target("avx2,f16c,fma"))), apply_to = function)
+
+SIMSIMD_INTERNAL __m256 _simsimd_partial_load_f32x8_haswell(simsimd_f32_t const *a, simsimd_size_t n) {
+    __m256i mask_vec = _mm256_cmpgt_epi32(_mm256_set1_epi32((int)n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    return _mm256_maskload_ps(a, mask_vec);
+}
+SIMSIMD_INTERNAL __m256d _simsimd_partial_load_f64x4_haswell(simsimd_f64_t const *a, simsimd_size_t n) {
+    __m256i mask_vec = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)n), _mm256_setr_epi64x(0, 1, 2, 3));
+    return _mm256_maskload_pd(a, mask_vec);
+}
+SIMSIMD_INTERNAL __m256 _simsimd_load_f32x8_haswell(simsimd_f32_t const *a) { return _mm256_loadu_ps(a); }
+SIMSIMD_INTERNAL __m256 _simsimd_load_f16x8_haswell(simsimd_f16_t const *a) {
+    return _mm256_cvtph_ps(_mm_loadu_si128((__m128i const *)a));
+}
+SIMSIMD_INTERNAL __m256 _simsimd_load_bf16x8_haswell(simsimd_bf16_t const *a) {
+    return _simsimd_bf16x8_to_f32x8_haswell(_mm_loadu_si128((__m128i const *)a));
+}
+SIMSIMD_INTERNAL __m256 _simsimd_partial_load_bf16x8_as_f32x8_haswell(simsimd_bf16_t const *a, simsimd_size_t n) {
+    return _simsimd_bf16x8_to_f32x8_haswell(_simsimd_partial_load_bf16x8_haswell(a, n));
+}
+
+/**
+ *  @brief  Sums, L1 norms, L2 norms, minimums, and maximums of rows of `f32`, `f16`, or `bf16` scalars,
+ *          upcast to `f32` with `load` for full 8-element chunks, and `partial_load` for zero-padded tails.
+ */
+#define SIMSIMD_MAKE_REDUCE_F32X8_HASWELL(input_type, load, partial_load)                                            \
+    SIMSIMD_PUBLIC void simsimd_reduce_sum_##input_type##_haswell(simsimd_##input_type##_t const *rows,              \
+                                                                  simsimd_size_t count, simsimd_size_t stride,       \
+                                                                  simsimd_size_t n, simsimd_distance_t *results) {   \
+        for (simsimd_size_t r = 0; r != count; ++r) {                                                                \
+            simsimd_##input_type##_t const *row = SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, r);            \
+            __m256 sum_vec = _mm256_setzero_ps();                                                                    \
+            simsimd_size_t i = 0;                                                                                    \
+            for (; i + 8 <= n; i += 8) sum_vec = _mm256_add_ps(sum_vec, load(row + i));                              \
+            if (i < n) sum_vec = _mm256_add_ps(sum_vec, partial_load(row + i, n - i));                               \
+            results[r] = _simsimd_reduce_f32x8_haswell(sum_vec);                                                     \
+        }                                                                                                            \
+    }                                                                                                                \
+    SIMSIMD_PUBLIC void simsimd_reduce_l1_##input_type##_haswell(simsimd_##input_type##_t const *rows,               \
+                                                                 simsimd_size_t count, simsimd_size_t stride,        \
+                                                                 simsimd_size_t n, simsimd_distance_t *results) {    \
+        __m256 const sign_vec = _mm256_set1_ps(-0.0f);                                                               \
+        for (simsimd_size_t r = 0; r != count; ++r) {                                                                \
+            simsimd_##input_type##_t const *row = SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, r);            \
+            __m256 sum_vec = _mm256_setzero_ps();                                                                    \
+            simsimd_size_t i = 0;                                                                                    \
+            for (; i + 8 <= n; i += 8) sum_vec = _mm256_add_ps(sum_vec, _mm256_andnot_ps(sign_vec, load(row + i)));  \
+            if (i < n)                                                                                               \
+                sum_vec = _mm256_add_ps(sum_vec, _mm256_andnot_ps(sign_vec, partial_load(row + i, n - i)));          \
+            results[r] = _simsimd_reduce_f32x8_haswell(sum_vec);                                                     \
+        }                                                                                                            \
+    }                                                                                                                \
+    SIMSIMD_PUBLIC void simsimd_reduce_l2_##input_type##_haswell(simsimd_##input_type##_t const *rows,               \
+                                                                 simsimd_size_t count, simsimd_size_t stride,        \
+                                                                 simsimd_size_t n, simsimd_distance_t *results) {    \
+        for (simsimd_size_t r = 0; r != count; ++r) {                                                                \
+            simsimd_##input_type##_t const *row = SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, r);            \
+            __m256 sum_vec = _mm256_setzero_ps(), x_vec;                                                             \
+            simsimd_size_t i = 0;                                                                                    \
+            for (; i + 8 <= n; i += 8) x_vec = load(row + i), sum_vec = _mm256_fmadd_ps(x_vec, x_vec, sum_vec);      \
+            if (i < n) x_vec = partial_load(row + i, n - i), sum_vec = _mm256_fmadd_ps(x_vec, x_vec, sum_vec);       \
+            results[r] = _simsimd_sqrt_f64_haswell(_simsimd_reduce_f32x8_haswell(sum_vec));                          \
+        }                                                                                                            \
+    }                                                                                                                \
+    SIMSIMD_INTERNAL void _simsimd_reduce_argmin_##input_type##_haswell(simsimd_##input_type##_t const *a,           \
+                                                                        simsimd_size_t n, __m256 flip_vec,           \
+                                                                        simsimd_distance_t *value,                   \
+                                                                        simsimd_size_t *index) {                     \
+        __m256 min_vec = _mm256_set1_ps((simsimd_f32_t)_simsimd_f64_infinity());                                     \
+        __m256i iterations_vec = _mm256_setzero_si256(), iteration_vec = _mm256_setzero_si256();                     \
+        __m256i const one_vec = _mm256_set1_epi32(1);                                                                \
+        simsimd_size_t i = 0;                                                                                        \
+        for (; i + 8 <= n; i += 8) {                                                                                 \
+            __m256 x_vec = _mm256_xor_ps(load(a + i), flip_vec);                                                     \
+            __m256 less_vec = _mm256_cmp_ps(x_vec, min_vec, _CMP_LT_OQ);                                             \
+            min_vec = _mm256_blendv_ps(min_vec, x_vec, less_vec);                                                    \
+            iterations_vec = _mm256_blendv_epi8(iterations_vec, iteration_vec, _mm256_castps_si256(less_vec));       \
+            iteration_vec = _mm256_add_epi32(iteration_vec, one_vec);                                                \
+        }                                                                                                            \
+        if (i < n) {                                                                                                 \
+            __m256i tail_vec =                                                                                       \
+                _mm256_cmpgt_epi32(_mm256_set1_epi32((int)(n - i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));      \
+            __m256 x_vec = _mm256_xor_ps(partial_load(a + i, n - i), flip_vec);                                      \
+            __m256 less_vec =                                                                                        \
+                _mm256_and_ps(_mm256_cmp_ps(x_vec, min_vec, _CMP_LT_OQ), _mm256_castsi256_ps(tail_vec));             \
+            min_vec = _mm256_blendv_ps(min_vec, x_vec, less_vec);                                                    \
+            iterations_vec = _mm256_blendv_epi8(iterations_vec, iteration_vec, _mm256_castps_si256(less_vec));       \
+        }                                                                                                            \
+        simsimd_f32_t mins_f32[8];                                                                                   \
+        simsimd_u32_t iterations_u32[8];                                                                             \
+        simsimd_f64_t mins[8];                                                                                       \
+        simsimd_u64_t iterations[8];                                                                                 \
+        _mm256_storeu_ps(mins_f32, min_vec);                                                                         \
+        _mm256_storeu_si256((__m256i *)iterations_u32, iterations_vec);                                              \
+        for (int lane = 0; lane != 8; ++lane) mins[lane] = mins_f32[lane], iterations[lane] = iterations_u32[lane];  \
+        _simsimd_reduce_argmin_lanes(mins, iterations, 8, value, index);                                             \
+    }                                                                                                                \
+    SIMSIMD_PUBLIC void simsimd_reduce_min_##input_type##_haswell(                                                   \
+        simsimd_##input_type##_t const *rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n,         \
+        simsimd_distance_t *values, simsimd_size_t *indices) {                                                       \
+        simsimd_size_t index;                                                                                        \
+        for (simsimd_size_t r = 0; r != count; ++r) {                                                                \
+            _simsimd_reduce_argmin_##input_type##_haswell(SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, r), n, \
+                                                          _mm256_setzero_ps(), values + r, &index);                  \
+            if (indices) indices[r] = index;                                                                         \
+        }                                                                                                            \
+    }                                                                                                                \
+    SIMSIMD_PUBLIC void simsimd_reduce_max_##input_type##_haswell(                                                   \
+        simsimd_##input_type##_t const *rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n,         \
+        simsimd_distance_t *values, simsimd_size_t *indices) {                                                       \
+        simsimd_size_t index;                                                                                        \
+        for (simsimd_size_t r = 0; r != count; ++r) {                                                                \
+            _simsimd_reduce_argmin_##input_type##_haswell(SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, r), n, \
+                                                          _mm256_set1_ps(-0.0f), values + r, &index);                \
+            values[r] = -values[r];                                                                                  \
+            if (indices) indices[r] = index;                                                                         \
+        }                                                                                                            \
+    }
+
+SIMSIMD_MAKE_REDUCE_F32X8_HASWELL(f32, _simsimd_load_f32x8_haswell, _simsimd_partial_load_f32x8_haswell)
+SIMSIMD_MAKE_REDUCE_F32X8_HASWELL(f16, _simsimd_load_f16x8_haswell, _simsimd_partial_load_f16x8_haswell)
+SIMSIMD_MAKE_REDUCE_F32X8_HASWELL(bf16, _simsimd_load_bf16x8_haswell, _simsimd_partial_load_bf16x8_as_f32x8_haswell)
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f64_haswell(simsimd_f64_t const *rows, simsimd_size_t count,
+                                                   simsimd_size_t stride, simsimd_size_t n,
+                                                   simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f64_t const *row = SIMSIMD_ROW(simsimd_f64_t, rows, stride, r);
+        __m256d sum_vec = _mm256_setzero_pd();
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4) sum_vec = _mm256_add_pd(sum_vec, _mm256_loadu_pd(row + i));
+        if (i < n) sum_vec = _mm256_add_pd(sum_vec, _simsimd_partial_load_f64x4_haswell(row + i, n - i));
+        results[r] = _simsimd_reduce_f64x4_haswell(sum_vec);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f64_haswell(simsimd_f64_t const *rows, simsimd_size_t count,
+                                                  simsimd_size_t stride, simsimd_size_t n,
+                                                  simsimd_distance_t *results) {
+    __m256d const sign_vec = _mm256_set1_pd(-0.0);
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f64_t const *row = SIMSIMD_ROW(simsimd_f64_t, rows, stride, r);
+        __m256d sum_vec = _mm256_setzero_pd();
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+            sum_vec = _mm256_add_pd(sum_vec, _mm256_andnot_pd(sign_vec, _mm256_loadu_pd(row + i)));
+        if (i < n)
+            sum_vec =
+                _mm256_add_pd(sum_vec, _mm256_andnot_pd(sign_vec, _simsimd_partial_load_f64x4_haswell(row + i, n - i)));
+        results[r] = _simsimd_reduce_f64x4_haswell(sum_vec);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f64_haswell(simsimd_f64_t const *rows, simsimd_size_t count,
+                                                  simsimd_size_t stride, simsimd_size_t n,
+                                                  simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f64_t const *row = SIMSIMD_ROW(simsimd_f64_t, rows, stride, r);
+        __m256d sum_vec = _mm256_setzero_pd(), x_vec;
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4) x_vec = _mm256_loadu_pd(row + i), sum_vec = _mm256_fmadd_pd(x_vec, x_vec, sum_vec);
+        if (i < n)
+            x_vec = _simsimd_partial_load_f64x4_haswell(row + i, n - i),
+            sum_vec = _mm256_fmadd_pd(x_vec, x_vec, sum_vec);
+        results[r] = _simsimd_sqrt_f64_haswell(_simsimd_reduce_f64x4_haswell(sum_vec));
+    }
+}
+
+SIMSIMD_INTERNAL void _simsimd_reduce_argmin_f64_haswell(simsimd_f64_t const *a, simsimd_size_t n, __m256d flip_vec,
+                                                         simsimd_distance_t *value, simsimd_size_t *index) {
+    __m256d min_vec = _mm256_set1_pd(_simsimd_f64_infinity());
+    __m256i iterations_vec = _mm256_setzero_si256(), iteration_vec = _mm256_setzero_si256();
+    __m256i const one_vec = _mm256_set1_epi64x(1);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d x_vec = _mm256_xor_pd(_mm256_loadu_pd(a + i), flip_vec);
+        __m256d less_vec = _mm256_cmp_pd(x_vec, min_vec, _CMP_LT_OQ);
+        min_vec = _mm256_blendv_pd(min_vec, x_vec, less_vec);
+        iterations_vec = _mm256_blendv_epi8(iterations_vec, iteration_vec, _mm256_castpd_si256(less_vec));
+        iteration_vec = _mm256_add_epi64(iteration_vec, one_vec);
+    }
+    if (i < n) {
+        __m256i tail_vec = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)(n - i)), _mm256_setr_epi64x(0, 1, 2, 3));
+        __m256d x_vec = _mm256_xor_pd(_simsimd_partial_load_f64x4_haswell(a + i, n - i), flip_vec);
+        __m256d less_vec = _mm256_and_pd(_mm256_cmp_pd(x_vec, min_vec, _CMP_LT_OQ), _mm256_castsi256_pd(tail_vec));
+        min_vec = _mm256_blendv_pd(min_vec, x_vec, less_vec);
+        iterations_vec = _mm256_blendv_epi8(iterations_vec, iteration_vec, _mm256_castpd_si256(less_vec));
+    }
+    simsimd_f64_t mins[4];
+    simsimd_u64_t iterations[4];
+    _mm256_storeu_pd(mins, min_vec);
+    _mm256_storeu_si256((__m256i *)iterations, iterations_vec);
+    _simsimd_reduce_argmin_lanes(mins, iterations, 4, value, index);
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_min_f64_haswell(simsimd_f64_t const *rows, simsimd_size_t count,
+                                                   simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t *values,
+                                                   simsimd_size_t *indices) {
+    simsimd_size_t index;
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        _simsimd_reduce_argmin_f64_haswell(SIMSIMD_ROW(simsimd_f64_t, rows, stride, r), n, _mm256_setzero_pd(),
+                                           values + r, &index);
+        if (indices) indices[r] = index;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_max_f64_haswell(simsimd_f64_t const *rows, simsimd_size_t count,
+                                                   simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t *values,
+                                                   simsimd_size_t *indices) {
+    simsimd_size_t index;
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        _simsimd_reduce_argmin_f64_haswell(SIMSIMD_ROW(simsimd_f64_t, rows, stride, r), n, _mm256_set1_pd(-0.0),
+                                           values + r, &index);
+        values[r] = -values[r];
+        if (indices) indices[r] = index;
+    }
+}
+
+SIMSIMD_INTERNAL simsimd_u64_t _simsimd_reduce_u64x4_haswell(__m256i vec) {
+    __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(vec), _mm256_extracti128_si256(vec, 1));
+    return (simsimd_u64_t)_mm_cvtsi128_si64(sum) + (simsimd_u64_t)_mm_extract_epi64(sum, 1);
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_u8_haswell(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                                  simsimd_size_t n, simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_u8_t const *row = SIMSIMD_ROW(simsimd_u8_t, rows, stride, r);
+        __m256i sum_vec = _mm256_setzero_si256();
+        simsimd_size_t i = 0;
+        for (; i + 32 <= n; i += 32)
+            sum_vec = _mm256_add_epi64(
+                sum_vec, _mm256_sad_epu8(_mm256_loadu_si256((__m256i const *)(row + i)), _mm256_setzero_si256()));
+        simsimd_u64_t sum = _simsimd_reduce_u64x4_haswell(sum_vec);
+        for (; i < n; ++i) sum += row[i];
+        results[r] = (simsimd_distance_t)sum;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_u8_haswell(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                                 simsimd_size_t n, simsimd_distance_t *results) {
+    simsimd_reduce_sum_u8_haswell(rows, count, stride, n, results);
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_i8_haswell(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                                  simsimd_size_t n, simsimd_distance_t *results) {
+    // Flipping the sign bit maps `i8` values into `u8` ones, shifted by 128, so they can be summed with `vpsadbw`.
+    __m256i const bias_vec = _mm256_set1_epi8((char)0x80);
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_i8_t const *row = SIMSIMD_ROW(simsimd_i8_t, rows, stride, r);
+        __m256i sum_vec = _mm256_setzero_si256();
+        simsimd_size_t i = 0;
+        for (; i + 32 <= n; i += 32)
+            sum_vec = _mm256_add_epi64(
+                sum_vec, _mm256_sad_epu8(_mm256_xor_si256(_mm256_loadu_si256((__m256i const *)(row + i)), bias_vec),
+                                         _mm256_setzero_si256()));
+        simsimd_i64_t sum = (simsimd_i64_t)_simsimd_reduce_u64x4_haswell(sum_vec) - (simsimd_i64_t)i * 128;
+        for (; i < n; ++i) sum += row[i];
+        results[r] = (simsimd_distance_t)sum;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_i8_haswell(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                                 simsimd_size_t n, simsimd_distance_t *results) {
+    // The absolute value of -128 doesn't fit into `i8`, but it's still correct, if treated as `u8`.
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_i8_t const *row = SIMSIMD_ROW(simsimd_i8_t, rows, stride, r);
+        __m256i sum_vec = _mm256_setzero_si256();
+        simsimd_size_t i = 0;
+        for (; i + 32 <= n; i += 32)
+            sum_vec = _mm256_add_epi64(
+                sum_vec, _mm256_sad_epu8(_mm256_abs_epi8(_mm256_loadu_si256((__m256i const *)(row + i))),
+                                         _mm256_setzero_si256()));
+        simsimd_u64_t sum = _simsimd_reduce_u64x4_haswell(sum_vec);
+        for (; i < n; ++i) sum += (simsimd_u64_t)(row[i] < 0 ? -row[i] : row[i]);
+        results[r] = (simsimd_distance_t)sum;
+    }
+}
+
+/**
+ *  @brief  Sum of squares of `i8` or `u8` scalars, widened to `i16` and accumulated with `vpmaddwd` into `i32` lanes.
+ *          The lanes are flushed into a 64-bit scalar every 8192 elements, long before they can overflow.
+ */
+#define SIMSIMD_MAKE_REDUCE_L2_X8_HASWELL(input_type, widen)                                                      \
+    SIMSIMD_PUBLIC void simsimd_reduce_l2_##input_type##_haswell(simsimd_##input_type##_t const *rows,            \
+                                                                 simsimd_size_t count, simsimd_size_t stride,     \
+                                                                 simsimd_size_t n, simsimd_distance_t *results) { \
+        for (simsimd_size_t r = 0; r != count; ++r) {                                                             \
+            simsimd_##input_type##_t const *row = SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, r);         \
+            simsimd_i64_t sum = 0;                                                                                \
+            simsimd_size_t i = 0;                                                                                 \
+            while (i + 16 <= n) {                                                                                 \
+                simsimd_size_t const block_end = n - i > 8192 ? i + 8192 : n;                                     \
+                __m256i sum_vec = _mm256_setzero_si256();                                                         \
+                for (; i + 16 <= block_end; i += 16) {                                                            \
+                    __m256i x_vec = widen(_mm_loadu_si128((__m128i const *)(row + i)));                           \
+                    sum_vec = _mm256_add_epi32(sum_vec, _mm256_madd_epi16(x_vec, x_vec));                         \
+                }                                                                                                 \
+                sum += _simsimd_reduce_i32x8_haswell(sum_vec);                                                    \
+            }                                                                                                     \
+            for (; i < n; ++i) sum += (simsimd_i64_t)row[i] * row[i];                                             \
+            results[r] = _simsimd_sqrt_f64_haswell((simsimd_f64_t)sum);                                           \
+        }                                                                                                         \
+    }
+
+SIMSIMD_MAKE_REDUCE_L2_X8_HASWELL(i8, _mm256_cvtepi8_epi16)
+SIMSIMD_MAKE_REDUCE_L2_X8_HASWELL(u8, _mm256_cvtepu8_epi16)
+
+/**
+ *  @brief  Minimums of `i8` or `u8` rows and the indices of their first occurrences, with every input XOR-ed with
+ *          `flip`, reversing the order of all scalars to search for the maximums with the same code, when all bits
+ *          are set. The minimum is found with `min_epi8` first, and then located with byte-wise comparisons.
+ */
+#define SIMSIMD_MAKE_REDUCE_MINMAX_X8_HASWELL(input_type, min_epi8)                                                    \
+    SIMSIMD_INTERNAL void _simsimd_reduce_argmin_##input_type##_haswell(simsimd_##input_type##_t const *a,             \
+                                                                        simsimd_size_t n, simsimd_u8_t flip,           \
+                                                                        simsimd_distance_t *value,                     \
+                                                                        simsimd_size_t *index) {                       \
+        __m256i const flip_vec = _mm256_set1_epi8((char)flip);                                                         \
+        simsimd_##input_type##_t best;                                                                                 \
+        simsimd_size_t i = 0;                                                                                          \
+        if (n < 32) {                                                                                                  \
+            if (!n) {                                                                                                  \
+                *value = _simsimd_f64_infinity(), *index = 0;                                                          \
+                return;                                                                                                \
+            }                                                                                                          \
+            best = (simsimd_##input_type##_t)(a[0] ^ flip);                                                            \
+        }                                                                                                              \
+        else {                                                                                                         \
+            __m256i min_vec = _mm256_xor_si256(_mm256_loadu_si256((__m256i const *)a), flip_vec);                      \
+            for (i = 32; i + 32 <= n; i += 32)                                                                         \
+                min_vec = min_epi8(min_vec, _mm256_xor_si256(_mm256_loadu_si256((__m256i const *)(a + i)), flip_vec)); \
+            simsimd_##input_type##_t mins[32];                                                                         \
+            _mm256_storeu_si256((__m256i *)mins, min_vec);                                                             \
+            best = mins[0];                                                                                            \
+            for (int lane = 1; lane != 32; ++lane) best = mins[lane] < best ? mins[lane] : best;                       \
+        }                                                                                                              \
+        for (; i < n; ++i) {                                                                                           \
+            simsimd_##input_type##_t x = (simsimd_##input_type##_t)(a[i] ^ flip);                                      \
+            best = x < best ? x : best;                                                                                \
+        }                                                                                                              \
+        /* Second pass, locating the first occurrence of the minimum */                                                \
+        __m256i const best_vec = _mm256_set1_epi8((char)(best ^ flip));                                                \
+        for (i = 0; i + 32 <= n; i += 32) {                                                                            \
+            simsimd_u32_t mask = (simsimd_u32_t)_mm256_movemask_epi8(                                                  \
+                _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i const *)(a + i)), best_vec));                            \
+            if (mask) {                                                                                                \
+                while (!(mask & 1)) mask >>= 1, ++i;                                                                   \
+                break;                                                                                                 \
+            }                                                                                                          \
+        }                                                                                                              \
+        while ((simsimd_##input_type##_t)(a[i] ^ flip) != best) ++i;                                                   \
+        *value = (simsimd_##input_type##_t)(best ^ flip), *index = i;                                                  \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC void simsimd_reduce_min_##input_type##_haswell(                                                     \
+        simsimd_##input_type##_t const *rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n,           \
+        simsimd_distance_t *values, simsimd_size_t *indices) {                                                         \
+        simsimd_size_t index;                                                                                          \
+        for (simsimd_size_t r = 0; r != count; ++r) {                                                                  \
+            _simsimd_reduce_argmin_##input_type##_haswell(SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, r), n,   \
+                                                          0x00, values + r, &index);                                   \
+            if (indices) indices[r] = index;                                                                           \
+        }                                                                                                              \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC void simsimd_reduce_max_##input_type##_haswell(                                                     \
+        simsimd_##input_type##_t const *rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n,           \
+        simsimd_distance_t *values, simsimd_size_t *indices) {                                                         \
+        simsimd_size_t index;                                                                                          \
+        for (simsimd_size_t r = 0; r != count; ++r) {                                                                  \
+            _simsimd_reduce_argmin_##input_type##_haswell(SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, r), n,   \
+                                                          0xFF, values + r, &index);                                   \
+            if (!n) values[r] = -_simsimd_f64_infinity();                                                              \
+            if (indices) indices[r] = index;                                                                           \
+        }                                                                                                              \
+    }
+
+SIMSIMD_MAKE_REDUCE_MINMAX_X8_HASWELL(i8, _mm256_min_epi8)
+SIMSIMD_MAKE_REDUCE_MINMAX_X8_HASWELL(u8, _mm256_min_epu8)
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_HASWELL
+
+#if SIMSIMD_TARGET_SKYLAKE
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "avx512bw", "bmi2")
+#pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512vl,avx512bw,bmi2"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f32_skylake(simsimd_f32_t const *rows, simsimd_size_t count,
+                                                   simsimd_size_t stride, simsimd_size_t n,
+                                                   simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f32_t const *row = SIMSIMD_ROW(simsimd_f32_t, rows, stride, r);
+        __m512 sum_vec = _mm512_setzero_ps();
+        simsimd_size_t i = 0;
+        for (; i + 16 <= n; i += 16) sum_vec = _mm512_add_ps(sum_vec, _mm512_loadu_ps(row + i));
+        if (i < n)
+            sum_vec = _mm512_add_ps(sum_vec, _mm512_maskz_loadu_ps((__mmask16)_bzhi_u32(0xFFFF, n - i), row + i));
+        results[r] = _simsimd_reduce_f32x16_skylake(sum_vec);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f32_skylake(simsimd_f32_t const *rows, simsimd_size_t count,
+                                                  simsimd_size_t stride, simsimd_size_t n,
+                                                  simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f32_t const *row = SIMSIMD_ROW(simsimd_f32_t, rows, stride, r);
+        __m512 sum_vec = _mm512_setzero_ps();
+        simsimd_size_t i = 0;
+        for (; i + 16 <= n; i += 16) sum_vec = _mm512_add_ps(sum_vec, _mm512_abs_ps(_mm512_loadu_ps(row + i)));
+        if (i < n)
+            sum_vec = _mm512_add_ps(sum_vec,
+                                    _mm512_abs_ps(_mm512_maskz_loadu_ps((__mmask16)_bzhi_u32(0xFFFF, n - i), row + i)));
+        results[r] = _simsimd_reduce_f32x16_skylake(sum_vec);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f32_skylake(simsimd_f32_t const *rows, simsimd_size_t count,
+                                                  simsimd_size_t stride, simsimd_size_t n,
+                                                  simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f32_t const *row = SIMSIMD_ROW(simsimd_f32_t, rows, stride, r);
+        __m512 sum_vec = _mm512_setzero_ps(), x_vec;
+        simsimd_size_t i = 0;
+        for (; i + 16 <= n; i += 16) x_vec = _mm512_loadu_ps(row + i), sum_vec = _mm512_fmadd_ps(x_vec, x_vec, sum_vec);
+        if (i < n)
+            x_vec = _mm512_maskz_loadu_ps((__mmask16)_bzhi_u32(0xFFFF, n - i), row + i),
+            sum_vec = _mm512_fmadd_ps(x_vec, x_vec, sum_vec);
+        results[r] = _simsimd_sqrt_f64_haswell(_simsimd_reduce_f32x16_skylake(sum_vec));
+    }
+}
+
+SIMSIMD_INTERNAL void _simsimd_reduce_argmin_f32_skylake(simsimd_f32_t const *a, simsimd_size_t n, __m512i flip_vec,
+                                                         simsimd_distance_t *value, simsimd_size_t *index) {
+    __m512 min_vec = _mm512_set1_ps((simsimd_f32_t)_simsimd_f64_infinity());
+    __m512i iterations_vec = _mm512_setzero_si512(), iteration_vec = _mm512_setzero_si512();
+    __m512i const one_vec = _mm512_set1_epi32(1);
+    __mmask16 less_mask;
+    simsimd_size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512 x_vec = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_loadu_ps(a + i)), flip_vec));
+        less_mask = _mm512_cmp_ps_mask(x_vec, min_vec, _CMP_LT_OQ);
+        min_vec = _mm512_mask_mov_ps(min_vec, less_mask, x_vec);
+        iterations_vec = _mm512_mask_mov_epi32(iterations_vec, less_mask, iteration_vec);
+        iteration_vec = _mm512_add_epi32(iteration_vec, one_vec);
+    }
+    if (i < n) {
+        __mmask16 tail_mask = (__mmask16)_bzhi_u32(0xFFFF, n - i);
+        __m512 x_vec = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_maskz_loadu_epi32(tail_mask, a + i), flip_vec));
+        less_mask = _mm512_mask_cmp_ps_mask(tail_mask, x_vec, min_vec, _CMP_LT_OQ);
+        min_vec = _mm512_mask_mov_ps(min_vec, less_mask, x_vec);
+        iterations_vec = _mm512_mask_mov_epi32(iterations_vec, less_mask, iteration_vec);
+    }
+    simsimd_f32_t mins_f32[16];
+    simsimd_u32_t iterations_u32[16];
+    simsimd_f64_t mins[16];
+    simsimd_u64_t iterations[16];
+    _mm512_storeu_ps(mins_f32, min_vec);
+    _mm512_storeu_si512(iterations_u32, iterations_vec);
+    for (int lane = 0; lane != 16; ++lane) mins[lane] = mins_f32[lane], iterations[lane] = iterations_u32[lane];
+    _simsimd_reduce_argmin_lanes(mins, iterations, 16, value, index);
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_min_f32_skylake(simsimd_f32_t const *rows, simsimd_size_t count,
+                                                   simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t *values,
+                                                   simsimd_size_t *indices) {
+    simsimd_size_t index;
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        _simsimd_reduce_argmin_f32_skylake(SIMSIMD_ROW(simsimd_f32_t, rows, stride, r), n, _mm512_setzero_si512(),
+                                           values + r, &index);
+        if (indices) indices[r] = index;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_max_f32_skylake(simsimd_f32_t const *rows, simsimd_size_t count,
+                                                   simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t *values,
+                                                   simsimd_size_t *indices) {
+    simsimd_size_t index;
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        _simsimd_reduce_argmin_f32_skylake(SIMSIMD_ROW(simsimd_f32_t, rows, stride, r), n,
+                                           _mm512_set1_epi32((int)0x80000000), values + r, &index);
+        values[r] = -values[r];
+        if (indices) indices[r] = index;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f64_skylake(simsimd_f64_t const *rows, simsimd_size_t count,
+                                                   simsimd_size_t stride, simsimd_size_t n,
+                                                   simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f64_t const *row = SIMSIMD_ROW(simsimd_f64_t, rows, stride, r);
+        __m512d sum_vec = _mm512_setzero_pd();
+        simsimd_size_t i = 0;
+        for (; i + 8 <= n; i += 8) sum_vec = _mm512_add_pd(sum_vec, _mm512_loadu_pd(row + i));
+        if (i < n) sum_vec = _mm512_add_pd(sum_vec, _mm512_maskz_loadu_pd((__mmask8)_bzhi_u32(0xFF, n - i), row + i));
+        results[r] = _mm512_reduce_add_pd(sum_vec);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f64_skylake(simsimd_f64_t const *rows, simsimd_size_t count,
+                                                  simsimd_size_t stride, simsimd_size_t n,
+                                                  simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f64_t const *row = SIMSIMD_ROW(simsimd_f64_t, rows, stride, r);
+        __m512d sum_vec = _mm512_setzero_pd();
+        simsimd_size_t i = 0;
+        for (; i + 8 <= n; i += 8) sum_vec = _mm512_add_pd(sum_vec, _mm512_abs_pd(_mm512_loadu_pd(row + i)));
+        if (i < n)
+            sum_vec = _mm512_add_pd(sum_vec,
+                                    _mm512_abs_pd(_mm512_maskz_loadu_pd((__mmask8)_bzhi_u32(0xFF, n - i), row + i)));
+        results[r] = _mm512_reduce_add_pd(sum_vec);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f64_skylake(simsimd_f64_t const *rows, simsimd_size_t count,
+                                                  simsimd_size_t stride, simsimd_size_t n,
+                                                  simsimd_distance_t *results) {
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        simsimd_f64_t const *row = SIMSIMD_ROW(simsimd_f64_t, rows, stride, r);
+        __m512d sum_vec = _mm512_setzero_pd(), x_vec;
+        simsimd_size_t i = 0;
+        for (; i + 8 <= n; i += 8) x_vec = _mm512_loadu_pd(row + i), sum_vec = _mm512_fmadd_pd(x_vec, x_vec, sum_vec);
+        if (i < n)
+            x_vec = _mm512_maskz_loadu_pd((__mmask8)_bzhi_u32(0xFF, n - i), row + i),
+            sum_vec = _mm512_fmadd_pd(x_vec, x_vec, sum_vec);
+        results[r] = _simsimd_sqrt_f64_haswell(_mm512_reduce_add_pd(sum_vec));
+    }
+}
+
+SIMSIMD_INTERNAL void _simsimd_reduce_argmin_f64_skylake(simsimd_f64_t const *a, simsimd_size_t n, __m512i flip_vec,
+                                                         simsimd_distance_t *value, simsimd_size_t *index) {
+    __m512d min_vec = _mm512_set1_pd(_simsimd_f64_infinity());
+    __m512i iterations_vec = _mm512_setzero_si512(), iteration_vec = _mm512_setzero_si512();
+    __m512i const one_vec = _mm512_set1_epi64(1);
+    __mmask8 less_mask;
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d x_vec = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(_mm512_loadu_pd(a + i)), flip_vec));
+        less_mask = _mm512_cmp_pd_mask(x_vec, min_vec, _CMP_LT_OQ);
+        min_vec = _mm512_mask_mov_pd(min_vec, less_mask, x_vec);
+        iterations_vec = _mm512_mask_mov_epi64(iterations_vec, less_mask, iteration_vec);
+        iteration_vec = _mm512_add_epi64(iteration_vec, one_vec);
+    }
+    if (i < n) {
+        __mmask8 tail_mask = (__mmask8)_bzhi_u32(0xFF, n - i);
+        __m512d x_vec = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_maskz_loadu_epi64(tail_mask, a + i), flip_vec));
+        less_mask = _mm512_mask_cmp_pd_mask(tail_mask, x_vec, min_vec, _CMP_LT_OQ);
+        min_vec = _mm512_mask_mov_pd(min_vec, less_mask, x_vec);
+        iterations_vec = _mm512_mask_mov_epi64(iterations_vec, less_mask, iteration_vec);
+    }
+    simsimd_f64_t mins[8];
+    simsimd_u64_t iterations[8];
+    _mm512_storeu_pd(mins, min_vec);
+    _mm512_storeu_si512(iterations, iterations_vec);
+    _simsimd_reduce_argmin_lanes(mins, iterations, 8, value, index);
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_min_f64_skylake(simsimd_f64_t const *rows, simsimd_size_t count,
+                                                   simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t *values,
+                                                   simsimd_size_t *indices) {
+    simsimd_size_t index;
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        _simsimd_reduce_argmin_f64_skylake(SIMSIMD_ROW(simsimd_f64_t, rows, stride, r), n, _mm512_setzero_si512(),
+                                           values + r, &index);
+        if (indices) indices[r] = index;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_max_f64_skylake(simsimd_f64_t const *rows, simsimd_size_t count,
+                                                   simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t *values,
+                                                   simsimd_size_t *indices) {
+    simsimd_size_t index;
+    for (simsimd_size_t r = 0; r != count; ++r) {
+        _simsimd_reduce_argmin_f64_skylake(SIMSIMD_ROW(simsimd_f64_t, rows, stride, r), n,
+                                           _mm512_set1_epi64((long long)0x8000000000000000ull), values + r, &index);
+        values[r] = -values[r];
+        if (indices) indices[r] = index;
+    }
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SKYLAKE
+#endif // _SIMSIMD_TARGET_X86
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
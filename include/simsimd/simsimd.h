@@ -102,14 +102,28 @@
 #define SIMSIMD_DYNAMIC_DISPATCH (0) // true or false
 #endif
 
+/**
+ *  @brief  Counts the calls, bytes, and optionally the CPU ticks of every kernel served by the dynamic dispatch
+ *          library, keyed by the metric kind, datatype, and capability. Compiled out by default, as every call
+ *          pays for a few atomic increments. Query the counters with `simsimd_instrumentation_usage`.
+ */
+#ifndef SIMSIMD_INSTRUMENTATION
+#define SIMSIMD_INSTRUMENTATION (0) // true or false
+#endif
+
 #include "binary.h"      // Hamming, Jaccard
+#include "cdist.h"       // Many-to-many distance matrices
 #include "curved.h"      // Mahalanobis, Bilinear Forms
 #include "dot.h"         // Inner (dot) product, and its conjugate
 #include "elementwise.h" // Weighted Sum, Fused-Multiply-Add
 #include "geospatial.h"  // Haversine and Vincenty
+#include "mesh.h"        // RMSD, Kabsch
+#include "pq.h"          // Product Quantization scans
 #include "probability.h" // Kullback-Leibler, Jensen–Shannon
+#include "reduce.h"      // Sums, norms, and extrema of rows
 #include "sparse.h"      // Intersect
 #include "spatial.h"     // L2, Cosine
+#include "strings.h"     // Levenshtein, Needleman-Wunsch, Smith-Waterman
 
 // On Apple Silicon, `mrs` is not allowed in user-space, so we need to use the `sysctl` API.
 #if defined(_SIMSIMD_DEFINED_APPLE)
@@ -150,14 +164,20 @@ typedef enum {
     simsimd_metric_tanimoto_k = 'j', ///< Tanimoto coefficient is same as Jaccard
 
     // Sets:
-    simsimd_metric_intersect_k = 'x',     ///< Equivalent to unnormalized Jaccard
-    simsimd_metric_spdot_counts_k = 'y',  ///< Sparse sets with integer weights
-    simsimd_metric_spdot_weights_k = 'z', ///< Sparse sets with brain floating-point weights
+    simsimd_metric_intersect_k = 'x',         ///< Equivalent to unnormalized Jaccard
+    simsimd_metric_spdot_counts_k = 'y',      ///< Sparse sets with integer weights
+    simsimd_metric_spdot_weights_k = 'z',     ///< Sparse sets with brain floating-point weights
+    simsimd_metric_spdot_weights_f32_k = 'W', ///< Sparse sets with single-precision floating-point weights
 
     // Curved Spaces:
     simsimd_metric_bilinear_k = 'b',    ///< Bilinear form
     simsimd_metric_mahalanobis_k = 'm', ///< Mahalanobis distance
 
+    // Curved Spaces in batches, following `simsimd_kernel_whiten_punned_t`
+    // and `simsimd_metric_bilinear_cdist_punned_t` signatures:
+    simsimd_metric_whiten_k = 't',         ///< Projection of many vectors by a factor of the metric tensor
+    simsimd_metric_bilinear_cdist_k = 'G', ///< Bilinear forms of all pairs of rows
+
     // Probability:
     simsimd_metric_kl_k = 'k',               ///< Kullback-Leibler divergence
     simsimd_metric_kullback_leibler_k = 'k', ///< Kullback-Leibler divergence alias
@@ -169,6 +189,94 @@ typedef enum {
     simsimd_metric_fma_k = 'f',  ///< Fused Multiply-Add
     simsimd_metric_wsum_k = 'w', ///< Weighted Sum
 
+    // Element-wise kernels, following `simsimd_kernel_scale_punned_t`, `simsimd_kernel_elementwise_punned_t`,
+    // and `simsimd_kernel_convert_punned_t` signatures:
+    simsimd_metric_scale_k = 'M',      ///< Multiplying by one scalar and adding another
+    simsimd_metric_add_k = '+',        ///< Element-wise sum
+    simsimd_metric_multiply_k = '*',   ///< Element-wise product
+    simsimd_metric_quantize_k = '>',   ///< Scaled conversion from `f32` into the requested datatype
+    simsimd_metric_dequantize_k = '<', ///< Scaled conversion from the requested datatype into `f32`
+
+    // Row-wise reductions, following `simsimd_kernel_reduce_punned_t` and `simsimd_kernel_argreduce_punned_t`:
+    simsimd_metric_reduce_sum_k = '=', ///< Sums of elements in every row
+    simsimd_metric_reduce_l1_k = '1',  ///< Sums of absolute values in every row
+    simsimd_metric_reduce_l2_k = '|',  ///< Euclidean norms of every row
+    simsimd_metric_reduce_min_k = '_', ///< Minimums of every row and the indices of their first occurrences
+    simsimd_metric_reduce_max_k = '^', ///< Maximums of every row and the indices of their first occurrences
+
+    // One-to-many batches, following `simsimd_metric_batch_punned_t` signature:
+    simsimd_metric_dot_batch_k = 'I',     ///< Inner product of one query with many vectors
+    simsimd_metric_cos_batch_k = 'C',     ///< Cosine similarity of one query with many vectors
+    simsimd_metric_l2sq_batch_k = 'E',    ///< Squared Euclidean distance of one query to many vectors
+    simsimd_metric_l2_batch_k = 'L',      ///< Euclidean distance of one query to many vectors
+    simsimd_metric_hamming_batch_k = 'H', ///< Hamming distance of one query to many bit-vectors
+    simsimd_metric_jaccard_batch_k = 'J', ///< Jaccard coefficient of one query with many bit-vectors
+
+    // Many-to-many distance matrices, following `simsimd_metric_cdist_punned_t` signature:
+    simsimd_metric_dot_cdist_k = 'P',     ///< Inner products of all pairs of rows
+    simsimd_metric_cos_cdist_k = 'A',     ///< Cosine (Angular) distances between all pairs of rows
+    simsimd_metric_l2sq_cdist_k = 'Q',    ///< Squared Euclidean distances between all pairs of rows
+    simsimd_metric_l2_cdist_k = 'N',      ///< Euclidean distances between all pairs of rows
+    simsimd_metric_hamming_cdist_k = 'B', ///< Hamming distances between all pairs of bit-vectors
+    simsimd_metric_jaccard_cdist_k = 'T', ///< Jaccard (Tanimoto) distances between all pairs of bit-vectors
+
+    // Many-to-many distance matrices in a custom output precision, following `simsimd_metric_cdist_typed_punned_t`:
+    simsimd_metric_dot_cdist_typed_k = '4',  ///< Inner products of all pairs of rows
+    simsimd_metric_cos_cdist_typed_k = '5',  ///< Cosine (Angular) distances between all pairs of rows
+    simsimd_metric_l2sq_cdist_typed_k = '6', ///< Squared Euclidean distances between all pairs of rows
+    simsimd_metric_l2_cdist_typed_k = '7',   ///< Euclidean distances between all pairs of rows
+
+    // Squared norms of many rows, cached for the kernels below, following `simsimd_kernel_norms_punned_t`:
+    simsimd_metric_norms_k = 'o', ///< Squared Euclidean norms of many rows
+
+    // One-to-many batches with cached norms, following `simsimd_metric_batch_normed_punned_t` signature:
+    simsimd_metric_cos_batch_normed_k = 'u',  ///< Cosine similarity of one query with many vectors
+    simsimd_metric_l2sq_batch_normed_k = 'd', ///< Squared Euclidean distance of one query to many vectors
+    simsimd_metric_l2_batch_normed_k = 'l',   ///< Euclidean distance of one query to many vectors
+
+    // Many-to-many distance matrices with cached norms, following `simsimd_metric_cdist_normed_punned_t`:
+    simsimd_metric_cos_cdist_normed_k = '8',  ///< Cosine (Angular) distances between all pairs of rows
+    simsimd_metric_l2sq_cdist_normed_k = '9', ///< Squared Euclidean distances between all pairs of rows
+    simsimd_metric_l2_cdist_normed_k = '0',   ///< Euclidean distances between all pairs of rows
+
+    // Geospatial distances, following `simsimd_metric_geospatial_punned_t` signature:
+    simsimd_metric_haversine_k = 'g', ///< Great-circle distance on a sphere in meters
+    simsimd_metric_hav_k = 'a',       ///< Haversine of the central angle, monotonic in the great-circle distance
+    simsimd_metric_vincenty_k = 'n',  ///< Geodesic distance on the WGS-84 ellipsoid in meters
+
+    // Rigid 3D point clouds, following `simsimd_metric_mesh_punned_t` signature:
+    simsimd_metric_rmsd_k = 'r',   ///< Root Mean Square Deviation after aligning the centroids
+    simsimd_metric_kabsch_k = 'p', ///< Root Mean Square Deviation after the optimal Procrustes superposition
+
+    // One-to-many batches of rigid 3D point clouds, following `simsimd_metric_batch_punned_t` signature:
+    simsimd_metric_rmsd_batch_k = 'R',   ///< RMSD of one reference cloud to many conformers
+    simsimd_metric_kabsch_batch_k = 'K', ///< Kabsch RMSD of one reference cloud to many conformers
+
+    // Asymmetric metrics between a floating-point query and a quantized row,
+    // following `simsimd_metric_quantized_punned_t` signature:
+    simsimd_metric_dot_quantized_k = 'D',  ///< Inner product with a dequantized row
+    simsimd_metric_cos_quantized_k = 'O',  ///< Cosine similarity with a dequantized row
+    simsimd_metric_l2sq_quantized_k = 'S', ///< Squared Euclidean distance to a dequantized row
+    simsimd_metric_l2_quantized_k = 'U',   ///< Euclidean distance to a dequantized row
+
+    // Product Quantization scans, following `simsimd_metric_pq_punned_t` signature:
+    simsimd_metric_pq_scan_k = 'q', ///< Sums of quantized ADC table entries selected by packed codes
+
+    // Threshold searches, following `simsimd_metric_radius_punned_t` signature:
+    simsimd_metric_hamming_radius_k = 'X', ///< Bit-vectors within a Hamming distance of the query
+    simsimd_metric_jaccard_radius_k = 'Y', ///< Bit-vectors within a Jaccard distance of the query
+
+    // Sparse sets of one query against many documents, following `simsimd_metric_sparse_batch_punned_t`
+    // and `simsimd_metric_spdot_batch_punned_t` signatures:
+    simsimd_metric_intersect_batch_k = 'V',     ///< Intersection sizes of one query with many documents
+    simsimd_metric_spdot_weights_batch_k = 'Z', ///< Sparse dot products with brain floating-point weights
+
+    // Byte strings of one query against many sequences, following `simsimd_metric_levenshtein_batch_punned_t`
+    // and `simsimd_metric_alignment_batch_punned_t` signatures:
+    simsimd_metric_levenshtein_batch_k = '~',      ///< Bounded edit distances of one query to many sequences
+    simsimd_metric_needleman_wunsch_batch_k = '[', ///< Global alignment scores of one query with many sequences
+    simsimd_metric_smith_waterman_batch_k = ']',   ///< Local alignment scores of one query with many sequences
+
 } simsimd_metric_kind_t;
 
 /**
@@ -178,13 +286,14 @@ typedef enum {
     simsimd_cap_serial_k = 1,       ///< Serial (non-SIMD) capability
     simsimd_cap_any_k = 0x7FFFFFFF, ///< Mask representing any capability with `INT_MAX`
 
-    simsimd_cap_haswell_k = 1 << 10,  ///< x86 AVX2 capability with FMA and F16C extensions
-    simsimd_cap_skylake_k = 1 << 11,  ///< x86 AVX512 baseline capability
-    simsimd_cap_ice_k = 1 << 12,      ///< x86 AVX512 capability with advanced integer algos
-    simsimd_cap_genoa_k = 1 << 13,    ///< x86 AVX512 capability with `bf16` support
-    simsimd_cap_sapphire_k = 1 << 14, ///< x86 AVX512 capability with `f16` support
-    simsimd_cap_turin_k = 1 << 15,    ///< x86 AVX512 capability with conflict detection
-    simsimd_cap_sierra_k = 1 << 16,   ///< x86 AVX2+VNNI capability with `i8` dot-products
+    simsimd_cap_haswell_k = 1 << 10,      ///< x86 AVX2 capability with FMA and F16C extensions
+    simsimd_cap_skylake_k = 1 << 11,      ///< x86 AVX512 baseline capability
+    simsimd_cap_ice_k = 1 << 12,          ///< x86 AVX512 capability with advanced integer algos
+    simsimd_cap_genoa_k = 1 << 13,        ///< x86 AVX512 capability with `bf16` support
+    simsimd_cap_sapphire_k = 1 << 14,     ///< x86 AVX512 capability with `f16` support
+    simsimd_cap_turin_k = 1 << 15,        ///< x86 AVX512 capability with conflict detection
+    simsimd_cap_sierra_k = 1 << 16,       ///< x86 AVX2+VNNI capability with `i8` dot-products
+    simsimd_cap_sapphire_amx_k = 1 << 17, ///< x86 AMX capability with `bf16` and `i8` tiles
 
     simsimd_cap_neon_k = 1 << 20,      ///< ARM NEON baseline capability
     simsimd_cap_neon_f16_k = 1 << 21,  ///< ARM NEON `f16` capability
@@ -199,40 +308,6 @@ typedef enum {
 
 } simsimd_capability_t;
 
-/**
- *  @brief  Enumeration of supported data types.
- *
- *  Includes complex type descriptors which in C code would use the real counterparts,
- *  but the independent flags contain metadata to be passed between programming language
- *  interfaces.
- */
-typedef enum {
-    simsimd_datatype_unknown_k = 0,                  ///< Unknown data type
-    simsimd_datatype_b8_k = 1 << 1,                  ///< Single-bit values packed into 8-bit words
-    simsimd_datatype_b1x8_k = simsimd_datatype_b8_k, ///< Single-bit values packed into 8-bit words
-    simsimd_datatype_i4x2_k = 1 << 19,               ///< 4-bit signed integers packed into 8-bit words
-
-    simsimd_datatype_i8_k = 1 << 2,  ///< 8-bit signed integer
-    simsimd_datatype_i16_k = 1 << 3, ///< 16-bit signed integer
-    simsimd_datatype_i32_k = 1 << 4, ///< 32-bit signed integer
-    simsimd_datatype_i64_k = 1 << 5, ///< 64-bit signed integer
-
-    simsimd_datatype_u8_k = 1 << 6,  ///< 8-bit unsigned integer
-    simsimd_datatype_u16_k = 1 << 7, ///< 16-bit unsigned integer
-    simsimd_datatype_u32_k = 1 << 8, ///< 32-bit unsigned integer
-    simsimd_datatype_u64_k = 1 << 9, ///< 64-bit unsigned integer
-
-    simsimd_datatype_f64_k = 1 << 10,  ///< Double precision floating point
-    simsimd_datatype_f32_k = 1 << 11,  ///< Single precision floating point
-    simsimd_datatype_f16_k = 1 << 12,  ///< Half precision floating point
-    simsimd_datatype_bf16_k = 1 << 13, ///< Brain floating point
-
-    simsimd_datatype_f64c_k = 1 << 20,  ///< Complex double precision floating point
-    simsimd_datatype_f32c_k = 1 << 21,  ///< Complex single precision floating point
-    simsimd_datatype_f16c_k = 1 << 22,  ///< Complex half precision floating point
-    simsimd_datatype_bf16c_k = 1 << 23, ///< Complex brain floating point
-} simsimd_datatype_t;
-
 /**
  *  @brief  Type-punned function pointer for dense vector representations and simplest similarity measures.
  *
@@ -259,6 +334,22 @@ typedef void (*simsimd_metric_sparse_punned_t)(void const *a, void const *b,
                                                simsimd_size_t a_length, simsimd_size_t b_length, //
                                                simsimd_distance_t *d);
 
+/**
+ *  @brief  Type-punned function pointer for weighted sparse vectors and their dot products.
+ *
+ *  @param[in] a          Pointer to the first sorted array of integers.
+ *  @param[in] b          Pointer to the second sorted array of integers.
+ *  @param[in] a_weights  Pointer to the weights of the first array.
+ *  @param[in] b_weights  Pointer to the weights of the second array.
+ *  @param[in] a_length   Number of scalar words in the first input array.
+ *  @param[in] b_length   Number of scalar words in the second input array.
+ *  @param[out] results   Output pair of the intersection size and the dot product of the matching weights.
+ */
+typedef void (*simsimd_metric_spdot_punned_t)(void const *a, void const *b,                     //
+                                              void const *a_weights, void const *b_weights,     //
+                                              simsimd_size_t a_length, simsimd_size_t b_length, //
+                                              simsimd_distance_t *results);
+
 /**
  *  @brief  Type-punned function pointer for curved vector spaces and similarity measures.
  *
@@ -271,6 +362,43 @@ typedef void (*simsimd_metric_sparse_punned_t)(void const *a, void const *b,
 typedef void (*simsimd_metric_curved_punned_t)(void const *a, void const *b, void const *c, //
                                                simsimd_size_t n, simsimd_distance_t *d);
 
+/**
+ *  @brief  Type-punned function pointer for projecting many vectors by a factor of the metric tensor.
+ *          Implements `whitened = l^T * vector` for every row, so that the Mahalanobis distance with
+ *          the metric tensor `l * l^T` becomes the Euclidean distance between the projected rows.
+ *
+ *  @param[in] vectors          Pointer to the first row of the input matrix.
+ *  @param[in] count            Number of rows in the input matrix.
+ *  @param[in] stride           Number of bytes between the starts of consecutive input rows.
+ *  @param[in] l                Pointer to the `n` by `n` row-major factor of the metric tensor.
+ *  @param[in] n                Number of scalar words in each row.
+ *  @param[out] whitened        Pointer to the first row of the output matrix, in the input precision.
+ *  @param[in] whitened_stride  Number of bytes between the starts of consecutive output rows.
+ */
+typedef void (*simsimd_kernel_whiten_punned_t)(void const *vectors, simsimd_size_t count, simsimd_size_t stride, //
+                                               void const *l, simsimd_size_t n,                                 //
+                                               void *whitened, simsimd_size_t whitened_stride);
+
+/**
+ *  @brief  Type-punned function pointer for bilinear forms `a_i^T * c * b_j` of all pairs of rows.
+ *
+ *  @param[in] a          Pointer to the first row of the first matrix.
+ *  @param[in] b          Pointer to the first row of the second matrix.
+ *  @param[in] a_count    Number of rows in the first matrix.
+ *  @param[in] a_stride   Number of bytes between the starts of consecutive rows of the first matrix.
+ *  @param[in] b_count    Number of rows in the second matrix.
+ *  @param[in] b_stride   Number of bytes between the starts of consecutive rows of the second matrix.
+ *  @param[in] c          Pointer to the `n` by `n` row-major metric tensor.
+ *  @param[in] n          Number of scalar words in each row.
+ *  @param[out] d         Row-major `a_count` by `b_count` matrix of double-precision floats.
+ *  @param[in] d_stride   Number of bytes between the starts of consecutive rows of the output matrix.
+ */
+typedef void (*simsimd_metric_bilinear_cdist_punned_t)(void const *a, void const *b,                    //
+                                                       simsimd_size_t a_count, simsimd_size_t a_stride, //
+                                                       simsimd_size_t b_count, simsimd_size_t b_stride, //
+                                                       void const *c, simsimd_size_t n,                 //
+                                                       simsimd_distance_t *d, simsimd_size_t d_stride);
+
 /**
  *  @brief  Type-punned function pointer for FMA operations on dense vector representations.
  *          Implements the `y = alpha * a * b + beta * c` operation.
@@ -302,10 +430,363 @@ typedef void (*simsimd_kernel_wsum_punned_t)(void const *a, void const *b, //
                                              simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
                                              void *y);
 
+/**
+ *  @brief  Type-punned function pointer for Scale operations on dense vector representations.
+ *          Implements the `y = alpha * a + beta` operation, and `y` may alias `a`.
+ *
+ *  @param[in] a        Pointer to the data array.
+ *  @param[in] n        Number of scalar words in the input array.
+ *  @param[in] alpha    Scaling factor for the array.
+ *  @param[in] beta     Shift added to every scaled element.
+ *  @param[out] y       Output value in the same precision as the input array.
+ */
+typedef void (*simsimd_kernel_scale_punned_t)(void const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, void *y);
+
+/**
+ *  @brief  Type-punned function pointer for element-wise Add and Multiply operations on dense vector representations.
+ *          Implements the `y = a + b` and `y = a * b` operations, and `y` may alias `a` or `b`.
+ *
+ *  @param[in] a        Pointer to the first data array.
+ *  @param[in] b        Pointer to the second data array.
+ *  @param[in] n        Number of scalar words in the input arrays.
+ *  @param[out] y       Output value in the same precision as the input arrays.
+ */
+typedef void (*simsimd_kernel_elementwise_punned_t)(void const *a, void const *b, simsimd_size_t n, void *y);
+
+/**
+ *  @brief  Type-punned function pointer for Quantize and Dequantize conversions between `f32` and other datatypes.
+ *          Implements the `y = alpha * a` operation, rounding and saturating integers, and packing `b8` sign bits
+ *          starting from the most significant one, like `numpy.packbits`.
+ *
+ *  @param[in] a        Pointer to the data array, in `f32` for Quantize, or in the kernel datatype for Dequantize.
+ *  @param[in] n        Number of scalar words in the input array.
+ *  @param[in] alpha    Scaling factor applied before the conversion.
+ *  @param[out] y       Output array, in the kernel datatype for Quantize, or in `f32` for Dequantize.
+ */
+typedef void (*simsimd_kernel_convert_punned_t)(void const *a, simsimd_size_t n, simsimd_distance_t alpha, void *y);
+
+/**
+ *  @brief  Type-punned function pointer for the Sum, L1 norm, and L2 norm reductions of many rows.
+ *          A single vector is just a matrix with one row.
+ *
+ *  @param[in] rows       Pointer to the first row of the matrix.
+ *  @param[in] count      Number of rows in the matrix.
+ *  @param[in] stride     Number of bytes between the starts of consecutive rows.
+ *  @param[in] n          Number of scalar words in each row.
+ *  @param[out] results   Array of `count` reductions as double-precision floats.
+ */
+typedef void (*simsimd_kernel_reduce_punned_t)(void const *rows, simsimd_size_t count, simsimd_size_t stride, //
+                                               simsimd_size_t n, simsimd_distance_t *results);
+
+/**
+ *  @brief  Type-punned function pointer for the Min and Max reductions of many rows, that also locate the
+ *          first occurrence of the extremum in every row. NaNs are skipped, and rows without comparable
+ *          elements report an infinity at index zero.
+ *
+ *  @param[in] rows       Pointer to the first row of the matrix.
+ *  @param[in] count      Number of rows in the matrix.
+ *  @param[in] stride     Number of bytes between the starts of consecutive rows.
+ *  @param[in] n          Number of scalar words in each row.
+ *  @param[out] values    Array of `count` extremums as double-precision floats.
+ *  @param[out] indices   Optional array of `count` indices of the extremums within their rows.
+ */
+typedef void (*simsimd_kernel_argreduce_punned_t)(void const *rows, simsimd_size_t count, simsimd_size_t stride, //
+                                                  simsimd_size_t n, simsimd_distance_t *values,
+                                                  simsimd_size_t *indices);
+
+/**
+ *  @brief  Type-punned function pointer for one-to-many comparisons of dense vectors.
+ *          Computes the distances between a single query and every row of a matrix.
+ *
+ *  @param[in] a          Pointer to the query data array.
+ *  @param[in] b          Pointer to the first row of the matrix of candidates.
+ *  @param[in] b_count    Number of rows in the candidates matrix.
+ *  @param[in] b_stride   Number of bytes between the starts of consecutive rows, at least the size of a row.
+ *  @param[in] n          Number of scalar words in the query and in each row.
+ *  @param[out] d         Array of `b_count` output values as double-precision floats.
+ */
+typedef void (*simsimd_metric_batch_punned_t)(void const *a, void const *b,                    //
+                                              simsimd_size_t b_count, simsimd_size_t b_stride, //
+                                              simsimd_size_t n, simsimd_distance_t *d);
+
+/**
+ *  @brief  Type-punned function pointer for many-to-many comparisons of dense vectors.
+ *          Computes the distances between every row of the first matrix and every row of the second.
+ *
+ *  @param[in] a          Pointer to the first row of the first matrix.
+ *  @param[in] b          Pointer to the first row of the second matrix.
+ *  @param[in] a_count    Number of rows in the first matrix.
+ *  @param[in] a_stride   Number of bytes between the starts of consecutive rows of the first matrix.
+ *  @param[in] b_count    Number of rows in the second matrix.
+ *  @param[in] b_stride   Number of bytes between the starts of consecutive rows of the second matrix.
+ *  @param[in] n          Number of scalar words in each row.
+ *  @param[out] d         Row-major `a_count` by `b_count` matrix of double-precision floats.
+ *  @param[in] d_stride   Number of bytes between the starts of consecutive rows of the output matrix.
+ */
+typedef void (*simsimd_metric_cdist_punned_t)(void const *a, void const *b,                    //
+                                              simsimd_size_t a_count, simsimd_size_t a_stride, //
+                                              simsimd_size_t b_count, simsimd_size_t b_stride, //
+                                              simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+
+/**
+ *  @brief  Type-punned function pointer for many-to-many comparisons of dense vectors, writing the output
+ *          matrix directly in the requested precision, without an intermediate double-precision matrix.
+ *
+ *  @param[in] a          Pointer to the first row of the first matrix.
+ *  @param[in] b          Pointer to the first row of the second matrix.
+ *  @param[in] a_count    Number of rows in the first matrix.
+ *  @param[in] a_stride   Number of bytes between the starts of consecutive rows of the first matrix.
+ *  @param[in] b_count    Number of rows in the second matrix.
+ *  @param[in] b_stride   Number of bytes between the starts of consecutive rows of the second matrix.
+ *  @param[in] n          Number of scalar words in each row.
+ *  @param[out] d         Row-major `a_count` by `b_count` matrix of `d_type` scalars.
+ *  @param[in] d_stride   Number of bytes between the starts of consecutive rows of the output matrix.
+ *  @param[in] d_type     Output precision, one of `f64`, `f32`, `f16`, or `bf16`.
+ */
+typedef void (*simsimd_metric_cdist_typed_punned_t)(void const *a, void const *b,                    //
+                                                    simsimd_size_t a_count, simsimd_size_t a_stride, //
+                                                    simsimd_size_t b_count, simsimd_size_t b_stride, //
+                                                    simsimd_size_t n, void *d, simsimd_size_t d_stride,
+                                                    simsimd_datatype_t d_type);
+
+/**
+ *  @brief  Type-punned function pointer for the squared Euclidean norms of many rows, to be computed once
+ *          and reused by the `simsimd_metric_batch_normed_punned_t` and `simsimd_metric_cdist_normed_punned_t`.
+ *
+ *  @param[in] rows       Pointer to the first row of the matrix.
+ *  @param[in] count      Number of rows in the matrix.
+ *  @param[in] stride     Number of bytes between the starts of consecutive rows.
+ *  @param[in] n          Number of scalar words in each row.
+ *  @param[out] norms     Array of `count` squared norms as double-precision floats.
+ */
+typedef void (*simsimd_kernel_norms_punned_t)(void const *rows, simsimd_size_t count, simsimd_size_t stride, //
+                                              simsimd_size_t n, simsimd_distance_t *norms);
+
+/**
+ *  @brief  Type-punned function pointer for one-to-many angular and Euclidean distances, reusing the cached
+ *          squared norms instead of recomputing them, so that only the dot-products are accumulated.
+ *
+ *  @param[in] a          Pointer to the query data array.
+ *  @param[in] b          Pointer to the first row of the matrix of candidates.
+ *  @param[in] b_count    Number of rows in the candidates matrix.
+ *  @param[in] b_stride   Number of bytes between the starts of consecutive rows, at least the size of a row.
+ *  @param[in] n          Number of scalar words in the query and in each row.
+ *  @param[in] a_norm     Optional pointer to the squared norm of the query, computed on the fly if null.
+ *  @param[in] b_norms    Optional array of `b_count` squared norms, falling back to the regular batch if null.
+ *  @param[out] d         Array of `b_count` output values as double-precision floats.
+ */
+typedef void (*simsimd_metric_batch_normed_punned_t)(void const *a, void const *b,                    //
+                                                     simsimd_size_t b_count, simsimd_size_t b_stride, //
+                                                     simsimd_size_t n, simsimd_distance_t const *a_norm,
+                                                     simsimd_distance_t const *b_norms, simsimd_distance_t *d);
+
+/**
+ *  @brief  Type-punned function pointer for many-to-many angular and Euclidean distances, reusing the cached
+ *          squared norms of either matrix, and writing the output matrix in the requested precision.
+ *
+ *  @param[in] a          Pointer to the first row of the first matrix.
+ *  @param[in] b          Pointer to the first row of the second matrix.
+ *  @param[in] a_count    Number of rows in the first matrix.
+ *  @param[in] a_stride   Number of bytes between the starts of consecutive rows of the first matrix.
+ *  @param[in] b_count    Number of rows in the second matrix.
+ *  @param[in] b_stride   Number of bytes between the starts of consecutive rows of the second matrix.
+ *  @param[in] n          Number of scalar words in each row.
+ *  @param[in] a_norms    Optional array of `a_count` squared norms, computed on the fly if null.
+ *  @param[in] b_norms    Optional array of `b_count` squared norms, computed on the fly if null.
+ *  @param[out] d         Row-major `a_count` by `b_count` matrix of `d_type` scalars.
+ *  @param[in] d_stride   Number of bytes between the starts of consecutive rows of the output matrix.
+ *  @param[in] d_type     Output precision, one of `f64`, `f32`, `f16`, or `bf16`.
+ */
+typedef void (*simsimd_metric_cdist_normed_punned_t)(void const *a, void const *b,                    //
+                                                     simsimd_size_t a_count, simsimd_size_t a_stride, //
+                                                     simsimd_size_t b_count, simsimd_size_t b_stride, //
+                                                     simsimd_size_t n, simsimd_distance_t const *a_norms,
+                                                     simsimd_distance_t const *b_norms, void *d,
+                                                     simsimd_size_t d_stride, simsimd_datatype_t d_type);
+
+/**
+ *  @brief  Type-punned function pointer for element-wise distances between pairs of points on Earth.
+ *          Coordinates are passed in radians in a Structure-of-Arrays layout.
+ *
+ *  @param[in] a_lats     Array of `n` latitudes of the first points.
+ *  @param[in] a_lons     Array of `n` longitudes of the first points.
+ *  @param[in] b_lats     Array of `n` latitudes of the second points.
+ *  @param[in] b_lons     Array of `n` longitudes of the second points.
+ *  @param[in] n          Number of pairs of points.
+ *  @param[out] d         Array of `n` output values as double-precision floats.
+ */
+typedef void (*simsimd_metric_geospatial_punned_t)(void const *a_lats, void const *a_lons, //
+                                                   void const *b_lats, void const *b_lons, //
+                                                   simsimd_size_t n, simsimd_distance_t *d);
+
+/**
+ *  @brief  Type-punned function pointer for distances between two rigid 3D point clouds.
+ *          Points are stored with interleaved `x, y, z` coordinates.
+ *
+ *  @param[in] a          First cloud of `n` points, `3 * n` scalars.
+ *  @param[in] b          Second cloud of `n` points, `3 * n` scalars.
+ *  @param[in] n          Number of points in each cloud.
+ *  @param[out] a_centroid  Optional output of 3 scalars for the centroid of `a`, can be NULL.
+ *  @param[out] b_centroid  Optional output of 3 scalars for the centroid of `b`, can be NULL.
+ *  @param[out] d         Output value as a double-precision float.
+ */
+typedef void (*simsimd_metric_mesh_punned_t)(void const *a, void const *b, simsimd_size_t n, //
+                                             void *a_centroid, void *b_centroid, simsimd_distance_t *d);
+
+/**
+ *  @brief  Type-punned function pointer for asymmetric metrics between a floating-point query
+ *          and a quantized row, which is dequantized on the fly as `(b[i] - zero_points[j]) * scales[j]`.
+ *          Such kernels are looked up with a combined datatype, like `simsimd_datatype_f32_k | simsimd_datatype_i8_k`.
+ *
+ *  @param[in] a              Pointer to the `f32` or `f16` query.
+ *  @param[in] b              Pointer to the `i8`, `u8`, or `i4x2` quantized row.
+ *  @param[in] n              Number of dimensions in both vectors, even for the packed `i4x2` rows.
+ *  @param[in] scales         Dequantization scales, either a single one or one per dimension.
+ *  @param[in] zero_points    Dequantization offsets, either a single one or one per dimension.
+ *  @param[in] params_stride  Zero for per-vector parameters, or one for per-dimension parameters.
+ *  @param[out] d             Output value as a double-precision float.
+ */
+typedef void (*simsimd_metric_quantized_punned_t)(void const *a, void const *b, simsimd_size_t n,  //
+                                                  simsimd_f32_t const *scales,                     //
+                                                  simsimd_f32_t const *zero_points,                //
+                                                  simsimd_size_t params_stride, simsimd_distance_t *d);
+
+/**
+ *  @brief  Type-punned function pointer for Product Quantization scans, summing one entry of a quantized
+ *          ADC table per subspace for every database vector, with codes packed into blocks of `SIMSIMD_PQ_BLOCK`.
+ *
+ *  @param[in] codes      Pointer to the packed `u8` or `u4x2` codes.
+ *  @param[in] count      Number of database vectors, not necessarily a multiple of `SIMSIMD_PQ_BLOCK`.
+ *  @param[in] subspaces  Number of subspaces, or codes per database vector.
+ *  @param[in] table      Quantized ADC table, with 256 entries per subspace for `u8` and 16 for `u4x2` codes.
+ *  @param[in] scale      Multiplier of the integer sums, as exported by `simsimd_pq_quantize_table`.
+ *  @param[in] bias       Offset of the integer sums, as exported by `simsimd_pq_quantize_table`.
+ *  @param[out] results   Output values as double-precision floats, one per database vector.
+ */
+typedef void (*simsimd_metric_pq_punned_t)(void const *codes, simsimd_size_t count, simsimd_size_t subspaces, //
+                                           simsimd_u8_t const *table, simsimd_distance_t scale,              //
+                                           simsimd_distance_t bias, simsimd_distance_t *results);
+
+/**
+ *  @brief  Type-punned function pointer for threshold searches, reporting the rows within a radius of the query.
+ *
+ *  @param[in] a          Pointer to the query data array.
+ *  @param[in] b          Pointer to the first row of the matrix of candidates.
+ *  @param[in] b_count    Number of rows in the candidates matrix.
+ *  @param[in] b_stride   Number of bytes between the starts of consecutive rows, at least the size of a row.
+ *  @param[in] n          Number of scalar words in the query and in each row.
+ *  @param[in] radius     Largest distance to be reported, inclusive.
+ *  @param[out] ids       Ascending indices of the matching rows, at least `b_count` entries.
+ *  @param[out] distances Optional distances of the matching rows, at least `b_count` entries, can be NULL.
+ *  @param[out] found     Number of matching rows.
+ */
+typedef void (*simsimd_metric_radius_punned_t)(void const *a, void const *b,                       //
+                                               simsimd_size_t b_count, simsimd_size_t b_stride,    //
+                                               simsimd_size_t n, simsimd_distance_t radius,        //
+                                               simsimd_size_t *ids, simsimd_distance_t *distances, //
+                                               simsimd_size_t *found);
+
+/**
+ *  @brief  Type-punned function pointer for one-to-many sparse set intersections over a CSR block of documents.
+ *
+ *  @param[in] a          Pointer to the sorted query indices.
+ *  @param[in] a_length   Number of scalar words in the query.
+ *  @param[in] b          Pointer to the concatenated sorted indices of all documents.
+ *  @param[in] b_offsets  Offsets of the documents in `b`, with `b_count + 1` entries.
+ *  @param[in] b_count    Number of documents.
+ *  @param[out] results   Output values as double-precision floats, one per document.
+ */
+typedef void (*simsimd_metric_sparse_batch_punned_t)(void const *a, simsimd_size_t a_length,         //
+                                                     void const *b, simsimd_size_t const *b_offsets, //
+                                                     simsimd_size_t b_count, simsimd_distance_t *results);
+
+/**
+ *  @brief  Type-punned function pointer for one-to-many sparse dot products over a CSR block of documents.
+ *
+ *  @param[in] a          Pointer to the sorted query indices.
+ *  @param[in] a_weights  Pointer to the query weights.
+ *  @param[in] a_length   Number of scalar words in the query.
+ *  @param[in] b          Pointer to the concatenated sorted indices of all documents.
+ *  @param[in] b_weights  Pointer to the concatenated weights of all documents, sharing `b_offsets`.
+ *  @param[in] b_offsets  Offsets of the documents in `b`, with `b_count + 1` entries.
+ *  @param[in] b_count    Number of documents.
+ *  @param[out] results   Output values as double-precision floats, one per document.
+ */
+typedef void (*simsimd_metric_spdot_batch_punned_t)(void const *a, void const *a_weights, simsimd_size_t a_length, //
+                                                    void const *b, void const *b_weights,                          //
+                                                    simsimd_size_t const *b_offsets, simsimd_size_t b_count,       //
+                                                    simsimd_distance_t *results);
+
+/**
+ *  @brief  Type-punned function pointer for one-to-many bounded Levenshtein distances between byte sequences.
+ *
+ *  @param[in] a          Pointer to the query sequence.
+ *  @param[in] a_length   Number of bytes in the query.
+ *  @param[in] b          Pointer to the first of the candidate sequences.
+ *  @param[in] b_lengths  Number of bytes in every candidate, with `b_count` entries.
+ *  @param[in] b_count    Number of candidates.
+ *  @param[in] b_stride   Number of bytes between the starts of consecutive candidates.
+ *  @param[in] bound      Largest distance of interest, with the further pairs reported as `bound + 1`.
+ *  @param[out] results   Output values as double-precision floats, one per candidate, or NaN for the pairs
+ *                        where both sequences are longer than `SIMSIMD_STRINGS_MAX_LENGTH` bytes.
+ */
+typedef void (*simsimd_metric_levenshtein_batch_punned_t)(void const *a, simsimd_size_t a_length,          //
+                                                          void const *b, simsimd_size_t const *b_lengths,  //
+                                                          simsimd_size_t b_count, simsimd_size_t b_stride, //
+                                                          simsimd_size_t bound, simsimd_distance_t *results);
+
+/**
+ *  @brief  Type-punned function pointer for one-to-many Needleman-Wunsch and Smith-Waterman alignment scores
+ *          between byte sequences, with a linear gap penalty.
+ *
+ *  @param[in] a          Pointer to the query sequence.
+ *  @param[in] a_length   Number of bytes in the query.
+ *  @param[in] b          Pointer to the first of the candidate sequences.
+ *  @param[in] b_lengths  Number of bytes in every candidate, with `b_count` entries.
+ *  @param[in] b_count    Number of candidates.
+ *  @param[in] b_stride   Number of bytes between the starts of consecutive candidates.
+ *  @param[in] match      Score of aligning two equal bytes.
+ *  @param[in] mismatch   Score of aligning two different bytes.
+ *  @param[in] gap        Score of skipping a byte in either sequence, usually negative.
+ *  @param[out] results   Output values as double-precision floats, one per candidate, or NaN for the pairs
+ *                        where both sequences are longer than `SIMSIMD_STRINGS_MAX_LENGTH` bytes.
+ */
+typedef void (*simsimd_metric_alignment_batch_punned_t)(void const *a, simsimd_size_t a_length,          //
+                                                        void const *b, simsimd_size_t const *b_lengths,  //
+                                                        simsimd_size_t b_count, simsimd_size_t b_stride, //
+                                                        simsimd_i32_t match, simsimd_i32_t mismatch,     //
+                                                        simsimd_i32_t gap, simsimd_distance_t *results);
+
+/**
+ *  @brief  Type-punned task, invoked by an executor once for every index in `[0, count)`.
+ *
+ *  @param[in] context    User-defined state shared by all tasks of a single submission.
+ *  @param[in] task       Index of the task, independent from the thread executing it.
+ */
+typedef void (*simsimd_task_punned_t)(void *context, simsimd_size_t task);
+
+/**
+ *  @brief  Type-punned executor, running `count` independent tasks, potentially in parallel,
+ *          and returning only once all of them have finished. Can wrap any thread pool, like
+ *          OpenMP, Intel TBB, or the built-in one in the dynamic dispatch library.
+ *
+ *  @param[in] executor   User-defined state of the executor, like a handle to a thread pool.
+ *  @param[in] task       Function to call for every task index.
+ *  @param[in] context    User-defined state forwarded to every `task` call.
+ *  @param[in] count      Number of tasks to execute.
+ */
+typedef void (*simsimd_executor_punned_t)(void *executor, simsimd_task_punned_t task, void *context,
+                                          simsimd_size_t count);
+
 /**
  *  @brief  Type-punned function pointer for a SimSIMD public interface.
  *          Can be a `simsimd_metric_dense_punned_t`, `simsimd_metric_sparse_punned_t`,
- *          or `simsimd_metric_curved_punned_t`.
+ *          `simsimd_metric_curved_punned_t`, `simsimd_metric_batch_punned_t`, `simsimd_metric_cdist_punned_t`,
+ *          `simsimd_metric_cdist_typed_punned_t`, `simsimd_kernel_norms_punned_t`,
+ *          `simsimd_metric_batch_normed_punned_t`, `simsimd_metric_cdist_normed_punned_t`,
+ *          `simsimd_metric_geospatial_punned_t`, `simsimd_metric_mesh_punned_t`,
+ *          `simsimd_metric_quantized_punned_t`, `simsimd_metric_pq_punned_t`, or `simsimd_metric_radius_punned_t`.
  */
 typedef simsimd_metric_dense_punned_t simsimd_metric_punned_t;
 
@@ -329,6 +810,237 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
     simsimd_capability_t *capability_output);
 #endif
 
+/**
+ *  @brief  Number of metric kinds and datatypes addressable in a `simsimd_dispatch_table_t`.
+ *          Metric kinds are 7-bit ASCII codes, and datatypes are single bits of `simsimd_datatype_t`.
+ */
+enum {
+    simsimd_dispatch_kinds_k = 128,
+    simsimd_dispatch_datatypes_k = 24,
+};
+
+/**
+ *  @brief  Resolved kernels for every metric kind and datatype, filled once and read-only afterwards.
+ *          Indexing it replaces the branchy `simsimd_find_metric_punned` on the hot path, which is a
+ *          measurable share of latency for short vectors, and can be shared between threads without locks.
+ */
+typedef struct simsimd_dispatch_table_t {
+    simsimd_capability_t capabilities; ///< The capabilities the kernels were resolved for
+    simsimd_metric_punned_t metrics[simsimd_dispatch_kinds_k][simsimd_dispatch_datatypes_k];
+    /// The capability of every resolved kernel, or zero if none was found, to trace the dispatch decisions
+    simsimd_capability_t used_capabilities[simsimd_dispatch_kinds_k][simsimd_dispatch_datatypes_k];
+} simsimd_dispatch_table_t;
+
+/**
+ *  @brief  Maps a single-bit `simsimd_datatype_t` to its column in `simsimd_dispatch_table_t`.
+ *          Folds into a constant for compile-time datatypes.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_dispatch_datatype_slot(simsimd_datatype_t datatype) {
+    switch (datatype) {
+    case simsimd_datatype_b8_k: return 1;
+    case simsimd_datatype_i8_k: return 2;
+    case simsimd_datatype_i16_k: return 3;
+    case simsimd_datatype_i32_k: return 4;
+    case simsimd_datatype_i64_k: return 5;
+    case simsimd_datatype_u8_k: return 6;
+    case simsimd_datatype_u16_k: return 7;
+    case simsimd_datatype_u32_k: return 8;
+    case simsimd_datatype_u64_k: return 9;
+    case simsimd_datatype_f64_k: return 10;
+    case simsimd_datatype_f32_k: return 11;
+    case simsimd_datatype_f16_k: return 12;
+    case simsimd_datatype_bf16_k: return 13;
+    case simsimd_datatype_u4x2_k: return 18;
+    case simsimd_datatype_i4x2_k: return 19;
+    case simsimd_datatype_f64c_k: return 20;
+    case simsimd_datatype_f32c_k: return 21;
+    case simsimd_datatype_f16c_k: return 22;
+    case simsimd_datatype_bf16c_k: return 23;
+    default: return 0;
+    }
+}
+
+/**
+ *  @brief  Resolves the kernels for all metric kinds and datatypes, probing `simsimd_find_metric_punned`.
+ *
+ *  @param[out] table     The table to fill, with null pointers for unsupported combinations.
+ *  @param[in] supported  The capabilities of the current machine, like `simsimd_capabilities()`.
+ *  @param[in] allowed    The capabilities the caller is willing to use, like `simsimd_cap_any_k`.
+ */
+SIMSIMD_PUBLIC void simsimd_dispatch_table_init(simsimd_dispatch_table_t *table, simsimd_capability_t supported,
+                                                simsimd_capability_t allowed) {
+    simsimd_size_t kind, slot;
+    simsimd_capability_t used_capability;
+    table->capabilities = (simsimd_capability_t)(supported & allowed);
+    for (kind = 0; kind != simsimd_dispatch_kinds_k; ++kind) {
+        table->metrics[kind][0] = 0; // Unknown datatypes never match
+        table->used_capabilities[kind][0] = (simsimd_capability_t)0;
+        for (slot = 1; slot != simsimd_dispatch_datatypes_k; ++slot) {
+            // The per-datatype lookups don't reset the output for unsupported metric kinds
+            table->metrics[kind][slot] = 0;
+            simsimd_find_metric_punned((simsimd_metric_kind_t)kind, (simsimd_datatype_t)(1 << slot), supported,
+                                       allowed, &table->metrics[kind][slot], &used_capability);
+            table->used_capabilities[kind][slot] =
+                table->metrics[kind][slot] ? used_capability : (simsimd_capability_t)0;
+        }
+    }
+}
+
+/**
+ *  @brief  Fetches a kernel from a filled `simsimd_dispatch_table_t`, returning a null pointer if unsupported.
+ *          Cast the result to the type-punned signature of the requested metric kind.
+ */
+SIMSIMD_PUBLIC simsimd_metric_punned_t simsimd_dispatch_table_find(simsimd_dispatch_table_t const *table,
+                                                                   simsimd_metric_kind_t kind,
+                                                                   simsimd_datatype_t datatype) {
+    return table->metrics[(simsimd_size_t)kind % simsimd_dispatch_kinds_k][simsimd_dispatch_datatype_slot(datatype)];
+}
+
+/**
+ *  @brief  Fetches the capability of a kernel from a filled `simsimd_dispatch_table_t`, returning zero if unsupported.
+ */
+SIMSIMD_PUBLIC simsimd_capability_t simsimd_dispatch_table_capability(simsimd_dispatch_table_t const *table,
+                                                                      simsimd_metric_kind_t kind,
+                                                                      simsimd_datatype_t datatype) {
+    return table->used_capabilities[(simsimd_size_t)kind % simsimd_dispatch_kinds_k]
+                                   [simsimd_dispatch_datatype_slot(datatype)];
+}
+
+#if SIMSIMD_DYNAMIC_DISPATCH
+/**
+ *  @brief  The dispatch table of the shared library, filled when it is loaded, for bindings to index directly.
+ */
+SIMSIMD_DYNAMIC simsimd_dispatch_table_t const *simsimd_dispatch_table(void);
+#endif
+
+/**
+ *  @brief  Number of vector length buckets and dense metric kinds addressable in a `simsimd_tuning_table_t`.
+ *          Bucket `i` covers lengths up to `32 << i` scalars, and the last one also covers all longer vectors.
+ */
+enum {
+    simsimd_tuning_buckets_k = 8,
+    simsimd_tuning_kinds_k = 10,
+};
+
+/**
+ *  @brief  Capabilities of the fastest kernels for every dense metric kind, datatype, and length bucket,
+ *          measured on the current machine. Zero entries are untuned and fall back to the default dispatch,
+ *          which prefers the newest capability, even where an older one is faster, like Haswell over Skylake
+ *          for short vectors, or NEON over SVE on some Graviton cores.
+ */
+typedef struct simsimd_tuning_table_t {
+    simsimd_capability_t winners[simsimd_tuning_kinds_k][simsimd_dispatch_datatypes_k][simsimd_tuning_buckets_k];
+} simsimd_tuning_table_t;
+
+/**
+ *  @brief  Maps a dense metric kind, following the `simsimd_metric_dense_punned_t` signature,
+ *          to its row in `simsimd_tuning_table_t`, or to zero if it can't be tuned.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_tuning_kind_slot(simsimd_metric_kind_t kind) {
+    switch (kind) {
+    case simsimd_metric_dot_k: return 1;
+    case simsimd_metric_vdot_k: return 2;
+    case simsimd_metric_cos_k: return 3;
+    case simsimd_metric_l2sq_k: return 4;
+    case simsimd_metric_l2_k: return 5;
+    case simsimd_metric_hamming_k: return 6;
+    case simsimd_metric_jaccard_k: return 7;
+    case simsimd_metric_kl_k: return 8;
+    case simsimd_metric_js_k: return 9;
+    default: return 0;
+    }
+}
+
+/**
+ *  @brief  Maps the number of scalar words in a vector to its column in `simsimd_tuning_table_t`.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_tuning_bucket(simsimd_size_t n) {
+    simsimd_size_t bucket = 0;
+    while (bucket + 1 != simsimd_tuning_buckets_k && n > ((simsimd_size_t)32 << bucket)) ++bucket;
+    return bucket;
+}
+
+/**
+ *  @brief  Lists the kernels available for a metric kind and datatype, from the newest capability to the oldest,
+ *          by repeatedly excluding the capability of the last match from the `allowed` mask.
+ *
+ *  @param[out] metrics       Up to `limit` candidate kernels.
+ *  @param[out] capabilities  Up to `limit` capabilities of the candidate kernels.
+ *  @return                   The number of candidates exported.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_find_metric_candidates(simsimd_metric_kind_t kind, simsimd_datatype_t datatype,
+                                                             simsimd_capability_t supported,
+                                                             simsimd_capability_t allowed,
+                                                             simsimd_metric_punned_t *metrics,
+                                                             simsimd_capability_t *capabilities, simsimd_size_t limit) {
+    simsimd_size_t count = 0;
+    while (count != limit) {
+        simsimd_metric_punned_t metric = 0;
+        simsimd_capability_t capability = simsimd_cap_serial_k;
+        simsimd_find_metric_punned(kind, datatype, supported, allowed, &metric, &capability);
+        if (!metric) break;
+        metrics[count] = metric, capabilities[count] = capability, ++count;
+        allowed = (simsimd_capability_t)(allowed & ~capability);
+    }
+    return count;
+}
+
+#if SIMSIMD_DYNAMIC_DISPATCH
+/*  Optional calibration of the dynamic dispatch library, consulted by dense metrics like `simsimd_dot_f32`
+ *  - `simsimd_tuning_calibrate` benchmarks all candidates of every tunable metric, datatype, and length bucket,
+ *    restricted to the `allowed` capabilities, running every kernel `repetitions` times per measurement.
+ *  - `simsimd_tuning_save` and `simsimd_tuning_load` persist the winners in a text file, returning 1 on success.
+ *    The file named by the `SIMSIMD_TUNING_FILE` environment variable is loaded when the library starts.
+ *  - `simsimd_tuning_reset` restores the default dispatch.
+ *  Calibrating or loading must not overlap with any computation.
+ */
+SIMSIMD_DYNAMIC void simsimd_tuning_calibrate(simsimd_capability_t allowed, simsimd_size_t repetitions);
+SIMSIMD_DYNAMIC int simsimd_tuning_save(char const *path);
+SIMSIMD_DYNAMIC int simsimd_tuning_load(char const *path);
+SIMSIMD_DYNAMIC void simsimd_tuning_reset(void);
+SIMSIMD_DYNAMIC simsimd_tuning_table_t const *simsimd_tuning_table(void);
+#endif
+
+/**
+ *  @brief  Accumulated usage of a single kernel of the dynamic dispatch library, built with `SIMSIMD_INSTRUMENTATION`.
+ */
+typedef struct simsimd_kernel_usage_t {
+    simsimd_metric_kind_t kind;      ///< The requested metric kind
+    simsimd_datatype_t datatype;     ///< The requested datatype, or a union of two for mixed-precision metrics
+    simsimd_capability_t capability; ///< The capability of the kernel that served the calls, zero if none was found
+    simsimd_u64_t calls;             ///< The number of calls, including the ones exporting NaNs for missing kernels
+    simsimd_u64_t bytes;             ///< The number of bytes in the inputs of all calls
+    simsimd_u64_t cycles;            ///< The number of CPU timestamp ticks spent in all calls, if counted
+} simsimd_kernel_usage_t;
+
+/**
+ *  @brief  Optional features of the instrumentation layer, combined into a bitmask.
+ */
+typedef enum {
+    simsimd_instrumentation_cycles_k = 1, ///< Read `rdtsc` on x86 or `cntvct_el0` on Arm around every call
+    simsimd_instrumentation_trace_k = 2,  ///< Log every first use of a metric, datatype, and capability to `stderr`
+} simsimd_instrumentation_flags_t;
+
+#if SIMSIMD_DYNAMIC_DISPATCH
+/*  Opt-in instrumentation of the dynamic dispatch library, compiled in with `SIMSIMD_INSTRUMENTATION`
+ *  - `simsimd_instrumentation_enabled` returns 1 if the library was compiled with instrumentation.
+ *  - `simsimd_instrumentation_configure` toggles `simsimd_instrumentation_flags_t`, which are also read from the
+ *    `SIMSIMD_INSTRUMENTATION_FLAGS` environment variable when the library starts.
+ *  - `simsimd_instrumentation_usage` exports up to `limit` entries, returning the total number of tracked kernels.
+ *  - `simsimd_instrumentation_reset` zeroes all counters, and must not overlap with any computation.
+ *  - `simsimd_instrumentation_ticks` and `simsimd_instrumentation_record` let the bindings, that call the kernels
+ *    directly, account for their own calls. The ticks are zero unless cycles are counted.
+ */
+SIMSIMD_DYNAMIC int simsimd_instrumentation_enabled(void);
+SIMSIMD_DYNAMIC void simsimd_instrumentation_configure(int flags);
+SIMSIMD_DYNAMIC simsimd_size_t simsimd_instrumentation_usage(simsimd_kernel_usage_t *usage, simsimd_size_t limit);
+SIMSIMD_DYNAMIC void simsimd_instrumentation_reset(void);
+SIMSIMD_DYNAMIC simsimd_u64_t simsimd_instrumentation_ticks(void);
+SIMSIMD_DYNAMIC void simsimd_instrumentation_record(simsimd_metric_kind_t kind, simsimd_datatype_t datatype,
+                                                    simsimd_capability_t capability, simsimd_u64_t calls,
+                                                    simsimd_u64_t bytes, simsimd_u64_t cycles);
+#endif
+
 #if _SIMSIMD_TARGET_X86
 
 /**
@@ -383,6 +1095,8 @@ SIMSIMD_PUBLIC simsimd_capability_t _simsimd_capabilities_x86(void) {
     unsigned supports_avx512bitalg = (info7.named.ecx & 0x00001000) != 0;
     // Check for AVX512VBMI2 (Function ID 7, ECX register)
     unsigned supports_avx512vbmi2 = (info7.named.ecx & 0x00000040) != 0;
+    // Check for AVX512VBMI (Function ID 7, ECX register)
+    unsigned supports_avx512vbmi = (info7.named.ecx & 0x00000002) != 0;
     // Check for AVX512VPOPCNTDQ (Function ID 7, ECX register)
     unsigned supports_avx512vpopcntdq = (info7.named.ecx & 0x00004000) != 0;
     // Check for AVX512BF16 (Function ID 7, Sub-leaf 1, EAX register)
@@ -391,26 +1105,60 @@ SIMSIMD_PUBLIC simsimd_capability_t _simsimd_capabilities_x86(void) {
     // Clang doesn't show the VP2INTERSECT flag, but we can get it from QEMU
     // https://stackoverflow.com/a/68289220/2766161
     unsigned supports_avx512vp2intersect = (info7.named.edx & 0x00000100) != 0;
+    // Check for AMX-BF16, AMX-TILE, and AMX-INT8 (Function ID 7, EDX register)
+    unsigned supports_amx_bf16 = (info7.named.edx & 0x00400000) != 0;
+    unsigned supports_amx_tile = (info7.named.edx & 0x01000000) != 0;
+    unsigned supports_amx_int8 = (info7.named.edx & 0x02000000) != 0;
+    // The OS must also preserve the tile configuration and data across context switches, enabling the bits 17
+    // and 18 of the XCR0 register, which can only be read if OSXSAVE (Function ID 1, ECX register) is set.
+    unsigned supports_osxsave = (info1.named.ecx & 0x08000000) != 0;
+    unsigned long long xcr0 = 0;
+    if (supports_osxsave) {
+#if defined(_MSC_VER)
+        xcr0 = _xgetbv(0);
+#else
+        unsigned xcr0_low, xcr0_high;
+        __asm__ __volatile__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+        xcr0 = ((unsigned long long)xcr0_high << 32) | xcr0_low;
+#endif
+    }
+    unsigned supports_amx_state = (xcr0 & 0x00060000) == 0x00060000;
 
     // Convert specific features into CPU generations
     unsigned supports_haswell = supports_avx2 && supports_f16c && supports_fma;
     unsigned supports_skylake = supports_avx512f;
     unsigned supports_ice = supports_avx512vnni && supports_avx512ifma && supports_avx512bitalg &&
-                            supports_avx512vbmi2 && supports_avx512vpopcntdq;
+                            supports_avx512vbmi && supports_avx512vbmi2 && supports_avx512vpopcntdq;
     unsigned supports_genoa = supports_avx512bf16;
     unsigned supports_sapphire = supports_avx512fp16;
     // We don't want to accidently enable AVX512VP2INTERSECT on Intel Tiger Lake CPUs
-    unsigned supports_turin = supports_avx512vp2intersect && supports_avx512bf16;
+    unsigned supports_turin = supports_avx512vp2intersect && supports_avx512bf16 && supports_avx512vnni;
     unsigned supports_sierra = 0;
+    unsigned supports_sapphire_amx = supports_amx_tile && supports_amx_bf16 && supports_amx_int8 && supports_amx_state;
+#if defined(_SIMSIMD_DEFINED_LINUX) && !defined(_MSC_VER)
+    // Since Linux 5.16 every process must request the permission to use the 8 KB tile data state before its
+    // first use, or the first tile instruction will be killed with `SIGILL`. Repeated requests are harmless.
+    // https://docs.kernel.org/arch/x86/xstate.html
+    if (supports_sapphire_amx) {
+        long status;
+        __asm__ __volatile__("syscall"
+                             : "=a"(status)
+                             : "a"(158 /* SYS_arch_prctl */), "D"(0x1023 /* ARCH_REQ_XCOMP_PERM */),
+                               "S"(18 /* XFEATURE_XTILEDATA */)
+                             : "rcx", "r11", "memory");
+        supports_sapphire_amx = status == 0;
+    }
+#endif
 
-    return (simsimd_capability_t)(                     //
-        (simsimd_cap_haswell_k * supports_haswell) |   //
-        (simsimd_cap_skylake_k * supports_skylake) |   //
-        (simsimd_cap_ice_k * supports_ice) |           //
-        (simsimd_cap_genoa_k * supports_genoa) |       //
-        (simsimd_cap_sapphire_k * supports_sapphire) | //
-        (simsimd_cap_turin_k * supports_turin) |       //
-        (simsimd_cap_sierra_k * supports_sierra) |     //
+    return (simsimd_capability_t)(                             //
+        (simsimd_cap_haswell_k * supports_haswell) |           //
+        (simsimd_cap_skylake_k * supports_skylake) |           //
+        (simsimd_cap_ice_k * supports_ice) |                   //
+        (simsimd_cap_genoa_k * supports_genoa) |               //
+        (simsimd_cap_sapphire_k * supports_sapphire) |         //
+        (simsimd_cap_turin_k * supports_turin) |               //
+        (simsimd_cap_sierra_k * supports_sierra) |             //
+        (simsimd_cap_sapphire_amx_k * supports_sapphire_amx) | //
         (simsimd_cap_serial_k));
 }
 
@@ -554,6 +1302,13 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f64(simsimd_capability_t v, si
         case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_f64_neon, *c = simsimd_cap_neon_k; return;
         case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f64_neon, *c = simsimd_cap_neon_k; return;
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_f64_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_haversine_k: *m = (m_t)&simsimd_haversine_f64_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_hav_k: *m = (m_t)&simsimd_hav_f64_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_vincenty_k: *m = (m_t)&simsimd_vincenty_f64_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_f64_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_f64_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_rmsd_batch_k: *m = (m_t)&simsimd_rmsd_batch_f64_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_kabsch_batch_k: *m = (m_t)&simsimd_kabsch_batch_f64_neon, *c = simsimd_cap_neon_k; return;
         default: break;
         }
 #endif
@@ -565,6 +1320,20 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f64(simsimd_capability_t v, si
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_f64_skylake, *c = simsimd_cap_skylake_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f64_skylake, *c = simsimd_cap_skylake_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f64_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_f64_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_f64_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_rmsd_batch_k: *m = (m_t)&simsimd_rmsd_batch_f64_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_kabsch_batch_k:
+            *m = (m_t)&simsimd_kabsch_batch_f64_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f64_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_f64_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_f64_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_f64_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_f64_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_f64_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_f64_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_f64_skylake, *c = simsimd_cap_skylake_k; return;
         default: break;
         }
 #endif
@@ -575,6 +1344,17 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f64(simsimd_capability_t v, si
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_f64_haswell, *c = simsimd_cap_haswell_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f64_haswell, *c = simsimd_cap_haswell_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f64_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_haversine_k: *m = (m_t)&simsimd_haversine_f64_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_hav_k: *m = (m_t)&simsimd_hav_f64_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_vincenty_k: *m = (m_t)&simsimd_vincenty_f64_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f64_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_f64_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_f64_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_f64_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_f64_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_f64_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_f64_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_f64_haswell, *c = simsimd_cap_haswell_k; return;
         default: break;
         }
 #endif
@@ -589,6 +1369,37 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f64(simsimd_capability_t v, si
         case simsimd_metric_mahalanobis_k: *m = (m_t)&simsimd_mahalanobis_f64_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f64_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_k: *m = (m_t)&simsimd_cos_batch_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_batch_k: *m = (m_t)&simsimd_l2sq_batch_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_batch_k: *m = (m_t)&simsimd_l2_batch_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_norms_k: *m = (m_t)&simsimd_norms_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_normed_k:
+            *m = (m_t)&simsimd_cos_batch_normed_f64_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_batch_normed_k:
+            *m = (m_t)&simsimd_l2sq_batch_normed_f64_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_batch_normed_k:
+            *m = (m_t)&simsimd_l2_batch_normed_f64_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_haversine_k: *m = (m_t)&simsimd_haversine_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_hav_k: *m = (m_t)&simsimd_hav_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_vincenty_k: *m = (m_t)&simsimd_vincenty_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_rmsd_batch_k: *m = (m_t)&simsimd_rmsd_batch_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_kabsch_batch_k:
+            *m = (m_t)&simsimd_kabsch_batch_f64_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_f64_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_f64_serial, *c = simsimd_cap_serial_k; return;
         default: break;
         }
 }
@@ -602,6 +1413,43 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f32(simsimd_capability_t v, si
         case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_f32_sve, *c = simsimd_cap_sve_k; return;
         case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f32_sve, *c = simsimd_cap_sve_k; return;
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_f32_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_f32_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_cos_batch_k: *m = (m_t)&simsimd_cos_batch_f32_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_l2sq_batch_k: *m = (m_t)&simsimd_l2sq_batch_f32_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_l2_batch_k: *m = (m_t)&simsimd_l2_batch_f32_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_norms_k: *m = (m_t)&simsimd_norms_f32_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_cos_batch_normed_k:
+            *m = (m_t)&simsimd_cos_batch_normed_f32_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_l2sq_batch_normed_k:
+            *m = (m_t)&simsimd_l2sq_batch_normed_f32_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_l2_batch_normed_k:
+            *m = (m_t)&simsimd_l2_batch_normed_f32_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_f32_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_f32_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_f32_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_f32_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_f32_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_f32_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_f32_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k: *m = (m_t)&simsimd_l2_cdist_typed_f32_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_f32_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_f32_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_f32_sve, *c = simsimd_cap_sve_k;
+            return;
         default: break;
         }
 #endif
@@ -615,6 +1463,64 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f32(simsimd_capability_t v, si
         case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_f32_neon, *c = simsimd_cap_neon_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f32_neon, *c = simsimd_cap_neon_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_cos_batch_k: *m = (m_t)&simsimd_cos_batch_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_l2sq_batch_k: *m = (m_t)&simsimd_l2sq_batch_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_l2_batch_k: *m = (m_t)&simsimd_l2_batch_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_norms_k: *m = (m_t)&simsimd_norms_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_cos_batch_normed_k:
+            *m = (m_t)&simsimd_cos_batch_normed_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2sq_batch_normed_k:
+            *m = (m_t)&simsimd_l2sq_batch_normed_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2_batch_normed_k:
+            *m = (m_t)&simsimd_l2_batch_normed_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_haversine_k: *m = (m_t)&simsimd_haversine_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_hav_k: *m = (m_t)&simsimd_hav_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_vincenty_k: *m = (m_t)&simsimd_vincenty_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_rmsd_batch_k: *m = (m_t)&simsimd_rmsd_batch_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_kabsch_batch_k: *m = (m_t)&simsimd_kabsch_batch_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_whiten_k: *m = (m_t)&simsimd_whiten_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_bilinear_cdist_k:
+            *m = (m_t)&simsimd_bilinear_cdist_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_f32_neon, *c = simsimd_cap_neon_k; return;
         default: break;
         }
 #endif
@@ -632,6 +1538,63 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f32(simsimd_capability_t v, si
             return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f32_skylake, *c = simsimd_cap_skylake_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_batch_k: *m = (m_t)&simsimd_cos_batch_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2sq_batch_k: *m = (m_t)&simsimd_l2sq_batch_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2_batch_k: *m = (m_t)&simsimd_l2_batch_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_norms_k: *m = (m_t)&simsimd_norms_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_batch_normed_k:
+            *m = (m_t)&simsimd_cos_batch_normed_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2sq_batch_normed_k:
+            *m = (m_t)&simsimd_l2sq_batch_normed_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2_batch_normed_k:
+            *m = (m_t)&simsimd_l2_batch_normed_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_rmsd_batch_k: *m = (m_t)&simsimd_rmsd_batch_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_kabsch_batch_k:
+            *m = (m_t)&simsimd_kabsch_batch_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_whiten_k: *m = (m_t)&simsimd_whiten_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_bilinear_cdist_k:
+            *m = (m_t)&simsimd_bilinear_cdist_f32_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_f32_skylake, *c = simsimd_cap_skylake_k; return;
         default: break;
         }
 #endif
@@ -643,20 +1606,130 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f32(simsimd_capability_t v, si
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_f32_haswell, *c = simsimd_cap_haswell_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f32_haswell, *c = simsimd_cap_haswell_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f32_haswell, *c = simsimd_cap_haswell_k; return;
-        default: break;
-        }
-#endif
-    if (v & simsimd_cap_serial_k) switch (k) {
-        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_f32_serial, *c = simsimd_cap_serial_k; return;
-        case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_f32_serial, *c = simsimd_cap_serial_k; return;
-        case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f32_serial, *c = simsimd_cap_serial_k; return;
-        case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_f32_serial, *c = simsimd_cap_serial_k; return;
-        case simsimd_metric_js_k: *m = (m_t)&simsimd_js_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_batch_k: *m = (m_t)&simsimd_cos_batch_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2sq_batch_k: *m = (m_t)&simsimd_l2sq_batch_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2_batch_k: *m = (m_t)&simsimd_l2_batch_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_norms_k: *m = (m_t)&simsimd_norms_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_batch_normed_k:
+            *m = (m_t)&simsimd_cos_batch_normed_f32_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2sq_batch_normed_k:
+            *m = (m_t)&simsimd_l2sq_batch_normed_f32_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2_batch_normed_k:
+            *m = (m_t)&simsimd_l2_batch_normed_f32_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_f32_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_f32_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_f32_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_f32_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_f32_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_f32_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_f32_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_haversine_k: *m = (m_t)&simsimd_haversine_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_hav_k: *m = (m_t)&simsimd_hav_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_vincenty_k: *m = (m_t)&simsimd_vincenty_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        default: break;
+        }
+#endif
+    if (v & simsimd_cap_serial_k) switch (k) {
+        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_js_k: *m = (m_t)&simsimd_js_f32_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_f32_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_bilinear_k: *m = (m_t)&simsimd_bilinear_f32_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_mahalanobis_k: *m = (m_t)&simsimd_mahalanobis_f32_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f32_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_k: *m = (m_t)&simsimd_cos_batch_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_batch_k: *m = (m_t)&simsimd_l2sq_batch_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_batch_k: *m = (m_t)&simsimd_l2_batch_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_norms_k: *m = (m_t)&simsimd_norms_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_normed_k:
+            *m = (m_t)&simsimd_cos_batch_normed_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_batch_normed_k:
+            *m = (m_t)&simsimd_l2sq_batch_normed_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_batch_normed_k:
+            *m = (m_t)&simsimd_l2_batch_normed_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_haversine_k: *m = (m_t)&simsimd_haversine_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_hav_k: *m = (m_t)&simsimd_hav_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_vincenty_k: *m = (m_t)&simsimd_vincenty_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_rmsd_batch_k: *m = (m_t)&simsimd_rmsd_batch_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_kabsch_batch_k:
+            *m = (m_t)&simsimd_kabsch_batch_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_whiten_k: *m = (m_t)&simsimd_whiten_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_bilinear_cdist_k:
+            *m = (m_t)&simsimd_bilinear_cdist_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_f32_serial, *c = simsimd_cap_serial_k; return;
         default: break;
         }
 }
@@ -664,12 +1737,67 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f32(simsimd_capability_t v, si
 SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f16(simsimd_capability_t v, simsimd_metric_kind_t k,
                                                       simsimd_metric_punned_t *m, simsimd_capability_t *c) {
     typedef simsimd_metric_punned_t m_t;
+#if SIMSIMD_TARGET_SVE2P1
+    if (v & simsimd_cap_sve2p1_k) switch (k) {
+        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_f16_sve2p1, *c = simsimd_cap_sve2p1_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_f16_sve2p1, *c = simsimd_cap_sve2p1_k; return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_f16_sve2p1, *c = simsimd_cap_sve2p1_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_f16_sve2p1, *c = simsimd_cap_sve2p1_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_f16_sve2p1, *c = simsimd_cap_sve2p1_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_f16_sve2p1, *c = simsimd_cap_sve2p1_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_f16_sve2p1, *c = simsimd_cap_sve2p1_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_f16_sve2p1, *c = simsimd_cap_sve2p1_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_f16_sve2p1, *c = simsimd_cap_sve2p1_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_f16_sve2p1, *c = simsimd_cap_sve2p1_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_f16_sve2p1, *c = simsimd_cap_sve2p1_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_f16_sve2p1, *c = simsimd_cap_sve2p1_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_f16_sve2p1, *c = simsimd_cap_sve2p1_k;
+            return;
+        default: break;
+        }
+#endif
 #if SIMSIMD_TARGET_SVE_F16
     if (v & simsimd_cap_sve_k) switch (k) {
         case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_f16_sve, *c = simsimd_cap_sve_f16_k; return;
         case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_f16_sve, *c = simsimd_cap_sve_f16_k; return;
         case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f16_sve, *c = simsimd_cap_sve_f16_k; return;
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_f16_sve, *c = simsimd_cap_sve_f16_k; return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_f16_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_f16_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_f16_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_f16_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_f16_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_f16_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_f16_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k: *m = (m_t)&simsimd_l2_cdist_typed_f16_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_f16_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_f16_sve, *c = simsimd_cap_sve_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_f16_sve, *c = simsimd_cap_sve_k;
+            return;
         default: break;
         }
 #endif
@@ -685,6 +1813,39 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f16(simsimd_capability_t v, si
         case simsimd_metric_mahalanobis_k: *m = (m_t)&simsimd_mahalanobis_f16_neon, *c = simsimd_cap_neon_f16_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f16_neon, *c = simsimd_cap_neon_f16_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_f16_neon, *c = simsimd_cap_neon_f16_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_f16_neon, *c = simsimd_cap_neon_f16_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_f16_neon, *c = simsimd_cap_neon_f16_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_f16_neon, *c = simsimd_cap_neon_f16_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_f16_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_f16_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_f16_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_rmsd_batch_k: *m = (m_t)&simsimd_rmsd_batch_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_kabsch_batch_k:
+            *m = (m_t)&simsimd_kabsch_batch_f16_neon, *c = simsimd_cap_neon_f16_k;
+            return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_dequantize_k: *m = (m_t)&simsimd_dequantize_f16_neon, *c = simsimd_cap_neon_f16_k; return;
         default: break;
         }
 #endif
@@ -702,6 +1863,44 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f16(simsimd_capability_t v, si
             return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f16_sapphire, *c = simsimd_cap_sapphire_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f16_sapphire, *c = simsimd_cap_sapphire_k; return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_f16_sapphire, *c = simsimd_cap_sapphire_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_f16_sapphire, *c = simsimd_cap_sapphire_k; return;
+        case simsimd_metric_rmsd_batch_k:
+            *m = (m_t)&simsimd_rmsd_batch_f16_sapphire, *c = simsimd_cap_sapphire_k;
+            return;
+        case simsimd_metric_kabsch_batch_k:
+            *m = (m_t)&simsimd_kabsch_batch_f16_sapphire, *c = simsimd_cap_sapphire_k;
+            return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+    if (v & simsimd_cap_skylake_k) switch (k) {
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_f16_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_f16_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_f16_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_f16_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_f16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_f16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_f16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_f16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_f16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_f16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_f16_skylake, *c = simsimd_cap_skylake_k;
+            return;
         default: break;
         }
 #endif
@@ -719,6 +1918,41 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f16(simsimd_capability_t v, si
             return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f16_haswell, *c = simsimd_cap_haswell_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_f16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_f16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_f16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_f16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_f16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_f16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_f16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dequantize_k: *m = (m_t)&simsimd_dequantize_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_f16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_f16_haswell, *c = simsimd_cap_haswell_k; return;
         default: break;
         }
 #endif
@@ -733,6 +1967,61 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f16(simsimd_capability_t v, si
         case simsimd_metric_mahalanobis_k: *m = (m_t)&simsimd_mahalanobis_f16_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f16_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_k: *m = (m_t)&simsimd_cos_batch_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_batch_k: *m = (m_t)&simsimd_l2sq_batch_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_batch_k: *m = (m_t)&simsimd_l2_batch_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_norms_k: *m = (m_t)&simsimd_norms_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_normed_k:
+            *m = (m_t)&simsimd_cos_batch_normed_f16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_batch_normed_k:
+            *m = (m_t)&simsimd_l2sq_batch_normed_f16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_batch_normed_k:
+            *m = (m_t)&simsimd_l2_batch_normed_f16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_f16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_f16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_f16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_f16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_f16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_f16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_f16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_rmsd_batch_k: *m = (m_t)&simsimd_rmsd_batch_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_kabsch_batch_k:
+            *m = (m_t)&simsimd_kabsch_batch_f16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dequantize_k: *m = (m_t)&simsimd_dequantize_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_f16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_f16_serial, *c = simsimd_cap_serial_k; return;
         default: break;
         }
 }
@@ -742,9 +2031,36 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_bf16(simsimd_capability_t v, s
     typedef simsimd_metric_punned_t m_t;
 #if SIMSIMD_TARGET_SVE_BF16
     if (v & simsimd_cap_sve_bf16_k) switch (k) {
+        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_bf16_sve, *c = simsimd_cap_sve_bf16_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_bf16_sve, *c = simsimd_cap_sve_bf16_k; return;
         case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_bf16_sve, *c = simsimd_cap_sve_bf16_k; return;
         case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_bf16_sve, *c = simsimd_cap_sve_bf16_k; return;
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_bf16_sve, *c = simsimd_cap_sve_bf16_k; return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_bf16_sve, *c = simsimd_cap_sve_bf16_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_bf16_sve, *c = simsimd_cap_sve_bf16_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_bf16_sve, *c = simsimd_cap_sve_bf16_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_bf16_sve, *c = simsimd_cap_sve_bf16_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_bf16_sve, *c = simsimd_cap_sve_bf16_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_bf16_sve, *c = simsimd_cap_sve_bf16_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_bf16_sve, *c = simsimd_cap_sve_bf16_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_bf16_sve, *c = simsimd_cap_sve_bf16_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_bf16_sve, *c = simsimd_cap_sve_bf16_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_bf16_sve, *c = simsimd_cap_sve_bf16_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_bf16_sve, *c = simsimd_cap_sve_bf16_k;
+            return;
         default: break;
         }
 #endif
@@ -756,6 +2072,75 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_bf16(simsimd_capability_t v, s
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_bf16_neon, *c = simsimd_cap_neon_bf16_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_bf16_neon, *c = simsimd_cap_neon_bf16_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_bf16_neon, *c = simsimd_cap_neon_bf16_k; return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_bf16_neon, *c = simsimd_cap_neon_bf16_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_bf16_neon, *c = simsimd_cap_neon_bf16_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_bf16_neon, *c = simsimd_cap_neon_bf16_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_bf16_neon, *c = simsimd_cap_neon_bf16_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_bf16_neon, *c = simsimd_cap_neon_bf16_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_bf16_neon, *c = simsimd_cap_neon_bf16_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_bf16_neon, *c = simsimd_cap_neon_bf16_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_bf16_neon, *c = simsimd_cap_neon_bf16_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_bf16_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_bf16_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_bf16_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_bf16_neon, *c = simsimd_cap_neon_bf16_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_bf16_neon, *c = simsimd_cap_neon_bf16_k; return;
+        case simsimd_metric_rmsd_batch_k: *m = (m_t)&simsimd_rmsd_batch_bf16_neon, *c = simsimd_cap_neon_bf16_k; return;
+        case simsimd_metric_kabsch_batch_k:
+            *m = (m_t)&simsimd_kabsch_batch_bf16_neon, *c = simsimd_cap_neon_bf16_k;
+            return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_SAPPHIRE_AMX
+    if (v & simsimd_cap_sapphire_amx_k) switch (k) {
+        case simsimd_metric_dot_cdist_k:
+            *m = (m_t)&simsimd_dot_cdist_bf16_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_cos_cdist_k:
+            *m = (m_t)&simsimd_cos_cdist_bf16_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2sq_cdist_k:
+            *m = (m_t)&simsimd_l2sq_cdist_bf16_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2_cdist_k:
+            *m = (m_t)&simsimd_l2_cdist_bf16_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_bf16_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_bf16_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_bf16_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_bf16_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_bf16_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_bf16_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_bf16_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
         default: break;
         }
 #endif
@@ -767,6 +2152,37 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_bf16(simsimd_capability_t v, s
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_bf16_genoa, *c = simsimd_cap_genoa_k; return;
         case simsimd_metric_bilinear_k: *m = (m_t)&simsimd_bilinear_bf16_genoa, *c = simsimd_cap_genoa_k; return;
         case simsimd_metric_mahalanobis_k: *m = (m_t)&simsimd_mahalanobis_bf16_genoa, *c = simsimd_cap_genoa_k; return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_bf16_genoa, *c = simsimd_cap_genoa_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_bf16_genoa, *c = simsimd_cap_genoa_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_bf16_genoa, *c = simsimd_cap_genoa_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_bf16_genoa, *c = simsimd_cap_genoa_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_bf16_genoa, *c = simsimd_cap_genoa_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_bf16_genoa, *c = simsimd_cap_genoa_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_bf16_genoa, *c = simsimd_cap_genoa_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_bf16_genoa, *c = simsimd_cap_genoa_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_bf16_genoa, *c = simsimd_cap_genoa_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_bf16_genoa, *c = simsimd_cap_genoa_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_bf16_genoa, *c = simsimd_cap_genoa_k;
+            return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_bf16_genoa, *c = simsimd_cap_genoa_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_bf16_genoa, *c = simsimd_cap_genoa_k; return;
+        case simsimd_metric_rmsd_batch_k: *m = (m_t)&simsimd_rmsd_batch_bf16_genoa, *c = simsimd_cap_genoa_k; return;
+        case simsimd_metric_kabsch_batch_k:
+            *m = (m_t)&simsimd_kabsch_batch_bf16_genoa, *c = simsimd_cap_genoa_k;
+            return;
         default: break;
         }
 #endif
@@ -774,6 +2190,33 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_bf16(simsimd_capability_t v, s
     if (v & simsimd_cap_skylake_k) switch (k) {
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_bf16_skylake, *c = simsimd_cap_skylake_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_bf16_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_bf16_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_bf16_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2sq_cdist_k:
+            *m = (m_t)&simsimd_l2sq_cdist_bf16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_bf16_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_bf16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_bf16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_bf16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_bf16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_bf16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_bf16_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_bf16_skylake, *c = simsimd_cap_skylake_k;
+            return;
         default: break;
         }
 #endif
@@ -789,6 +2232,51 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_bf16(simsimd_capability_t v, s
             return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_bf16_haswell, *c = simsimd_cap_haswell_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2sq_cdist_k:
+            *m = (m_t)&simsimd_l2sq_cdist_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dequantize_k:
+            *m = (m_t)&simsimd_dequantize_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_reduce_sum_k:
+            *m = (m_t)&simsimd_reduce_sum_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_min_k:
+            *m = (m_t)&simsimd_reduce_min_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_reduce_max_k:
+            *m = (m_t)&simsimd_reduce_max_bf16_haswell, *c = simsimd_cap_haswell_k;
+            return;
         default: break;
         }
 #endif
@@ -805,6 +2293,61 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_bf16(simsimd_capability_t v, s
             return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_bf16_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_k: *m = (m_t)&simsimd_cos_batch_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_batch_k: *m = (m_t)&simsimd_l2sq_batch_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_batch_k: *m = (m_t)&simsimd_l2_batch_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_norms_k: *m = (m_t)&simsimd_norms_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_normed_k:
+            *m = (m_t)&simsimd_cos_batch_normed_bf16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_batch_normed_k:
+            *m = (m_t)&simsimd_l2sq_batch_normed_bf16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_batch_normed_k:
+            *m = (m_t)&simsimd_l2_batch_normed_bf16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_bf16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_bf16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_bf16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_bf16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_bf16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_bf16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_bf16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_rmsd_k: *m = (m_t)&simsimd_rmsd_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_kabsch_k: *m = (m_t)&simsimd_kabsch_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_rmsd_batch_k: *m = (m_t)&simsimd_rmsd_batch_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_kabsch_batch_k:
+            *m = (m_t)&simsimd_kabsch_batch_bf16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dequantize_k: *m = (m_t)&simsimd_dequantize_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_bf16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_bf16_serial, *c = simsimd_cap_serial_k; return;
         default: break;
         }
 }
@@ -812,12 +2355,81 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_bf16(simsimd_capability_t v, s
 SIMSIMD_INTERNAL void _simsimd_find_metric_punned_i8(simsimd_capability_t v, simsimd_metric_kind_t k,
                                                      simsimd_metric_punned_t *m, simsimd_capability_t *c) {
     typedef simsimd_metric_punned_t m_t;
+#if SIMSIMD_TARGET_SVE_I8
+    if (v & simsimd_cap_sve_i8_k) switch (k) {
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_i8_sve, *c = simsimd_cap_sve_i8_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_i8_sve, *c = simsimd_cap_sve_i8_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_i8_sve, *c = simsimd_cap_sve_i8_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_i8_sve, *c = simsimd_cap_sve_i8_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_i8_sve, *c = simsimd_cap_sve_i8_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_i8_sve, *c = simsimd_cap_sve_i8_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_i8_sve, *c = simsimd_cap_sve_i8_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_i8_sve, *c = simsimd_cap_sve_i8_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_i8_sve, *c = simsimd_cap_sve_i8_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_i8_sve, *c = simsimd_cap_sve_i8_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_i8_sve, *c = simsimd_cap_sve_i8_k;
+            return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_SVE
+    if (v & simsimd_cap_sve_k) switch (k) {
+        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i8_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_i8_sve, *c = simsimd_cap_sve_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_NEON
+    if (v & simsimd_cap_neon_k) switch (k) {
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_i8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_dequantize_k: *m = (m_t)&simsimd_dequantize_i8_neon, *c = simsimd_cap_neon_k; return;
+        default: break;
+        }
+#endif
 #if SIMSIMD_TARGET_NEON_I8
     if (v & simsimd_cap_neon_i8_k) switch (k) {
         case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i8_neon, *c = simsimd_cap_neon_i8_k; return;
         case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i8_neon, *c = simsimd_cap_neon_i8_k; return;
         case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i8_neon, *c = simsimd_cap_neon_i8_k; return;
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_i8_neon, *c = simsimd_cap_neon_i8_k; return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_i8_neon, *c = simsimd_cap_neon_i8_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_i8_neon, *c = simsimd_cap_neon_i8_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_i8_neon, *c = simsimd_cap_neon_i8_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_i8_neon, *c = simsimd_cap_neon_i8_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_i8_neon, *c = simsimd_cap_neon_i8_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_i8_neon, *c = simsimd_cap_neon_i8_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_i8_neon, *c = simsimd_cap_neon_i8_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_i8_neon, *c = simsimd_cap_neon_i8_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_i8_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_i8_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_i8_neon, *c = simsimd_cap_neon_k;
+            return;
         default: break;
         }
 #endif
@@ -828,6 +2440,44 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_i8(simsimd_capability_t v, sim
         default: break;
         }
 #endif
+#if SIMSIMD_TARGET_SAPPHIRE_AMX
+    if (v & simsimd_cap_sapphire_amx_k) switch (k) {
+        case simsimd_metric_dot_cdist_k:
+            *m = (m_t)&simsimd_dot_cdist_i8_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_cos_cdist_k:
+            *m = (m_t)&simsimd_cos_cdist_i8_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2sq_cdist_k:
+            *m = (m_t)&simsimd_l2sq_cdist_i8_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2_cdist_k:
+            *m = (m_t)&simsimd_l2_cdist_i8_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_i8_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_i8_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_i8_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_i8_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_i8_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_i8_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_i8_sapphire_amx, *c = simsimd_cap_sapphire_amx_k;
+            return;
+        default: break;
+        }
+#endif
 #if SIMSIMD_TARGET_SAPPHIRE //! Scaling of 8-bit integers is performed using 16-bit floats.
     if (v & simsimd_cap_sapphire_k) switch (k) {
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_i8_sapphire, *c = simsimd_cap_sapphire_k; return;
@@ -841,6 +2491,43 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_i8(simsimd_capability_t v, sim
         case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i8_ice, *c = simsimd_cap_ice_k; return;
         case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i8_ice, *c = simsimd_cap_ice_k; return;
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_i8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_i8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_cos_batch_k: *m = (m_t)&simsimd_cos_batch_i8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_l2sq_batch_k: *m = (m_t)&simsimd_l2sq_batch_i8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_l2_batch_k: *m = (m_t)&simsimd_l2_batch_i8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_norms_k: *m = (m_t)&simsimd_norms_i8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_cos_batch_normed_k:
+            *m = (m_t)&simsimd_cos_batch_normed_i8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_l2sq_batch_normed_k:
+            *m = (m_t)&simsimd_l2sq_batch_normed_i8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_l2_batch_normed_k:
+            *m = (m_t)&simsimd_l2_batch_normed_i8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_i8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_i8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_i8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_i8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_i8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_i8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_i8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k: *m = (m_t)&simsimd_l2_cdist_typed_i8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_i8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_i8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_i8_ice, *c = simsimd_cap_ice_k;
+            return;
         default: break;
         }
 #endif
@@ -852,6 +2539,13 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_i8(simsimd_capability_t v, sim
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_i8_haswell, *c = simsimd_cap_haswell_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_i8_haswell, *c = simsimd_cap_haswell_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dequantize_k: *m = (m_t)&simsimd_dequantize_i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_i8_haswell, *c = simsimd_cap_haswell_k; return;
         default: break;
         }
 #endif
@@ -862,12 +2556,78 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_i8(simsimd_capability_t v, sim
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_i8_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_i8_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_k: *m = (m_t)&simsimd_cos_batch_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_batch_k: *m = (m_t)&simsimd_l2sq_batch_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_batch_k: *m = (m_t)&simsimd_l2_batch_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_norms_k: *m = (m_t)&simsimd_norms_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_normed_k:
+            *m = (m_t)&simsimd_cos_batch_normed_i8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_batch_normed_k:
+            *m = (m_t)&simsimd_l2sq_batch_normed_i8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_batch_normed_k:
+            *m = (m_t)&simsimd_l2_batch_normed_i8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_dot_cdist_k: *m = (m_t)&simsimd_dot_cdist_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_cdist_k: *m = (m_t)&simsimd_cos_cdist_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_cdist_k: *m = (m_t)&simsimd_l2sq_cdist_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_cdist_k: *m = (m_t)&simsimd_l2_cdist_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_cdist_typed_k:
+            *m = (m_t)&simsimd_dot_cdist_typed_i8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_cos_cdist_typed_k:
+            *m = (m_t)&simsimd_cos_cdist_typed_i8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_cdist_typed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_typed_i8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_cdist_typed_k:
+            *m = (m_t)&simsimd_l2_cdist_typed_i8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_cos_cdist_normed_k:
+            *m = (m_t)&simsimd_cos_cdist_normed_i8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_cdist_normed_k:
+            *m = (m_t)&simsimd_l2sq_cdist_normed_i8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_cdist_normed_k:
+            *m = (m_t)&simsimd_l2_cdist_normed_i8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dequantize_k: *m = (m_t)&simsimd_dequantize_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_i8_serial, *c = simsimd_cap_serial_k; return;
         default: break;
         }
 }
 SIMSIMD_INTERNAL void _simsimd_find_metric_punned_u8(simsimd_capability_t v, simsimd_metric_kind_t k,
                                                      simsimd_metric_punned_t *m, simsimd_capability_t *c) {
     typedef simsimd_metric_punned_t m_t;
+#if SIMSIMD_TARGET_NEON
+    if (v & simsimd_cap_neon_k) switch (k) {
+        case simsimd_metric_pq_scan_k: *m = (m_t)&simsimd_pq_scan_u8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_u8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_dequantize_k: *m = (m_t)&simsimd_dequantize_u8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_levenshtein_batch_k:
+            *m = (m_t)&simsimd_levenshtein_batch_u8_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_needleman_wunsch_batch_k:
+            *m = (m_t)&simsimd_needleman_wunsch_batch_u8_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_smith_waterman_batch_k:
+            *m = (m_t)&simsimd_smith_waterman_batch_u8_neon, *c = simsimd_cap_neon_k;
+            return;
+        default: break;
+        }
+#endif
 #if SIMSIMD_TARGET_NEON_I8
     if (v & simsimd_cap_neon_i8_k) switch (k) {
         case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_u8_neon, *c = simsimd_cap_neon_i8_k; return;
@@ -897,6 +2657,16 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_u8(simsimd_capability_t v, sim
         case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_u8_ice, *c = simsimd_cap_ice_k; return;
         case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_u8_ice, *c = simsimd_cap_ice_k; return;
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_u8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_pq_scan_k: *m = (m_t)&simsimd_pq_scan_u8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_levenshtein_batch_k:
+            *m = (m_t)&simsimd_levenshtein_batch_u8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_needleman_wunsch_batch_k:
+            *m = (m_t)&simsimd_needleman_wunsch_batch_u8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_smith_waterman_batch_k:
+            *m = (m_t)&simsimd_smith_waterman_batch_u8_ice, *c = simsimd_cap_ice_k;
+            return;
         default: break;
         }
 #endif
@@ -908,6 +2678,13 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_u8(simsimd_capability_t v, sim
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_u8_haswell, *c = simsimd_cap_haswell_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_u8_haswell, *c = simsimd_cap_haswell_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dequantize_k: *m = (m_t)&simsimd_dequantize_u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_u8_haswell, *c = simsimd_cap_haswell_k; return;
         default: break;
         }
 #endif
@@ -916,57 +2693,517 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_u8(simsimd_capability_t v, sim
         case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_u8_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_u8_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_pq_scan_k: *m = (m_t)&simsimd_pq_scan_u8_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_u8_serial, *c = simsimd_cap_serial_k; return;
         case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_batch_k: *m = (m_t)&simsimd_dot_batch_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_k: *m = (m_t)&simsimd_cos_batch_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_batch_k: *m = (m_t)&simsimd_l2sq_batch_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_batch_k: *m = (m_t)&simsimd_l2_batch_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_norms_k: *m = (m_t)&simsimd_norms_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_batch_normed_k:
+            *m = (m_t)&simsimd_cos_batch_normed_u8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2sq_batch_normed_k:
+            *m = (m_t)&simsimd_l2sq_batch_normed_u8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_l2_batch_normed_k:
+            *m = (m_t)&simsimd_l2_batch_normed_u8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_add_k: *m = (m_t)&simsimd_add_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_multiply_k: *m = (m_t)&simsimd_multiply_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dequantize_k: *m = (m_t)&simsimd_dequantize_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_sum_k: *m = (m_t)&simsimd_reduce_sum_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l1_k: *m = (m_t)&simsimd_reduce_l1_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_l2_k: *m = (m_t)&simsimd_reduce_l2_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_min_k: *m = (m_t)&simsimd_reduce_min_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_reduce_max_k: *m = (m_t)&simsimd_reduce_max_u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_levenshtein_batch_k:
+            *m = (m_t)&simsimd_levenshtein_batch_u8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_needleman_wunsch_batch_k:
+            *m = (m_t)&simsimd_needleman_wunsch_batch_u8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_smith_waterman_batch_k:
+            *m = (m_t)&simsimd_smith_waterman_batch_u8_serial, *c = simsimd_cap_serial_k;
+            return;
         default: break;
         }
 }
 
-SIMSIMD_INTERNAL void _simsimd_find_metric_punned_b8(simsimd_capability_t v, simsimd_metric_kind_t k,
-                                                     simsimd_metric_punned_t *m, simsimd_capability_t *c) {
+SIMSIMD_INTERNAL void _simsimd_find_metric_punned_i4x2(simsimd_capability_t v, simsimd_metric_kind_t k,
+                                                       simsimd_metric_punned_t *m, simsimd_capability_t *c) {
     typedef simsimd_metric_punned_t m_t;
 #if SIMSIMD_TARGET_SVE
     if (v & simsimd_cap_sve_k) switch (k) {
-        case simsimd_metric_hamming_k: *m = (m_t)&simsimd_hamming_b8_sve, *c = simsimd_cap_sve_k; return;
-        case simsimd_metric_jaccard_k: *m = (m_t)&simsimd_jaccard_b8_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i4x2_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i4x2_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i4x2_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_i4x2_sve, *c = simsimd_cap_sve_k; return;
         default: break;
         }
 #endif
-#if SIMSIMD_TARGET_NEON
-    if (v & simsimd_cap_neon_k) switch (k) {
-        case simsimd_metric_hamming_k: *m = (m_t)&simsimd_hamming_b8_neon, *c = simsimd_cap_neon_k; return;
-        case simsimd_metric_jaccard_k: *m = (m_t)&simsimd_jaccard_b8_neon, *c = simsimd_cap_neon_k; return;
+#if SIMSIMD_TARGET_NEON_I8
+    if (v & simsimd_cap_neon_i8_k) switch (k) {
+        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i4x2_neon, *c = simsimd_cap_neon_i8_k; return;
+        case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i4x2_neon, *c = simsimd_cap_neon_i8_k; return;
+        case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i4x2_neon, *c = simsimd_cap_neon_i8_k; return;
+        case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_i4x2_neon, *c = simsimd_cap_neon_i8_k; return;
         default: break;
         }
 #endif
 #if SIMSIMD_TARGET_ICE
     if (v & simsimd_cap_ice_k) switch (k) {
-        case simsimd_metric_hamming_k: *m = (m_t)&simsimd_hamming_b8_ice, *c = simsimd_cap_ice_k; return;
-        case simsimd_metric_jaccard_k: *m = (m_t)&simsimd_jaccard_b8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i4x2_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i4x2_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i4x2_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_i4x2_ice, *c = simsimd_cap_ice_k; return;
         default: break;
         }
 #endif
 #if SIMSIMD_TARGET_HASWELL
     if (v & simsimd_cap_haswell_k) switch (k) {
-        case simsimd_metric_hamming_k: *m = (m_t)&simsimd_hamming_b8_haswell, *c = simsimd_cap_haswell_k; return;
-        case simsimd_metric_jaccard_k: *m = (m_t)&simsimd_jaccard_b8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i4x2_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i4x2_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i4x2_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_i4x2_haswell, *c = simsimd_cap_haswell_k; return;
         default: break;
         }
 #endif
     if (v & simsimd_cap_serial_k) switch (k) {
-        case simsimd_metric_hamming_k: *m = (m_t)&simsimd_hamming_b8_serial, *c = simsimd_cap_serial_k; return;
-        case simsimd_metric_jaccard_k: *m = (m_t)&simsimd_jaccard_b8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i4x2_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i4x2_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i4x2_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_k: *m = (m_t)&simsimd_l2_i4x2_serial, *c = simsimd_cap_serial_k; return;
         default: break;
         }
 }
 
-SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f64c(simsimd_capability_t v, simsimd_metric_kind_t k,
-                                                       simsimd_metric_punned_t *m, simsimd_capability_t *c) {
+SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f32i8(simsimd_capability_t v, simsimd_metric_kind_t k,
+                                                        simsimd_metric_punned_t *m, simsimd_capability_t *c) {
     typedef simsimd_metric_punned_t m_t;
-#if SIMSIMD_TARGET_SVE
-    if (v & simsimd_cap_sve_k) switch (k) {
-        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_f64c_sve, *c = simsimd_cap_sve_k; return;
-        case simsimd_metric_vdot_k: *m = (m_t)&simsimd_vdot_f64c_sve, *c = simsimd_cap_sve_k; return;
+#if SIMSIMD_TARGET_NEON
+    if (v & simsimd_cap_neon_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32i8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32i8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f32i8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32i8_neon, *c = simsimd_cap_neon_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+    if (v & simsimd_cap_skylake_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32i8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32i8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f32i8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32i8_skylake, *c = simsimd_cap_skylake_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+    if (v & simsimd_cap_haswell_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f32i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32i8_haswell, *c = simsimd_cap_haswell_k; return;
+        default: break;
+        }
+#endif
+    if (v & simsimd_cap_serial_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f32i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32i8_serial, *c = simsimd_cap_serial_k; return;
+        default: break;
+        }
+}
+
+SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f32u8(simsimd_capability_t v, simsimd_metric_kind_t k,
+                                                        simsimd_metric_punned_t *m, simsimd_capability_t *c) {
+    typedef simsimd_metric_punned_t m_t;
+#if SIMSIMD_TARGET_NEON
+    if (v & simsimd_cap_neon_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32u8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32u8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f32u8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32u8_neon, *c = simsimd_cap_neon_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+    if (v & simsimd_cap_skylake_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32u8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32u8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f32u8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32u8_skylake, *c = simsimd_cap_skylake_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+    if (v & simsimd_cap_haswell_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f32u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32u8_haswell, *c = simsimd_cap_haswell_k; return;
+        default: break;
+        }
+#endif
+    if (v & simsimd_cap_serial_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f32u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32u8_serial, *c = simsimd_cap_serial_k; return;
+        default: break;
+        }
+}
+
+SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f32i4x2(simsimd_capability_t v, simsimd_metric_kind_t k,
+                                                          simsimd_metric_punned_t *m, simsimd_capability_t *c) {
+    typedef simsimd_metric_punned_t m_t;
+#if SIMSIMD_TARGET_NEON
+    if (v & simsimd_cap_neon_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32i4x2_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32i4x2_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f32i4x2_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32i4x2_neon, *c = simsimd_cap_neon_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+    if (v & simsimd_cap_skylake_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32i4x2_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32i4x2_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2sq_quantized_k:
+            *m = (m_t)&simsimd_l2sq_f32i4x2_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32i4x2_skylake, *c = simsimd_cap_skylake_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+    if (v & simsimd_cap_haswell_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32i4x2_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32i4x2_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2sq_quantized_k:
+            *m = (m_t)&simsimd_l2sq_f32i4x2_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32i4x2_haswell, *c = simsimd_cap_haswell_k; return;
+        default: break;
+        }
+#endif
+    if (v & simsimd_cap_serial_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f32i4x2_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f32i4x2_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f32i4x2_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f32i4x2_serial, *c = simsimd_cap_serial_k; return;
+        default: break;
+        }
+}
+
+SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f16i8(simsimd_capability_t v, simsimd_metric_kind_t k,
+                                                        simsimd_metric_punned_t *m, simsimd_capability_t *c) {
+    typedef simsimd_metric_punned_t m_t;
+#if SIMSIMD_TARGET_NEON_F16
+    if (v & simsimd_cap_neon_f16_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16i8_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16i8_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f16i8_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16i8_neon, *c = simsimd_cap_neon_f16_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+    if (v & simsimd_cap_skylake_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16i8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16i8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f16i8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16i8_skylake, *c = simsimd_cap_skylake_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+    if (v & simsimd_cap_haswell_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f16i8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16i8_haswell, *c = simsimd_cap_haswell_k; return;
+        default: break;
+        }
+#endif
+    if (v & simsimd_cap_serial_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f16i8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16i8_serial, *c = simsimd_cap_serial_k; return;
+        default: break;
+        }
+}
+
+SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f16u8(simsimd_capability_t v, simsimd_metric_kind_t k,
+                                                        simsimd_metric_punned_t *m, simsimd_capability_t *c) {
+    typedef simsimd_metric_punned_t m_t;
+#if SIMSIMD_TARGET_NEON_F16
+    if (v & simsimd_cap_neon_f16_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16u8_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16u8_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f16u8_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16u8_neon, *c = simsimd_cap_neon_f16_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+    if (v & simsimd_cap_skylake_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16u8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16u8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f16u8_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16u8_skylake, *c = simsimd_cap_skylake_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+    if (v & simsimd_cap_haswell_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f16u8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16u8_haswell, *c = simsimd_cap_haswell_k; return;
+        default: break;
+        }
+#endif
+    if (v & simsimd_cap_serial_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f16u8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16u8_serial, *c = simsimd_cap_serial_k; return;
+        default: break;
+        }
+}
+
+SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f16i4x2(simsimd_capability_t v, simsimd_metric_kind_t k,
+                                                          simsimd_metric_punned_t *m, simsimd_capability_t *c) {
+    typedef simsimd_metric_punned_t m_t;
+#if SIMSIMD_TARGET_NEON_F16
+    if (v & simsimd_cap_neon_f16_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16i4x2_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16i4x2_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f16i4x2_neon, *c = simsimd_cap_neon_f16_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16i4x2_neon, *c = simsimd_cap_neon_f16_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+    if (v & simsimd_cap_skylake_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16i4x2_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16i4x2_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_l2sq_quantized_k:
+            *m = (m_t)&simsimd_l2sq_f16i4x2_skylake, *c = simsimd_cap_skylake_k;
+            return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16i4x2_skylake, *c = simsimd_cap_skylake_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+    if (v & simsimd_cap_haswell_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16i4x2_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16i4x2_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_l2sq_quantized_k:
+            *m = (m_t)&simsimd_l2sq_f16i4x2_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16i4x2_haswell, *c = simsimd_cap_haswell_k; return;
+        default: break;
+        }
+#endif
+    if (v & simsimd_cap_serial_k) switch (k) {
+        case simsimd_metric_dot_quantized_k: *m = (m_t)&simsimd_dot_f16i4x2_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_quantized_k: *m = (m_t)&simsimd_cos_f16i4x2_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2sq_quantized_k: *m = (m_t)&simsimd_l2sq_f16i4x2_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_l2_quantized_k: *m = (m_t)&simsimd_l2_f16i4x2_serial, *c = simsimd_cap_serial_k; return;
+        default: break;
+        }
+}
+
+/**
+ *  @brief  Routes the combined datatypes of asymmetric metrics, like `simsimd_datatype_f32_k | simsimd_datatype_i8_k`,
+ *          which are not members of `simsimd_datatype_t` and can't be handled by its exhaustive `switch`.
+ */
+SIMSIMD_INTERNAL void _simsimd_find_metric_punned_quantized(simsimd_capability_t v, simsimd_metric_kind_t k,
+                                                            simsimd_datatype_t d, simsimd_metric_punned_t *m,
+                                                            simsimd_capability_t *c) {
+    if (d == (simsimd_datatype_f32_k | simsimd_datatype_i8_k)) _simsimd_find_metric_punned_f32i8(v, k, m, c);
+    else if (d == (simsimd_datatype_f32_k | simsimd_datatype_u8_k)) _simsimd_find_metric_punned_f32u8(v, k, m, c);
+    else if (d == (simsimd_datatype_f32_k | simsimd_datatype_i4x2_k)) _simsimd_find_metric_punned_f32i4x2(v, k, m, c);
+    else if (d == (simsimd_datatype_f16_k | simsimd_datatype_i8_k)) _simsimd_find_metric_punned_f16i8(v, k, m, c);
+    else if (d == (simsimd_datatype_f16_k | simsimd_datatype_u8_k)) _simsimd_find_metric_punned_f16u8(v, k, m, c);
+    else if (d == (simsimd_datatype_f16_k | simsimd_datatype_i4x2_k)) _simsimd_find_metric_punned_f16i4x2(v, k, m, c);
+}
+
+SIMSIMD_INTERNAL void _simsimd_find_metric_punned_u4x2(simsimd_capability_t v, simsimd_metric_kind_t k,
+                                                       simsimd_metric_punned_t *m, simsimd_capability_t *c) {
+    typedef simsimd_metric_punned_t m_t;
+#if SIMSIMD_TARGET_SVE
+    if (v & simsimd_cap_sve_k) switch (k) {
+        case simsimd_metric_pq_scan_k: *m = (m_t)&simsimd_pq_scan_u4x2_sve, *c = simsimd_cap_sve_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_NEON
+    if (v & simsimd_cap_neon_k) switch (k) {
+        case simsimd_metric_pq_scan_k: *m = (m_t)&simsimd_pq_scan_u4x2_neon, *c = simsimd_cap_neon_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+    if (v & simsimd_cap_skylake_k) switch (k) {
+        case simsimd_metric_pq_scan_k: *m = (m_t)&simsimd_pq_scan_u4x2_skylake, *c = simsimd_cap_skylake_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+    if (v & simsimd_cap_haswell_k) switch (k) {
+        case simsimd_metric_pq_scan_k: *m = (m_t)&simsimd_pq_scan_u4x2_haswell, *c = simsimd_cap_haswell_k; return;
+        default: break;
+        }
+#endif
+    if (v & simsimd_cap_serial_k) switch (k) {
+        case simsimd_metric_pq_scan_k: *m = (m_t)&simsimd_pq_scan_u4x2_serial, *c = simsimd_cap_serial_k; return;
+        default: break;
+        }
+}
+
+SIMSIMD_INTERNAL void _simsimd_find_metric_punned_b8(simsimd_capability_t v, simsimd_metric_kind_t k,
+                                                     simsimd_metric_punned_t *m, simsimd_capability_t *c) {
+    typedef simsimd_metric_punned_t m_t;
+#if SIMSIMD_TARGET_SVE
+    if (v & simsimd_cap_sve_k) switch (k) {
+        case simsimd_metric_hamming_k: *m = (m_t)&simsimd_hamming_b8_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_jaccard_k: *m = (m_t)&simsimd_jaccard_b8_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_hamming_batch_k: *m = (m_t)&simsimd_hamming_batch_b8_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_jaccard_batch_k: *m = (m_t)&simsimd_jaccard_batch_b8_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_hamming_cdist_k: *m = (m_t)&simsimd_hamming_cdist_b8_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_jaccard_cdist_k: *m = (m_t)&simsimd_jaccard_cdist_b8_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_hamming_radius_k: *m = (m_t)&simsimd_hamming_radius_b8_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_jaccard_radius_k: *m = (m_t)&simsimd_jaccard_radius_b8_sve, *c = simsimd_cap_sve_k; return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_NEON
+    if (v & simsimd_cap_neon_k) switch (k) {
+        case simsimd_metric_hamming_k: *m = (m_t)&simsimd_hamming_b8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_jaccard_k: *m = (m_t)&simsimd_jaccard_b8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_hamming_batch_k: *m = (m_t)&simsimd_hamming_batch_b8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_jaccard_batch_k: *m = (m_t)&simsimd_jaccard_batch_b8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_hamming_cdist_k: *m = (m_t)&simsimd_hamming_cdist_b8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_jaccard_cdist_k: *m = (m_t)&simsimd_jaccard_cdist_b8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_hamming_radius_k:
+            *m = (m_t)&simsimd_hamming_radius_b8_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_jaccard_radius_k:
+            *m = (m_t)&simsimd_jaccard_radius_b8_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_b8_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_levenshtein_batch_k:
+            *m = (m_t)&simsimd_levenshtein_batch_u8_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_needleman_wunsch_batch_k:
+            *m = (m_t)&simsimd_needleman_wunsch_batch_u8_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_smith_waterman_batch_k:
+            *m = (m_t)&simsimd_smith_waterman_batch_u8_neon, *c = simsimd_cap_neon_k;
+            return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_ICE
+    if (v & simsimd_cap_ice_k) switch (k) {
+        case simsimd_metric_hamming_k: *m = (m_t)&simsimd_hamming_b8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_jaccard_k: *m = (m_t)&simsimd_jaccard_b8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_hamming_batch_k: *m = (m_t)&simsimd_hamming_batch_b8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_jaccard_batch_k: *m = (m_t)&simsimd_jaccard_batch_b8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_hamming_cdist_k: *m = (m_t)&simsimd_hamming_cdist_b8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_jaccard_cdist_k: *m = (m_t)&simsimd_jaccard_cdist_b8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_hamming_radius_k: *m = (m_t)&simsimd_hamming_radius_b8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_jaccard_radius_k: *m = (m_t)&simsimd_jaccard_radius_b8_ice, *c = simsimd_cap_ice_k; return;
+        case simsimd_metric_levenshtein_batch_k:
+            *m = (m_t)&simsimd_levenshtein_batch_u8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_needleman_wunsch_batch_k:
+            *m = (m_t)&simsimd_needleman_wunsch_batch_u8_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_smith_waterman_batch_k:
+            *m = (m_t)&simsimd_smith_waterman_batch_u8_ice, *c = simsimd_cap_ice_k;
+            return;
+        default: break;
+        }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+    if (v & simsimd_cap_haswell_k) switch (k) {
+        case simsimd_metric_hamming_k: *m = (m_t)&simsimd_hamming_b8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_jaccard_k: *m = (m_t)&simsimd_jaccard_b8_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_hamming_batch_k:
+            *m = (m_t)&simsimd_hamming_batch_b8_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_jaccard_batch_k:
+            *m = (m_t)&simsimd_jaccard_batch_b8_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_hamming_cdist_k:
+            *m = (m_t)&simsimd_hamming_cdist_b8_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_jaccard_cdist_k:
+            *m = (m_t)&simsimd_jaccard_cdist_b8_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_hamming_radius_k:
+            *m = (m_t)&simsimd_hamming_radius_b8_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_jaccard_radius_k:
+            *m = (m_t)&simsimd_jaccard_radius_b8_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_b8_haswell, *c = simsimd_cap_haswell_k; return;
+        default: break;
+        }
+#endif
+    if (v & simsimd_cap_serial_k) switch (k) {
+        case simsimd_metric_hamming_k: *m = (m_t)&simsimd_hamming_b8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_jaccard_k: *m = (m_t)&simsimd_jaccard_b8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_hamming_batch_k:
+            *m = (m_t)&simsimd_hamming_batch_b8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_jaccard_batch_k:
+            *m = (m_t)&simsimd_jaccard_batch_b8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_hamming_cdist_k:
+            *m = (m_t)&simsimd_hamming_cdist_b8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_jaccard_cdist_k:
+            *m = (m_t)&simsimd_jaccard_cdist_b8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_hamming_radius_k:
+            *m = (m_t)&simsimd_hamming_radius_b8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_jaccard_radius_k:
+            *m = (m_t)&simsimd_jaccard_radius_b8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_quantize_k: *m = (m_t)&simsimd_quantize_b8_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_levenshtein_batch_k:
+            *m = (m_t)&simsimd_levenshtein_batch_u8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_needleman_wunsch_batch_k:
+            *m = (m_t)&simsimd_needleman_wunsch_batch_u8_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_smith_waterman_batch_k:
+            *m = (m_t)&simsimd_smith_waterman_batch_u8_serial, *c = simsimd_cap_serial_k;
+            return;
+        default: break;
+        }
+}
+
+SIMSIMD_INTERNAL void _simsimd_find_metric_punned_f64c(simsimd_capability_t v, simsimd_metric_kind_t k,
+                                                       simsimd_metric_punned_t *m, simsimd_capability_t *c) {
+    typedef simsimd_metric_punned_t m_t;
+#if SIMSIMD_TARGET_SVE
+    if (v & simsimd_cap_sve_k) switch (k) {
+        case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_f64c_sve, *c = simsimd_cap_sve_k; return;
+        case simsimd_metric_vdot_k: *m = (m_t)&simsimd_vdot_f64c_sve, *c = simsimd_cap_sve_k; return;
         default: break;
         }
 #endif
@@ -1092,12 +3329,21 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_u16(simsimd_capability_t v, si
         case simsimd_metric_intersect_k: *m = (m_t)&simsimd_intersect_u16_sve2, *c = simsimd_cap_sve2_k; return;
         case simsimd_metric_spdot_counts_k: *m = (m_t)&simsimd_spdot_counts_u16_sve2, *c = simsimd_cap_sve2_k; return;
         case simsimd_metric_spdot_weights_k: *m = (m_t)&simsimd_spdot_weights_u16_sve2, *c = simsimd_cap_sve2_k; return;
+        case simsimd_metric_intersect_batch_k:
+            *m = (m_t)&simsimd_intersect_batch_u16_sve2, *c = simsimd_cap_sve2_k;
+            return;
+        case simsimd_metric_spdot_weights_batch_k:
+            *m = (m_t)&simsimd_spdot_weights_batch_u16_sve2, *c = simsimd_cap_sve2_k;
+            return;
         default: break;
         }
 #endif
 #if SIMSIMD_TARGET_NEON
     if (v & simsimd_cap_neon_k) switch (k) {
         case simsimd_metric_intersect_k: *m = (m_t)&simsimd_intersect_u16_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_intersect_batch_k:
+            *m = (m_t)&simsimd_intersect_batch_u16_neon, *c = simsimd_cap_neon_k;
+            return;
         default: break;
         }
 #endif
@@ -1108,17 +3354,41 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_u16(simsimd_capability_t v, si
         case simsimd_metric_spdot_weights_k:
             *m = (m_t)&simsimd_spdot_weights_u16_turin, *c = simsimd_cap_turin_k;
             return;
+        case simsimd_metric_intersect_batch_k:
+            *m = (m_t)&simsimd_intersect_batch_u16_turin, *c = simsimd_cap_turin_k;
+            return;
+        case simsimd_metric_spdot_weights_batch_k:
+            *m = (m_t)&simsimd_spdot_weights_batch_u16_turin, *c = simsimd_cap_turin_k;
+            return;
         default: break;
         }
 #endif
 #if SIMSIMD_TARGET_ICE
     if (v & simsimd_cap_ice_k) switch (k) {
         case simsimd_metric_intersect_k: *m = (m_t)&simsimd_intersect_u16_ice, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_intersect_batch_k:
+            *m = (m_t)&simsimd_intersect_batch_u16_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_spdot_weights_batch_k:
+            *m = (m_t)&simsimd_spdot_weights_batch_u16_ice, *c = simsimd_cap_ice_k;
+            return;
         default: break;
         }
 #endif
     if (v & simsimd_cap_serial_k) switch (k) {
         case simsimd_metric_intersect_k: *m = (m_t)&simsimd_intersect_u16_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_spdot_counts_k:
+            *m = (m_t)&simsimd_spdot_counts_u16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_spdot_weights_k:
+            *m = (m_t)&simsimd_spdot_weights_u16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_intersect_batch_k:
+            *m = (m_t)&simsimd_intersect_batch_u16_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_spdot_weights_batch_k:
+            *m = (m_t)&simsimd_spdot_weights_batch_u16_serial, *c = simsimd_cap_serial_k;
+            return;
         default: break;
         }
 }
@@ -1129,29 +3399,74 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_u32(simsimd_capability_t v, si
 #if SIMSIMD_TARGET_SVE2
     if (v & simsimd_cap_sve2_k) switch (k) {
         case simsimd_metric_intersect_k: *m = (m_t)&simsimd_intersect_u32_sve2, *c = simsimd_cap_sve2_k; return;
+        case simsimd_metric_intersect_batch_k:
+            *m = (m_t)&simsimd_intersect_batch_u32_sve2, *c = simsimd_cap_sve2_k;
+            return;
+        case simsimd_metric_spdot_weights_k:
+            *m = (m_t)&simsimd_spdot_weights_u32_sve2, *c = simsimd_cap_sve2_k;
+            return;
+        case simsimd_metric_spdot_weights_f32_k:
+            *m = (m_t)&simsimd_spdot_weights_f32_u32_sve2, *c = simsimd_cap_sve2_k;
+            return;
         default: break;
         }
 #endif
 #if SIMSIMD_TARGET_NEON
     if (v & simsimd_cap_neon_k) switch (k) {
         case simsimd_metric_intersect_k: *m = (m_t)&simsimd_intersect_u32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_intersect_batch_k:
+            *m = (m_t)&simsimd_intersect_batch_u32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_spdot_weights_k:
+            *m = (m_t)&simsimd_spdot_weights_u32_neon, *c = simsimd_cap_neon_k;
+            return;
+        case simsimd_metric_spdot_weights_f32_k:
+            *m = (m_t)&simsimd_spdot_weights_f32_u32_neon, *c = simsimd_cap_neon_k;
+            return;
         default: break;
         }
 #endif
 #if SIMSIMD_TARGET_TURIN
     if (v & simsimd_cap_turin_k) switch (k) {
         case simsimd_metric_intersect_k: *m = (m_t)&simsimd_intersect_u32_turin, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_intersect_batch_k:
+            *m = (m_t)&simsimd_intersect_batch_u32_turin, *c = simsimd_cap_turin_k;
+            return;
+        case simsimd_metric_spdot_weights_k:
+            *m = (m_t)&simsimd_spdot_weights_u32_turin, *c = simsimd_cap_turin_k;
+            return;
+        case simsimd_metric_spdot_weights_f32_k:
+            *m = (m_t)&simsimd_spdot_weights_f32_u32_turin, *c = simsimd_cap_turin_k;
+            return;
         default: break;
         }
 #endif
 #if SIMSIMD_TARGET_ICE
     if (v & simsimd_cap_ice_k) switch (k) {
         case simsimd_metric_intersect_k: *m = (m_t)&simsimd_intersect_u32_ice, *c = simsimd_cap_skylake_k; return;
-        default: break;
+        case simsimd_metric_intersect_batch_k:
+            *m = (m_t)&simsimd_intersect_batch_u32_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_spdot_weights_k:
+            *m = (m_t)&simsimd_spdot_weights_u32_ice, *c = simsimd_cap_ice_k;
+            return;
+        case simsimd_metric_spdot_weights_f32_k:
+            *m = (m_t)&simsimd_spdot_weights_f32_u32_ice, *c = simsimd_cap_ice_k;
+            return;
+        default: break;
         }
 #endif
     if (v & simsimd_cap_serial_k) switch (k) {
         case simsimd_metric_intersect_k: *m = (m_t)&simsimd_intersect_u32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_intersect_batch_k:
+            *m = (m_t)&simsimd_intersect_batch_u32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_spdot_weights_k:
+            *m = (m_t)&simsimd_spdot_weights_u32_serial, *c = simsimd_cap_serial_k;
+            return;
+        case simsimd_metric_spdot_weights_f32_k:
+            *m = (m_t)&simsimd_spdot_weights_f32_u32_serial, *c = simsimd_cap_serial_k;
+            return;
         default: break;
         }
 }
@@ -1203,15 +3518,18 @@ SIMSIMD_INTERNAL void _simsimd_find_metric_punned_implementation( //
     case simsimd_datatype_bf16c_k: _simsimd_find_metric_punned_bf16c(viable, kind, m, c); return;
     case simsimd_datatype_u16_k: _simsimd_find_metric_punned_u16(viable, kind, m, c); return;
     case simsimd_datatype_u32_k: _simsimd_find_metric_punned_u32(viable, kind, m, c); return;
+    case simsimd_datatype_i4x2_k: _simsimd_find_metric_punned_i4x2(viable, kind, m, c); return;
+    case simsimd_datatype_u4x2_k: _simsimd_find_metric_punned_u4x2(viable, kind, m, c); return;
 
     // These data-types are not supported yet
-    case simsimd_datatype_i4x2_k: break;
     case simsimd_datatype_i16_k: break;
     case simsimd_datatype_i32_k: break;
     case simsimd_datatype_i64_k: break;
     case simsimd_datatype_u64_k: break;
     case simsimd_datatype_unknown_k: break;
-    default: break;
+
+    // Combined datatypes of asymmetric metrics
+    default: _simsimd_find_metric_punned_quantized(viable, kind, datatype, m, c); return;
     }
 
     // Replace with zeros if no suitable implementation was found
@@ -1252,6 +3570,534 @@ SIMSIMD_PUBLIC simsimd_metric_punned_t simsimd_metric_punned( //
     return result;
 }
 
+/**
+ *  @brief  Number of candidates scored at once by `simsimd_topk_scan`, before being offered to the heap.
+ *          The scores are kept in a stack buffer, so the default of 64 distances occupies just 512 bytes.
+ */
+#if !defined(SIMSIMD_TOPK_CHUNK)
+#define SIMSIMD_TOPK_CHUNK 64
+#endif
+
+/*  Fused top-k search
+ *  - Keeps the `k` best candidates in a binary max-heap of `ids` and `distances`, with the worst one at the root.
+ *  - Similarity metrics, like inner products, are negated on entry, so the same heap keeps the largest of them.
+ *  - Heaps of disjoint candidate slices can be combined with `simsimd_topk_merge` before `simsimd_topk_sort`.
+ */
+
+SIMSIMD_INTERNAL void _simsimd_topk_sift_down(simsimd_size_t count, simsimd_size_t *ids, simsimd_distance_t *distances,
+                                              simsimd_size_t id, simsimd_distance_t distance) {
+    simsimd_size_t i = 0;
+    for (;;) {
+        simsimd_size_t child = 2 * i + 1;
+        if (child >= count) break;
+        if (child + 1 < count && distances[child + 1] > distances[child]) ++child;
+        if (distances[child] <= distance) break;
+        distances[i] = distances[child], ids[i] = ids[child], i = child;
+    }
+    distances[i] = distance, ids[i] = id;
+}
+
+/**
+ *  @brief  Offers a candidate to a max-heap of at most `k` entries, evicting the worst one if the heap is full.
+ *          NaN distances are ignored, so the heap may end up holding fewer than `k` entries.
+ *
+ *  @param k The maximum number of entries to keep.
+ *  @param count The number of entries currently in the heap, updated in-place.
+ *  @param ids The identifiers of the kept candidates, at least `k` entries.
+ *  @param distances The distances of the kept candidates, at least `k` entries.
+ *  @param id The identifier of the new candidate.
+ *  @param distance The distance of the new candidate, already negated for similarity metrics.
+ */
+SIMSIMD_PUBLIC void simsimd_topk_push(simsimd_size_t k, simsimd_size_t *count, simsimd_size_t *ids,
+                                      simsimd_distance_t *distances, simsimd_size_t id, simsimd_distance_t distance) {
+    if (distance != distance) return;
+    if (*count == k) {
+        if (!k || distance >= distances[0]) return;
+        _simsimd_topk_sift_down(k, ids, distances, id, distance);
+        return;
+    }
+    simsimd_size_t i = (*count)++;
+    while (i) {
+        simsimd_size_t parent = (i - 1) / 2;
+        if (distances[parent] >= distance) break;
+        distances[i] = distances[parent], ids[i] = ids[parent], i = parent;
+    }
+    distances[i] = distance, ids[i] = id;
+}
+
+/**
+ *  @brief  Merges the `other` heap into the first one, keeping the `k` best entries of both.
+ *          Both heaps must come from `simsimd_topk_push` or `simsimd_topk_scan` and must not be sorted yet.
+ */
+SIMSIMD_PUBLIC void simsimd_topk_merge(simsimd_size_t k, simsimd_size_t *count, simsimd_size_t *ids,
+                                       simsimd_distance_t *distances, simsimd_size_t other_count,
+                                       simsimd_size_t const *other_ids, simsimd_distance_t const *other_distances) {
+    for (simsimd_size_t i = 0; i != other_count; ++i)
+        simsimd_topk_push(k, count, ids, distances, other_ids[i], other_distances[i]);
+}
+
+/**
+ *  @brief  Heap-sorts the entries from the best to the worst, restoring the sign of similarity scores.
+ *          After this call the arrays are no longer a valid heap.
+ *
+ *  @param count The number of entries in the heap.
+ *  @param ids The identifiers of the kept candidates.
+ *  @param distances The distances of the kept candidates.
+ *  @param largest Non-zero if the heap was populated with negated similarities via `simsimd_topk_scan`.
+ */
+SIMSIMD_PUBLIC void simsimd_topk_sort(simsimd_size_t count, simsimd_size_t *ids, simsimd_distance_t *distances,
+                                      int largest) {
+    for (simsimd_size_t last = count; last > 1;) {
+        --last;
+        simsimd_size_t id = ids[last];
+        simsimd_distance_t distance = distances[last];
+        ids[last] = ids[0], distances[last] = distances[0];
+        _simsimd_topk_sift_down(last, ids, distances, id, distance);
+    }
+    if (largest)
+        for (simsimd_size_t i = 0; i != count; ++i) distances[i] = -distances[i];
+}
+
+/**
+ *  @brief  Scores `b_count` candidates against one query and offers them to the heap, never materializing
+ *          more than `SIMSIMD_TOPK_CHUNK` distances at a time. Prefers the one-to-many `batch` kernel, if provided,
+ *          falling back to the pairwise `metric` otherwise.
+ *
+ *  @param metric The pairwise kernel, used when `batch` is NULL.
+ *  @param batch The optional one-to-many kernel of the same metric.
+ *  @param largest Non-zero to keep the largest scores, like for inner products, rather than the smallest.
+ *  @param a The query vector.
+ *  @param b The first candidate vector.
+ *  @param b_count The number of candidates.
+ *  @param b_stride The stride between candidates in bytes.
+ *  @param n The number of dimensions, as passed to `metric`.
+ *  @param first_id The identifier of the first candidate, useful when scanning a slice of a larger collection.
+ *  @param k The maximum number of entries to keep.
+ *  @param count The number of entries currently in the heap, updated in-place.
+ *  @param ids The identifiers of the kept candidates, at least `k` entries.
+ *  @param distances The distances of the kept candidates, at least `k` entries.
+ */
+SIMSIMD_PUBLIC void simsimd_topk_scan(                                                          //
+    simsimd_metric_punned_t metric, simsimd_metric_batch_punned_t batch, int largest,           //
+    void const *a, void const *b, simsimd_size_t b_count, simsimd_size_t b_stride,              //
+    simsimd_size_t n, simsimd_size_t first_id,                                                  //
+    simsimd_size_t k, simsimd_size_t *count, simsimd_size_t *ids, simsimd_distance_t *distances) {
+
+    // Complex kernels output two components, so we reserve space for the imaginary part of the last one.
+    simsimd_distance_t scores[SIMSIMD_TOPK_CHUNK + 1];
+    simsimd_distance_t const sign = largest ? -1 : 1;
+    for (simsimd_size_t i = 0; i < b_count; i += SIMSIMD_TOPK_CHUNK) {
+        simsimd_size_t const chunk = b_count - i < SIMSIMD_TOPK_CHUNK ? b_count - i : SIMSIMD_TOPK_CHUNK;
+        simsimd_u8_t const *chunk_start = (simsimd_u8_t const *)b + i * b_stride;
+        if (batch) batch(a, chunk_start, chunk, b_stride, n, scores);
+        else
+            for (simsimd_size_t j = 0; j != chunk; ++j) metric(a, chunk_start + j * b_stride, n, scores + j);
+        // Most candidates lose to the root of a full heap, so we filter them before the function call.
+        for (simsimd_size_t j = 0; j != chunk; ++j) {
+            simsimd_distance_t const distance = sign * scores[j];
+            if (*count == k && !(distance < distances[0])) continue;
+            simsimd_topk_push(k, count, ids, distances, first_id + i + j, distance);
+        }
+    }
+}
+
+/**
+ *  @brief  Maps a pairwise metric kind to the one-to-many kind with the same semantics, if there is one.
+ *  @return The batch metric kind or `simsimd_metric_unknown_k`.
+ */
+SIMSIMD_PUBLIC simsimd_metric_kind_t simsimd_metric_batch_kind(simsimd_metric_kind_t kind) {
+    switch (kind) {
+    case simsimd_metric_dot_k: return simsimd_metric_dot_batch_k;
+    case simsimd_metric_cos_k: return simsimd_metric_cos_batch_k;
+    case simsimd_metric_l2sq_k: return simsimd_metric_l2sq_batch_k;
+    case simsimd_metric_l2_k: return simsimd_metric_l2_batch_k;
+    case simsimd_metric_hamming_k: return simsimd_metric_hamming_batch_k;
+    case simsimd_metric_jaccard_k: return simsimd_metric_jaccard_batch_k;
+    case simsimd_metric_rmsd_k: return simsimd_metric_rmsd_batch_k;
+    case simsimd_metric_kabsch_k: return simsimd_metric_kabsch_batch_k;
+    default: return simsimd_metric_unknown_k;
+    }
+}
+
+/**
+ *  @brief  Maps a pairwise metric kind to the many-to-many kind with the same semantics, if there is one.
+ *  @return The cdist metric kind or `simsimd_metric_unknown_k`.
+ */
+SIMSIMD_PUBLIC simsimd_metric_kind_t simsimd_metric_cdist_kind(simsimd_metric_kind_t kind) {
+    switch (kind) {
+    case simsimd_metric_dot_k: return simsimd_metric_dot_cdist_k;
+    case simsimd_metric_cos_k: return simsimd_metric_cos_cdist_k;
+    case simsimd_metric_l2sq_k: return simsimd_metric_l2sq_cdist_k;
+    case simsimd_metric_l2_k: return simsimd_metric_l2_cdist_k;
+    case simsimd_metric_hamming_k: return simsimd_metric_hamming_cdist_k;
+    case simsimd_metric_jaccard_k: return simsimd_metric_jaccard_cdist_k;
+    default: return simsimd_metric_unknown_k;
+    }
+}
+
+/**
+ *  @brief  Finds the `k` nearest of `b_count` candidates to the query `a` under any pairwise metric,
+ *          returning them sorted from the best to the worst. Inner products keep the largest scores,
+ *          all other metrics keep the smallest. For complex inputs only the real part is ranked.
+ *
+ *  @param kind The kind of metric to be evaluated.
+ *  @param datatype The data type of the vectors.
+ *  @param a The query vector.
+ *  @param b The first candidate vector.
+ *  @param b_count The number of candidates.
+ *  @param b_stride The stride between candidates in bytes.
+ *  @param n The number of dimensions, as passed to the pairwise kernel.
+ *  @param k The maximum number of entries to return.
+ *  @param ids The output identifiers, at least `k` entries.
+ *  @param distances The output distances, at least `k` entries.
+ *  @return The number of entries found, which is less than `k` if there are fewer valid candidates,
+ *          or zero if the metric isn't supported for the given datatype.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_topk(                                                        //
+    simsimd_metric_kind_t kind, simsimd_datatype_t datatype,                                       //
+    void const *a, void const *b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, //
+    simsimd_size_t k, simsimd_size_t *ids, simsimd_distance_t *distances) {
+
+    simsimd_capability_t const supported = simsimd_capabilities();
+    simsimd_capability_t c = simsimd_cap_serial_k;
+    simsimd_metric_punned_t metric = 0, batch = 0;
+    simsimd_find_metric_punned(kind, datatype, supported, simsimd_cap_any_k, &metric, &c);
+    if (!metric) return 0;
+    simsimd_metric_kind_t const batch_kind = simsimd_metric_batch_kind(kind);
+    if (batch_kind != simsimd_metric_unknown_k)
+        simsimd_find_metric_punned(batch_kind, datatype, supported, simsimd_cap_any_k, &batch, &c);
+
+    int const largest = kind == simsimd_metric_dot_k || kind == simsimd_metric_vdot_k;
+    simsimd_size_t count = 0;
+    simsimd_topk_scan(metric, (simsimd_metric_batch_punned_t)batch, largest, a, b, b_count, b_stride, n, 0, k, &count,
+                      ids, distances);
+    simsimd_topk_sort(count, ids, distances, largest);
+    return count;
+}
+
+/**
+ *  @brief  Builds the ADC table of a single query for Product Quantization, evaluating the distances between
+ *          every query sub-vector and every centroid of the same subspace with any dense pairwise kernel,
+ *          like `simsimd_l2sq_f32` or `simsimd_dot_f32`. The table can be quantized for the fast-scan kernels
+ *          with `simsimd_pq_quantize_table`.
+ *
+ *  @param metric The dense pairwise kernel for the `input_type` scalars.
+ *  @param query The query vector of `subspaces * subspace_dims` scalars.
+ *  @param centroids The codebooks of `subspaces * centroids_count` centroids, `subspace_dims` scalars each.
+ *  @param subspaces The number of subspaces.
+ *  @param centroids_count The number of centroids per subspace, 16 for `u4x2` codes and 256 for `u8` codes.
+ *  @param subspace_dims The number of dimensions in every subspace.
+ *  @param table The output table of `subspaces * centroids_count` entries.
+ */
+#define SIMSIMD_MAKE_PQ_TABLE(input_type)                                                                         \
+    SIMSIMD_PUBLIC void simsimd_pq_table_##input_type(                                                            \
+        simsimd_metric_punned_t metric, simsimd_##input_type##_t const *query,                                    \
+        simsimd_##input_type##_t const *centroids, simsimd_size_t subspaces, simsimd_size_t centroids_count,      \
+        simsimd_size_t subspace_dims, simsimd_f32_t *table) {                                                     \
+        simsimd_distance_t distance;                                                                              \
+        for (simsimd_size_t j = 0; j != subspaces; ++j)                                                           \
+            for (simsimd_size_t c = 0; c != centroids_count; ++c) {                                               \
+                metric(query + j * subspace_dims, centroids + (j * centroids_count + c) * subspace_dims,          \
+                       subspace_dims, &distance);                                                                 \
+                table[j * centroids_count + c] = (simsimd_f32_t)distance;                                         \
+            }                                                                                                     \
+    }
+
+SIMSIMD_MAKE_PQ_TABLE(f32) // simsimd_pq_table_f32
+SIMSIMD_MAKE_PQ_TABLE(f16) // simsimd_pq_table_f16
+
+/**
+ *  @brief  Number of candidates scored by a single task of `simsimd_batch_parallel`.
+ */
+#if !defined(SIMSIMD_PARALLEL_BATCH_ROWS)
+#define SIMSIMD_PARALLEL_BATCH_ROWS 256
+#endif
+
+/**
+ *  @brief  Number of columns of the output matrix computed by a single task of `simsimd_cdist_parallel`,
+ *          with the number of rows matching the `SIMSIMD_CDIST_MC` block of the packed kernels.
+ */
+#if !defined(SIMSIMD_PARALLEL_CDIST_COLUMNS)
+#define SIMSIMD_PARALLEL_CDIST_COLUMNS 256
+#endif
+
+/**
+ *  @brief  Number of rows and columns in a square tile of the distance matrix computed by a single task
+ *          of `simsimd_pdist_parallel`. The tile is computed on the stack, so it must stay small.
+ */
+#if !defined(SIMSIMD_PARALLEL_PDIST_TILE)
+#define SIMSIMD_PARALLEL_PDIST_TILE 64
+#endif
+
+/**
+ *  @brief  Smallest number of scalar multiply-accumulate steps worth splitting across threads.
+ *          Below it the cost of waking up the workers outweighs the parallel speedup.
+ */
+#if !defined(SIMSIMD_PARALLEL_MIN_WORK)
+#define SIMSIMD_PARALLEL_MIN_WORK (1ull << 20)
+#endif
+
+typedef struct {
+    simsimd_metric_batch_punned_t metric;
+    simsimd_metric_batch_normed_punned_t normed_metric;
+    simsimd_u8_t const *a, *b;
+    simsimd_size_t b_count, b_stride, n;
+    simsimd_distance_t const *a_norm, *b_norms;
+    simsimd_distance_t *d;
+} _simsimd_batch_tasks_t;
+
+SIMSIMD_INTERNAL void _simsimd_batch_task(void *context, simsimd_size_t task) {
+    _simsimd_batch_tasks_t const *tasks = (_simsimd_batch_tasks_t const *)context;
+    simsimd_size_t const first = task * SIMSIMD_PARALLEL_BATCH_ROWS;
+    simsimd_size_t const rows =
+        tasks->b_count - first < SIMSIMD_PARALLEL_BATCH_ROWS ? tasks->b_count - first : SIMSIMD_PARALLEL_BATCH_ROWS;
+    if (tasks->normed_metric)
+        tasks->normed_metric(tasks->a, tasks->b + first * tasks->b_stride, rows, tasks->b_stride, tasks->n,
+                             tasks->a_norm, tasks->b_norms ? tasks->b_norms + first : 0, tasks->d + first);
+    else
+        tasks->metric(tasks->a, tasks->b + first * tasks->b_stride, rows, tasks->b_stride, tasks->n,
+                      tasks->d + first);
+}
+
+typedef struct {
+    simsimd_metric_cdist_punned_t metric;
+    simsimd_metric_cdist_typed_punned_t typed_metric;
+    simsimd_metric_cdist_normed_punned_t normed_metric;
+    simsimd_u8_t const *a, *b;
+    simsimd_size_t a_count, a_stride, b_count, b_stride, n;
+    simsimd_distance_t const *a_norms, *b_norms;
+    simsimd_u8_t *d;
+    simsimd_size_t d_stride, column_tiles;
+    simsimd_datatype_t d_type;
+    simsimd_size_t d_scalar_size;
+} _simsimd_cdist_tasks_t;
+
+SIMSIMD_INTERNAL void _simsimd_cdist_task(void *context, simsimd_size_t task) {
+    _simsimd_cdist_tasks_t const *tasks = (_simsimd_cdist_tasks_t const *)context;
+    simsimd_size_t const i = (task / tasks->column_tiles) * SIMSIMD_CDIST_MC;
+    simsimd_size_t const j = (task % tasks->column_tiles) * SIMSIMD_PARALLEL_CDIST_COLUMNS;
+    simsimd_size_t const rows = tasks->a_count - i < SIMSIMD_CDIST_MC ? tasks->a_count - i : SIMSIMD_CDIST_MC;
+    simsimd_size_t const columns = tasks->b_count - j < SIMSIMD_PARALLEL_CDIST_COLUMNS ? tasks->b_count - j
+                                                                                      : SIMSIMD_PARALLEL_CDIST_COLUMNS;
+    simsimd_u8_t *const d = tasks->d + i * tasks->d_stride + j * tasks->d_scalar_size;
+    if (tasks->normed_metric)
+        tasks->normed_metric(tasks->a + i * tasks->a_stride, tasks->b + j * tasks->b_stride, rows, tasks->a_stride,
+                             columns, tasks->b_stride, tasks->n, tasks->a_norms ? tasks->a_norms + i : 0,
+                             tasks->b_norms ? tasks->b_norms + j : 0, d, tasks->d_stride, tasks->d_type);
+    else if (tasks->typed_metric)
+        tasks->typed_metric(tasks->a + i * tasks->a_stride, tasks->b + j * tasks->b_stride, rows, tasks->a_stride,
+                            columns, tasks->b_stride, tasks->n, d, tasks->d_stride, tasks->d_type);
+    else
+        tasks->metric(tasks->a + i * tasks->a_stride, tasks->b + j * tasks->b_stride, rows, tasks->a_stride, columns,
+                      tasks->b_stride, tasks->n, (simsimd_distance_t *)d, tasks->d_stride);
+}
+
+/**
+ *  @brief  Splits a one-to-many comparison into tasks of `SIMSIMD_PARALLEL_BATCH_ROWS` candidates,
+ *          submitting them to the `executor`. Small inputs and missing executors fall back to a direct call.
+ *          Arguments match `simsimd_metric_batch_punned_t`.
+ */
+SIMSIMD_PUBLIC void simsimd_batch_parallel(                                           //
+    simsimd_metric_batch_punned_t metric, simsimd_executor_punned_t executor, void *executor_state, //
+    void const *a, void const *b, simsimd_size_t b_count, simsimd_size_t b_stride,   //
+    simsimd_size_t n, simsimd_distance_t *d) {
+
+    simsimd_size_t const count_tasks = (b_count + SIMSIMD_PARALLEL_BATCH_ROWS - 1) / SIMSIMD_PARALLEL_BATCH_ROWS;
+    if (!executor || count_tasks < 2 || b_count * n < SIMSIMD_PARALLEL_MIN_WORK) {
+        metric(a, b, b_count, b_stride, n, d);
+        return;
+    }
+    _simsimd_batch_tasks_t tasks;
+    tasks.metric = metric, tasks.normed_metric = 0;
+    tasks.a = (simsimd_u8_t const *)a, tasks.b = (simsimd_u8_t const *)b;
+    tasks.b_count = b_count, tasks.b_stride = b_stride, tasks.n = n, tasks.d = d;
+    tasks.a_norm = 0, tasks.b_norms = 0;
+    executor(executor_state, &_simsimd_batch_task, &tasks, count_tasks);
+}
+
+/**
+ *  @brief  Splits a one-to-many comparison with cached norms into the same tasks as `simsimd_batch_parallel`,
+ *          slicing the `b_norms` along with the candidates. Arguments match `simsimd_metric_batch_normed_punned_t`.
+ */
+SIMSIMD_PUBLIC void simsimd_batch_normed_parallel(                                                         //
+    simsimd_metric_batch_normed_punned_t metric, simsimd_executor_punned_t executor, void *executor_state, //
+    void const *a, void const *b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,       //
+    simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms, simsimd_distance_t *d) {
+
+    simsimd_size_t const count_tasks = (b_count + SIMSIMD_PARALLEL_BATCH_ROWS - 1) / SIMSIMD_PARALLEL_BATCH_ROWS;
+    if (!executor || count_tasks < 2 || b_count * n < SIMSIMD_PARALLEL_MIN_WORK) {
+        metric(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+        return;
+    }
+    _simsimd_batch_tasks_t tasks;
+    tasks.metric = 0, tasks.normed_metric = metric;
+    tasks.a = (simsimd_u8_t const *)a, tasks.b = (simsimd_u8_t const *)b;
+    tasks.b_count = b_count, tasks.b_stride = b_stride, tasks.n = n, tasks.d = d;
+    tasks.a_norm = a_norm, tasks.b_norms = b_norms;
+    executor(executor_state, &_simsimd_batch_task, &tasks, count_tasks);
+}
+
+/**
+ *  @brief  Splits a many-to-many comparison into output tiles of `SIMSIMD_CDIST_MC` rows and
+ *          `SIMSIMD_PARALLEL_CDIST_COLUMNS` columns, submitting them to the `executor`.
+ *          Small inputs and missing executors fall back to a direct call.
+ *          Arguments match `simsimd_metric_cdist_punned_t`.
+ */
+SIMSIMD_PUBLIC void simsimd_cdist_parallel(                                                         //
+    simsimd_metric_cdist_punned_t metric, simsimd_executor_punned_t executor, void *executor_state, //
+    void const *a, void const *b, simsimd_size_t a_count, simsimd_size_t a_stride,                  //
+    simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,                              //
+    simsimd_distance_t *d, simsimd_size_t d_stride) {
+
+    simsimd_size_t const row_tiles = (a_count + SIMSIMD_CDIST_MC - 1) / SIMSIMD_CDIST_MC;
+    simsimd_size_t const column_tiles = (b_count + SIMSIMD_PARALLEL_CDIST_COLUMNS - 1) / SIMSIMD_PARALLEL_CDIST_COLUMNS;
+    if (!executor || row_tiles * column_tiles < 2 || a_count * b_count * n < SIMSIMD_PARALLEL_MIN_WORK) {
+        metric(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+        return;
+    }
+    _simsimd_cdist_tasks_t tasks;
+    tasks.metric = metric, tasks.typed_metric = 0, tasks.normed_metric = 0;
+    tasks.a_norms = 0, tasks.b_norms = 0;
+    tasks.a = (simsimd_u8_t const *)a, tasks.b = (simsimd_u8_t const *)b;
+    tasks.a_count = a_count, tasks.a_stride = a_stride, tasks.b_count = b_count, tasks.b_stride = b_stride;
+    tasks.n = n, tasks.d = (simsimd_u8_t *)d, tasks.d_stride = d_stride, tasks.column_tiles = column_tiles;
+    tasks.d_type = simsimd_datatype_f64_k, tasks.d_scalar_size = sizeof(simsimd_distance_t);
+    executor(executor_state, &_simsimd_cdist_task, &tasks, row_tiles * column_tiles);
+}
+
+/**
+ *  @brief  Splits a many-to-many comparison with a custom output precision into the same tiles as
+ *          `simsimd_cdist_parallel`, submitting them to the `executor`.
+ *          Arguments match `simsimd_metric_cdist_typed_punned_t`.
+ */
+SIMSIMD_PUBLIC void simsimd_cdist_typed_parallel(                                                         //
+    simsimd_metric_cdist_typed_punned_t metric, simsimd_executor_punned_t executor, void *executor_state, //
+    void const *a, void const *b, simsimd_size_t a_count, simsimd_size_t a_stride,                        //
+    simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,                                    //
+    void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+
+    simsimd_size_t const row_tiles = (a_count + SIMSIMD_CDIST_MC - 1) / SIMSIMD_CDIST_MC;
+    simsimd_size_t const column_tiles = (b_count + SIMSIMD_PARALLEL_CDIST_COLUMNS - 1) / SIMSIMD_PARALLEL_CDIST_COLUMNS;
+    if (!executor || row_tiles * column_tiles < 2 || a_count * b_count * n < SIMSIMD_PARALLEL_MIN_WORK) {
+        metric(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+        return;
+    }
+    _simsimd_cdist_tasks_t tasks;
+    tasks.metric = 0, tasks.typed_metric = metric, tasks.normed_metric = 0;
+    tasks.a_norms = 0, tasks.b_norms = 0;
+    tasks.a = (simsimd_u8_t const *)a, tasks.b = (simsimd_u8_t const *)b;
+    tasks.a_count = a_count, tasks.a_stride = a_stride, tasks.b_count = b_count, tasks.b_stride = b_stride;
+    tasks.n = n, tasks.d = (simsimd_u8_t *)d, tasks.d_stride = d_stride, tasks.column_tiles = column_tiles;
+    tasks.d_type = d_type, tasks.d_scalar_size = d_type == simsimd_datatype_f64_k   ? 8
+                                                 : d_type == simsimd_datatype_f32_k ? 4
+                                                                                    : 2;
+    executor(executor_state, &_simsimd_cdist_task, &tasks, row_tiles * column_tiles);
+}
+
+/**
+ *  @brief  Splits a many-to-many comparison with cached norms into the same tiles as `simsimd_cdist_parallel`,
+ *          slicing the `a_norms` and `b_norms` along with the rows. Arguments match
+ *          `simsimd_metric_cdist_normed_punned_t`.
+ */
+SIMSIMD_PUBLIC void simsimd_cdist_normed_parallel(                                                         //
+    simsimd_metric_cdist_normed_punned_t metric, simsimd_executor_punned_t executor, void *executor_state, //
+    void const *a, void const *b, simsimd_size_t a_count, simsimd_size_t a_stride,                         //
+    simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,                                     //
+    simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,                                  //
+    void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+
+    simsimd_size_t const row_tiles = (a_count + SIMSIMD_CDIST_MC - 1) / SIMSIMD_CDIST_MC;
+    simsimd_size_t const column_tiles = (b_count + SIMSIMD_PARALLEL_CDIST_COLUMNS - 1) / SIMSIMD_PARALLEL_CDIST_COLUMNS;
+    if (!executor || row_tiles * column_tiles < 2 || a_count * b_count * n < SIMSIMD_PARALLEL_MIN_WORK) {
+        metric(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride, d_type);
+        return;
+    }
+    _simsimd_cdist_tasks_t tasks;
+    tasks.metric = 0, tasks.typed_metric = 0, tasks.normed_metric = metric;
+    tasks.a_norms = a_norms, tasks.b_norms = b_norms;
+    tasks.a = (simsimd_u8_t const *)a, tasks.b = (simsimd_u8_t const *)b;
+    tasks.a_count = a_count, tasks.a_stride = a_stride, tasks.b_count = b_count, tasks.b_stride = b_stride;
+    tasks.n = n, tasks.d = (simsimd_u8_t *)d, tasks.d_stride = d_stride, tasks.column_tiles = column_tiles;
+    tasks.d_type = d_type, tasks.d_scalar_size = d_type == simsimd_datatype_f64_k   ? 8
+                                                 : d_type == simsimd_datatype_f32_k ? 4
+                                                                                    : 2;
+    executor(executor_state, &_simsimd_cdist_task, &tasks, row_tiles * column_tiles);
+}
+
+/**
+ *  @brief  Position of the distance between rows `i < j` of a `count`-row matrix in the condensed upper
+ *          triangle, matching the layout of `scipy.spatial.distance.pdist`.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_pdist_offset(simsimd_size_t count, simsimd_size_t i, simsimd_size_t j) {
+    return i * (2 * count - i - 1) / 2 + (j - i - 1);
+}
+
+typedef struct {
+    simsimd_metric_cdist_punned_t metric;
+    simsimd_u8_t const *a;
+    simsimd_size_t count, stride, n, tiles;
+    simsimd_u8_t *d;
+    simsimd_datatype_t d_type;
+    simsimd_size_t d_scalar_size;
+} _simsimd_pdist_tasks_t;
+
+/**
+ *  Every task computes one square tile on or above the diagonal, enumerated row by row. All tiles but the
+ *  last ones cost the same, as the diagonal tiles are computed in full and only their upper parts exported,
+ *  so any executor splitting the tasks evenly also splits the work evenly.
+ */
+SIMSIMD_INTERNAL void _simsimd_pdist_task(void *context, simsimd_size_t task) {
+    _simsimd_pdist_tasks_t const *tasks = (_simsimd_pdist_tasks_t const *)context;
+    simsimd_distance_t block[SIMSIMD_PARALLEL_PDIST_TILE * SIMSIMD_PARALLEL_PDIST_TILE];
+    simsimd_size_t tile_i = 0, tile_j;
+    while (task >= tasks->tiles - tile_i) task -= tasks->tiles - tile_i, ++tile_i;
+    tile_j = tile_i + task;
+
+    simsimd_size_t const i0 = tile_i * SIMSIMD_PARALLEL_PDIST_TILE, j0 = tile_j * SIMSIMD_PARALLEL_PDIST_TILE;
+    simsimd_size_t const rows = tasks->count - i0 < SIMSIMD_PARALLEL_PDIST_TILE ? tasks->count - i0
+                                                                                : SIMSIMD_PARALLEL_PDIST_TILE;
+    simsimd_size_t const columns = tasks->count - j0 < SIMSIMD_PARALLEL_PDIST_TILE ? tasks->count - j0
+                                                                                   : SIMSIMD_PARALLEL_PDIST_TILE;
+    tasks->metric(tasks->a + i0 * tasks->stride, tasks->a + j0 * tasks->stride, rows, tasks->stride, columns,
+                  tasks->stride, tasks->n, block, columns * sizeof(simsimd_distance_t));
+
+    // In the condensed layout, the distances from row `i` to all rows `j > i` are contiguous
+    for (simsimd_size_t i = 0; i != rows; ++i) {
+        simsimd_size_t const first = tile_i == tile_j ? i + 1 : 0;
+        if (first >= columns) continue;
+        simsimd_size_t const offset = simsimd_pdist_offset(tasks->count, i0 + i, j0 + first);
+        _simsimd_cdist_cast_serial(block + i * columns + first, columns - first, tasks->d_type,
+                                   tasks->d + offset * tasks->d_scalar_size);
+    }
+}
+
+/**
+ *  @brief  Computes the distances between all pairs of rows of a single matrix with a many-to-many kernel,
+ *          exporting only the condensed upper triangle of `count * (count - 1) / 2` scalars, like SciPy's `pdist`.
+ *          The triangle is split into square tiles of `SIMSIMD_PARALLEL_PDIST_TILE` rows, submitted to the
+ *          `executor`, or evaluated in the calling thread if it's missing.
+ *
+ *  @param d        Condensed output of `d_type` scalars, which must be `f64`, `f32`, `f16`, or `bf16`.
+ */
+SIMSIMD_PUBLIC void simsimd_pdist_parallel(                                                         //
+    simsimd_metric_cdist_punned_t metric, simsimd_executor_punned_t executor, void *executor_state, //
+    void const *a, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n,                   //
+    void *d, simsimd_datatype_t d_type) {
+
+    simsimd_size_t const tiles = (count + SIMSIMD_PARALLEL_PDIST_TILE - 1) / SIMSIMD_PARALLEL_PDIST_TILE;
+    simsimd_size_t const count_tasks = tiles * (tiles + 1) / 2;
+    _simsimd_pdist_tasks_t tasks;
+    tasks.metric = metric, tasks.a = (simsimd_u8_t const *)a, tasks.count = count, tasks.stride = stride;
+    tasks.n = n, tasks.tiles = tiles, tasks.d = (simsimd_u8_t *)d, tasks.d_type = d_type;
+    tasks.d_scalar_size = d_type == simsimd_datatype_f64_k   ? 8
+                          : d_type == simsimd_datatype_f32_k ? 4
+                                                             : 2;
+    if (!executor || count_tasks < 2 || count * count * n < 2 * SIMSIMD_PARALLEL_MIN_WORK)
+        for (simsimd_size_t task = 0; task != count_tasks; ++task) _simsimd_pdist_task(&tasks, task);
+    else
+        executor(executor_state, &_simsimd_pdist_task, &tasks, count_tasks);
+}
+
 #if SIMSIMD_DYNAMIC_DISPATCH
 
 /*  Run-time feature-testing functions
@@ -1277,14 +4123,84 @@ SIMSIMD_DYNAMIC int simsimd_uses_sve_f16(void);
 SIMSIMD_DYNAMIC int simsimd_uses_sve_bf16(void);
 SIMSIMD_DYNAMIC int simsimd_uses_sve_i8(void);
 SIMSIMD_DYNAMIC int simsimd_uses_sve2(void);
+SIMSIMD_DYNAMIC int simsimd_uses_sve2p1(void);
 SIMSIMD_DYNAMIC int simsimd_uses_haswell(void);
 SIMSIMD_DYNAMIC int simsimd_uses_skylake(void);
 SIMSIMD_DYNAMIC int simsimd_uses_ice(void);
 SIMSIMD_DYNAMIC int simsimd_uses_genoa(void);
 SIMSIMD_DYNAMIC int simsimd_uses_sapphire(void);
+SIMSIMD_DYNAMIC int simsimd_uses_sapphire_amx(void);
 SIMSIMD_DYNAMIC int simsimd_uses_turin(void);
 SIMSIMD_DYNAMIC int simsimd_uses_sierra(void);
 
+/*  Built-in thread pool, used by the one-to-many and many-to-many kernels of the dynamic dispatch library
+ *  - Threads are spawned once and sleep between calls, avoiding the team startup cost on every request.
+ *  - Tasks are claimed from a shared atomic counter, so faster threads naturally take over more tiles.
+ *  - Optional pinning assigns workers to the CPUs from the affinity mask of the process, one NUMA node after
+ *    another, following the topology in `/sys/devices/system/node` on Linux.
+ *  - Any other thread pool can be plugged in with `simsimd_set_executor`.
+ *  - The current one, null if single-threaded, can be passed to the `*_parallel` APIs via `simsimd_get_executor`.
+ *  Reconfiguring the pool waits for the in-flight submission, but must not be called from within a task.
+ */
+SIMSIMD_DYNAMIC simsimd_size_t simsimd_set_threads(simsimd_size_t threads, int pinned);
+SIMSIMD_DYNAMIC simsimd_size_t simsimd_get_threads(void);
+SIMSIMD_DYNAMIC void simsimd_set_executor(simsimd_executor_punned_t executor, void *executor_state);
+SIMSIMD_DYNAMIC void simsimd_get_executor(simsimd_executor_punned_t *executor, void **executor_state);
+SIMSIMD_DYNAMIC void simsimd_pool_execute(void *pool, simsimd_task_punned_t task, void *context, simsimd_size_t count);
+
+/**
+ *  @brief  Finds the `k` nearest of `b_count` candidates for each of the `queries_count` queries, splitting the work
+ *          between the threads of the executor. Query `i` gets `counts[i]` entries sorted from the best to the worst
+ *          in `ids + i * k` and `distances + i * k`. Inner products keep the largest scores, all other metrics
+ *          keep the smallest. Returns 1 on success, or 0 if the metric isn't supported for the datatype.
+ */
+SIMSIMD_DYNAMIC int simsimd_topk_cdist(                                                                //
+    simsimd_metric_kind_t kind, simsimd_datatype_t datatype,                                           //
+    void const *queries, simsimd_size_t queries_count, simsimd_size_t queries_stride,                  //
+    void const *b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_size_t k, //
+    simsimd_size_t *ids, simsimd_distance_t *distances, simsimd_size_t *counts);
+
+/**
+ *  @brief  Computes the condensed upper triangle of distances between all pairs of the `count` rows of `a`,
+ *          like SciPy's `pdist`, splitting the tiles of the triangle between the threads of the executor.
+ *          The `d` output has `count * (count - 1) / 2` scalars of `d_type`, which must be `f64`, `f32`,
+ *          `f16`, or `bf16`. Returns 1 on success, or 0 if the metric has no many-to-many kernel for the
+ *          datatype, or the output type isn't supported.
+ */
+SIMSIMD_DYNAMIC int simsimd_pdist(                                                //
+    simsimd_metric_kind_t kind, simsimd_datatype_t datatype,                      //
+    void const *a, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, //
+    void *d, simsimd_datatype_t d_type);
+
+/**
+ *  @brief  Layout of a row-major matrix stored in a file. Filled by `simsimd_file_matrix_inspect` for
+ *          `.npy` files and the `.fbin`, `.u8bin`, and `.i8bin` files of the Big-ANN benchmarks,
+ *          or manually for raw files, where every row, including the last one, must span `stride` bytes.
+ */
+typedef struct simsimd_file_matrix_t {
+    simsimd_datatype_t datatype;
+    simsimd_size_t offset;     //< Number of header bytes before the first row
+    simsimd_size_t rows;       //< Number of rows
+    simsimd_size_t dimensions; //< Number of dimensions, as passed to the pairwise kernels
+    simsimd_size_t stride;     //< Number of bytes between consecutive rows
+} simsimd_file_matrix_t;
+
+/*  Exact search over vector files larger than the available memory
+ *  - `simsimd_file_matrix_inspect` parses the header of a file, returning 1 on success.
+ *  - `simsimd_topk_file` finds the `k` nearest rows of the file for each of the `queries_count` queries,
+ *    streaming it in windows of `SIMSIMD_TOPK_FILE_WINDOW` bytes. The next window is mapped and prefetched
+ *    asynchronously by the kernel, while the current one is scored with the one-to-many kernels, split between
+ *    the threads of the executor. Query `i` gets `counts[i]` entries sorted from the best to the worst in
+ *    `ids + i * k` and `distances + i * k`. Returns 1 on success, or 0 if the metric isn't supported for
+ *    the datatype of the file, or if the file can't be mapped or is shorter than its layout.
+ *  Streaming requires POSIX memory mapping, on other platforms both functions return 0.
+ */
+SIMSIMD_DYNAMIC int simsimd_file_matrix_inspect(char const *path, simsimd_file_matrix_t *matrix);
+SIMSIMD_DYNAMIC int simsimd_topk_file(                                                           //
+    simsimd_metric_kind_t kind, void const *queries, simsimd_size_t queries_count,               //
+    simsimd_size_t queries_stride, char const *path, simsimd_file_matrix_t const *matrix,        //
+    simsimd_size_t k, simsimd_size_t *ids, simsimd_distance_t *distances, simsimd_size_t *counts);
+
 /*  Inner products
  *  - Dot product: the sum of the products of the corresponding elements of two vectors.
  *  - Complex Dot product: dot product with a conjugate first argument.
@@ -1299,6 +4215,12 @@ SIMSIMD_DYNAMIC int simsimd_uses_sierra(void);
  *  @note The dot product is zero if and only if the two vectors are orthogonal.
  *  @note Defined only for floating-point and integer data types.
  */
+SIMSIMD_DYNAMIC void simsimd_dot_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                    simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                    simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_i4x2(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                      simsimd_distance_t *d);
 SIMSIMD_DYNAMIC void simsimd_dot_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
                                      simsimd_distance_t *d);
 SIMSIMD_DYNAMIC void simsimd_dot_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
@@ -1341,6 +4263,8 @@ SIMSIMD_DYNAMIC void simsimd_cos_i8(simsimd_i8_t const *a, simsimd_i8_t const *b
                                     simsimd_distance_t *d);
 SIMSIMD_DYNAMIC void simsimd_cos_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
                                     simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_i4x2(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                      simsimd_distance_t *d);
 SIMSIMD_DYNAMIC void simsimd_cos_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
                                      simsimd_distance_t *d);
 SIMSIMD_DYNAMIC void simsimd_cos_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
@@ -1353,6 +4277,8 @@ SIMSIMD_DYNAMIC void simsimd_l2sq_i8(simsimd_i8_t const *a, simsimd_i8_t const *
                                      simsimd_distance_t *d);
 SIMSIMD_DYNAMIC void simsimd_l2sq_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
                                      simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_i4x2(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                       simsimd_distance_t *d);
 SIMSIMD_DYNAMIC void simsimd_l2sq_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
                                       simsimd_distance_t *d);
 SIMSIMD_DYNAMIC void simsimd_l2sq_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
@@ -1365,6 +4291,8 @@ SIMSIMD_DYNAMIC void simsimd_l2_i8(simsimd_i8_t const *a, simsimd_i8_t const *b,
                                    simsimd_distance_t *d);
 SIMSIMD_DYNAMIC void simsimd_l2_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
                                    simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_i4x2(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                     simsimd_distance_t *d);
 SIMSIMD_DYNAMIC void simsimd_l2_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
                                     simsimd_distance_t *d);
 SIMSIMD_DYNAMIC void simsimd_l2_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
@@ -1374,6 +4302,110 @@ SIMSIMD_DYNAMIC void simsimd_l2_f32(simsimd_f32_t const *a, simsimd_f32_t const
 SIMSIMD_DYNAMIC void simsimd_l2_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
                                     simsimd_distance_t *d);
 
+/*  Asymmetric distances between floating-point queries and quantized rows
+ *  - Dequantize every element of `b` as `(b[i] - zero_points[j]) * scales[j]` on the fly.
+ *  - Use `j = 0` for per-vector parameters with `params_stride == 0`, and `j = i` for per-dimension ones.
+ *
+ *  @param a The `f32` or `f16` query vector.
+ *  @param b The `i8`, `u8`, or `i4x2` quantized vector.
+ *  @param n The number of dimensions in both vectors; `i4x2` rows occupy `(n + 1) / 2` bytes.
+ *  @param scales The dequantization scales.
+ *  @param zero_points The dequantization offsets.
+ *  @param params_stride The stride between consecutive `scales` and `zero_points`, either 0 or 1.
+ *  @param d The output distance value.
+ */
+SIMSIMD_DYNAMIC void simsimd_dot_f32i8(simsimd_f32_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_f32u8(simsimd_f32_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_f32i4x2(simsimd_f32_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                         simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                         simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_f16i8(simsimd_f16_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_f16u8(simsimd_f16_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_f16i4x2(simsimd_f16_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                         simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                         simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_f32i8(simsimd_f32_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_f32u8(simsimd_f32_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_f32i4x2(simsimd_f32_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                         simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                         simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_f16i8(simsimd_f16_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_f16u8(simsimd_f16_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_f16i4x2(simsimd_f16_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                         simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                         simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_f32i8(simsimd_f32_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                        simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_f32u8(simsimd_f32_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                        simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_f32i4x2(simsimd_f32_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                          simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                          simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_f16i8(simsimd_f16_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                        simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_f16u8(simsimd_f16_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                        simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_f16i4x2(simsimd_f16_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                          simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                          simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_f32i8(simsimd_f32_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_f32u8(simsimd_f32_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_f32i4x2(simsimd_f32_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                        simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_f16i8(simsimd_f16_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_f16u8(simsimd_f16_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_f16i4x2(simsimd_f16_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                        simsimd_size_t params_stride, simsimd_distance_t *d);
+
+/*  Product Quantization scans
+ *  - Sum one entry of a quantized ADC table per subspace, selected by the codes of every database vector.
+ *  - Export the sums as `bias + scale * sum`, with both parameters coming from `simsimd_pq_quantize_table`.
+ *
+ *  @param codes The codes of `count` vectors, packed with `simsimd_pq_pack_u8` or `simsimd_pq_pack_u4x2`.
+ *  @param count The number of database vectors.
+ *  @param subspaces The number of subspaces.
+ *  @param table The quantized table, with 256 entries per subspace for `u8` and 16 for `u4x2` codes.
+ *  @param scale The multiplier of the integer sums.
+ *  @param bias The offset of the integer sums.
+ *  @param results The output approximate distances, one per database vector.
+ */
+SIMSIMD_DYNAMIC void simsimd_pq_scan_u8(simsimd_u8_t const *codes, simsimd_size_t count, simsimd_size_t subspaces,
+                                        simsimd_u8_t const *table, simsimd_distance_t scale, simsimd_distance_t bias,
+                                        simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_pq_scan_u4x2(simsimd_u4x2_t const *codes, simsimd_size_t count, simsimd_size_t subspaces,
+                                          simsimd_u8_t const *table, simsimd_distance_t scale, simsimd_distance_t bias,
+                                          simsimd_distance_t *results);
+
 /*  Binary distances
  *  - Hamming distance: the number of positions at which the corresponding bits are different.
  *  - Jaccard distance: ratio of bit-level matching positions (intersection) to the total number of positions (union).
@@ -1423,6 +4455,652 @@ SIMSIMD_DYNAMIC void simsimd_js_f32(simsimd_f32_t const *a, simsimd_f32_t const
 SIMSIMD_DYNAMIC void simsimd_js_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
                                     simsimd_distance_t *d);
 
+/*  One-to-many batches of the inner products, spatial, and binary distances above
+ *  - Compare a single query vector against every row of a matrix, amortizing the query loads.
+ *
+ *  @param a The query vector.
+ *  @param b The first row of the candidates matrix.
+ *  @param b_count The number of rows in the candidates matrix.
+ *  @param b_stride The number of bytes between the starts of consecutive rows.
+ *  @param n The number of elements in the query and in each row.
+ *  @param d The output array of `b_count` distance values.
+ */
+SIMSIMD_DYNAMIC void simsimd_dot_batch_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_batch_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                            simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_dot_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                            simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                            simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                             simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                            simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                            simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                         simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                         simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_hamming_batch_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_jaccard_batch_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+
+/*  Many-to-many distance matrices of the inner products and spatial distances above
+ *  - Compare every row of one matrix against every row of another, packing both into cache-friendly panels.
+ *
+ *  @param a The first row of the first matrix.
+ *  @param b The first row of the second matrix.
+ *  @param a_count The number of rows in the first matrix.
+ *  @param a_stride The number of bytes between the starts of consecutive rows of the first matrix.
+ *  @param b_count The number of rows in the second matrix.
+ *  @param b_stride The number of bytes between the starts of consecutive rows of the second matrix.
+ *  @param n The number of elements in each row.
+ *  @param d The output row-major matrix of `a_count` by `b_count` distance values.
+ *  @param d_stride The number of bytes between the starts of consecutive rows of the output matrix.
+ */
+SIMSIMD_DYNAMIC void simsimd_dot_cdist_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                          simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                          simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_dot_cdist_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                           simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                           simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_dot_cdist_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t a_count,
+                                            simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                            simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_dot_cdist_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                           simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                           simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                          simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                          simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                           simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                           simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t a_count,
+                                            simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                            simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                           simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                           simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                           simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                           simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                            simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                            simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t a_count,
+                                             simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                             simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                            simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                            simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                         simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                         simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                          simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                          simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t a_count,
+                                           simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                           simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                          simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                          simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+SIMSIMD_DYNAMIC void simsimd_hamming_cdist_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t a_count,
+                                              simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                              simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+
+/*  Many-to-many distance matrices of the inner products and spatial distances above, in a custom output precision
+ *  - Narrow the distances right after the norm correction of every cache block, skipping the `f64` matrix.
+ *
+ *  @param d The output row-major matrix of `a_count` by `b_count` distance values of `d_type`.
+ *  @param d_type The precision of the output, one of `f64`, `f32`, `f16`, or `bf16`.
+ */
+SIMSIMD_DYNAMIC void simsimd_dot_cdist_typed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_dot_cdist_typed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                 simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_dot_cdist_typed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                  simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_dot_cdist_typed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                 simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_typed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_typed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                 simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_typed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                  simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_typed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                 simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_typed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                 simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_typed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b,
+                                                  simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_typed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                   simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_typed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                  simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_typed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                               simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                               simsimd_size_t n, void *d, simsimd_size_t d_stride,
+                                               simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_typed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_typed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                 simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                 simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                 void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_typed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_jaccard_cdist_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t a_count,
+                                              simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                              simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride);
+
+/*  Squared norms of many rows and the angular and Euclidean distances reusing them
+ *  - Compute the norms of a static collection once, and skip their accumulation in every later batch or matrix.
+ *
+ *  @param rows The first row of the matrix, which norms are computed.
+ *  @param norms The output array of `count` squared norms.
+ *  @param a_norm The optional squared norm of the query, computed on the fly if NULL.
+ *  @param a_norms The optional squared norms of the rows of the first matrix, computed on the fly if NULL.
+ *  @param b_norms The optional squared norms of the rows of the second matrix, computed on the fly if NULL.
+ */
+SIMSIMD_DYNAMIC void simsimd_norms_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                      simsimd_size_t n, simsimd_distance_t *norms);
+SIMSIMD_DYNAMIC void simsimd_norms_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                      simsimd_size_t n, simsimd_distance_t *norms);
+SIMSIMD_DYNAMIC void simsimd_norms_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                       simsimd_size_t n, simsimd_distance_t *norms);
+SIMSIMD_DYNAMIC void simsimd_norms_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                        simsimd_size_t n, simsimd_distance_t *norms);
+SIMSIMD_DYNAMIC void simsimd_norms_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                       simsimd_size_t n, simsimd_distance_t *norms);
+SIMSIMD_DYNAMIC void simsimd_norms_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                       simsimd_size_t n, simsimd_distance_t *norms);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                 simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_normed_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                 simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                  simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                   simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                  simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_batch_normed_f64(simsimd_f64_t const *a, simsimd_f64_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                  simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                                  simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                  simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_normed_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                                  simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                  simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                   simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                    simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                    simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                    simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                   simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2sq_batch_normed_f64(simsimd_f64_t const *a, simsimd_f64_t const *b,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                   simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_normed_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                 simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                  simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                 simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_l2_batch_normed_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                 simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                 void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b,
+                                                  simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                   simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                   void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_cos_cdist_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                  simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                                  simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                  simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b,
+                                                   simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                   void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                    simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                    simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                    simsimd_distance_t const *a_norms,
+                                                    simsimd_distance_t const *b_norms, void *d, simsimd_size_t d_stride,
+                                                    simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2sq_cdist_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                   simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                   void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                 void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                  simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+SIMSIMD_DYNAMIC void simsimd_l2_cdist_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                 void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type);
+
+/*  Threshold searches over bit-vectors, useful for near-duplicate detection
+ *  - Report only the rows of `b` within the `radius` of the query `a`, in ascending order.
+ *
+ *  @param a The query bit-vector.
+ *  @param b The first candidate bit-vector.
+ *  @param b_count The number of candidates.
+ *  @param b_stride The number of bytes between the starts of consecutive candidates.
+ *  @param n The number of 8-bit words in each bit-vector.
+ *  @param radius The largest distance to be reported, inclusive.
+ *  @param ids The output indices of the matches, at least `b_count` entries.
+ *  @param distances The optional output distances of the matches, at least `b_count` entries, can be NULL.
+ *  @param found The output number of matches.
+ */
+SIMSIMD_DYNAMIC void simsimd_hamming_radius_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                               simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t radius,
+                                               simsimd_size_t *ids, simsimd_distance_t *distances,
+                                               simsimd_size_t *found);
+SIMSIMD_DYNAMIC void simsimd_jaccard_radius_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                               simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t radius,
+                                               simsimd_size_t *ids, simsimd_distance_t *distances,
+                                               simsimd_size_t *found);
+
+/*  Weighted sparse set intersections, outputting the intersection size and the dot product of the matching weights
+ *
+ *  @param a The first sorted array of integers.
+ *  @param b The second sorted array of integers.
+ *  @param a_weights The weights for the first array.
+ *  @param b_weights The weights for the second array.
+ *  @param a_length The number of elements in the first array.
+ *  @param b_length The number of elements in the second array.
+ *  @param d The output pair of the intersection size and the weighted product.
+ */
+SIMSIMD_DYNAMIC void simsimd_spdot_counts_u16(simsimd_u16_t const *a, simsimd_u16_t const *b,
+                                              simsimd_i16_t const *a_weights, simsimd_i16_t const *b_weights,
+                                              simsimd_size_t a_length, simsimd_size_t b_length, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_spdot_weights_u16(simsimd_u16_t const *a, simsimd_u16_t const *b,
+                                               simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights,
+                                               simsimd_size_t a_length, simsimd_size_t b_length, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_spdot_weights_u32(simsimd_u32_t const *a, simsimd_u32_t const *b,
+                                               simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights,
+                                               simsimd_size_t a_length, simsimd_size_t b_length, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_spdot_weights_f32_u32(simsimd_u32_t const *a, simsimd_u32_t const *b,
+                                                   simsimd_f32_t const *a_weights, simsimd_f32_t const *b_weights,
+                                                   simsimd_size_t a_length, simsimd_size_t b_length,
+                                                   simsimd_distance_t *d);
+
+/*  Sparse set intersections and dot products of one query against many documents
+ *  - Documents are concatenated into one indices buffer and one weights buffer, like CSR matrix rows.
+ *
+ *  @param a The sorted query indices.
+ *  @param a_weights The query weights.
+ *  @param a_length The number of elements in the query.
+ *  @param b The concatenated sorted indices of all documents.
+ *  @param b_weights The concatenated weights of all documents.
+ *  @param b_offsets The offsets of the documents in `b`, with `b_count + 1` entries.
+ *  @param b_count The number of documents.
+ *  @param d The output array of `b_count` intersection sizes or weighted products.
+ */
+SIMSIMD_DYNAMIC void simsimd_intersect_batch_u16(simsimd_u16_t const *a, simsimd_size_t a_length,
+                                                 simsimd_u16_t const *b, simsimd_size_t const *b_offsets,
+                                                 simsimd_size_t b_count, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_intersect_batch_u32(simsimd_u32_t const *a, simsimd_size_t a_length,
+                                                 simsimd_u32_t const *b, simsimd_size_t const *b_offsets,
+                                                 simsimd_size_t b_count, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_spdot_weights_batch_u16(simsimd_u16_t const *a, simsimd_bf16_t const *a_weights,
+                                                     simsimd_size_t a_length, simsimd_u16_t const *b,
+                                                     simsimd_bf16_t const *b_weights,
+                                                     simsimd_size_t const *b_offsets, simsimd_size_t b_count,
+                                                     simsimd_distance_t *d);
+
+/*  Geospatial distances between pairs of points in radians, using the WGS-84 ellipsoid for Vincenty
+ */
+SIMSIMD_DYNAMIC void simsimd_haversine_f64(simsimd_f64_t const *a_lats, simsimd_f64_t const *a_lons,
+                                           simsimd_f64_t const *b_lats, simsimd_f64_t const *b_lons,
+                                           simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_haversine_f32(simsimd_f32_t const *a_lats, simsimd_f32_t const *a_lons,
+                                           simsimd_f32_t const *b_lats, simsimd_f32_t const *b_lons,
+                                           simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_hav_f64(simsimd_f64_t const *a_lats, simsimd_f64_t const *a_lons,
+                                     simsimd_f64_t const *b_lats, simsimd_f64_t const *b_lons,
+                                     simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_hav_f32(simsimd_f32_t const *a_lats, simsimd_f32_t const *a_lons,
+                                     simsimd_f32_t const *b_lats, simsimd_f32_t const *b_lons,
+                                     simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_vincenty_f64(simsimd_f64_t const *a_lats, simsimd_f64_t const *a_lons,
+                                          simsimd_f64_t const *b_lats, simsimd_f64_t const *b_lons,
+                                          simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_vincenty_f32(simsimd_f32_t const *a_lats, simsimd_f32_t const *a_lons,
+                                          simsimd_f32_t const *b_lats, simsimd_f32_t const *b_lons,
+                                          simsimd_size_t n, simsimd_distance_t *d);
+
+/*  Root Mean Square Deviation between rigid 3D point clouds with interleaved coordinates, with and without
+ *  the optimal rotation, and their one-to-many batches
+ */
+SIMSIMD_DYNAMIC void simsimd_rmsd_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                      simsimd_f64_t *a_centroid, simsimd_f64_t *b_centroid, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_rmsd_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t *a_centroid, simsimd_f32_t *b_centroid, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_rmsd_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
+                                      simsimd_f16_t *a_centroid, simsimd_f16_t *b_centroid, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_rmsd_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
+                                       simsimd_bf16_t *a_centroid, simsimd_bf16_t *b_centroid, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_kabsch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                        simsimd_f64_t *a_centroid, simsimd_f64_t *b_centroid, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_kabsch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                        simsimd_f32_t *a_centroid, simsimd_f32_t *b_centroid, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_kabsch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
+                                        simsimd_f16_t *a_centroid, simsimd_f16_t *b_centroid, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_kabsch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
+                                         simsimd_bf16_t *a_centroid, simsimd_bf16_t *b_centroid, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_rmsd_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                            simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_rmsd_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                            simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_rmsd_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                            simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_rmsd_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                             simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_kabsch_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_kabsch_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_kabsch_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+SIMSIMD_DYNAMIC void simsimd_kabsch_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                               simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d);
+
+/*  Curved spaces in batches: projecting many rows by a factor `l` of the metric tensor `l * l^T`, turning the
+ *  Mahalanobis distances into `l2` ones, and bilinear forms `a_i^T * c * b_j` between all pairs of rows
+ */
+SIMSIMD_DYNAMIC void simsimd_whiten_f32(simsimd_f32_t const *vectors, simsimd_size_t count, simsimd_size_t stride,
+                                        simsimd_f32_t const *l, simsimd_size_t n, simsimd_f32_t *whitened,
+                                        simsimd_size_t whitened_stride);
+SIMSIMD_DYNAMIC void simsimd_bilinear_cdist_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_f32_t const *c, simsimd_size_t n,
+                                                simsimd_distance_t *d, simsimd_size_t d_stride);
+
+/*  Element-wise kernels: scaling and shifting, sums and products of pairs of vectors, and scaled conversions
+ *  from `f32` into narrower datatypes and back, all of which may be applied in-place when the datatypes match
+ */
+SIMSIMD_DYNAMIC void simsimd_scale_f64(simsimd_f64_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                       simsimd_distance_t beta, simsimd_f64_t *r);
+SIMSIMD_DYNAMIC void simsimd_scale_f32(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                       simsimd_distance_t beta, simsimd_f32_t *r);
+SIMSIMD_DYNAMIC void simsimd_scale_f16(simsimd_f16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                       simsimd_distance_t beta, simsimd_f16_t *r);
+SIMSIMD_DYNAMIC void simsimd_scale_bf16(simsimd_bf16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                        simsimd_distance_t beta, simsimd_bf16_t *r);
+SIMSIMD_DYNAMIC void simsimd_scale_i8(simsimd_i8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                      simsimd_distance_t beta, simsimd_i8_t *r);
+SIMSIMD_DYNAMIC void simsimd_scale_u8(simsimd_u8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                      simsimd_distance_t beta, simsimd_u8_t *r);
+SIMSIMD_DYNAMIC void simsimd_add_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                     simsimd_f64_t *r);
+SIMSIMD_DYNAMIC void simsimd_add_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                     simsimd_f32_t *r);
+SIMSIMD_DYNAMIC void simsimd_add_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
+                                     simsimd_f16_t *r);
+SIMSIMD_DYNAMIC void simsimd_add_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
+                                      simsimd_bf16_t *r);
+SIMSIMD_DYNAMIC void simsimd_add_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t n, simsimd_i8_t *r);
+SIMSIMD_DYNAMIC void simsimd_add_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n, simsimd_u8_t *r);
+SIMSIMD_DYNAMIC void simsimd_multiply_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                          simsimd_f64_t *r);
+SIMSIMD_DYNAMIC void simsimd_multiply_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                          simsimd_f32_t *r);
+SIMSIMD_DYNAMIC void simsimd_multiply_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
+                                          simsimd_f16_t *r);
+SIMSIMD_DYNAMIC void simsimd_multiply_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
+                                           simsimd_bf16_t *r);
+SIMSIMD_DYNAMIC void simsimd_multiply_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                         simsimd_i8_t *r);
+SIMSIMD_DYNAMIC void simsimd_multiply_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                         simsimd_u8_t *r);
+SIMSIMD_DYNAMIC void simsimd_quantize_f16(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                          simsimd_f16_t *r);
+SIMSIMD_DYNAMIC void simsimd_quantize_bf16(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                           simsimd_bf16_t *r);
+SIMSIMD_DYNAMIC void simsimd_quantize_i8(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                         simsimd_i8_t *r);
+SIMSIMD_DYNAMIC void simsimd_quantize_u8(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                         simsimd_u8_t *r);
+SIMSIMD_DYNAMIC void simsimd_quantize_b8(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                         simsimd_b8_t *r);
+SIMSIMD_DYNAMIC void simsimd_dequantize_f16(simsimd_f16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                            simsimd_f32_t *r);
+SIMSIMD_DYNAMIC void simsimd_dequantize_bf16(simsimd_bf16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                             simsimd_f32_t *r);
+SIMSIMD_DYNAMIC void simsimd_dequantize_i8(simsimd_i8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                           simsimd_f32_t *r);
+SIMSIMD_DYNAMIC void simsimd_dequantize_u8(simsimd_u8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                           simsimd_f32_t *r);
+
+/*  Row-wise reductions of dense vectors
+ *  - Sums, L1 and L2 norms, as well as minimums and maximums with the indices of their first occurrences.
+ *
+ *  @param rows The first row of the matrix, which rows are reduced.
+ *  @param count The number of rows, one for a single vector.
+ *  @param results The output array of `count` reductions.
+ *  @param values The output array of `count` extremums.
+ *  @param indices The optional output array of `count` indices of the extremums within their rows.
+ */
+SIMSIMD_DYNAMIC void simsimd_reduce_sum_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_sum_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_sum_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_sum_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                             simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_sum_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_sum_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l1_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l1_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l1_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l1_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l1_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l1_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l2_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l2_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l2_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l2_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l2_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_l2_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_reduce_min_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+SIMSIMD_DYNAMIC void simsimd_reduce_min_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+SIMSIMD_DYNAMIC void simsimd_reduce_min_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+SIMSIMD_DYNAMIC void simsimd_reduce_min_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                             simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+SIMSIMD_DYNAMIC void simsimd_reduce_min_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+SIMSIMD_DYNAMIC void simsimd_reduce_min_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+SIMSIMD_DYNAMIC void simsimd_reduce_max_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+SIMSIMD_DYNAMIC void simsimd_reduce_max_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+SIMSIMD_DYNAMIC void simsimd_reduce_max_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+SIMSIMD_DYNAMIC void simsimd_reduce_max_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                             simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+SIMSIMD_DYNAMIC void simsimd_reduce_max_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+SIMSIMD_DYNAMIC void simsimd_reduce_max_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices);
+
+/*  One-to-many similarity of byte strings
+ *  - Bounded Levenshtein distances, as well as Needleman-Wunsch and Smith-Waterman alignment scores.
+ *
+ *  @param a The query sequence of `a_length` bytes.
+ *  @param b The first of `b_count` candidate sequences, spaced `b_stride` bytes apart.
+ *  @param b_lengths The lengths of the candidates in bytes.
+ *  @param bound The largest distance of interest, with the further candidates reported as `bound + 1`.
+ *  @param results The output array of `b_count` distances or scores, NaN where the shorter of the two sequences
+ *          exceeds `SIMSIMD_STRINGS_MAX_LENGTH`, which defaults to 1024 bytes.
+ */
+SIMSIMD_DYNAMIC void simsimd_levenshtein_batch_u8(simsimd_u8_t const *a, simsimd_size_t a_length, simsimd_u8_t const *b,
+                                                  simsimd_size_t const *b_lengths, simsimd_size_t b_count,
+                                                  simsimd_size_t b_stride, simsimd_size_t bound,
+                                                  simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_needleman_wunsch_batch_u8(simsimd_u8_t const *a, simsimd_size_t a_length,
+                                                       simsimd_u8_t const *b, simsimd_size_t const *b_lengths,
+                                                       simsimd_size_t b_count, simsimd_size_t b_stride,
+                                                       simsimd_i32_t match, simsimd_i32_t mismatch, simsimd_i32_t gap,
+                                                       simsimd_distance_t *results);
+SIMSIMD_DYNAMIC void simsimd_smith_waterman_batch_u8(simsimd_u8_t const *a, simsimd_size_t a_length,
+                                                     simsimd_u8_t const *b, simsimd_size_t const *b_lengths,
+                                                     simsimd_size_t b_count, simsimd_size_t b_stride,
+                                                     simsimd_i32_t match, simsimd_i32_t mismatch, simsimd_i32_t gap,
+                                                     simsimd_distance_t *results);
+
 #else
 
 /*  Compile-time feature-testing functions
@@ -1447,11 +5125,13 @@ SIMSIMD_PUBLIC int simsimd_uses_sve_f16(void) { return _SIMSIMD_TARGET_ARM && SI
 SIMSIMD_PUBLIC int simsimd_uses_sve_bf16(void) { return _SIMSIMD_TARGET_ARM && SIMSIMD_TARGET_SVE_BF16; }
 SIMSIMD_PUBLIC int simsimd_uses_sve_i8(void) { return _SIMSIMD_TARGET_ARM && SIMSIMD_TARGET_SVE_I8; }
 SIMSIMD_PUBLIC int simsimd_uses_sve2(void) { return _SIMSIMD_TARGET_ARM && SIMSIMD_TARGET_SVE2; }
+SIMSIMD_PUBLIC int simsimd_uses_sve2p1(void) { return _SIMSIMD_TARGET_ARM && SIMSIMD_TARGET_SVE2P1; }
 SIMSIMD_PUBLIC int simsimd_uses_haswell(void) { return _SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_HASWELL; }
 SIMSIMD_PUBLIC int simsimd_uses_skylake(void) { return _SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_SKYLAKE; }
 SIMSIMD_PUBLIC int simsimd_uses_ice(void) { return _SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_ICE; }
 SIMSIMD_PUBLIC int simsimd_uses_genoa(void) { return _SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_GENOA; }
 SIMSIMD_PUBLIC int simsimd_uses_sapphire(void) { return _SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_SAPPHIRE; }
+SIMSIMD_PUBLIC int simsimd_uses_sapphire_amx(void) { return _SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_SAPPHIRE_AMX; }
 SIMSIMD_PUBLIC int simsimd_uses_turin(void) { return _SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_TURIN; }
 SIMSIMD_PUBLIC int simsimd_uses_sierra(void) { return _SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_SIERRA; }
 SIMSIMD_PUBLIC int simsimd_uses_dynamic_dispatch(void) { return 0; }
@@ -1483,7 +5163,9 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
  */
 SIMSIMD_PUBLIC void simsimd_dot_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
                                    simsimd_distance_t *d) {
-#if SIMSIMD_TARGET_NEON_F16
+#if SIMSIMD_TARGET_SVE
+    simsimd_dot_i8_sve(a, b, n, d);
+#elif SIMSIMD_TARGET_NEON_F16
     simsimd_dot_i8_neon(a, b, n, d);
 #elif SIMSIMD_TARGET_ICE
     simsimd_dot_i8_ice(a, b, n, d);
@@ -1505,9 +5187,25 @@ SIMSIMD_PUBLIC void simsimd_dot_u8(simsimd_u8_t const *a, simsimd_u8_t const *b,
     simsimd_dot_u8_serial(a, b, n, d);
 #endif
 }
+SIMSIMD_PUBLIC void simsimd_dot_i4x2(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                     simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_dot_i4x2_sve(a, b, n, d);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_dot_i4x2_neon(a, b, n, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_dot_i4x2_ice(a, b, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_i4x2_haswell(a, b, n, d);
+#else
+    simsimd_dot_i4x2_serial(a, b, n, d);
+#endif
+}
 SIMSIMD_PUBLIC void simsimd_dot_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
                                     simsimd_distance_t *d) {
-#if SIMSIMD_TARGET_SVE_F16
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_dot_f16_sve2p1(a, b, n, d);
+#elif SIMSIMD_TARGET_SVE_F16
     simsimd_dot_f16_sve(a, b, n, d);
 #elif SIMSIMD_TARGET_NEON_F16
     simsimd_dot_f16_neon(a, b, n, d);
@@ -1525,6 +5223,8 @@ SIMSIMD_PUBLIC void simsimd_dot_bf16(simsimd_bf16_t const *a, simsimd_bf16_t con
     simsimd_dot_bf16_genoa(a, b, n, d);
 #elif SIMSIMD_TARGET_HASWELL
     simsimd_dot_bf16_haswell(a, b, n, d);
+#elif SIMSIMD_TARGET_SVE_BF16
+    simsimd_dot_bf16_sve(a, b, n, d);
 #elif SIMSIMD_TARGET_NEON_BF16
     simsimd_dot_bf16_neon(a, b, n, d);
 #else
@@ -1689,6 +5389,20 @@ SIMSIMD_PUBLIC void simsimd_cos_u8(simsimd_u8_t const *a, simsimd_u8_t const *b,
     simsimd_cos_u8_serial(a, b, n, d);
 #endif
 }
+SIMSIMD_PUBLIC void simsimd_cos_i4x2(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                     simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_cos_i4x2_sve(a, b, n, d);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_cos_i4x2_neon(a, b, n, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_cos_i4x2_ice(a, b, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_i4x2_haswell(a, b, n, d);
+#else
+    simsimd_cos_i4x2_serial(a, b, n, d);
+#endif
+}
 SIMSIMD_PUBLIC void simsimd_cos_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
                                     simsimd_distance_t *d) {
 #if SIMSIMD_TARGET_SVE_F16
@@ -1767,6 +5481,20 @@ SIMSIMD_PUBLIC void simsimd_l2sq_u8(simsimd_u8_t const *a, simsimd_u8_t const *b
     simsimd_l2sq_u8_serial(a, b, n, d);
 #endif
 }
+SIMSIMD_PUBLIC void simsimd_l2sq_i4x2(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                      simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2sq_i4x2_sve(a, b, n, d);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_l2sq_i4x2_neon(a, b, n, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_l2sq_i4x2_ice(a, b, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_i4x2_haswell(a, b, n, d);
+#else
+    simsimd_l2sq_i4x2_serial(a, b, n, d);
+#endif
+}
 SIMSIMD_PUBLIC void simsimd_l2sq_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
                                      simsimd_distance_t *d) {
 #if SIMSIMD_TARGET_SVE_F16
@@ -1845,6 +5573,20 @@ SIMSIMD_PUBLIC void simsimd_l2_u8(simsimd_u8_t const *a, simsimd_u8_t const *b,
     simsimd_l2_u8_serial(a, b, n, d);
 #endif
 }
+SIMSIMD_PUBLIC void simsimd_l2_i4x2(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                    simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2_i4x2_sve(a, b, n, d);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_l2_i4x2_neon(a, b, n, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_l2_i4x2_ice(a, b, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_i4x2_haswell(a, b, n, d);
+#else
+    simsimd_l2_i4x2_serial(a, b, n, d);
+#endif
+}
 SIMSIMD_PUBLIC void simsimd_l2_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
                                    simsimd_distance_t *d) {
 #if SIMSIMD_TARGET_SVE_F16
@@ -1900,23 +5642,365 @@ SIMSIMD_PUBLIC void simsimd_l2_f64(simsimd_f64_t const *a, simsimd_f64_t const *
 #endif
 }
 
-/*  Binary distances
- *  - Hamming distance: the number of positions at which the corresponding bits are different.
- *  - Jaccard distance: ratio of bit-level matching positions (intersection) to the total number of positions (union).
- *
- *  @param a The first binary vector.
- *  @param b The second binary vector.
- *  @param n The number of 8-bit words in the vectors.
- *  @param d The output distance value.
- *
- *  @note The output distance value is non-negative.
- *  @note The output distance value is zero if and only if the two vectors are identical.
- *  @note Defined only for binary data.
- */
-SIMSIMD_PUBLIC void simsimd_hamming_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t n,
-                                       simsimd_distance_t *d) {
-#if SIMSIMD_TARGET_SVE
-    simsimd_hamming_b8_sve(a, b, n, d);
+/*  Asymmetric distances between floating-point queries and quantized rows */
+SIMSIMD_PUBLIC void simsimd_dot_f32i8(simsimd_f32_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_f32i8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_f32i8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dot_f32i8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_dot_f32i8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_f32u8(simsimd_f32_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_f32u8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_f32u8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dot_f32u8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_dot_f32u8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_f32i4x2(simsimd_f32_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                        simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_f32i4x2_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_f32i4x2_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dot_f32i4x2_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_dot_f32i4x2_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_f16i8(simsimd_f16_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_f16i8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_f16i8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_dot_f16i8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_dot_f16i8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_f16u8(simsimd_f16_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_f16u8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_f16u8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_dot_f16u8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_dot_f16u8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_f16i4x2(simsimd_f16_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                        simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_f16i4x2_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_f16i4x2_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_dot_f16i4x2_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_dot_f16i4x2_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_f32i8(simsimd_f32_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_f32i8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_f32i8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_f32i8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_cos_f32i8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_f32u8(simsimd_f32_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_f32u8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_f32u8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_f32u8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_cos_f32u8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_f32i4x2(simsimd_f32_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                        simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_f32i4x2_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_f32i4x2_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_f32i4x2_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_cos_f32i4x2_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_f16i8(simsimd_f16_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_f16i8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_f16i8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_cos_f16i8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_cos_f16i8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_f16u8(simsimd_f16_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                      simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                      simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_f16u8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_f16u8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_cos_f16u8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_cos_f16u8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_f16i4x2(simsimd_f16_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                        simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_f16i4x2_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_f16i4x2_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_cos_f16i4x2_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_cos_f16i4x2_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_f32i8(simsimd_f32_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_f32i8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_f32i8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_f32i8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2sq_f32i8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_f32u8(simsimd_f32_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_f32u8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_f32u8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_f32u8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2sq_f32u8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_f32i4x2(simsimd_f32_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                         simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                         simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_f32i4x2_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_f32i4x2_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_f32i4x2_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2sq_f32i4x2_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_f16i8(simsimd_f16_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_f16i8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_f16i8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_l2sq_f16i8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2sq_f16i8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_f16u8(simsimd_f16_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_f16u8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_f16u8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_l2sq_f16u8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2sq_f16u8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_f16i4x2(simsimd_f16_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                         simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                         simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_f16i4x2_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_f16i4x2_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_l2sq_f16i4x2_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2sq_f16i4x2_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_f32i8(simsimd_f32_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                     simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                     simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_f32i8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_f32i8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_f32i8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2_f32i8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_f32u8(simsimd_f32_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                     simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                     simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_f32u8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_f32u8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_f32u8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2_f32u8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_f32i4x2(simsimd_f32_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_f32i4x2_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_f32i4x2_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_f32i4x2_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2_f32i4x2_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_f16i8(simsimd_f16_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                     simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                     simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_f16i8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_f16i8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_l2_f16i8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2_f16i8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_f16u8(simsimd_f16_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                     simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                     simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_f16u8_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_f16u8_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_l2_f16u8_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2_f16u8_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_f16i4x2(simsimd_f16_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t const *scales, simsimd_f32_t const *zero_points,
+                                       simsimd_size_t params_stride, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_f16i4x2_skylake(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_f16i4x2_haswell(a, b, n, scales, zero_points, params_stride, d);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_l2_f16i4x2_neon(a, b, n, scales, zero_points, params_stride, d);
+#else
+    simsimd_l2_f16i4x2_serial(a, b, n, scales, zero_points, params_stride, d);
+#endif
+}
+
+/*  Product Quantization scans */
+SIMSIMD_PUBLIC void simsimd_pq_scan_u8(simsimd_u8_t const *codes, simsimd_size_t count, simsimd_size_t subspaces,
+                                       simsimd_u8_t const *table, simsimd_distance_t scale, simsimd_distance_t bias,
+                                       simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_ICE
+    simsimd_pq_scan_u8_ice(codes, count, subspaces, table, scale, bias, results);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_pq_scan_u8_neon(codes, count, subspaces, table, scale, bias, results);
+#else
+    simsimd_pq_scan_u8_serial(codes, count, subspaces, table, scale, bias, results);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_pq_scan_u4x2(simsimd_u4x2_t const *codes, simsimd_size_t count, simsimd_size_t subspaces,
+                                         simsimd_u8_t const *table, simsimd_distance_t scale, simsimd_distance_t bias,
+                                         simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_pq_scan_u4x2_sve(codes, count, subspaces, table, scale, bias, results);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_pq_scan_u4x2_neon(codes, count, subspaces, table, scale, bias, results);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_pq_scan_u4x2_skylake(codes, count, subspaces, table, scale, bias, results);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_pq_scan_u4x2_haswell(codes, count, subspaces, table, scale, bias, results);
+#else
+    simsimd_pq_scan_u4x2_serial(codes, count, subspaces, table, scale, bias, results);
+#endif
+}
+
+/*  Binary distances
+ *  - Hamming distance: the number of positions at which the corresponding bits are different.
+ *  - Jaccard distance: ratio of bit-level matching positions (intersection) to the total number of positions (union).
+ *
+ *  @param a The first binary vector.
+ *  @param b The second binary vector.
+ *  @param n The number of 8-bit words in the vectors.
+ *  @param d The output distance value.
+ *
+ *  @note The output distance value is non-negative.
+ *  @note The output distance value is zero if and only if the two vectors are identical.
+ *  @note Defined only for binary data.
+ */
+SIMSIMD_PUBLIC void simsimd_hamming_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t n,
+                                       simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_hamming_b8_sve(a, b, n, d);
 #elif SIMSIMD_TARGET_NEON
     simsimd_hamming_b8_neon(a, b, n, d);
 #elif SIMSIMD_TARGET_ICE
@@ -2081,6 +6165,97 @@ SIMSIMD_PUBLIC void simsimd_spdot_weights_u16(simsimd_u16_t const *a, simsimd_u1
 #endif
 }
 
+SIMSIMD_PUBLIC void simsimd_spdot_weights_u32(simsimd_u32_t const *a, simsimd_u32_t const *b,
+                                              simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights,
+                                              simsimd_size_t a_length, simsimd_size_t b_length, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE2
+    simsimd_spdot_weights_u32_sve2(a, b, a_weights, b_weights, a_length, b_length, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_spdot_weights_u32_neon(a, b, a_weights, b_weights, a_length, b_length, d);
+#elif SIMSIMD_TARGET_TURIN
+    simsimd_spdot_weights_u32_turin(a, b, a_weights, b_weights, a_length, b_length, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_spdot_weights_u32_ice(a, b, a_weights, b_weights, a_length, b_length, d);
+#else
+    simsimd_spdot_weights_u32_serial(a, b, a_weights, b_weights, a_length, b_length, d);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_spdot_weights_f32_u32(simsimd_u32_t const *a, simsimd_u32_t const *b,
+                                                  simsimd_f32_t const *a_weights, simsimd_f32_t const *b_weights,
+                                                  simsimd_size_t a_length, simsimd_size_t b_length,
+                                                  simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE2
+    simsimd_spdot_weights_f32_u32_sve2(a, b, a_weights, b_weights, a_length, b_length, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_spdot_weights_f32_u32_neon(a, b, a_weights, b_weights, a_length, b_length, d);
+#elif SIMSIMD_TARGET_TURIN
+    simsimd_spdot_weights_f32_u32_turin(a, b, a_weights, b_weights, a_length, b_length, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_spdot_weights_f32_u32_ice(a, b, a_weights, b_weights, a_length, b_length, d);
+#else
+    simsimd_spdot_weights_f32_u32_serial(a, b, a_weights, b_weights, a_length, b_length, d);
+#endif
+}
+
+/*  Batched set operations of one query against many documents
+ *
+ *  @param a The sorted query indices.
+ *  @param a_weights The query weights.
+ *  @param a_length The number of elements in the query.
+ *  @param b The concatenated sorted indices of all documents.
+ *  @param b_weights The concatenated weights of all documents.
+ *  @param b_offsets The offsets of the documents in `b`, with `b_count + 1` entries.
+ *  @param b_count The number of documents.
+ *  @param d The output array of `b_count` intersection sizes or weighted products.
+ */
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u16(simsimd_u16_t const *a, simsimd_size_t a_length,
+                                                simsimd_u16_t const *b, simsimd_size_t const *b_offsets,
+                                                simsimd_size_t b_count, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE2
+    simsimd_intersect_batch_u16_sve2(a, a_length, b, b_offsets, b_count, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_intersect_batch_u16_neon(a, a_length, b, b_offsets, b_count, d);
+#elif SIMSIMD_TARGET_TURIN
+    simsimd_intersect_batch_u16_turin(a, a_length, b, b_offsets, b_count, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_intersect_batch_u16_ice(a, a_length, b, b_offsets, b_count, d);
+#else
+    simsimd_intersect_batch_u16_serial(a, a_length, b, b_offsets, b_count, d);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u32(simsimd_u32_t const *a, simsimd_size_t a_length,
+                                                simsimd_u32_t const *b, simsimd_size_t const *b_offsets,
+                                                simsimd_size_t b_count, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE2
+    simsimd_intersect_batch_u32_sve2(a, a_length, b, b_offsets, b_count, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_intersect_batch_u32_neon(a, a_length, b, b_offsets, b_count, d);
+#elif SIMSIMD_TARGET_TURIN
+    simsimd_intersect_batch_u32_turin(a, a_length, b, b_offsets, b_count, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_intersect_batch_u32_ice(a, a_length, b, b_offsets, b_count, d);
+#else
+    simsimd_intersect_batch_u32_serial(a, a_length, b, b_offsets, b_count, d);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_spdot_weights_batch_u16(simsimd_u16_t const *a, simsimd_bf16_t const *a_weights,
+                                                    simsimd_size_t a_length, simsimd_u16_t const *b,
+                                                    simsimd_bf16_t const *b_weights, simsimd_size_t const *b_offsets,
+                                                    simsimd_size_t b_count, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE2
+    simsimd_spdot_weights_batch_u16_sve2(a, a_weights, a_length, b, b_weights, b_offsets, b_count, d);
+#elif SIMSIMD_TARGET_TURIN
+    simsimd_spdot_weights_batch_u16_turin(a, a_weights, a_length, b, b_weights, b_offsets, b_count, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_spdot_weights_batch_u16_ice(a, a_weights, a_length, b, b_weights, b_offsets, b_count, d);
+#else
+    simsimd_spdot_weights_batch_u16_serial(a, a_weights, a_length, b, b_weights, b_offsets, b_count, d);
+#endif
+}
+
 /*  Curved space distances
  *
  *  @param a The first vector of floating point values.
@@ -2167,6 +6342,38 @@ SIMSIMD_PUBLIC void simsimd_mahalanobis_bf16(simsimd_bf16_t const *a, simsimd_bf
 #endif
 }
 
+/*  Curved space distances in batches
+ *
+ *  @param vectors The rows to project by the factor `l` of the metric tensor `l * l^T`.
+ *  @param l The `n` by `n` factor of the metric tensor, like its Cholesky decomposition.
+ *  @param whitened The output rows, `l^T * vector` for every input row.
+ *  @param c The metric tensor for the bilinear forms of all pairs of rows of `a` and `b`.
+ *  @param d The output `a_count` by `b_count` matrix of bilinear forms.
+ */
+SIMSIMD_PUBLIC void simsimd_whiten_f32(simsimd_f32_t const *vectors, simsimd_size_t count, simsimd_size_t stride,
+                                       simsimd_f32_t const *l, simsimd_size_t n, simsimd_f32_t *whitened,
+                                       simsimd_size_t whitened_stride) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_whiten_f32_skylake(vectors, count, stride, l, n, whitened, whitened_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_whiten_f32_neon(vectors, count, stride, l, n, whitened, whitened_stride);
+#else
+    simsimd_whiten_f32_serial(vectors, count, stride, l, n, whitened, whitened_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_bilinear_cdist_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                               simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                               simsimd_f32_t const *c, simsimd_size_t n, simsimd_distance_t *d,
+                                               simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_bilinear_cdist_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, c, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_bilinear_cdist_f32_neon(a, b, a_count, a_stride, b_count, b_stride, c, n, d, d_stride);
+#else
+    simsimd_bilinear_cdist_f32_serial(a, b, a_count, a_stride, b_count, b_stride, c, n, d, d_stride);
+#endif
+}
+
 /*  Elementwise operations
  *
  *  @param a The first vector of integral or floating point values.
@@ -2335,6 +6542,2059 @@ SIMSIMD_PUBLIC void simsimd_fma_u8(simsimd_u8_t const *a, simsimd_u8_t const *b,
 #endif
 }
 
+/*  Element-wise kernels
+ *
+ *  @param a The first vector of integral or floating point values, or of `f32` values for the `quantize` kernels.
+ *  @param b The second vector of integral or floating point values.
+ *  @param n The number of dimensions in the vectors.
+ *  @param alpha The scaling factor.
+ *  @param beta The shift added after scaling.
+ *  @param r The output vector, which may be `a` or `b` itself, or of `f32` values for the `dequantize` kernels.
+ */
+SIMSIMD_PUBLIC void simsimd_scale_f64(simsimd_f64_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                      simsimd_distance_t beta, simsimd_f64_t *r) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_scale_f64_skylake(a, n, alpha, beta, r);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_scale_f64_haswell(a, n, alpha, beta, r);
+#else
+    simsimd_scale_f64_serial(a, n, alpha, beta, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f32(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                      simsimd_distance_t beta, simsimd_f32_t *r) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_scale_f32_skylake(a, n, alpha, beta, r);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_scale_f32_haswell(a, n, alpha, beta, r);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_scale_f32_neon(a, n, alpha, beta, r);
+#else
+    simsimd_scale_f32_serial(a, n, alpha, beta, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f16(simsimd_f16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                      simsimd_distance_t beta, simsimd_f16_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_scale_f16_haswell(a, n, alpha, beta, r);
+#else
+    simsimd_scale_f16_serial(a, n, alpha, beta, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_bf16(simsimd_bf16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                       simsimd_distance_t beta, simsimd_bf16_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_scale_bf16_haswell(a, n, alpha, beta, r);
+#else
+    simsimd_scale_bf16_serial(a, n, alpha, beta, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_i8(simsimd_i8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                     simsimd_distance_t beta, simsimd_i8_t *r) {
+    simsimd_scale_i8_serial(a, n, alpha, beta, r);
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_u8(simsimd_u8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                     simsimd_distance_t beta, simsimd_u8_t *r) {
+    simsimd_scale_u8_serial(a, n, alpha, beta, r);
+}
+
+SIMSIMD_PUBLIC void simsimd_add_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                    simsimd_f64_t *r) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_add_f64_skylake(a, b, n, r);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_add_f64_haswell(a, b, n, r);
+#else
+    simsimd_add_f64_serial(a, b, n, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_add_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                    simsimd_f32_t *r) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_add_f32_skylake(a, b, n, r);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_add_f32_haswell(a, b, n, r);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_add_f32_neon(a, b, n, r);
+#else
+    simsimd_add_f32_serial(a, b, n, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_add_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
+                                    simsimd_f16_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_add_f16_haswell(a, b, n, r);
+#else
+    simsimd_add_f16_serial(a, b, n, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_add_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
+                                     simsimd_bf16_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_add_bf16_haswell(a, b, n, r);
+#else
+    simsimd_add_bf16_serial(a, b, n, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_add_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t n, simsimd_i8_t *r) {
+    simsimd_add_i8_serial(a, b, n, r);
+}
+
+SIMSIMD_PUBLIC void simsimd_add_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n, simsimd_u8_t *r) {
+    simsimd_add_u8_serial(a, b, n, r);
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                         simsimd_f64_t *r) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_multiply_f64_skylake(a, b, n, r);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_multiply_f64_haswell(a, b, n, r);
+#else
+    simsimd_multiply_f64_serial(a, b, n, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                         simsimd_f32_t *r) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_multiply_f32_skylake(a, b, n, r);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_multiply_f32_haswell(a, b, n, r);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_multiply_f32_neon(a, b, n, r);
+#else
+    simsimd_multiply_f32_serial(a, b, n, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
+                                         simsimd_f16_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_multiply_f16_haswell(a, b, n, r);
+#else
+    simsimd_multiply_f16_serial(a, b, n, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
+                                          simsimd_bf16_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_multiply_bf16_haswell(a, b, n, r);
+#else
+    simsimd_multiply_bf16_serial(a, b, n, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t n,
+                                        simsimd_i8_t *r) {
+    simsimd_multiply_i8_serial(a, b, n, r);
+}
+
+SIMSIMD_PUBLIC void simsimd_multiply_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
+                                        simsimd_u8_t *r) {
+    simsimd_multiply_u8_serial(a, b, n, r);
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_f16(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                         simsimd_f16_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_quantize_f16_haswell(a, n, alpha, r);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_quantize_f16_neon(a, n, alpha, r);
+#else
+    simsimd_quantize_f16_serial(a, n, alpha, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_bf16(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                          simsimd_bf16_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_quantize_bf16_haswell(a, n, alpha, r);
+#else
+    simsimd_quantize_bf16_serial(a, n, alpha, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_i8(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                        simsimd_i8_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_quantize_i8_haswell(a, n, alpha, r);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_quantize_i8_neon(a, n, alpha, r);
+#else
+    simsimd_quantize_i8_serial(a, n, alpha, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_u8(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                        simsimd_u8_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_quantize_u8_haswell(a, n, alpha, r);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_quantize_u8_neon(a, n, alpha, r);
+#else
+    simsimd_quantize_u8_serial(a, n, alpha, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_b8(simsimd_f32_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                        simsimd_b8_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_quantize_b8_haswell(a, n, alpha, r);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_quantize_b8_neon(a, n, alpha, r);
+#else
+    simsimd_quantize_b8_serial(a, n, alpha, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_f16(simsimd_f16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                           simsimd_f32_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_dequantize_f16_haswell(a, n, alpha, r);
+#elif SIMSIMD_TARGET_NEON_F16
+    simsimd_dequantize_f16_neon(a, n, alpha, r);
+#else
+    simsimd_dequantize_f16_serial(a, n, alpha, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_bf16(simsimd_bf16_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                            simsimd_f32_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_dequantize_bf16_haswell(a, n, alpha, r);
+#else
+    simsimd_dequantize_bf16_serial(a, n, alpha, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_i8(simsimd_i8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                          simsimd_f32_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_dequantize_i8_haswell(a, n, alpha, r);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dequantize_i8_neon(a, n, alpha, r);
+#else
+    simsimd_dequantize_i8_serial(a, n, alpha, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_u8(simsimd_u8_t const *a, simsimd_size_t n, simsimd_distance_t alpha,
+                                          simsimd_f32_t *r) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_dequantize_u8_haswell(a, n, alpha, r);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dequantize_u8_neon(a, n, alpha, r);
+#else
+    simsimd_dequantize_u8_serial(a, n, alpha, r);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_sum_i8_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_sum_i8_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_sum_u8_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_sum_u8_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_sum_f16_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_sum_f16_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_sum_bf16_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_sum_bf16_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_reduce_sum_f32_neon(rows, count, stride, n, results);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_reduce_sum_f32_skylake(rows, count, stride, n, results);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_sum_f32_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_sum_f32_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_sum_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_reduce_sum_f64_skylake(rows, count, stride, n, results);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_sum_f64_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_sum_f64_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                         simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l1_i8_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l1_i8_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                         simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l1_u8_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l1_u8_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l1_f16_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l1_f16_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l1_bf16_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l1_bf16_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_reduce_l1_f32_neon(rows, count, stride, n, results);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_reduce_l1_f32_skylake(rows, count, stride, n, results);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l1_f32_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l1_f32_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l1_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_reduce_l1_f64_skylake(rows, count, stride, n, results);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l1_f64_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l1_f64_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l2_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                         simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l2_i8_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l2_i8_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l2_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                         simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l2_u8_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l2_u8_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l2_f16_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l2_f16_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l2_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l2_bf16_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l2_bf16_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_reduce_l2_f32_neon(rows, count, stride, n, results);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_reduce_l2_f32_skylake(rows, count, stride, n, results);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l2_f32_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l2_f32_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_l2_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_reduce_l2_f64_skylake(rows, count, stride, n, results);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_l2_f64_haswell(rows, count, stride, n, results);
+#else
+    simsimd_reduce_l2_f64_serial(rows, count, stride, n, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_min_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_min_i8_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_min_i8_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_min_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_min_u8_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_min_u8_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_min_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_min_f16_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_min_f16_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_min_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_min_bf16_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_min_bf16_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_min_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_reduce_min_f32_neon(rows, count, stride, n, values, indices);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_reduce_min_f32_skylake(rows, count, stride, n, values, indices);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_min_f32_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_min_f32_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_min_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_reduce_min_f64_skylake(rows, count, stride, n, values, indices);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_min_f64_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_min_f64_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_max_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_max_i8_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_max_i8_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_max_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                          simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_max_u8_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_max_u8_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_max_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_max_f16_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_max_f16_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_max_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                            simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_max_bf16_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_max_bf16_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_max_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_reduce_max_f32_neon(rows, count, stride, n, values, indices);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_reduce_max_f32_skylake(rows, count, stride, n, values, indices);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_max_f32_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_max_f32_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_reduce_max_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                           simsimd_size_t n, simsimd_distance_t *values, simsimd_size_t *indices) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_reduce_max_f64_skylake(rows, count, stride, n, values, indices);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_reduce_max_f64_haswell(rows, count, stride, n, values, indices);
+#else
+    simsimd_reduce_max_f64_serial(rows, count, stride, n, values, indices);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_levenshtein_batch_u8(simsimd_u8_t const *a, simsimd_size_t a_length, simsimd_u8_t const *b,
+                                                 simsimd_size_t const *b_lengths, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t bound,
+                                                 simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_ICE
+    simsimd_levenshtein_batch_u8_ice(a, a_length, b, b_lengths, b_count, b_stride, bound, results);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_levenshtein_batch_u8_neon(a, a_length, b, b_lengths, b_count, b_stride, bound, results);
+#else
+    simsimd_levenshtein_batch_u8_serial(a, a_length, b, b_lengths, b_count, b_stride, bound, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_needleman_wunsch_batch_u8(simsimd_u8_t const *a, simsimd_size_t a_length,
+                                                      simsimd_u8_t const *b, simsimd_size_t const *b_lengths,
+                                                      simsimd_size_t b_count, simsimd_size_t b_stride,
+                                                      simsimd_i32_t match, simsimd_i32_t mismatch, simsimd_i32_t gap,
+                                                      simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_ICE
+    simsimd_needleman_wunsch_batch_u8_ice(a, a_length, b, b_lengths, b_count, b_stride, match, mismatch, gap, results);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_needleman_wunsch_batch_u8_neon(a, a_length, b, b_lengths, b_count, b_stride, match, mismatch, gap, results);
+#else
+    simsimd_needleman_wunsch_batch_u8_serial(a, a_length, b, b_lengths, b_count, b_stride, match, mismatch, gap,
+                                             results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_smith_waterman_batch_u8(simsimd_u8_t const *a, simsimd_size_t a_length,
+                                                    simsimd_u8_t const *b, simsimd_size_t const *b_lengths,
+                                                    simsimd_size_t b_count, simsimd_size_t b_stride,
+                                                    simsimd_i32_t match, simsimd_i32_t mismatch, simsimd_i32_t gap,
+                                                    simsimd_distance_t *results) {
+#if SIMSIMD_TARGET_ICE
+    simsimd_smith_waterman_batch_u8_ice(a, a_length, b, b_lengths, b_count, b_stride, match, mismatch, gap, results);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_smith_waterman_batch_u8_neon(a, a_length, b, b_lengths, b_count, b_stride, match, mismatch, gap, results);
+#else
+    simsimd_smith_waterman_batch_u8_serial(a, a_length, b, b_lengths, b_count, b_stride, match, mismatch, gap, results);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_batch_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                         simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_dot_batch_i8_sve(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_dot_batch_i8_ice(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_dot_batch_i8_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_batch_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                         simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_dot_batch_u8_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_dot_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_dot_batch_f16_sve2p1(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_dot_batch_f16_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_dot_batch_bf16_sve(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_dot_batch_bf16_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_dot_batch_f32_sve(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dot_batch_f32_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_batch_f32_skylake(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_batch_f32_haswell(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_dot_batch_f32_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_dot_batch_f64_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                         simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_ICE
+    simsimd_cos_batch_i8_ice(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_cos_batch_i8_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                         simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_cos_batch_u8_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_cos_batch_f16_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_cos_batch_bf16_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_cos_batch_f32_sve(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_batch_f32_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_batch_f32_skylake(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_batch_f32_haswell(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_cos_batch_f32_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_cos_batch_f64_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_ICE
+    simsimd_l2sq_batch_i8_ice(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_l2sq_batch_i8_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_l2sq_batch_u8_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_l2sq_batch_f16_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                            simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_l2sq_batch_bf16_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2sq_batch_f32_sve(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_batch_f32_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_batch_f32_skylake(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_batch_f32_haswell(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_l2sq_batch_f32_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_l2sq_batch_f64_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                        simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_ICE
+    simsimd_l2_batch_i8_ice(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_l2_batch_i8_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                        simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_l2_batch_u8_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                         simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_l2_batch_f16_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                          simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_l2_batch_bf16_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                         simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2_batch_f32_sve(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_batch_f32_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_batch_f32_skylake(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_batch_f32_haswell(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_l2_batch_f32_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                         simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+    simsimd_l2_batch_f64_serial(a, b, b_count, b_stride, n, d);
+}
+SIMSIMD_PUBLIC void simsimd_hamming_batch_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                             simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_hamming_batch_b8_sve(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_hamming_batch_b8_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_hamming_batch_b8_ice(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_hamming_batch_b8_haswell(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_hamming_batch_b8_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_jaccard_batch_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                             simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_jaccard_batch_b8_sve(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_jaccard_batch_b8_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_jaccard_batch_b8_ice(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_jaccard_batch_b8_haswell(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_jaccard_batch_b8_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_cdist_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                         simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                         simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE_I8
+    simsimd_dot_cdist_i8_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_dot_cdist_i8_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_dot_cdist_i8_ice(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_dot_cdist_i8_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                          simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                          simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_dot_cdist_f16_sve2p1(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SVE
+    simsimd_dot_cdist_f16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dot_cdist_f16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_cdist_f16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_cdist_f16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_dot_cdist_f16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_cdist_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t a_count,
+                                           simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                           simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_dot_cdist_bf16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dot_cdist_bf16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_dot_cdist_bf16_genoa(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_cdist_bf16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_cdist_bf16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_dot_cdist_bf16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_cdist_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                          simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                          simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_dot_cdist_f32_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dot_cdist_f32_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_cdist_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_cdist_f32_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_dot_cdist_f32_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                         simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                         simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE_I8
+    simsimd_cos_cdist_i8_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_cos_cdist_i8_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_cos_cdist_i8_ice(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_cos_cdist_i8_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                          simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                          simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_cos_cdist_f16_sve2p1(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SVE
+    simsimd_cos_cdist_f16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_cdist_f16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_cdist_f16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_cdist_f16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_cos_cdist_f16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t a_count,
+                                           simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                           simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_cos_cdist_bf16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_cdist_bf16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_cos_cdist_bf16_genoa(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_cdist_bf16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_cdist_bf16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_cos_cdist_bf16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                          simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                          simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_cos_cdist_f32_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_cdist_f32_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_cdist_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_cdist_f32_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_cos_cdist_f32_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                          simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                          simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE_I8
+    simsimd_l2sq_cdist_i8_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_l2sq_cdist_i8_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_l2sq_cdist_i8_ice(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_l2sq_cdist_i8_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                           simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                           simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_l2sq_cdist_f16_sve2p1(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SVE
+    simsimd_l2sq_cdist_f16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_cdist_f16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_cdist_f16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_cdist_f16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_l2sq_cdist_f16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t a_count,
+                                            simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                            simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_l2sq_cdist_bf16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_cdist_bf16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_l2sq_cdist_bf16_genoa(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_cdist_bf16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_cdist_bf16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_l2sq_cdist_bf16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                           simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                           simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2sq_cdist_f32_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_cdist_f32_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_cdist_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_cdist_f32_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_l2sq_cdist_f32_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                        simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                        simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE_I8
+    simsimd_l2_cdist_i8_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_l2_cdist_i8_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_l2_cdist_i8_ice(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_l2_cdist_i8_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                         simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                         simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_l2_cdist_f16_sve2p1(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SVE
+    simsimd_l2_cdist_f16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_cdist_f16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_cdist_f16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_cdist_f16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_l2_cdist_f16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t a_count,
+                                          simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                          simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_l2_cdist_bf16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_cdist_bf16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_l2_cdist_bf16_genoa(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_cdist_bf16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_cdist_bf16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_l2_cdist_bf16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                         simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                         simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2_cdist_f32_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_cdist_f32_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_cdist_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_cdist_f32_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_l2_cdist_f32_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                               simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                               simsimd_size_t n, void *d, simsimd_size_t d_stride,
+                                               simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_I8
+    simsimd_dot_cdist_typed_i8_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_dot_cdist_typed_i8_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_dot_cdist_typed_i8_ice(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_dot_cdist_typed_i8_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_dot_cdist_typed_f16_sve2p1(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SVE
+    simsimd_dot_cdist_typed_f16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dot_cdist_typed_f16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_cdist_typed_f16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_cdist_typed_f16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_dot_cdist_typed_f16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                 simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                 simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                 void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_dot_cdist_typed_bf16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dot_cdist_typed_bf16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_dot_cdist_typed_bf16_genoa(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_cdist_typed_bf16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_cdist_typed_bf16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_dot_cdist_typed_bf16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_dot_cdist_typed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_dot_cdist_typed_f32_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_dot_cdist_typed_f32_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_dot_cdist_typed_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_cdist_typed_f32_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_dot_cdist_typed_f32_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                               simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                               simsimd_size_t n, void *d, simsimd_size_t d_stride,
+                                               simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_I8
+    simsimd_cos_cdist_typed_i8_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_cos_cdist_typed_i8_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_cos_cdist_typed_i8_ice(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_cos_cdist_typed_i8_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_cos_cdist_typed_f16_sve2p1(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SVE
+    simsimd_cos_cdist_typed_f16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_cdist_typed_f16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_cdist_typed_f16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_cdist_typed_f16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_cos_cdist_typed_f16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                 simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                 simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                 void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_cos_cdist_typed_bf16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_cdist_typed_bf16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_cos_cdist_typed_bf16_genoa(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_cdist_typed_bf16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_cdist_typed_bf16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_cos_cdist_typed_bf16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_typed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_cos_cdist_typed_f32_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_cdist_typed_f32_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_cdist_typed_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_cdist_typed_f32_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_cos_cdist_typed_f32_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_I8
+    simsimd_l2sq_cdist_typed_i8_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_l2sq_cdist_typed_i8_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_l2sq_cdist_typed_i8_ice(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_l2sq_cdist_typed_i8_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                 simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_l2sq_cdist_typed_f16_sve2p1(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SVE
+    simsimd_l2sq_cdist_typed_f16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_cdist_typed_f16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_cdist_typed_f16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_cdist_typed_f16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_l2sq_cdist_typed_f16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                  simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_l2sq_cdist_typed_bf16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_cdist_typed_bf16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_l2sq_cdist_typed_bf16_genoa(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_cdist_typed_bf16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_cdist_typed_bf16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_l2sq_cdist_typed_bf16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_typed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                 simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2sq_cdist_typed_f32_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_cdist_typed_f32_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_cdist_typed_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_cdist_typed_f32_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_l2sq_cdist_typed_f32_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                              simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                              simsimd_size_t n, void *d, simsimd_size_t d_stride,
+                                              simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_I8
+    simsimd_l2_cdist_typed_i8_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_l2_cdist_typed_i8_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_l2_cdist_typed_i8_ice(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_l2_cdist_typed_i8_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                               simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                               simsimd_size_t n, void *d, simsimd_size_t d_stride,
+                                               simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_l2_cdist_typed_f16_sve2p1(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SVE
+    simsimd_l2_cdist_typed_f16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_cdist_typed_f16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_cdist_typed_f16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_cdist_typed_f16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_l2_cdist_typed_f16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                simsimd_size_t a_count, simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n, void *d,
+                                                simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_l2_cdist_typed_bf16_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_cdist_typed_bf16_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_l2_cdist_typed_bf16_genoa(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_cdist_typed_bf16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_cdist_typed_bf16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_l2_cdist_typed_bf16_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_typed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                               simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                               simsimd_size_t n, void *d, simsimd_size_t d_stride,
+                                               simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2_cdist_typed_f32_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_cdist_typed_f32_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_cdist_typed_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_cdist_typed_f32_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#else
+    simsimd_l2_cdist_typed_f32_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride, d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_hamming_cdist_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t a_count,
+                                             simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                             simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_hamming_cdist_b8_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_hamming_cdist_b8_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_hamming_cdist_b8_ice(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_hamming_cdist_b8_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_hamming_cdist_b8_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_jaccard_cdist_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t a_count,
+                                             simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                             simsimd_size_t n, simsimd_distance_t *d, simsimd_size_t d_stride) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_jaccard_cdist_b8_sve(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_jaccard_cdist_b8_neon(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_jaccard_cdist_b8_ice(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_jaccard_cdist_b8_haswell(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#else
+    simsimd_jaccard_cdist_b8_serial(a, b, a_count, a_stride, b_count, b_stride, n, d, d_stride);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_norms_i8(simsimd_i8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                     simsimd_size_t n, simsimd_distance_t *norms) {
+#if SIMSIMD_TARGET_ICE
+    simsimd_norms_i8_ice(rows, count, stride, n, norms);
+#else
+    simsimd_norms_i8_serial(rows, count, stride, n, norms);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_norms_u8(simsimd_u8_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                     simsimd_size_t n, simsimd_distance_t *norms) {
+    simsimd_norms_u8_serial(rows, count, stride, n, norms);
+}
+SIMSIMD_PUBLIC void simsimd_norms_f16(simsimd_f16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                      simsimd_size_t n, simsimd_distance_t *norms) {
+    simsimd_norms_f16_serial(rows, count, stride, n, norms);
+}
+SIMSIMD_PUBLIC void simsimd_norms_bf16(simsimd_bf16_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                       simsimd_size_t n, simsimd_distance_t *norms) {
+    simsimd_norms_bf16_serial(rows, count, stride, n, norms);
+}
+SIMSIMD_PUBLIC void simsimd_norms_f32(simsimd_f32_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                      simsimd_size_t n, simsimd_distance_t *norms) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_norms_f32_sve(rows, count, stride, n, norms);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_norms_f32_neon(rows, count, stride, n, norms);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_norms_f32_skylake(rows, count, stride, n, norms);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_norms_f32_haswell(rows, count, stride, n, norms);
+#else
+    simsimd_norms_f32_serial(rows, count, stride, n, norms);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_norms_f64(simsimd_f64_t const *rows, simsimd_size_t count, simsimd_size_t stride,
+                                      simsimd_size_t n, simsimd_distance_t *norms) {
+    simsimd_norms_f64_serial(rows, count, stride, n, norms);
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_ICE
+    simsimd_cos_batch_normed_i8_ice(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#else
+    simsimd_cos_batch_normed_i8_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                simsimd_distance_t *d) {
+    simsimd_cos_batch_normed_u8_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                 simsimd_distance_t *d) {
+    simsimd_cos_batch_normed_f16_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                  simsimd_distance_t *d) {
+    simsimd_cos_batch_normed_bf16_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                 simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_cos_batch_normed_f32_sve(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_batch_normed_f32_neon(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_batch_normed_f32_skylake(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_batch_normed_f32_haswell(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#else
+    simsimd_cos_batch_normed_f32_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                 simsimd_distance_t *d) {
+    simsimd_cos_batch_normed_f64_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                 simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_ICE
+    simsimd_l2sq_batch_normed_i8_ice(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#else
+    simsimd_l2sq_batch_normed_i8_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                 simsimd_distance_t *d) {
+    simsimd_l2sq_batch_normed_u8_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                  simsimd_distance_t *d) {
+    simsimd_l2sq_batch_normed_f16_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                   simsimd_distance_t *d) {
+    simsimd_l2sq_batch_normed_bf16_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                  simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2sq_batch_normed_f32_sve(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_batch_normed_f32_neon(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_batch_normed_f32_skylake(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_batch_normed_f32_haswell(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#else
+    simsimd_l2sq_batch_normed_f32_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_f64(simsimd_f64_t const *a, simsimd_f64_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                  simsimd_distance_t *d) {
+    simsimd_l2sq_batch_normed_f64_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                               simsimd_size_t b_stride, simsimd_size_t n,
+                                               simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                               simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_ICE
+    simsimd_l2_batch_normed_i8_ice(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#else
+    simsimd_l2_batch_normed_i8_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_u8(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t b_count,
+                                               simsimd_size_t b_stride, simsimd_size_t n,
+                                               simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                               simsimd_distance_t *d) {
+    simsimd_l2_batch_normed_u8_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                simsimd_distance_t *d) {
+    simsimd_l2_batch_normed_f16_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                 simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                 simsimd_distance_t *d) {
+    simsimd_l2_batch_normed_bf16_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2_batch_normed_f32_sve(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_batch_normed_f32_neon(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_batch_normed_f32_skylake(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_batch_normed_f32_haswell(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#else
+    simsimd_l2_batch_normed_f32_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t const *a_norm, simsimd_distance_t const *b_norms,
+                                                simsimd_distance_t *d) {
+    simsimd_l2_batch_normed_f64_serial(a, b, b_count, b_stride, n, a_norm, b_norms, d);
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_I8
+    simsimd_cos_cdist_normed_i8_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                    d_type);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_cos_cdist_normed_i8_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                     d_type);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_cos_cdist_normed_i8_ice(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                    d_type);
+#else
+    simsimd_cos_cdist_normed_i8_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                       d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                 void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_cos_cdist_normed_f16_sve2p1(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                        d_type);
+#elif SIMSIMD_TARGET_SVE
+    simsimd_cos_cdist_normed_f16_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                     d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_cdist_normed_f16_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                      d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_cdist_normed_f16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                         d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_cdist_normed_f16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                         d_type);
+#else
+    simsimd_cos_cdist_normed_f16_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                        d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                  simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_cos_cdist_normed_bf16_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                      d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_cdist_normed_bf16_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                       d_type);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_cos_cdist_normed_bf16_genoa(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                        d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_cdist_normed_bf16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                          d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_cdist_normed_bf16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                          d_type);
+#else
+    simsimd_cos_cdist_normed_bf16_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                         d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_cos_cdist_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                 void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_cos_cdist_normed_f32_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                     d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_cos_cdist_normed_f32_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                      d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_cos_cdist_normed_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                         d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_cos_cdist_normed_f32_haswell(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                         d_type);
+#else
+    simsimd_cos_cdist_normed_f32_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                        d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                                 simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                 simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                 void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_I8
+    simsimd_l2sq_cdist_normed_i8_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                     d_type);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_l2sq_cdist_normed_i8_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                      d_type);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_l2sq_cdist_normed_i8_ice(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                     d_type);
+#else
+    simsimd_l2sq_cdist_normed_i8_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                        d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b,
+                                                  simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_l2sq_cdist_normed_f16_sve2p1(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                         d_type);
+#elif SIMSIMD_TARGET_SVE
+    simsimd_l2sq_cdist_normed_f16_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                      d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_cdist_normed_f16_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                       d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_cdist_normed_f16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                          d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_cdist_normed_f16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                          d_type);
+#else
+    simsimd_l2sq_cdist_normed_f16_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                         d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                   simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                   void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_l2sq_cdist_normed_bf16_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                       d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_cdist_normed_bf16_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                        d_type);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_l2sq_cdist_normed_bf16_genoa(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                         d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_cdist_normed_bf16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                           d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_cdist_normed_bf16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                           d_type);
+#else
+    simsimd_l2sq_cdist_normed_bf16_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                          d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_cdist_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                  simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                  void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2sq_cdist_normed_f32_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                      d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2sq_cdist_normed_f32_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                       d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2sq_cdist_normed_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                          d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2sq_cdist_normed_f32_haswell(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                          d_type);
+#else
+    simsimd_l2sq_cdist_normed_f32_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                         d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_i8(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t a_count,
+                                               simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride,
+                                               simsimd_size_t n, simsimd_distance_t const *a_norms,
+                                               simsimd_distance_t const *b_norms, void *d, simsimd_size_t d_stride,
+                                               simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_I8
+    simsimd_l2_cdist_normed_i8_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                   d_type);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_l2_cdist_normed_i8_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                    d_type);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_l2_cdist_normed_i8_ice(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                   d_type);
+#else
+    simsimd_l2_cdist_normed_i8_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                      d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE2P1
+    simsimd_l2_cdist_normed_f16_sve2p1(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                       d_type);
+#elif SIMSIMD_TARGET_SVE
+    simsimd_l2_cdist_normed_f16_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                    d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_cdist_normed_f16_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                     d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_cdist_normed_f16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                        d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_cdist_normed_f16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                        d_type);
+#else
+    simsimd_l2_cdist_normed_f16_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                       d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b,
+                                                 simsimd_size_t a_count, simsimd_size_t a_stride,
+                                                 simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                 void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE_BF16
+    simsimd_l2_cdist_normed_bf16_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                     d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_cdist_normed_bf16_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                      d_type);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_l2_cdist_normed_bf16_genoa(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                       d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_cdist_normed_bf16_skylake(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                         d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_cdist_normed_bf16_haswell(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                         d_type);
+#else
+    simsimd_l2_cdist_normed_bf16_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                        d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_l2_cdist_normed_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                                                simsimd_size_t a_stride, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t const *a_norms, simsimd_distance_t const *b_norms,
+                                                void *d, simsimd_size_t d_stride, simsimd_datatype_t d_type) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2_cdist_normed_f32_sve(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                    d_type);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_l2_cdist_normed_f32_neon(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                     d_type);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_l2_cdist_normed_f32_skylake(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                        d_type);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_l2_cdist_normed_f32_haswell(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                        d_type);
+#else
+    simsimd_l2_cdist_normed_f32_serial(a, b, a_count, a_stride, b_count, b_stride, n, a_norms, b_norms, d, d_stride,
+                                       d_type);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_hamming_radius_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t radius,
+                                              simsimd_size_t *ids, simsimd_distance_t *distances,
+                                              simsimd_size_t *found) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_hamming_radius_b8_sve(a, b, b_count, b_stride, n, radius, ids, distances, found);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_hamming_radius_b8_neon(a, b, b_count, b_stride, n, radius, ids, distances, found);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_hamming_radius_b8_ice(a, b, b_count, b_stride, n, radius, ids, distances, found);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_hamming_radius_b8_haswell(a, b, b_count, b_stride, n, radius, ids, distances, found);
+#else
+    simsimd_hamming_radius_b8_serial(a, b, b_count, b_stride, n, radius, ids, distances, found);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_jaccard_radius_b8(simsimd_b8_t const *a, simsimd_b8_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t radius,
+                                              simsimd_size_t *ids, simsimd_distance_t *distances,
+                                              simsimd_size_t *found) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_jaccard_radius_b8_sve(a, b, b_count, b_stride, n, radius, ids, distances, found);
+#elif SIMSIMD_TARGET_NEON
+    simsimd_jaccard_radius_b8_neon(a, b, b_count, b_stride, n, radius, ids, distances, found);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_jaccard_radius_b8_ice(a, b, b_count, b_stride, n, radius, ids, distances, found);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_jaccard_radius_b8_haswell(a, b, b_count, b_stride, n, radius, ids, distances, found);
+#else
+    simsimd_jaccard_radius_b8_serial(a, b, b_count, b_stride, n, radius, ids, distances, found);
+#endif
+}
+
+SIMSIMD_PUBLIC void simsimd_haversine_f64(simsimd_f64_t const *a_lats, simsimd_f64_t const *a_lons,
+                                          simsimd_f64_t const *b_lats, simsimd_f64_t const *b_lons,
+                                          simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_haversine_f64_neon(a_lats, a_lons, b_lats, b_lons, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_haversine_f64_haswell(a_lats, a_lons, b_lats, b_lons, n, d);
+#else
+    simsimd_haversine_f64_serial(a_lats, a_lons, b_lats, b_lons, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_haversine_f32(simsimd_f32_t const *a_lats, simsimd_f32_t const *a_lons,
+                                          simsimd_f32_t const *b_lats, simsimd_f32_t const *b_lons,
+                                          simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_haversine_f32_neon(a_lats, a_lons, b_lats, b_lons, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_haversine_f32_haswell(a_lats, a_lons, b_lats, b_lons, n, d);
+#else
+    simsimd_haversine_f32_serial(a_lats, a_lons, b_lats, b_lons, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_hav_f64(simsimd_f64_t const *a_lats, simsimd_f64_t const *a_lons,
+                                    simsimd_f64_t const *b_lats, simsimd_f64_t const *b_lons,
+                                    simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_hav_f64_neon(a_lats, a_lons, b_lats, b_lons, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_hav_f64_haswell(a_lats, a_lons, b_lats, b_lons, n, d);
+#else
+    simsimd_hav_f64_serial(a_lats, a_lons, b_lats, b_lons, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_hav_f32(simsimd_f32_t const *a_lats, simsimd_f32_t const *a_lons,
+                                    simsimd_f32_t const *b_lats, simsimd_f32_t const *b_lons,
+                                    simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_hav_f32_neon(a_lats, a_lons, b_lats, b_lons, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_hav_f32_haswell(a_lats, a_lons, b_lats, b_lons, n, d);
+#else
+    simsimd_hav_f32_serial(a_lats, a_lons, b_lats, b_lons, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_vincenty_f64(simsimd_f64_t const *a_lats, simsimd_f64_t const *a_lons,
+                                         simsimd_f64_t const *b_lats, simsimd_f64_t const *b_lons,
+                                         simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_vincenty_f64_neon(a_lats, a_lons, b_lats, b_lons, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_vincenty_f64_haswell(a_lats, a_lons, b_lats, b_lons, n, d);
+#else
+    simsimd_vincenty_f64_serial(a_lats, a_lons, b_lats, b_lons, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_vincenty_f32(simsimd_f32_t const *a_lats, simsimd_f32_t const *a_lons,
+                                         simsimd_f32_t const *b_lats, simsimd_f32_t const *b_lons,
+                                         simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_vincenty_f32_neon(a_lats, a_lons, b_lats, b_lons, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_vincenty_f32_haswell(a_lats, a_lons, b_lats, b_lons, n, d);
+#else
+    simsimd_vincenty_f32_serial(a_lats, a_lons, b_lats, b_lons, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_rmsd_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                     simsimd_f64_t *a_centroid, simsimd_f64_t *b_centroid, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_rmsd_f64_neon(a, b, n, a_centroid, b_centroid, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_rmsd_f64_skylake(a, b, n, a_centroid, b_centroid, d);
+#else
+    simsimd_rmsd_f64_serial(a, b, n, a_centroid, b_centroid, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_rmsd_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                     simsimd_f32_t *a_centroid, simsimd_f32_t *b_centroid, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_rmsd_f32_neon(a, b, n, a_centroid, b_centroid, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_rmsd_f32_skylake(a, b, n, a_centroid, b_centroid, d);
+#else
+    simsimd_rmsd_f32_serial(a, b, n, a_centroid, b_centroid, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_rmsd_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
+                                     simsimd_f16_t *a_centroid, simsimd_f16_t *b_centroid, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON_F16
+    simsimd_rmsd_f16_neon(a, b, n, a_centroid, b_centroid, d);
+#elif SIMSIMD_TARGET_SAPPHIRE
+    simsimd_rmsd_f16_sapphire(a, b, n, a_centroid, b_centroid, d);
+#else
+    simsimd_rmsd_f16_serial(a, b, n, a_centroid, b_centroid, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_rmsd_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
+                                      simsimd_bf16_t *a_centroid, simsimd_bf16_t *b_centroid, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON_BF16
+    simsimd_rmsd_bf16_neon(a, b, n, a_centroid, b_centroid, d);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_rmsd_bf16_genoa(a, b, n, a_centroid, b_centroid, d);
+#else
+    simsimd_rmsd_bf16_serial(a, b, n, a_centroid, b_centroid, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_kabsch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
+                                       simsimd_f64_t *a_centroid, simsimd_f64_t *b_centroid, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_kabsch_f64_neon(a, b, n, a_centroid, b_centroid, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_kabsch_f64_skylake(a, b, n, a_centroid, b_centroid, d);
+#else
+    simsimd_kabsch_f64_serial(a, b, n, a_centroid, b_centroid, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_kabsch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n,
+                                       simsimd_f32_t *a_centroid, simsimd_f32_t *b_centroid, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_kabsch_f32_neon(a, b, n, a_centroid, b_centroid, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_kabsch_f32_skylake(a, b, n, a_centroid, b_centroid, d);
+#else
+    simsimd_kabsch_f32_serial(a, b, n, a_centroid, b_centroid, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_kabsch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t n,
+                                       simsimd_f16_t *a_centroid, simsimd_f16_t *b_centroid, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON_F16
+    simsimd_kabsch_f16_neon(a, b, n, a_centroid, b_centroid, d);
+#elif SIMSIMD_TARGET_SAPPHIRE
+    simsimd_kabsch_f16_sapphire(a, b, n, a_centroid, b_centroid, d);
+#else
+    simsimd_kabsch_f16_serial(a, b, n, a_centroid, b_centroid, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_kabsch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t n,
+                                        simsimd_bf16_t *a_centroid, simsimd_bf16_t *b_centroid, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON_BF16
+    simsimd_kabsch_bf16_neon(a, b, n, a_centroid, b_centroid, d);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_kabsch_bf16_genoa(a, b, n, a_centroid, b_centroid, d);
+#else
+    simsimd_kabsch_bf16_serial(a, b, n, a_centroid, b_centroid, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_rmsd_batch_f64_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_rmsd_batch_f64_skylake(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_rmsd_batch_f64_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_rmsd_batch_f32_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_rmsd_batch_f32_skylake(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_rmsd_batch_f32_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                           simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON_F16
+    simsimd_rmsd_batch_f16_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_SAPPHIRE
+    simsimd_rmsd_batch_f16_sapphire(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_rmsd_batch_f16_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_rmsd_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                            simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON_BF16
+    simsimd_rmsd_batch_bf16_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_rmsd_batch_bf16_genoa(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_rmsd_batch_bf16_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f64(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t b_count,
+                                             simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_kabsch_batch_f64_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_kabsch_batch_f64_skylake(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_kabsch_batch_f64_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f32(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                             simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_kabsch_batch_f32_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_kabsch_batch_f32_skylake(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_kabsch_batch_f32_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_f16(simsimd_f16_t const *a, simsimd_f16_t const *b, simsimd_size_t b_count,
+                                             simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON_F16
+    simsimd_kabsch_batch_f16_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_SAPPHIRE
+    simsimd_kabsch_batch_f16_sapphire(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_kabsch_batch_f16_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_kabsch_batch_bf16(simsimd_bf16_t const *a, simsimd_bf16_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *d) {
+#if SIMSIMD_TARGET_NEON_BF16
+    simsimd_kabsch_batch_bf16_neon(a, b, b_count, b_stride, n, d);
+#elif SIMSIMD_TARGET_GENOA
+    simsimd_kabsch_batch_bf16_genoa(a, b, b_count, b_stride, n, d);
+#else
+    simsimd_kabsch_batch_bf16_serial(a, b, b_count, b_stride, n, d);
+#endif
+}
+
 #endif
 
 #ifdef __cplusplus
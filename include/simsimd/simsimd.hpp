@@ -0,0 +1,296 @@
+/**
+ *  @file       simsimd.hpp
+ *  @brief      C++ templates for Similarity Measures of vectors with compile-time dimensions.
+ *  @author     Ash Vardanian
+ *  @date       October 15, 2026
+ *
+ *  Contains:
+ *  - Inner product
+ *  - Cosine (Angular) distance
+ *  - L2 (Euclidean) regular and squared distance
+ *
+ *  For datatypes:
+ *  - 64-bit IEEE floating point numbers
+ *  - 32-bit IEEE floating point numbers
+ *  - 8-bit signed integers
+ *
+ *  For hardware architectures:
+ *  - Arm: NEON
+ *  - x86: Haswell, Skylake
+ *
+ *  Only the `f32` kernels are hand-vectorized for those targets. The `f64` and `i8` variants always use the
+ *  serial code, leaving the vectorization of the fixed-length loop to the compiler.
+ *
+ *  Embeddings generally have a fixed number of dimensions, like 384, 768, or 1536. When it is known at compile
+ *  time, the `simsimd::fixed_metric<kind, scalar, dimensions>` template unrolls the loop over up to 128
+ *  vectors, replaces the masked tail loads of the generic kernels with a single compile-time mask or nothing
+ *  at all, and spreads the work over as many independent accumulators as there are vectors, up to 4, to hide
+ *  the FMA latency. Once unrolled, every accumulator index is a constant, so they all stay in registers.
+ *  The backend is selected at compile time, just like in the C API without `SIMSIMD_DYNAMIC_DISPATCH`:
+ *
+ *  @code{.cpp}
+ *  simsimd_f32_t a[768], b[768];
+ *  simsimd_distance_t distance = simsimd::fixed_metric<simsimd_metric_cos_k, simsimd_f32_t, 768>(a, b);
+ *  @endcode
+ *
+ *  Only the types with unambiguous C++ aliases are supported, as `simsimd_f16_t` and `simsimd_bf16_t`,
+ *  or `simsimd_u8_t` and `simsimd_b8_t`, may be the same type, depending on the compiler.
+ */
+#ifndef SIMSIMD_HPP
+#define SIMSIMD_HPP
+
+#include <cstddef>     // `std::size_t`
+#include <type_traits> // `std::is_same_v`
+
+#include "simsimd.h"
+
+namespace simsimd {
+namespace detail {
+
+/// @brief  Whether `simsimd::fixed_metric` implements the metric kind.
+template <simsimd_metric_kind_t kind_>
+inline constexpr bool is_fixed_metric_k = kind_ == simsimd_metric_dot_k || kind_ == simsimd_metric_cos_k ||
+                                          kind_ == simsimd_metric_l2sq_k || kind_ == simsimd_metric_l2_k;
+
+/// @brief  Asks the compiler to unroll the following loop, which has a compile-time trip count.
+#if defined(__GNUC__) || defined(__clang__)
+#define _SIMSIMD_FIXED_UNROLL _Pragma("GCC unroll 128")
+#else
+#define _SIMSIMD_FIXED_UNROLL
+#endif
+
+/// @brief  Number of independent accumulators for a given number of loop iterations, up to 4.
+constexpr std::size_t fixed_accumulators(std::size_t iterations) noexcept {
+    return iterations < 1 ? 1 : iterations > 4 ? 4 : iterations;
+}
+
+/// @brief  Accumulator type, matching the serial C kernels.
+template <typename scalar_>
+using fixed_accumulator_t =
+    std::conditional_t<std::is_same_v<scalar_, simsimd_i8_t>, simsimd_i32_t,
+                       std::conditional_t<std::is_same_v<scalar_, simsimd_f64_t>, simsimd_f64_t, simsimd_f32_t>>;
+
+template <simsimd_metric_kind_t kind_, typename scalar_, std::size_t dimensions_>
+inline simsimd_distance_t fixed_metric_serial(scalar_ const *a, scalar_ const *b) noexcept {
+    using accumulator_t = fixed_accumulator_t<scalar_>;
+    constexpr std::size_t lanes_k = fixed_accumulators(dimensions_);
+    accumulator_t ab[lanes_k] = {}, a2[lanes_k] = {}, b2[lanes_k] = {};
+    for (std::size_t i = 0; i != dimensions_; ++i) {
+        accumulator_t const ai = a[i], bi = b[i];
+        if constexpr (kind_ == simsimd_metric_dot_k) ab[i % lanes_k] += ai * bi;
+        else if constexpr (kind_ == simsimd_metric_cos_k)
+            ab[i % lanes_k] += ai * bi, a2[i % lanes_k] += ai * ai, b2[i % lanes_k] += bi * bi;
+        else {
+            accumulator_t const di = ai - bi;
+            ab[i % lanes_k] += di * di;
+        }
+    }
+    for (std::size_t j = 1; j != lanes_k; ++j) ab[0] += ab[j], a2[0] += a2[j], b2[0] += b2[j];
+
+    if constexpr (kind_ == simsimd_metric_cos_k) return _simsimd_cos_normalize_f64_serial(ab[0], a2[0], b2[0]);
+    else if constexpr (kind_ == simsimd_metric_l2_k) return SIMSIMD_SQRT((simsimd_distance_t)ab[0]);
+    else return ab[0];
+}
+
+#if _SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_HASWELL
+#pragma GCC push_options
+#pragma GCC target("avx2", "f16c", "fma")
+#pragma clang attribute push(__attribute__((target("avx2,f16c,fma"))), apply_to = function)
+
+template <simsimd_metric_kind_t kind_, std::size_t dimensions_>
+inline simsimd_distance_t fixed_metric_f32_haswell(simsimd_f32_t const *a, simsimd_f32_t const *b) noexcept {
+    constexpr std::size_t vectors_k = dimensions_ / 8, tail_k = dimensions_ % 8;
+    constexpr std::size_t lanes_k = fixed_accumulators(vectors_k);
+    __m256 ab_vecs[lanes_k], a2_vecs[lanes_k], b2_vecs[lanes_k];
+    _SIMSIMD_FIXED_UNROLL
+    for (std::size_t j = 0; j != lanes_k; ++j)
+        ab_vecs[j] = _mm256_setzero_ps(), a2_vecs[j] = _mm256_setzero_ps(), b2_vecs[j] = _mm256_setzero_ps();
+
+    _SIMSIMD_FIXED_UNROLL
+    for (std::size_t i = 0; i != vectors_k; ++i) {
+        __m256 const a_vec = _mm256_loadu_ps(a + i * 8), b_vec = _mm256_loadu_ps(b + i * 8);
+        if constexpr (kind_ == simsimd_metric_dot_k)
+            ab_vecs[i % lanes_k] = _mm256_fmadd_ps(a_vec, b_vec, ab_vecs[i % lanes_k]);
+        else if constexpr (kind_ == simsimd_metric_cos_k) {
+            ab_vecs[i % lanes_k] = _mm256_fmadd_ps(a_vec, b_vec, ab_vecs[i % lanes_k]);
+            a2_vecs[i % lanes_k] = _mm256_fmadd_ps(a_vec, a_vec, a2_vecs[i % lanes_k]);
+            b2_vecs[i % lanes_k] = _mm256_fmadd_ps(b_vec, b_vec, b2_vecs[i % lanes_k]);
+        }
+        else {
+            __m256 const d_vec = _mm256_sub_ps(a_vec, b_vec);
+            ab_vecs[i % lanes_k] = _mm256_fmadd_ps(d_vec, d_vec, ab_vecs[i % lanes_k]);
+        }
+    }
+    _SIMSIMD_FIXED_UNROLL
+    for (std::size_t j = 1; j != lanes_k; ++j)
+        ab_vecs[0] = _mm256_add_ps(ab_vecs[0], ab_vecs[j]), a2_vecs[0] = _mm256_add_ps(a2_vecs[0], a2_vecs[j]),
+        b2_vecs[0] = _mm256_add_ps(b2_vecs[0], b2_vecs[j]);
+
+    // AVX2 has no cheap masked loads, so the few remaining dimensions are handled with scalar code
+    simsimd_f64_t ab = _simsimd_reduce_f32x8_haswell(ab_vecs[0]), a2 = 0, b2 = 0;
+    if constexpr (kind_ == simsimd_metric_cos_k)
+        a2 = _simsimd_reduce_f32x8_haswell(a2_vecs[0]), b2 = _simsimd_reduce_f32x8_haswell(b2_vecs[0]);
+    for (std::size_t i = vectors_k * 8; i != vectors_k * 8 + tail_k; ++i) {
+        simsimd_f32_t const ai = a[i], bi = b[i];
+        if constexpr (kind_ == simsimd_metric_dot_k) ab += ai * bi;
+        else if constexpr (kind_ == simsimd_metric_cos_k) ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+        else ab += (ai - bi) * (ai - bi);
+    }
+
+    if constexpr (kind_ == simsimd_metric_cos_k) return _simsimd_cos_normalize_f64_haswell(ab, a2, b2);
+    else if constexpr (kind_ == simsimd_metric_l2_k) return _simsimd_sqrt_f64_haswell(ab);
+    else return ab;
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_HASWELL
+
+#if SIMSIMD_TARGET_SKYLAKE
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "avx512bw", "bmi2")
+#pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512vl,avx512bw,bmi2"))), apply_to = function)
+
+template <simsimd_metric_kind_t kind_, std::size_t dimensions_>
+inline simsimd_distance_t fixed_metric_f32_skylake(simsimd_f32_t const *a, simsimd_f32_t const *b) noexcept {
+    constexpr std::size_t vectors_k = dimensions_ / 16, tail_k = dimensions_ % 16;
+    constexpr std::size_t iterations_k = vectors_k + (tail_k != 0);
+    constexpr std::size_t lanes_k = fixed_accumulators(iterations_k);
+    __m512 ab_vecs[lanes_k], a2_vecs[lanes_k], b2_vecs[lanes_k];
+    _SIMSIMD_FIXED_UNROLL
+    for (std::size_t j = 0; j != lanes_k; ++j)
+        ab_vecs[j] = _mm512_setzero_ps(), a2_vecs[j] = _mm512_setzero_ps(), b2_vecs[j] = _mm512_setzero_ps();
+
+    // The last iteration uses a compile-time mask, if the dimensions aren't a multiple of 16
+    _SIMSIMD_FIXED_UNROLL
+    for (std::size_t i = 0; i != iterations_k; ++i) {
+        __m512 a_vec, b_vec;
+        if (tail_k == 0 || i != vectors_k) a_vec = _mm512_loadu_ps(a + i * 16), b_vec = _mm512_loadu_ps(b + i * 16);
+        else {
+            constexpr __mmask16 mask = (__mmask16)((1u << tail_k) - 1u);
+            a_vec = _mm512_maskz_loadu_ps(mask, a + i * 16), b_vec = _mm512_maskz_loadu_ps(mask, b + i * 16);
+        }
+        if constexpr (kind_ == simsimd_metric_dot_k)
+            ab_vecs[i % lanes_k] = _mm512_fmadd_ps(a_vec, b_vec, ab_vecs[i % lanes_k]);
+        else if constexpr (kind_ == simsimd_metric_cos_k) {
+            ab_vecs[i % lanes_k] = _mm512_fmadd_ps(a_vec, b_vec, ab_vecs[i % lanes_k]);
+            a2_vecs[i % lanes_k] = _mm512_fmadd_ps(a_vec, a_vec, a2_vecs[i % lanes_k]);
+            b2_vecs[i % lanes_k] = _mm512_fmadd_ps(b_vec, b_vec, b2_vecs[i % lanes_k]);
+        }
+        else {
+            __m512 const d_vec = _mm512_sub_ps(a_vec, b_vec);
+            ab_vecs[i % lanes_k] = _mm512_fmadd_ps(d_vec, d_vec, ab_vecs[i % lanes_k]);
+        }
+    }
+    _SIMSIMD_FIXED_UNROLL
+    for (std::size_t j = 1; j != lanes_k; ++j)
+        ab_vecs[0] = _mm512_add_ps(ab_vecs[0], ab_vecs[j]), a2_vecs[0] = _mm512_add_ps(a2_vecs[0], a2_vecs[j]),
+        b2_vecs[0] = _mm512_add_ps(b2_vecs[0], b2_vecs[j]);
+
+    simsimd_f64_t const ab = _simsimd_reduce_f32x16_skylake(ab_vecs[0]);
+    if constexpr (kind_ == simsimd_metric_cos_k)
+        return _simsimd_cos_normalize_f64_skylake(ab, _simsimd_reduce_f32x16_skylake(a2_vecs[0]),
+                                                  _simsimd_reduce_f32x16_skylake(b2_vecs[0]));
+    else if constexpr (kind_ == simsimd_metric_l2_k) return _simsimd_sqrt_f64_haswell(ab);
+    else return ab;
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SKYLAKE
+#endif // _SIMSIMD_TARGET_X86
+
+#if _SIMSIMD_TARGET_ARM
+#if SIMSIMD_TARGET_NEON
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+simd")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+simd"))), apply_to = function)
+
+template <simsimd_metric_kind_t kind_, std::size_t dimensions_>
+inline simsimd_distance_t fixed_metric_f32_neon(simsimd_f32_t const *a, simsimd_f32_t const *b) noexcept {
+    constexpr std::size_t vectors_k = dimensions_ / 4, tail_k = dimensions_ % 4;
+    constexpr std::size_t lanes_k = fixed_accumulators(vectors_k);
+    float32x4_t ab_vecs[lanes_k], a2_vecs[lanes_k], b2_vecs[lanes_k];
+    _SIMSIMD_FIXED_UNROLL
+    for (std::size_t j = 0; j != lanes_k; ++j)
+        ab_vecs[j] = vdupq_n_f32(0), a2_vecs[j] = vdupq_n_f32(0), b2_vecs[j] = vdupq_n_f32(0);
+
+    _SIMSIMD_FIXED_UNROLL
+    for (std::size_t i = 0; i != vectors_k; ++i) {
+        float32x4_t const a_vec = vld1q_f32(a + i * 4), b_vec = vld1q_f32(b + i * 4);
+        if constexpr (kind_ == simsimd_metric_dot_k)
+            ab_vecs[i % lanes_k] = vfmaq_f32(ab_vecs[i % lanes_k], a_vec, b_vec);
+        else if constexpr (kind_ == simsimd_metric_cos_k) {
+            ab_vecs[i % lanes_k] = vfmaq_f32(ab_vecs[i % lanes_k], a_vec, b_vec);
+            a2_vecs[i % lanes_k] = vfmaq_f32(a2_vecs[i % lanes_k], a_vec, a_vec);
+            b2_vecs[i % lanes_k] = vfmaq_f32(b2_vecs[i % lanes_k], b_vec, b_vec);
+        }
+        else {
+            float32x4_t const d_vec = vsubq_f32(a_vec, b_vec);
+            ab_vecs[i % lanes_k] = vfmaq_f32(ab_vecs[i % lanes_k], d_vec, d_vec);
+        }
+    }
+    _SIMSIMD_FIXED_UNROLL
+    for (std::size_t j = 1; j != lanes_k; ++j)
+        ab_vecs[0] = vaddq_f32(ab_vecs[0], ab_vecs[j]), a2_vecs[0] = vaddq_f32(a2_vecs[0], a2_vecs[j]),
+        b2_vecs[0] = vaddq_f32(b2_vecs[0], b2_vecs[j]);
+
+    simsimd_f64_t ab = vaddvq_f32(ab_vecs[0]), a2 = vaddvq_f32(a2_vecs[0]), b2 = vaddvq_f32(b2_vecs[0]);
+    for (std::size_t i = vectors_k * 4; i != vectors_k * 4 + tail_k; ++i) {
+        simsimd_f32_t const ai = a[i], bi = b[i];
+        if constexpr (kind_ == simsimd_metric_dot_k) ab += ai * bi;
+        else if constexpr (kind_ == simsimd_metric_cos_k) ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+        else ab += (ai - bi) * (ai - bi);
+    }
+
+    if constexpr (kind_ == simsimd_metric_cos_k) return _simsimd_cos_normalize_f64_neon(ab, a2, b2);
+    else if constexpr (kind_ == simsimd_metric_l2_k) return _simsimd_sqrt_f64_neon(ab);
+    else return ab;
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON
+#endif // _SIMSIMD_TARGET_ARM
+
+} // namespace detail
+
+/**
+ *  @brief  Computes a metric between two vectors with a compile-time number of dimensions.
+ *
+ *  @tparam kind_        One of `simsimd_metric_dot_k`, `simsimd_metric_cos_k`, `simsimd_metric_l2sq_k`,
+ *                       or `simsimd_metric_l2_k`.
+ *  @tparam scalar_      One of `simsimd_f64_t`, `simsimd_f32_t`, or `simsimd_i8_t`.
+ *  @tparam dimensions_  Number of scalars in each vector.
+ *  @return              Same value as the C API, like `simsimd_cos_f32`, up to the rounding errors.
+ */
+template <simsimd_metric_kind_t kind_, typename scalar_, std::size_t dimensions_>
+inline simsimd_distance_t fixed_metric(scalar_ const *a, scalar_ const *b) noexcept {
+    static_assert(detail::is_fixed_metric_k<kind_>, "Only dot, cos, l2sq, and l2 metrics are supported");
+    static_assert(std::is_same_v<scalar_, simsimd_f64_t> || std::is_same_v<scalar_, simsimd_f32_t> ||
+                      std::is_same_v<scalar_, simsimd_i8_t>,
+                  "Only f64, f32, and i8 scalars are supported");
+    static_assert(dimensions_ > 0, "Vectors must have at least one dimension");
+
+#if _SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_SKYLAKE
+    if constexpr (std::is_same_v<scalar_, simsimd_f32_t>)
+        return detail::fixed_metric_f32_skylake<kind_, dimensions_>(a, b);
+    else
+#elif _SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_HASWELL
+    if constexpr (std::is_same_v<scalar_, simsimd_f32_t>)
+        return detail::fixed_metric_f32_haswell<kind_, dimensions_>(a, b);
+    else
+#elif _SIMSIMD_TARGET_ARM && SIMSIMD_TARGET_NEON
+    if constexpr (std::is_same_v<scalar_, simsimd_f32_t>)
+        return detail::fixed_metric_f32_neon<kind_, dimensions_>(a, b);
+    else
+#endif
+        return detail::fixed_metric_serial<kind_, scalar_, dimensions_>(a, b);
+}
+
+} // namespace simsimd
+
+#undef _SIMSIMD_FIXED_UNROLL
+
+#endif // SIMSIMD_HPP
@@ -7,16 +7,18 @@
  *  Contains:
  *  - Set Intersection ~ Jaccard Distance
  *  - Sparse Dot Products, outputting the count and weighted product
+ *  - Batched intersections and dot products of one query against many documents in CSR layout
  *
  *  For datatypes:
  *  - u16: for vocabularies under 64 thousand tokens
  *  - u32: for vocabularies under 4 billion tokens
  *  - u16 indicies + i16 weights: for weighted word counts
  *  - u16 indicies + bf16 weights: for sparse matrices
+ *  - u32 indicies + bf16 or f32 weights: for sparse matrices over large vocabularies
  *
  *  For hardware architectures:
  *  - x86: Ice Lake, Turin
- *  - Arm: SVE2
+ *  - Arm: NEON, SVE2
  *
  *  Interestingly, to implement sparse distances and products, the most important function
  *  is analogous to `std::set_intersection`, that outputs the intersection of two sorted
@@ -75,6 +77,16 @@ SIMSIMD_PUBLIC void simsimd_spdot_weights_u16_serial(                 //
     simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights, //
     simsimd_size_t a_length, simsimd_size_t b_length,                 //
     simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_u32_serial(                 //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                   //
+    simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,                 //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_f32_u32_serial(           //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                 //
+    simsimd_f32_t const *a_weights, simsimd_f32_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,               //
+    simsimd_distance_t *results);
 
 /*  Implements the most naive set intersection algorithm, similar to `std::set_intersection in C++ STL`,
  *  naively enumerating the elements of two arrays.
@@ -97,6 +109,16 @@ SIMSIMD_PUBLIC void simsimd_spdot_weights_u16_accurate(               //
     simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights, //
     simsimd_size_t a_length, simsimd_size_t b_length,                 //
     simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_u32_accurate(               //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                   //
+    simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,                 //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_f32_u32_accurate(         //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                 //
+    simsimd_f32_t const *a_weights, simsimd_f32_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,               //
+    simsimd_distance_t *results);
 
 /*  SIMD-powered backends for Arm SVE, mostly using 32-bit arithmetic over variable-length platform-defined word sizes.
  *  Designed for Arm Graviton 3, Microsoft Cobalt, as well as Nvidia Grace and newer Ampere Altra CPUs.
@@ -119,6 +141,16 @@ SIMSIMD_PUBLIC void simsimd_spdot_weights_u16_sve2(                   //
     simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights, //
     simsimd_size_t a_length, simsimd_size_t b_length,                 //
     simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_u32_sve2(                   //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                   //
+    simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,                 //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_f32_u32_sve2(             //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                 //
+    simsimd_f32_t const *a_weights, simsimd_f32_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,               //
+    simsimd_distance_t *results);
 
 /*  SIMD-powered backends for various generations of AVX512 CPUs.
  *  Skylake is handy, as it supports masked loads and other operations, avoiding the need for the tail loop.
@@ -132,6 +164,16 @@ SIMSIMD_PUBLIC void simsimd_intersect_u32_ice(        //
     simsimd_u32_t const *a, simsimd_u32_t const *b,   //
     simsimd_size_t a_length, simsimd_size_t b_length, //
     simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_u32_ice(                    //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                   //
+    simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,                 //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_f32_u32_ice(              //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                 //
+    simsimd_f32_t const *a_weights, simsimd_f32_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,               //
+    simsimd_distance_t *results);
 
 /*  SIMD-powered backends for AMD Turin CPUs with cheap VP2INTERSECT instructions.
  *  On the Intel side, only mobile Tiger Lake support them, but have prohibitively high latency.
@@ -154,6 +196,105 @@ SIMSIMD_PUBLIC void simsimd_spdot_weights_u16_turin(                  //
     simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights, //
     simsimd_size_t a_length, simsimd_size_t b_length,                 //
     simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_u32_turin(                  //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                   //
+    simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,                 //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_f32_u32_turin(            //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                 //
+    simsimd_f32_t const *a_weights, simsimd_f32_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,               //
+    simsimd_distance_t *results);
+
+/*  SIMD-powered backends for Arm NEON, mostly using 32-bit arithmetic over 128-bit words.
+ *  The `bf16` weights are widened with shifts, not requiring the BF16 extensions.
+ */
+SIMSIMD_PUBLIC void simsimd_intersect_u16_neon(       //
+    simsimd_u16_t const *a, simsimd_u16_t const *b,   //
+    simsimd_size_t a_length, simsimd_size_t b_length, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_intersect_u32_neon(       //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,   //
+    simsimd_size_t a_length, simsimd_size_t b_length, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_u32_neon(                   //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                   //
+    simsimd_bf16_t const *a_weights, simsimd_bf16_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,                 //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_f32_u32_neon(             //
+    simsimd_u32_t const *a, simsimd_u32_t const *b,                 //
+    simsimd_f32_t const *a_weights, simsimd_f32_t const *b_weights, //
+    simsimd_size_t a_length, simsimd_size_t b_length,               //
+    simsimd_distance_t *results);
+
+/*  Batched set intersections of one query against many documents in a CSR-like block, where the document `d`
+ *  spans `b[b_offsets[d] : b_offsets[d + 1]]`, so `b_offsets` must have `b_count + 1` entries.
+ *  The intersection sizes or the weighted products are exported into a dense `results` array of `b_count` scores.
+ *  Per document, they pick between galloping and linear merging, similar to the serial pairwise kernel.
+ */
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u16_serial(                              //
+    simsimd_u16_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u16_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u32_serial(                              //
+    simsimd_u32_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u32_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_batch_u16_serial(                                   //
+    simsimd_u16_t const *a, simsimd_bf16_t const *a_weights, simsimd_size_t a_length,         //
+    simsimd_u16_t const *b, simsimd_bf16_t const *b_weights, simsimd_size_t const *b_offsets, //
+    simsimd_size_t b_count, simsimd_distance_t *results);
+
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u16_neon(                                //
+    simsimd_u16_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u16_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u32_neon(                                //
+    simsimd_u32_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u32_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u16_sve2(                                //
+    simsimd_u16_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u16_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u32_sve2(                                //
+    simsimd_u32_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u32_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_batch_u16_sve2(                                     //
+    simsimd_u16_t const *a, simsimd_bf16_t const *a_weights, simsimd_size_t a_length,         //
+    simsimd_u16_t const *b, simsimd_bf16_t const *b_weights, simsimd_size_t const *b_offsets, //
+    simsimd_size_t b_count, simsimd_distance_t *results);
+
+/*  On AVX-512, queries fitting into a single register are loaded once and compared against every document,
+ *  one register-sized chunk of a document at a time, stopping as soon as the document passes the query.
+ */
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u16_ice(                                 //
+    simsimd_u16_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u16_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u32_ice(                                 //
+    simsimd_u32_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u32_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_batch_u16_ice(                                      //
+    simsimd_u16_t const *a, simsimd_bf16_t const *a_weights, simsimd_size_t a_length,         //
+    simsimd_u16_t const *b, simsimd_bf16_t const *b_weights, simsimd_size_t const *b_offsets, //
+    simsimd_size_t b_count, simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u16_turin(                               //
+    simsimd_u16_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u16_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u32_turin(                               //
+    simsimd_u32_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u32_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results);
+SIMSIMD_PUBLIC void simsimd_spdot_weights_batch_u16_turin(                                    //
+    simsimd_u16_t const *a, simsimd_bf16_t const *a_weights, simsimd_size_t a_length,         //
+    simsimd_u16_t const *b, simsimd_bf16_t const *b_weights, simsimd_size_t const *b_offsets, //
+    simsimd_size_t b_count, simsimd_distance_t *results);
 
 #define SIMSIMD_MAKE_INTERSECT_LINEAR(name, input_type, counter_type)                                  \
     SIMSIMD_PUBLIC void simsimd_intersect_##input_type##_##name(                                       \
@@ -187,8 +328,8 @@ SIMSIMD_MAKE_INTERSECT_LINEAR(accurate, u32, size) // simsimd_intersect_u32_accu
             simsimd_##input_type##_t ai = a[i];                                                                   \
             simsimd_##input_type##_t bj = b[j];                                                                   \
             int matches = ai == bj;                                                                               \
-            simsimd_##counter_type##_t awi = load_and_convert(a_weights + i);                                     \
-            simsimd_##counter_type##_t bwi = load_and_convert(b_weights + i);                                     \
+            simsimd_##accumulator_type##_t awi = load_and_convert(a_weights + i);                                 \
+            simsimd_##accumulator_type##_t bwi = load_and_convert(b_weights + j);                                 \
             weights_product += matches * awi * bwi;                                                               \
             intersection_size += matches;                                                                         \
             i += ai < bj;                                                                                         \
@@ -202,6 +343,10 @@ SIMSIMD_MAKE_INTERSECT_WEIGHTED(accurate, spdot_counts, u16, size, i16, i64,
                                 SIMSIMD_DEREFERENCE) // simsimd_spdot_counts_u16_accurate
 SIMSIMD_MAKE_INTERSECT_WEIGHTED(accurate, spdot_weights, u16, size, bf16, f64,
                                 SIMSIMD_BF16_TO_F32) // simsimd_spdot_weights_u16_accurate
+SIMSIMD_MAKE_INTERSECT_WEIGHTED(accurate, spdot_weights, u32, size, bf16, f64,
+                                SIMSIMD_BF16_TO_F32) // simsimd_spdot_weights_u32_accurate
+SIMSIMD_MAKE_INTERSECT_WEIGHTED(accurate, spdot_weights_f32, u32, size, f32, f64,
+                                SIMSIMD_DEREFERENCE) // simsimd_spdot_weights_f32_u32_accurate
 
 #define SIMSIMD_MAKE_INTERSECT_GALLOPING(name, input_type, counter_type)                                             \
     SIMSIMD_PUBLIC simsimd_size_t simsimd_galloping_search_##input_type(simsimd_##input_type##_t const *array,       \
@@ -257,6 +402,75 @@ SIMSIMD_MAKE_INTERSECT_WEIGHTED(serial, spdot_counts, u16, size, i16, i32,
                                 SIMSIMD_DEREFERENCE) // simsimd_spdot_counts_u16_serial
 SIMSIMD_MAKE_INTERSECT_WEIGHTED(serial, spdot_weights, u16, size, bf16, f32,
                                 SIMSIMD_BF16_TO_F32) // simsimd_spdot_weights_u16_serial
+SIMSIMD_MAKE_INTERSECT_WEIGHTED(serial, spdot_weights, u32, size, bf16, f32,
+                                SIMSIMD_BF16_TO_F32) // simsimd_spdot_weights_u32_serial
+SIMSIMD_MAKE_INTERSECT_WEIGHTED(serial, spdot_weights_f32, u32, size, f32, f32,
+                                SIMSIMD_DEREFERENCE) // simsimd_spdot_weights_f32_u32_serial
+
+/**
+ *  @brief  Weighted analog of the galloping intersection, used for very unbalanced pairs of sparse vectors.
+ *  @return The sum of the products of the weights of the matching indices.
+ */
+SIMSIMD_INTERNAL simsimd_f32_t _simsimd_spdot_weights_u16_galloping(                                    //
+    simsimd_u16_t const *shorter, simsimd_bf16_t const *shorter_weights, simsimd_size_t shorter_length, //
+    simsimd_u16_t const *longer, simsimd_bf16_t const *longer_weights, simsimd_size_t longer_length) {
+    if (longer_length < shorter_length) {
+        simsimd_u16_t const *temp = shorter;
+        simsimd_bf16_t const *temp_weights = shorter_weights;
+        simsimd_size_t temp_length = shorter_length;
+        shorter = longer, shorter_weights = longer_weights, shorter_length = longer_length;
+        longer = temp, longer_weights = temp_weights, longer_length = temp_length;
+    }
+    simsimd_f32_t weights_product = 0;
+    simsimd_size_t j = 0;
+    for (simsimd_size_t i = 0; i < shorter_length; ++i) {
+        simsimd_u16_t shorter_i = shorter[i];
+        j = simsimd_galloping_search_u16(longer, j, longer_length, shorter_i);
+        if (j < longer_length && longer[j] == shorter_i)
+            weights_product += SIMSIMD_BF16_TO_F32(shorter_weights + i) * SIMSIMD_BF16_TO_F32(longer_weights + j);
+    }
+    return weights_product;
+}
+
+#define SIMSIMD_MAKE_INTERSECT_BATCH(name, input_type, merge_kernel)                                          \
+    SIMSIMD_PUBLIC void simsimd_intersect_batch_##input_type##_##name(                                        \
+        simsimd_##input_type##_t const *a, simsimd_size_t a_length, simsimd_##input_type##_t const *b,        \
+        simsimd_size_t const *b_offsets, simsimd_size_t b_count, simsimd_distance_t *results) {               \
+        for (simsimd_size_t d = 0; d != b_count; ++d) {                                                       \
+            simsimd_##input_type##_t const *document = b + b_offsets[d];                                      \
+            simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];                                 \
+            /* The serial kernel gallops through the longer list, if the lengths differ a lot */              \
+            if (document_length >= 64 * a_length || a_length >= 64 * document_length)                         \
+                simsimd_intersect_##input_type##_serial(a, document, a_length, document_length, results + d); \
+            else                                                                                              \
+                merge_kernel(a, document, a_length, document_length, results + d);                            \
+        }                                                                                                     \
+    }
+
+#define SIMSIMD_MAKE_SPDOT_WEIGHTS_BATCH(name, merge_kernel)                                                          \
+    SIMSIMD_PUBLIC void simsimd_spdot_weights_batch_u16_##name(                                                       \
+        simsimd_u16_t const *a, simsimd_bf16_t const *a_weights, simsimd_size_t a_length, simsimd_u16_t const *b,     \
+        simsimd_bf16_t const *b_weights, simsimd_size_t const *b_offsets, simsimd_size_t b_count,                     \
+        simsimd_distance_t *results) {                                                                                \
+        for (simsimd_size_t d = 0; d != b_count; ++d) {                                                               \
+            simsimd_u16_t const *document = b + b_offsets[d];                                                         \
+            simsimd_bf16_t const *document_weights = b_weights + b_offsets[d];                                        \
+            simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];                                         \
+            if (document_length >= 64 * a_length || a_length >= 64 * document_length) {                               \
+                results[d] = _simsimd_spdot_weights_u16_galloping(a, a_weights, a_length, document, document_weights, \
+                                                                  document_length);                                   \
+            }                                                                                                         \
+            else {                                                                                                    \
+                simsimd_distance_t count_and_product[2];                                                              \
+                merge_kernel(a, document, a_weights, document_weights, a_length, document_length, count_and_product); \
+                results[d] = count_and_product[1];                                                                    \
+            }                                                                                                         \
+        }                                                                                                             \
+    }
+
+SIMSIMD_MAKE_INTERSECT_BATCH(serial, u16, simsimd_intersect_u16_accurate) // simsimd_intersect_batch_u16_serial
+SIMSIMD_MAKE_INTERSECT_BATCH(serial, u32, simsimd_intersect_u32_accurate) // simsimd_intersect_batch_u32_serial
+SIMSIMD_MAKE_SPDOT_WEIGHTS_BATCH(serial, simsimd_spdot_weights_u16_serial) // simsimd_spdot_weights_batch_u16_serial
 
 /*  The AVX-512 implementations are inspired by the "Faster-Than-Native Alternatives
  *  for x86 VP2INTERSECT Instructions" paper by Guille Diez-Canas, 2022.
@@ -520,6 +734,240 @@ SIMSIMD_PUBLIC void simsimd_intersect_u32_ice(        //
     *results += c;
 }
 
+/**
+ *  @brief  Converts 16x `bf16` values, like 16x sparse weights, into 16x `f32` values.
+ */
+SIMSIMD_INTERNAL __m512 _simsimd_bf16x16_to_f32x16_ice(__m256i x) {
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(x), 16));
+}
+
+SIMSIMD_INTERNAL __m512 _simsimd_load_bf16x16_as_f32x16_ice(simsimd_bf16_t const *x) {
+    return _simsimd_bf16x16_to_f32x16_ice(_mm256_loadu_si256((__m256i const *)x));
+}
+
+SIMSIMD_INTERNAL __m512 _simsimd_load_f32x16_ice(simsimd_f32_t const *x) { return _mm512_loadu_ps(x); }
+
+#define SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_ICE(variation, weight_type, load_f32x16)                            \
+    SIMSIMD_PUBLIC void simsimd_##variation##_u32_ice(                                                     \
+        simsimd_u32_t const *a, simsimd_u32_t const *b, simsimd_##weight_type##_t const *a_weights,        \
+        simsimd_##weight_type##_t const *b_weights, simsimd_size_t a_length, simsimd_size_t b_length,      \
+        simsimd_distance_t *results) {                                                                     \
+                                                                                                           \
+        /* The baseline implementation for very small arrays (2 registers or less) can be quite simple: */ \
+        if (a_length < 32 && b_length < 32) {                                                              \
+            simsimd_##variation##_u32_serial(a, b, a_weights, b_weights, a_length, b_length, results);     \
+            return;                                                                                        \
+        }                                                                                                  \
+                                                                                                           \
+        simsimd_u32_t const *const a_end = a + a_length;                                                   \
+        simsimd_u32_t const *const b_end = b + b_length;                                                   \
+        simsimd_size_t intersection_size = 0;                                                              \
+        __m512 product_vec = _mm512_setzero_ps();                                                          \
+        union vec_t {                                                                                      \
+            __m512i zmm;                                                                                   \
+            simsimd_u32_t u32[16];                                                                         \
+        } a_vec, b_vec;                                                                                    \
+                                                                                                           \
+        while (a + 16 < a_end && b + 16 < b_end) {                                                         \
+            a_vec.zmm = _mm512_loadu_si512((__m512i const *)a);                                            \
+            b_vec.zmm = _mm512_loadu_si512((__m512i const *)b);                                            \
+            simsimd_u32_t a_min;                                                                           \
+            simsimd_u32_t a_max = a_vec.u32[15];                                                           \
+            simsimd_u32_t b_min = b_vec.u32[0];                                                            \
+            simsimd_u32_t b_max = b_vec.u32[15];                                                           \
+                                                                                                           \
+            /* If the slices don't overlap, advance the appropriate pointer */                             \
+            while (a_max < b_min && a + 32 < a_end) {                                                      \
+                a += 16, a_weights += 16;                                                                  \
+                a_vec.zmm = _mm512_loadu_si512((__m512i const *)a);                                        \
+                a_max = a_vec.u32[15];                                                                     \
+            }                                                                                              \
+            a_min = a_vec.u32[0];                                                                          \
+            while (b_max < a_min && b + 32 < b_end) {                                                      \
+                b += 16, b_weights += 16;                                                                  \
+                b_vec.zmm = _mm512_loadu_si512((__m512i const *)b);                                        \
+                b_max = b_vec.u32[15];                                                                     \
+            }                                                                                              \
+            b_min = b_vec.u32[0];                                                                          \
+                                                                                                           \
+            /* Unlike Turin, we need two passes to get the matches on both sides. Both are sorted, */      \
+            /* so after compression, the matching weights end up in the same lanes. */                     \
+            __mmask16 a_matches = _simsimd_intersect_u32x16_ice(a_vec.zmm, b_vec.zmm);                     \
+            if (a_matches) {                                                                               \
+                __mmask16 b_matches = _simsimd_intersect_u32x16_ice(b_vec.zmm, a_vec.zmm);                 \
+                __m512 a_weights_vec = _mm512_maskz_compress_ps(a_matches, load_f32x16(a_weights));        \
+                __m512 b_weights_vec = _mm512_maskz_compress_ps(b_matches, load_f32x16(b_weights));        \
+                product_vec = _mm512_fmadd_ps(a_weights_vec, b_weights_vec, product_vec);                  \
+                intersection_size += _mm_popcnt_u32(a_matches);                                            \
+            }                                                                                              \
+                                                                                                           \
+            __m512i a_last_broadcasted = _mm512_set1_epi32(*(int const *)&a_max);                          \
+            __m512i b_last_broadcasted = _mm512_set1_epi32(*(int const *)&b_max);                          \
+            __mmask16 a_step_mask = _mm512_cmple_epu32_mask(a_vec.zmm, b_last_broadcasted);                \
+            __mmask16 b_step_mask = _mm512_cmple_epu32_mask(b_vec.zmm, a_last_broadcasted);                \
+            simsimd_size_t a_step = 32 - _lzcnt_u32((simsimd_u32_t)a_step_mask);                           \
+            simsimd_size_t b_step = 32 - _lzcnt_u32((simsimd_u32_t)b_step_mask);                           \
+            a += a_step, a_weights += a_step;                                                              \
+            b += b_step, b_weights += b_step;                                                              \
+        }                                                                                                  \
+                                                                                                           \
+        simsimd_##variation##_u32_serial(a, b, a_weights, b_weights, a_end - a, b_end - b, results);       \
+        results[0] += intersection_size;                                                                   \
+        results[1] += _mm512_reduce_add_ps(product_vec);                                                   \
+    }
+
+SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_ICE(spdot_weights, bf16,
+                                   _simsimd_load_bf16x16_as_f32x16_ice) // simsimd_spdot_weights_u32_ice
+SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_ICE(spdot_weights_f32, f32,
+                                   _simsimd_load_f32x16_ice) // simsimd_spdot_weights_f32_u32_ice
+
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u16_ice(                                 //
+    simsimd_u16_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u16_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results) {
+
+    // Longer queries don't fit into a single register, so we fall back to pairwise kernels
+    if (a_length == 0 || a_length > 32) {
+        for (simsimd_size_t d = 0; d != b_count; ++d) {
+            simsimd_u16_t const *document = b + b_offsets[d];
+            simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];
+            if (document_length >= 64 * a_length || a_length >= 64 * document_length)
+                simsimd_intersect_u16_serial(a, document, a_length, document_length, results + d);
+            else
+                simsimd_intersect_u16_ice(a, document, a_length, document_length, results + d);
+        }
+        return;
+    }
+
+    // Pad the query with its last element, so that the padding can't produce any new matches
+    simsimd_u16_t const a_first = a[0], a_last = a[a_length - 1];
+    __mmask32 a_mask = (__mmask32)_bzhi_u32(0xFFFFFFFF, (unsigned int)a_length);
+    __m512i a_vec = _mm512_mask_loadu_epi16(_mm512_set1_epi16(*(short const *)&a_last), a_mask, a);
+
+    for (simsimd_size_t d = 0; d != b_count; ++d) {
+        simsimd_u16_t const *document = b + b_offsets[d];
+        simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];
+        if (document_length >= 64 * a_length) {
+            simsimd_intersect_u16_serial(a, document, a_length, document_length, results + d);
+            continue;
+        }
+
+        simsimd_size_t c = 0;
+        for (simsimd_size_t i = 0; i < document_length; i += 32) {
+            simsimd_size_t chunk_length = document_length - i < 32 ? document_length - i : 32;
+            if (document[i] > a_last) break;
+            if (document[i + chunk_length - 1] < a_first) continue;
+            __mmask32 document_mask = (__mmask32)_bzhi_u32(0xFFFFFFFF, (unsigned int)chunk_length);
+            __m512i document_vec = _mm512_maskz_loadu_epi16(document_mask, document + i);
+            c += _mm_popcnt_u32(_simsimd_intersect_u16x32_ice(document_vec, a_vec) & document_mask);
+        }
+        results[d] = c;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u32_ice(                                 //
+    simsimd_u32_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u32_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results) {
+
+    // Longer queries don't fit into a single register, so we fall back to pairwise kernels
+    if (a_length == 0 || a_length > 16) {
+        for (simsimd_size_t d = 0; d != b_count; ++d) {
+            simsimd_u32_t const *document = b + b_offsets[d];
+            simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];
+            if (document_length >= 64 * a_length || a_length >= 64 * document_length)
+                simsimd_intersect_u32_serial(a, document, a_length, document_length, results + d);
+            else
+                simsimd_intersect_u32_ice(a, document, a_length, document_length, results + d);
+        }
+        return;
+    }
+
+    // Pad the query with its last element, so that the padding can't produce any new matches
+    simsimd_u32_t const a_first = a[0], a_last = a[a_length - 1];
+    __mmask16 a_mask = (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)a_length);
+    __m512i a_vec = _mm512_mask_loadu_epi32(_mm512_set1_epi32(*(int const *)&a_last), a_mask, a);
+
+    for (simsimd_size_t d = 0; d != b_count; ++d) {
+        simsimd_u32_t const *document = b + b_offsets[d];
+        simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];
+        if (document_length >= 64 * a_length) {
+            simsimd_intersect_u32_serial(a, document, a_length, document_length, results + d);
+            continue;
+        }
+
+        simsimd_size_t c = 0;
+        for (simsimd_size_t i = 0; i < document_length; i += 16) {
+            simsimd_size_t chunk_length = document_length - i < 16 ? document_length - i : 16;
+            if (document[i] > a_last) break;
+            if (document[i + chunk_length - 1] < a_first) continue;
+            __mmask16 document_mask = (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)chunk_length);
+            __m512i document_vec = _mm512_maskz_loadu_epi32(document_mask, document + i);
+            c += _mm_popcnt_u32(_simsimd_intersect_u32x16_ice(document_vec, a_vec) & document_mask);
+        }
+        results[d] = c;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_spdot_weights_batch_u16_ice(                                      //
+    simsimd_u16_t const *a, simsimd_bf16_t const *a_weights, simsimd_size_t a_length,         //
+    simsimd_u16_t const *b, simsimd_bf16_t const *b_weights, simsimd_size_t const *b_offsets, //
+    simsimd_size_t b_count, simsimd_distance_t *results) {
+
+    // Longer queries don't fit into a single register, so we fall back to pairwise kernels
+    if (a_length == 0 || a_length > 32) {
+        simsimd_spdot_weights_batch_u16_serial(a, a_weights, a_length, b, b_weights, b_offsets, b_count, results);
+        return;
+    }
+
+    // Pad the query with its last element, so that the padding can't produce any new matches.
+    // Unlike the unweighted kernel, we need to know the matching lanes in both the query and the document,
+    // so the documents are also padded with their last elements, instead of zeros.
+    simsimd_u16_t const a_first = a[0], a_last = a[a_length - 1];
+    __mmask32 a_mask = (__mmask32)_bzhi_u32(0xFFFFFFFF, (unsigned int)a_length);
+    __m512i a_vec = _mm512_mask_loadu_epi16(_mm512_set1_epi16(*(short const *)&a_last), a_mask, a);
+    __m512i a_weights_vec = _mm512_maskz_loadu_epi16(a_mask, a_weights);
+
+    for (simsimd_size_t d = 0; d != b_count; ++d) {
+        simsimd_u16_t const *document = b + b_offsets[d];
+        simsimd_bf16_t const *document_weights = b_weights + b_offsets[d];
+        simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];
+        if (document_length >= 64 * a_length) {
+            results[d] = _simsimd_spdot_weights_u16_galloping(a, a_weights, a_length, document, document_weights,
+                                                              document_length);
+            continue;
+        }
+
+        __m512 product_vec = _mm512_setzero_ps();
+        for (simsimd_size_t i = 0; i < document_length; i += 32) {
+            simsimd_size_t chunk_length = document_length - i < 32 ? document_length - i : 32;
+            simsimd_u16_t document_last = document[i + chunk_length - 1];
+            if (document[i] > a_last) break;
+            if (document_last < a_first) continue;
+            __mmask32 document_mask = (__mmask32)_bzhi_u32(0xFFFFFFFF, (unsigned int)chunk_length);
+            __m512i document_vec =
+                _mm512_mask_loadu_epi16(_mm512_set1_epi16(*(short const *)&document_last), document_mask, document + i);
+            __mmask32 document_matches = _simsimd_intersect_u16x32_ice(document_vec, a_vec) & document_mask;
+            if (!document_matches) continue;
+            __mmask32 a_matches = _simsimd_intersect_u16x32_ice(a_vec, document_vec) & a_mask;
+
+            // Both sides are sorted, so after compression the matching weights end up in the same lanes
+            __m512i document_weights_vec = _mm512_maskz_loadu_epi16(document_mask, document_weights + i);
+            document_weights_vec = _mm512_maskz_compress_epi16(document_matches, document_weights_vec);
+            __m512i a_matching_weights_vec = _mm512_maskz_compress_epi16(a_matches, a_weights_vec);
+            __m512 a_f32_vec = _simsimd_bf16x16_to_f32x16_ice(_mm512_castsi512_si256(a_matching_weights_vec));
+            __m512 document_f32_vec = _simsimd_bf16x16_to_f32x16_ice(_mm512_castsi512_si256(document_weights_vec));
+            product_vec = _mm512_fmadd_ps(a_f32_vec, document_f32_vec, product_vec);
+            if (_mm_popcnt_u32(document_matches) > 16) {
+                a_f32_vec = _simsimd_bf16x16_to_f32x16_ice(_mm512_extracti64x4_epi64(a_matching_weights_vec, 1));
+                document_f32_vec = _simsimd_bf16x16_to_f32x16_ice(_mm512_extracti64x4_epi64(document_weights_vec, 1));
+                product_vec = _mm512_fmadd_ps(a_f32_vec, document_f32_vec, product_vec);
+            }
+        }
+        results[d] = _mm512_reduce_add_ps(product_vec);
+    }
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_ICE
@@ -527,10 +975,10 @@ SIMSIMD_PUBLIC void simsimd_intersect_u32_ice(        //
 #if SIMSIMD_TARGET_TURIN
 #pragma GCC push_options
 #pragma GCC target("avx2", "avx512f", "avx512vl", "bmi2", "lzcnt", "popcnt", "avx512bw", "avx512vbmi2", "avx512bf16", \
-                   "avx512vp2intersect")
-#pragma clang attribute push(                                                                                   \
-    __attribute__((                                                                                             \
-        target("avx2,avx512f,avx512vl,bmi2,lzcnt,popcnt,avx512bw,avx512vbmi2,avx512bf16,avx512vp2intersect"))), \
+                   "avx512vnni", "avx512vp2intersect")
+#pragma clang attribute push(                                                                        \
+    __attribute__((target("avx2,avx512f,avx512vl,bmi2,lzcnt,popcnt,avx512bw,avx512vbmi2,avx512bf16," \
+                          "avx512vnni,avx512vp2intersect"))),                                        \
     apply_to = function)
 
 SIMSIMD_PUBLIC void simsimd_intersect_u16_turin(      //
@@ -678,7 +1126,7 @@ SIMSIMD_PUBLIC void simsimd_spdot_weights_u16_turin(                  //
 
     // The baseline implementation for very small arrays (2 registers or less) can be quite simple:
     if (a_length < 64 && b_length < 64) {
-        simsimd_intersect_u16_serial(a, b, a_length, b_length, results);
+        simsimd_spdot_weights_u16_serial(a, b, a_weights, b_weights, a_length, b_length, results);
         return;
     }
 
@@ -752,8 +1200,9 @@ SIMSIMD_PUBLIC void simsimd_spdot_weights_u16_turin(                  //
         b += b_step, b_weights += b_step;
     }
 
-    simsimd_intersect_u16_serial(a, b, a_end - a, b_end - b, results);
-    *results += intersection_size;
+    simsimd_spdot_weights_u16_serial(a, b, a_weights, b_weights, a_end - a, b_end - b, results);
+    results[0] += intersection_size;
+    results[1] += _mm512_reduce_add_ps(_mm512_zextps256_ps512(product_vec.ymmps));
 }
 
 SIMSIMD_PUBLIC void simsimd_spdot_counts_u16_turin(                 //
@@ -764,7 +1213,7 @@ SIMSIMD_PUBLIC void simsimd_spdot_counts_u16_turin(                 //
 
     // The baseline implementation for very small arrays (2 registers or less) can be quite simple:
     if (a_length < 64 && b_length < 64) {
-        simsimd_intersect_u16_serial(a, b, a_length, b_length, results);
+        simsimd_spdot_counts_u16_serial(a, b, a_weights, b_weights, a_length, b_length, results);
         return;
     }
 
@@ -837,8 +1286,243 @@ SIMSIMD_PUBLIC void simsimd_spdot_counts_u16_turin(                 //
         b += b_step, b_weights += b_step;
     }
 
-    simsimd_intersect_u16_serial(a, b, a_end - a, b_end - b, results);
-    *results += intersection_size;
+    simsimd_spdot_counts_u16_serial(a, b, a_weights, b_weights, a_end - a, b_end - b, results);
+    results[0] += intersection_size;
+    results[1] += _mm512_reduce_add_epi32(_mm512_zextsi256_si512(product_vec.ymm));
+}
+
+/**
+ *  @brief  Converts 16x `bf16` values, like 16x sparse weights, into 16x `f32` values.
+ */
+SIMSIMD_INTERNAL __m512 _simsimd_load_bf16x16_as_f32x16_turin(simsimd_bf16_t const *x) {
+    __m256i x_u16 = _mm256_loadu_si256((__m256i const *)x);
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(x_u16), 16));
+}
+
+SIMSIMD_INTERNAL __m512 _simsimd_load_f32x16_turin(simsimd_f32_t const *x) { return _mm512_loadu_ps(x); }
+
+#define SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_TURIN(variation, weight_type, load_f32x16)                            \
+    SIMSIMD_PUBLIC void simsimd_##variation##_u32_turin(                                                     \
+        simsimd_u32_t const *a, simsimd_u32_t const *b, simsimd_##weight_type##_t const *a_weights,          \
+        simsimd_##weight_type##_t const *b_weights, simsimd_size_t a_length, simsimd_size_t b_length,        \
+        simsimd_distance_t *results) {                                                                       \
+                                                                                                             \
+        /* The baseline implementation for very small arrays (2 registers or less) can be quite simple: */   \
+        if (a_length < 32 && b_length < 32) {                                                                \
+            simsimd_##variation##_u32_serial(a, b, a_weights, b_weights, a_length, b_length, results);       \
+            return;                                                                                          \
+        }                                                                                                    \
+                                                                                                             \
+        simsimd_u32_t const *const a_end = a + a_length;                                                     \
+        simsimd_u32_t const *const b_end = b + b_length;                                                     \
+        simsimd_size_t intersection_size = 0;                                                                \
+        __m512 product_vec = _mm512_setzero_ps();                                                            \
+        union vec_t {                                                                                        \
+            __m512i zmm;                                                                                     \
+            simsimd_u32_t u32[16];                                                                           \
+        } a_vec, b_vec;                                                                                      \
+                                                                                                             \
+        while (a + 16 < a_end && b + 16 < b_end) {                                                           \
+            a_vec.zmm = _mm512_loadu_si512((__m512i const *)a);                                              \
+            b_vec.zmm = _mm512_loadu_si512((__m512i const *)b);                                              \
+            simsimd_u32_t a_min;                                                                             \
+            simsimd_u32_t a_max = a_vec.u32[15];                                                             \
+            simsimd_u32_t b_min = b_vec.u32[0];                                                              \
+            simsimd_u32_t b_max = b_vec.u32[15];                                                             \
+                                                                                                             \
+            /* If the slices don't overlap, advance the appropriate pointer */                               \
+            while (a_max < b_min && a + 32 < a_end) {                                                        \
+                a += 16, a_weights += 16;                                                                    \
+                a_vec.zmm = _mm512_loadu_si512((__m512i const *)a);                                          \
+                a_max = a_vec.u32[15];                                                                       \
+            }                                                                                                \
+            a_min = a_vec.u32[0];                                                                            \
+            while (b_max < a_min && b + 32 < b_end) {                                                        \
+                b += 16, b_weights += 16;                                                                    \
+                b_vec.zmm = _mm512_loadu_si512((__m512i const *)b);                                          \
+                b_max = b_vec.u32[15];                                                                       \
+            }                                                                                                \
+            b_min = b_vec.u32[0];                                                                            \
+                                                                                                             \
+            /* Both sides are sorted, so after compression, the matching weights end up in the same lanes */ \
+            __mmask16 a_matches, b_matches;                                                                  \
+            _mm512_2intersect_epi32(a_vec.zmm, b_vec.zmm, &a_matches, &b_matches);                           \
+            if (a_matches) {                                                                                 \
+                __m512 a_weights_vec = _mm512_maskz_compress_ps(a_matches, load_f32x16(a_weights));          \
+                __m512 b_weights_vec = _mm512_maskz_compress_ps(b_matches, load_f32x16(b_weights));          \
+                product_vec = _mm512_fmadd_ps(a_weights_vec, b_weights_vec, product_vec);                    \
+                intersection_size += _mm_popcnt_u32(a_matches);                                              \
+            }                                                                                                \
+                                                                                                             \
+            __m512i a_last_broadcasted = _mm512_set1_epi32(*(int const *)&a_max);                            \
+            __m512i b_last_broadcasted = _mm512_set1_epi32(*(int const *)&b_max);                            \
+            __mmask16 a_step_mask = _mm512_cmple_epu32_mask(a_vec.zmm, b_last_broadcasted);                  \
+            __mmask16 b_step_mask = _mm512_cmple_epu32_mask(b_vec.zmm, a_last_broadcasted);                  \
+            simsimd_size_t a_step = 32 - _lzcnt_u32((simsimd_u32_t)a_step_mask);                             \
+            simsimd_size_t b_step = 32 - _lzcnt_u32((simsimd_u32_t)b_step_mask);                             \
+            a += a_step, a_weights += a_step;                                                                \
+            b += b_step, b_weights += b_step;                                                                \
+        }                                                                                                    \
+                                                                                                             \
+        simsimd_##variation##_u32_serial(a, b, a_weights, b_weights, a_end - a, b_end - b, results);         \
+        results[0] += intersection_size;                                                                     \
+        results[1] += _mm512_reduce_add_ps(product_vec);                                                     \
+    }
+
+SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_TURIN(spdot_weights, bf16,
+                                     _simsimd_load_bf16x16_as_f32x16_turin) // simsimd_spdot_weights_u32_turin
+SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_TURIN(spdot_weights_f32, f32,
+                                     _simsimd_load_f32x16_turin) // simsimd_spdot_weights_f32_u32_turin
+
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u16_turin(                               //
+    simsimd_u16_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u16_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results) {
+
+    // Longer queries don't fit into a single register, so we fall back to pairwise kernels
+    if (a_length == 0 || a_length > 16) {
+        for (simsimd_size_t d = 0; d != b_count; ++d) {
+            simsimd_u16_t const *document = b + b_offsets[d];
+            simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];
+            if (document_length >= 64 * a_length || a_length >= 64 * document_length)
+                simsimd_intersect_u16_serial(a, document, a_length, document_length, results + d);
+            else
+                simsimd_intersect_u16_turin(a, document, a_length, document_length, results + d);
+        }
+        return;
+    }
+
+    //! There is no such thing as `_mm512_2intersect_epi16`, only the 32-bit variant!
+    //! So the query is upcast once and the documents are upcast 16 entries at a time.
+    simsimd_u16_t const a_first = a[0], a_last = a[a_length - 1];
+    __mmask16 a_mask = (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)a_length);
+    __m512i a_vec =
+        _mm512_cvtepu16_epi32(_mm256_mask_loadu_epi16(_mm256_set1_epi16(*(short const *)&a_last), a_mask, a));
+
+    for (simsimd_size_t d = 0; d != b_count; ++d) {
+        simsimd_u16_t const *document = b + b_offsets[d];
+        simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];
+        if (document_length >= 64 * a_length) {
+            simsimd_intersect_u16_serial(a, document, a_length, document_length, results + d);
+            continue;
+        }
+
+        simsimd_size_t c = 0;
+        for (simsimd_size_t i = 0; i < document_length; i += 16) {
+            simsimd_size_t chunk_length = document_length - i < 16 ? document_length - i : 16;
+            if (document[i] > a_last) break;
+            if (document[i + chunk_length - 1] < a_first) continue;
+            __mmask16 document_mask = (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)chunk_length);
+            __m512i document_vec = _mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(document_mask, document + i));
+            __mmask16 a_matches_any_in_b, b_matches_any_in_a;
+            _mm512_2intersect_epi32(a_vec, document_vec, &a_matches_any_in_b, &b_matches_any_in_a);
+            c += _mm_popcnt_u32(b_matches_any_in_a & document_mask);
+        }
+        results[d] = c;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_intersect_batch_u32_turin(                               //
+    simsimd_u32_t const *a, simsimd_size_t a_length,                                 //
+    simsimd_u32_t const *b, simsimd_size_t const *b_offsets, simsimd_size_t b_count, //
+    simsimd_distance_t *results) {
+
+    // Longer queries don't fit into a single register, so we fall back to pairwise kernels
+    if (a_length == 0 || a_length > 16) {
+        for (simsimd_size_t d = 0; d != b_count; ++d) {
+            simsimd_u32_t const *document = b + b_offsets[d];
+            simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];
+            if (document_length >= 64 * a_length || a_length >= 64 * document_length)
+                simsimd_intersect_u32_serial(a, document, a_length, document_length, results + d);
+            else
+                simsimd_intersect_u32_turin(a, document, a_length, document_length, results + d);
+        }
+        return;
+    }
+
+    simsimd_u32_t const a_first = a[0], a_last = a[a_length - 1];
+    __mmask16 a_mask = (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)a_length);
+    __m512i a_vec = _mm512_mask_loadu_epi32(_mm512_set1_epi32(*(int const *)&a_last), a_mask, a);
+
+    for (simsimd_size_t d = 0; d != b_count; ++d) {
+        simsimd_u32_t const *document = b + b_offsets[d];
+        simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];
+        if (document_length >= 64 * a_length) {
+            simsimd_intersect_u32_serial(a, document, a_length, document_length, results + d);
+            continue;
+        }
+
+        simsimd_size_t c = 0;
+        for (simsimd_size_t i = 0; i < document_length; i += 16) {
+            simsimd_size_t chunk_length = document_length - i < 16 ? document_length - i : 16;
+            if (document[i] > a_last) break;
+            if (document[i + chunk_length - 1] < a_first) continue;
+            __mmask16 document_mask = (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)chunk_length);
+            __m512i document_vec = _mm512_maskz_loadu_epi32(document_mask, document + i);
+            __mmask16 a_matches_any_in_b, b_matches_any_in_a;
+            _mm512_2intersect_epi32(a_vec, document_vec, &a_matches_any_in_b, &b_matches_any_in_a);
+            c += _mm_popcnt_u32(b_matches_any_in_a & document_mask);
+        }
+        results[d] = c;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_spdot_weights_batch_u16_turin(                                    //
+    simsimd_u16_t const *a, simsimd_bf16_t const *a_weights, simsimd_size_t a_length,         //
+    simsimd_u16_t const *b, simsimd_bf16_t const *b_weights, simsimd_size_t const *b_offsets, //
+    simsimd_size_t b_count, simsimd_distance_t *results) {
+
+    // Longer queries don't fit into a single register, so we fall back to pairwise kernels
+    if (a_length == 0 || a_length > 16) {
+        simsimd_spdot_weights_batch_u16_serial(a, a_weights, a_length, b, b_weights, b_offsets, b_count, results);
+        return;
+    }
+
+    // Both the query and the documents are padded with their last elements, so the padding can't
+    // produce any new matches, and the two masks exported by `_mm512_2intersect_epi32` stay consistent.
+    simsimd_u16_t const a_first = a[0], a_last = a[a_length - 1];
+    __mmask16 a_mask = (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)a_length);
+    __m512i a_vec =
+        _mm512_cvtepu16_epi32(_mm256_mask_loadu_epi16(_mm256_set1_epi16(*(short const *)&a_last), a_mask, a));
+    __m256i a_weights_vec = _mm256_maskz_loadu_epi16(a_mask, a_weights);
+
+    for (simsimd_size_t d = 0; d != b_count; ++d) {
+        simsimd_u16_t const *document = b + b_offsets[d];
+        simsimd_bf16_t const *document_weights = b_weights + b_offsets[d];
+        simsimd_size_t document_length = b_offsets[d + 1] - b_offsets[d];
+        if (document_length >= 64 * a_length) {
+            results[d] = _simsimd_spdot_weights_u16_galloping(a, a_weights, a_length, document, document_weights,
+                                                              document_length);
+            continue;
+        }
+
+        __m256 product_vec = _mm256_setzero_ps();
+        for (simsimd_size_t i = 0; i < document_length; i += 16) {
+            simsimd_size_t chunk_length = document_length - i < 16 ? document_length - i : 16;
+            simsimd_u16_t document_last = document[i + chunk_length - 1];
+            if (document[i] > a_last) break;
+            if (document_last < a_first) continue;
+            __mmask16 document_mask = (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)chunk_length);
+            __m256i document_padding_vec = _mm256_set1_epi16(*(short const *)&document_last);
+            __m512i document_vec =
+                _mm512_cvtepu16_epi32(_mm256_mask_loadu_epi16(document_padding_vec, document_mask, document + i));
+            __mmask16 a_matches_any_in_b, b_matches_any_in_a;
+            _mm512_2intersect_epi32(a_vec, document_vec, &a_matches_any_in_b, &b_matches_any_in_a);
+            a_matches_any_in_b &= a_mask, b_matches_any_in_a &= document_mask;
+            if (!b_matches_any_in_a) continue;
+
+            // Both sides are sorted, so after compression the matching weights end up in the same lanes
+            __m256i document_weights_vec = _mm256_maskz_loadu_epi16(document_mask, document_weights + i);
+            document_weights_vec = _mm256_maskz_compress_epi16(b_matches_any_in_a, document_weights_vec);
+            __m256i a_matching_weights_vec = _mm256_maskz_compress_epi16(a_matches_any_in_b, a_weights_vec);
+            product_vec =
+                _mm256_dpbf16_ps(product_vec, (__m256bh)a_matching_weights_vec, (__m256bh)document_weights_vec);
+        }
+        __m128 product_f32x4 = _mm_add_ps(_mm256_castps256_ps128(product_vec), _mm256_extractf128_ps(product_vec, 1));
+        product_f32x4 = _mm_add_ps(product_f32x4, _mm_movehl_ps(product_f32x4, product_f32x4));
+        product_f32x4 = _mm_add_ss(product_f32x4, _mm_movehdup_ps(product_f32x4));
+        results[d] = _mm_cvtss_f32(product_f32x4);
+    }
 }
 
 #pragma clang attribute pop
@@ -1059,6 +1743,98 @@ SIMSIMD_PUBLIC void simsimd_intersect_u32_neon(       //
     *results += vaddvq_u32(c_counts_vec.u32x4);
 }
 
+/**
+ *  @brief  Loads 4x `bf16` values, like 4x sparse weights, widening them into 4x `f32` values.
+ */
+SIMSIMD_INTERNAL float32x4_t _simsimd_load_bf16x4_as_f32x4_neon(simsimd_bf16_t const *x) {
+    return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16((simsimd_u16_t const *)x), 16));
+}
+
+SIMSIMD_INTERNAL float32x4_t _simsimd_load_f32x4_neon(simsimd_f32_t const *x) { return vld1q_f32(x); }
+
+#define SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_NEON(variation, weight_type, load_f32x4)                                       \
+    SIMSIMD_PUBLIC void simsimd_##variation##_u32_neon(                                                               \
+        simsimd_u32_t const *a, simsimd_u32_t const *b, simsimd_##weight_type##_t const *a_weights,                   \
+        simsimd_##weight_type##_t const *b_weights, simsimd_size_t a_length, simsimd_size_t b_length,                 \
+        simsimd_distance_t *results) {                                                                                \
+                                                                                                                      \
+        /* The baseline implementation for very small arrays (2 registers or less) can be quite simple: */            \
+        if (a_length < 32 && b_length < 32) {                                                                         \
+            simsimd_##variation##_u32_serial(a, b, a_weights, b_weights, a_length, b_length, results);                \
+            return;                                                                                                   \
+        }                                                                                                             \
+                                                                                                                      \
+        simsimd_u32_t const *const a_end = a + a_length;                                                              \
+        simsimd_u32_t const *const b_end = b + b_length;                                                              \
+        union vec_t {                                                                                                 \
+            uint32x4_t u32x4;                                                                                         \
+            simsimd_u32_t u32[4];                                                                                     \
+        } a_vec, b_vec;                                                                                               \
+        uint32x4_t counts_vec = vdupq_n_u32(0);                                                                       \
+        float32x4_t product_vec = vdupq_n_f32(0);                                                                     \
+                                                                                                                      \
+        while (a + 4 < a_end && b + 4 < b_end) {                                                                      \
+            a_vec.u32x4 = vld1q_u32(a);                                                                               \
+            b_vec.u32x4 = vld1q_u32(b);                                                                               \
+            simsimd_u32_t a_min;                                                                                      \
+            simsimd_u32_t a_max = a_vec.u32[3];                                                                       \
+            simsimd_u32_t b_min = b_vec.u32[0];                                                                       \
+            simsimd_u32_t b_max = b_vec.u32[3];                                                                       \
+                                                                                                                      \
+            /* If the slices don't overlap, advance the appropriate pointer */                                        \
+            while (a_max < b_min && a + 8 < a_end) {                                                                  \
+                a += 4, a_weights += 4;                                                                               \
+                a_vec.u32x4 = vld1q_u32(a);                                                                           \
+                a_max = a_vec.u32[3];                                                                                 \
+            }                                                                                                         \
+            a_min = a_vec.u32[0];                                                                                     \
+            while (b_max < a_min && b + 8 < b_end) {                                                                  \
+                b += 4, b_weights += 4;                                                                               \
+                b_vec.u32x4 = vld1q_u32(b);                                                                           \
+                b_max = b_vec.u32[3];                                                                                 \
+            }                                                                                                         \
+            b_min = b_vec.u32[0];                                                                                     \
+                                                                                                                      \
+            /* Rotate the indices of `b` together with their weights, like `_simsimd_intersect_u32x4_neon`, */        \
+            /* so that every matching pair ends up in the same lane. Each lane of `a` matches at most once. */        \
+            uint32x4_t b_weights_vec = vreinterpretq_u32_f32(load_f32x4(b_weights));                                  \
+            uint32x4_t matches0 = vceqq_u32(a_vec.u32x4, b_vec.u32x4);                                                \
+            uint32x4_t matches1 = vceqq_u32(a_vec.u32x4, vextq_u32(b_vec.u32x4, b_vec.u32x4, 1));                     \
+            uint32x4_t matches2 = vceqq_u32(a_vec.u32x4, vextq_u32(b_vec.u32x4, b_vec.u32x4, 2));                     \
+            uint32x4_t matches3 = vceqq_u32(a_vec.u32x4, vextq_u32(b_vec.u32x4, b_vec.u32x4, 3));                     \
+            uint32x4_t matching_weights_vec = vorrq_u32(                                                              \
+                vorrq_u32(vandq_u32(matches0, b_weights_vec),                                                         \
+                          vandq_u32(matches1, vextq_u32(b_weights_vec, b_weights_vec, 1))),                           \
+                vorrq_u32(vandq_u32(matches2, vextq_u32(b_weights_vec, b_weights_vec, 2)),                            \
+                          vandq_u32(matches3, vextq_u32(b_weights_vec, b_weights_vec, 3))));                          \
+            uint32x4_t matches = vorrq_u32(vorrq_u32(matches0, matches1), vorrq_u32(matches2, matches3));             \
+            counts_vec = vaddq_u32(counts_vec, vandq_u32(matches, vdupq_n_u32(1)));                                   \
+            product_vec = vfmaq_f32(product_vec, load_f32x4(a_weights), vreinterpretq_f32_u32(matching_weights_vec)); \
+                                                                                                                      \
+            uint32x4_t a_last_broadcasted = vdupq_n_u32(a_max);                                                       \
+            uint32x4_t b_last_broadcasted = vdupq_n_u32(b_max);                                                       \
+            simsimd_u64_t a_step = _simsimd_clz_u64(_simsimd_u8_to_u4_neon(                                           \
+                vreinterpretq_u8_u32(vcleq_u32(a_vec.u32x4, b_last_broadcasted))));                                   \
+            simsimd_u64_t b_step = _simsimd_clz_u64(_simsimd_u8_to_u4_neon(                                           \
+                vreinterpretq_u8_u32(vcleq_u32(b_vec.u32x4, a_last_broadcasted))));                                   \
+            a_step = (64 - a_step) / 16, b_step = (64 - b_step) / 16;                                                 \
+            a += a_step, a_weights += a_step;                                                                         \
+            b += b_step, b_weights += b_step;                                                                         \
+        }                                                                                                             \
+                                                                                                                      \
+        simsimd_##variation##_u32_serial(a, b, a_weights, b_weights, a_end - a, b_end - b, results);                  \
+        results[0] += vaddvq_u32(counts_vec);                                                                         \
+        results[1] += vaddvq_f32(product_vec);                                                                        \
+    }
+
+SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_NEON(spdot_weights, bf16,
+                                    _simsimd_load_bf16x4_as_f32x4_neon) // simsimd_spdot_weights_u32_neon
+SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_NEON(spdot_weights_f32, f32,
+                                    _simsimd_load_f32x4_neon) // simsimd_spdot_weights_f32_u32_neon
+
+SIMSIMD_MAKE_INTERSECT_BATCH(neon, u16, simsimd_intersect_u16_neon) // simsimd_intersect_batch_u16_neon
+SIMSIMD_MAKE_INTERSECT_BATCH(neon, u32, simsimd_intersect_u32_neon) // simsimd_intersect_batch_u32_neon
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_NEON
@@ -1329,6 +2105,93 @@ SIMSIMD_PUBLIC void simsimd_spdot_counts_u16_sve2(                  //
     results[1] = svaddv_s64(svptrue_b64(), product_vec);
 }
 
+/**
+ *  @brief  Marks the active lanes of `a` matching any lane of `b`, using the histogram instructions,
+ *          like `simsimd_intersect_u32_sve2`. Inactive lanes must not produce new matches.
+ */
+SIMSIMD_INTERNAL svbool_t _simsimd_intersect_u32_mask_sve2(svbool_t a_progress, svuint32_t a_vec, svuint32_t b_vec) {
+    svuint32_t hist_lower = svhistcnt_u32_z(svptrue_b32(), a_vec, b_vec);
+    svuint32_t hist_upper = svrev_u32(svhistcnt_u32_z(svptrue_b32(), svrev_u32(a_vec), svrev_u32(b_vec)));
+    return svcmpne_n_u32(a_progress, svorr_u32_x(a_progress, hist_lower, hist_upper), 0);
+}
+
+SIMSIMD_INTERNAL svfloat32_t _simsimd_load_bf16_as_f32_sve2(svbool_t progress, simsimd_bf16_t const *x) {
+    svuint32_t x_u32 = svld1uh_u32(progress, (simsimd_u16_t const *)x);
+    return svreinterpret_f32_u32(svlsl_n_u32_x(progress, x_u32, 16));
+}
+
+SIMSIMD_INTERNAL svfloat32_t _simsimd_load_f32_sve2(svbool_t progress, simsimd_f32_t const *x) {
+    return svld1_f32(progress, x);
+}
+
+#define SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_SVE2(variation, weight_type, load_f32)                                 \
+    SIMSIMD_PUBLIC void simsimd_##variation##_u32_sve2(                                                       \
+        simsimd_u32_t const *a, simsimd_u32_t const *b, simsimd_##weight_type##_t const *a_weights,           \
+        simsimd_##weight_type##_t const *b_weights, simsimd_size_t a_length, simsimd_size_t b_length,         \
+        simsimd_distance_t *results) {                                                                        \
+                                                                                                              \
+        simsimd_size_t const register_size = svcntw();                                                        \
+        simsimd_size_t a_idx = 0, b_idx = 0;                                                                  \
+        svfloat32_t product_vec = svdup_n_f32(0.f);                                                           \
+        simsimd_size_t intersection_size = 0;                                                                 \
+                                                                                                              \
+        while (a_idx < a_length && b_idx < b_length) {                                                        \
+            svbool_t a_progress = svwhilelt_b32_u64(a_idx, a_length);                                         \
+            svbool_t b_progress = svwhilelt_b32_u64(b_idx, b_length);                                         \
+            svuint32_t a_vec = svld1_u32(a_progress, a + a_idx);                                              \
+            svuint32_t b_vec = svld1_u32(b_progress, b + b_idx);                                              \
+            simsimd_u32_t a_min;                                                                              \
+            simsimd_u32_t a_max = svlastb(a_progress, a_vec);                                                 \
+            simsimd_u32_t b_min = svlasta(svpfalse_b(), b_vec);                                               \
+            simsimd_u32_t b_max = svlastb(b_progress, b_vec);                                                 \
+                                                                                                              \
+            /* If the slices don't overlap, advance the appropriate pointer */                                \
+            while (a_max < b_min && (a_idx + register_size) < a_length) {                                     \
+                a_idx += register_size;                                                                       \
+                a_progress = svwhilelt_b32_u64(a_idx, a_length);                                              \
+                a_vec = svld1_u32(a_progress, a + a_idx);                                                     \
+                a_max = svlastb(a_progress, a_vec);                                                           \
+            }                                                                                                 \
+            a_min = svlasta(svpfalse_b(), a_vec);                                                             \
+            while (b_max < a_min && (b_idx + register_size) < b_length) {                                     \
+                b_idx += register_size;                                                                       \
+                b_progress = svwhilelt_b32_u64(b_idx, b_length);                                              \
+                b_vec = svld1_u32(b_progress, b + b_idx);                                                     \
+                b_max = svlastb(b_progress, b_vec);                                                           \
+            }                                                                                                 \
+            b_min = svlasta(svpfalse_b(), b_vec);                                                             \
+                                                                                                              \
+            svbool_t a_mask = svcmple_n_u32(a_progress, a_vec, b_max);                                        \
+            svbool_t b_mask = svcmple_n_u32(b_progress, b_vec, a_max);                                        \
+            simsimd_u64_t a_step = svcntp_b32(a_progress, a_mask);                                            \
+            simsimd_u64_t b_step = svcntp_b32(b_progress, b_mask);                                            \
+                                                                                                              \
+            /* Pad the inactive lanes with the last active ones, so that they can't produce new matches. */   \
+            /* Both sides are sorted, so after compaction, the matching weights end up in the same lanes. */  \
+            a_vec = svsel_u32(a_progress, a_vec, svdup_n_u32(a_max));                                         \
+            b_vec = svsel_u32(b_progress, b_vec, svdup_n_u32(b_max));                                         \
+            svbool_t a_equal_mask = _simsimd_intersect_u32_mask_sve2(a_progress, a_vec, b_vec);               \
+            svbool_t b_equal_mask = _simsimd_intersect_u32_mask_sve2(b_progress, b_vec, a_vec);               \
+            svfloat32_t a_weights_vec = svcompact_f32(a_equal_mask, load_f32(a_progress, a_weights + a_idx)); \
+            svfloat32_t b_weights_vec = svcompact_f32(b_equal_mask, load_f32(b_progress, b_weights + b_idx)); \
+            product_vec = svmla_f32_x(svptrue_b32(), product_vec, a_weights_vec, b_weights_vec);              \
+            intersection_size += svcntp_b32(a_progress, a_equal_mask);                                        \
+                                                                                                              \
+            a_idx += a_step;                                                                                  \
+            b_idx += b_step;                                                                                  \
+        }                                                                                                     \
+        results[0] = (simsimd_distance_t)intersection_size;                                                   \
+        results[1] = svaddv_f32(svptrue_b32(), product_vec);                                                  \
+    }
+
+SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_SVE2(spdot_weights, bf16,
+                                    _simsimd_load_bf16_as_f32_sve2) // simsimd_spdot_weights_u32_sve2
+SIMSIMD_MAKE_SPDOT_WEIGHTS_U32_SVE2(spdot_weights_f32, f32,
+                                    _simsimd_load_f32_sve2) // simsimd_spdot_weights_f32_u32_sve2
+
+SIMSIMD_MAKE_INTERSECT_BATCH(sve2, u16, simsimd_intersect_u16_sve2) // simsimd_intersect_batch_u16_sve2
+SIMSIMD_MAKE_INTERSECT_BATCH(sve2, u32, simsimd_intersect_u32_sve2) // simsimd_intersect_batch_u32_sve2
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_SVE2
@@ -1416,6 +2279,8 @@ SIMSIMD_PUBLIC void simsimd_spdot_weights_u16_sve2(                   //
     results[1] = svaddv_f32(svptrue_b32(), product_vec);
 }
 
+SIMSIMD_MAKE_SPDOT_WEIGHTS_BATCH(sve2, simsimd_spdot_weights_u16_sve2) // simsimd_spdot_weights_batch_u16_sve2
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_SVE2 && SIMSIMD_TARGET_SVE_BF16
@@ -59,6 +59,9 @@ SIMSIMD_PUBLIC void simsimd_cos_i8_serial(simsimd_i8_t const* a, simsimd_i8_t co
 SIMSIMD_PUBLIC void simsimd_l2_u8_serial(simsimd_u8_t const* a, simsimd_u8_t const*, simsimd_size_t n, simsimd_distance_t* d);
 SIMSIMD_PUBLIC void simsimd_l2sq_u8_serial(simsimd_u8_t const* a, simsimd_u8_t const*, simsimd_size_t n, simsimd_distance_t* d);
 SIMSIMD_PUBLIC void simsimd_cos_u8_serial(simsimd_u8_t const* a, simsimd_u8_t const*, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_l2_i4x2_serial(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_l2sq_i4x2_serial(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_cos_i4x2_serial(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 
 /*  Double-precision serial backends for all numeric types.
  *  For single-precision computation check out the "*_serial" counterparts of those "*_accurate" functions.
@@ -94,6 +97,9 @@ SIMSIMD_PUBLIC void simsimd_cos_i8_neon(simsimd_i8_t const* a, simsimd_i8_t cons
 SIMSIMD_PUBLIC void simsimd_l2_u8_neon(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 SIMSIMD_PUBLIC void simsimd_l2sq_u8_neon(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 SIMSIMD_PUBLIC void simsimd_cos_u8_neon(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_l2_i4x2_neon(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_l2sq_i4x2_neon(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_cos_i4x2_neon(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 
 /*  SIMD-powered backends for Arm SVE, mostly using 32-bit arithmetic over variable-length platform-defined word sizes.
  *  Designed for Arm Graviton 3, Microsoft Cobalt, as well as Nvidia Grace and newer Ampere Altra CPUs.
@@ -110,6 +116,9 @@ SIMSIMD_PUBLIC void simsimd_cos_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t
 SIMSIMD_PUBLIC void simsimd_l2_f64_sve(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 SIMSIMD_PUBLIC void simsimd_l2sq_f64_sve(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 SIMSIMD_PUBLIC void simsimd_cos_f64_sve(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_l2_i4x2_sve(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_l2sq_i4x2_sve(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_cos_i4x2_sve(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 
 /*  SIMD-powered backends for AVX2 CPUs of Haswell generation and newer, using 32-bit arithmetic over 256-bit words.
  *  First demonstrated in 2011, at least one Haswell-based processor was still being sold in 2022 — the Pentium G3420.
@@ -123,6 +132,9 @@ SIMSIMD_PUBLIC void simsimd_cos_i8_haswell(simsimd_i8_t const* a, simsimd_i8_t c
 SIMSIMD_PUBLIC void simsimd_l2_u8_haswell(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 SIMSIMD_PUBLIC void simsimd_l2sq_u8_haswell(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 SIMSIMD_PUBLIC void simsimd_cos_u8_haswell(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_l2_i4x2_haswell(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_l2sq_i4x2_haswell(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+SIMSIMD_PUBLIC void simsimd_cos_i4x2_haswell(simsimd_i4x2_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 SIMSIMD_PUBLIC void simsimd_l2_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 SIMSIMD_PUBLIC void simsimd_l2sq_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t* d);
 SIMSIMD_PUBLIC void simsimd_cos_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t* d);
@@ -171,6 +183,169 @@ SIMSIMD_PUBLIC void simsimd_cos_f16_sapphire(simsimd_f16_t const* a, simsimd_f16
  *  The packs many "efficiency" cores into a single socket, avoiding heavy 512-bit operations, and focusing on 256-bit ones.
  */
 SIMSIMD_PUBLIC void simsimd_cos_i8_sierra(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t* d);
+
+/*  One-to-many backends, comparing a single query `a` against `b_count` rows of `b`, separated by `b_stride` bytes.
+ *  The query is loaded once per 4 candidate rows and, for the angular distance, its norm is computed only once.
+ */
+SIMSIMD_PUBLIC void simsimd_l2_batch_f64_serial(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f64_serial(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_f64_serial(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_u8_serial(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_u8_serial(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_u8_serial(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t* results);
+
+/*  Squared Euclidean norms of `count` rows of `rows`, separated by `stride` bytes, computed once and cached by the
+ *  caller. The one-to-many variants below derive the angular and Euclidean distances from a single dot-product stream,
+ *  given the squared norm of `a` and the squared norms of all rows of `b`. A missing `a_norm` is computed on the fly,
+ *  and missing `b_norms` fall back to the regular one-to-many kernels above.
+ */
+SIMSIMD_PUBLIC void simsimd_norms_f64_serial(simsimd_f64_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* norms);
+SIMSIMD_PUBLIC void simsimd_norms_f32_serial(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* norms);
+SIMSIMD_PUBLIC void simsimd_norms_f16_serial(simsimd_f16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* norms);
+SIMSIMD_PUBLIC void simsimd_norms_bf16_serial(simsimd_bf16_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* norms);
+SIMSIMD_PUBLIC void simsimd_norms_i8_serial(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* norms);
+SIMSIMD_PUBLIC void simsimd_norms_u8_serial(simsimd_u8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* norms);
+SIMSIMD_PUBLIC void simsimd_norms_f32_neon(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* norms);
+SIMSIMD_PUBLIC void simsimd_norms_f32_sve(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* norms);
+SIMSIMD_PUBLIC void simsimd_norms_f32_haswell(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* norms);
+SIMSIMD_PUBLIC void simsimd_norms_f32_skylake(simsimd_f32_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* norms);
+SIMSIMD_PUBLIC void simsimd_norms_i8_ice(simsimd_i8_t const* rows, simsimd_size_t count, simsimd_size_t stride, simsimd_size_t n, simsimd_distance_t* norms);
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_f64_serial(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_f64_serial(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_f64_serial(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_u8_serial(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_u8_serial(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_u8_serial(simsimd_u8_t const* a, simsimd_u8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_f32_sve(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2_batch_normed_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_cos_batch_normed_i8_ice(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const* a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* results);
+
+/*  Asymmetric backends, comparing an `f32` or `f16` query `a` against a quantized `i8`, `u8`, or `i4x2` row `b`.
+ *  Follow the same conventions for `n`, `scales`, `zero_points`, and `params_stride` as the `dot.h` variants.
+ */
+SIMSIMD_PUBLIC void simsimd_l2_f32i8_serial(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f32u8_serial(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f32i4x2_serial(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16i8_serial(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16u8_serial(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16i4x2_serial(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32i8_serial(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32u8_serial(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32i4x2_serial(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16i8_serial(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16u8_serial(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16i4x2_serial(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32i8_serial(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32u8_serial(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32i4x2_serial(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16i8_serial(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16u8_serial(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16i4x2_serial(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f32i8_neon(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f32u8_neon(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f32i4x2_neon(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32i8_neon(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32u8_neon(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32i4x2_neon(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32i8_neon(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32u8_neon(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32i4x2_neon(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16i8_neon(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16u8_neon(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16i4x2_neon(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16i8_neon(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16u8_neon(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16i4x2_neon(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16i8_neon(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16u8_neon(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16i4x2_neon(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f32i8_haswell(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f32u8_haswell(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f32i4x2_haswell(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16i8_haswell(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16u8_haswell(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16i4x2_haswell(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32i8_haswell(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32u8_haswell(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32i4x2_haswell(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16i8_haswell(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16u8_haswell(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16i4x2_haswell(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32i8_haswell(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32u8_haswell(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32i4x2_haswell(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16i8_haswell(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16u8_haswell(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16i4x2_haswell(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f32i8_skylake(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f32u8_skylake(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f32i4x2_skylake(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16i8_skylake(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16u8_skylake(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2_f16i4x2_skylake(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32i8_skylake(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32u8_skylake(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f32i4x2_skylake(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16i8_skylake(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16u8_skylake(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_l2sq_f16i4x2_skylake(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32i8_skylake(simsimd_f32_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32u8_skylake(simsimd_f32_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f32i4x2_skylake(simsimd_f32_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16i8_skylake(simsimd_f16_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16u8_skylake(simsimd_f16_t const* a, simsimd_u8_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_cos_f16i4x2_skylake(simsimd_f16_t const* a, simsimd_i4x2_t const* b, simsimd_size_t n, simsimd_f32_t const* scales, simsimd_f32_t const* zero_points, simsimd_size_t params_stride, simsimd_distance_t* result);
 // clang-format on
 
 #define SIMSIMD_MAKE_L2SQ(name, input_type, accumulator_type, load_and_convert)                                 \
@@ -214,6 +389,207 @@ SIMSIMD_PUBLIC void simsimd_cos_i8_sierra(simsimd_i8_t const* a, simsimd_i8_t co
         }                                                                                                      \
     }
 
+SIMSIMD_INTERNAL simsimd_distance_t _simsimd_cos_normalize_f64_serial(simsimd_f64_t ab, simsimd_f64_t a2,
+                                                                      simsimd_f64_t b2) {
+    if (a2 == 0 && b2 == 0) return 0;
+    else if (ab == 0)
+        return 1;
+    simsimd_distance_t unclipped_result = 1 - ab * SIMSIMD_RSQRT(a2) * SIMSIMD_RSQRT(b2);
+    return unclipped_result > 0 ? unclipped_result : 0;
+}
+
+#define SIMSIMD_MAKE_QUANTIZED_L2SQ(name, query_type, database_type, load_query, load_database)                \
+    SIMSIMD_PUBLIC void simsimd_l2sq_##query_type##database_type##_##name(                                     \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,             \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,          \
+        simsimd_distance_t *result) {                                                                         \
+        simsimd_f32_t d2 = 0;                                                                                 \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                             \
+            simsimd_f32_t ai = load_query(a + i);                                                             \
+            simsimd_f32_t bi = SIMSIMD_DEQUANTIZE(load_database(b, i), scales, zero_points, i * params_stride); \
+            d2 += (ai - bi) * (ai - bi);                                                                      \
+        }                                                                                                     \
+        *result = d2;                                                                                         \
+    }
+
+#define SIMSIMD_MAKE_QUANTIZED_L2(name, query_type, database_type)                                                \
+    SIMSIMD_PUBLIC void simsimd_l2_##query_type##database_type##_##name(                                          \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,                \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,             \
+        simsimd_distance_t *result) {                                                                            \
+        simsimd_l2sq_##query_type##database_type##_##name(a, b, n, scales, zero_points, params_stride, result); \
+        *result = SIMSIMD_SQRT(*result);                                                                         \
+    }
+
+#define SIMSIMD_MAKE_QUANTIZED_COS(name, query_type, database_type, load_query, load_database)                 \
+    SIMSIMD_PUBLIC void simsimd_cos_##query_type##database_type##_##name(                                      \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,             \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,          \
+        simsimd_distance_t *result) {                                                                         \
+        simsimd_f32_t ab = 0, a2 = 0, b2 = 0;                                                                 \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                             \
+            simsimd_f32_t ai = load_query(a + i);                                                             \
+            simsimd_f32_t bi = SIMSIMD_DEQUANTIZE(load_database(b, i), scales, zero_points, i * params_stride); \
+            ab += ai * bi, a2 += ai * ai, b2 += bi * bi;                                                      \
+        }                                                                                                     \
+        *result = _simsimd_cos_normalize_f64_serial(ab, a2, b2);                                              \
+    }
+
+SIMSIMD_MAKE_QUANTIZED_COS(serial, f32, i8, SIMSIMD_DEREFERENCE, SIMSIMD_INDEX)        // simsimd_cos_f32i8_serial
+SIMSIMD_MAKE_QUANTIZED_COS(serial, f32, u8, SIMSIMD_DEREFERENCE, SIMSIMD_INDEX)        // simsimd_cos_f32u8_serial
+SIMSIMD_MAKE_QUANTIZED_COS(serial, f32, i4x2, SIMSIMD_DEREFERENCE, SIMSIMD_I4X2_INDEX) // simsimd_cos_f32i4x2_serial
+SIMSIMD_MAKE_QUANTIZED_COS(serial, f16, i8, SIMSIMD_F16_TO_F32, SIMSIMD_INDEX)         // simsimd_cos_f16i8_serial
+SIMSIMD_MAKE_QUANTIZED_COS(serial, f16, u8, SIMSIMD_F16_TO_F32, SIMSIMD_INDEX)         // simsimd_cos_f16u8_serial
+SIMSIMD_MAKE_QUANTIZED_COS(serial, f16, i4x2, SIMSIMD_F16_TO_F32, SIMSIMD_I4X2_INDEX)  // simsimd_cos_f16i4x2_serial
+
+SIMSIMD_MAKE_QUANTIZED_L2SQ(serial, f32, i8, SIMSIMD_DEREFERENCE, SIMSIMD_INDEX)        // simsimd_l2sq_f32i8_serial
+SIMSIMD_MAKE_QUANTIZED_L2SQ(serial, f32, u8, SIMSIMD_DEREFERENCE, SIMSIMD_INDEX)        // simsimd_l2sq_f32u8_serial
+SIMSIMD_MAKE_QUANTIZED_L2SQ(serial, f32, i4x2, SIMSIMD_DEREFERENCE, SIMSIMD_I4X2_INDEX) // simsimd_l2sq_f32i4x2_serial
+SIMSIMD_MAKE_QUANTIZED_L2SQ(serial, f16, i8, SIMSIMD_F16_TO_F32, SIMSIMD_INDEX)         // simsimd_l2sq_f16i8_serial
+SIMSIMD_MAKE_QUANTIZED_L2SQ(serial, f16, u8, SIMSIMD_F16_TO_F32, SIMSIMD_INDEX)         // simsimd_l2sq_f16u8_serial
+SIMSIMD_MAKE_QUANTIZED_L2SQ(serial, f16, i4x2, SIMSIMD_F16_TO_F32, SIMSIMD_I4X2_INDEX)  // simsimd_l2sq_f16i4x2_serial
+
+SIMSIMD_MAKE_QUANTIZED_L2(serial, f32, i8)   // simsimd_l2_f32i8_serial
+SIMSIMD_MAKE_QUANTIZED_L2(serial, f32, u8)   // simsimd_l2_f32u8_serial
+SIMSIMD_MAKE_QUANTIZED_L2(serial, f32, i4x2) // simsimd_l2_f32i4x2_serial
+SIMSIMD_MAKE_QUANTIZED_L2(serial, f16, i8)   // simsimd_l2_f16i8_serial
+SIMSIMD_MAKE_QUANTIZED_L2(serial, f16, u8)   // simsimd_l2_f16u8_serial
+SIMSIMD_MAKE_QUANTIZED_L2(serial, f16, i4x2) // simsimd_l2_f16i4x2_serial
+
+#define SIMSIMD_MAKE_L2SQ_BATCH(name, input_type, accumulator_type, load_and_convert)                          \
+    SIMSIMD_PUBLIC void simsimd_l2sq_batch_##input_type##_##name(                                               \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t b_count,          \
+        simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results) {                              \
+        simsimd_size_t j = 0;                                                                                  \
+        for (; j + 4 <= b_count; j += 4) {                                                                     \
+            simsimd_##input_type##_t const *b0 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 0);     \
+            simsimd_##input_type##_t const *b1 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 1);     \
+            simsimd_##input_type##_t const *b2 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 2);     \
+            simsimd_##input_type##_t const *b3 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 3);     \
+            simsimd_##accumulator_type##_t d20 = 0, d21 = 0, d22 = 0, d23 = 0;                                 \
+            for (simsimd_size_t i = 0; i != n; ++i) {                                                          \
+                simsimd_##accumulator_type##_t ai = load_and_convert(a + i);                                   \
+                simsimd_##accumulator_type##_t d0 = ai - (simsimd_##accumulator_type##_t)load_and_convert(b0 + i); \
+                simsimd_##accumulator_type##_t d1 = ai - (simsimd_##accumulator_type##_t)load_and_convert(b1 + i); \
+                simsimd_##accumulator_type##_t d2 = ai - (simsimd_##accumulator_type##_t)load_and_convert(b2 + i); \
+                simsimd_##accumulator_type##_t d3 = ai - (simsimd_##accumulator_type##_t)load_and_convert(b3 + i); \
+                d20 += d0 * d0, d21 += d1 * d1, d22 += d2 * d2, d23 += d3 * d3;                                \
+            }                                                                                                  \
+            results[j + 0] = d20, results[j + 1] = d21, results[j + 2] = d22, results[j + 3] = d23;            \
+        }                                                                                                      \
+        for (; j != b_count; ++j)                                                                              \
+            simsimd_l2sq_##input_type##_##name(a, SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j), n,    \
+                                               results + j);                                                   \
+    }
+
+#define SIMSIMD_MAKE_L2_BATCH(name, input_type, accumulator_type, load_and_convert)                            \
+    SIMSIMD_PUBLIC void simsimd_l2_batch_##input_type##_##name(                                                 \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t b_count,          \
+        simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results) {                              \
+        simsimd_l2sq_batch_##input_type##_##name(a, b, b_count, b_stride, n, results);                         \
+        for (simsimd_size_t j = 0; j != b_count; ++j) results[j] = SIMSIMD_SQRT(results[j]);                   \
+    }
+
+#define SIMSIMD_MAKE_COS_BATCH(name, input_type, accumulator_type, load_and_convert)                           \
+    SIMSIMD_PUBLIC void simsimd_cos_batch_##input_type##_##name(                                                \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t b_count,          \
+        simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results) {                              \
+        simsimd_##accumulator_type##_t a2 = 0;                                                                 \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                              \
+            simsimd_##accumulator_type##_t ai = load_and_convert(a + i);                                       \
+            a2 += ai * ai;                                                                                     \
+        }                                                                                                      \
+        simsimd_size_t j = 0;                                                                                  \
+        for (; j + 4 <= b_count; j += 4) {                                                                     \
+            simsimd_##input_type##_t const *b0 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 0);     \
+            simsimd_##input_type##_t const *b1 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 1);     \
+            simsimd_##input_type##_t const *b2 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 2);     \
+            simsimd_##input_type##_t const *b3 = SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j + 3);     \
+            simsimd_##accumulator_type##_t ab0 = 0, ab1 = 0, ab2 = 0, ab3 = 0;                                 \
+            simsimd_##accumulator_type##_t b20 = 0, b21 = 0, b22 = 0, b23 = 0;                                 \
+            for (simsimd_size_t i = 0; i != n; ++i) {                                                          \
+                simsimd_##accumulator_type##_t ai = load_and_convert(a + i);                                   \
+                simsimd_##accumulator_type##_t bi0 = load_and_convert(b0 + i);                                 \
+                simsimd_##accumulator_type##_t bi1 = load_and_convert(b1 + i);                                 \
+                simsimd_##accumulator_type##_t bi2 = load_and_convert(b2 + i);                                 \
+                simsimd_##accumulator_type##_t bi3 = load_and_convert(b3 + i);                                 \
+                ab0 += ai * bi0, ab1 += ai * bi1, ab2 += ai * bi2, ab3 += ai * bi3;                            \
+                b20 += bi0 * bi0, b21 += bi1 * bi1, b22 += bi2 * bi2, b23 += bi3 * bi3;                        \
+            }                                                                                                  \
+            results[j + 0] = _simsimd_cos_normalize_f64_serial(ab0, a2, b20);                                  \
+            results[j + 1] = _simsimd_cos_normalize_f64_serial(ab1, a2, b21);                                  \
+            results[j + 2] = _simsimd_cos_normalize_f64_serial(ab2, a2, b22);                                  \
+            results[j + 3] = _simsimd_cos_normalize_f64_serial(ab3, a2, b23);                                  \
+        }                                                                                                      \
+        for (; j != b_count; ++j)                                                                              \
+            simsimd_cos_##input_type##_##name(a, SIMSIMD_ROW(simsimd_##input_type##_t, b, b_stride, j), n,     \
+                                              results + j);                                                    \
+    }
+
+/**
+ *  @brief  Squared norms of many rows, as a single dot-product stream per row, to be cached and reused by the
+ *          `_normed` kernels. Built on top of the dot-product kernel of the same backend.
+ */
+#define SIMSIMD_MAKE_NORMS(name, input_type)                                                               \
+    SIMSIMD_PUBLIC void simsimd_norms_##input_type##_##name(simsimd_##input_type##_t const *rows,          \
+                                                            simsimd_size_t count, simsimd_size_t stride,   \
+                                                            simsimd_size_t n, simsimd_distance_t *norms) { \
+        for (simsimd_size_t i = 0; i != count; ++i) {                                                      \
+            simsimd_##input_type##_t const *row = SIMSIMD_ROW(simsimd_##input_type##_t, rows, stride, i);  \
+            simsimd_dot_##input_type##_##name(row, row, n, norms + i);                                     \
+        }                                                                                                  \
+    }
+
+/**
+ *  @brief  One-to-many angular and Euclidean distances with precomputed squared norms, running only the dot-product
+ *          stream of the same backend. Like the distance matrices in `cdist.h`, the Euclidean distances are derived
+ *          as `|a|^2 + |b|^2 - 2 * a * b`, losing precision for almost identical vectors.
+ */
+#define SIMSIMD_MAKE_BATCH_NORMED(name, input_type)                                                            \
+    SIMSIMD_PUBLIC void simsimd_cos_batch_normed_##input_type##_##name(                                        \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t b_count,          \
+        simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const *a_norm,                           \
+        simsimd_distance_t const *b_norms, simsimd_distance_t *results) {                                      \
+        simsimd_distance_t a2;                                                                                 \
+        if (!b_norms) {                                                                                        \
+            simsimd_cos_batch_##input_type##_##name(a, b, b_count, b_stride, n, results);                      \
+            return;                                                                                            \
+        }                                                                                                      \
+        if (a_norm) a2 = *a_norm;                                                                              \
+        else simsimd_dot_##input_type##_##name(a, a, n, &a2);                                                  \
+        simsimd_dot_batch_##input_type##_##name(a, b, b_count, b_stride, n, results);                          \
+        for (simsimd_size_t j = 0; j != b_count; ++j)                                                          \
+            results[j] = _simsimd_cos_normalize_f64_serial(results[j], a2, b_norms[j]);                        \
+    }                                                                                                          \
+    SIMSIMD_PUBLIC void simsimd_l2sq_batch_normed_##input_type##_##name(                                       \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t b_count,          \
+        simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const *a_norm,                           \
+        simsimd_distance_t const *b_norms, simsimd_distance_t *results) {                                      \
+        simsimd_distance_t a2;                                                                                 \
+        if (!b_norms) {                                                                                        \
+            simsimd_l2sq_batch_##input_type##_##name(a, b, b_count, b_stride, n, results);                     \
+            return;                                                                                            \
+        }                                                                                                      \
+        if (a_norm) a2 = *a_norm;                                                                              \
+        else simsimd_dot_##input_type##_##name(a, a, n, &a2);                                                  \
+        simsimd_dot_batch_##input_type##_##name(a, b, b_count, b_stride, n, results);                          \
+        for (simsimd_size_t j = 0; j != b_count; ++j) {                                                        \
+            simsimd_distance_t d2 = a2 + b_norms[j] - 2 * results[j];                                          \
+            results[j] = d2 > 0 ? d2 : 0;                                                                      \
+        }                                                                                                      \
+    }                                                                                                          \
+    SIMSIMD_PUBLIC void simsimd_l2_batch_normed_##input_type##_##name(                                         \
+        simsimd_##input_type##_t const *a, simsimd_##input_type##_t const *b, simsimd_size_t b_count,          \
+        simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t const *a_norm,                           \
+        simsimd_distance_t const *b_norms, simsimd_distance_t *results) {                                      \
+        if (!b_norms) {                                                                                        \
+            simsimd_l2_batch_##input_type##_##name(a, b, b_count, b_stride, n, results);                       \
+            return;                                                                                            \
+        }                                                                                                      \
+        simsimd_l2sq_batch_normed_##input_type##_##name(a, b, b_count, b_stride, n, a_norm, b_norms, results); \
+        for (simsimd_size_t j = 0; j != b_count; ++j) results[j] = SIMSIMD_SQRT(results[j]);                   \
+    }
+
 SIMSIMD_MAKE_COS(serial, f64, f64, SIMSIMD_DEREFERENCE)  // simsimd_cos_f64_serial
 SIMSIMD_MAKE_L2SQ(serial, f64, f64, SIMSIMD_DEREFERENCE) // simsimd_l2sq_f64_serial
 SIMSIMD_MAKE_L2(serial, f64, f64, SIMSIMD_DEREFERENCE)   // simsimd_l2_f64_serial
@@ -238,6 +614,76 @@ SIMSIMD_MAKE_COS(serial, u8, i32, SIMSIMD_DEREFERENCE)  // simsimd_cos_u8_serial
 SIMSIMD_MAKE_L2SQ(serial, u8, i32, SIMSIMD_DEREFERENCE) // simsimd_l2sq_u8_serial
 SIMSIMD_MAKE_L2(serial, u8, i32, SIMSIMD_DEREFERENCE)   // simsimd_l2_u8_serial
 
+SIMSIMD_PUBLIC void simsimd_l2sq_i4x2_serial(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                             simsimd_distance_t *result) {
+    simsimd_i64_t d2 = 0;
+    for (simsimd_size_t i = 0; i != n_words; ++i) {
+        simsimd_i32_t d_low = SIMSIMD_I4X2_LOW(a[i]) - SIMSIMD_I4X2_LOW(b[i]);
+        simsimd_i32_t d_high = SIMSIMD_I4X2_HIGH(a[i]) - SIMSIMD_I4X2_HIGH(b[i]);
+        d2 += d_low * d_low + d_high * d_high;
+    }
+    *result = (simsimd_distance_t)d2;
+}
+SIMSIMD_PUBLIC void simsimd_l2_i4x2_serial(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                           simsimd_distance_t *result) {
+    simsimd_l2sq_i4x2_serial(a, b, n_words, result);
+    *result = SIMSIMD_SQRT(*result);
+}
+SIMSIMD_PUBLIC void simsimd_cos_i4x2_serial(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                            simsimd_distance_t *result) {
+    simsimd_i64_t ab = 0, a2 = 0, b2 = 0;
+    for (simsimd_size_t i = 0; i != n_words; ++i) {
+        simsimd_i32_t a_low = SIMSIMD_I4X2_LOW(a[i]), a_high = SIMSIMD_I4X2_HIGH(a[i]);
+        simsimd_i32_t b_low = SIMSIMD_I4X2_LOW(b[i]), b_high = SIMSIMD_I4X2_HIGH(b[i]);
+        ab += a_low * b_low + a_high * b_high;
+        a2 += a_low * a_low + a_high * a_high;
+        b2 += b_low * b_low + b_high * b_high;
+    }
+    *result = _simsimd_cos_normalize_f64_serial((simsimd_f64_t)ab, (simsimd_f64_t)a2, (simsimd_f64_t)b2);
+}
+
+SIMSIMD_MAKE_COS_BATCH(serial, f64, f64, SIMSIMD_DEREFERENCE)      // simsimd_cos_batch_f64_serial
+SIMSIMD_MAKE_L2SQ_BATCH(serial, f64, f64, SIMSIMD_DEREFERENCE)     // simsimd_l2sq_batch_f64_serial
+SIMSIMD_MAKE_L2_BATCH(serial, f64, f64, SIMSIMD_DEREFERENCE)       // simsimd_l2_batch_f64_serial
+
+SIMSIMD_MAKE_COS_BATCH(serial, f32, f32, SIMSIMD_DEREFERENCE)      // simsimd_cos_batch_f32_serial
+SIMSIMD_MAKE_L2SQ_BATCH(serial, f32, f32, SIMSIMD_DEREFERENCE)     // simsimd_l2sq_batch_f32_serial
+SIMSIMD_MAKE_L2_BATCH(serial, f32, f32, SIMSIMD_DEREFERENCE)       // simsimd_l2_batch_f32_serial
+
+SIMSIMD_MAKE_COS_BATCH(serial, f16, f32, SIMSIMD_F16_TO_F32)       // simsimd_cos_batch_f16_serial
+SIMSIMD_MAKE_L2SQ_BATCH(serial, f16, f32, SIMSIMD_F16_TO_F32)      // simsimd_l2sq_batch_f16_serial
+SIMSIMD_MAKE_L2_BATCH(serial, f16, f32, SIMSIMD_F16_TO_F32)        // simsimd_l2_batch_f16_serial
+
+SIMSIMD_MAKE_COS_BATCH(serial, bf16, f32, SIMSIMD_BF16_TO_F32)     // simsimd_cos_batch_bf16_serial
+SIMSIMD_MAKE_L2SQ_BATCH(serial, bf16, f32, SIMSIMD_BF16_TO_F32)    // simsimd_l2sq_batch_bf16_serial
+SIMSIMD_MAKE_L2_BATCH(serial, bf16, f32, SIMSIMD_BF16_TO_F32)      // simsimd_l2_batch_bf16_serial
+
+SIMSIMD_MAKE_COS_BATCH(serial, i8, i32, SIMSIMD_DEREFERENCE)       // simsimd_cos_batch_i8_serial
+SIMSIMD_MAKE_L2SQ_BATCH(serial, i8, i32, SIMSIMD_DEREFERENCE)      // simsimd_l2sq_batch_i8_serial
+SIMSIMD_MAKE_L2_BATCH(serial, i8, i32, SIMSIMD_DEREFERENCE)        // simsimd_l2_batch_i8_serial
+
+SIMSIMD_MAKE_COS_BATCH(serial, u8, i32, SIMSIMD_DEREFERENCE)       // simsimd_cos_batch_u8_serial
+SIMSIMD_MAKE_L2SQ_BATCH(serial, u8, i32, SIMSIMD_DEREFERENCE)      // simsimd_l2sq_batch_u8_serial
+SIMSIMD_MAKE_L2_BATCH(serial, u8, i32, SIMSIMD_DEREFERENCE)        // simsimd_l2_batch_u8_serial
+
+SIMSIMD_MAKE_NORMS(serial, f64)        // simsimd_norms_f64_serial
+SIMSIMD_MAKE_BATCH_NORMED(serial, f64) // simsimd_{cos,l2sq,l2}_batch_normed_f64_serial
+
+SIMSIMD_MAKE_NORMS(serial, f32)        // simsimd_norms_f32_serial
+SIMSIMD_MAKE_BATCH_NORMED(serial, f32) // simsimd_{cos,l2sq,l2}_batch_normed_f32_serial
+
+SIMSIMD_MAKE_NORMS(serial, f16)        // simsimd_norms_f16_serial
+SIMSIMD_MAKE_BATCH_NORMED(serial, f16) // simsimd_{cos,l2sq,l2}_batch_normed_f16_serial
+
+SIMSIMD_MAKE_NORMS(serial, bf16)        // simsimd_norms_bf16_serial
+SIMSIMD_MAKE_BATCH_NORMED(serial, bf16) // simsimd_{cos,l2sq,l2}_batch_normed_bf16_serial
+
+SIMSIMD_MAKE_NORMS(serial, i8)        // simsimd_norms_i8_serial
+SIMSIMD_MAKE_BATCH_NORMED(serial, i8) // simsimd_{cos,l2sq,l2}_batch_normed_i8_serial
+
+SIMSIMD_MAKE_NORMS(serial, u8)        // simsimd_norms_u8_serial
+SIMSIMD_MAKE_BATCH_NORMED(serial, u8) // simsimd_{cos,l2sq,l2}_batch_normed_u8_serial
+
 SIMSIMD_MAKE_COS(accurate, f32, f64, SIMSIMD_DEREFERENCE)  // simsimd_cos_f32_accurate
 SIMSIMD_MAKE_L2SQ(accurate, f32, f64, SIMSIMD_DEREFERENCE) // simsimd_l2sq_f32_accurate
 SIMSIMD_MAKE_L2(accurate, f32, f64, SIMSIMD_DEREFERENCE)   // simsimd_l2_f32_accurate
@@ -348,6 +794,91 @@ SIMSIMD_PUBLIC void simsimd_cos_f32_neon(simsimd_f32_t const *a, simsimd_f32_t c
     *result = _simsimd_cos_normalize_f64_neon(ab, a2, b2);
 }
 
+SIMSIMD_PUBLIC void simsimd_l2_batch_f32_neon(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n,
+                                              simsimd_distance_t *results) {
+    simsimd_l2sq_batch_f32_neon(a, b, b_count, b_stride, n, results);
+    for (simsimd_size_t j = 0; j != b_count; ++j) results[j] = _simsimd_sqrt_f64_neon(results[j]);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f32_neon(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                                simsimd_size_t b_stride, simsimd_size_t n,
+                                                simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        float32x4_t d20_vec = vdupq_n_f32(0), d21_vec = vdupq_n_f32(0);
+        float32x4_t d22_vec = vdupq_n_f32(0), d23_vec = vdupq_n_f32(0);
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t a_vec = vld1q_f32(a + i);
+            float32x4_t d0_vec = vsubq_f32(a_vec, vld1q_f32(b0 + i));
+            float32x4_t d1_vec = vsubq_f32(a_vec, vld1q_f32(b1 + i));
+            float32x4_t d2_vec = vsubq_f32(a_vec, vld1q_f32(b2 + i));
+            float32x4_t d3_vec = vsubq_f32(a_vec, vld1q_f32(b3 + i));
+            d20_vec = vfmaq_f32(d20_vec, d0_vec, d0_vec);
+            d21_vec = vfmaq_f32(d21_vec, d1_vec, d1_vec);
+            d22_vec = vfmaq_f32(d22_vec, d2_vec, d2_vec);
+            d23_vec = vfmaq_f32(d23_vec, d3_vec, d3_vec);
+        }
+        simsimd_f32_t d20 = vaddvq_f32(d20_vec), d21 = vaddvq_f32(d21_vec);
+        simsimd_f32_t d22 = vaddvq_f32(d22_vec), d23 = vaddvq_f32(d23_vec);
+        for (; i < n; ++i) {
+            simsimd_f32_t d0 = a[i] - b0[i], d1 = a[i] - b1[i], d2 = a[i] - b2[i], d3 = a[i] - b3[i];
+            d20 += d0 * d0, d21 += d1 * d1, d22 += d2 * d2, d23 += d3 * d3;
+        }
+        results[j + 0] = d20, results[j + 1] = d21, results[j + 2] = d22, results[j + 3] = d23;
+    }
+    for (; j != b_count; ++j) simsimd_l2sq_f32_neon(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_batch_f32_neon(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                               simsimd_size_t b_stride, simsimd_size_t n,
+                                               simsimd_distance_t *results) {
+    simsimd_distance_t a2;
+    simsimd_dot_f32_neon(a, a, n, &a2);
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        float32x4_t ab0_vec = vdupq_n_f32(0), ab1_vec = vdupq_n_f32(0);
+        float32x4_t ab2_vec = vdupq_n_f32(0), ab3_vec = vdupq_n_f32(0);
+        float32x4_t b20_vec = vdupq_n_f32(0), b21_vec = vdupq_n_f32(0);
+        float32x4_t b22_vec = vdupq_n_f32(0), b23_vec = vdupq_n_f32(0);
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t a_vec = vld1q_f32(a + i);
+            float32x4_t b0_vec = vld1q_f32(b0 + i), b1_vec = vld1q_f32(b1 + i);
+            float32x4_t b2_vec = vld1q_f32(b2 + i), b3_vec = vld1q_f32(b3 + i);
+            ab0_vec = vfmaq_f32(ab0_vec, a_vec, b0_vec), b20_vec = vfmaq_f32(b20_vec, b0_vec, b0_vec);
+            ab1_vec = vfmaq_f32(ab1_vec, a_vec, b1_vec), b21_vec = vfmaq_f32(b21_vec, b1_vec, b1_vec);
+            ab2_vec = vfmaq_f32(ab2_vec, a_vec, b2_vec), b22_vec = vfmaq_f32(b22_vec, b2_vec, b2_vec);
+            ab3_vec = vfmaq_f32(ab3_vec, a_vec, b3_vec), b23_vec = vfmaq_f32(b23_vec, b3_vec, b3_vec);
+        }
+        simsimd_f32_t ab0 = vaddvq_f32(ab0_vec), ab1 = vaddvq_f32(ab1_vec);
+        simsimd_f32_t ab2 = vaddvq_f32(ab2_vec), ab3 = vaddvq_f32(ab3_vec);
+        simsimd_f32_t b20 = vaddvq_f32(b20_vec), b21 = vaddvq_f32(b21_vec);
+        simsimd_f32_t b22 = vaddvq_f32(b22_vec), b23 = vaddvq_f32(b23_vec);
+        for (; i < n; ++i) {
+            simsimd_f32_t ai = a[i], bi0 = b0[i], bi1 = b1[i], bi2 = b2[i], bi3 = b3[i];
+            ab0 += ai * bi0, ab1 += ai * bi1, ab2 += ai * bi2, ab3 += ai * bi3;
+            b20 += bi0 * bi0, b21 += bi1 * bi1, b22 += bi2 * bi2, b23 += bi3 * bi3;
+        }
+        results[j + 0] = _simsimd_cos_normalize_f64_neon(ab0, a2, b20);
+        results[j + 1] = _simsimd_cos_normalize_f64_neon(ab1, a2, b21);
+        results[j + 2] = _simsimd_cos_normalize_f64_neon(ab2, a2, b22);
+        results[j + 3] = _simsimd_cos_normalize_f64_neon(ab3, a2, b23);
+    }
+    for (; j != b_count; ++j) simsimd_cos_f32_neon(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
+SIMSIMD_MAKE_NORMS(neon, f32)        // simsimd_norms_f32_neon
+SIMSIMD_MAKE_BATCH_NORMED(neon, f32) // simsimd_{cos,l2sq,l2}_batch_normed_f32_neon
+
 SIMSIMD_PUBLIC void simsimd_l2_f64_neon(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
                                         simsimd_distance_t *result) {
     simsimd_l2sq_f64_neon(a, b, n, result);
@@ -391,6 +922,85 @@ SIMSIMD_PUBLIC void simsimd_cos_f64_neon(simsimd_f64_t const *a, simsimd_f64_t c
     *result = _simsimd_cos_normalize_f64_neon(ab, a2, b2);
 }
 
+#define SIMSIMD_MAKE_QUANTIZED_L2SQ_NEON(query_type, database_type, load_query, load_database, load_query_scalar,     \
+                                         load_database_scalar)                                                        \
+    SIMSIMD_PUBLIC void simsimd_l2sq_##query_type##database_type##_neon(                                              \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,                    \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,                  \
+        simsimd_distance_t *result) {                                                                                 \
+        float32x4_t a_low_vec, a_high_vec, b_low_vec, b_high_vec;                                                     \
+        float32x4_t d2_vec = vdupq_n_f32(0);                                                                          \
+        simsimd_size_t i = 0;                                                                                         \
+        for (; i + 8 <= n; i += 8) {                                                                                  \
+            load_query(a, i, &a_low_vec, &a_high_vec);                                                                \
+            load_database(b, i, &b_low_vec, &b_high_vec);                                                             \
+            _simsimd_dequantize_f32x8_neon(scales, zero_points, params_stride, i, &b_low_vec, &b_high_vec);           \
+            float32x4_t d_low_vec = vsubq_f32(a_low_vec, b_low_vec);                                                  \
+            float32x4_t d_high_vec = vsubq_f32(a_high_vec, b_high_vec);                                               \
+            d2_vec = vfmaq_f32(vfmaq_f32(d2_vec, d_low_vec, d_low_vec), d_high_vec, d_high_vec);                      \
+        }                                                                                                             \
+        simsimd_f32_t d2 = vaddvq_f32(d2_vec);                                                                        \
+        for (; i < n; ++i) {                                                                                          \
+            simsimd_f32_t d = load_query_scalar(a + i) -                                                              \
+                              SIMSIMD_DEQUANTIZE(load_database_scalar(b, i), scales, zero_points, i * params_stride); \
+            d2 += d * d;                                                                                              \
+        }                                                                                                             \
+        *result = d2;                                                                                                 \
+    }
+
+#define SIMSIMD_MAKE_QUANTIZED_L2_NEON(query_type, database_type)                                             \
+    SIMSIMD_PUBLIC void simsimd_l2_##query_type##database_type##_neon(                                        \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,            \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,          \
+        simsimd_distance_t *result) {                                                                         \
+        simsimd_l2sq_##query_type##database_type##_neon(a, b, n, scales, zero_points, params_stride, result); \
+        *result = _simsimd_sqrt_f32_neon(*result);                                                            \
+    }
+
+#define SIMSIMD_MAKE_QUANTIZED_COS_NEON(query_type, database_type, load_query, load_database, load_query_scalar,       \
+                                        load_database_scalar)                                                          \
+    SIMSIMD_PUBLIC void simsimd_cos_##query_type##database_type##_neon(                                                \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,                     \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,                   \
+        simsimd_distance_t *result) {                                                                                  \
+        float32x4_t a_low_vec, a_high_vec, b_low_vec, b_high_vec;                                                      \
+        float32x4_t ab_vec = vdupq_n_f32(0), a2_vec = vdupq_n_f32(0), b2_vec = vdupq_n_f32(0);                         \
+        simsimd_size_t i = 0;                                                                                          \
+        for (; i + 8 <= n; i += 8) {                                                                                   \
+            load_query(a, i, &a_low_vec, &a_high_vec);                                                                 \
+            load_database(b, i, &b_low_vec, &b_high_vec);                                                              \
+            _simsimd_dequantize_f32x8_neon(scales, zero_points, params_stride, i, &b_low_vec, &b_high_vec);            \
+            ab_vec = vfmaq_f32(vfmaq_f32(ab_vec, a_low_vec, b_low_vec), a_high_vec, b_high_vec);                       \
+            a2_vec = vfmaq_f32(vfmaq_f32(a2_vec, a_low_vec, a_low_vec), a_high_vec, a_high_vec);                       \
+            b2_vec = vfmaq_f32(vfmaq_f32(b2_vec, b_low_vec, b_low_vec), b_high_vec, b_high_vec);                       \
+        }                                                                                                              \
+        simsimd_f32_t ab = vaddvq_f32(ab_vec), a2 = vaddvq_f32(a2_vec), b2 = vaddvq_f32(b2_vec);                       \
+        for (; i < n; ++i) {                                                                                           \
+            simsimd_f32_t ai = load_query_scalar(a + i);                                                               \
+            simsimd_f32_t bi = SIMSIMD_DEQUANTIZE(load_database_scalar(b, i), scales, zero_points, i * params_stride); \
+            ab += ai * bi, a2 += ai * ai, b2 += bi * bi;                                                               \
+        }                                                                                                              \
+        *result = _simsimd_cos_normalize_f32_neon(ab, a2, b2);                                                         \
+    }
+
+SIMSIMD_MAKE_QUANTIZED_L2SQ_NEON(f32, i8, _simsimd_load_f32x8_neon, _simsimd_load_i8x8_neon, SIMSIMD_DEREFERENCE,
+                                 SIMSIMD_INDEX) // simsimd_l2sq_f32i8_neon
+SIMSIMD_MAKE_QUANTIZED_L2SQ_NEON(f32, u8, _simsimd_load_f32x8_neon, _simsimd_load_u8x8_neon, SIMSIMD_DEREFERENCE,
+                                 SIMSIMD_INDEX) // simsimd_l2sq_f32u8_neon
+SIMSIMD_MAKE_QUANTIZED_L2SQ_NEON(f32, i4x2, _simsimd_load_f32x8_neon, _simsimd_load_i4x8_neon, SIMSIMD_DEREFERENCE,
+                                 SIMSIMD_I4X2_INDEX) // simsimd_l2sq_f32i4x2_neon
+
+SIMSIMD_MAKE_QUANTIZED_L2_NEON(f32, i8) // simsimd_l2_f32i8_neon
+SIMSIMD_MAKE_QUANTIZED_L2_NEON(f32, u8) // simsimd_l2_f32u8_neon
+SIMSIMD_MAKE_QUANTIZED_L2_NEON(f32, i4x2) // simsimd_l2_f32i4x2_neon
+
+SIMSIMD_MAKE_QUANTIZED_COS_NEON(f32, i8, _simsimd_load_f32x8_neon, _simsimd_load_i8x8_neon, SIMSIMD_DEREFERENCE,
+                                SIMSIMD_INDEX) // simsimd_cos_f32i8_neon
+SIMSIMD_MAKE_QUANTIZED_COS_NEON(f32, u8, _simsimd_load_f32x8_neon, _simsimd_load_u8x8_neon, SIMSIMD_DEREFERENCE,
+                                SIMSIMD_INDEX) // simsimd_cos_f32u8_neon
+SIMSIMD_MAKE_QUANTIZED_COS_NEON(f32, i4x2, _simsimd_load_f32x8_neon, _simsimd_load_i4x8_neon, SIMSIMD_DEREFERENCE,
+                                SIMSIMD_I4X2_INDEX) // simsimd_cos_f32i4x2_neon
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_NEON
@@ -453,6 +1063,24 @@ simsimd_cos_f16_neon_cycle:
     *result = _simsimd_cos_normalize_f32_neon(ab, a2, b2);
 }
 
+SIMSIMD_MAKE_QUANTIZED_L2SQ_NEON(f16, i8, _simsimd_load_f16x8_neon, _simsimd_load_i8x8_neon, SIMSIMD_F16_TO_F32,
+                                 SIMSIMD_INDEX) // simsimd_l2sq_f16i8_neon
+SIMSIMD_MAKE_QUANTIZED_L2SQ_NEON(f16, u8, _simsimd_load_f16x8_neon, _simsimd_load_u8x8_neon, SIMSIMD_F16_TO_F32,
+                                 SIMSIMD_INDEX) // simsimd_l2sq_f16u8_neon
+SIMSIMD_MAKE_QUANTIZED_L2SQ_NEON(f16, i4x2, _simsimd_load_f16x8_neon, _simsimd_load_i4x8_neon, SIMSIMD_F16_TO_F32,
+                                 SIMSIMD_I4X2_INDEX) // simsimd_l2sq_f16i4x2_neon
+
+SIMSIMD_MAKE_QUANTIZED_L2_NEON(f16, i8) // simsimd_l2_f16i8_neon
+SIMSIMD_MAKE_QUANTIZED_L2_NEON(f16, u8) // simsimd_l2_f16u8_neon
+SIMSIMD_MAKE_QUANTIZED_L2_NEON(f16, i4x2) // simsimd_l2_f16i4x2_neon
+
+SIMSIMD_MAKE_QUANTIZED_COS_NEON(f16, i8, _simsimd_load_f16x8_neon, _simsimd_load_i8x8_neon, SIMSIMD_F16_TO_F32,
+                                SIMSIMD_INDEX) // simsimd_cos_f16i8_neon
+SIMSIMD_MAKE_QUANTIZED_COS_NEON(f16, u8, _simsimd_load_f16x8_neon, _simsimd_load_u8x8_neon, SIMSIMD_F16_TO_F32,
+                                SIMSIMD_INDEX) // simsimd_cos_f16u8_neon
+SIMSIMD_MAKE_QUANTIZED_COS_NEON(f16, i4x2, _simsimd_load_f16x8_neon, _simsimd_load_i4x8_neon, SIMSIMD_F16_TO_F32,
+                                SIMSIMD_I4X2_INDEX) // simsimd_cos_f16i4x2_neon
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_NEON_F16
@@ -772,6 +1400,66 @@ SIMSIMD_PUBLIC void simsimd_cos_u8_neon(simsimd_u8_t const *a, simsimd_u8_t cons
     *result = _simsimd_cos_normalize_f32_neon(ab, a2, b2);
 }
 
+SIMSIMD_PUBLIC void simsimd_l2_i4x2_neon(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                         simsimd_distance_t *result) {
+    simsimd_l2sq_i4x2_neon(a, b, n_words, result);
+    *result = _simsimd_sqrt_f32_neon(*result);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_i4x2_neon(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                           simsimd_distance_t *result) {
+    uint32x4_t d2_vec = vdupq_n_u32(0);
+    simsimd_size_t i = 0;
+    for (; i + 16 <= n_words; i += 16) {
+        int8x16_t a_vec = vreinterpretq_s8_u8(vld1q_u8(a + i));
+        int8x16_t b_vec = vreinterpretq_s8_u8(vld1q_u8(b + i));
+        // The absolute difference of two 4-bit integers is at most 15, so it's safe to treat it as unsigned
+        uint8x16_t d_low_vec = vreinterpretq_u8_s8(vabdq_s8(vshrq_n_s8(vshlq_n_s8(a_vec, 4), 4),  //
+                                                            vshrq_n_s8(vshlq_n_s8(b_vec, 4), 4))); //
+        uint8x16_t d_high_vec = vreinterpretq_u8_s8(vabdq_s8(vshrq_n_s8(a_vec, 4), vshrq_n_s8(b_vec, 4)));
+        d2_vec = vdotq_u32(d2_vec, d_low_vec, d_low_vec);
+        d2_vec = vdotq_u32(d2_vec, d_high_vec, d_high_vec);
+    }
+    uint32_t d2 = vaddvq_u32(d2_vec);
+    for (; i < n_words; ++i) {
+        int32_t d_low = SIMSIMD_I4X2_LOW(a[i]) - SIMSIMD_I4X2_LOW(b[i]);
+        int32_t d_high = SIMSIMD_I4X2_HIGH(a[i]) - SIMSIMD_I4X2_HIGH(b[i]);
+        d2 += (uint32_t)(d_low * d_low + d_high * d_high);
+    }
+    *result = d2;
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_i4x2_neon(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                          simsimd_distance_t *result) {
+
+    simsimd_size_t i = 0;
+    int32x4_t ab_vec = vdupq_n_s32(0);
+    int32x4_t a2_vec = vdupq_n_s32(0);
+    int32x4_t b2_vec = vdupq_n_s32(0);
+    for (; i + 16 <= n_words; i += 16) {
+        int8x16_t a_vec = vreinterpretq_s8_u8(vld1q_u8(a + i));
+        int8x16_t b_vec = vreinterpretq_s8_u8(vld1q_u8(b + i));
+        int8x16_t a_low_vec = vshrq_n_s8(vshlq_n_s8(a_vec, 4), 4), a_high_vec = vshrq_n_s8(a_vec, 4);
+        int8x16_t b_low_vec = vshrq_n_s8(vshlq_n_s8(b_vec, 4), 4), b_high_vec = vshrq_n_s8(b_vec, 4);
+        ab_vec = vdotq_s32(vdotq_s32(ab_vec, a_low_vec, b_low_vec), a_high_vec, b_high_vec);
+        a2_vec = vdotq_s32(vdotq_s32(a2_vec, a_low_vec, a_low_vec), a_high_vec, a_high_vec);
+        b2_vec = vdotq_s32(vdotq_s32(b2_vec, b_low_vec, b_low_vec), b_high_vec, b_high_vec);
+    }
+    int32_t ab = vaddvq_s32(ab_vec);
+    int32_t a2 = vaddvq_s32(a2_vec);
+    int32_t b2 = vaddvq_s32(b2_vec);
+
+    // Take care of the tail:
+    for (; i < n_words; ++i) {
+        int32_t a_low = SIMSIMD_I4X2_LOW(a[i]), a_high = SIMSIMD_I4X2_HIGH(a[i]);
+        int32_t b_low = SIMSIMD_I4X2_LOW(b[i]), b_high = SIMSIMD_I4X2_HIGH(b[i]);
+        ab += a_low * b_low + a_high * b_high;
+        a2 += a_low * a_low + a_high * a_high;
+        b2 += b_low * b_low + b_high * b_high;
+    }
+
+    *result = _simsimd_cos_normalize_f32_neon(ab, a2, b2);
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_NEON_I8
@@ -824,6 +1512,86 @@ SIMSIMD_PUBLIC void simsimd_cos_f32_sve(simsimd_f32_t const *a, simsimd_f32_t co
     *result = _simsimd_cos_normalize_f64_neon(ab, a2, b2);
 }
 
+SIMSIMD_PUBLIC void simsimd_l2_batch_f32_sve(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                             simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results) {
+    simsimd_l2sq_batch_f32_sve(a, b, b_count, b_stride, n, results);
+    for (simsimd_size_t j = 0; j != b_count; ++j) results[j] = _simsimd_sqrt_f64_neon(results[j]);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f32_sve(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                               simsimd_size_t b_stride, simsimd_size_t n,
+                                               simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        svfloat32_t d20_vec = svdup_f32(0.f), d21_vec = svdup_f32(0.f);
+        svfloat32_t d22_vec = svdup_f32(0.f), d23_vec = svdup_f32(0.f);
+        simsimd_size_t i = 0;
+        do {
+            svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+            svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+            svfloat32_t d0_vec = svsub_f32_x(pg_vec, a_vec, svld1_f32(pg_vec, b0 + i));
+            svfloat32_t d1_vec = svsub_f32_x(pg_vec, a_vec, svld1_f32(pg_vec, b1 + i));
+            svfloat32_t d2_vec = svsub_f32_x(pg_vec, a_vec, svld1_f32(pg_vec, b2 + i));
+            svfloat32_t d3_vec = svsub_f32_x(pg_vec, a_vec, svld1_f32(pg_vec, b3 + i));
+            d20_vec = svmla_f32_m(pg_vec, d20_vec, d0_vec, d0_vec);
+            d21_vec = svmla_f32_m(pg_vec, d21_vec, d1_vec, d1_vec);
+            d22_vec = svmla_f32_m(pg_vec, d22_vec, d2_vec, d2_vec);
+            d23_vec = svmla_f32_m(pg_vec, d23_vec, d3_vec, d3_vec);
+            i += svcntw();
+        } while (i < n);
+        results[j + 0] = svaddv_f32(svptrue_b32(), d20_vec);
+        results[j + 1] = svaddv_f32(svptrue_b32(), d21_vec);
+        results[j + 2] = svaddv_f32(svptrue_b32(), d22_vec);
+        results[j + 3] = svaddv_f32(svptrue_b32(), d23_vec);
+    }
+    for (; j != b_count; ++j) simsimd_l2sq_f32_sve(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_batch_f32_sve(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n,
+                                              simsimd_distance_t *results) {
+    simsimd_distance_t a2;
+    simsimd_dot_f32_sve(a, a, n, &a2);
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        svfloat32_t ab0_vec = svdup_f32(0.f), ab1_vec = svdup_f32(0.f);
+        svfloat32_t ab2_vec = svdup_f32(0.f), ab3_vec = svdup_f32(0.f);
+        svfloat32_t b20_vec = svdup_f32(0.f), b21_vec = svdup_f32(0.f);
+        svfloat32_t b22_vec = svdup_f32(0.f), b23_vec = svdup_f32(0.f);
+        simsimd_size_t i = 0;
+        do {
+            svbool_t pg_vec = svwhilelt_b32((unsigned int)i, (unsigned int)n);
+            svfloat32_t a_vec = svld1_f32(pg_vec, a + i);
+            svfloat32_t b0_vec = svld1_f32(pg_vec, b0 + i), b1_vec = svld1_f32(pg_vec, b1 + i);
+            svfloat32_t b2_vec = svld1_f32(pg_vec, b2 + i), b3_vec = svld1_f32(pg_vec, b3 + i);
+            ab0_vec = svmla_f32_m(pg_vec, ab0_vec, a_vec, b0_vec), b20_vec = svmla_f32_m(pg_vec, b20_vec, b0_vec, b0_vec);
+            ab1_vec = svmla_f32_m(pg_vec, ab1_vec, a_vec, b1_vec), b21_vec = svmla_f32_m(pg_vec, b21_vec, b1_vec, b1_vec);
+            ab2_vec = svmla_f32_m(pg_vec, ab2_vec, a_vec, b2_vec), b22_vec = svmla_f32_m(pg_vec, b22_vec, b2_vec, b2_vec);
+            ab3_vec = svmla_f32_m(pg_vec, ab3_vec, a_vec, b3_vec), b23_vec = svmla_f32_m(pg_vec, b23_vec, b3_vec, b3_vec);
+            i += svcntw();
+        } while (i < n);
+        results[j + 0] = _simsimd_cos_normalize_f64_neon(svaddv_f32(svptrue_b32(), ab0_vec), a2,
+                                                         svaddv_f32(svptrue_b32(), b20_vec));
+        results[j + 1] = _simsimd_cos_normalize_f64_neon(svaddv_f32(svptrue_b32(), ab1_vec), a2,
+                                                         svaddv_f32(svptrue_b32(), b21_vec));
+        results[j + 2] = _simsimd_cos_normalize_f64_neon(svaddv_f32(svptrue_b32(), ab2_vec), a2,
+                                                         svaddv_f32(svptrue_b32(), b22_vec));
+        results[j + 3] = _simsimd_cos_normalize_f64_neon(svaddv_f32(svptrue_b32(), ab3_vec), a2,
+                                                         svaddv_f32(svptrue_b32(), b23_vec));
+    }
+    for (; j != b_count; ++j) simsimd_cos_f32_sve(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
+SIMSIMD_MAKE_NORMS(sve, f32)        // simsimd_norms_f32_sve
+SIMSIMD_MAKE_BATCH_NORMED(sve, f32) // simsimd_{cos,l2sq,l2}_batch_normed_f32_sve
+
 SIMSIMD_PUBLIC void simsimd_l2_f64_sve(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
                                        simsimd_distance_t *result) {
     simsimd_l2sq_f64_sve(a, b, n, result);
@@ -867,6 +1635,57 @@ SIMSIMD_PUBLIC void simsimd_cos_f64_sve(simsimd_f64_t const *a, simsimd_f64_t co
     *result = _simsimd_cos_normalize_f64_neon(ab, a2, b2);
 }
 
+SIMSIMD_PUBLIC void simsimd_l2_i4x2_sve(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                        simsimd_distance_t *result) {
+    simsimd_l2sq_i4x2_sve(a, b, n_words, result);
+    *result = _simsimd_sqrt_f64_neon(*result);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_i4x2_sve(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                          simsimd_distance_t *result) {
+    simsimd_size_t i = 0;
+    svuint32_t d2_vec = svdup_n_u32(0);
+    do {
+        svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n_words);
+        svint8_t a_vec = svreinterpret_s8_u8(svld1_u8(pg_vec, a + i));
+        svint8_t b_vec = svreinterpret_s8_u8(svld1_u8(pg_vec, b + i));
+        svint8_t a_low_vec = svasr_n_s8_x(pg_vec, svlsl_n_s8_x(pg_vec, a_vec, 4), 4);
+        svint8_t b_low_vec = svasr_n_s8_x(pg_vec, svlsl_n_s8_x(pg_vec, b_vec, 4), 4);
+        // Zeroing the inactive lanes, so that the unpredicated `svdot` can consume them
+        svuint8_t d_low_vec = svreinterpret_u8_s8(svabd_s8_z(pg_vec, a_low_vec, b_low_vec));
+        svuint8_t d_high_vec = svreinterpret_u8_s8(
+            svabd_s8_z(pg_vec, svasr_n_s8_x(pg_vec, a_vec, 4), svasr_n_s8_x(pg_vec, b_vec, 4)));
+        d2_vec = svdot_u32(svdot_u32(d2_vec, d_low_vec, d_low_vec), d_high_vec, d_high_vec);
+        i += svcntb();
+    } while (i < n_words);
+    *result = svaddv_u32(svptrue_b32(), d2_vec);
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_i4x2_sve(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                         simsimd_distance_t *result) {
+    simsimd_size_t i = 0;
+    svint32_t ab_vec = svdup_n_s32(0);
+    svint32_t a2_vec = svdup_n_s32(0);
+    svint32_t b2_vec = svdup_n_s32(0);
+    do {
+        svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n_words);
+        svint8_t a_vec = svreinterpret_s8_u8(svld1_u8(pg_vec, a + i));
+        svint8_t b_vec = svreinterpret_s8_u8(svld1_u8(pg_vec, b + i));
+        svint8_t a_low_vec = svasr_n_s8_z(pg_vec, svlsl_n_s8_z(pg_vec, a_vec, 4), 4);
+        svint8_t b_low_vec = svasr_n_s8_z(pg_vec, svlsl_n_s8_z(pg_vec, b_vec, 4), 4);
+        svint8_t a_high_vec = svasr_n_s8_z(pg_vec, a_vec, 4);
+        svint8_t b_high_vec = svasr_n_s8_z(pg_vec, b_vec, 4);
+        ab_vec = svdot_s32(svdot_s32(ab_vec, a_low_vec, b_low_vec), a_high_vec, b_high_vec);
+        a2_vec = svdot_s32(svdot_s32(a2_vec, a_low_vec, a_low_vec), a_high_vec, a_high_vec);
+        b2_vec = svdot_s32(svdot_s32(b2_vec, b_low_vec, b_low_vec), b_high_vec, b_high_vec);
+        i += svcntb();
+    } while (i < n_words);
+
+    simsimd_i32_t ab = (simsimd_i32_t)svaddv_s32(svptrue_b32(), ab_vec);
+    simsimd_i32_t a2 = (simsimd_i32_t)svaddv_s32(svptrue_b32(), a2_vec);
+    simsimd_i32_t b2 = (simsimd_i32_t)svaddv_s32(svptrue_b32(), b2_vec);
+    *result = _simsimd_cos_normalize_f64_neon(ab, a2, b2);
+}
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_SVE
@@ -1442,6 +2261,91 @@ SIMSIMD_PUBLIC void simsimd_cos_f32_haswell(simsimd_f32_t const *a, simsimd_f32_
     *result = _simsimd_cos_normalize_f64_haswell(ab, a2, b2);
 }
 
+SIMSIMD_PUBLIC void simsimd_l2_batch_f32_haswell(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                 simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t *results) {
+    simsimd_l2sq_batch_f32_haswell(a, b, b_count, b_stride, n, results);
+    for (simsimd_size_t j = 0; j != b_count; ++j) results[j] = _simsimd_sqrt_f32_haswell(results[j]);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f32_haswell(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        __m256 d20_vec = _mm256_setzero_ps(), d21_vec = _mm256_setzero_ps();
+        __m256 d22_vec = _mm256_setzero_ps(), d23_vec = _mm256_setzero_ps();
+        simsimd_size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256 a_vec = _mm256_loadu_ps(a + i);
+            __m256 d0_vec = _mm256_sub_ps(a_vec, _mm256_loadu_ps(b0 + i));
+            __m256 d1_vec = _mm256_sub_ps(a_vec, _mm256_loadu_ps(b1 + i));
+            __m256 d2_vec = _mm256_sub_ps(a_vec, _mm256_loadu_ps(b2 + i));
+            __m256 d3_vec = _mm256_sub_ps(a_vec, _mm256_loadu_ps(b3 + i));
+            d20_vec = _mm256_fmadd_ps(d0_vec, d0_vec, d20_vec);
+            d21_vec = _mm256_fmadd_ps(d1_vec, d1_vec, d21_vec);
+            d22_vec = _mm256_fmadd_ps(d2_vec, d2_vec, d22_vec);
+            d23_vec = _mm256_fmadd_ps(d3_vec, d3_vec, d23_vec);
+        }
+        simsimd_f64_t d20 = _simsimd_reduce_f32x8_haswell(d20_vec), d21 = _simsimd_reduce_f32x8_haswell(d21_vec);
+        simsimd_f64_t d22 = _simsimd_reduce_f32x8_haswell(d22_vec), d23 = _simsimd_reduce_f32x8_haswell(d23_vec);
+        for (; i < n; ++i) {
+            simsimd_f32_t d0 = a[i] - b0[i], d1 = a[i] - b1[i], d2 = a[i] - b2[i], d3 = a[i] - b3[i];
+            d20 += d0 * d0, d21 += d1 * d1, d22 += d2 * d2, d23 += d3 * d3;
+        }
+        results[j + 0] = d20, results[j + 1] = d21, results[j + 2] = d22, results[j + 3] = d23;
+    }
+    for (; j != b_count; ++j) simsimd_l2sq_f32_haswell(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_batch_f32_haswell(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t *results) {
+    simsimd_distance_t a2;
+    simsimd_dot_f32_haswell(a, a, n, &a2);
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        __m256 ab0_vec = _mm256_setzero_ps(), ab1_vec = _mm256_setzero_ps();
+        __m256 ab2_vec = _mm256_setzero_ps(), ab3_vec = _mm256_setzero_ps();
+        __m256 b20_vec = _mm256_setzero_ps(), b21_vec = _mm256_setzero_ps();
+        __m256 b22_vec = _mm256_setzero_ps(), b23_vec = _mm256_setzero_ps();
+        simsimd_size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256 a_vec = _mm256_loadu_ps(a + i);
+            __m256 b0_vec = _mm256_loadu_ps(b0 + i), b1_vec = _mm256_loadu_ps(b1 + i);
+            __m256 b2_vec = _mm256_loadu_ps(b2 + i), b3_vec = _mm256_loadu_ps(b3 + i);
+            ab0_vec = _mm256_fmadd_ps(a_vec, b0_vec, ab0_vec), b20_vec = _mm256_fmadd_ps(b0_vec, b0_vec, b20_vec);
+            ab1_vec = _mm256_fmadd_ps(a_vec, b1_vec, ab1_vec), b21_vec = _mm256_fmadd_ps(b1_vec, b1_vec, b21_vec);
+            ab2_vec = _mm256_fmadd_ps(a_vec, b2_vec, ab2_vec), b22_vec = _mm256_fmadd_ps(b2_vec, b2_vec, b22_vec);
+            ab3_vec = _mm256_fmadd_ps(a_vec, b3_vec, ab3_vec), b23_vec = _mm256_fmadd_ps(b3_vec, b3_vec, b23_vec);
+        }
+        simsimd_f64_t ab0 = _simsimd_reduce_f32x8_haswell(ab0_vec), b20 = _simsimd_reduce_f32x8_haswell(b20_vec);
+        simsimd_f64_t ab1 = _simsimd_reduce_f32x8_haswell(ab1_vec), b21 = _simsimd_reduce_f32x8_haswell(b21_vec);
+        simsimd_f64_t ab2 = _simsimd_reduce_f32x8_haswell(ab2_vec), b22 = _simsimd_reduce_f32x8_haswell(b22_vec);
+        simsimd_f64_t ab3 = _simsimd_reduce_f32x8_haswell(ab3_vec), b23 = _simsimd_reduce_f32x8_haswell(b23_vec);
+        for (; i < n; ++i) {
+            simsimd_f32_t ai = a[i], bi0 = b0[i], bi1 = b1[i], bi2 = b2[i], bi3 = b3[i];
+            ab0 += ai * bi0, ab1 += ai * bi1, ab2 += ai * bi2, ab3 += ai * bi3;
+            b20 += bi0 * bi0, b21 += bi1 * bi1, b22 += bi2 * bi2, b23 += bi3 * bi3;
+        }
+        results[j + 0] = _simsimd_cos_normalize_f64_haswell(ab0, a2, b20);
+        results[j + 1] = _simsimd_cos_normalize_f64_haswell(ab1, a2, b21);
+        results[j + 2] = _simsimd_cos_normalize_f64_haswell(ab2, a2, b22);
+        results[j + 3] = _simsimd_cos_normalize_f64_haswell(ab3, a2, b23);
+    }
+    for (; j != b_count; ++j) simsimd_cos_f32_haswell(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
+SIMSIMD_MAKE_NORMS(haswell, f32)        // simsimd_norms_f32_haswell
+SIMSIMD_MAKE_BATCH_NORMED(haswell, f32) // simsimd_{cos,l2sq,l2}_batch_normed_f32_haswell
+
 SIMSIMD_PUBLIC void simsimd_l2_f64_haswell(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
                                            simsimd_distance_t *result) {
     simsimd_l2sq_f64_haswell(a, b, n, result);
@@ -1493,6 +2397,172 @@ SIMSIMD_PUBLIC void simsimd_cos_f64_haswell(simsimd_f64_t const *a, simsimd_f64_
     *result = _simsimd_cos_normalize_f64_haswell(ab, a2, b2);
 }
 
+SIMSIMD_PUBLIC void simsimd_l2_i4x2_haswell(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                            simsimd_distance_t *result) {
+    simsimd_l2sq_i4x2_haswell(a, b, n_words, result);
+    *result = _simsimd_sqrt_f32_haswell(*result);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_i4x2_haswell(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                              simsimd_distance_t *result) {
+    __m256i const ones_i16_vec = _mm256_set1_epi16(1);
+    __m256i d2_i32_vec = _mm256_setzero_si256();
+    __m256i a_low_vec, a_high_vec, b_low_vec, b_high_vec;
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n_words; i += 32) {
+        _simsimd_i4x2_to_i8x32_haswell(_mm256_lddqu_si256((__m256i const *)(a + i)), &a_low_vec, &a_high_vec);
+        _simsimd_i4x2_to_i8x32_haswell(_mm256_lddqu_si256((__m256i const *)(b + i)), &b_low_vec, &b_high_vec);
+        // The absolute difference of two 4-bit integers is at most 15, and its square is at most 225,
+        // so both operands of `_mm256_maddubs_epi16` are fine, and pairs of squares fit into `i16`
+        __m256i d_low_vec = _mm256_abs_epi8(_mm256_sub_epi8(a_low_vec, b_low_vec));
+        __m256i d_high_vec = _mm256_abs_epi8(_mm256_sub_epi8(a_high_vec, b_high_vec));
+        d2_i32_vec = _mm256_add_epi32(d2_i32_vec, _mm256_madd_epi16(_mm256_maddubs_epi16(d_low_vec, d_low_vec), //
+                                                                    ones_i16_vec));
+        d2_i32_vec = _mm256_add_epi32(d2_i32_vec, _mm256_madd_epi16(_mm256_maddubs_epi16(d_high_vec, d_high_vec), //
+                                                                    ones_i16_vec));
+    }
+
+    // Take care of the tail:
+    int d2 = _simsimd_reduce_i32x8_haswell(d2_i32_vec);
+    for (; i < n_words; ++i) {
+        int d_low = SIMSIMD_I4X2_LOW(a[i]) - SIMSIMD_I4X2_LOW(b[i]);
+        int d_high = SIMSIMD_I4X2_HIGH(a[i]) - SIMSIMD_I4X2_HIGH(b[i]);
+        d2 += d_low * d_low + d_high * d_high;
+    }
+    *result = d2;
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_i4x2_haswell(simsimd_i4x2_t const *a, simsimd_i4x2_t const *b, simsimd_size_t n_words,
+                                             simsimd_distance_t *result) {
+    __m256i const ones_i16_vec = _mm256_set1_epi16(1);
+    __m256i ab_i32_vec = _mm256_setzero_si256();
+    __m256i a2_i32_vec = _mm256_setzero_si256();
+    __m256i b2_i32_vec = _mm256_setzero_si256();
+    __m256i a_low_vec, a_high_vec, b_low_vec, b_high_vec;
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n_words; i += 32) {
+        _simsimd_i4x2_to_i8x32_haswell(_mm256_lddqu_si256((__m256i const *)(a + i)), &a_low_vec, &a_high_vec);
+        _simsimd_i4x2_to_i8x32_haswell(_mm256_lddqu_si256((__m256i const *)(b + i)), &b_low_vec, &b_high_vec);
+        __m256i ab_i16_vec = _mm256_add_epi16(_simsimd_i4x32_dot_i16x16_haswell(a_low_vec, b_low_vec),
+                                              _simsimd_i4x32_dot_i16x16_haswell(a_high_vec, b_high_vec));
+        __m256i a2_i16_vec = _mm256_add_epi16(_simsimd_i4x32_dot_i16x16_haswell(a_low_vec, a_low_vec),
+                                              _simsimd_i4x32_dot_i16x16_haswell(a_high_vec, a_high_vec));
+        __m256i b2_i16_vec = _mm256_add_epi16(_simsimd_i4x32_dot_i16x16_haswell(b_low_vec, b_low_vec),
+                                              _simsimd_i4x32_dot_i16x16_haswell(b_high_vec, b_high_vec));
+        ab_i32_vec = _mm256_add_epi32(ab_i32_vec, _mm256_madd_epi16(ab_i16_vec, ones_i16_vec));
+        a2_i32_vec = _mm256_add_epi32(a2_i32_vec, _mm256_madd_epi16(a2_i16_vec, ones_i16_vec));
+        b2_i32_vec = _mm256_add_epi32(b2_i32_vec, _mm256_madd_epi16(b2_i16_vec, ones_i16_vec));
+    }
+
+    // Take care of the tail:
+    int ab = _simsimd_reduce_i32x8_haswell(ab_i32_vec);
+    int a2 = _simsimd_reduce_i32x8_haswell(a2_i32_vec);
+    int b2 = _simsimd_reduce_i32x8_haswell(b2_i32_vec);
+    for (; i < n_words; ++i) {
+        int a_low = SIMSIMD_I4X2_LOW(a[i]), a_high = SIMSIMD_I4X2_HIGH(a[i]);
+        int b_low = SIMSIMD_I4X2_LOW(b[i]), b_high = SIMSIMD_I4X2_HIGH(b[i]);
+        ab += a_low * b_low + a_high * b_high;
+        a2 += a_low * a_low + a_high * a_high;
+        b2 += b_low * b_low + b_high * b_high;
+    }
+    *result = _simsimd_cos_normalize_f32_haswell(ab, a2, b2);
+}
+
+#define SIMSIMD_MAKE_QUANTIZED_L2SQ_HASWELL(query_type, database_type, load_query, load_database, load_query_scalar,  \
+                                            load_database_scalar)                                                     \
+    SIMSIMD_PUBLIC void simsimd_l2sq_##query_type##database_type##_haswell(                                           \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,                    \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,                  \
+        simsimd_distance_t *result) {                                                                                 \
+        __m256 a_low_vec, a_high_vec, b_low_vec, b_high_vec;                                                          \
+        __m256 d2_vec = _mm256_setzero_ps();                                                                          \
+        simsimd_size_t i = 0;                                                                                         \
+        for (; i + 16 <= n; i += 16) {                                                                                \
+            load_query(a, i, &a_low_vec, &a_high_vec);                                                                \
+            load_database(b, i, &b_low_vec, &b_high_vec);                                                             \
+            _simsimd_dequantize_f32x16_haswell(scales, zero_points, params_stride, i, &b_low_vec, &b_high_vec);       \
+            __m256 d_low_vec = _mm256_sub_ps(a_low_vec, b_low_vec);                                                   \
+            __m256 d_high_vec = _mm256_sub_ps(a_high_vec, b_high_vec);                                                \
+            d2_vec = _mm256_fmadd_ps(d_high_vec, d_high_vec, _mm256_fmadd_ps(d_low_vec, d_low_vec, d2_vec));          \
+        }                                                                                                             \
+        simsimd_f64_t d2 = _simsimd_reduce_f32x8_haswell(d2_vec);                                                     \
+        for (; i < n; ++i) {                                                                                          \
+            simsimd_f32_t d = load_query_scalar(a + i) -                                                              \
+                              SIMSIMD_DEQUANTIZE(load_database_scalar(b, i), scales, zero_points, i * params_stride); \
+            d2 += d * d;                                                                                              \
+        }                                                                                                             \
+        *result = d2;                                                                                                 \
+    }
+
+#define SIMSIMD_MAKE_QUANTIZED_L2_HASWELL(query_type, database_type)                                             \
+    SIMSIMD_PUBLIC void simsimd_l2_##query_type##database_type##_haswell(                                        \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,               \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,             \
+        simsimd_distance_t *result) {                                                                            \
+        simsimd_l2sq_##query_type##database_type##_haswell(a, b, n, scales, zero_points, params_stride, result); \
+        *result = _simsimd_sqrt_f64_haswell(*result);                                                            \
+    }
+
+#define SIMSIMD_MAKE_QUANTIZED_COS_HASWELL(query_type, database_type, load_query, load_database, load_query_scalar,    \
+                                           load_database_scalar)                                                       \
+    SIMSIMD_PUBLIC void simsimd_cos_##query_type##database_type##_haswell(                                             \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,                     \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,                   \
+        simsimd_distance_t *result) {                                                                                  \
+        __m256 a_low_vec, a_high_vec, b_low_vec, b_high_vec;                                                           \
+        __m256 ab_vec = _mm256_setzero_ps(), a2_vec = _mm256_setzero_ps(), b2_vec = _mm256_setzero_ps();               \
+        simsimd_size_t i = 0;                                                                                          \
+        for (; i + 16 <= n; i += 16) {                                                                                 \
+            load_query(a, i, &a_low_vec, &a_high_vec);                                                                 \
+            load_database(b, i, &b_low_vec, &b_high_vec);                                                              \
+            _simsimd_dequantize_f32x16_haswell(scales, zero_points, params_stride, i, &b_low_vec, &b_high_vec);        \
+            ab_vec = _mm256_fmadd_ps(a_high_vec, b_high_vec, _mm256_fmadd_ps(a_low_vec, b_low_vec, ab_vec));           \
+            a2_vec = _mm256_fmadd_ps(a_high_vec, a_high_vec, _mm256_fmadd_ps(a_low_vec, a_low_vec, a2_vec));           \
+            b2_vec = _mm256_fmadd_ps(b_high_vec, b_high_vec, _mm256_fmadd_ps(b_low_vec, b_low_vec, b2_vec));           \
+        }                                                                                                              \
+        simsimd_f64_t ab = _simsimd_reduce_f32x8_haswell(ab_vec);                                                      \
+        simsimd_f64_t a2 = _simsimd_reduce_f32x8_haswell(a2_vec);                                                      \
+        simsimd_f64_t b2 = _simsimd_reduce_f32x8_haswell(b2_vec);                                                      \
+        for (; i < n; ++i) {                                                                                           \
+            simsimd_f32_t ai = load_query_scalar(a + i);                                                               \
+            simsimd_f32_t bi = SIMSIMD_DEQUANTIZE(load_database_scalar(b, i), scales, zero_points, i * params_stride); \
+            ab += ai * bi, a2 += ai * ai, b2 += bi * bi;                                                               \
+        }                                                                                                              \
+        *result = _simsimd_cos_normalize_f64_haswell(ab, a2, b2);                                                      \
+    }
+
+SIMSIMD_MAKE_QUANTIZED_L2SQ_HASWELL(f32, i8, _simsimd_load_f32x16_haswell, _simsimd_load_i8x16_haswell,
+                                    SIMSIMD_DEREFERENCE, SIMSIMD_INDEX) // simsimd_l2sq_f32i8_haswell
+SIMSIMD_MAKE_QUANTIZED_L2SQ_HASWELL(f32, u8, _simsimd_load_f32x16_haswell, _simsimd_load_u8x16_haswell,
+                                    SIMSIMD_DEREFERENCE, SIMSIMD_INDEX) // simsimd_l2sq_f32u8_haswell
+SIMSIMD_MAKE_QUANTIZED_L2SQ_HASWELL(f32, i4x2, _simsimd_load_f32x16_haswell, _simsimd_load_i4x16_haswell,
+                                    SIMSIMD_DEREFERENCE, SIMSIMD_I4X2_INDEX) // simsimd_l2sq_f32i4x2_haswell
+SIMSIMD_MAKE_QUANTIZED_L2SQ_HASWELL(f16, i8, _simsimd_load_f16x16_haswell, _simsimd_load_i8x16_haswell,
+                                    SIMSIMD_F16_TO_F32, SIMSIMD_INDEX) // simsimd_l2sq_f16i8_haswell
+SIMSIMD_MAKE_QUANTIZED_L2SQ_HASWELL(f16, u8, _simsimd_load_f16x16_haswell, _simsimd_load_u8x16_haswell,
+                                    SIMSIMD_F16_TO_F32, SIMSIMD_INDEX) // simsimd_l2sq_f16u8_haswell
+SIMSIMD_MAKE_QUANTIZED_L2SQ_HASWELL(f16, i4x2, _simsimd_load_f16x16_haswell, _simsimd_load_i4x16_haswell,
+                                    SIMSIMD_F16_TO_F32, SIMSIMD_I4X2_INDEX) // simsimd_l2sq_f16i4x2_haswell
+
+SIMSIMD_MAKE_QUANTIZED_L2_HASWELL(f32, i8) // simsimd_l2_f32i8_haswell
+SIMSIMD_MAKE_QUANTIZED_L2_HASWELL(f32, u8) // simsimd_l2_f32u8_haswell
+SIMSIMD_MAKE_QUANTIZED_L2_HASWELL(f32, i4x2) // simsimd_l2_f32i4x2_haswell
+SIMSIMD_MAKE_QUANTIZED_L2_HASWELL(f16, i8) // simsimd_l2_f16i8_haswell
+SIMSIMD_MAKE_QUANTIZED_L2_HASWELL(f16, u8) // simsimd_l2_f16u8_haswell
+SIMSIMD_MAKE_QUANTIZED_L2_HASWELL(f16, i4x2) // simsimd_l2_f16i4x2_haswell
+
+SIMSIMD_MAKE_QUANTIZED_COS_HASWELL(f32, i8, _simsimd_load_f32x16_haswell, _simsimd_load_i8x16_haswell,
+                                   SIMSIMD_DEREFERENCE, SIMSIMD_INDEX) // simsimd_cos_f32i8_haswell
+SIMSIMD_MAKE_QUANTIZED_COS_HASWELL(f32, u8, _simsimd_load_f32x16_haswell, _simsimd_load_u8x16_haswell,
+                                   SIMSIMD_DEREFERENCE, SIMSIMD_INDEX) // simsimd_cos_f32u8_haswell
+SIMSIMD_MAKE_QUANTIZED_COS_HASWELL(f32, i4x2, _simsimd_load_f32x16_haswell, _simsimd_load_i4x16_haswell,
+                                   SIMSIMD_DEREFERENCE, SIMSIMD_I4X2_INDEX) // simsimd_cos_f32i4x2_haswell
+SIMSIMD_MAKE_QUANTIZED_COS_HASWELL(f16, i8, _simsimd_load_f16x16_haswell, _simsimd_load_i8x16_haswell,
+                                   SIMSIMD_F16_TO_F32, SIMSIMD_INDEX) // simsimd_cos_f16i8_haswell
+SIMSIMD_MAKE_QUANTIZED_COS_HASWELL(f16, u8, _simsimd_load_f16x16_haswell, _simsimd_load_u8x16_haswell,
+                                   SIMSIMD_F16_TO_F32, SIMSIMD_INDEX) // simsimd_cos_f16u8_haswell
+SIMSIMD_MAKE_QUANTIZED_COS_HASWELL(f16, i4x2, _simsimd_load_f16x16_haswell, _simsimd_load_i4x16_haswell,
+                                   SIMSIMD_F16_TO_F32, SIMSIMD_I4X2_INDEX) // simsimd_cos_f16i4x2_haswell
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_HASWELL
@@ -1604,6 +2674,109 @@ simsimd_cos_f32_skylake_cycle:
     *result = _simsimd_cos_normalize_f64_skylake(ab, a2, b2);
 }
 
+SIMSIMD_PUBLIC void simsimd_l2_batch_f32_skylake(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                 simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                 simsimd_distance_t *results) {
+    simsimd_l2sq_batch_f32_skylake(a, b, b_count, b_stride, n, results);
+    for (simsimd_size_t j = 0; j != b_count; ++j) results[j] = _simsimd_sqrt_f64_haswell(results[j]);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_f32_skylake(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                   simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                   simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        __m512 d20_vec = _mm512_setzero(), d21_vec = _mm512_setzero();
+        __m512 d22_vec = _mm512_setzero(), d23_vec = _mm512_setzero();
+        __m512 a_vec, b0_vec, b1_vec, b2_vec, b3_vec;
+        simsimd_size_t i = 0;
+
+    simsimd_l2sq_batch_f32_skylake_cycle:
+        if (n - i < 16) {
+            __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n - i);
+            a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+            b0_vec = _mm512_maskz_loadu_ps(mask, b0 + i), b1_vec = _mm512_maskz_loadu_ps(mask, b1 + i);
+            b2_vec = _mm512_maskz_loadu_ps(mask, b2 + i), b3_vec = _mm512_maskz_loadu_ps(mask, b3 + i);
+            i = n;
+        }
+        else {
+            a_vec = _mm512_loadu_ps(a + i);
+            b0_vec = _mm512_loadu_ps(b0 + i), b1_vec = _mm512_loadu_ps(b1 + i);
+            b2_vec = _mm512_loadu_ps(b2 + i), b3_vec = _mm512_loadu_ps(b3 + i);
+            i += 16;
+        }
+        b0_vec = _mm512_sub_ps(a_vec, b0_vec), b1_vec = _mm512_sub_ps(a_vec, b1_vec);
+        b2_vec = _mm512_sub_ps(a_vec, b2_vec), b3_vec = _mm512_sub_ps(a_vec, b3_vec);
+        d20_vec = _mm512_fmadd_ps(b0_vec, b0_vec, d20_vec);
+        d21_vec = _mm512_fmadd_ps(b1_vec, b1_vec, d21_vec);
+        d22_vec = _mm512_fmadd_ps(b2_vec, b2_vec, d22_vec);
+        d23_vec = _mm512_fmadd_ps(b3_vec, b3_vec, d23_vec);
+        if (i < n) goto simsimd_l2sq_batch_f32_skylake_cycle;
+
+        results[j + 0] = _simsimd_reduce_f32x16_skylake(d20_vec);
+        results[j + 1] = _simsimd_reduce_f32x16_skylake(d21_vec);
+        results[j + 2] = _simsimd_reduce_f32x16_skylake(d22_vec);
+        results[j + 3] = _simsimd_reduce_f32x16_skylake(d23_vec);
+    }
+    for (; j != b_count; ++j) simsimd_l2sq_f32_skylake(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_batch_f32_skylake(simsimd_f32_t const *a, simsimd_f32_t const *b,
+                                                  simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                                                  simsimd_distance_t *results) {
+    simsimd_distance_t a2;
+    simsimd_dot_f32_skylake(a, a, n, &a2);
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_f32_t const *b0 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 0);
+        simsimd_f32_t const *b1 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 1);
+        simsimd_f32_t const *b2 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 2);
+        simsimd_f32_t const *b3 = SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j + 3);
+        __m512 ab0_vec = _mm512_setzero(), ab1_vec = _mm512_setzero();
+        __m512 ab2_vec = _mm512_setzero(), ab3_vec = _mm512_setzero();
+        __m512 b20_vec = _mm512_setzero(), b21_vec = _mm512_setzero();
+        __m512 b22_vec = _mm512_setzero(), b23_vec = _mm512_setzero();
+        __m512 a_vec, b0_vec, b1_vec, b2_vec, b3_vec;
+        simsimd_size_t i = 0;
+
+    simsimd_cos_batch_f32_skylake_cycle:
+        if (n - i < 16) {
+            __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n - i);
+            a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+            b0_vec = _mm512_maskz_loadu_ps(mask, b0 + i), b1_vec = _mm512_maskz_loadu_ps(mask, b1 + i);
+            b2_vec = _mm512_maskz_loadu_ps(mask, b2 + i), b3_vec = _mm512_maskz_loadu_ps(mask, b3 + i);
+            i = n;
+        }
+        else {
+            a_vec = _mm512_loadu_ps(a + i);
+            b0_vec = _mm512_loadu_ps(b0 + i), b1_vec = _mm512_loadu_ps(b1 + i);
+            b2_vec = _mm512_loadu_ps(b2 + i), b3_vec = _mm512_loadu_ps(b3 + i);
+            i += 16;
+        }
+        ab0_vec = _mm512_fmadd_ps(a_vec, b0_vec, ab0_vec), b20_vec = _mm512_fmadd_ps(b0_vec, b0_vec, b20_vec);
+        ab1_vec = _mm512_fmadd_ps(a_vec, b1_vec, ab1_vec), b21_vec = _mm512_fmadd_ps(b1_vec, b1_vec, b21_vec);
+        ab2_vec = _mm512_fmadd_ps(a_vec, b2_vec, ab2_vec), b22_vec = _mm512_fmadd_ps(b2_vec, b2_vec, b22_vec);
+        ab3_vec = _mm512_fmadd_ps(a_vec, b3_vec, ab3_vec), b23_vec = _mm512_fmadd_ps(b3_vec, b3_vec, b23_vec);
+        if (i < n) goto simsimd_cos_batch_f32_skylake_cycle;
+
+        results[j + 0] = _simsimd_cos_normalize_f64_skylake(_simsimd_reduce_f32x16_skylake(ab0_vec), a2,
+                                                            _simsimd_reduce_f32x16_skylake(b20_vec));
+        results[j + 1] = _simsimd_cos_normalize_f64_skylake(_simsimd_reduce_f32x16_skylake(ab1_vec), a2,
+                                                            _simsimd_reduce_f32x16_skylake(b21_vec));
+        results[j + 2] = _simsimd_cos_normalize_f64_skylake(_simsimd_reduce_f32x16_skylake(ab2_vec), a2,
+                                                            _simsimd_reduce_f32x16_skylake(b22_vec));
+        results[j + 3] = _simsimd_cos_normalize_f64_skylake(_simsimd_reduce_f32x16_skylake(ab3_vec), a2,
+                                                            _simsimd_reduce_f32x16_skylake(b23_vec));
+    }
+    for (; j != b_count; ++j) simsimd_cos_f32_skylake(a, SIMSIMD_ROW(simsimd_f32_t, b, b_stride, j), n, results + j);
+}
+
+SIMSIMD_MAKE_NORMS(skylake, f32)        // simsimd_norms_f32_skylake
+SIMSIMD_MAKE_BATCH_NORMED(skylake, f32) // simsimd_{cos,l2sq,l2}_batch_normed_f32_skylake
+
 SIMSIMD_PUBLIC void simsimd_l2_f64_skylake(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size_t n,
                                            simsimd_distance_t *result) {
     simsimd_l2sq_f64_skylake(a, b, n, result);
@@ -1663,6 +2836,86 @@ simsimd_cos_f64_skylake_cycle:
     *result = _simsimd_cos_normalize_f64_skylake(ab, a2, b2);
 }
 
+#define SIMSIMD_MAKE_QUANTIZED_L2SQ_SKYLAKE(query_type, database_type, load_query, load_database)          \
+    SIMSIMD_PUBLIC void simsimd_l2sq_##query_type##database_type##_skylake(                                \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,         \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,       \
+        simsimd_distance_t *result) {                                                                      \
+        __m512 d2_vec = _mm512_setzero_ps();                                                               \
+        for (simsimd_size_t i = 0; i < n; i += 16) {                                                       \
+            __mmask16 mask = n - i < 16 ? (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)(n - i)) : 0xFFFF;    \
+            __m512 a_vec = load_query(a, i, mask);                                                         \
+            __m512 b_vec = _simsimd_dequantize_f32x16_skylake(scales, zero_points, params_stride, i, mask, \
+                                                              load_database(b, i, mask));                  \
+            __m512 d_vec = _mm512_sub_ps(a_vec, b_vec);                                                    \
+            d2_vec = _mm512_fmadd_ps(d_vec, d_vec, d2_vec);                                                \
+        }                                                                                                  \
+        *result = _simsimd_reduce_f32x16_skylake(d2_vec);                                                  \
+    }
+
+#define SIMSIMD_MAKE_QUANTIZED_L2_SKYLAKE(query_type, database_type)                                             \
+    SIMSIMD_PUBLIC void simsimd_l2_##query_type##database_type##_skylake(                                        \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,               \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,             \
+        simsimd_distance_t *result) {                                                                            \
+        simsimd_l2sq_##query_type##database_type##_skylake(a, b, n, scales, zero_points, params_stride, result); \
+        *result = _simsimd_sqrt_f64_haswell(*result);                                                            \
+    }
+
+#define SIMSIMD_MAKE_QUANTIZED_COS_SKYLAKE(query_type, database_type, load_query, load_database)           \
+    SIMSIMD_PUBLIC void simsimd_cos_##query_type##database_type##_skylake(                                 \
+        simsimd_##query_type##_t const *a, simsimd_##database_type##_t const *b, simsimd_size_t n,         \
+        simsimd_f32_t const *scales, simsimd_f32_t const *zero_points, simsimd_size_t params_stride,       \
+        simsimd_distance_t *result) {                                                                      \
+        __m512 ab_vec = _mm512_setzero_ps(), a2_vec = _mm512_setzero_ps(), b2_vec = _mm512_setzero_ps();   \
+        for (simsimd_size_t i = 0; i < n; i += 16) {                                                       \
+            __mmask16 mask = n - i < 16 ? (__mmask16)_bzhi_u32(0xFFFF, (unsigned int)(n - i)) : 0xFFFF;    \
+            __m512 a_vec = load_query(a, i, mask);                                                         \
+            __m512 b_vec = _simsimd_dequantize_f32x16_skylake(scales, zero_points, params_stride, i, mask, \
+                                                              load_database(b, i, mask));                  \
+            ab_vec = _mm512_fmadd_ps(a_vec, b_vec, ab_vec);                                                \
+            a2_vec = _mm512_fmadd_ps(a_vec, a_vec, a2_vec);                                                \
+            b2_vec = _mm512_fmadd_ps(b_vec, b_vec, b2_vec);                                                \
+        }                                                                                                  \
+        simsimd_f64_t ab = _simsimd_reduce_f32x16_skylake(ab_vec);                                         \
+        simsimd_f64_t a2 = _simsimd_reduce_f32x16_skylake(a2_vec);                                         \
+        simsimd_f64_t b2 = _simsimd_reduce_f32x16_skylake(b2_vec);                                         \
+        *result = _simsimd_cos_normalize_f64_skylake(ab, a2, b2);                                          \
+    }
+
+SIMSIMD_MAKE_QUANTIZED_L2SQ_SKYLAKE(f32, i8, _simsimd_load_f32x16_skylake,
+                                    _simsimd_load_i8x16_skylake) // simsimd_l2sq_f32i8_skylake
+SIMSIMD_MAKE_QUANTIZED_L2SQ_SKYLAKE(f32, u8, _simsimd_load_f32x16_skylake,
+                                    _simsimd_load_u8x16_skylake) // simsimd_l2sq_f32u8_skylake
+SIMSIMD_MAKE_QUANTIZED_L2SQ_SKYLAKE(f32, i4x2, _simsimd_load_f32x16_skylake,
+                                    _simsimd_load_i4x16_skylake) // simsimd_l2sq_f32i4x2_skylake
+SIMSIMD_MAKE_QUANTIZED_L2SQ_SKYLAKE(f16, i8, _simsimd_load_f16x16_skylake,
+                                    _simsimd_load_i8x16_skylake) // simsimd_l2sq_f16i8_skylake
+SIMSIMD_MAKE_QUANTIZED_L2SQ_SKYLAKE(f16, u8, _simsimd_load_f16x16_skylake,
+                                    _simsimd_load_u8x16_skylake) // simsimd_l2sq_f16u8_skylake
+SIMSIMD_MAKE_QUANTIZED_L2SQ_SKYLAKE(f16, i4x2, _simsimd_load_f16x16_skylake,
+                                    _simsimd_load_i4x16_skylake) // simsimd_l2sq_f16i4x2_skylake
+
+SIMSIMD_MAKE_QUANTIZED_L2_SKYLAKE(f32, i8) // simsimd_l2_f32i8_skylake
+SIMSIMD_MAKE_QUANTIZED_L2_SKYLAKE(f32, u8) // simsimd_l2_f32u8_skylake
+SIMSIMD_MAKE_QUANTIZED_L2_SKYLAKE(f32, i4x2) // simsimd_l2_f32i4x2_skylake
+SIMSIMD_MAKE_QUANTIZED_L2_SKYLAKE(f16, i8) // simsimd_l2_f16i8_skylake
+SIMSIMD_MAKE_QUANTIZED_L2_SKYLAKE(f16, u8) // simsimd_l2_f16u8_skylake
+SIMSIMD_MAKE_QUANTIZED_L2_SKYLAKE(f16, i4x2) // simsimd_l2_f16i4x2_skylake
+
+SIMSIMD_MAKE_QUANTIZED_COS_SKYLAKE(f32, i8, _simsimd_load_f32x16_skylake,
+                                   _simsimd_load_i8x16_skylake) // simsimd_cos_f32i8_skylake
+SIMSIMD_MAKE_QUANTIZED_COS_SKYLAKE(f32, u8, _simsimd_load_f32x16_skylake,
+                                   _simsimd_load_u8x16_skylake) // simsimd_cos_f32u8_skylake
+SIMSIMD_MAKE_QUANTIZED_COS_SKYLAKE(f32, i4x2, _simsimd_load_f32x16_skylake,
+                                   _simsimd_load_i4x16_skylake) // simsimd_cos_f32i4x2_skylake
+SIMSIMD_MAKE_QUANTIZED_COS_SKYLAKE(f16, i8, _simsimd_load_f16x16_skylake,
+                                   _simsimd_load_i8x16_skylake) // simsimd_cos_f16i8_skylake
+SIMSIMD_MAKE_QUANTIZED_COS_SKYLAKE(f16, u8, _simsimd_load_f16x16_skylake,
+                                   _simsimd_load_u8x16_skylake) // simsimd_cos_f16u8_skylake
+SIMSIMD_MAKE_QUANTIZED_COS_SKYLAKE(f16, i4x2, _simsimd_load_f16x16_skylake,
+                                   _simsimd_load_i4x16_skylake) // simsimd_cos_f16i4x2_skylake
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_SKYLAKE
@@ -1960,6 +3213,119 @@ simsimd_cos_i8_ice_cycle:
     int b2 = _mm512_reduce_add_epi32(b2_i32_vec);
     *result = _simsimd_cos_normalize_f32_haswell(ab, a2, b2);
 }
+
+SIMSIMD_PUBLIC void simsimd_l2_batch_i8_ice(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                            simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results) {
+    simsimd_l2sq_batch_i8_ice(a, b, b_count, b_stride, n, results);
+    for (simsimd_size_t j = 0; j != b_count; ++j) results[j] = _simsimd_sqrt_f32_haswell(results[j]);
+}
+SIMSIMD_PUBLIC void simsimd_l2sq_batch_i8_ice(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                              simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results) {
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_i8_t const *b0 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 0);
+        simsimd_i8_t const *b1 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 1);
+        simsimd_i8_t const *b2 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 2);
+        simsimd_i8_t const *b3 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 3);
+        __m512i d20_i32_vec = _mm512_setzero_si512(), d21_i32_vec = _mm512_setzero_si512();
+        __m512i d22_i32_vec = _mm512_setzero_si512(), d23_i32_vec = _mm512_setzero_si512();
+        __m512i a_i16_vec, d0_i16_vec, d1_i16_vec, d2_i16_vec, d3_i16_vec;
+        simsimd_size_t i = 0;
+
+    simsimd_l2sq_batch_i8_ice_cycle:
+        if (n - i < 32) {
+            __mmask32 mask = (__mmask32)_bzhi_u32(0xFFFFFFFF, n - i);
+            a_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, a + i));
+            d0_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b0 + i));
+            d1_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b1 + i));
+            d2_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b2 + i));
+            d3_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b3 + i));
+            i = n;
+        }
+        else {
+            a_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(a + i)));
+            d0_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b0 + i)));
+            d1_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b1 + i)));
+            d2_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b2 + i)));
+            d3_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b3 + i)));
+            i += 32;
+        }
+        d0_i16_vec = _mm512_sub_epi16(a_i16_vec, d0_i16_vec), d1_i16_vec = _mm512_sub_epi16(a_i16_vec, d1_i16_vec);
+        d2_i16_vec = _mm512_sub_epi16(a_i16_vec, d2_i16_vec), d3_i16_vec = _mm512_sub_epi16(a_i16_vec, d3_i16_vec);
+        d20_i32_vec = _mm512_dpwssd_epi32(d20_i32_vec, d0_i16_vec, d0_i16_vec);
+        d21_i32_vec = _mm512_dpwssd_epi32(d21_i32_vec, d1_i16_vec, d1_i16_vec);
+        d22_i32_vec = _mm512_dpwssd_epi32(d22_i32_vec, d2_i16_vec, d2_i16_vec);
+        d23_i32_vec = _mm512_dpwssd_epi32(d23_i32_vec, d3_i16_vec, d3_i16_vec);
+        if (i < n) goto simsimd_l2sq_batch_i8_ice_cycle;
+
+        results[j + 0] = _mm512_reduce_add_epi32(d20_i32_vec);
+        results[j + 1] = _mm512_reduce_add_epi32(d21_i32_vec);
+        results[j + 2] = _mm512_reduce_add_epi32(d22_i32_vec);
+        results[j + 3] = _mm512_reduce_add_epi32(d23_i32_vec);
+    }
+    for (; j != b_count; ++j) simsimd_l2sq_i8_ice(a, SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j), n, results + j);
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_batch_i8_ice(simsimd_i8_t const *a, simsimd_i8_t const *b, simsimd_size_t b_count,
+                                             simsimd_size_t b_stride, simsimd_size_t n, simsimd_distance_t *results) {
+    simsimd_distance_t a2;
+    simsimd_dot_i8_ice(a, a, n, &a2);
+    simsimd_size_t j = 0;
+    for (; j + 4 <= b_count; j += 4) {
+        simsimd_i8_t const *b0 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 0);
+        simsimd_i8_t const *b1 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 1);
+        simsimd_i8_t const *b2 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 2);
+        simsimd_i8_t const *b3 = SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j + 3);
+        __m512i ab0_i32_vec = _mm512_setzero_si512(), ab1_i32_vec = _mm512_setzero_si512();
+        __m512i ab2_i32_vec = _mm512_setzero_si512(), ab3_i32_vec = _mm512_setzero_si512();
+        __m512i b20_i32_vec = _mm512_setzero_si512(), b21_i32_vec = _mm512_setzero_si512();
+        __m512i b22_i32_vec = _mm512_setzero_si512(), b23_i32_vec = _mm512_setzero_si512();
+        __m512i a_i16_vec, b0_i16_vec, b1_i16_vec, b2_i16_vec, b3_i16_vec;
+        simsimd_size_t i = 0;
+
+    simsimd_cos_batch_i8_ice_cycle:
+        if (n - i < 32) {
+            __mmask32 mask = (__mmask32)_bzhi_u32(0xFFFFFFFF, n - i);
+            a_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, a + i));
+            b0_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b0 + i));
+            b1_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b1 + i));
+            b2_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b2 + i));
+            b3_i16_vec = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(mask, b3 + i));
+            i = n;
+        }
+        else {
+            a_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(a + i)));
+            b0_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b0 + i)));
+            b1_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b1 + i)));
+            b2_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b2 + i)));
+            b3_i16_vec = _mm512_cvtepi8_epi16(_mm256_lddqu_si256((__m256i const *)(b3 + i)));
+            i += 32;
+        }
+        // Same `VPMADDWD`-based approach as in `simsimd_cos_i8_ice`, but the query norm is computed just once.
+        ab0_i32_vec = _mm512_add_epi32(ab0_i32_vec, _mm512_madd_epi16(a_i16_vec, b0_i16_vec));
+        ab1_i32_vec = _mm512_add_epi32(ab1_i32_vec, _mm512_madd_epi16(a_i16_vec, b1_i16_vec));
+        ab2_i32_vec = _mm512_add_epi32(ab2_i32_vec, _mm512_madd_epi16(a_i16_vec, b2_i16_vec));
+        ab3_i32_vec = _mm512_add_epi32(ab3_i32_vec, _mm512_madd_epi16(a_i16_vec, b3_i16_vec));
+        b20_i32_vec = _mm512_add_epi32(b20_i32_vec, _mm512_madd_epi16(b0_i16_vec, b0_i16_vec));
+        b21_i32_vec = _mm512_add_epi32(b21_i32_vec, _mm512_madd_epi16(b1_i16_vec, b1_i16_vec));
+        b22_i32_vec = _mm512_add_epi32(b22_i32_vec, _mm512_madd_epi16(b2_i16_vec, b2_i16_vec));
+        b23_i32_vec = _mm512_add_epi32(b23_i32_vec, _mm512_madd_epi16(b3_i16_vec, b3_i16_vec));
+        if (i < n) goto simsimd_cos_batch_i8_ice_cycle;
+
+        results[j + 0] = _simsimd_cos_normalize_f32_haswell(_mm512_reduce_add_epi32(ab0_i32_vec), (simsimd_f32_t)a2,
+                                                            _mm512_reduce_add_epi32(b20_i32_vec));
+        results[j + 1] = _simsimd_cos_normalize_f32_haswell(_mm512_reduce_add_epi32(ab1_i32_vec), (simsimd_f32_t)a2,
+                                                            _mm512_reduce_add_epi32(b21_i32_vec));
+        results[j + 2] = _simsimd_cos_normalize_f32_haswell(_mm512_reduce_add_epi32(ab2_i32_vec), (simsimd_f32_t)a2,
+                                                            _mm512_reduce_add_epi32(b22_i32_vec));
+        results[j + 3] = _simsimd_cos_normalize_f32_haswell(_mm512_reduce_add_epi32(ab3_i32_vec), (simsimd_f32_t)a2,
+                                                            _mm512_reduce_add_epi32(b23_i32_vec));
+    }
+    for (; j != b_count; ++j) simsimd_cos_i8_ice(a, SIMSIMD_ROW(simsimd_i8_t, b, b_stride, j), n, results + j);
+}
+
+SIMSIMD_MAKE_NORMS(ice, i8)        // simsimd_norms_i8_ice
+SIMSIMD_MAKE_BATCH_NORMED(ice, i8) // simsimd_{cos,l2sq,l2}_batch_normed_i8_ice
 SIMSIMD_PUBLIC void simsimd_l2_u8_ice(simsimd_u8_t const *a, simsimd_u8_t const *b, simsimd_size_t n,
                                       simsimd_distance_t *result) {
     simsimd_l2sq_u8_ice(a, b, n, result);
@@ -2126,7 +3492,9 @@ simsimd_l2sq_i4x2_ice_cycle:
             _mm512_unpacklo_epi8(d2_u8_high_vec, _mm512_setzero_si512()),
             _mm512_unpackhi_epi8(d2_u8_high_vec, _mm512_setzero_si512()));
     d2_u32_vec = _mm512_add_epi32(d2_u32_vec, _mm512_unpacklo_epi16(d2_u16_low_vec, _mm512_setzero_si512()));
+    d2_u32_vec = _mm512_add_epi32(d2_u32_vec, _mm512_unpackhi_epi16(d2_u16_low_vec, _mm512_setzero_si512()));
     d2_u32_vec = _mm512_add_epi32(d2_u32_vec, _mm512_unpacklo_epi16(d2_u16_high_vec, _mm512_setzero_si512()));
+    d2_u32_vec = _mm512_add_epi32(d2_u32_vec, _mm512_unpackhi_epi16(d2_u16_high_vec, _mm512_setzero_si512()));
     if (n_words) goto simsimd_l2sq_i4x2_ice_cycle;
 
     // Finally, we can reduce the 16-bit integers to 32-bit integers and sum them up.
@@ -2189,13 +3557,13 @@ SIMSIMD_PUBLIC void simsimd_cos_i4x2_ice(simsimd_i4x2_t const *a, simsimd_i4x2_t
     __m512i a_i8_low_vec, a_i8_high_vec, b_i8_low_vec, b_i8_high_vec;
     __m512i a2_u8_vec, b2_u8_vec;
 
+    /// Every squares byte is multiplied by one, when accumulated into 32-bit integers.
+    __m512i const ones_i8_vec = _mm512_set1_epi8(1);
+
     // Accumulators:
-    __m512i a2_u16_low_vec = _mm512_setzero_si512();
-    __m512i a2_u16_high_vec = _mm512_setzero_si512();
-    __m512i b2_u16_low_vec = _mm512_setzero_si512();
-    __m512i b2_u16_high_vec = _mm512_setzero_si512();
-    __m512i ab_i32_low_vec = _mm512_setzero_si512();
-    __m512i ab_i32_high_vec = _mm512_setzero_si512();
+    __m512i a2_i32_vec = _mm512_setzero_si512();
+    __m512i b2_i32_vec = _mm512_setzero_si512();
+    __m512i ab_i32_vec = _mm512_setzero_si512();
 
 simsimd_cos_i4x2_ice_cycle:
     if (n_words < 64) {
@@ -2226,15 +3594,10 @@ simsimd_cos_i4x2_ice_cycle:
     b2_u8_vec = _mm512_add_epi8(_mm512_shuffle_epi8(i4_squares_lookup_vec, b_i8_low_vec),
                                 _mm512_shuffle_epi8(i4_squares_lookup_vec, b_i8_high_vec));
 
-    // We can safely aggregate into just 16-bit sums without overflow, if the vectors have less than:
-    //      (2 scalars / byte) * (64 bytes / register) * (256 non-overflowing 8-bit additions in 16-bit intesgers)
-    //      = 32'768 dimensions.
-    //
-    // We use saturated addition here to clearly inform in case of overflow.
-    a2_u16_low_vec = _mm512_adds_epu16(a2_u16_low_vec, _mm512_cvtepu8_epi16(_mm512_castsi512_si256(a2_u8_vec)));
-    a2_u16_high_vec = _mm512_adds_epu16(a2_u16_high_vec, _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(a2_u8_vec, 1)));
-    b2_u16_low_vec = _mm512_adds_epu16(b2_u16_low_vec, _mm512_cvtepu8_epi16(_mm512_castsi512_si256(a2_u8_vec)));
-    b2_u16_high_vec = _mm512_adds_epu16(b2_u16_high_vec, _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(a2_u8_vec, 1)));
+    // Instead of upcasting the squares to 16-bit integers, which would limit us to 32'768 dimensions
+    // before the overflow, we multiply them by one and accumulate straight into 32-bit integers.
+    a2_i32_vec = _mm512_dpbusd_epi32(a2_i32_vec, a2_u8_vec, ones_i8_vec);
+    b2_i32_vec = _mm512_dpbusd_epi32(b2_i32_vec, b2_u8_vec, ones_i8_vec);
 
     // Time to perform the proper sign extension of the 4-bit integers to 8-bit integers.
     a_i8_low_vec = _mm512_shuffle_epi8(i4_to_i8_lookup_vec, a_i8_low_vec);
@@ -2242,34 +3605,16 @@ simsimd_cos_i4x2_ice_cycle:
     b_i8_low_vec = _mm512_shuffle_epi8(i4_to_i8_lookup_vec, b_i8_low_vec);
     b_i8_high_vec = _mm512_shuffle_epi8(i4_to_i8_lookup_vec, b_i8_high_vec);
 
-    // The same trick won't work for the primary dot-product, as the signs vector
-    // components may differ significantly. So we have to use two `_mm512_dpwssds_epi32`
-    // intrinsics instead, upcasting four chunks to 16-bit integers beforehand!
-    // Alternatively, we can flip the signs of the second argument and use `_mm512_dpbusds_epi32`,
-    // but it ends up taking more instructions.
-    ab_i32_low_vec = _mm512_dpwssds_epi32(                          //
-        ab_i32_low_vec,                                             //
-        _mm512_cvtepi8_epi16(_mm512_castsi512_si256(a_i8_low_vec)), //
-        _mm512_cvtepi8_epi16(_mm512_castsi512_si256(b_i8_low_vec)));
-    ab_i32_low_vec = _mm512_dpwssds_epi32(                                //
-        ab_i32_low_vec,                                                   //
-        _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(a_i8_low_vec, 1)), //
-        _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(b_i8_low_vec, 1)));
-    ab_i32_high_vec = _mm512_dpwssds_epi32(                          //
-        ab_i32_high_vec,                                             //
-        _mm512_cvtepi8_epi16(_mm512_castsi512_si256(a_i8_high_vec)), //
-        _mm512_cvtepi8_epi16(_mm512_castsi512_si256(b_i8_high_vec)));
-    ab_i32_high_vec = _mm512_dpwssds_epi32(                                //
-        ab_i32_high_vec,                                                   //
-        _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(a_i8_high_vec, 1)), //
-        _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(b_i8_high_vec, 1)));
+    // The same trick won't work for the primary dot-product, as the signs vector components may differ.
+    // But unlike the full `int8_t` range, the magnitudes of `int4_t` values always fit into the signed
+    // argument of `_mm512_dpbusd_epi32`, so we can move the signs of `a` onto `b`.
+    ab_i32_vec = _simsimd_i4x64_dot_i32x16_ice(ab_i32_vec, a_i8_low_vec, b_i8_low_vec);
+    ab_i32_vec = _simsimd_i4x64_dot_i32x16_ice(ab_i32_vec, a_i8_high_vec, b_i8_high_vec);
     if (n_words) goto simsimd_cos_i4x2_ice_cycle;
 
-    int ab = _mm512_reduce_add_epi32(_mm512_add_epi32(ab_i32_low_vec, ab_i32_high_vec));
-    unsigned short a2_u16[32], b2_u16[32];
-    _mm512_storeu_si512(a2_u16, _mm512_add_epi16(a2_u16_low_vec, a2_u16_high_vec));
-    unsigned int a2 = 0, b2 = 0;
-    for (int i = 0; i < 32; ++i) a2 += a2_u16[i], b2 += b2_u16[i];
+    int ab = _mm512_reduce_add_epi32(ab_i32_vec);
+    int a2 = _mm512_reduce_add_epi32(a2_i32_vec);
+    int b2 = _mm512_reduce_add_epi32(b2_i32_vec);
     *result = _simsimd_cos_normalize_f32_haswell(ab, a2, b2);
 }
 
@@ -0,0 +1,436 @@
+/**
+ *  @file       strings.h
+ *  @brief      SIMD-accelerated similarity measures for strings and other byte sequences.
+ *  @author     Ash Vardanian
+ *  @date       October 15, 2026
+ *
+ *  Contains:
+ *  - Bounded Levenshtein edit distance
+ *  - Needleman-Wunsch global alignment score
+ *  - Smith-Waterman local alignment score
+ *
+ *  For datatypes:
+ *  - 8-bit unsigned integers, like ASCII and UTF-8 code units or nucleotides
+ *
+ *  For hardware architectures:
+ *  - Arm: NEON
+ *  - x86: Ice Lake
+ *
+ *  Every kernel compares a single query `a` against `b_count` sequences of `b`, each starting `b_stride` bytes
+ *  after the previous one and spanning its own `b_lengths[j]` bytes, so a padded matrix of short strings or
+ *  DNA reads can be scanned in one call. The dynamic programming matrices are never materialized. A single row
+ *  along the shorter of the two sequences is kept on the stack, so the shorter one can't be longer than
+ *  `SIMSIMD_STRINGS_MAX_LENGTH` bytes, and the pairs exceeding it report a NaN.
+ *
+ *  The Levenshtein kernels count unit-cost insertions, deletions, and substitutions, and stop early as soon as
+ *  the distance is known to exceed the `bound`, reporting `bound + 1` in that case. The SIMD backends use the
+ *  bit-parallel algorithm of Myers (1999), processing 64 rows of the matrix per machine word, and deriving the
+ *  equality bitmask of every text character and 64 pattern characters with a single vector comparison.
+ *
+ *  The alignment kernels maximize the sum of the `match` and `mismatch` scores of the aligned characters and the
+ *  `gap` penalties of the unaligned ones, which are usually negative. Scores are accumulated in 32-bit integers.
+ *  The SIMD backends compute every row of the matrix in two steps: the diagonal and vertical transitions are
+ *  independent between the lanes, while the horizontal ones form a prefix-maximum, scanned in the register.
+ *
+ *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
+ *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
+ */
+#ifndef SIMSIMD_STRINGS_H
+#define SIMSIMD_STRINGS_H
+
+#include "types.h"
+
+/**
+ *  @brief  Maximum length of the shorter sequence in every compared pair. The kernels keep a row of as many
+ *          32-bit or 64-bit scores on the stack, so the default occupies up to 8 KB.
+ */
+#if !defined(SIMSIMD_STRINGS_MAX_LENGTH)
+#define SIMSIMD_STRINGS_MAX_LENGTH 1024
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// clang-format off
+
+/*  One-to-many bounded Levenshtein distances, reporting `bound + 1` for the pairs further apart than `bound`.
+ *  Pass `(simsimd_size_t)-1` as the `bound` to compute the exact distances. Pairs, where both sequences are
+ *  longer than `SIMSIMD_STRINGS_MAX_LENGTH` bytes, report a NaN.
+ */
+SIMSIMD_PUBLIC void simsimd_levenshtein_batch_u8_serial(simsimd_u8_t const* a, simsimd_size_t a_length, simsimd_u8_t const* b, simsimd_size_t const* b_lengths, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t bound, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_levenshtein_batch_u8_neon(simsimd_u8_t const* a, simsimd_size_t a_length, simsimd_u8_t const* b, simsimd_size_t const* b_lengths, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t bound, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_levenshtein_batch_u8_ice(simsimd_u8_t const* a, simsimd_size_t a_length, simsimd_u8_t const* b, simsimd_size_t const* b_lengths, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t bound, simsimd_distance_t* results);
+
+/*  One-to-many global and local alignment scores with a linear gap penalty. Pairs, where both sequences are
+ *  longer than `SIMSIMD_STRINGS_MAX_LENGTH` bytes, report a NaN.
+ */
+SIMSIMD_PUBLIC void simsimd_needleman_wunsch_batch_u8_serial(simsimd_u8_t const* a, simsimd_size_t a_length, simsimd_u8_t const* b, simsimd_size_t const* b_lengths, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_i32_t match, simsimd_i32_t mismatch, simsimd_i32_t gap, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_needleman_wunsch_batch_u8_neon(simsimd_u8_t const* a, simsimd_size_t a_length, simsimd_u8_t const* b, simsimd_size_t const* b_lengths, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_i32_t match, simsimd_i32_t mismatch, simsimd_i32_t gap, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_needleman_wunsch_batch_u8_ice(simsimd_u8_t const* a, simsimd_size_t a_length, simsimd_u8_t const* b, simsimd_size_t const* b_lengths, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_i32_t match, simsimd_i32_t mismatch, simsimd_i32_t gap, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_smith_waterman_batch_u8_serial(simsimd_u8_t const* a, simsimd_size_t a_length, simsimd_u8_t const* b, simsimd_size_t const* b_lengths, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_i32_t match, simsimd_i32_t mismatch, simsimd_i32_t gap, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_smith_waterman_batch_u8_neon(simsimd_u8_t const* a, simsimd_size_t a_length, simsimd_u8_t const* b, simsimd_size_t const* b_lengths, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_i32_t match, simsimd_i32_t mismatch, simsimd_i32_t gap, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_smith_waterman_batch_u8_ice(simsimd_u8_t const* a, simsimd_size_t a_length, simsimd_u8_t const* b, simsimd_size_t const* b_lengths, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_i32_t match, simsimd_i32_t mismatch, simsimd_i32_t gap, simsimd_distance_t* results);
+// clang-format on
+
+/**
+ *  @brief  Generates a one-to-many Levenshtein kernel, matching the shorter sequence of every pair against the
+ *          longer one with the `_simsimd_levenshtein_u8_##isa` helper, which may return any value above the
+ *          `bound` once the latter is exceeded.
+ */
+#define SIMSIMD_MAKE_LEVENSHTEIN_BATCH(isa)                                                                     \
+    SIMSIMD_PUBLIC void simsimd_levenshtein_batch_u8_##isa(                                                     \
+        simsimd_u8_t const *a, simsimd_size_t a_length, simsimd_u8_t const *b, simsimd_size_t const *b_lengths, \
+        simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t bound, simsimd_distance_t *results) {   \
+        for (simsimd_size_t j = 0; j != b_count; ++j) {                                                         \
+            simsimd_u8_t const *b_row = SIMSIMD_ROW(simsimd_u8_t, b, b_stride, j);                              \
+            simsimd_u8_t const *shorter = a, *longer = b_row;                                                   \
+            simsimd_size_t shorter_length = a_length, longer_length = b_lengths[j];                             \
+            if (longer_length < shorter_length)                                                                 \
+                shorter = b_row, longer = a, shorter_length = b_lengths[j], longer_length = a_length;           \
+            if (shorter_length > SIMSIMD_STRINGS_MAX_LENGTH) { results[j] = _simsimd_f64_nan(); }               \
+            else if (longer_length - shorter_length > bound) { results[j] = (simsimd_distance_t)bound + 1; }    \
+            else {                                                                                              \
+                simsimd_size_t distance =                                                                       \
+                    _simsimd_levenshtein_u8_##isa(shorter, shorter_length, longer, longer_length, bound);       \
+                results[j] = distance > bound ? (simsimd_distance_t)bound + 1 : (simsimd_distance_t)distance;   \
+            }                                                                                                   \
+        }                                                                                                       \
+    }
+
+/**
+ *  @brief  Generates a one-to-many alignment kernel, scoring the shorter sequence of every pair against the longer
+ *          one with the `_simsimd_alignment_u8_##isa` helper, local for Smith-Waterman and global otherwise.
+ */
+#define SIMSIMD_MAKE_ALIGNMENT_BATCH(name, local, isa)                                                          \
+    SIMSIMD_PUBLIC void simsimd_##name##_batch_u8_##isa(                                                        \
+        simsimd_u8_t const *a, simsimd_size_t a_length, simsimd_u8_t const *b, simsimd_size_t const *b_lengths, \
+        simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_i32_t match, simsimd_i32_t mismatch,           \
+        simsimd_i32_t gap, simsimd_distance_t *results) {                                                       \
+        for (simsimd_size_t j = 0; j != b_count; ++j) {                                                         \
+            simsimd_u8_t const *b_row = SIMSIMD_ROW(simsimd_u8_t, b, b_stride, j);                              \
+            simsimd_u8_t const *shorter = a, *longer = b_row;                                                   \
+            simsimd_size_t shorter_length = a_length, longer_length = b_lengths[j];                             \
+            if (longer_length < shorter_length)                                                                 \
+                shorter = b_row, longer = a, shorter_length = b_lengths[j], longer_length = a_length;           \
+            if (shorter_length > SIMSIMD_STRINGS_MAX_LENGTH) { results[j] = _simsimd_f64_nan(); }               \
+            else {                                                                                              \
+                results[j] = _simsimd_alignment_u8_##isa(shorter, shorter_length, longer, longer_length, match, \
+                                                         mismatch, gap, local);                                 \
+            }                                                                                                   \
+        }                                                                                                       \
+    }
+
+/**
+ *  @brief  Wagner-Fischer edit distance, keeping one row along the `pattern`, and stopping as soon as the whole
+ *          row exceeds the `bound`, as its minimum never decreases from one row to the next.
+ */
+SIMSIMD_INTERNAL simsimd_size_t _simsimd_levenshtein_u8_serial(simsimd_u8_t const *pattern, simsimd_size_t m,
+                                                               simsimd_u8_t const *text, simsimd_size_t n,
+                                                               simsimd_size_t bound) {
+    simsimd_size_t row[SIMSIMD_STRINGS_MAX_LENGTH + 1];
+    for (simsimd_size_t i = 0; i <= m; ++i) row[i] = i;
+    for (simsimd_size_t j = 1; j <= n; ++j) {
+        simsimd_size_t diagonal = row[0], row_min = j;
+        row[0] = j;
+        for (simsimd_size_t i = 1; i <= m; ++i) {
+            simsimd_size_t up = row[i];
+            simsimd_size_t cost = diagonal + (pattern[i - 1] != text[j - 1]);
+            if (up + 1 < cost) cost = up + 1;
+            if (row[i - 1] + 1 < cost) cost = row[i - 1] + 1;
+            if (cost < row_min) row_min = cost;
+            row[i] = cost, diagonal = up;
+        }
+        if (row_min > bound) return row_min;
+    }
+    return row[m];
+}
+
+/**
+ *  @brief  Needleman-Wunsch or Smith-Waterman score, keeping one row along the `pattern`. The local variant clamps
+ *          every cell at zero and reports the maximum over the whole matrix.
+ */
+SIMSIMD_INTERNAL simsimd_i32_t _simsimd_alignment_u8_serial(simsimd_u8_t const *pattern, simsimd_size_t m,
+                                                            simsimd_u8_t const *text, simsimd_size_t n,
+                                                            simsimd_i32_t match, simsimd_i32_t mismatch,
+                                                            simsimd_i32_t gap, int local) {
+    simsimd_i32_t row[SIMSIMD_STRINGS_MAX_LENGTH + 1];
+    simsimd_i32_t best = 0;
+    for (simsimd_size_t j = 0; j <= m; ++j) row[j] = local ? 0 : (simsimd_i32_t)j * gap;
+    for (simsimd_size_t i = 1; i <= n; ++i) {
+        simsimd_i32_t diagonal = row[0];
+        row[0] = local ? 0 : (simsimd_i32_t)i * gap;
+        for (simsimd_size_t j = 1; j <= m; ++j) {
+            simsimd_i32_t up = row[j];
+            simsimd_i32_t score = diagonal + (pattern[j - 1] == text[i - 1] ? match : mismatch);
+            if (up + gap > score) score = up + gap;
+            if (row[j - 1] + gap > score) score = row[j - 1] + gap;
+            if (local && score < 0) score = 0;
+            if (score > best) best = score;
+            row[j] = score, diagonal = up;
+        }
+    }
+    return local ? best : row[m];
+}
+
+/**
+ *  @brief  Advances a 64-row block of the bit-parallel Levenshtein matrix by one text character, following the
+ *          `advance_block` procedure of Myers (1999).
+ *
+ *  @param[inout] positives  Bitmask of the rows, where the vertical delta is +1.
+ *  @param[inout] negatives  Bitmask of the rows, where the vertical delta is -1.
+ *  @param[in] equal         Bitmask of the rows, where the pattern character matches the text one.
+ *  @param[in] carry         Horizontal delta entering the first row of the block, from the block above.
+ *  @param[in] last          Bitmask of the last row of the block, the highest bit unless the pattern ends earlier.
+ *  @return                  Horizontal delta leaving the last row of the block.
+ */
+SIMSIMD_INTERNAL int _simsimd_levenshtein_advance_block(simsimd_u64_t *positives, simsimd_u64_t *negatives,
+                                                        simsimd_u64_t equal, int carry, simsimd_u64_t last) {
+    simsimd_u64_t vertical_positives = *positives, vertical_negatives = *negatives;
+    simsimd_u64_t vertical_changes = equal | vertical_negatives;
+    if (carry < 0) equal |= 1;
+    simsimd_u64_t horizontal_changes = (((equal & vertical_positives) + vertical_positives) ^ vertical_positives) |
+                                       equal;
+    simsimd_u64_t horizontal_positives = vertical_negatives | ~(horizontal_changes | vertical_positives);
+    simsimd_u64_t horizontal_negatives = vertical_positives & horizontal_changes;
+    int carry_out = (horizontal_positives & last) ? 1 : (horizontal_negatives & last) ? -1 : 0;
+    horizontal_positives <<= 1, horizontal_negatives <<= 1;
+    if (carry < 0) horizontal_negatives |= 1;
+    else if (carry > 0) horizontal_positives |= 1;
+    *positives = horizontal_negatives | ~(vertical_changes | horizontal_positives);
+    *negatives = horizontal_positives & vertical_changes;
+    return carry_out;
+}
+
+/**
+ *  @brief  Updates the distance in the last row of the bit-parallel Levenshtein matrix after `j` of `n` text
+ *          characters, returning zero once it can't come back within the `bound`, as every remaining character
+ *          can decrease it by at most one.
+ */
+SIMSIMD_INTERNAL int _simsimd_levenshtein_update_score(simsimd_size_t *score, int carry, simsimd_size_t j,
+                                                       simsimd_size_t n, simsimd_size_t bound) {
+    if (carry > 0) ++*score;
+    else if (carry < 0) --*score;
+    return *score <= bound || *score - bound <= n - j;
+}
+
+SIMSIMD_MAKE_LEVENSHTEIN_BATCH(serial)                    // simsimd_levenshtein_batch_u8_serial
+SIMSIMD_MAKE_ALIGNMENT_BATCH(needleman_wunsch, 0, serial) // simsimd_needleman_wunsch_batch_u8_serial
+SIMSIMD_MAKE_ALIGNMENT_BATCH(smith_waterman, 1, serial)   // simsimd_smith_waterman_batch_u8_serial
+
+#if _SIMSIMD_TARGET_ARM
+#if SIMSIMD_TARGET_NEON
+#pragma GCC push_options
+#pragma GCC target("arch=armv8.2-a+simd")
+#pragma clang attribute push(__attribute__((target("arch=armv8.2-a+simd"))), apply_to = function)
+
+/**
+ *  @brief  Bitmask of the 64 bytes of `pattern`, equal to the broadcasted text character, gathered with the
+ *          bit weights of every byte and three rounds of pairwise additions.
+ */
+SIMSIMD_INTERNAL simsimd_u64_t _simsimd_equal_mask_u8x64_neon(simsimd_u8_t const *pattern, uint8x16_t text_vec) {
+    uint8x16_t const weights_vec = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t equal0_vec = vandq_u8(vceqq_u8(vld1q_u8(pattern + 0), text_vec), weights_vec);
+    uint8x16_t equal1_vec = vandq_u8(vceqq_u8(vld1q_u8(pattern + 16), text_vec), weights_vec);
+    uint8x16_t equal2_vec = vandq_u8(vceqq_u8(vld1q_u8(pattern + 32), text_vec), weights_vec);
+    uint8x16_t equal3_vec = vandq_u8(vceqq_u8(vld1q_u8(pattern + 48), text_vec), weights_vec);
+    uint8x16_t sums_vec = vpaddq_u8(vpaddq_u8(equal0_vec, equal1_vec), vpaddq_u8(equal2_vec, equal3_vec));
+    sums_vec = vpaddq_u8(sums_vec, sums_vec);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sums_vec), 0);
+}
+
+SIMSIMD_INTERNAL simsimd_size_t _simsimd_levenshtein_u8_neon(simsimd_u8_t const *pattern, simsimd_size_t m,
+                                                             simsimd_u8_t const *text, simsimd_size_t n,
+                                                             simsimd_size_t bound) {
+    if (!m) return n;
+    simsimd_u64_t positives[(SIMSIMD_STRINGS_MAX_LENGTH + 63) / 64], negatives[(SIMSIMD_STRINGS_MAX_LENGTH + 63) / 64];
+    simsimd_size_t const blocks = (m + 63) / 64;
+    simsimd_u64_t const last = 1ull << ((m - 1) % 64);
+    for (simsimd_size_t block = 0; block != blocks; ++block) positives[block] = ~0ull, negatives[block] = 0;
+
+    // The trailing bytes of the pattern are copied into a zero-padded buffer, as the bits above the last row
+    // only ever affect the higher bits, and never the distance.
+    simsimd_u8_t tail[64] = {0};
+    simsimd_size_t const tail_offset = (blocks - 1) * 64;
+    for (simsimd_size_t i = tail_offset; i != m; ++i) tail[i - tail_offset] = pattern[i];
+
+    simsimd_size_t score = m;
+    for (simsimd_size_t j = 0; j != n; ++j) {
+        uint8x16_t text_vec = vdupq_n_u8(text[j]);
+        int carry = 1;
+        for (simsimd_size_t block = 0; block + 1 < blocks; ++block) {
+            simsimd_u64_t equal = _simsimd_equal_mask_u8x64_neon(pattern + block * 64, text_vec);
+            carry = _simsimd_levenshtein_advance_block(&positives[block], &negatives[block], equal, carry,
+                                                       0x8000000000000000ull);
+        }
+        simsimd_u64_t equal = _simsimd_equal_mask_u8x64_neon(tail, text_vec);
+        carry = _simsimd_levenshtein_advance_block(&positives[blocks - 1], &negatives[blocks - 1], equal, carry, last);
+        if (!_simsimd_levenshtein_update_score(&score, carry, j + 1, n, bound)) return score;
+    }
+    return score;
+}
+
+SIMSIMD_INTERNAL simsimd_i32_t _simsimd_alignment_u8_neon(simsimd_u8_t const *pattern, simsimd_size_t m,
+                                                          simsimd_u8_t const *text, simsimd_size_t n,
+                                                          simsimd_i32_t match, simsimd_i32_t mismatch,
+                                                          simsimd_i32_t gap, int local) {
+    // The row is padded to a whole number of 16-byte chunks, so the last one can be updated without masking.
+    simsimd_i32_t row[SIMSIMD_STRINGS_MAX_LENGTH + 17];
+    simsimd_size_t const padded = (m + 15) / 16 * 16;
+    for (simsimd_size_t j = 0; j <= padded; ++j) row[j] = local ? 0 : (simsimd_i32_t)j * gap;
+    simsimd_u8_t tail[16] = {0};
+    for (simsimd_size_t j = m / 16 * 16; j != m; ++j) tail[j - m / 16 * 16] = pattern[j];
+
+    int32x4_t const match_vec = vdupq_n_s32(match), mismatch_vec = vdupq_n_s32(mismatch), gap_vec = vdupq_n_s32(gap);
+    int32x4_t const gap4_vec = vdupq_n_s32(gap * 4), zeros_vec = vdupq_n_s32(0);
+    int32x4_t const infinities_vec = vdupq_n_s32(-2147483647 - 1);
+    int32x4_t const first_offsets_vec = {gap, gap * 2, gap * 3, gap * 4};
+    uint32x4_t const lanes_vec = {0, 1, 2, 3};
+    int32x4_t best_vec = zeros_vec;
+
+    for (simsimd_size_t i = 1; i <= n; ++i) {
+        uint8x16_t text_vec = vdupq_n_u8(text[i - 1]);
+        int32x4_t previous_up_vec = vdupq_n_s32(row[0]);
+        row[0] = local ? 0 : (simsimd_i32_t)i * gap;
+        // Prefix maximum of the horizontal transitions, shifted by the gap penalties to the first column.
+        int32x4_t carry_vec = vdupq_n_s32(row[0]);
+        int32x4_t offsets_vec = first_offsets_vec;
+        for (simsimd_size_t j = 0; j < m; j += 16) {
+            simsimd_u8_t const *chunk = j + 16 <= m ? pattern + j : tail;
+            int8x16_t equal_vec = vreinterpretq_s8_u8(vceqq_u8(vld1q_u8(chunk), text_vec));
+            int16x8_t equal_low_vec = vmovl_s8(vget_low_s8(equal_vec)), equal_high_vec = vmovl_high_s8(equal_vec);
+            int32x4_t equals_vec[4];
+            equals_vec[0] = vmovl_s16(vget_low_s16(equal_low_vec)), equals_vec[1] = vmovl_high_s16(equal_low_vec);
+            equals_vec[2] = vmovl_s16(vget_low_s16(equal_high_vec)), equals_vec[3] = vmovl_high_s16(equal_high_vec);
+            for (simsimd_size_t quad = 0; quad != 4 && j + quad * 4 < m; ++quad) {
+                simsimd_i32_t *cells = row + j + quad * 4 + 1;
+                int32x4_t up_vec = vld1q_s32(cells);
+                int32x4_t diagonal_vec = vextq_s32(previous_up_vec, up_vec, 3);
+                int32x4_t scores_vec = vbslq_s32(vreinterpretq_u32_s32(equals_vec[quad]), match_vec, mismatch_vec);
+                int32x4_t cell_vec = vmaxq_s32(vaddq_s32(diagonal_vec, scores_vec), vaddq_s32(up_vec, gap_vec));
+                if (local) cell_vec = vmaxq_s32(cell_vec, zeros_vec);
+                cell_vec = vsubq_s32(cell_vec, offsets_vec);
+                cell_vec = vmaxq_s32(cell_vec, vextq_s32(infinities_vec, cell_vec, 3));
+                cell_vec = vmaxq_s32(cell_vec, vextq_s32(infinities_vec, cell_vec, 2));
+                cell_vec = vmaxq_s32(cell_vec, carry_vec);
+                carry_vec = vdupq_laneq_s32(cell_vec, 3);
+                cell_vec = vaddq_s32(cell_vec, offsets_vec);
+                vst1q_s32(cells, cell_vec);
+                if (local) {
+                    uint32x4_t valid_vec = vcltq_u32(lanes_vec, vdupq_n_u32((simsimd_u32_t)(m - j - quad * 4)));
+                    best_vec = vmaxq_s32(best_vec, vbslq_s32(valid_vec, cell_vec, zeros_vec));
+                }
+                previous_up_vec = up_vec;
+                offsets_vec = vaddq_s32(offsets_vec, gap4_vec);
+            }
+        }
+    }
+    return local ? vmaxvq_s32(best_vec) : row[m];
+}
+
+SIMSIMD_MAKE_LEVENSHTEIN_BATCH(neon)                    // simsimd_levenshtein_batch_u8_neon
+SIMSIMD_MAKE_ALIGNMENT_BATCH(needleman_wunsch, 0, neon) // simsimd_needleman_wunsch_batch_u8_neon
+SIMSIMD_MAKE_ALIGNMENT_BATCH(smith_waterman, 1, neon)   // simsimd_smith_waterman_batch_u8_neon
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON
+#endif // _SIMSIMD_TARGET_ARM
+
+#if _SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_ICE
+#pragma GCC push_options
+#pragma GCC target("avx2", "avx512f", "avx512vl", "bmi2", "avx512bw", "avx512vpopcntdq")
+#pragma clang attribute push(__attribute__((target("avx2,avx512f,avx512vl,bmi2,avx512bw,avx512vpopcntdq"))), \
+                             apply_to = function)
+
+SIMSIMD_INTERNAL simsimd_size_t _simsimd_levenshtein_u8_ice(simsimd_u8_t const *pattern, simsimd_size_t m,
+                                                            simsimd_u8_t const *text, simsimd_size_t n,
+                                                            simsimd_size_t bound) {
+    if (!m) return n;
+    simsimd_u64_t positives[(SIMSIMD_STRINGS_MAX_LENGTH + 63) / 64], negatives[(SIMSIMD_STRINGS_MAX_LENGTH + 63) / 64];
+    simsimd_size_t const blocks = (m + 63) / 64;
+    simsimd_u64_t const last = 1ull << ((m - 1) % 64);
+    __mmask64 const tail_mask = (__mmask64)_bzhi_u64(0xFFFFFFFFFFFFFFFF, m - (blocks - 1) * 64);
+    for (simsimd_size_t block = 0; block != blocks; ++block) positives[block] = ~0ull, negatives[block] = 0;
+
+    simsimd_size_t score = m;
+    for (simsimd_size_t j = 0; j != n; ++j) {
+        __m512i text_vec = _mm512_set1_epi8((char)text[j]);
+        int carry = 1;
+        for (simsimd_size_t block = 0; block + 1 < blocks; ++block) {
+            __m512i pattern_vec = _mm512_loadu_si512(pattern + block * 64);
+            simsimd_u64_t equal = _mm512_cmpeq_epi8_mask(pattern_vec, text_vec);
+            carry = _simsimd_levenshtein_advance_block(&positives[block], &negatives[block], equal, carry,
+                                                       0x8000000000000000ull);
+        }
+        __m512i pattern_vec = _mm512_maskz_loadu_epi8(tail_mask, pattern + (blocks - 1) * 64);
+        simsimd_u64_t equal = _mm512_mask_cmpeq_epi8_mask(tail_mask, pattern_vec, text_vec);
+        carry = _simsimd_levenshtein_advance_block(&positives[blocks - 1], &negatives[blocks - 1], equal, carry, last);
+        if (!_simsimd_levenshtein_update_score(&score, carry, j + 1, n, bound)) return score;
+    }
+    return score;
+}
+
+SIMSIMD_INTERNAL simsimd_i32_t _simsimd_alignment_u8_ice(simsimd_u8_t const *pattern, simsimd_size_t m,
+                                                         simsimd_u8_t const *text, simsimd_size_t n,
+                                                         simsimd_i32_t match, simsimd_i32_t mismatch,
+                                                         simsimd_i32_t gap, int local) {
+    simsimd_i32_t row[SIMSIMD_STRINGS_MAX_LENGTH + 1];
+    for (simsimd_size_t j = 0; j <= m; ++j) row[j] = local ? 0 : (simsimd_i32_t)j * gap;
+
+    __m512i const match_vec = _mm512_set1_epi32(match), mismatch_vec = _mm512_set1_epi32(mismatch);
+    __m512i const gap_vec = _mm512_set1_epi32(gap), gap16_vec = _mm512_set1_epi32(gap * 16);
+    __m512i const zeros_vec = _mm512_setzero_si512(), infinities_vec = _mm512_set1_epi32(-2147483647 - 1);
+    __m512i const last_lane_vec = _mm512_set1_epi32(15);
+    __m512i const first_offsets_vec = _mm512_mullo_epi32(
+        _mm512_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16), gap_vec);
+    __m512i best_vec = zeros_vec;
+
+    for (simsimd_size_t i = 1; i <= n; ++i) {
+        __m128i text_vec = _mm_set1_epi8((char)text[i - 1]);
+        __m512i previous_up_vec = _mm512_set1_epi32(row[0]);
+        row[0] = local ? 0 : (simsimd_i32_t)i * gap;
+        // Prefix maximum of the horizontal transitions, shifted by the gap penalties to the first column.
+        __m512i carry_vec = _mm512_set1_epi32(row[0]);
+        __m512i offsets_vec = first_offsets_vec;
+        for (simsimd_size_t j = 0; j < m; j += 16) {
+            __mmask16 mask = m - j >= 16 ? (__mmask16)0xFFFF : (__mmask16)_bzhi_u32(0xFFFF, (unsigned)(m - j));
+            __m512i up_vec = _mm512_maskz_loadu_epi32(mask, row + j + 1);
+            __m512i diagonal_vec = _mm512_alignr_epi32(up_vec, previous_up_vec, 15);
+            __mmask16 equal = _mm_mask_cmpeq_epi8_mask(mask, _mm_maskz_loadu_epi8(mask, pattern + j), text_vec);
+            __m512i scores_vec = _mm512_mask_blend_epi32(equal, mismatch_vec, match_vec);
+            __m512i cell_vec = _mm512_max_epi32(_mm512_add_epi32(diagonal_vec, scores_vec),
+                                                _mm512_add_epi32(up_vec, gap_vec));
+            if (local) cell_vec = _mm512_max_epi32(cell_vec, zeros_vec);
+            cell_vec = _mm512_mask_sub_epi32(infinities_vec, mask, cell_vec, offsets_vec);
+            cell_vec = _mm512_max_epi32(cell_vec, _mm512_alignr_epi32(cell_vec, infinities_vec, 15));
+            cell_vec = _mm512_max_epi32(cell_vec, _mm512_alignr_epi32(cell_vec, infinities_vec, 14));
+            cell_vec = _mm512_max_epi32(cell_vec, _mm512_alignr_epi32(cell_vec, infinities_vec, 12));
+            cell_vec = _mm512_max_epi32(cell_vec, _mm512_alignr_epi32(cell_vec, infinities_vec, 8));
+            cell_vec = _mm512_max_epi32(cell_vec, carry_vec);
+            carry_vec = _mm512_permutexvar_epi32(last_lane_vec, cell_vec);
+            cell_vec = _mm512_add_epi32(cell_vec, offsets_vec);
+            _mm512_mask_storeu_epi32(row + j + 1, mask, cell_vec);
+            if (local) best_vec = _mm512_mask_max_epi32(best_vec, mask, best_vec, cell_vec);
+            previous_up_vec = up_vec;
+            offsets_vec = _mm512_add_epi32(offsets_vec, gap16_vec);
+        }
+    }
+    return local ? _mm512_reduce_max_epi32(best_vec) : row[m];
+}
+
+SIMSIMD_MAKE_LEVENSHTEIN_BATCH(ice)                    // simsimd_levenshtein_batch_u8_ice
+SIMSIMD_MAKE_ALIGNMENT_BATCH(needleman_wunsch, 0, ice) // simsimd_needleman_wunsch_batch_u8_ice
+SIMSIMD_MAKE_ALIGNMENT_BATCH(smith_waterman, 1, ice)   // simsimd_smith_waterman_batch_u8_ice
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_ICE
+#endif // _SIMSIMD_TARGET_X86
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
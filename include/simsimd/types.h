@@ -149,6 +149,18 @@
 #endif // defined(__ARM_FEATURE_SVE)
 #endif // !defined(SIMSIMD_TARGET_SVE2) || ...
 
+// Compiling for Arm: SIMSIMD_TARGET_SVE2P1
+//
+// SVE2.1 adds the 2-way `f16` dot-products into `f32` accumulators, but requires GCC 14 or Clang 18.
+#if !defined(SIMSIMD_TARGET_SVE2P1) || (SIMSIMD_TARGET_SVE2P1 && !_SIMSIMD_TARGET_ARM)
+#if defined(__ARM_FEATURE_SVE2p1)
+#define SIMSIMD_TARGET_SVE2P1 _SIMSIMD_TARGET_ARM
+#else
+#undef SIMSIMD_TARGET_SVE2P1
+#define SIMSIMD_TARGET_SVE2P1 0
+#endif // defined(__ARM_FEATURE_SVE2p1)
+#endif // !defined(SIMSIMD_TARGET_SVE2P1) || ...
+
 // Compiling for x86: SIMSIMD_TARGET_HASWELL
 //
 // Starting with Ivy Bridge, Intel supports the `F16C` extensions for fast half-precision
@@ -166,7 +178,7 @@
 #endif // !defined(SIMSIMD_TARGET_HASWELL) || ...
 
 // Compiling for x86: SIMSIMD_TARGET_SKYLAKE, SIMSIMD_TARGET_ICE, SIMSIMD_TARGET_GENOA,
-// SIMSIMD_TARGET_SAPPHIRE, SIMSIMD_TARGET_TURIN, SIMSIMD_TARGET_SIERRA
+// SIMSIMD_TARGET_SAPPHIRE, SIMSIMD_TARGET_SAPPHIRE_AMX, SIMSIMD_TARGET_TURIN, SIMSIMD_TARGET_SIERRA
 //
 // To list all available macros for x86, take a recent compiler, like GCC 12 and run:
 //      gcc-12 -march=sapphirerapids -dM -E - < /dev/null | egrep "SSE|AVX" | sort
@@ -206,6 +218,19 @@
 #define SIMSIMD_TARGET_SAPPHIRE 0
 #endif
 #endif // !defined(SIMSIMD_TARGET_SAPPHIRE) || ...
+#if !defined(SIMSIMD_TARGET_SAPPHIRE_AMX) || (SIMSIMD_TARGET_SAPPHIRE_AMX && !_SIMSIMD_TARGET_X86)
+#if defined(__AMX_TILE__) && defined(__AMX_BF16__) && defined(__AMX_INT8__)
+#define SIMSIMD_TARGET_SAPPHIRE_AMX 1
+#else
+#undef SIMSIMD_TARGET_SAPPHIRE_AMX
+#define SIMSIMD_TARGET_SAPPHIRE_AMX 0
+#endif
+#endif // !defined(SIMSIMD_TARGET_SAPPHIRE_AMX) || ...
+// The AMX kernels forward small inputs to the Genoa and Ice Lake kernels, so they can't be compiled without them
+#if SIMSIMD_TARGET_SAPPHIRE_AMX && (!SIMSIMD_TARGET_GENOA || !SIMSIMD_TARGET_ICE)
+#undef SIMSIMD_TARGET_SAPPHIRE_AMX
+#define SIMSIMD_TARGET_SAPPHIRE_AMX 0
+#endif
 #if !defined(SIMSIMD_TARGET_TURIN) || (SIMSIMD_TARGET_TURIN && !_SIMSIMD_TARGET_X86)
 #if defined(__AVX512VP2INTERSECT__)
 #define SIMSIMD_TARGET_TURIN 1
@@ -231,12 +256,12 @@
 #include <arm_neon.h>
 #endif
 
-#if SIMSIMD_TARGET_SVE || SIMSIMD_TARGET_SVE2
+#if SIMSIMD_TARGET_SVE || SIMSIMD_TARGET_SVE2 || SIMSIMD_TARGET_SVE2P1
 #include <arm_sve.h>
 #endif
 
 #if SIMSIMD_TARGET_HASWELL || SIMSIMD_TARGET_SKYLAKE || SIMSIMD_TARGET_ICE || SIMSIMD_TARGET_GENOA || \
-    SIMSIMD_TARGET_SAPPHIRE || SIMSIMD_TARGET_TURIN
+    SIMSIMD_TARGET_SAPPHIRE || SIMSIMD_TARGET_SAPPHIRE_AMX || SIMSIMD_TARGET_TURIN
 #include <immintrin.h>
 #endif
 
@@ -257,6 +282,21 @@
 #define SIMSIMD_LOG(x) (log(x))
 #endif
 
+#if !defined(SIMSIMD_SIN)
+#include <math.h>
+#define SIMSIMD_SIN(x) (sin(x))
+#endif
+
+#if !defined(SIMSIMD_COS)
+#include <math.h>
+#define SIMSIMD_COS(x) (cos(x))
+#endif
+
+#if !defined(SIMSIMD_ATAN2)
+#include <math.h>
+#define SIMSIMD_ATAN2(y, x) (atan2(y, x))
+#endif
+
 #if !defined(SIMSIMD_F32_DIVISION_EPSILON)
 #define SIMSIMD_F32_DIVISION_EPSILON (1e-7)
 #endif
@@ -271,6 +311,7 @@ extern "C" {
 
 typedef unsigned char simsimd_b8_t;
 typedef unsigned char simsimd_i4x2_t;
+typedef unsigned char simsimd_u4x2_t;
 
 typedef signed char simsimd_i8_t;
 typedef unsigned char simsimd_u8_t;
@@ -287,6 +328,41 @@ typedef double simsimd_f64_t;
 typedef simsimd_u64_t simsimd_size_t;
 typedef simsimd_f64_t simsimd_distance_t;
 
+/**
+ *  @brief  Enumeration of supported data types.
+ *
+ *  Includes complex type descriptors which in C code would use the real counterparts,
+ *  but the independent flags contain metadata to be passed between programming language
+ *  interfaces.
+ */
+typedef enum {
+    simsimd_datatype_unknown_k = 0,                  ///< Unknown data type
+    simsimd_datatype_b8_k = 1 << 1,                  ///< Single-bit values packed into 8-bit words
+    simsimd_datatype_b1x8_k = simsimd_datatype_b8_k, ///< Single-bit values packed into 8-bit words
+    simsimd_datatype_i4x2_k = 1 << 19,               ///< 4-bit signed integers packed into 8-bit words
+    simsimd_datatype_u4x2_k = 1 << 18,               ///< 4-bit unsigned integers packed into 8-bit words
+
+    simsimd_datatype_i8_k = 1 << 2,  ///< 8-bit signed integer
+    simsimd_datatype_i16_k = 1 << 3, ///< 16-bit signed integer
+    simsimd_datatype_i32_k = 1 << 4, ///< 32-bit signed integer
+    simsimd_datatype_i64_k = 1 << 5, ///< 64-bit signed integer
+
+    simsimd_datatype_u8_k = 1 << 6,  ///< 8-bit unsigned integer
+    simsimd_datatype_u16_k = 1 << 7, ///< 16-bit unsigned integer
+    simsimd_datatype_u32_k = 1 << 8, ///< 32-bit unsigned integer
+    simsimd_datatype_u64_k = 1 << 9, ///< 64-bit unsigned integer
+
+    simsimd_datatype_f64_k = 1 << 10,  ///< Double precision floating point
+    simsimd_datatype_f32_k = 1 << 11,  ///< Single precision floating point
+    simsimd_datatype_f16_k = 1 << 12,  ///< Half precision floating point
+    simsimd_datatype_bf16_k = 1 << 13, ///< Brain floating point
+
+    simsimd_datatype_f64c_k = 1 << 20,  ///< Complex double precision floating point
+    simsimd_datatype_f32c_k = 1 << 21,  ///< Complex single precision floating point
+    simsimd_datatype_f16c_k = 1 << 22,  ///< Complex half precision floating point
+    simsimd_datatype_bf16c_k = 1 << 23, ///< Complex brain floating point
+} simsimd_datatype_t;
+
 /*  @brief  Half-precision floating-point type.
  *
  *  - GCC or Clang on 64-bit Arm: `__fp16`, may require `-mfp16-format` option.
@@ -407,6 +483,31 @@ SIMSIMD_STATIC_ASSERT(sizeof(simsimd_bf16_t) == 2, simsimd_bf16_t_must_be_2_byte
 #define SIMSIMD_DEREFERENCE(x) (*(x))
 #define SIMSIMD_EXPORT(x, y) *(y) = x
 
+/**
+ *  @brief  Addresses the `j`-th row of a matrix of `type` scalars, separated by `stride` bytes.
+ *          Used by the one-to-many and many-to-many kernels, where rows may be padded or interleaved.
+ */
+#define SIMSIMD_ROW(type, base, stride, j) ((type const *)((simsimd_u8_t const *)(base) + (j) * (stride)))
+
+/**
+ *  @brief  Sign-extends the low and the high nibbles of a `simsimd_i4x2_t` word, the first and the second
+ *          scalar respectively, from the [-8, 7] range to 32-bit integers.
+ */
+#define SIMSIMD_I4X2_LOW(x) ((simsimd_i32_t)(((x) & 0x0F) ^ 0x08) - 8)
+#define SIMSIMD_I4X2_HIGH(x) ((simsimd_i32_t)((((x) >> 4) & 0x0F) ^ 0x08) - 8)
+
+/**
+ *  @brief  Loads the `i`-th scalar of a vector, addressing byte-sized and sub-byte types alike,
+ *          as the asymmetric kernels count dimensions rather than words.
+ */
+#define SIMSIMD_INDEX(x, i) ((x)[i])
+#define SIMSIMD_I4X2_INDEX(x, i) ((i) & 1 ? SIMSIMD_I4X2_HIGH((x)[(i) / 2]) : SIMSIMD_I4X2_LOW((x)[(i) / 2]))
+
+/**
+ *  @brief  Reconstructs a quantized scalar as `(x - zero_point) * scale`, using the `j`-th parameters.
+ */
+#define SIMSIMD_DEQUANTIZE(x, scales, zero_points, j) (((simsimd_f32_t)(x) - (zero_points)[j]) * (scales)[j])
+
 /**
  *  @brief  Returns the value of the half-precision floating-point number,
  *          potentially decompressed into single-precision.
@@ -454,6 +555,26 @@ typedef union {
     float f;
 } simsimd_f32i32_t;
 
+/** @brief  Convenience type for double-precision floating-point bit manipulations. */
+typedef union {
+    simsimd_u64_t i;
+    simsimd_f64_t f;
+} simsimd_f64i64_t;
+
+/** @brief  Positive infinity, without relying on `HUGE_VAL` from `<math.h>`. */
+SIMSIMD_INTERNAL simsimd_f64_t _simsimd_f64_infinity(void) {
+    simsimd_f64i64_t infinity;
+    infinity.i = 0x7FF0000000000000ull;
+    return infinity.f;
+}
+
+/** @brief  Quiet NaN, without relying on `NAN` from `<math.h>`. */
+SIMSIMD_INTERNAL simsimd_f64_t _simsimd_f64_nan(void) {
+    simsimd_f64i64_t nan;
+    nan.i = 0x7FF8000000000000ull;
+    return nan.f;
+}
+
 /**
  *  @brief  Computes `1/sqrt(x)` using the trick from Quake 3,
  *          replacing the magic numbers with the ones suggested by Jan Kadlec.
@@ -192,6 +192,77 @@ export const jensenshannon = (a: Float64Array | Float32Array, b: Float64Array |
   return Math.sqrt(divergence);
 };
 
+/**
+ * @brief Names of the metrics supported by the `batch` and `cdist` functions.
+ */
+export type BatchMetric = "dot" | "inner" | "cosine" | "sqeuclidean" | "euclidean" | "hamming" | "jaccard";
+
+type Vectors = Float64Array | Float32Array | Int8Array | Uint8Array;
+
+const pairwise = (metric: BatchMetric): ((a: any, b: any) => number) => {
+  switch (metric) {
+    case "dot":
+    case "inner":
+      return inner;
+    case "cosine":
+      return cosine;
+    case "sqeuclidean":
+      return sqeuclidean;
+    case "euclidean":
+      return (a, b) => Math.sqrt(sqeuclidean(a, b));
+    case "hamming":
+      return hamming;
+    case "jaccard":
+      return jaccard;
+    default:
+      throw new Error(`Unknown metric: ${metric}`);
+  }
+};
+
+/**
+ * @brief Computes the distances between every row of `a` and every row of `b`, both stored row-major.
+ * @param {Float64Array|Float32Array|Int8Array|Uint8Array} a - The first matrix.
+ * @param {Float64Array|Float32Array|Int8Array|Uint8Array} b - The second matrix.
+ * @param {number} dimensions - The number of scalars in every row.
+ * @param {Float64Array|Float32Array} out - The row-major output with a row per vector of `a`.
+ * @param {BatchMetric} metric - The name of the metric.
+ */
+export const cdist = (
+  a: Vectors,
+  b: Vectors,
+  dimensions: number,
+  out: Float64Array | Float32Array,
+  metric: BatchMetric
+): void => {
+  if (!(dimensions > 0) || a.length % dimensions !== 0 || b.length % dimensions !== 0) {
+    throw new Error("Lengths of the inputs must be multiples of the number of dimensions");
+  }
+  const aCount = a.length / dimensions;
+  const bCount = b.length / dimensions;
+  if (out.length < aCount * bCount) {
+    throw new Error("The output is too short to hold all the distances");
+  }
+
+  const distance = pairwise(metric);
+  for (let i = 0; i < aCount; i++) {
+    const row = a.subarray(i * dimensions, (i + 1) * dimensions);
+    for (let j = 0; j < bCount; j++) {
+      out[i * bCount + j] = distance(row, b.subarray(j * dimensions, (j + 1) * dimensions));
+    }
+  }
+};
+
+/**
+ * @brief Computes the distances between the `query` and every row of the row-major `matrix`.
+ * @param {Float64Array|Float32Array|Int8Array|Uint8Array} query - The query vector.
+ * @param {Float64Array|Float32Array|Int8Array|Uint8Array} matrix - The candidate vectors.
+ * @param {Float64Array|Float32Array} out - The output with an entry per row of the `matrix`.
+ * @param {BatchMetric} metric - The name of the metric.
+ */
+export const batch = (query: Vectors, matrix: Vectors, out: Float64Array | Float32Array, metric: BatchMetric): void => {
+  cdist(query, matrix, query.length, out, metric);
+};
+
 export default {
   sqeuclidean,
   cosine,
@@ -200,4 +271,6 @@ export default {
   jaccard,
   kullbackleibler,
   jensenshannon,
+  batch,
+  cdist,
 };
@@ -8,12 +8,26 @@
  *  @see        NodeJS docs: https://nodejs.org/api/n-api.html
  */
 
+#include <stdlib.h> // `malloc`, `free`
+#include <string.h> // `strcmp`
+
 #include <node_api.h>        // `napi_*` functions
 #include <simsimd/simsimd.h> // `simsimd_*` functions
 
 /// @brief  Global variable that caches the CPU capabilities, and is computed just onc, when the module is loaded.
 simsimd_capability_t static_capabilities = simsimd_cap_serial_k;
 
+/// @brief  Maps the supported typed arrays to SimSIMD datatypes, treating `Uint8Array` as packed bits.
+simsimd_datatype_t datatypeOf(napi_typedarray_type type) {
+    switch (type) {
+    case napi_float64_array: return simsimd_datatype_f64_k;
+    case napi_float32_array: return simsimd_datatype_f32_k;
+    case napi_int8_array: return simsimd_datatype_i8_k;
+    case napi_uint8_array: return simsimd_datatype_b8_k;
+    default: return simsimd_datatype_unknown_k;
+    }
+}
+
 napi_value runAPI(napi_env env, napi_callback_info info, simsimd_metric_kind_t metric_kind) {
     size_t argc = 2;
     napi_value args[2];
@@ -44,14 +58,7 @@ napi_value runAPI(napi_env env, napi_callback_info info, simsimd_metric_kind_t m
         return NULL;
     }
 
-    simsimd_datatype_t datatype = simsimd_datatype_unknown_k;
-    switch (type_a) {
-    case napi_float64_array: datatype = simsimd_datatype_f64_k; break;
-    case napi_float32_array: datatype = simsimd_datatype_f32_k; break;
-    case napi_int8_array: datatype = simsimd_datatype_i8_k; break;
-    case napi_uint8_array: datatype = simsimd_datatype_b8_k; break;
-    default: break;
-    }
+    simsimd_datatype_t datatype = datatypeOf(type_a);
 
     simsimd_metric_punned_t metric = NULL;
     simsimd_capability_t capability = simsimd_cap_serial_k;
@@ -80,6 +87,156 @@ napi_value jsAPI(napi_env env, napi_callback_info info) { return runAPI(env, inf
 napi_value hammingAPI(napi_env env, napi_callback_info info) { return runAPI(env, info, simsimd_metric_hamming_k); }
 napi_value jaccardAPI(napi_env env, napi_callback_info info) { return runAPI(env, info, simsimd_metric_jaccard_k); }
 
+/// @brief  Size of a scalar in the supported typed arrays, used to compute the strides between rows.
+size_t scalarSizeOf(napi_typedarray_type type) {
+    switch (type) {
+    case napi_float64_array: return 8;
+    case napi_float32_array: return 4;
+    default: return 1;
+    }
+}
+
+/**
+ *  @brief  Parses the metric name of the batch APIs into the one-to-many and many-to-many kernel kinds.
+ *  @return 1 on success, 0 after throwing a JavaScript error.
+ */
+int parseBatchMetric(napi_env env, napi_value value, simsimd_metric_kind_t *batch_kind,
+                     simsimd_metric_kind_t *cdist_kind) {
+    char name[16];
+    size_t length = 0;
+    if (napi_get_value_string_utf8(env, value, name, sizeof(name), &length) != napi_ok) {
+        napi_throw_type_error(env, NULL, "The metric must be a string");
+        return 0;
+    }
+    if (strcmp(name, "dot") == 0 || strcmp(name, "inner") == 0)
+        *batch_kind = simsimd_metric_dot_batch_k, *cdist_kind = simsimd_metric_dot_cdist_k;
+    else if (strcmp(name, "cosine") == 0)
+        *batch_kind = simsimd_metric_cos_batch_k, *cdist_kind = simsimd_metric_cos_cdist_k;
+    else if (strcmp(name, "sqeuclidean") == 0)
+        *batch_kind = simsimd_metric_l2sq_batch_k, *cdist_kind = simsimd_metric_l2sq_cdist_k;
+    else if (strcmp(name, "euclidean") == 0)
+        *batch_kind = simsimd_metric_l2_batch_k, *cdist_kind = simsimd_metric_l2_cdist_k;
+    else if (strcmp(name, "hamming") == 0)
+        *batch_kind = simsimd_metric_hamming_batch_k, *cdist_kind = simsimd_metric_hamming_cdist_k;
+    else if (strcmp(name, "jaccard") == 0)
+        *batch_kind = simsimd_metric_jaccard_batch_k, *cdist_kind = simsimd_metric_jaccard_cdist_k;
+    else {
+        napi_throw_error(env, NULL, "Unknown metric, expected 'dot', 'inner', 'cosine', 'sqeuclidean', 'euclidean', "
+                                    "'hamming' or 'jaccard'");
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ *  @brief  Computes `a_count` by `b_count` distances into a `Float64Array` or a `Float32Array`.
+ *          Kernels always produce doubles, so single-precision outputs go through a temporary buffer.
+ *          If there is no many-to-many kernel for the datatype, rows of `a` are processed one by one.
+ */
+napi_value runBatchAPI(napi_env env, napi_value const *args, size_t dimensions, size_t a_count,
+                       napi_value metric_name) {
+
+    void *data_a, *data_b, *data_out;
+    size_t length_a, length_b, length_out;
+    napi_typedarray_type type_a, type_b, type_out;
+    if (napi_get_typedarray_info(env, args[0], &type_a, &length_a, &data_a, NULL, NULL) != napi_ok ||
+        napi_get_typedarray_info(env, args[1], &type_b, &length_b, &data_b, NULL, NULL) != napi_ok ||
+        napi_get_typedarray_info(env, args[2], &type_out, &length_out, &data_out, NULL, NULL) != napi_ok ||
+        type_a != type_b) {
+        napi_throw_error(env, NULL, "Inputs must be typed arrays of matching types");
+        return NULL;
+    }
+    if (type_out != napi_float64_array && type_out != napi_float32_array) {
+        napi_throw_type_error(env, NULL, "Outputs must be `Float64Array` or `Float32Array`");
+        return NULL;
+    }
+    simsimd_datatype_t const datatype = datatypeOf(type_a);
+    if (dimensions == 0 || length_a % dimensions != 0 || length_b % dimensions != 0) {
+        napi_throw_range_error(env, NULL, "Lengths of the inputs must be multiples of the number of dimensions");
+        return NULL;
+    }
+    if (a_count == 0) a_count = length_a / dimensions;
+    size_t const b_count = length_b / dimensions;
+    if (length_out < a_count * b_count) {
+        napi_throw_range_error(env, NULL, "The output is too short to hold all the distances");
+        return NULL;
+    }
+
+    simsimd_metric_kind_t batch_kind, cdist_kind;
+    if (!parseBatchMetric(env, metric_name, &batch_kind, &cdist_kind)) return NULL;
+    simsimd_metric_punned_t batch = NULL, cdist = NULL;
+    simsimd_capability_t capability = simsimd_cap_serial_k;
+    simsimd_find_metric_punned(batch_kind, datatype, static_capabilities, simsimd_cap_any_k, &batch, &capability);
+    if (a_count > 1)
+        simsimd_find_metric_punned(cdist_kind, datatype, static_capabilities, simsimd_cap_any_k, &cdist, &capability);
+    if (batch == NULL) {
+        napi_throw_error(env, NULL, "Unsupported datatype for given metric");
+        return NULL;
+    }
+
+    napi_value undefined;
+    napi_get_undefined(env, &undefined);
+    if (a_count == 0 || b_count == 0) return undefined;
+
+    simsimd_distance_t *results = (simsimd_distance_t *)data_out;
+    if (type_out == napi_float32_array) {
+        results = (simsimd_distance_t *)malloc(a_count * b_count * sizeof(simsimd_distance_t));
+        if (!results) {
+            napi_throw_error(env, NULL, "Failed to allocate memory for the distances");
+            return NULL;
+        }
+    }
+
+    size_t const stride = dimensions * scalarSizeOf(type_a);
+    if (cdist)
+        ((simsimd_metric_cdist_punned_t)cdist)(data_a, data_b, a_count, stride, b_count, stride, dimensions, results,
+                                               b_count * sizeof(simsimd_distance_t));
+    else
+        for (size_t i = 0; i != a_count; ++i)
+            ((simsimd_metric_batch_punned_t)batch)((char const *)data_a + i * stride, data_b, b_count, stride,
+                                                   dimensions, results + i * b_count);
+
+    if (type_out == napi_float32_array) {
+        simsimd_f32_t *out = (simsimd_f32_t *)data_out;
+        for (size_t i = 0; i != a_count * b_count; ++i) out[i] = (simsimd_f32_t)results[i];
+        free(results);
+    }
+    return undefined;
+}
+
+/// @brief  Computes distances from one query to every row of a matrix: `batch(query, matrix, out, metric)`.
+napi_value batchAPI(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    if (napi_get_cb_info(env, info, &argc, args, NULL, NULL) != napi_ok || argc != 4) {
+        napi_throw_error(env, NULL, "Wrong number of arguments");
+        return NULL;
+    }
+    size_t length_query;
+    if (napi_get_typedarray_info(env, args[0], NULL, &length_query, NULL, NULL, NULL) != napi_ok) {
+        napi_throw_error(env, NULL, "The query must be a typed array");
+        return NULL;
+    }
+    return runBatchAPI(env, args, length_query, 1, args[3]);
+}
+
+/// @brief  Computes distances between all pairs of rows: `cdist(a, b, dimensions, out, metric)`.
+napi_value cdistAPI(napi_env env, napi_callback_info info) {
+    size_t argc = 5;
+    napi_value args[5];
+    if (napi_get_cb_info(env, info, &argc, args, NULL, NULL) != napi_ok || argc != 5) {
+        napi_throw_error(env, NULL, "Wrong number of arguments");
+        return NULL;
+    }
+    int64_t dimensions = 0;
+    if (napi_get_value_int64(env, args[2], &dimensions) != napi_ok || dimensions <= 0) {
+        napi_throw_range_error(env, NULL, "The number of dimensions must be a positive integer");
+        return NULL;
+    }
+    napi_value const inputs[3] = {args[0], args[1], args[3]};
+    return runBatchAPI(env, inputs, (size_t)dimensions, 0, args[4]);
+}
+
 napi_value Init(napi_env env, napi_value exports) {
 
     // Define an array of property descriptors
@@ -91,8 +248,10 @@ napi_value Init(napi_env env, napi_value exports) {
     napi_property_descriptor jaccardDesc = {"jaccard", 0, jaccardAPI, 0, 0, 0, napi_default, 0};
     napi_property_descriptor klDesc = {"kullbackleibler", 0, klAPI, 0, 0, 0, napi_default, 0};
     napi_property_descriptor jsDesc = {"jensenshannon", 0, jsAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor batchDesc = {"batch", 0, batchAPI, 0, 0, 0, napi_default, 0};
+    napi_property_descriptor cdistDesc = {"cdist", 0, cdistAPI, 0, 0, 0, napi_default, 0};
     napi_property_descriptor properties[] = {
-        dotDesc, innerDesc, sqeuclideanDesc, cosineDesc, hammingDesc, jaccardDesc, klDesc, jsDesc,
+        dotDesc, innerDesc, sqeuclideanDesc, cosineDesc, hammingDesc, jaccardDesc, klDesc, jsDesc, batchDesc, cdistDesc,
     };
 
     // Define the properties on the `exports` object
@@ -102,6 +102,45 @@ export const jensenshannon = (a: Float64Array | Float32Array, b: Float64Array |
   return compiled.jensenshannon(a, b);
 };
 
+/**
+ * @brief Names of the metrics supported by the `batch` and `cdist` functions.
+ */
+export type BatchMetric = fallback.BatchMetric;
+
+/**
+ * @brief Computes the distances between the `query` and every row of the row-major `matrix` in a single native call.
+ * @param {Float64Array|Float32Array|Int8Array|Uint8Array} query - The query vector.
+ * @param {Float64Array|Float32Array|Int8Array|Uint8Array} matrix - The candidate vectors, of the same type as the query.
+ * @param {Float64Array|Float32Array} out - The output with an entry per row of the `matrix`.
+ * @param {BatchMetric} metric - The name of the metric.
+ */
+export const batch = (
+  query: Float64Array | Float32Array | Int8Array | Uint8Array,
+  matrix: Float64Array | Float32Array | Int8Array | Uint8Array,
+  out: Float64Array | Float32Array,
+  metric: BatchMetric
+): void => {
+  compiled.batch(query, matrix, out, metric);
+};
+
+/**
+ * @brief Computes the distances between every row of `a` and every row of `b` in a single native call.
+ * @param {Float64Array|Float32Array|Int8Array|Uint8Array} a - The first row-major matrix.
+ * @param {Float64Array|Float32Array|Int8Array|Uint8Array} b - The second row-major matrix, of the same type.
+ * @param {number} dimensions - The number of scalars in every row, or bytes for `Uint8Array` bit-vectors.
+ * @param {Float64Array|Float32Array} out - The row-major output with a row per vector of `a`.
+ * @param {BatchMetric} metric - The name of the metric.
+ */
+export const cdist = (
+  a: Float64Array | Float32Array | Int8Array | Uint8Array,
+  b: Float64Array | Float32Array | Int8Array | Uint8Array,
+  dimensions: number,
+  out: Float64Array | Float32Array,
+  metric: BatchMetric
+): void => {
+  compiled.cdist(a, b, dimensions, out, metric);
+};
+
 /**
  * Quantizes a floating-point vector into a binary vector (1 for positive values, 0 for non-positive values) and packs the result into a Uint8Array, where each element represents 8 binary values from the original vector.
  * This function is useful for preparing data for bitwise distance or similarity computations, such as Hamming or Jaccard indices.
@@ -132,6 +171,8 @@ export default {
   jaccard,
   kullbackleibler,
   jensenshannon,
+  batch,
+  cdist,
   toBinary,
 };
 
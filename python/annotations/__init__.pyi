@@ -1,4 +1,5 @@
-from typing import Any, Union, Literal, Optional, TypeAlias
+import os
+from typing import Any, Tuple, Union, Literal, Optional, TypeAlias
 
 # A lot of annotation features a depend on the Python version:
 # - `typing.TypeAlias` Type aliases are supported from Python 3.10 to 3.11
@@ -29,6 +30,9 @@ _MetricType = Literal[
     "mahalanobis",
     "fma",
     "wsum",
+    "scale",
+    "add",
+    "multiply",
 ]
 _IntegralType = Literal[
     # Booleans
@@ -84,7 +88,23 @@ _ComplexType = Literal[
     "complex128",
 ]
 
-class DistancesTensor(memoryview): ...
+class DistancesTensor(memoryview):
+    def __dlpack__(
+        self,
+        *,
+        stream: None = None,
+        max_version: Optional[Tuple[int, int]] = None,
+        dl_device: Optional[Tuple[int, int]] = None,
+        copy: Optional[bool] = None,
+    ) -> object: ...
+    def __dlpack_device__(self) -> Tuple[int, int]: ...
+
+class Workspace:
+    def __init__(self, capacity: int = 0) -> None: ...
+    @property
+    def capacity(self) -> int: ...
+    @property
+    def huge_pages(self) -> bool: ...
 
 # ---------------------------------------------------------------------
 
@@ -93,6 +113,11 @@ def get_capabilities() -> dict[str, bool]: ...
 def enable_capability(capability: str, /) -> None: ...
 def disable_capability(capability: str, /) -> None: ...
 
+# Counting kernel calls, if compiled with `SIMSIMD_INSTRUMENTATION=1`
+def configure_kernel_usage(options: str, /) -> bool: ...
+def get_kernel_usage() -> list[dict[str, Union[str, int, None]]]: ...
+def reset_kernel_usage() -> None: ...
+
 # Accessing function pointers
 def pointer_to_euclidean(dtype: Union[_IntegralType, _FloatType], /) -> int: ...
 def pointer_to_sqeuclidean(dtype: Union[_IntegralType, _FloatType], /) -> int: ...
@@ -119,8 +144,53 @@ def cdist(
     dtype: Optional[Union[_IntegralType, _FloatType, _ComplexType]] = None,
     out: Optional[_BufferType] = None,
     out_dtype: Union[_FloatType, _ComplexType] = "d",
+    a_norms: Optional[_BufferType] = None,
+    b_norms: Optional[_BufferType] = None,
+    workspace: Optional[Workspace] = None,
 ) -> Optional[Union[float, complex, DistancesTensor]]: ...
 
+# Squared Euclidean norms of all rows, to be cached and passed to `cdist` as `a_norms` or `b_norms`.
+def norms(a: _BufferType, /) -> DistancesTensor: ...
+
+# Condensed distances between all pairs of rows, similar to: `scipy.spatial.distance.pdist`.
+# https://docs.scipy.org/doc/scipy-1.11.4/reference/generated/scipy.spatial.distance.pdist.html
+def pdist(
+    a: _BufferType,
+    /,
+    metric: _MetricType = "euclidean",
+    *,
+    threads: int = 1,
+    dtype: Optional[Union[_IntegralType, _FloatType, _ComplexType]] = None,
+    out_dtype: Union[_FloatType, _ComplexType] = "d",
+    workspace: Optional[Workspace] = None,
+) -> DistancesTensor: ...
+
+# Nearest neighbors of every row of `a` among the rows of `b`, best first,
+# similar to `numpy.argpartition` over `scipy.spatial.distance.cdist`.
+def topk(
+    a: _BufferType,
+    b: _BufferType,
+    k: int,
+    /,
+    metric: _MetricType = "euclidean",
+    *,
+    threads: int = 1,
+    dtype: Optional[Union[_IntegralType, _FloatType]] = None,
+) -> Tuple[DistancesTensor, DistancesTensor]: ...
+
+def topk_file(
+    a: _BufferType,
+    path: Union[str, os.PathLike[str]],
+    k: int,
+    /,
+    metric: _MetricType = "euclidean",
+    *,
+    dtype: Optional[Union[_IntegralType, _FloatType]] = None,
+    offset: int = 0,
+    stride: Optional[int] = None,
+    rows: Optional[int] = None,
+) -> Tuple[DistancesTensor, DistancesTensor]: ...
+
 # ---------------------------------------------------------------------
 # Vector-vector dot products for real and complex numbers
 # ---------------------------------------------------------------------
@@ -278,6 +348,15 @@ def mahalanobis(
 # https://numpy.org/doc/stable/reference/generated/numpy.intersect1d.html
 def intersection(array1: _BufferType, array2: _BufferType, /) -> float: ...
 
+# Sparse dot product of the weights of the intersecting indices, with `int16`, `bf16`, or `float32` weights.
+def intersect(
+    a: _BufferType,
+    b: _BufferType,
+    a_weights: Optional[_BufferType] = None,
+    b_weights: Optional[_BufferType] = None,
+    /,
+) -> float: ...
+
 # ---------------------------------------------------------------------
 # Vector-vector math: FMA, WSum
 # ---------------------------------------------------------------------
@@ -306,3 +385,97 @@ def wum(
     beta: float = 1,
     out: Optional[_BufferType] = None,
 ) -> Optional[DistancesTensor]: ...
+
+# ---------------------------------------------------------------------
+# Element-wise kernels: Scale, Add, Multiply, Quantize, Dequantize
+# ---------------------------------------------------------------------
+
+# Vector affine transformation `alpha * a + beta`.
+def scale(
+    a: _BufferType,
+    /,
+    dtype: Optional[Union[_FloatType, _IntegralType]] = None,
+    *,
+    alpha: float = 1,
+    beta: float = 0,
+    out: Optional[_BufferType] = None,
+) -> Optional[DistancesTensor]: ...
+
+# Vector-vector element-wise sum.
+def add(
+    a: _BufferType,
+    b: _BufferType,
+    /,
+    dtype: Optional[Union[_FloatType, _IntegralType]] = None,
+    *,
+    out: Optional[_BufferType] = None,
+) -> Optional[DistancesTensor]: ...
+
+# Vector-vector element-wise product.
+def multiply(
+    a: _BufferType,
+    b: _BufferType,
+    /,
+    dtype: Optional[Union[_FloatType, _IntegralType]] = None,
+    *,
+    out: Optional[_BufferType] = None,
+) -> Optional[DistancesTensor]: ...
+
+# Scaled conversion of a `float32` vector into `f16`, `bf16`, `i8`, `u8`, or packed `b8`.
+def quantize(
+    a: _BufferType,
+    /,
+    dtype: Union[_FloatType, _IntegralType],
+    *,
+    alpha: float = 1,
+    out: Optional[_BufferType] = None,
+) -> Optional[DistancesTensor]: ...
+
+# Scaled conversion of a `f16`, `bf16`, `i8`, or `u8` vector into `float32`.
+def dequantize(
+    a: _BufferType,
+    /,
+    dtype: Optional[Union[_FloatType, _IntegralType]] = None,
+    *,
+    alpha: float = 1,
+    out: Optional[_BufferType] = None,
+) -> Optional[DistancesTensor]: ...
+
+# ---------------------------------------------------------------------
+# Row-wise reductions: Sum, L1 and L2 norms, Min, Max, ArgMin, ArgMax
+# ---------------------------------------------------------------------
+
+# Sum of elements of a vector, or of every row of a matrix, similar to: `numpy.sum(a, axis=-1)`.
+def sum(
+    a: _BufferType, /, dtype: Optional[Union[_FloatType, _IntegralType]] = None
+) -> Union[float, DistancesTensor]: ...
+
+# Sum of absolute values of a vector, or of every row of a matrix.
+def l1norm(
+    a: _BufferType, /, dtype: Optional[Union[_FloatType, _IntegralType]] = None
+) -> Union[float, DistancesTensor]: ...
+
+# Euclidean norm of a vector, or of every row of a matrix, similar to: `numpy.linalg.norm(a, axis=-1)`.
+def l2norm(
+    a: _BufferType, /, dtype: Optional[Union[_FloatType, _IntegralType]] = None
+) -> Union[float, DistancesTensor]: ...
+
+# Minimum of a vector, or of every row of a matrix, skipping NaNs, similar to: `numpy.nanmin(a, axis=-1)`.
+def min(
+    a: _BufferType, /, dtype: Optional[Union[_FloatType, _IntegralType]] = None
+) -> Union[float, DistancesTensor]: ...
+
+# Maximum of a vector, or of every row of a matrix, skipping NaNs, similar to: `numpy.nanmax(a, axis=-1)`.
+def max(
+    a: _BufferType, /, dtype: Optional[Union[_FloatType, _IntegralType]] = None
+) -> Union[float, DistancesTensor]: ...
+
+# Index of the first minimum of a vector, or of every row of a matrix, similar to: `numpy.nanargmin(a, axis=-1)`.
+def argmin(
+    a: _BufferType, /, dtype: Optional[Union[_FloatType, _IntegralType]] = None
+) -> Union[int, DistancesTensor]: ...
+
+# Index of the first maximum of a vector, or of every row of a matrix, similar to: `numpy.nanargmax(a, axis=-1)`.
+def argmax(
+    a: _BufferType, /, dtype: Optional[Union[_FloatType, _IntegralType]] = None
+) -> Union[int, DistancesTensor]: ...
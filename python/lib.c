@@ -63,9 +63,15 @@
  *
  *  https://ashvardanian.com/posts/discount-on-keyword-arguments-in-python/
  */
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE // Exposes `MAP_ANONYMOUS` and `MADV_HUGEPAGE` in strict C11 mode
+#endif
+
 #include <math.h>
+#include <sys/stat.h> // `stat`
 
 #if defined(__linux__)
+#include <sys/mman.h> // `mmap`, `madvise`
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -85,36 +91,114 @@ typedef struct TensorArgument {
     simsimd_datatype_t datatype;
 } TensorArgument;
 
+typedef struct Workspace {
+    PyObject_HEAD     //
+        char *data;   // Start of the arena, aligned to the page size
+    void *allocation; // Start of the underlying allocation, to be unmapped or freed
+    size_t capacity;  // Usable bytes in the arena, starting at `data`
+    size_t views;     // Number of live `DistancesTensor` objects borrowing the arena
+    int huge_pages;   // Whether the arena was mapped with a huge pages advice
+} Workspace;
+
 typedef struct DistancesTensor {
     PyObject_HEAD                    //
         simsimd_datatype_t datatype; // Double precision real or complex numbers
     size_t dimensions;               // Can be only 1 or 2 dimensions
     Py_ssize_t shape[2];             // Dimensions of the tensor
     Py_ssize_t strides[2];           // Strides for each dimension
+    Workspace *workspace;            // Arena holding the scalars, or NULL if they follow inline in `start`
+    char *data;                      // Either `start` or the start of the `workspace` arena
     simsimd_distance_t start[];      // Variable length data aligned to 64-bit scalars
 } DistancesTensor;
 
 static int DistancesTensor_getbuffer(PyObject *export_from, Py_buffer *view, int flags);
 static void DistancesTensor_releasebuffer(PyObject *export_from, Py_buffer *view);
+static void DistancesTensor_dealloc(PyObject *self);
+static PyObject *DistancesTensor_dlpack(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                                        PyObject *args_names_tuple);
+static PyObject *DistancesTensor_dlpack_device(PyObject *self, PyObject *unused);
 
 static PyBufferProcs DistancesTensor_as_buffer = {
     .bf_getbuffer = DistancesTensor_getbuffer,
     .bf_releasebuffer = DistancesTensor_releasebuffer,
 };
 
+static PyMethodDef DistancesTensor_methods[] = {
+    {"__dlpack__", (PyCFunction)DistancesTensor_dlpack, METH_FASTCALL | METH_KEYWORDS,
+     "Export the tensor as a DLPack capsule, to be consumed zero-copy by `torch.from_dlpack` and alike."},
+    {"__dlpack_device__", (PyCFunction)DistancesTensor_dlpack_device, METH_NOARGS,
+     "Return the DLPack device type and index, always `(1, 0)` for the CPU."},
+    {NULL, NULL, 0, NULL},
+};
+
 static PyTypeObject DistancesTensorType = {
     PyVarObject_HEAD_INIT(NULL, 0).tp_name = "simsimd.DistancesTensor",
-    .tp_doc = "Zero-copy view of an internal tensor, compatible with NumPy",
+    .tp_doc = "Zero-copy view of an internal tensor, compatible with NumPy and DLPack consumers",
     .tp_basicsize = sizeof(DistancesTensor),
     // Instead of using `simsimd_distance_t` for all the elements,
     // we use `char` to allow user to specify the datatype on `cdist`-like functions.
     .tp_itemsize = sizeof(char),
+    .tp_dealloc = DistancesTensor_dealloc,
     .tp_as_buffer = &DistancesTensor_as_buffer,
+    .tp_methods = DistancesTensor_methods,
+};
+
+static PyObject *Workspace_new(PyTypeObject *type, PyObject *args, PyObject *kwargs);
+static void Workspace_dealloc(PyObject *self);
+static PyObject *Workspace_get_capacity(PyObject *self, void *closure);
+static PyObject *Workspace_get_huge_pages(PyObject *self, void *closure);
+
+static PyGetSetDef Workspace_getset[] = {
+    {"capacity", Workspace_get_capacity, NULL, "Number of bytes reserved for the outputs", NULL},
+    {"huge_pages", Workspace_get_huge_pages, NULL, "Whether the arena is advised to use huge pages", NULL},
+    {NULL, NULL, NULL, NULL, NULL},
+};
+
+static PyTypeObject WorkspaceType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "simsimd.Workspace",
+    .tp_doc = "Reusable arena for the outputs of `cdist` and `pdist`, passed as the `workspace` argument.\n\n"
+              "Args:\n"
+              "    capacity (int, optional): Number of bytes to reserve upfront, growing on demand otherwise.\n\n"
+              "Notes:\n"
+              "    * Every call overwrites the results of the previous call with the same workspace.\n"
+              "    * The arena can't grow while the results of previous calls are still referenced.\n"
+              "    * Don't share one workspace between concurrent calls from different threads.",
+    .tp_basicsize = sizeof(Workspace),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_new = Workspace_new,
+    .tp_dealloc = Workspace_dealloc,
+    .tp_getset = Workspace_getset,
 };
 
 /// @brief  Global variable that caches the CPU capabilities, and is computed just onc, when the module is loaded.
 simsimd_capability_t static_capabilities = simsimd_cap_serial_k;
 
+/// @brief  Global table of kernels resolved for `static_capabilities`, refreshed whenever those change,
+///         so that every call indexes it directly instead of searching with `simsimd_find_metric_punned`.
+simsimd_dispatch_table_t dispatch_table;
+
+/// @brief  Reads the timestamp counter before a kernel call, if compiled with `SIMSIMD_INSTRUMENTATION`.
+static simsimd_u64_t kernel_usage_start(void) {
+#if SIMSIMD_INSTRUMENTATION
+    return simsimd_instrumentation_ticks();
+#else
+    return 0;
+#endif
+}
+
+/// @brief  Accounts for the kernel calls of the bindings, that bypass the instrumented exports of the dynamic library.
+///         Unsupported combinations are recorded with a zero capability, so that they are reported as misses.
+static void kernel_usage_record(simsimd_metric_kind_t kind, simsimd_datatype_t datatype, size_t calls, size_t bytes,
+                                simsimd_u64_t start) {
+#if SIMSIMD_INSTRUMENTATION
+    simsimd_capability_t const capability = simsimd_dispatch_table_capability(&dispatch_table, kind, datatype);
+    simsimd_u64_t const cycles = start ? simsimd_instrumentation_ticks() - start : 0;
+    simsimd_instrumentation_record(kind, datatype, capability, calls, bytes, cycles);
+#else
+    (void)kind, (void)datatype, (void)calls, (void)bytes, (void)start;
+#endif
+}
+
 /// @brief Helper method to check for string equality.
 /// @return 1 if the strings are equal, 0 otherwise.
 int same_string(char const *a, char const *b) { return strcmp(a, b) == 0; }
@@ -164,6 +248,8 @@ simsimd_datatype_t numpy_string_to_datatype(char const *name) {
     else if (same_string(name, "b") || same_string(name, "<b") || same_string(name, "i1") || same_string(name, "|i1") ||
              same_string(name, "<i1") || same_string(name, "int8"))
         return simsimd_datatype_i8_k;
+    else if (same_string(name, "i4x2") || same_string(name, "int4"))
+        return simsimd_datatype_i4x2_k;
     else if (same_string(name, "h") || same_string(name, "<h") || same_string(name, "i2") || same_string(name, "|i2") ||
              same_string(name, "<i2") || same_string(name, "int16"))
         return simsimd_datatype_i16_k;
@@ -218,6 +304,8 @@ simsimd_datatype_t python_string_to_datatype(char const *name) {
     // Signed integers:
     else if (same_string(name, "b") || same_string(name, "i8") || same_string(name, "int8"))
         return simsimd_datatype_i8_k;
+    else if (same_string(name, "i4x2") || same_string(name, "int4"))
+        return simsimd_datatype_i4x2_k;
     else if (same_string(name, "h") || same_string(name, "i16") || same_string(name, "int16"))
         return simsimd_datatype_i16_k;
     else if (same_string(name, "i") || same_string(name, "i32") || same_string(name, "int32") || same_string(name, "l"))
@@ -271,6 +359,32 @@ char const *datatype_to_python_string(simsimd_datatype_t dtype) {
     }
 }
 
+/// @brief Returns the short name of a datatype, accepted by the `dtype` arguments.
+/// @return "unknown" if the datatype is not supported, otherwise a string.
+char const *datatype_to_name(simsimd_datatype_t dtype) {
+    switch (dtype) {
+    case simsimd_datatype_f64_k: return "f64";
+    case simsimd_datatype_f32_k: return "f32";
+    case simsimd_datatype_f16_k: return "f16";
+    case simsimd_datatype_bf16_k: return "bf16";
+    case simsimd_datatype_f64c_k: return "complex128";
+    case simsimd_datatype_f32c_k: return "complex64";
+    case simsimd_datatype_f16c_k: return "complex32";
+    case simsimd_datatype_bf16c_k: return "bcomplex32";
+    case simsimd_datatype_b8_k: return "b8";
+    case simsimd_datatype_i4x2_k: return "i4x2";
+    case simsimd_datatype_i8_k: return "i8";
+    case simsimd_datatype_i16_k: return "i16";
+    case simsimd_datatype_i32_k: return "i32";
+    case simsimd_datatype_i64_k: return "i64";
+    case simsimd_datatype_u8_k: return "u8";
+    case simsimd_datatype_u16_k: return "u16";
+    case simsimd_datatype_u32_k: return "u32";
+    case simsimd_datatype_u64_k: return "u64";
+    default: return "unknown";
+    }
+}
+
 /// @brief Estimate the number of bytes per element for a given datatype.
 /// @param dtype Logical datatype, can be complex.
 /// @return Zero if the datatype is not supported, positive integer otherwise.
@@ -286,6 +400,8 @@ size_t bytes_per_datatype(simsimd_datatype_t dtype) {
     case simsimd_datatype_bf16c_k: return sizeof(simsimd_bf16_t) * 2;
     case simsimd_datatype_b8_k: return sizeof(simsimd_b8_t);
     case simsimd_datatype_i8_k: return sizeof(simsimd_i8_t);
+    case simsimd_datatype_i4x2_k: return sizeof(simsimd_i4x2_t);
+    case simsimd_datatype_u4x2_k: return sizeof(simsimd_u4x2_t);
     case simsimd_datatype_u8_k: return sizeof(simsimd_u8_t);
     case simsimd_datatype_i16_k: return sizeof(simsimd_i16_t);
     case simsimd_datatype_u16_k: return sizeof(simsimd_u16_t);
@@ -359,6 +475,40 @@ int kernel_is_commutative(simsimd_metric_kind_t kind) {
     }
 }
 
+/// @brief  Maps a pairwise metric to its many-to-many counterpart, if one exists.
+simsimd_metric_kind_t kernel_cdist_kind(simsimd_metric_kind_t kind) {
+    switch (kind) {
+    case simsimd_metric_dot_k: return simsimd_metric_dot_cdist_k;
+    case simsimd_metric_cos_k: return simsimd_metric_cos_cdist_k;
+    case simsimd_metric_l2sq_k: return simsimd_metric_l2sq_cdist_k;
+    case simsimd_metric_l2_k: return simsimd_metric_l2_cdist_k;
+    case simsimd_metric_hamming_k: return simsimd_metric_hamming_cdist_k;
+    case simsimd_metric_jaccard_k: return simsimd_metric_jaccard_cdist_k;
+    default: return simsimd_metric_unknown_k;
+    }
+}
+
+/// @brief  Maps a pairwise metric to its many-to-many counterpart with a custom output precision, if one exists.
+simsimd_metric_kind_t kernel_cdist_typed_kind(simsimd_metric_kind_t kind) {
+    switch (kind) {
+    case simsimd_metric_dot_k: return simsimd_metric_dot_cdist_typed_k;
+    case simsimd_metric_cos_k: return simsimd_metric_cos_cdist_typed_k;
+    case simsimd_metric_l2sq_k: return simsimd_metric_l2sq_cdist_typed_k;
+    case simsimd_metric_l2_k: return simsimd_metric_l2_cdist_typed_k;
+    default: return simsimd_metric_unknown_k;
+    }
+}
+
+/// @brief  Maps a pairwise metric to its many-to-many counterpart reusing cached squared norms, if one exists.
+simsimd_metric_kind_t kernel_cdist_normed_kind(simsimd_metric_kind_t kind) {
+    switch (kind) {
+    case simsimd_metric_cos_k: return simsimd_metric_cos_cdist_normed_k;
+    case simsimd_metric_l2sq_k: return simsimd_metric_l2sq_cdist_normed_k;
+    case simsimd_metric_l2_k: return simsimd_metric_l2_cdist_normed_k;
+    default: return simsimd_metric_unknown_k;
+    }
+}
+
 static char const doc_enable_capability[] = //
     "Enable a specific SIMD kernel family.\n\n"
     "Args:\n"
@@ -384,6 +534,7 @@ static PyObject *api_enable_capability(PyObject *self, PyObject *cap_name_obj) {
     else if (same_string(cap_name, "ice")) { static_capabilities |= simsimd_cap_ice_k; }
     else if (same_string(cap_name, "genoa")) { static_capabilities |= simsimd_cap_genoa_k; }
     else if (same_string(cap_name, "sapphire")) { static_capabilities |= simsimd_cap_sapphire_k; }
+    else if (same_string(cap_name, "sapphire_amx")) { static_capabilities |= simsimd_cap_sapphire_amx_k; }
     else if (same_string(cap_name, "turin")) { static_capabilities |= simsimd_cap_turin_k; }
     else if (same_string(cap_name, "sierra")) { static_capabilities |= simsimd_cap_sierra_k; }
     else if (same_string(cap_name, "serial")) {
@@ -395,6 +546,7 @@ static PyObject *api_enable_capability(PyObject *self, PyObject *cap_name_obj) {
         return NULL;
     }
 
+    simsimd_dispatch_table_init(&dispatch_table, static_capabilities, simsimd_cap_any_k);
     Py_RETURN_NONE;
 }
 
@@ -423,6 +575,7 @@ static PyObject *api_disable_capability(PyObject *self, PyObject *cap_name_obj)
     else if (same_string(cap_name, "ice")) { static_capabilities &= ~simsimd_cap_ice_k; }
     else if (same_string(cap_name, "genoa")) { static_capabilities &= ~simsimd_cap_genoa_k; }
     else if (same_string(cap_name, "sapphire")) { static_capabilities &= ~simsimd_cap_sapphire_k; }
+    else if (same_string(cap_name, "sapphire_amx")) { static_capabilities &= ~simsimd_cap_sapphire_amx_k; }
     else if (same_string(cap_name, "turin")) { static_capabilities &= ~simsimd_cap_turin_k; }
     else if (same_string(cap_name, "sierra")) { static_capabilities &= ~simsimd_cap_sierra_k; }
     else if (same_string(cap_name, "serial")) {
@@ -434,12 +587,13 @@ static PyObject *api_disable_capability(PyObject *self, PyObject *cap_name_obj)
         return NULL;
     }
 
+    simsimd_dispatch_table_init(&dispatch_table, static_capabilities, simsimd_cap_any_k);
     Py_RETURN_NONE;
 }
 
 static char const doc_get_capabilities[] = //
     "Get the current hardware SIMD capabilities as a dictionary of feature flags.\n"
-    "On x86 includes: 'serial', 'haswell', 'skylake', 'ice', 'genoa', 'sapphire', 'turin'.\n"
+    "On x86 includes: 'serial', 'haswell', 'skylake', 'ice', 'genoa', 'sapphire', 'sapphire_amx', 'turin'.\n"
     "On Arm includes: 'serial', 'neon', 'sve', 'sve2', and their extensions.\n";
 
 static PyObject *api_get_capabilities(PyObject *self) {
@@ -463,6 +617,7 @@ static PyObject *api_get_capabilities(PyObject *self) {
     ADD_CAP(ice);
     ADD_CAP(genoa);
     ADD_CAP(sapphire);
+    ADD_CAP(sapphire_amx);
     ADD_CAP(turin);
     ADD_CAP(sierra);
 
@@ -471,9 +626,154 @@ static PyObject *api_get_capabilities(PyObject *self) {
     return cap_dict;
 }
 
-/// @brief Unpacks a Python tensor object into a C structure.
+/// @brief  Names a single capability, the way `get_capabilities` does.
+/// @return Static string, or NULL for a zero or unknown capability.
+static char const *capability_to_python_string(simsimd_capability_t capability) {
+    switch (capability) {
+    case simsimd_cap_serial_k: return "serial";
+    case simsimd_cap_neon_k: return "neon";
+    case simsimd_cap_neon_f16_k: return "neon_f16";
+    case simsimd_cap_neon_bf16_k: return "neon_bf16";
+    case simsimd_cap_neon_i8_k: return "neon_i8";
+    case simsimd_cap_sve_k: return "sve";
+    case simsimd_cap_sve_f16_k: return "sve_f16";
+    case simsimd_cap_sve_bf16_k: return "sve_bf16";
+    case simsimd_cap_sve_i8_k: return "sve_i8";
+    case simsimd_cap_sve2_k: return "sve2";
+    case simsimd_cap_sve2p1_k: return "sve2p1";
+    case simsimd_cap_haswell_k: return "haswell";
+    case simsimd_cap_skylake_k: return "skylake";
+    case simsimd_cap_ice_k: return "ice";
+    case simsimd_cap_genoa_k: return "genoa";
+    case simsimd_cap_sapphire_k: return "sapphire";
+    case simsimd_cap_sapphire_amx_k: return "sapphire_amx";
+    case simsimd_cap_turin_k: return "turin";
+    case simsimd_cap_sierra_k: return "sierra";
+    default: return NULL;
+    }
+}
+
+static char const doc_configure_kernel_usage[] = //
+    "Choose what is counted for every kernel, if compiled with `SIMSIMD_INSTRUMENTATION=1`.\n\n"
+    "Args:\n"
+    "    options (str): Comma-separated 'cycles' to read the CPU timestamp counter around every call,\n"
+    "        and 'trace' to log the first use of every kernel to `stderr`. Empty to count just calls and bytes.\n\n"
+    "Returns:\n"
+    "    bool: True if the instrumentation is compiled in, False if the counters will stay empty.";
+
+static PyObject *api_configure_kernel_usage(PyObject *self, PyObject *options_obj) {
+    char const *options = PyUnicode_AsUTF8(options_obj);
+    if (!options) {
+        PyErr_SetString(PyExc_TypeError, "Options must be a string");
+        return NULL;
+    }
+
+    int flags = 0;
+    while (*options) {
+        char const *end = strchr(options, ',');
+        size_t const length = end ? (size_t)(end - options) : strlen(options);
+        if (length == 6 && strncmp(options, "cycles", 6) == 0) { flags |= simsimd_instrumentation_cycles_k; }
+        else if (length == 5 && strncmp(options, "trace", 5) == 0) { flags |= simsimd_instrumentation_trace_k; }
+        else if (length != 0) {
+            PyErr_Format(PyExc_ValueError, "Unknown instrumentation option '%.*s'", (int)length, options);
+            return NULL;
+        }
+        options += end ? length + 1 : length;
+    }
+
+    simsimd_instrumentation_configure(flags);
+    return PyBool_FromLong(simsimd_instrumentation_enabled());
+}
+
+static char const doc_get_kernel_usage[] = //
+    "Get the accumulated usage of every kernel, if compiled with `SIMSIMD_INSTRUMENTATION=1`.\n\n"
+    "Returns:\n"
+    "    list: Dictionaries with the 'metric' kind, the 'dtype', the 'capability' that served the calls,\n"
+    "        or None if the combination isn't supported, and the 'calls', 'bytes', and 'cycles' counters.";
+
+static PyObject *api_get_kernel_usage(PyObject *self) {
+    simsimd_size_t const count = simsimd_instrumentation_usage(NULL, 0);
+    simsimd_kernel_usage_t *usage = NULL;
+    PyObject *usage_list = NULL;
+
+    // New kernels may be tracked between the two calls, so the second one may export fewer of them
+    if (count) {
+        usage = (simsimd_kernel_usage_t *)PyMem_Malloc(count * sizeof(simsimd_kernel_usage_t));
+        if (!usage) return PyErr_NoMemory();
+    }
+    simsimd_size_t const exported = count ? simsimd_instrumentation_usage(usage, count) : 0;
+    usage_list = PyList_New(0);
+    if (!usage_list) goto cleanup;
+
+    for (simsimd_size_t i = 0; i < exported && i < count; ++i) {
+        char const kind[2] = {(char)usage[i].kind, 0};
+        char const *capability = capability_to_python_string(usage[i].capability);
+        PyObject *entry = Py_BuildValue(                                                          //
+            "{s:s,s:s,s:z,s:K,s:K,s:K}",                                                          //
+            "metric", kind, "dtype", datatype_to_name(usage[i].datatype),                         //
+            "capability", capability, "calls", (unsigned long long)usage[i].calls,                //
+            "bytes", (unsigned long long)usage[i].bytes, "cycles", (unsigned long long)usage[i].cycles);
+        if (!entry || PyList_Append(usage_list, entry) < 0) {
+            Py_XDECREF(entry);
+            Py_CLEAR(usage_list);
+            goto cleanup;
+        }
+        Py_DECREF(entry);
+    }
+
+cleanup:
+    PyMem_Free(usage);
+    return usage_list;
+}
+
+static char const doc_reset_kernel_usage[] = //
+    "Zero the counters of all kernels. Must not overlap with other calls into the library.";
+
+static PyObject *api_reset_kernel_usage(PyObject *self) {
+    simsimd_instrumentation_reset();
+    Py_RETURN_NONE;
+}
+
+/// @brief  Replaces a strided view with a packed copy of its rows, owned by a `bytes` object that the @p buffer
+///         references, so that the usual `PyBuffer_Release` frees it. The copy itself runs without the GIL.
 /// @return 1 on success, 0 otherwise.
-int parse_tensor(PyObject *tensor, Py_buffer *buffer, TensorArgument *parsed) {
+static int gather_tensor(Py_buffer *buffer, TensorArgument *parsed, Py_ssize_t rows_stride, Py_ssize_t scalars_stride,
+                         size_t rows, size_t scalars) {
+    size_t const scalar_size = (size_t)buffer->itemsize;
+    size_t const row_size = scalars * scalar_size;
+    PyObject *gathered_obj = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)(rows * row_size));
+    if (!gathered_obj) {
+        PyBuffer_Release(buffer);
+        return 0;
+    }
+
+    char const *source = (char const *)buffer->buf;
+    char *target = PyBytes_AS_STRING(gathered_obj);
+    Py_BEGIN_ALLOW_THREADS;
+    for (size_t i = 0; i != rows; ++i) {
+        char const *source_row = source + (Py_ssize_t)i * rows_stride;
+        char *target_row = target + i * row_size;
+        for (size_t j = 0; j != scalars; ++j)
+            memcpy(target_row + j * scalar_size, source_row + (Py_ssize_t)j * scalars_stride, scalar_size);
+    }
+    Py_END_ALLOW_THREADS;
+
+    // The new view holds its own reference to the copy, so the original exporter can be released right away
+    PyBuffer_Release(buffer);
+    PyBuffer_FillInfo(buffer, gathered_obj, target, (Py_ssize_t)(rows * row_size), 1, PyBUF_SIMPLE);
+    Py_DECREF(gathered_obj);
+    buffer->itemsize = (Py_ssize_t)scalar_size;
+    buffer->format = (char *)datatype_to_python_string(parsed->datatype);
+    parsed->start = target;
+    parsed->stride = row_size;
+    return 1;
+}
+
+/// @brief  Unpacks a Python tensor object into a C structure. Views with non-unit strides between the scalars,
+///         like column slices or transposed matrices, are packed into a contiguous copy if @p gather is set,
+///         and rejected otherwise, as the outputs must be written in-place.
+/// @return 1 on success, 0 otherwise.
+static int parse_tensor_view(PyObject *tensor, Py_buffer *buffer, TensorArgument *parsed, int gather) {
     if (PyObject_GetBuffer(tensor, buffer, PyBUF_STRIDES | PyBUF_FORMAT) != 0) {
         PyErr_SetString(PyExc_TypeError, "arguments must support buffer protocol");
         return 0;
@@ -487,25 +787,18 @@ int parse_tensor(PyObject *tensor, Py_buffer *buffer, TensorArgument *parsed) {
     parsed->start = buffer->buf;
     parsed->datatype = numpy_string_to_datatype(buffer->format);
     parsed->rank = buffer->ndim;
+    Py_ssize_t scalars_stride = buffer->itemsize;
     if (buffer->ndim == 1) {
-        if (buffer->strides[0] > buffer->itemsize) {
-            PyErr_SetString(PyExc_ValueError, "Input vectors must be contiguous, check with `X.__array_interface__`");
-            PyBuffer_Release(buffer);
-            return 0;
-        }
         parsed->dimensions = buffer->shape[0];
         parsed->count = 1;
         parsed->stride = 0;
+        scalars_stride = buffer->strides[0];
     }
     else if (buffer->ndim == 2) {
-        if (buffer->strides[1] > buffer->itemsize) {
-            PyErr_SetString(PyExc_ValueError, "Input vectors must be contiguous, check with `X.__array_interface__`");
-            PyBuffer_Release(buffer);
-            return 0;
-        }
         parsed->dimensions = buffer->shape[1];
         parsed->count = buffer->shape[0];
         parsed->stride = buffer->strides[0];
+        scalars_stride = buffer->strides[1];
     }
     else {
         PyErr_SetString(PyExc_ValueError, "Input tensors must be 1D or 2D");
@@ -513,18 +806,44 @@ int parse_tensor(PyObject *tensor, Py_buffer *buffer, TensorArgument *parsed) {
         return 0;
     }
 
+    // Single-scalar rows are contiguous, whatever their stride is
+    int const is_contiguous = scalars_stride == buffer->itemsize || parsed->dimensions < 2;
+    if (!is_contiguous) {
+        if (!gather) {
+            PyErr_SetString(PyExc_ValueError, "Output tensors must be contiguous, check with `X.__array_interface__`");
+            PyBuffer_Release(buffer);
+            return 0;
+        }
+        // The packed view is always flat, so the layout is decided by the original rank
+        Py_ssize_t const rows_stride = parsed->rank == 2 ? buffer->strides[0] : 0;
+        if (!gather_tensor(buffer, parsed, rows_stride, scalars_stride, parsed->count, parsed->dimensions)) return 0;
+        if (parsed->rank == 1) parsed->stride = 0;
+    }
+
     // We handle complex numbers differently
     if (is_complex(parsed->datatype)) { parsed->dimensions *= 2; }
 
     return 1;
 }
 
+/// @brief Unpacks a Python tensor object into a C structure, packing non-contiguous inputs.
+/// @return 1 on success, 0 otherwise.
+int parse_tensor(PyObject *tensor, Py_buffer *buffer, TensorArgument *parsed) {
+    return parse_tensor_view(tensor, buffer, parsed, 1);
+}
+
+/// @brief Unpacks a Python tensor object, that will be written into, into a C structure.
+/// @return 1 on success, 0 otherwise.
+int parse_output_tensor(PyObject *tensor, Py_buffer *buffer, TensorArgument *parsed) {
+    return parse_tensor_view(tensor, buffer, parsed, 0);
+}
+
 static int DistancesTensor_getbuffer(PyObject *export_from, Py_buffer *view, int flags) {
     DistancesTensor *tensor = (DistancesTensor *)export_from;
     size_t const total_items = tensor->shape[0] * tensor->shape[1];
     size_t const item_size = bytes_per_datatype(tensor->datatype);
 
-    view->buf = &tensor->start[0];
+    view->buf = tensor->data;
     view->obj = (PyObject *)tensor;
     view->len = item_size * total_items;
     view->readonly = 0;
@@ -545,6 +864,308 @@ static void DistancesTensor_releasebuffer(PyObject *export_from, Py_buffer *view
     // https://docs.python.org/3/c-api/typeobj.html#c.PyBufferProcs.bf_releasebuffer
 }
 
+static void DistancesTensor_dealloc(PyObject *self) {
+    DistancesTensor *tensor = (DistancesTensor *)self;
+    if (tensor->workspace) {
+        --tensor->workspace->views;
+        Py_DECREF(tensor->workspace);
+    }
+    Py_TYPE(self)->tp_free(self);
+}
+
+/// @brief  Alignment and granularity of the `Workspace` arenas, matching the transparent huge pages on Linux.
+#if defined(__linux__)
+#define SIMSIMD_WORKSPACE_ALIGNMENT ((size_t)2 << 20)
+#else
+#define SIMSIMD_WORKSPACE_ALIGNMENT ((size_t)4096)
+#endif
+
+static void workspace_release(Workspace *workspace) {
+    if (!workspace->allocation) return;
+#if defined(__linux__)
+    munmap(workspace->allocation, workspace->capacity + SIMSIMD_WORKSPACE_ALIGNMENT);
+#else
+    PyMem_RawFree(workspace->allocation);
+#endif
+    workspace->allocation = NULL;
+    workspace->data = NULL;
+    workspace->capacity = 0;
+    workspace->huge_pages = 0;
+}
+
+/// @brief  Makes sure the arena can fit @p bytes, reallocating it if no previous results reference it.
+///         New arenas are faulted in right away, so that the calls borrowing them don't pay for the page faults.
+/// @return 1 on success, 0 otherwise.
+static int workspace_reserve(Workspace *workspace, size_t bytes) {
+    if (bytes <= workspace->capacity) return 1;
+    if (workspace->views) {
+        PyErr_Format(PyExc_BufferError,
+                     "Workspace can't grow from %zu to %zu bytes, while its previous results are still referenced",
+                     workspace->capacity, bytes);
+        return 0;
+    }
+    workspace_release(workspace);
+
+    size_t const alignment = SIMSIMD_WORKSPACE_ALIGNMENT;
+    size_t const capacity = (bytes + alignment - 1) / alignment * alignment;
+#if defined(__linux__)
+    void *allocation = mmap(NULL, capacity + alignment, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (allocation == MAP_FAILED) allocation = NULL;
+#else
+    void *allocation = PyMem_RawMalloc(capacity + alignment);
+#endif
+    if (!allocation) {
+        PyErr_NoMemory();
+        return 0;
+    }
+    char *data = (char *)(((size_t)allocation + alignment - 1) / alignment * alignment);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    workspace->huge_pages = madvise(data, capacity, MADV_HUGEPAGE) == 0;
+#endif
+    workspace->allocation = allocation;
+    workspace->data = data;
+    workspace->capacity = capacity;
+
+    Py_BEGIN_ALLOW_THREADS;
+    memset(data, 0, capacity);
+    Py_END_ALLOW_THREADS;
+    return 1;
+}
+
+static PyObject *Workspace_new(PyTypeObject *type, PyObject *args, PyObject *kwargs) {
+    Py_ssize_t const positional_args_count = PyTuple_Size(args);
+    Py_ssize_t const args_names_count = kwargs ? PyDict_Size(kwargs) : 0;
+    if (positional_args_count + args_names_count > 1) {
+        PyErr_SetString(PyExc_TypeError, "Workspace expects at most one argument, the 'capacity' in bytes");
+        return NULL;
+    }
+
+    PyObject *capacity_obj = positional_args_count ? PyTuple_GetItem(args, 0) : NULL;
+    if (args_names_count && !(capacity_obj = PyDict_GetItemString(kwargs, "capacity"))) {
+        PyErr_SetString(PyExc_TypeError, "Workspace only accepts the 'capacity' keyword argument");
+        return NULL;
+    }
+    size_t capacity = 0;
+    if (capacity_obj) capacity = PyLong_AsSize_t(capacity_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'capacity' to be an unsigned integer");
+        return NULL;
+    }
+
+    // The generic allocator zero-initializes the object, so an empty workspace holds no arena
+    Workspace *workspace = (Workspace *)type->tp_alloc(type, 0);
+    if (!workspace) return NULL;
+    if (capacity && !workspace_reserve(workspace, capacity)) {
+        Py_DECREF(workspace);
+        return NULL;
+    }
+    return (PyObject *)workspace;
+}
+
+static void Workspace_dealloc(PyObject *self) {
+    workspace_release((Workspace *)self);
+    Py_TYPE(self)->tp_free(self);
+}
+
+static PyObject *Workspace_get_capacity(PyObject *self, void *closure) {
+    return PyLong_FromSize_t(((Workspace *)self)->capacity);
+}
+
+static PyObject *Workspace_get_huge_pages(PyObject *self, void *closure) {
+    return PyBool_FromLong(((Workspace *)self)->huge_pages);
+}
+
+/// @brief  Allocates a row-major `DistancesTensor`, leaving its contents uninitialized.
+///         Matrices with a single row can be exported as vectors of `cols` scalars with `rank` set to 1.
+///         If a @p workspace is passed, the scalars are placed in its arena instead of following the object.
+static DistancesTensor *new_distances_tensor_in(Workspace *workspace, simsimd_datatype_t datatype, size_t rank,
+                                                size_t rows, size_t cols) {
+    size_t const bytes_per_scalar = bytes_per_datatype(datatype);
+    size_t const bytes = rows * cols * bytes_per_scalar;
+    if (workspace && !workspace_reserve(workspace, bytes)) return NULL;
+    DistancesTensor *tensor = PyObject_NewVar(DistancesTensor, &DistancesTensorType, workspace ? 0 : bytes);
+    if (!tensor) return (DistancesTensor *)PyErr_NoMemory();
+    tensor->datatype = datatype;
+    tensor->dimensions = rank;
+    tensor->shape[0] = rank == 1 ? rows * cols : rows;
+    tensor->shape[1] = rank == 1 ? 1 : cols;
+    tensor->strides[0] = rank == 1 ? bytes_per_scalar : cols * bytes_per_scalar;
+    tensor->strides[1] = rank == 1 ? 0 : bytes_per_scalar;
+    tensor->workspace = workspace;
+    tensor->data = workspace ? workspace->data : (char *)&tensor->start[0];
+    if (workspace) {
+        Py_INCREF(workspace);
+        ++workspace->views;
+    }
+    return tensor;
+}
+
+static DistancesTensor *new_distances_tensor(simsimd_datatype_t datatype, size_t rank, size_t rows, size_t cols) {
+    return new_distances_tensor_in(NULL, datatype, rank, rows, cols);
+}
+
+/*  Minimal subset of the DLPack ABI, that is stable across its versions, to export the tensors without
+ *  depending on the `dlpack.h` header: https://dmlc.github.io/dlpack/latest/c_api.html
+ */
+typedef struct DLDevice {
+    int32_t device_type; // `kDLCPU` is 1
+    int32_t device_id;
+} DLDevice;
+
+typedef struct DLDataType {
+    uint8_t code; // `kDLInt` is 0, `kDLUInt` is 1, `kDLFloat` is 2, `kDLBfloat` is 4, `kDLComplex` is 5
+    uint8_t bits;
+    uint16_t lanes;
+} DLDataType;
+
+typedef struct DLTensor {
+    void *data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t *shape;
+    int64_t *strides; // In scalars, not bytes
+    uint64_t byte_offset;
+} DLTensor;
+
+typedef struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void *manager_ctx;
+    void (*deleter)(struct DLManagedTensor *self);
+} DLManagedTensor;
+
+/// @brief  Single allocation backing an exported `DLManagedTensor`, that references the `DistancesTensor`.
+typedef struct DLPackExport {
+    DLManagedTensor managed;
+    int64_t shape[2];
+    int64_t strides[2];
+} DLPackExport;
+
+static void dlpack_deleter(DLManagedTensor *managed) {
+    // Consumers may call the deleter from any thread, with or without the GIL
+    PyGILState_STATE const gil_state = PyGILState_Ensure();
+    Py_XDECREF((PyObject *)managed->manager_ctx);
+    PyGILState_Release(gil_state);
+    PyMem_RawFree(managed);
+}
+
+static void dlpack_capsule_destructor(PyObject *capsule) {
+    // Capsules renamed to "used_dltensor" are owned by the consumer, that will call the deleter itself
+    if (!PyCapsule_IsValid(capsule, "dltensor")) return;
+    PyObject *error_type, *error_value, *error_traceback;
+    PyErr_Fetch(&error_type, &error_value, &error_traceback);
+    DLManagedTensor *managed = (DLManagedTensor *)PyCapsule_GetPointer(capsule, "dltensor");
+    if (managed && managed->deleter) managed->deleter(managed);
+    PyErr_Restore(error_type, error_value, error_traceback);
+}
+
+/// @brief  Maps the datatype to its DLPack descriptor.
+/// @return 1 on success, 0 if DLPack has no equivalent type.
+static int datatype_to_dlpack(simsimd_datatype_t datatype, DLDataType *dlpack_datatype) {
+    dlpack_datatype->lanes = 1;
+    dlpack_datatype->bits = (uint8_t)(bytes_per_datatype(datatype) * 8);
+    switch (datatype) {
+    case simsimd_datatype_f64_k:
+    case simsimd_datatype_f32_k:
+    case simsimd_datatype_f16_k: dlpack_datatype->code = 2; return 1;
+    case simsimd_datatype_bf16_k: dlpack_datatype->code = 4; return 1;
+    case simsimd_datatype_f64c_k:
+    case simsimd_datatype_f32c_k:
+    case simsimd_datatype_f16c_k: dlpack_datatype->code = 5; return 1;
+    case simsimd_datatype_i8_k:
+    case simsimd_datatype_i16_k:
+    case simsimd_datatype_i32_k:
+    case simsimd_datatype_i64_k: dlpack_datatype->code = 0; return 1;
+    case simsimd_datatype_u8_k:
+    case simsimd_datatype_u16_k:
+    case simsimd_datatype_u32_k:
+    case simsimd_datatype_u64_k: dlpack_datatype->code = 1; return 1;
+    default: return 0;
+    }
+}
+
+static PyObject *DistancesTensor_dlpack(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                                        PyObject *args_names_tuple) {
+    DistancesTensor *tensor = (DistancesTensor *)self;
+
+    // This method accepts only keyword arguments, following the Array API standard:
+    // https://data-apis.org/array-api/latest/API_specification/generated/array_api.array.__dlpack__.html
+    PyObject *stream_obj = NULL;    // Must be `None` for the CPU
+    PyObject *dl_device_obj = NULL; // Optional tuple, must be `(1, 0)` if passed
+    PyObject *copy_obj = NULL;      // Optional boolean, copies are never made
+    Py_ssize_t const args_names_count = args_names_tuple ? PyTuple_Size(args_names_tuple) : 0;
+    if (positional_args_count > 0) {
+        PyErr_SetString(PyExc_TypeError, "`__dlpack__` accepts only keyword arguments");
+        return NULL;
+    }
+    for (Py_ssize_t args_names_tuple_progress = 0; args_names_tuple_progress < args_names_count;
+         ++args_names_tuple_progress) {
+        PyObject *const key = PyTuple_GetItem(args_names_tuple, args_names_tuple_progress);
+        PyObject *const value = args[args_names_tuple_progress];
+        if (PyUnicode_CompareWithASCIIString(key, "stream") == 0 && !stream_obj) { stream_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "dl_device") == 0 && !dl_device_obj) { dl_device_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "copy") == 0 && !copy_obj) { copy_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "max_version") == 0) {} // Only the legacy capsules are exported
+        else {
+            PyErr_Format(PyExc_TypeError, "Got unexpected keyword argument: %S", key);
+            return NULL;
+        }
+    }
+    if (stream_obj && stream_obj != Py_None) {
+        PyErr_SetString(PyExc_BufferError, "The 'stream' must be None for CPU tensors");
+        return NULL;
+    }
+    if (copy_obj && PyObject_IsTrue(copy_obj)) {
+        PyErr_SetString(PyExc_BufferError, "Only zero-copy exports are supported");
+        return NULL;
+    }
+    if (dl_device_obj && dl_device_obj != Py_None) {
+        long device_type = -1, device_id = -1;
+        if (PyTuple_Check(dl_device_obj) && PyTuple_Size(dl_device_obj) == 2) {
+            device_type = PyLong_AsLong(PyTuple_GetItem(dl_device_obj, 0));
+            device_id = PyLong_AsLong(PyTuple_GetItem(dl_device_obj, 1));
+        }
+        if (PyErr_Occurred() || device_type != 1 || device_id != 0) {
+            PyErr_Clear();
+            PyErr_SetString(PyExc_BufferError, "Tensors can only be exported to the CPU device `(1, 0)`");
+            return NULL;
+        }
+    }
+
+    DLDataType dlpack_datatype;
+    if (!datatype_to_dlpack(tensor->datatype, &dlpack_datatype)) {
+        PyErr_Format(PyExc_BufferError, "The '%s' datatype has no DLPack equivalent",
+                     datatype_to_python_string(tensor->datatype));
+        return NULL;
+    }
+
+    DLPackExport *exported = (DLPackExport *)PyMem_RawMalloc(sizeof(DLPackExport));
+    if (!exported) return PyErr_NoMemory();
+    Py_ssize_t const bytes_per_scalar = (Py_ssize_t)bytes_per_datatype(tensor->datatype);
+    for (size_t i = 0; i < tensor->dimensions; ++i) {
+        exported->shape[i] = tensor->shape[i];
+        exported->strides[i] = tensor->strides[i] / bytes_per_scalar;
+    }
+    DLTensor *dl_tensor = &exported->managed.dl_tensor;
+    dl_tensor->data = tensor->data;
+    dl_tensor->device.device_type = 1;
+    dl_tensor->device.device_id = 0;
+    dl_tensor->ndim = (int32_t)tensor->dimensions;
+    dl_tensor->dtype = dlpack_datatype;
+    dl_tensor->shape = &exported->shape[0];
+    dl_tensor->strides = &exported->strides[0];
+    dl_tensor->byte_offset = 0;
+    exported->managed.manager_ctx = self;
+    exported->managed.deleter = dlpack_deleter;
+    Py_INCREF(self);
+
+    PyObject *capsule = PyCapsule_New(&exported->managed, "dltensor", dlpack_capsule_destructor);
+    if (!capsule) dlpack_deleter(&exported->managed);
+    return capsule;
+}
+
+static PyObject *DistancesTensor_dlpack_device(PyObject *self, PyObject *unused) { return Py_BuildValue("(ii)", 1, 0); }
+
 static PyObject *implement_dense_metric( //
     simsimd_metric_kind_t metric_kind,   //
     PyObject *const *args, Py_ssize_t const positional_args_count, PyObject *args_names_tuple) {
@@ -630,7 +1251,7 @@ static PyObject *implement_dense_metric( //
 
     // Convert `a_obj` to `a_buffer` and to `a_parsed`. Same for `b_obj` and `out_obj`.
     if (!parse_tensor(a_obj, &a_buffer, &a_parsed) || !parse_tensor(b_obj, &b_buffer, &b_parsed)) return NULL;
-    if (out_obj && !parse_tensor(out_obj, &out_buffer, &out_parsed)) return NULL;
+    if (out_obj && !parse_output_tensor(out_obj, &out_buffer, &out_parsed)) return NULL;
 
     // Check dimensions
     if (a_parsed.dimensions != b_parsed.dimensions) {
@@ -683,11 +1304,10 @@ static PyObject *implement_dense_metric( //
         }
     }
 
-    // Look up the metric and the capability
-    simsimd_metric_punned_t metric = NULL;
-    simsimd_capability_t capability = simsimd_cap_serial_k;
-    simsimd_find_metric_punned(metric_kind, dtype, static_capabilities, simsimd_cap_any_k, &metric, &capability);
+    // Look up the metric in the dispatch table
+    simsimd_metric_punned_t metric = simsimd_dispatch_table_find(&dispatch_table, metric_kind, dtype);
     if (!metric) {
+        kernel_usage_record(metric_kind, dtype, 1, 0, 0);
         PyErr_Format( //
             PyExc_LookupError,
             "Unsupported metric '%c' and datatype combination across vectors ('%s'/'%s' and '%s'/'%s') and "
@@ -701,18 +1321,16 @@ static PyObject *implement_dense_metric( //
 
     // If the distance is computed between two vectors, rather than matrices, return a scalar
     int const dtype_is_complex = is_complex(dtype);
+    simsimd_u64_t const usage_start = kernel_usage_start();
     if (a_parsed.rank == 1 && b_parsed.rank == 1) {
+        simsimd_distance_t distances[2];
+        Py_BEGIN_ALLOW_THREADS;
+        metric(a_parsed.start, b_parsed.start, a_parsed.dimensions, distances);
+        Py_END_ALLOW_THREADS;
         // For complex numbers we are going to use `PyComplex_FromDoubles`.
-        if (dtype_is_complex) {
-            simsimd_distance_t distances[2];
-            metric(a_parsed.start, b_parsed.start, a_parsed.dimensions, distances);
-            return_obj = PyComplex_FromDoubles(distances[0], distances[1]);
-        }
-        else {
-            simsimd_distance_t distance;
-            metric(a_parsed.start, b_parsed.start, a_parsed.dimensions, &distance);
-            return_obj = PyFloat_FromDouble(distance);
-        }
+        if (dtype_is_complex) { return_obj = PyComplex_FromDoubles(distances[0], distances[1]); }
+        else { return_obj = PyFloat_FromDouble(distances[0]); }
+        kernel_usage_record(metric_kind, dtype, 1, a_buffer.len + b_buffer.len, usage_start);
         goto cleanup;
     }
 
@@ -724,29 +1342,15 @@ static PyObject *implement_dense_metric( //
     // We take the maximum of the two counts, because if only one entry is present in one of the arrays,
     // all distances will be computed against that single entry.
     size_t const count_pairs = a_parsed.count > b_parsed.count ? a_parsed.count : b_parsed.count;
-    size_t const components_per_pair = dtype_is_complex ? 2 : 1;
-    size_t const count_components = count_pairs * components_per_pair;
     char *distances_start = NULL;
     size_t distances_stride_bytes = 0;
 
     // Allocate the output matrix if it wasn't provided
     if (!out_obj) {
-        DistancesTensor *distances_obj =
-            PyObject_NewVar(DistancesTensor, &DistancesTensorType, count_components * bytes_per_datatype(out_dtype));
-        if (!distances_obj) {
-            PyErr_NoMemory();
-            goto cleanup;
-        }
-
-        // Initialize the object
-        distances_obj->datatype = out_dtype;
-        distances_obj->dimensions = 1;
-        distances_obj->shape[0] = count_pairs;
-        distances_obj->shape[1] = 1;
-        distances_obj->strides[0] = bytes_per_datatype(out_dtype);
-        distances_obj->strides[1] = 0;
+        DistancesTensor *distances_obj = new_distances_tensor(out_dtype, 1, 1, count_pairs);
+        if (!distances_obj) goto cleanup;
         return_obj = (PyObject *)distances_obj;
-        distances_start = (char *)&distances_obj->start[0];
+        distances_start = distances_obj->data;
         distances_stride_bytes = distances_obj->strides[0];
     }
     else {
@@ -766,6 +1370,7 @@ static PyObject *implement_dense_metric( //
     }
 
     // Compute the distances
+    Py_BEGIN_ALLOW_THREADS;
     for (size_t i = 0; i < count_pairs; ++i) {
         simsimd_distance_t result[2];
         metric(                                   //
@@ -778,6 +1383,8 @@ static PyObject *implement_dense_metric( //
         cast_distance(result[0], out_dtype, distances_start + i * distances_stride_bytes, 0);
         if (dtype_is_complex) cast_distance(result[1], out_dtype, distances_start + i * distances_stride_bytes, 1);
     }
+    Py_END_ALLOW_THREADS;
+    kernel_usage_record(metric_kind, dtype, count_pairs, a_buffer.len + b_buffer.len, usage_start);
 
 cleanup:
     PyBuffer_Release(&a_buffer);
@@ -886,12 +1493,11 @@ static PyObject *implement_curved_metric( //
     }
     if (dtype == simsimd_datatype_unknown_k) dtype = a_parsed.datatype;
 
-    // Look up the metric and the capability
-    simsimd_metric_curved_punned_t metric = NULL;
-    simsimd_capability_t capability = simsimd_cap_serial_k;
-    simsimd_find_metric_punned(metric_kind, dtype, static_capabilities, simsimd_cap_any_k,
-                               (simsimd_metric_punned_t *)&metric, &capability);
+    // Look up the metric in the dispatch table
+    simsimd_metric_curved_punned_t metric =
+        (simsimd_metric_curved_punned_t)simsimd_dispatch_table_find(&dispatch_table, metric_kind, dtype);
     if (!metric) {
+        kernel_usage_record(metric_kind, dtype, 1, 0, 0);
         PyErr_Format( //
             PyExc_LookupError,
             "Unsupported metric '%c' and datatype combination across vectors ('%s'/'%s' and '%s'/'%s'), "
@@ -905,7 +1511,11 @@ static PyObject *implement_curved_metric( //
     }
 
     simsimd_distance_t distance;
+    simsimd_u64_t const usage_start = kernel_usage_start();
+    Py_BEGIN_ALLOW_THREADS;
     metric(a_parsed.start, b_parsed.start, c_parsed.start, a_parsed.dimensions, &distance);
+    Py_END_ALLOW_THREADS;
+    kernel_usage_record(metric_kind, dtype, 1, a_buffer.len + b_buffer.len + c_buffer.len, usage_start);
     return_obj = PyFloat_FromDouble(distance);
 
 cleanup:
@@ -918,24 +1528,36 @@ cleanup:
 static PyObject *implement_sparse_metric( //
     simsimd_metric_kind_t metric_kind,    //
     PyObject *const *args, Py_ssize_t nargs) {
-    if (nargs != 2) {
-        PyErr_SetString(PyExc_TypeError, "Function expects only 2 arguments");
+    if (nargs != 2 && nargs != 4) {
+        PyErr_SetString(PyExc_TypeError, "Function expects 2 index arrays, optionally followed by 2 weight arrays");
         return NULL;
     }
 
     PyObject *return_obj = NULL;
     PyObject *a_obj = args[0];
     PyObject *b_obj = args[1];
+    int const is_weighted = nargs == 4;
 
-    Py_buffer a_buffer, b_buffer;
-    TensorArgument a_parsed, b_parsed;
+    Py_buffer a_buffer, b_buffer, a_weights_buffer, b_weights_buffer;
+    TensorArgument a_parsed, b_parsed, a_weights_parsed, b_weights_parsed;
+    memset(&a_weights_buffer, 0, sizeof(Py_buffer));
+    memset(&b_weights_buffer, 0, sizeof(Py_buffer));
     if (!parse_tensor(a_obj, &a_buffer, &a_parsed) || !parse_tensor(b_obj, &b_buffer, &b_parsed)) return NULL;
+    if (is_weighted && (!parse_tensor(args[2], &a_weights_buffer, &a_weights_parsed) ||
+                        !parse_tensor(args[3], &b_weights_buffer, &b_weights_parsed)))
+        goto cleanup;
 
     // Check dimensions
     if (a_parsed.rank != 1 || b_parsed.rank != 1) {
         PyErr_SetString(PyExc_ValueError, "First and second argument must be vectors");
         goto cleanup;
     }
+    if (is_weighted && (a_weights_parsed.rank != 1 || b_weights_parsed.rank != 1 ||
+                        a_weights_parsed.dimensions != a_parsed.dimensions ||
+                        b_weights_parsed.dimensions != b_parsed.dimensions)) {
+        PyErr_SetString(PyExc_ValueError, "Weights must be vectors of the same length as the indices");
+        goto cleanup;
+    }
 
     // Check data types
     if (a_parsed.datatype != b_parsed.datatype && a_parsed.datatype != simsimd_datatype_unknown_k &&
@@ -944,13 +1566,26 @@ static PyObject *implement_sparse_metric( //
                         "Input tensors must have matching datatypes, check with `X.__array_interface__`");
         goto cleanup;
     }
+    if (is_weighted) {
+        if (a_weights_parsed.datatype != b_weights_parsed.datatype) {
+            PyErr_SetString(PyExc_TypeError, "Weight tensors must have matching datatypes");
+            goto cleanup;
+        }
+        // The kind of the weighted product is defined by the type of weights
+        switch (a_weights_parsed.datatype) {
+        case simsimd_datatype_i16_k: metric_kind = simsimd_metric_spdot_counts_k; break;
+        case simsimd_datatype_bf16_k: metric_kind = simsimd_metric_spdot_weights_k; break;
+        case simsimd_datatype_f32_k: metric_kind = simsimd_metric_spdot_weights_f32_k; break;
+        default:
+            PyErr_SetString(PyExc_TypeError, "Weights must be 16-bit integers, `bf16`, or `f32` floats");
+            goto cleanup;
+        }
+    }
 
     simsimd_datatype_t dtype = a_parsed.datatype;
-    simsimd_metric_sparse_punned_t metric = NULL;
-    simsimd_capability_t capability = simsimd_cap_serial_k;
-    simsimd_find_metric_punned(metric_kind, dtype, static_capabilities, simsimd_cap_any_k,
-                               (simsimd_metric_punned_t *)&metric, &capability);
+    simsimd_metric_punned_t metric = simsimd_dispatch_table_find(&dispatch_table, metric_kind, dtype);
     if (!metric) {
+        kernel_usage_record(metric_kind, dtype, 1, 0, 0);
         PyErr_Format( //
             PyExc_LookupError, "Unsupported metric '%c' and datatype combination ('%s'/'%s' and '%s'/'%s')",
             metric_kind,                                                                             //
@@ -959,32 +1594,67 @@ static PyObject *implement_sparse_metric( //
         goto cleanup;
     }
 
-    simsimd_distance_t distance;
-    metric(a_parsed.start, b_parsed.start, a_parsed.dimensions, b_parsed.dimensions, &distance);
-    return_obj = PyFloat_FromDouble(distance);
+    // Weighted kernels output both the intersection size and the dot product of the matching weights
+    simsimd_distance_t results[2];
+    simsimd_u64_t const usage_start = kernel_usage_start();
+    Py_BEGIN_ALLOW_THREADS;
+    if (is_weighted)
+        ((simsimd_metric_spdot_punned_t)metric)(a_parsed.start, b_parsed.start, a_weights_parsed.start,
+                                                b_weights_parsed.start, a_parsed.dimensions, b_parsed.dimensions,
+                                                results);
+    else
+        ((simsimd_metric_sparse_punned_t)metric)(a_parsed.start, b_parsed.start, a_parsed.dimensions,
+                                                 b_parsed.dimensions, results);
+    Py_END_ALLOW_THREADS;
+    return_obj = PyFloat_FromDouble(results[is_weighted]);
+    kernel_usage_record(metric_kind, dtype, 1,
+                        a_buffer.len + b_buffer.len + a_weights_buffer.len + b_weights_buffer.len, usage_start);
 
 cleanup:
     PyBuffer_Release(&a_buffer);
     PyBuffer_Release(&b_buffer);
+    PyBuffer_Release(&a_weights_buffer);
+    PyBuffer_Release(&b_weights_buffer);
     return return_obj;
 }
 
 static PyObject *implement_cdist(                        //
     PyObject *a_obj, PyObject *b_obj, PyObject *out_obj, //
+    PyObject *a_norms_obj, PyObject *b_norms_obj,        //
     simsimd_metric_kind_t metric_kind, size_t threads,   //
-    simsimd_datatype_t dtype, simsimd_datatype_t out_dtype) {
+    simsimd_datatype_t dtype, simsimd_datatype_t out_dtype, Workspace *workspace) {
 
     PyObject *return_obj = NULL;
 
-    Py_buffer a_buffer, b_buffer, out_buffer;
-    TensorArgument a_parsed, b_parsed, out_parsed;
+    Py_buffer a_buffer, b_buffer, out_buffer, a_norms_buffer, b_norms_buffer;
+    TensorArgument a_parsed, b_parsed, out_parsed, a_norms_parsed, b_norms_parsed;
+    simsimd_distance_t *shared_norms = NULL;
     memset(&a_buffer, 0, sizeof(Py_buffer));
     memset(&b_buffer, 0, sizeof(Py_buffer));
     memset(&out_buffer, 0, sizeof(Py_buffer));
+    memset(&a_norms_buffer, 0, sizeof(Py_buffer));
+    memset(&b_norms_buffer, 0, sizeof(Py_buffer));
 
     // Error will be set by `parse_tensor` if the input is invalid
     if (!parse_tensor(a_obj, &a_buffer, &a_parsed) || !parse_tensor(b_obj, &b_buffer, &b_parsed)) return NULL;
-    if (out_obj && !parse_tensor(out_obj, &out_buffer, &out_parsed)) return NULL;
+    if (out_obj && !parse_output_tensor(out_obj, &out_buffer, &out_parsed)) return NULL;
+    if ((a_norms_obj && !parse_tensor(a_norms_obj, &a_norms_buffer, &a_norms_parsed)) ||
+        (b_norms_obj && !parse_tensor(b_norms_obj, &b_norms_buffer, &b_norms_parsed)))
+        goto cleanup;
+
+    // The cached norms are only meaningful for the angular and Euclidean distances
+    if ((a_norms_obj || b_norms_obj) && kernel_cdist_normed_kind(metric_kind) == simsimd_metric_unknown_k) {
+        PyErr_SetString(PyExc_ValueError,
+                        "Cached norms are only supported for 'cosine', 'sqeuclidean', and 'euclidean'");
+        goto cleanup;
+    }
+    if ((a_norms_obj && (a_norms_parsed.rank != 1 || a_norms_parsed.datatype != simsimd_datatype_f64_k ||
+                         a_norms_parsed.dimensions != a_parsed.count)) ||
+        (b_norms_obj && (b_norms_parsed.rank != 1 || b_norms_parsed.datatype != simsimd_datatype_f64_k ||
+                         b_norms_parsed.dimensions != b_parsed.count))) {
+        PyErr_SetString(PyExc_ValueError, "Cached norms must be 1D 'float64' vectors with one entry per row");
+        goto cleanup;
+    }
 
     // Check dimensions
     if (a_parsed.dimensions != b_parsed.dimensions) {
@@ -1039,11 +1709,10 @@ static PyObject *implement_cdist(                        //
         }
     }
 
-    // Look up the metric and the capability
-    simsimd_metric_punned_t metric = NULL;
-    simsimd_capability_t capability = simsimd_cap_serial_k;
-    simsimd_find_metric_punned(metric_kind, dtype, static_capabilities, simsimd_cap_any_k, &metric, &capability);
+    // Look up the metric in the dispatch table
+    simsimd_metric_punned_t metric = simsimd_dispatch_table_find(&dispatch_table, metric_kind, dtype);
     if (!metric) {
+        kernel_usage_record(metric_kind, dtype, 1, 0, 0);
         PyErr_Format( //
             PyExc_LookupError, "Unsupported metric '%c' and datatype combination ('%s'/'%s' and '%s'/'%s')",
             metric_kind,                                                                             //
@@ -1054,18 +1723,16 @@ static PyObject *implement_cdist(                        //
 
     // If the distance is computed between two vectors, rather than matrices, return a scalar
     int const dtype_is_complex = is_complex(dtype);
+    simsimd_u64_t const usage_start = kernel_usage_start();
     if (a_parsed.rank == 1 && b_parsed.rank == 1) {
+        simsimd_distance_t distances[2];
+        Py_BEGIN_ALLOW_THREADS;
+        metric(a_parsed.start, b_parsed.start, a_parsed.dimensions, distances);
+        Py_END_ALLOW_THREADS;
         // For complex numbers we are going to use `PyComplex_FromDoubles`.
-        if (dtype_is_complex) {
-            simsimd_distance_t distances[2];
-            metric(a_parsed.start, b_parsed.start, a_parsed.dimensions, distances);
-            return_obj = PyComplex_FromDoubles(distances[0], distances[1]);
-        }
-        else {
-            simsimd_distance_t distance;
-            metric(a_parsed.start, b_parsed.start, a_parsed.dimensions, &distance);
-            return_obj = PyFloat_FromDouble(distance);
-        }
+        if (dtype_is_complex) { return_obj = PyComplex_FromDoubles(distances[0], distances[1]); }
+        else { return_obj = PyFloat_FromDouble(distances[0]); }
+        kernel_usage_record(metric_kind, dtype, 1, a_buffer.len + b_buffer.len, usage_start);
         goto cleanup;
     }
 
@@ -1077,31 +1744,17 @@ static PyObject *implement_cdist(                        //
 #endif
 
     size_t const count_pairs = a_parsed.count * b_parsed.count;
-    size_t const components_per_pair = dtype_is_complex ? 2 : 1;
-    size_t const count_components = count_pairs * components_per_pair;
     char *distances_start = NULL;
     size_t distances_rows_stride_bytes = 0;
     size_t distances_cols_stride_bytes = 0;
 
     // Allocate the output matrix if it wasn't provided
     if (!out_obj) {
-
         DistancesTensor *distances_obj =
-            PyObject_NewVar(DistancesTensor, &DistancesTensorType, count_components * bytes_per_datatype(out_dtype));
-        if (!distances_obj) {
-            PyErr_NoMemory();
-            goto cleanup;
-        }
-
-        // Initialize the object
-        distances_obj->datatype = out_dtype;
-        distances_obj->dimensions = 2;
-        distances_obj->shape[0] = a_parsed.count;
-        distances_obj->shape[1] = b_parsed.count;
-        distances_obj->strides[0] = b_parsed.count * bytes_per_datatype(distances_obj->datatype);
-        distances_obj->strides[1] = bytes_per_datatype(distances_obj->datatype);
+            new_distances_tensor_in(workspace, out_dtype, 2, a_parsed.count, b_parsed.count);
+        if (!distances_obj) goto cleanup;
         return_obj = (PyObject *)distances_obj;
-        distances_start = (char *)&distances_obj->start[0];
+        distances_start = distances_obj->data;
         distances_rows_stride_bytes = distances_obj->strides[0];
         distances_cols_stride_bytes = distances_obj->strides[1];
     }
@@ -1122,10 +1775,112 @@ static PyObject *implement_cdist(                        //
         return_obj = Py_None;
     }
 
+    // Angular and Euclidean distances can reuse the squared norms of the rows, either passed by the caller,
+    // or computed once for both sides, if a set is compared against itself.
+    simsimd_metric_cdist_normed_punned_t cdist_normed_metric = NULL;
+    simsimd_metric_kind_t const cdist_normed_kind = kernel_cdist_normed_kind(metric_kind);
+    int const is_same_set = a_parsed.start == b_parsed.start && a_parsed.stride == b_parsed.stride &&
+                            a_parsed.count == b_parsed.count;
+    if (cdist_normed_kind != simsimd_metric_unknown_k && (a_norms_obj || b_norms_obj || is_same_set) &&
+        (out_dtype == simsimd_datatype_f64_k || out_dtype == simsimd_datatype_f32_k ||
+         out_dtype == simsimd_datatype_f16_k || out_dtype == simsimd_datatype_bf16_k) &&
+        distances_cols_stride_bytes == bytes_per_datatype(out_dtype))
+        cdist_normed_metric = (simsimd_metric_cdist_normed_punned_t)simsimd_dispatch_table_find(
+            &dispatch_table, cdist_normed_kind, dtype);
+    if (cdist_normed_metric) {
+        simsimd_distance_t const *a_norms = a_norms_obj ? (simsimd_distance_t const *)a_norms_parsed.start : NULL;
+        simsimd_distance_t const *b_norms = b_norms_obj ? (simsimd_distance_t const *)b_norms_parsed.start : NULL;
+        simsimd_kernel_norms_punned_t norms_kernel =
+            (simsimd_kernel_norms_punned_t)simsimd_dispatch_table_find(&dispatch_table, simsimd_metric_norms_k, dtype);
+        if (is_same_set && !a_norms && !b_norms && norms_kernel) {
+            shared_norms = (simsimd_distance_t *)malloc(a_parsed.count * sizeof(simsimd_distance_t));
+            if (!shared_norms) {
+                PyErr_NoMemory();
+                goto cleanup;
+            }
+            a_norms = b_norms = shared_norms;
+        }
+        size_t const count_slices = (a_parsed.count + SIMSIMD_CDIST_MC - 1) / SIMSIMD_CDIST_MC;
+        Py_BEGIN_ALLOW_THREADS;
+        if (shared_norms)
+            norms_kernel(a_parsed.start, a_parsed.count, a_parsed.stride, a_parsed.dimensions, shared_norms);
+#pragma omp parallel for
+        for (size_t slice = 0; slice < count_slices; ++slice) {
+            size_t const i = slice * SIMSIMD_CDIST_MC;
+            size_t const rows = a_parsed.count - i < SIMSIMD_CDIST_MC ? a_parsed.count - i : SIMSIMD_CDIST_MC;
+            cdist_normed_metric(                                                                //
+                a_parsed.start + i * a_parsed.stride, b_parsed.start,                           //
+                rows, a_parsed.stride, b_parsed.count, b_parsed.stride,                         //
+                a_parsed.dimensions, a_norms ? a_norms + i : NULL, b_norms,                     //
+                distances_start + i * distances_rows_stride_bytes, distances_rows_stride_bytes, //
+                out_dtype);
+        }
+        Py_END_ALLOW_THREADS;
+        kernel_usage_record(cdist_normed_kind, dtype, count_slices, a_buffer.len + b_buffer.len, usage_start);
+        goto cleanup;
+    }
+
+    // Real-valued dot-products, spatial distances, and binary distances exported into contiguous `f64` rows
+    // are computed by many-to-many kernels, each thread taking its own slice of the rows of `a`.
+    simsimd_metric_cdist_punned_t cdist_metric = NULL;
+    simsimd_metric_kind_t const cdist_kind = kernel_cdist_kind(metric_kind);
+    if (cdist_kind != simsimd_metric_unknown_k && out_dtype == simsimd_datatype_f64_k &&
+        distances_cols_stride_bytes == sizeof(simsimd_distance_t))
+        cdist_metric =
+            (simsimd_metric_cdist_punned_t)simsimd_dispatch_table_find(&dispatch_table, cdist_kind, dtype);
+    if (cdist_metric) {
+        size_t const count_slices = (a_parsed.count + SIMSIMD_CDIST_MC - 1) / SIMSIMD_CDIST_MC;
+        Py_BEGIN_ALLOW_THREADS;
+#pragma omp parallel for
+        for (size_t slice = 0; slice < count_slices; ++slice) {
+            size_t const i = slice * SIMSIMD_CDIST_MC;
+            size_t const rows = a_parsed.count - i < SIMSIMD_CDIST_MC ? a_parsed.count - i : SIMSIMD_CDIST_MC;
+            cdist_metric(                                                                  //
+                a_parsed.start + i * a_parsed.stride, b_parsed.start,                      //
+                rows, a_parsed.stride, b_parsed.count, b_parsed.stride,                    //
+                a_parsed.dimensions,                                                       //
+                (simsimd_distance_t *)(distances_start + i * distances_rows_stride_bytes), //
+                distances_rows_stride_bytes);
+        }
+        Py_END_ALLOW_THREADS;
+        kernel_usage_record(cdist_kind, dtype, count_slices, a_buffer.len + b_buffer.len, usage_start);
+        goto cleanup;
+    }
+
+    // Narrower floating-point outputs of the dense kernels are exported straight from the cache blocks,
+    // without materializing the `f64` distances first.
+    simsimd_metric_cdist_typed_punned_t cdist_typed_metric = NULL;
+    simsimd_metric_kind_t const cdist_typed_kind = kernel_cdist_typed_kind(metric_kind);
+    if (cdist_typed_kind != simsimd_metric_unknown_k &&
+        (out_dtype == simsimd_datatype_f32_k || out_dtype == simsimd_datatype_f16_k ||
+         out_dtype == simsimd_datatype_bf16_k) &&
+        distances_cols_stride_bytes == bytes_per_datatype(out_dtype))
+        cdist_typed_metric =
+            (simsimd_metric_cdist_typed_punned_t)simsimd_dispatch_table_find(&dispatch_table, cdist_typed_kind, dtype);
+    if (cdist_typed_metric) {
+        size_t const count_slices = (a_parsed.count + SIMSIMD_CDIST_MC - 1) / SIMSIMD_CDIST_MC;
+        Py_BEGIN_ALLOW_THREADS;
+#pragma omp parallel for
+        for (size_t slice = 0; slice < count_slices; ++slice) {
+            size_t const i = slice * SIMSIMD_CDIST_MC;
+            size_t const rows = a_parsed.count - i < SIMSIMD_CDIST_MC ? a_parsed.count - i : SIMSIMD_CDIST_MC;
+            cdist_typed_metric(                                                                 //
+                a_parsed.start + i * a_parsed.stride, b_parsed.start,                           //
+                rows, a_parsed.stride, b_parsed.count, b_parsed.stride,                         //
+                a_parsed.dimensions,                                                            //
+                distances_start + i * distances_rows_stride_bytes, distances_rows_stride_bytes, //
+                out_dtype);
+        }
+        Py_END_ALLOW_THREADS;
+        kernel_usage_record(cdist_typed_kind, dtype, count_slices, a_buffer.len + b_buffer.len, usage_start);
+        goto cleanup;
+    }
+
     // Assuming most of our kernels are symmetric, we only need to compute the upper triangle
     // if we are computing all pairwise distances within the same set.
     int const is_symmetric = kernel_is_commutative(metric_kind) && a_parsed.start == b_parsed.start &&
                              a_parsed.stride == b_parsed.stride && a_parsed.count == b_parsed.count;
+    Py_BEGIN_ALLOW_THREADS;
 #pragma omp parallel for collapse(2)
     for (size_t i = 0; i < a_parsed.count; ++i)
         for (size_t j = 0; j < b_parsed.count; ++j) {
@@ -1154,11 +1909,17 @@ static PyObject *implement_cdist(                        //
                 cast_distance(result[1], out_dtype,
                               distances_start + j * distances_rows_stride_bytes + i * distances_cols_stride_bytes, 1);
         }
+    Py_END_ALLOW_THREADS;
+    kernel_usage_record(metric_kind, dtype, is_symmetric ? (count_pairs + a_parsed.count) / 2 : count_pairs,
+                        a_buffer.len + b_buffer.len, usage_start);
 
 cleanup:
     PyBuffer_Release(&a_buffer);
     PyBuffer_Release(&b_buffer);
     PyBuffer_Release(&out_buffer);
+    PyBuffer_Release(&a_norms_buffer);
+    PyBuffer_Release(&b_norms_buffer);
+    free(shared_norms);
     return return_obj;
 }
 
@@ -1175,9 +1936,7 @@ static PyObject *implement_pointer_access(simsimd_metric_kind_t metric_kind, PyO
         return NULL;
     }
 
-    simsimd_metric_punned_t metric = NULL;
-    simsimd_capability_t capability = simsimd_cap_serial_k;
-    simsimd_find_metric_punned(metric_kind, datatype, static_capabilities, simsimd_cap_any_k, &metric, &capability);
+    simsimd_metric_punned_t metric = simsimd_dispatch_table_find(&dispatch_table, metric_kind, datatype);
     if (metric == NULL) {
         PyErr_SetString(PyExc_LookupError, "No such metric");
         return NULL;
@@ -1196,18 +1955,24 @@ static char const doc_cdist[] = //
     "    dtype (Union[IntegralType, FloatType, ComplexType], optional): Override the presumed input type.\n"
     "    out_dtype (Union[FloatType, ComplexType], optional): Result type, default is 'float64'.\n\n"
     "    threads (int, optional): Number of threads to use (default is 1).\n"
+    "    a_norms (NDArray, optional): Cached 'float64' squared norms of the rows of `a`.\n"
+    "    b_norms (NDArray, optional): Cached 'float64' squared norms of the rows of `b`.\n"
+    "    workspace (Workspace, optional): Reusable arena to place the result in, instead of `out`.\n"
     "Returns:\n"
     "    DistancesTensor: Pairwise distances between all inputs.\n\n"
     "Equivalent to: `scipy.spatial.distance.cdist`.\n"
     "Notes:\n"
     "    * `a` and `b` are positional-only arguments.\n"
     "    * `metric` can be positional or keyword.\n"
-    "    * `out`, `threads`, `dtype`, and `out_dtype` are keyword-only arguments.";
+    "    * `out`, `threads`, `dtype`, `out_dtype`, `a_norms`, `b_norms`, and `workspace` are keyword-only.\n"
+    "    * Results placed in a `workspace` are overwritten by its next use.\n"
+    "    * The norms only apply to 'cosine', 'sqeuclidean', and 'euclidean', and are computed once and shared\n"
+    "      when a matrix is compared with itself. Get them from `norms(X)`.";
 
 static PyObject *api_cdist( //
     PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count, PyObject *args_names_tuple) {
 
-    // This function accepts up to 7 arguments - more than SciPy:
+    // This function accepts up to 9 arguments - more than SciPy:
     // https://docs.scipy.org/doc/scipy/reference/generated/scipy.spatial.distance.cdist.html
     PyObject *a_obj = NULL;         // Required object, positional-only
     PyObject *b_obj = NULL;         // Required object, positional-only
@@ -1216,6 +1981,9 @@ static PyObject *api_cdist( //
     PyObject *dtype_obj = NULL;     // Optional string, "dtype" keyword-only
     PyObject *out_dtype_obj = NULL; // Optional string, "out_dtype" keyword-only
     PyObject *threads_obj = NULL;   // Optional integer, "threads" keyword-only
+    PyObject *a_norms_obj = NULL;   // Optional object, "a_norms" keyword-only
+    PyObject *b_norms_obj = NULL;   // Optional object, "b_norms" keyword-only
+    PyObject *workspace_obj = NULL; // Optional object, "workspace" keyword-only
 
     // Once parsed, the arguments will be stored in these variables:
     unsigned long long threads = 1;
@@ -1230,8 +1998,8 @@ static PyObject *api_cdist( //
     // Parse the arguments
     Py_ssize_t const args_names_count = args_names_tuple ? PyTuple_Size(args_names_tuple) : 0;
     Py_ssize_t const args_count = positional_args_count + args_names_count;
-    if (args_count < 2 || args_count > 7) {
-        PyErr_Format(PyExc_TypeError, "Function expects 2-7 arguments, got %zd", args_count);
+    if (args_count < 2 || args_count > 10) {
+        PyErr_Format(PyExc_TypeError, "Function expects 2-10 arguments, got %zd", args_count);
         return NULL;
     }
     if (positional_args_count > 3) {
@@ -1256,6 +2024,9 @@ static PyObject *api_cdist( //
         else if (PyUnicode_CompareWithASCIIString(key, "out_dtype") == 0 && !out_dtype_obj) { out_dtype_obj = value; }
         else if (PyUnicode_CompareWithASCIIString(key, "threads") == 0 && !threads_obj) { threads_obj = value; }
         else if (PyUnicode_CompareWithASCIIString(key, "metric") == 0 && !metric_obj) { metric_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "a_norms") == 0 && !a_norms_obj) { a_norms_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "b_norms") == 0 && !b_norms_obj) { b_norms_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "workspace") == 0 && !workspace_obj) { workspace_obj = value; }
         else {
             PyErr_Format(PyExc_TypeError, "Got unexpected keyword argument: %S", key);
             return NULL;
@@ -1311,27 +2082,788 @@ static PyObject *api_cdist( //
         }
     }
 
-    return implement_cdist(a_obj, b_obj, out_obj, metric_kind, threads, dtype, out_dtype);
-}
+    // Results can either be written into `out`, or into the arena of the `workspace`
+    if (workspace_obj && !PyObject_TypeCheck(workspace_obj, &WorkspaceType)) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'workspace' to be a `simsimd.Workspace`");
+        return NULL;
+    }
+    if (workspace_obj && out_obj) {
+        PyErr_SetString(PyExc_ValueError, "The 'out' and 'workspace' arguments are mutually exclusive");
+        return NULL;
+    }
 
-static char const doc_l2_pointer[] = "Get (int) pointer to the `simsimd.l2` kernel.";
-static PyObject *api_l2_pointer(PyObject *self, PyObject *dtype_obj) {
-    return implement_pointer_access(simsimd_metric_l2_k, dtype_obj);
-}
-static char const doc_l2sq_pointer[] = "Get (int) pointer to the `simsimd.l2sq` kernel.";
-static PyObject *api_l2sq_pointer(PyObject *self, PyObject *dtype_obj) {
-    return implement_pointer_access(simsimd_metric_l2sq_k, dtype_obj);
+    return implement_cdist(a_obj, b_obj, out_obj, a_norms_obj, b_norms_obj, metric_kind, threads, dtype, out_dtype,
+                           (Workspace *)workspace_obj);
 }
-static char const doc_cos_pointer[] = "Get (int) pointer to the `simsimd.cos` kernel.";
-static PyObject *api_cos_pointer(PyObject *self, PyObject *dtype_obj) {
-    return implement_pointer_access(simsimd_metric_cos_k, dtype_obj);
-}
-static char const doc_dot_pointer[] = "Get (int) pointer to the `simsimd.dot` kernel.";
-static PyObject *api_dot_pointer(PyObject *self, PyObject *dtype_obj) {
-    return implement_pointer_access(simsimd_metric_dot_k, dtype_obj);
+
+static char const doc_norms[] = //
+    "Compute the squared Euclidean norms of all rows of a matrix, to be cached and passed to `cdist`.\n\n"
+    "Args:\n"
+    "    a (NDArray): Input matrix or a single vector.\n"
+    "Returns:\n"
+    "    DistancesTensor: 'float64' squared norms, one per row.\n\n"
+    "Notes:\n"
+    "    * Pass the result as `a_norms` or `b_norms` to `cdist`, when the same matrix is compared many times.";
+
+static PyObject *api_norms(PyObject *self, PyObject *a_obj) {
+    PyObject *return_obj = NULL;
+    Py_buffer a_buffer;
+    TensorArgument a_parsed;
+    memset(&a_buffer, 0, sizeof(Py_buffer));
+    if (!parse_tensor(a_obj, &a_buffer, &a_parsed)) return NULL;
+
+    simsimd_kernel_norms_punned_t kernel = (simsimd_kernel_norms_punned_t)simsimd_dispatch_table_find(
+        &dispatch_table, simsimd_metric_norms_k, a_parsed.datatype);
+    if (!kernel) {
+        PyErr_Format(PyExc_LookupError, "Unsupported datatype for norms ('%s'/'%s')",
+                     a_buffer.format ? a_buffer.format : "nil", datatype_to_python_string(a_parsed.datatype));
+        goto cleanup;
+    }
+
+    DistancesTensor *norms_obj = new_distances_tensor(simsimd_datatype_f64_k, 1, a_parsed.count, 1);
+    if (!norms_obj) goto cleanup;
+    Py_BEGIN_ALLOW_THREADS;
+    kernel(a_parsed.start, a_parsed.count, a_parsed.stride, a_parsed.dimensions,
+           (simsimd_distance_t *)norms_obj->data);
+    Py_END_ALLOW_THREADS;
+    return_obj = (PyObject *)norms_obj;
+
+cleanup:
+    PyBuffer_Release(&a_buffer);
+    return return_obj;
 }
-static char const doc_vdot_pointer[] = "Get (int) pointer to the `simsimd.vdot` kernel.";
-static PyObject *api_vdot_pointer(PyObject *self, PyObject *dtype_obj) {
+
+static PyObject *implement_topk(                            //
+    PyObject *a_obj, PyObject *b_obj, size_t k,             //
+    simsimd_metric_kind_t metric_kind, size_t threads,      //
+    simsimd_datatype_t dtype) {
+
+    PyObject *return_obj = NULL;
+    DistancesTensor *ids_obj = NULL, *distances_obj = NULL;
+    simsimd_size_t *heaps_ids = NULL, *heaps_counts = NULL;
+    simsimd_distance_t *heaps_distances = NULL;
+    int owns_heaps = 0;
+
+    Py_buffer a_buffer, b_buffer;
+    TensorArgument a_parsed, b_parsed;
+    memset(&a_buffer, 0, sizeof(Py_buffer));
+    memset(&b_buffer, 0, sizeof(Py_buffer));
+
+    // Error will be set by `parse_tensor` if the input is invalid
+    if (!parse_tensor(a_obj, &a_buffer, &a_parsed) || !parse_tensor(b_obj, &b_buffer, &b_parsed)) return NULL;
+
+    // Check dimensions
+    if (a_parsed.dimensions != b_parsed.dimensions) {
+        PyErr_Format(PyExc_ValueError, "Vector dimensions don't match (%z != %z)", a_parsed.dimensions,
+                     b_parsed.dimensions);
+        goto cleanup;
+    }
+    if (a_parsed.count == 0 || b_parsed.count == 0) {
+        PyErr_SetString(PyExc_ValueError, "Collections can't be empty");
+        goto cleanup;
+    }
+    if (k == 0) {
+        PyErr_SetString(PyExc_ValueError, "The number of neighbors 'k' must be positive");
+        goto cleanup;
+    }
+
+    // Check data types
+    if (a_parsed.datatype != b_parsed.datatype || //
+        a_parsed.datatype == simsimd_datatype_unknown_k || b_parsed.datatype == simsimd_datatype_unknown_k) {
+        PyErr_SetString(PyExc_TypeError,
+                        "Input tensors must have matching datatypes, check with `X.__array_interface__`");
+        goto cleanup;
+    }
+    if (dtype == simsimd_datatype_unknown_k) dtype = a_parsed.datatype;
+    if (is_complex(dtype)) {
+        PyErr_SetString(PyExc_TypeError, "Complex numbers can't be ranked, use real-valued inputs");
+        goto cleanup;
+    }
+
+    // Look up the metric in the dispatch table, preferring the one-to-many kernel for scoring
+    simsimd_metric_punned_t batch_metric = NULL;
+    simsimd_metric_punned_t metric = simsimd_dispatch_table_find(&dispatch_table, metric_kind, dtype);
+    if (!metric) {
+        kernel_usage_record(metric_kind, dtype, 1, 0, 0);
+        PyErr_Format( //
+            PyExc_LookupError, "Unsupported metric '%c' and datatype combination ('%s'/'%s' and '%s'/'%s')",
+            metric_kind,                                                                             //
+            a_buffer.format ? a_buffer.format : "nil", datatype_to_python_string(a_parsed.datatype), //
+            b_buffer.format ? b_buffer.format : "nil", datatype_to_python_string(b_parsed.datatype));
+        goto cleanup;
+    }
+    simsimd_metric_kind_t const batch_kind = simsimd_metric_batch_kind(metric_kind);
+    if (batch_kind != simsimd_metric_unknown_k)
+        batch_metric = simsimd_dispatch_table_find(&dispatch_table, batch_kind, dtype);
+    int const largest = metric_kind == simsimd_metric_dot_k;
+
+#ifdef __linux__
+#ifdef _OPENMP
+    if (threads == 0) threads = omp_get_num_procs();
+    omp_set_num_threads(threads);
+#endif
+#endif
+
+    // Each query keeps at most `k` candidates, and if there are fewer queries than threads,
+    // the candidates are split into slices, each with its own heap, merged at the end.
+    size_t const k_returned = k < b_parsed.count ? k : b_parsed.count;
+    size_t const max_slices = (b_parsed.count + SIMSIMD_TOPK_CHUNK - 1) / SIMSIMD_TOPK_CHUNK;
+    size_t count_slices = a_parsed.count < threads ? (threads + a_parsed.count - 1) / a_parsed.count : 1;
+    if (count_slices > max_slices) count_slices = max_slices;
+    size_t const slice_size = (b_parsed.count + count_slices - 1) / count_slices;
+    size_t const count_heaps = a_parsed.count * count_slices;
+
+    size_t const rank = a_parsed.rank == 1 ? 1 : 2;
+    ids_obj = new_distances_tensor(simsimd_datatype_u64_k, rank, a_parsed.count, k_returned);
+    distances_obj = new_distances_tensor(simsimd_datatype_f64_k, rank, a_parsed.count, k_returned);
+    heaps_counts = (simsimd_size_t *)PyMem_RawCalloc(count_heaps, sizeof(simsimd_size_t));
+    owns_heaps = count_slices > 1;
+    if (owns_heaps) {
+        heaps_ids = (simsimd_size_t *)PyMem_RawMalloc(count_heaps * k_returned * sizeof(simsimd_size_t));
+        heaps_distances = (simsimd_distance_t *)PyMem_RawMalloc(count_heaps * k_returned * sizeof(simsimd_distance_t));
+    }
+    else {
+        heaps_ids = ids_obj ? (simsimd_size_t *)ids_obj->data : NULL;
+        heaps_distances = distances_obj ? (simsimd_distance_t *)distances_obj->data : NULL;
+    }
+    if (!ids_obj || !distances_obj || !heaps_counts || !heaps_ids || !heaps_distances) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    simsimd_u64_t const usage_start = kernel_usage_start();
+    Py_BEGIN_ALLOW_THREADS;
+#pragma omp parallel for
+    for (size_t heap = 0; heap < count_heaps; ++heap) {
+        size_t const i = heap / count_slices;
+        size_t const first = (heap % count_slices) * slice_size;
+        if (first >= b_parsed.count) continue;
+        size_t const slice = b_parsed.count - first < slice_size ? b_parsed.count - first : slice_size;
+        simsimd_topk_scan(                                                                         //
+            metric, (simsimd_metric_batch_punned_t)batch_metric, largest,                          //
+            a_parsed.start + i * a_parsed.stride, b_parsed.start + first * b_parsed.stride, slice, //
+            b_parsed.stride, a_parsed.dimensions, first,                                           //
+            k_returned, heaps_counts + heap, heaps_ids + heap * k_returned, heaps_distances + heap * k_returned);
+    }
+    kernel_usage_record(batch_metric ? batch_kind : metric_kind, dtype, count_heaps, a_buffer.len + b_buffer.len,
+                        usage_start);
+
+    // Merge the slices into the first heap of every query, sort, and export with padding.
+    // Missing entries, like candidates with NaN distances, are marked with the largest identifier.
+#pragma omp parallel for
+    for (size_t i = 0; i < a_parsed.count; ++i) {
+        size_t const heap = i * count_slices;
+        simsimd_size_t *found_ids = heaps_ids + heap * k_returned;
+        simsimd_distance_t *found_distances = heaps_distances + heap * k_returned;
+        for (size_t slice = 1; slice < count_slices; ++slice)
+            simsimd_topk_merge(k_returned, heaps_counts + heap, found_ids, found_distances,
+                               heaps_counts[heap + slice], found_ids + slice * k_returned,
+                               found_distances + slice * k_returned);
+        simsimd_topk_sort(heaps_counts[heap], found_ids, found_distances, largest);
+
+        simsimd_size_t *ids_row = (simsimd_size_t *)ids_obj->data + i * k_returned;
+        simsimd_distance_t *distances_row = (simsimd_distance_t *)distances_obj->data + i * k_returned;
+        for (size_t j = 0; j < k_returned; ++j) {
+            int const found = j < heaps_counts[heap];
+            ids_row[j] = found ? found_ids[j] : (simsimd_size_t)-1;
+            distances_row[j] = found ? found_distances[j] : NAN;
+        }
+    }
+    Py_END_ALLOW_THREADS;
+
+    return_obj = PyTuple_Pack(2, (PyObject *)ids_obj, (PyObject *)distances_obj);
+
+cleanup:
+    if (owns_heaps) {
+        PyMem_RawFree(heaps_ids);
+        PyMem_RawFree(heaps_distances);
+    }
+    PyMem_RawFree(heaps_counts);
+    Py_XDECREF(ids_obj);
+    Py_XDECREF(distances_obj);
+    PyBuffer_Release(&a_buffer);
+    PyBuffer_Release(&b_buffer);
+    return return_obj;
+}
+
+/// @brief  Executor for the `simsimd_*_parallel` helpers, running the tasks on the OpenMP threads.
+///         The tasks are claimed one by one, as their costs may differ.
+static void openmp_executor(void *executor, simsimd_task_punned_t task, void *context, simsimd_size_t count) {
+    (void)executor;
+#pragma omp parallel for schedule(dynamic, 1)
+    for (size_t i = 0; i < count; ++i) task(context, i);
+}
+
+static PyObject *implement_pdist(                     //
+    PyObject *a_obj, simsimd_metric_kind_t metric_kind, //
+    size_t threads, simsimd_datatype_t dtype, simsimd_datatype_t out_dtype, Workspace *workspace) {
+
+    PyObject *return_obj = NULL;
+    DistancesTensor *distances_obj = NULL;
+
+    Py_buffer a_buffer;
+    TensorArgument a_parsed;
+    memset(&a_buffer, 0, sizeof(Py_buffer));
+
+    // Error will be set by `parse_tensor` if the input is invalid
+    if (!parse_tensor(a_obj, &a_buffer, &a_parsed)) return NULL;
+    if (a_parsed.rank != 2) {
+        PyErr_SetString(PyExc_ValueError, "Input must be a matrix with one observation per row");
+        goto cleanup;
+    }
+    if (a_parsed.datatype == simsimd_datatype_unknown_k) {
+        PyErr_SetString(PyExc_TypeError, "Input tensor has unsupported datatype, check with `X.__array_interface__`");
+        goto cleanup;
+    }
+    if (dtype == simsimd_datatype_unknown_k) dtype = a_parsed.datatype;
+    if (out_dtype == simsimd_datatype_unknown_k)
+        out_dtype = is_complex(dtype) ? simsimd_datatype_f64c_k : simsimd_datatype_f64_k;
+    if (is_complex(dtype) != is_complex(out_dtype)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "If the input datatype is complex, the return datatype must be complex, and same for real.");
+        goto cleanup;
+    }
+    {
+        char returned_buffer_example[8];
+        if (!cast_distance(0, out_dtype, &returned_buffer_example, 0)) {
+            PyErr_SetString(PyExc_ValueError, "Exporting to the provided datatype is not supported");
+            goto cleanup;
+        }
+    }
+
+    simsimd_metric_punned_t metric = simsimd_dispatch_table_find(&dispatch_table, metric_kind, dtype);
+    if (!metric) {
+        kernel_usage_record(metric_kind, dtype, 1, 0, 0);
+        PyErr_Format( //
+            PyExc_LookupError, "Unsupported metric '%c' and datatype combination ('%s'/'%s')", metric_kind,
+            a_buffer.format ? a_buffer.format : "nil", datatype_to_python_string(a_parsed.datatype));
+        goto cleanup;
+    }
+
+#ifdef __linux__
+#ifdef _OPENMP
+    if (threads == 0) threads = omp_get_num_procs();
+    omp_set_num_threads(threads);
+#endif
+#endif
+
+    size_t const count = a_parsed.count;
+    size_t const count_pairs = count * (count - 1) / 2;
+    int const dtype_is_complex = is_complex(dtype);
+    distances_obj = new_distances_tensor_in(workspace, out_dtype, 1, 1, count_pairs);
+    if (!distances_obj) goto cleanup;
+    char *const distances_start = distances_obj->data;
+
+    // Metrics with many-to-many kernels are evaluated in square tiles of the upper triangle,
+    // so every thread gets the same amount of work, and the narrowing is fused into the export.
+    simsimd_metric_kind_t const cdist_kind = kernel_cdist_kind(metric_kind);
+    simsimd_metric_cdist_punned_t cdist_metric = NULL;
+    if (cdist_kind != simsimd_metric_unknown_k && !dtype_is_complex &&
+        (out_dtype == simsimd_datatype_f64_k || out_dtype == simsimd_datatype_f32_k ||
+         out_dtype == simsimd_datatype_f16_k || out_dtype == simsimd_datatype_bf16_k))
+        cdist_metric =
+            (simsimd_metric_cdist_punned_t)simsimd_dispatch_table_find(&dispatch_table, cdist_kind, dtype);
+    simsimd_u64_t const usage_start = kernel_usage_start();
+    if (cdist_metric) {
+        Py_BEGIN_ALLOW_THREADS;
+        simsimd_pdist_parallel(cdist_metric, threads == 1 ? NULL : &openmp_executor, NULL, a_parsed.start, count,
+                               a_parsed.stride, a_parsed.dimensions, distances_start, out_dtype);
+        Py_END_ALLOW_THREADS;
+        kernel_usage_record(cdist_kind, dtype, 1, a_buffer.len, usage_start);
+        return_obj = (PyObject *)distances_obj;
+        distances_obj = NULL;
+        goto cleanup;
+    }
+
+    // Other metrics are evaluated pair by pair, with rows of decreasing length claimed dynamically
+    Py_BEGIN_ALLOW_THREADS;
+#pragma omp parallel for schedule(dynamic, 1)
+    for (size_t i = 0; i < count; ++i)
+        for (size_t j = i + 1; j < count; ++j) {
+            simsimd_distance_t result[2];
+            metric(a_parsed.start + i * a_parsed.stride, a_parsed.start + j * a_parsed.stride, a_parsed.dimensions,
+                   (simsimd_distance_t *)&result);
+            size_t const offset = simsimd_pdist_offset(count, i, j) * (dtype_is_complex ? 2 : 1);
+            cast_distance(result[0], out_dtype, distances_start, offset);
+            if (dtype_is_complex) cast_distance(result[1], out_dtype, distances_start, offset + 1);
+        }
+    Py_END_ALLOW_THREADS;
+    kernel_usage_record(metric_kind, dtype, count_pairs, a_buffer.len, usage_start);
+    return_obj = (PyObject *)distances_obj;
+    distances_obj = NULL;
+
+cleanup:
+    Py_XDECREF(distances_obj);
+    PyBuffer_Release(&a_buffer);
+    return return_obj;
+}
+
+static char const doc_pdist[] = //
+    "Compute distances between all pairs of rows of a single matrix, in a condensed form.\n\n"
+    "Args:\n"
+    "    a (NDArray): Matrix with one observation per row.\n"
+    "    metric (str, optional): Distance metric to use (e.g., 'sqeuclidean', 'cosine').\n"
+    "    dtype (Union[IntegralType, FloatType, ComplexType], optional): Override the presumed input type.\n"
+    "    out_dtype (Union[FloatType, ComplexType], optional): Result type, default is 'float64'.\n"
+    "    threads (int, optional): Number of threads to use (default is 1).\n"
+    "    workspace (Workspace, optional): Reusable arena to place the result in.\n\n"
+    "Returns:\n"
+    "    DistancesTensor: Vector of `n * (n - 1) / 2` distances between rows `i < j`, ordered by `i` then `j`.\n\n"
+    "Equivalent to: `scipy.spatial.distance.pdist`.\n"
+    "Notes:\n"
+    "    * `a` is a positional-only argument.\n"
+    "    * `metric` can be positional or keyword.\n"
+    "    * `threads`, `dtype`, `out_dtype`, and `workspace` are keyword-only arguments.\n"
+    "    * Uses half the memory of `cdist(a, a)`, and splits the upper triangle evenly between the threads.";
+
+static PyObject *api_pdist( //
+    PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count, PyObject *args_names_tuple) {
+
+    PyObject *a_obj = NULL;         // Required object, positional-only
+    PyObject *metric_obj = NULL;    // Optional string, "metric" keyword or positional
+    PyObject *dtype_obj = NULL;     // Optional string, "dtype" keyword-only
+    PyObject *out_dtype_obj = NULL; // Optional string, "out_dtype" keyword-only
+    PyObject *threads_obj = NULL;   // Optional integer, "threads" keyword-only
+    PyObject *workspace_obj = NULL; // Optional object, "workspace" keyword-only
+
+    // Once parsed, the arguments will be stored in these variables:
+    unsigned long long threads = 1;
+    char const *dtype_str = NULL, *out_dtype_str = NULL;
+    simsimd_datatype_t dtype = simsimd_datatype_unknown_k, out_dtype = simsimd_datatype_unknown_k;
+    simsimd_metric_kind_t metric_kind = simsimd_metric_euclidean_k;
+    char const *metric_str = NULL;
+
+    // Parse the arguments
+    Py_ssize_t const args_names_count = args_names_tuple ? PyTuple_Size(args_names_tuple) : 0;
+    Py_ssize_t const args_count = positional_args_count + args_names_count;
+    if (args_count < 1 || args_count > 6) {
+        PyErr_Format(PyExc_TypeError, "Function expects 1-6 arguments, got %zd", args_count);
+        return NULL;
+    }
+    if (positional_args_count < 1 || positional_args_count > 2) {
+        PyErr_Format(PyExc_TypeError, "Expects 1 or 2 positional arguments, received %zd", positional_args_count);
+        return NULL;
+    }
+
+    // Positional-only argument (the matrix)
+    a_obj = args[0];
+
+    // Positional or keyword arguments (metric)
+    if (positional_args_count == 2) metric_obj = args[1];
+
+    // The rest of the arguments must be checked in the keyword dictionary:
+    for (Py_ssize_t args_names_tuple_progress = 0, args_progress = positional_args_count;
+         args_names_tuple_progress < args_names_count; ++args_progress, ++args_names_tuple_progress) {
+        PyObject *const key = PyTuple_GetItem(args_names_tuple, args_names_tuple_progress);
+        PyObject *const value = args[args_progress];
+        if (PyUnicode_CompareWithASCIIString(key, "dtype") == 0 && !dtype_obj) { dtype_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "out_dtype") == 0 && !out_dtype_obj) { out_dtype_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "threads") == 0 && !threads_obj) { threads_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "workspace") == 0 && !workspace_obj) { workspace_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "metric") == 0 && !metric_obj) { metric_obj = value; }
+        else {
+            PyErr_Format(PyExc_TypeError, "Got unexpected keyword argument: %S", key);
+            return NULL;
+        }
+    }
+
+    // Convert `metric_obj` to `metric_str` and to `metric_kind`
+    if (metric_obj) {
+        metric_str = PyUnicode_AsUTF8(metric_obj);
+        if (!metric_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'metric' to be a string");
+            return NULL;
+        }
+        metric_kind = python_string_to_metric_kind(metric_str);
+        if (metric_kind == simsimd_metric_unknown_k) {
+            PyErr_SetString(PyExc_LookupError, "Unsupported metric");
+            return NULL;
+        }
+    }
+
+    // Convert `threads_obj` to `threads` integer
+    if (threads_obj) threads = PyLong_AsSize_t(threads_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'threads' to be an unsigned integer");
+        return NULL;
+    }
+
+    // Convert `dtype_obj` to `dtype_str` and to `dtype`
+    if (dtype_obj) {
+        dtype_str = PyUnicode_AsUTF8(dtype_obj);
+        if (!dtype_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'dtype' to be a string");
+            return NULL;
+        }
+        dtype = python_string_to_datatype(dtype_str);
+        if (dtype == simsimd_datatype_unknown_k) {
+            PyErr_SetString(PyExc_ValueError, "Unsupported 'dtype'");
+            return NULL;
+        }
+    }
+
+    // Convert `out_dtype_obj` to `out_dtype_str` and to `out_dtype`
+    if (out_dtype_obj) {
+        out_dtype_str = PyUnicode_AsUTF8(out_dtype_obj);
+        if (!out_dtype_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'out_dtype' to be a string");
+            return NULL;
+        }
+        out_dtype = python_string_to_datatype(out_dtype_str);
+        if (out_dtype == simsimd_datatype_unknown_k) {
+            PyErr_SetString(PyExc_ValueError, "Unsupported 'out_dtype'");
+            return NULL;
+        }
+    }
+
+    if (workspace_obj && !PyObject_TypeCheck(workspace_obj, &WorkspaceType)) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'workspace' to be a `simsimd.Workspace`");
+        return NULL;
+    }
+
+    return implement_pdist(a_obj, metric_kind, threads, dtype, out_dtype, (Workspace *)workspace_obj);
+}
+
+static char const doc_topk[] = //
+    "Find the `k` nearest rows of `b` for every row of `a`, without materializing the distance matrix.\n\n"
+    "Args:\n"
+    "    a (NDArray): Query vector or matrix.\n"
+    "    b (NDArray): Matrix of candidates.\n"
+    "    k (int): Number of neighbors to return per query.\n"
+    "    metric (str, optional): Distance metric to use (e.g., 'sqeuclidean', 'cosine', 'dot').\n"
+    "    dtype (Union[IntegralType, FloatType], optional): Override the presumed input type.\n"
+    "    threads (int, optional): Number of threads to use (default is 1).\n\n"
+    "Returns:\n"
+    "    Tuple[DistancesTensor, DistancesTensor]: `uint64` indices and `float64` distances, best first.\n\n"
+    "Equivalent to: `numpy.argpartition` over `scipy.spatial.distance.cdist`.\n"
+    "Notes:\n"
+    "    * `a`, `b`, and `k` are positional-only arguments.\n"
+    "    * `metric` can be positional or keyword.\n"
+    "    * `threads` and `dtype` are keyword-only arguments.\n"
+    "    * The 'dot' metric keeps the largest products, all other metrics keep the smallest distances.\n"
+    "    * If `k` exceeds the number of candidates, all of them are returned.";
+
+static PyObject *api_topk( //
+    PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count, PyObject *args_names_tuple) {
+
+    PyObject *a_obj = NULL;       // Required object, positional-only
+    PyObject *b_obj = NULL;       // Required object, positional-only
+    PyObject *k_obj = NULL;       // Required integer, positional-only
+    PyObject *metric_obj = NULL;  // Optional string, "metric" keyword or positional
+    PyObject *dtype_obj = NULL;   // Optional string, "dtype" keyword-only
+    PyObject *threads_obj = NULL; // Optional integer, "threads" keyword-only
+
+    // Once parsed, the arguments will be stored in these variables:
+    size_t k = 0;
+    unsigned long long threads = 1;
+    char const *dtype_str = NULL;
+    simsimd_datatype_t dtype = simsimd_datatype_unknown_k;
+    simsimd_metric_kind_t metric_kind = simsimd_metric_euclidean_k;
+    char const *metric_str = NULL;
+
+    // Parse the arguments
+    Py_ssize_t const args_names_count = args_names_tuple ? PyTuple_Size(args_names_tuple) : 0;
+    Py_ssize_t const args_count = positional_args_count + args_names_count;
+    if (args_count < 3 || args_count > 6) {
+        PyErr_Format(PyExc_TypeError, "Function expects 3-6 arguments, got %zd", args_count);
+        return NULL;
+    }
+    if (positional_args_count < 3 || positional_args_count > 4) {
+        PyErr_Format(PyExc_TypeError, "Expects 3 or 4 positional arguments, received %zd", positional_args_count);
+        return NULL;
+    }
+
+    // Positional-only arguments (queries, candidates, and the number of neighbors)
+    a_obj = args[0];
+    b_obj = args[1];
+    k_obj = args[2];
+
+    // Positional or keyword arguments (metric)
+    if (positional_args_count == 4) metric_obj = args[3];
+
+    // The rest of the arguments must be checked in the keyword dictionary:
+    for (Py_ssize_t args_names_tuple_progress = 0, args_progress = positional_args_count;
+         args_names_tuple_progress < args_names_count; ++args_progress, ++args_names_tuple_progress) {
+        PyObject *const key = PyTuple_GetItem(args_names_tuple, args_names_tuple_progress);
+        PyObject *const value = args[args_progress];
+        if (PyUnicode_CompareWithASCIIString(key, "dtype") == 0 && !dtype_obj) { dtype_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "threads") == 0 && !threads_obj) { threads_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "metric") == 0 && !metric_obj) { metric_obj = value; }
+        else {
+            PyErr_Format(PyExc_TypeError, "Got unexpected keyword argument: %S", key);
+            return NULL;
+        }
+    }
+
+    // Convert `k_obj` to `k` integer
+    k = PyLong_AsSize_t(k_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'k' to be an unsigned integer");
+        return NULL;
+    }
+
+    // Convert `metric_obj` to `metric_str` and to `metric_kind`
+    if (metric_obj) {
+        metric_str = PyUnicode_AsUTF8(metric_obj);
+        if (!metric_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'metric' to be a string");
+            return NULL;
+        }
+        metric_kind = python_string_to_metric_kind(metric_str);
+        if (metric_kind == simsimd_metric_unknown_k) {
+            PyErr_SetString(PyExc_LookupError, "Unsupported metric");
+            return NULL;
+        }
+    }
+
+    // Convert `threads_obj` to `threads` integer
+    if (threads_obj) threads = PyLong_AsSize_t(threads_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'threads' to be an unsigned integer");
+        return NULL;
+    }
+
+    // Convert `dtype_obj` to `dtype_str` and to `dtype`
+    if (dtype_obj) {
+        dtype_str = PyUnicode_AsUTF8(dtype_obj);
+        if (!dtype_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'dtype' to be a string");
+            return NULL;
+        }
+        dtype = python_string_to_datatype(dtype_str);
+        if (dtype == simsimd_datatype_unknown_k) {
+            PyErr_SetString(PyExc_ValueError, "Unsupported 'dtype'");
+            return NULL;
+        }
+    }
+
+    return implement_topk(a_obj, b_obj, k, metric_kind, threads, dtype);
+}
+
+static char const doc_topk_file[] = //
+    "Find the `k` nearest rows of a vector file for every row of `a`, streaming it from disk.\n\n"
+    "Args:\n"
+    "    a (NDArray): Query vector or matrix.\n"
+    "    path (Union[str, os.PathLike]): File with the candidate vectors.\n"
+    "    k (int): Number of neighbors to return per query.\n"
+    "    metric (str, optional): Distance metric to use (e.g., 'sqeuclidean', 'cosine', 'dot').\n"
+    "    dtype (Union[IntegralType, FloatType], optional): Datatype of a raw row-major file.\n"
+    "    offset (int, optional): Number of header bytes before the first row of a raw file (default is 0).\n"
+    "    stride (int, optional): Number of bytes between the rows of a raw file (default is the row size).\n"
+    "    rows (int, optional): Number of rows in a raw file (default is inferred from the file size).\n\n"
+    "Returns:\n"
+    "    Tuple[DistancesTensor, DistancesTensor]: `uint64` indices and `float64` distances, best first.\n\n"
+    "Equivalent to: `simsimd.topk(a, numpy.load(path, mmap_mode='r'), k)` for larger-than-memory files.\n"
+    "Notes:\n"
+    "    * `a`, `path`, and `k` are positional-only arguments.\n"
+    "    * `metric` can be positional or keyword.\n"
+    "    * `dtype`, `offset`, `stride`, and `rows` are keyword-only arguments.\n"
+    "    * Without `dtype`, the layout is read from the header of `.npy`, `.fbin`, `.u8bin`, or `.i8bin` files.\n"
+    "    * The file is mapped in large windows, prefetching the next one while the current one is scored.\n"
+    "    * Streaming requires a POSIX system with memory mapping.";
+
+static PyObject *api_topk_file( //
+    PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count, PyObject *args_names_tuple) {
+
+    PyObject *a_obj = NULL;      // Required object, positional-only
+    PyObject *path_obj = NULL;   // Required path, positional-only
+    PyObject *k_obj = NULL;      // Required integer, positional-only
+    PyObject *metric_obj = NULL; // Optional string, "metric" keyword or positional
+    PyObject *dtype_obj = NULL;  // Optional string, "dtype" keyword-only
+    PyObject *offset_obj = NULL; // Optional integer, "offset" keyword-only
+    PyObject *stride_obj = NULL; // Optional integer, "stride" keyword-only
+    PyObject *rows_obj = NULL;   // Optional integer, "rows" keyword-only
+
+    // Once parsed, the arguments will be stored in these variables:
+    size_t k = 0;
+    simsimd_metric_kind_t metric_kind = simsimd_metric_euclidean_k;
+    simsimd_file_matrix_t matrix;
+    PyObject *path_bytes = NULL, *return_obj = NULL;
+    DistancesTensor *ids_obj = NULL, *distances_obj = NULL;
+    simsimd_size_t *counts = NULL;
+    Py_buffer a_buffer;
+    TensorArgument a_parsed;
+    memset(&a_buffer, 0, sizeof(Py_buffer));
+    memset(&matrix, 0, sizeof(matrix));
+
+    // Parse the arguments
+    Py_ssize_t const args_names_count = args_names_tuple ? PyTuple_Size(args_names_tuple) : 0;
+    Py_ssize_t const args_count = positional_args_count + args_names_count;
+    if (args_count < 3 || args_count > 8) {
+        PyErr_Format(PyExc_TypeError, "Function expects 3-8 arguments, got %zd", args_count);
+        return NULL;
+    }
+    if (positional_args_count < 3 || positional_args_count > 4) {
+        PyErr_Format(PyExc_TypeError, "Expects 3 or 4 positional arguments, received %zd", positional_args_count);
+        return NULL;
+    }
+
+    // Positional-only arguments (queries, file path, and the number of neighbors)
+    a_obj = args[0];
+    path_obj = args[1];
+    k_obj = args[2];
+
+    // Positional or keyword arguments (metric)
+    if (positional_args_count == 4) metric_obj = args[3];
+
+    // The rest of the arguments must be checked in the keyword dictionary:
+    for (Py_ssize_t args_names_tuple_progress = 0, args_progress = positional_args_count;
+         args_names_tuple_progress < args_names_count; ++args_progress, ++args_names_tuple_progress) {
+        PyObject *const key = PyTuple_GetItem(args_names_tuple, args_names_tuple_progress);
+        PyObject *const value = args[args_progress];
+        if (PyUnicode_CompareWithASCIIString(key, "dtype") == 0 && !dtype_obj) { dtype_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "offset") == 0 && !offset_obj) { offset_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "stride") == 0 && !stride_obj) { stride_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "rows") == 0 && !rows_obj) { rows_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "metric") == 0 && !metric_obj) { metric_obj = value; }
+        else {
+            PyErr_Format(PyExc_TypeError, "Got unexpected keyword argument: %S", key);
+            return NULL;
+        }
+    }
+
+    // Convert `k_obj` to `k` integer
+    k = PyLong_AsSize_t(k_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'k' to be an unsigned integer");
+        return NULL;
+    }
+    if (k == 0) {
+        PyErr_SetString(PyExc_ValueError, "The number of neighbors 'k' must be positive");
+        return NULL;
+    }
+
+    // Convert `metric_obj` to `metric_kind`
+    if (metric_obj) {
+        char const *metric_str = PyUnicode_AsUTF8(metric_obj);
+        if (!metric_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'metric' to be a string");
+            return NULL;
+        }
+        metric_kind = python_string_to_metric_kind(metric_str);
+        if (metric_kind == simsimd_metric_unknown_k) {
+            PyErr_SetString(PyExc_LookupError, "Unsupported metric");
+            return NULL;
+        }
+    }
+
+    // Error will be set by the converter and by `parse_tensor` if the inputs are invalid
+    if (!PyUnicode_FSConverter(path_obj, &path_bytes)) return NULL;
+    char const *path = PyBytes_AsString(path_bytes);
+    if (!parse_tensor(a_obj, &a_buffer, &a_parsed)) goto cleanup;
+    if (a_parsed.count == 0) {
+        PyErr_SetString(PyExc_ValueError, "Collections can't be empty");
+        goto cleanup;
+    }
+
+    // Raw files are described by the arguments, while other files are described by their headers
+    if (dtype_obj) {
+        char const *dtype_str = PyUnicode_AsUTF8(dtype_obj);
+        if (!dtype_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'dtype' to be a string");
+            goto cleanup;
+        }
+        matrix.datatype = python_string_to_datatype(dtype_str);
+        if (matrix.datatype == simsimd_datatype_unknown_k) {
+            PyErr_SetString(PyExc_ValueError, "Unsupported 'dtype'");
+            goto cleanup;
+        }
+        matrix.dimensions = a_parsed.dimensions;
+        matrix.stride = a_parsed.dimensions * bytes_per_datatype(matrix.datatype);
+    }
+    else if (!simsimd_file_matrix_inspect(path, &matrix)) {
+        PyErr_Format(PyExc_ValueError, "Can't infer the layout of '%s', pass the 'dtype' of a raw file", path);
+        goto cleanup;
+    }
+    if (offset_obj) matrix.offset = PyLong_AsSize_t(offset_obj);
+    if (stride_obj) matrix.stride = PyLong_AsSize_t(stride_obj);
+    if (rows_obj) matrix.rows = PyLong_AsSize_t(rows_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'offset', 'stride', and 'rows' to be unsigned integers");
+        goto cleanup;
+    }
+    if (dtype_obj && !rows_obj) {
+        struct stat status;
+        if (stat(path, &status) != 0 || matrix.stride == 0) {
+            PyErr_Format(PyExc_FileNotFoundError, "Can't access '%s'", path);
+            goto cleanup;
+        }
+        matrix.rows = (size_t)status.st_size > matrix.offset ? ((size_t)status.st_size - matrix.offset) / matrix.stride
+                                                             : 0;
+    }
+
+    // Check dimensions and data types
+    if (a_parsed.dimensions != matrix.dimensions) {
+        PyErr_Format(PyExc_ValueError, "Vector dimensions don't match (%zu != %zu)", a_parsed.dimensions,
+                     (size_t)matrix.dimensions);
+        goto cleanup;
+    }
+    if (a_parsed.datatype != matrix.datatype) {
+        PyErr_Format(PyExc_TypeError, "Queries must match the '%s' datatype of the file",
+                     datatype_to_python_string(matrix.datatype));
+        goto cleanup;
+    }
+    if (is_complex(matrix.datatype)) {
+        PyErr_SetString(PyExc_TypeError, "Complex numbers can't be ranked, use real-valued inputs");
+        goto cleanup;
+    }
+
+    size_t const k_returned = k < matrix.rows ? k : matrix.rows;
+    size_t const rank = a_parsed.rank == 1 ? 1 : 2;
+    ids_obj = new_distances_tensor(simsimd_datatype_u64_k, rank, a_parsed.count, k_returned);
+    distances_obj = new_distances_tensor(simsimd_datatype_f64_k, rank, a_parsed.count, k_returned);
+    counts = (simsimd_size_t *)PyMem_RawMalloc(a_parsed.count * sizeof(simsimd_size_t));
+    if (!ids_obj || !distances_obj || !counts) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    // Reading the file dominates, so other Python threads can run meanwhile
+    simsimd_size_t *ids = (simsimd_size_t *)ids_obj->data;
+    simsimd_distance_t *distances = (simsimd_distance_t *)distances_obj->data;
+    int found;
+    Py_BEGIN_ALLOW_THREADS;
+    found = k_returned == 0 || simsimd_topk_file(metric_kind, a_parsed.start, a_parsed.count, a_parsed.stride, path,
+                                                 &matrix, k_returned, ids, distances, counts);
+    Py_END_ALLOW_THREADS;
+    if (!found) {
+        PyErr_Format(PyExc_OSError, "Failed to stream '%s' with the requested metric", path);
+        goto cleanup;
+    }
+
+    // Missing entries, like candidates with NaN distances, are marked with the largest identifier
+    for (size_t i = 0; i < a_parsed.count && k_returned; ++i)
+        for (size_t j = counts[i]; j < k_returned; ++j)
+            ids[i * k_returned + j] = (simsimd_size_t)-1, distances[i * k_returned + j] = NAN;
+    return_obj = PyTuple_Pack(2, (PyObject *)ids_obj, (PyObject *)distances_obj);
+
+cleanup:
+    PyMem_RawFree(counts);
+    Py_XDECREF(ids_obj);
+    Py_XDECREF(distances_obj);
+    Py_XDECREF(path_bytes);
+    PyBuffer_Release(&a_buffer);
+    return return_obj;
+}
+
+static char const doc_l2_pointer[] = "Get (int) pointer to the `simsimd.l2` kernel.";
+static PyObject *api_l2_pointer(PyObject *self, PyObject *dtype_obj) {
+    return implement_pointer_access(simsimd_metric_l2_k, dtype_obj);
+}
+static char const doc_l2sq_pointer[] = "Get (int) pointer to the `simsimd.l2sq` kernel.";
+static PyObject *api_l2sq_pointer(PyObject *self, PyObject *dtype_obj) {
+    return implement_pointer_access(simsimd_metric_l2sq_k, dtype_obj);
+}
+static char const doc_cos_pointer[] = "Get (int) pointer to the `simsimd.cos` kernel.";
+static PyObject *api_cos_pointer(PyObject *self, PyObject *dtype_obj) {
+    return implement_pointer_access(simsimd_metric_cos_k, dtype_obj);
+}
+static char const doc_dot_pointer[] = "Get (int) pointer to the `simsimd.dot` kernel.";
+static PyObject *api_dot_pointer(PyObject *self, PyObject *dtype_obj) {
+    return implement_pointer_access(simsimd_metric_dot_k, dtype_obj);
+}
+static char const doc_vdot_pointer[] = "Get (int) pointer to the `simsimd.vdot` kernel.";
+static PyObject *api_vdot_pointer(PyObject *self, PyObject *dtype_obj) {
     return implement_pointer_access(simsimd_metric_vdot_k, dtype_obj);
 }
 static char const doc_kl_pointer[] = "Get (int) pointer to the `simsimd.kl` kernel.";
@@ -1568,15 +3100,17 @@ static PyObject *api_mahalanobis(PyObject *self, PyObject *const *args, Py_ssize
 }
 
 static char const doc_intersect[] = //
-    "Compute the intersection of two sorted integer arrays.\n\n"
+    "Compute the intersection of two sorted integer arrays, or the dot product of two sparse vectors.\n\n"
     "Args:\n"
     "    a (NDArray): First sorted integer array.\n"
-    "    b (NDArray): Second sorted integer array.\n\n"
+    "    b (NDArray): Second sorted integer array.\n"
+    "    a_weights (NDArray, optional): Weights of the first array, as `int16`, `bf16`, or `float32`.\n"
+    "    b_weights (NDArray, optional): Weights of the second array, of the same type as `a_weights`.\n\n"
     "Returns:\n"
-    "    float: The number of intersecting elements.\n\n"
+    "    float: The number of intersecting elements, or the sum of products of their weights.\n\n"
     "Similar to: `numpy.intersect1d`."
     "Signature:\n"
-    "    >>> def intersect(a, b, /) -> float: ...";
+    "    >>> def intersect(a, b, a_weights=None, b_weights=None, /) -> float: ...";
 
 static PyObject *api_intersect(PyObject *self, PyObject *const *args, Py_ssize_t nargs) {
     return implement_sparse_metric(simsimd_metric_intersect_k, args, nargs);
@@ -1599,15 +3133,187 @@ static char const doc_fma[] = //
     "Signature:\n"
     "    >>> def fma(a, b, c, /, dtype, *, alpha, beta, out) -> Optional[DistancesTensor]: ...";
 
-static PyObject *api_fma(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
-                         PyObject *args_names_tuple) {
+static PyObject *api_fma(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                         PyObject *args_names_tuple) {
+
+    PyObject *return_obj = NULL;
+
+    // This function accepts up to 5 arguments:
+    PyObject *a_obj = NULL;     // Required object, positional-only
+    PyObject *b_obj = NULL;     // Required object, positional-only
+    PyObject *c_obj = NULL;     // Required object, positional-only
+    PyObject *dtype_obj = NULL; // Optional object, "dtype" keyword or positional
+    PyObject *out_obj = NULL;   // Optional object, "out" keyword-only
+    PyObject *alpha_obj = NULL; // Optional object, "alpha" keyword-only
+    PyObject *beta_obj = NULL;  // Optional object, "beta" keyword-only
+
+    // Once parsed, the arguments will be stored in these variables:
+    char const *dtype_str = NULL;
+    simsimd_datatype_t dtype = simsimd_datatype_unknown_k;
+    simsimd_distance_t alpha = 1, beta = 1;
+
+    Py_buffer a_buffer, b_buffer, c_buffer, out_buffer;
+    TensorArgument a_parsed, b_parsed, c_parsed, out_parsed;
+    memset(&a_buffer, 0, sizeof(Py_buffer));
+    memset(&b_buffer, 0, sizeof(Py_buffer));
+    memset(&c_buffer, 0, sizeof(Py_buffer));
+    memset(&out_buffer, 0, sizeof(Py_buffer));
+
+    Py_ssize_t const args_names_count = args_names_tuple ? PyTuple_Size(args_names_tuple) : 0;
+    Py_ssize_t const args_count = positional_args_count + args_names_count;
+    if (args_count < 3 || args_count > 7) {
+        PyErr_Format(PyExc_TypeError, "Function expects 3-7 arguments, got %zd", args_count);
+        return NULL;
+    }
+    if (positional_args_count > 4) {
+        PyErr_Format(PyExc_TypeError, "Only first 4 arguments can be positional, received %zd", positional_args_count);
+        return NULL;
+    }
+
+    // Positional-only arguments (first and second matrix)
+    a_obj = args[0];
+    b_obj = args[1];
+    c_obj = args[2];
+
+    // Positional or keyword arguments (dtype)
+    if (positional_args_count == 4) dtype_obj = args[3];
+
+    // The rest of the arguments must be checked in the keyword dictionary:
+    for (Py_ssize_t args_names_tuple_progress = 0, args_progress = positional_args_count;
+         args_names_tuple_progress < args_names_count; ++args_progress, ++args_names_tuple_progress) {
+        PyObject *const key = PyTuple_GetItem(args_names_tuple, args_names_tuple_progress);
+        PyObject *const value = args[args_progress];
+        if (PyUnicode_CompareWithASCIIString(key, "dtype") == 0 && !dtype_obj) { dtype_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "out") == 0 && !out_obj) { out_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "alpha") == 0 && !alpha_obj) { alpha_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "beta") == 0 && !beta_obj) { beta_obj = value; }
+        else {
+            PyErr_Format(PyExc_TypeError, "Got unexpected keyword argument: %S", key);
+            return NULL;
+        }
+    }
+
+    // Convert `dtype_obj` to `dtype_str` and to `dtype`
+    if (dtype_obj) {
+        dtype_str = PyUnicode_AsUTF8(dtype_obj);
+        if (!dtype_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'dtype' to be a string");
+            return NULL;
+        }
+        dtype = python_string_to_datatype(dtype_str);
+        if (dtype == simsimd_datatype_unknown_k) {
+            PyErr_SetString(PyExc_ValueError, "Unsupported 'dtype'");
+            return NULL;
+        }
+    }
+
+    // Convert `alpha_obj` to `alpha` and `beta_obj` to `beta`
+    if (alpha_obj) alpha = PyFloat_AsDouble(alpha_obj);
+    if (beta_obj) beta = PyFloat_AsDouble(beta_obj);
+    if (PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, "Expected 'alpha' and 'beta' to be a float");
+        return NULL;
+    }
+
+    // Convert `a_obj` to `a_buffer` and to `a_parsed`. Same for `b_obj` and `out_obj`.
+    if (!parse_tensor(a_obj, &a_buffer, &a_parsed) || !parse_tensor(b_obj, &b_buffer, &b_parsed) ||
+        !parse_tensor(c_obj, &c_buffer, &c_parsed))
+        return NULL;
+    if (out_obj && !parse_output_tensor(out_obj, &out_buffer, &out_parsed)) return NULL;
+
+    // Check dimensions
+    if (a_parsed.rank != 1 || b_parsed.rank != 1 || c_parsed.rank != 1 || (out_obj && out_parsed.rank != 1)) {
+        PyErr_SetString(PyExc_ValueError, "All tensors must be vectors");
+        goto cleanup;
+    }
+    if (a_parsed.dimensions != b_parsed.dimensions || a_parsed.dimensions != c_parsed.dimensions ||
+        (out_obj && a_parsed.dimensions != out_parsed.dimensions)) {
+        PyErr_SetString(PyExc_ValueError, "Vector dimensions don't match");
+        goto cleanup;
+    }
+
+    // Check data types
+    if (a_parsed.datatype != b_parsed.datatype || a_parsed.datatype == simsimd_datatype_unknown_k ||
+        b_parsed.datatype == simsimd_datatype_unknown_k || c_parsed.datatype == simsimd_datatype_unknown_k ||
+        (out_obj && out_parsed.datatype == simsimd_datatype_unknown_k)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "Input tensors must have matching datatypes, check with `X.__array_interface__`");
+        goto cleanup;
+    }
+    if (dtype == simsimd_datatype_unknown_k) dtype = a_parsed.datatype;
+
+    // Look up the metric in the dispatch table
+    simsimd_kernel_fma_punned_t metric = NULL;
+    simsimd_metric_kind_t const metric_kind = simsimd_metric_fma_k;
+    metric = (simsimd_kernel_fma_punned_t)simsimd_dispatch_table_find(&dispatch_table, metric_kind, dtype);
+    if (!metric) {
+        kernel_usage_record(metric_kind, dtype, 1, 0, 0);
+        PyErr_Format( //
+            PyExc_LookupError,
+            "Unsupported metric '%c' and datatype combination across vectors ('%s'/'%s') and "
+            "`dtype` override ('%s'/'%s')",
+            metric_kind,                                                                             //
+            a_buffer.format ? a_buffer.format : "nil", datatype_to_python_string(a_parsed.datatype), //
+            dtype_str ? dtype_str : "nil", datatype_to_python_string(dtype));
+        goto cleanup;
+    }
+
+    char *distances_start = NULL;
+    size_t distances_stride_bytes = 0;
+
+    // Allocate the output matrix if it wasn't provided
+    if (!out_obj) {
+        DistancesTensor *distances_obj = new_distances_tensor(dtype, 1, 1, a_parsed.dimensions);
+        if (!distances_obj) goto cleanup;
+        return_obj = (PyObject *)distances_obj;
+        distances_start = distances_obj->data;
+        distances_stride_bytes = distances_obj->strides[0];
+    }
+    else {
+        distances_start = (char *)&out_parsed.start[0];
+        distances_stride_bytes = out_buffer.strides[0];
+        //? Logic suggests to return `None` in in-place mode...
+        //? SciPy decided differently.
+        return_obj = Py_None;
+    }
+
+    simsimd_u64_t const usage_start = kernel_usage_start();
+    Py_BEGIN_ALLOW_THREADS;
+    metric(a_parsed.start, b_parsed.start, c_parsed.start, a_parsed.dimensions, alpha, beta, distances_start);
+    Py_END_ALLOW_THREADS;
+    kernel_usage_record(metric_kind, dtype, 1, a_buffer.len + b_buffer.len + c_buffer.len, usage_start);
+cleanup:
+    PyBuffer_Release(&a_buffer);
+    PyBuffer_Release(&b_buffer);
+    PyBuffer_Release(&c_buffer);
+    PyBuffer_Release(&out_buffer);
+    return return_obj;
+}
+
+static char const doc_wsum[] = //
+    "Weighted Sum of 2 input vectors.\n\n"
+    "Args:\n"
+    "    a (NDArray): First vector.\n"
+    "    b (NDArray): Second vector.\n"
+    "    dtype (Union[IntegralType, FloatType], optional): Override the presumed numeric type.\n"
+    "    alpha (float, optional): First scale, 1.0 by default.\n"
+    "    beta (float, optional): Second scale, 1.0 by default.\n"
+    "    out (NDArray, optional): Vector for resulting distances.\n\n"
+    "Returns:\n"
+    "    DistancesTensor: The distances if `out` is not provided.\n"
+    "    None: If `out` is provided. Operation will per performed in-place.\n\n"
+    "Equivalent to: `alpha * a + beta * b`.\n"
+    "Signature:\n"
+    "    >>> def wsum(a, b, /, dtype, *, alpha, beta, out) -> Optional[DistancesTensor]: ...";
+
+static PyObject *api_wsum(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                          PyObject *args_names_tuple) {
 
     PyObject *return_obj = NULL;
 
     // This function accepts up to 5 arguments:
     PyObject *a_obj = NULL;     // Required object, positional-only
     PyObject *b_obj = NULL;     // Required object, positional-only
-    PyObject *c_obj = NULL;     // Required object, positional-only
     PyObject *dtype_obj = NULL; // Optional object, "dtype" keyword or positional
     PyObject *out_obj = NULL;   // Optional object, "out" keyword-only
     PyObject *alpha_obj = NULL; // Optional object, "alpha" keyword-only
@@ -1618,31 +3324,29 @@ static PyObject *api_fma(PyObject *self, PyObject *const *args, Py_ssize_t const
     simsimd_datatype_t dtype = simsimd_datatype_unknown_k;
     simsimd_distance_t alpha = 1, beta = 1;
 
-    Py_buffer a_buffer, b_buffer, c_buffer, out_buffer;
-    TensorArgument a_parsed, b_parsed, c_parsed, out_parsed;
+    Py_buffer a_buffer, b_buffer, out_buffer;
+    TensorArgument a_parsed, b_parsed, out_parsed;
     memset(&a_buffer, 0, sizeof(Py_buffer));
     memset(&b_buffer, 0, sizeof(Py_buffer));
-    memset(&c_buffer, 0, sizeof(Py_buffer));
     memset(&out_buffer, 0, sizeof(Py_buffer));
 
     Py_ssize_t const args_names_count = args_names_tuple ? PyTuple_Size(args_names_tuple) : 0;
     Py_ssize_t const args_count = positional_args_count + args_names_count;
-    if (args_count < 3 || args_count > 7) {
-        PyErr_Format(PyExc_TypeError, "Function expects 3-7 arguments, got %zd", args_count);
+    if (args_count < 2 || args_count > 6) {
+        PyErr_Format(PyExc_TypeError, "Function expects 2-6 arguments, got %zd", args_count);
         return NULL;
     }
-    if (positional_args_count > 4) {
-        PyErr_Format(PyExc_TypeError, "Only first 4 arguments can be positional, received %zd", positional_args_count);
+    if (positional_args_count > 3) {
+        PyErr_Format(PyExc_TypeError, "Only first 3 arguments can be positional, received %zd", positional_args_count);
         return NULL;
     }
 
     // Positional-only arguments (first and second matrix)
     a_obj = args[0];
     b_obj = args[1];
-    c_obj = args[2];
 
     // Positional or keyword arguments (dtype)
-    if (positional_args_count == 4) dtype_obj = args[3];
+    if (positional_args_count == 3) dtype_obj = args[2];
 
     // The rest of the arguments must be checked in the keyword dictionary:
     for (Py_ssize_t args_names_tuple_progress = 0, args_progress = positional_args_count;
@@ -1682,25 +3386,22 @@ static PyObject *api_fma(PyObject *self, PyObject *const *args, Py_ssize_t const
     }
 
     // Convert `a_obj` to `a_buffer` and to `a_parsed`. Same for `b_obj` and `out_obj`.
-    if (!parse_tensor(a_obj, &a_buffer, &a_parsed) || !parse_tensor(b_obj, &b_buffer, &b_parsed) ||
-        !parse_tensor(c_obj, &c_buffer, &c_parsed))
-        return NULL;
-    if (out_obj && !parse_tensor(out_obj, &out_buffer, &out_parsed)) return NULL;
+    if (!parse_tensor(a_obj, &a_buffer, &a_parsed) || !parse_tensor(b_obj, &b_buffer, &b_parsed)) return NULL;
+    if (out_obj && !parse_output_tensor(out_obj, &out_buffer, &out_parsed)) return NULL;
 
     // Check dimensions
-    if (a_parsed.rank != 1 || b_parsed.rank != 1 || c_parsed.rank != 1 || (out_obj && out_parsed.rank != 1)) {
+    if (a_parsed.rank != 1 || b_parsed.rank != 1 || (out_obj && out_parsed.rank != 1)) {
         PyErr_SetString(PyExc_ValueError, "All tensors must be vectors");
         goto cleanup;
     }
-    if (a_parsed.dimensions != b_parsed.dimensions || a_parsed.dimensions != c_parsed.dimensions ||
-        (out_obj && a_parsed.dimensions != out_parsed.dimensions)) {
+    if (a_parsed.dimensions != b_parsed.dimensions || (out_obj && a_parsed.dimensions != out_parsed.dimensions)) {
         PyErr_SetString(PyExc_ValueError, "Vector dimensions don't match");
         goto cleanup;
     }
 
     // Check data types
     if (a_parsed.datatype != b_parsed.datatype || a_parsed.datatype == simsimd_datatype_unknown_k ||
-        b_parsed.datatype == simsimd_datatype_unknown_k || c_parsed.datatype == simsimd_datatype_unknown_k ||
+        b_parsed.datatype == simsimd_datatype_unknown_k ||
         (out_obj && out_parsed.datatype == simsimd_datatype_unknown_k)) {
         PyErr_SetString(PyExc_TypeError,
                         "Input tensors must have matching datatypes, check with `X.__array_interface__`");
@@ -1708,13 +3409,12 @@ static PyObject *api_fma(PyObject *self, PyObject *const *args, Py_ssize_t const
     }
     if (dtype == simsimd_datatype_unknown_k) dtype = a_parsed.datatype;
 
-    // Look up the metric and the capability
-    simsimd_kernel_fma_punned_t metric = NULL;
-    simsimd_capability_t capability = simsimd_cap_serial_k;
-    simsimd_metric_kind_t const metric_kind = simsimd_metric_fma_k;
-    simsimd_find_metric_punned(metric_kind, dtype, static_capabilities, simsimd_cap_any_k,
-                               (simsimd_metric_punned_t *)&metric, &capability);
+    // Look up the metric in the dispatch table
+    simsimd_kernel_wsum_punned_t metric = NULL;
+    simsimd_metric_kind_t const metric_kind = simsimd_metric_wsum_k;
+    metric = (simsimd_kernel_wsum_punned_t)simsimd_dispatch_table_find(&dispatch_table, metric_kind, dtype);
     if (!metric) {
+        kernel_usage_record(metric_kind, dtype, 1, 0, 0);
         PyErr_Format( //
             PyExc_LookupError,
             "Unsupported metric '%c' and datatype combination across vectors ('%s'/'%s') and "
@@ -1730,22 +3430,10 @@ static PyObject *api_fma(PyObject *self, PyObject *const *args, Py_ssize_t const
 
     // Allocate the output matrix if it wasn't provided
     if (!out_obj) {
-        DistancesTensor *distances_obj =
-            PyObject_NewVar(DistancesTensor, &DistancesTensorType, a_parsed.dimensions * bytes_per_datatype(dtype));
-        if (!distances_obj) {
-            PyErr_NoMemory();
-            goto cleanup;
-        }
-
-        // Initialize the object
-        distances_obj->datatype = dtype;
-        distances_obj->dimensions = 1;
-        distances_obj->shape[0] = a_parsed.dimensions;
-        distances_obj->shape[1] = 1;
-        distances_obj->strides[0] = bytes_per_datatype(dtype);
-        distances_obj->strides[1] = 0;
+        DistancesTensor *distances_obj = new_distances_tensor(dtype, 1, 1, a_parsed.dimensions);
+        if (!distances_obj) goto cleanup;
         return_obj = (PyObject *)distances_obj;
-        distances_start = (char *)&distances_obj->start[0];
+        distances_start = distances_obj->data;
         distances_stride_bytes = distances_obj->strides[0];
     }
     else {
@@ -1756,48 +3444,41 @@ static PyObject *api_fma(PyObject *self, PyObject *const *args, Py_ssize_t const
         return_obj = Py_None;
     }
 
-    metric(a_parsed.start, b_parsed.start, c_parsed.start, a_parsed.dimensions, alpha, beta, distances_start);
+    simsimd_u64_t const usage_start = kernel_usage_start();
+    Py_BEGIN_ALLOW_THREADS;
+    metric(a_parsed.start, b_parsed.start, a_parsed.dimensions, alpha, beta, distances_start);
+    Py_END_ALLOW_THREADS;
+    kernel_usage_record(metric_kind, dtype, 1, a_buffer.len + b_buffer.len, usage_start);
 cleanup:
     PyBuffer_Release(&a_buffer);
     PyBuffer_Release(&b_buffer);
-    PyBuffer_Release(&c_buffer);
     PyBuffer_Release(&out_buffer);
     return return_obj;
 }
 
-static char const doc_wsum[] = //
-    "Weighted Sum of 2 input vectors.\n\n"
-    "Args:\n"
-    "    a (NDArray): First vector.\n"
-    "    b (NDArray): Second vector.\n"
-    "    dtype (Union[IntegralType, FloatType], optional): Override the presumed numeric type.\n"
-    "    alpha (float, optional): First scale, 1.0 by default.\n"
-    "    beta (float, optional): Second scale, 1.0 by default.\n"
-    "    out (NDArray, optional): Vector for resulting distances.\n\n"
-    "Returns:\n"
-    "    DistancesTensor: The distances if `out` is not provided.\n"
-    "    None: If `out` is provided. Operation will per performed in-place.\n\n"
-    "Equivalent to: `alpha * a + beta * b`.\n"
-    "Signature:\n"
-    "    >>> def wsum(a, b, /, dtype, *, alpha, beta, out) -> Optional[DistancesTensor]: ...";
-
-static PyObject *api_wsum(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
-                          PyObject *args_names_tuple) {
+static PyObject *implement_elementwise( //
+    simsimd_metric_kind_t metric_kind,  //
+    PyObject *const *args, Py_ssize_t const positional_args_count, PyObject *args_names_tuple) {
 
     PyObject *return_obj = NULL;
 
-    // This function accepts up to 5 arguments:
+    // Addition and multiplication take two vectors, while scaling and conversions take one,
+    // and only the latter accept the `alpha` and `beta` keyword arguments.
+    int const is_binary = metric_kind == simsimd_metric_add_k || metric_kind == simsimd_metric_multiply_k;
+    int const is_conversion = metric_kind == simsimd_metric_quantize_k || metric_kind == simsimd_metric_dequantize_k;
+    Py_ssize_t const operands_count = is_binary ? 2 : 1;
+
     PyObject *a_obj = NULL;     // Required object, positional-only
-    PyObject *b_obj = NULL;     // Required object, positional-only
+    PyObject *b_obj = NULL;     // Required object for binary operations, positional-only
     PyObject *dtype_obj = NULL; // Optional object, "dtype" keyword or positional
     PyObject *out_obj = NULL;   // Optional object, "out" keyword-only
-    PyObject *alpha_obj = NULL; // Optional object, "alpha" keyword-only
-    PyObject *beta_obj = NULL;  // Optional object, "beta" keyword-only
+    PyObject *alpha_obj = NULL; // Optional object, "alpha" keyword-only, for unary operations
+    PyObject *beta_obj = NULL;  // Optional object, "beta" keyword-only, for scaling
 
     // Once parsed, the arguments will be stored in these variables:
     char const *dtype_str = NULL;
     simsimd_datatype_t dtype = simsimd_datatype_unknown_k;
-    simsimd_distance_t alpha = 1, beta = 1;
+    simsimd_distance_t alpha = 1, beta = 0;
 
     Py_buffer a_buffer, b_buffer, out_buffer;
     TensorArgument a_parsed, b_parsed, out_parsed;
@@ -1806,22 +3487,21 @@ static PyObject *api_wsum(PyObject *self, PyObject *const *args, Py_ssize_t cons
     memset(&out_buffer, 0, sizeof(Py_buffer));
 
     Py_ssize_t const args_names_count = args_names_tuple ? PyTuple_Size(args_names_tuple) : 0;
-    Py_ssize_t const args_count = positional_args_count + args_names_count;
-    if (args_count < 2 || args_count > 6) {
-        PyErr_Format(PyExc_TypeError, "Function expects 2-6 arguments, got %zd", args_count);
+    if (positional_args_count < operands_count) {
+        PyErr_Format(PyExc_TypeError, "Function expects %zd positional vectors, got %zd", operands_count,
+                     positional_args_count);
         return NULL;
     }
-    if (positional_args_count > 3) {
-        PyErr_Format(PyExc_TypeError, "Only first 3 arguments can be positional, received %zd", positional_args_count);
+    if (positional_args_count > operands_count + 1) {
+        PyErr_Format(PyExc_TypeError, "Only first %zd arguments can be positional, received %zd", operands_count + 1,
+                     positional_args_count);
         return NULL;
     }
 
-    // Positional-only arguments (first and second matrix)
+    // Positional-only arguments (the vectors), followed by an optional `dtype`
     a_obj = args[0];
-    b_obj = args[1];
-
-    // Positional or keyword arguments (dtype)
-    if (positional_args_count == 3) dtype_obj = args[2];
+    if (is_binary) b_obj = args[1];
+    if (positional_args_count == operands_count + 1) dtype_obj = args[operands_count];
 
     // The rest of the arguments must be checked in the keyword dictionary:
     for (Py_ssize_t args_names_tuple_progress = 0, args_progress = positional_args_count;
@@ -1830,8 +3510,13 @@ static PyObject *api_wsum(PyObject *self, PyObject *const *args, Py_ssize_t cons
         PyObject *const value = args[args_progress];
         if (PyUnicode_CompareWithASCIIString(key, "dtype") == 0 && !dtype_obj) { dtype_obj = value; }
         else if (PyUnicode_CompareWithASCIIString(key, "out") == 0 && !out_obj) { out_obj = value; }
-        else if (PyUnicode_CompareWithASCIIString(key, "alpha") == 0 && !alpha_obj) { alpha_obj = value; }
-        else if (PyUnicode_CompareWithASCIIString(key, "beta") == 0 && !beta_obj) { beta_obj = value; }
+        else if (PyUnicode_CompareWithASCIIString(key, "alpha") == 0 && !alpha_obj && !is_binary) {
+            alpha_obj = value;
+        }
+        else if (PyUnicode_CompareWithASCIIString(key, "beta") == 0 && !beta_obj &&
+                 metric_kind == simsimd_metric_scale_k) {
+            beta_obj = value;
+        }
         else {
             PyErr_Format(PyExc_TypeError, "Got unexpected keyword argument: %S", key);
             return NULL;
@@ -1851,6 +3536,10 @@ static PyObject *api_wsum(PyObject *self, PyObject *const *args, Py_ssize_t cons
             return NULL;
         }
     }
+    else if (metric_kind == simsimd_metric_quantize_k) {
+        PyErr_SetString(PyExc_TypeError, "Quantization requires the target 'dtype'");
+        return NULL;
+    }
 
     // Convert `alpha_obj` to `alpha` and `beta_obj` to `beta`
     if (alpha_obj) alpha = PyFloat_AsDouble(alpha_obj);
@@ -1861,39 +3550,44 @@ static PyObject *api_wsum(PyObject *self, PyObject *const *args, Py_ssize_t cons
     }
 
     // Convert `a_obj` to `a_buffer` and to `a_parsed`. Same for `b_obj` and `out_obj`.
-    if (!parse_tensor(a_obj, &a_buffer, &a_parsed) || !parse_tensor(b_obj, &b_buffer, &b_parsed)) return NULL;
-    if (out_obj && !parse_tensor(out_obj, &out_buffer, &out_parsed)) return NULL;
+    if (!parse_tensor(a_obj, &a_buffer, &a_parsed)) return NULL;
+    if (b_obj && !parse_tensor(b_obj, &b_buffer, &b_parsed)) goto cleanup;
+    if (out_obj && !parse_output_tensor(out_obj, &out_buffer, &out_parsed)) goto cleanup;
 
     // Check dimensions
-    if (a_parsed.rank != 1 || b_parsed.rank != 1 || (out_obj && out_parsed.rank != 1)) {
+    if (a_parsed.rank != 1 || (b_obj && b_parsed.rank != 1) || (out_obj && out_parsed.rank != 1)) {
         PyErr_SetString(PyExc_ValueError, "All tensors must be vectors");
         goto cleanup;
     }
-    if (a_parsed.dimensions != b_parsed.dimensions || (out_obj && a_parsed.dimensions != out_parsed.dimensions)) {
+    if (b_obj && a_parsed.dimensions != b_parsed.dimensions) {
         PyErr_SetString(PyExc_ValueError, "Vector dimensions don't match");
         goto cleanup;
     }
 
     // Check data types
-    if (a_parsed.datatype != b_parsed.datatype || a_parsed.datatype == simsimd_datatype_unknown_k ||
-        b_parsed.datatype == simsimd_datatype_unknown_k ||
-        (out_obj && out_parsed.datatype == simsimd_datatype_unknown_k)) {
+    if (a_parsed.datatype == simsimd_datatype_unknown_k || (b_obj && a_parsed.datatype != b_parsed.datatype)) {
         PyErr_SetString(PyExc_TypeError,
                         "Input tensors must have matching datatypes, check with `X.__array_interface__`");
         goto cleanup;
     }
+    if (metric_kind == simsimd_metric_quantize_k && a_parsed.datatype != simsimd_datatype_f32_k) {
+        PyErr_SetString(PyExc_TypeError, "Quantization expects a `float32` input vector");
+        goto cleanup;
+    }
     if (dtype == simsimd_datatype_unknown_k) dtype = a_parsed.datatype;
 
-    // Look up the metric and the capability
-    simsimd_kernel_wsum_punned_t metric = NULL;
-    simsimd_capability_t capability = simsimd_cap_serial_k;
-    simsimd_metric_kind_t const metric_kind = simsimd_metric_wsum_k;
-    simsimd_find_metric_punned(metric_kind, dtype, static_capabilities, simsimd_cap_any_k,
-                               (simsimd_metric_punned_t *)&metric, &capability);
-    if (!metric) {
+    // Conversions are keyed by their narrow side, and the other side is always `f32`.
+    // Bit-vectors pack 8 dimensions into every output byte.
+    simsimd_datatype_t const out_dtype = metric_kind == simsimd_metric_dequantize_k ? simsimd_datatype_f32_k : dtype;
+    size_t const out_count = out_dtype == simsimd_datatype_b8_k ? (a_parsed.dimensions + 7) / 8 : a_parsed.dimensions;
+
+    // Look up the kernel in the dispatch table
+    simsimd_metric_punned_t kernel = simsimd_dispatch_table_find(&dispatch_table, metric_kind, dtype);
+    if (!kernel) {
+        kernel_usage_record(metric_kind, dtype, 1, 0, 0);
         PyErr_Format( //
             PyExc_LookupError,
-            "Unsupported metric '%c' and datatype combination across vectors ('%s'/'%s') and "
+            "Unsupported operation '%c' and datatype combination across vectors ('%s'/'%s') and "
             "`dtype` override ('%s'/'%s')",
             metric_kind,                                                                             //
             a_buffer.format ? a_buffer.format : "nil", datatype_to_python_string(a_parsed.datatype), //
@@ -1901,38 +3595,37 @@ static PyObject *api_wsum(PyObject *self, PyObject *const *args, Py_ssize_t cons
         goto cleanup;
     }
 
-    char *distances_start = NULL;
-    size_t distances_stride_bytes = 0;
+    char *result_start = NULL;
 
-    // Allocate the output matrix if it wasn't provided
+    // Allocate the output vector if it wasn't provided
     if (!out_obj) {
-        DistancesTensor *distances_obj =
-            PyObject_NewVar(DistancesTensor, &DistancesTensorType, a_parsed.dimensions * bytes_per_datatype(dtype));
-        if (!distances_obj) {
-            PyErr_NoMemory();
-            goto cleanup;
-        }
-
-        // Initialize the object
-        distances_obj->datatype = dtype;
-        distances_obj->dimensions = 1;
-        distances_obj->shape[0] = a_parsed.dimensions;
-        distances_obj->shape[1] = 1;
-        distances_obj->strides[0] = bytes_per_datatype(dtype);
-        distances_obj->strides[1] = 0;
-        return_obj = (PyObject *)distances_obj;
-        distances_start = (char *)&distances_obj->start[0];
-        distances_stride_bytes = distances_obj->strides[0];
+        DistancesTensor *result_obj = new_distances_tensor(out_dtype, 1, 1, out_count);
+        if (!result_obj) goto cleanup;
+        return_obj = (PyObject *)result_obj;
+        result_start = result_obj->data;
     }
     else {
-        distances_start = (char *)&out_parsed.start[0];
-        distances_stride_bytes = out_buffer.strides[0];
-        //? Logic suggests to return `None` in in-place mode...
-        //? SciPy decided differently.
+        if (out_parsed.dimensions != out_count || out_buffer.itemsize != (Py_ssize_t)bytes_per_datatype(out_dtype)) {
+            PyErr_Format(PyExc_ValueError, "Output must be a vector of %zu '%s' scalars", out_count,
+                         datatype_to_python_string(out_dtype));
+            goto cleanup;
+        }
+        result_start = (char *)&out_parsed.start[0];
         return_obj = Py_None;
     }
 
-    metric(a_parsed.start, b_parsed.start, a_parsed.dimensions, alpha, beta, distances_start);
+    simsimd_u64_t const usage_start = kernel_usage_start();
+    Py_BEGIN_ALLOW_THREADS;
+    if (is_binary)
+        ((simsimd_kernel_elementwise_punned_t)kernel)(a_parsed.start, b_parsed.start, a_parsed.dimensions,
+                                                      result_start);
+    else if (is_conversion)
+        ((simsimd_kernel_convert_punned_t)kernel)(a_parsed.start, a_parsed.dimensions, alpha, result_start);
+    else
+        ((simsimd_kernel_scale_punned_t)kernel)(a_parsed.start, a_parsed.dimensions, alpha, beta, result_start);
+    Py_END_ALLOW_THREADS;
+    kernel_usage_record(metric_kind, dtype, 1, a_buffer.len + b_buffer.len, usage_start);
+
 cleanup:
     PyBuffer_Release(&a_buffer);
     PyBuffer_Release(&b_buffer);
@@ -1940,6 +3633,277 @@ cleanup:
     return return_obj;
 }
 
+static char const doc_scale[] = //
+    "Affine transformation of a vector.\n\n"
+    "Args:\n"
+    "    a (NDArray): Input vector.\n"
+    "    dtype (Union[IntegralType, FloatType], optional): Override the presumed numeric type.\n"
+    "    alpha (float, optional): Multiplier, 1.0 by default.\n"
+    "    beta (float, optional): Shift, 0.0 by default.\n"
+    "    out (NDArray, optional): Vector for the results, can be `a` itself.\n\n"
+    "Returns:\n"
+    "    DistancesTensor: The results if `out` is not provided.\n"
+    "    None: If `out` is provided. Operation will per performed in-place.\n\n"
+    "Equivalent to: `alpha * a + beta`.\n"
+    "Signature:\n"
+    "    >>> def scale(a, /, dtype, *, alpha, beta, out) -> Optional[DistancesTensor]: ...";
+
+static PyObject *api_scale(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                           PyObject *args_names_tuple) {
+    return implement_elementwise(simsimd_metric_scale_k, args, positional_args_count, args_names_tuple);
+}
+
+static char const doc_add[] = //
+    "Element-wise sum of 2 input vectors.\n\n"
+    "Args:\n"
+    "    a (NDArray): First vector.\n"
+    "    b (NDArray): Second vector.\n"
+    "    dtype (Union[IntegralType, FloatType], optional): Override the presumed numeric type.\n"
+    "    out (NDArray, optional): Vector for the results, can be `a` or `b`.\n\n"
+    "Returns:\n"
+    "    DistancesTensor: The results if `out` is not provided.\n"
+    "    None: If `out` is provided. Operation will per performed in-place.\n\n"
+    "Equivalent to: `a + b`, saturating for integers.\n"
+    "Signature:\n"
+    "    >>> def add(a, b, /, dtype, *, out) -> Optional[DistancesTensor]: ...";
+
+static PyObject *api_add(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                         PyObject *args_names_tuple) {
+    return implement_elementwise(simsimd_metric_add_k, args, positional_args_count, args_names_tuple);
+}
+
+static char const doc_multiply[] = //
+    "Element-wise product of 2 input vectors.\n\n"
+    "Args:\n"
+    "    a (NDArray): First vector.\n"
+    "    b (NDArray): Second vector.\n"
+    "    dtype (Union[IntegralType, FloatType], optional): Override the presumed numeric type.\n"
+    "    out (NDArray, optional): Vector for the results, can be `a` or `b`.\n\n"
+    "Returns:\n"
+    "    DistancesTensor: The results if `out` is not provided.\n"
+    "    None: If `out` is provided. Operation will per performed in-place.\n\n"
+    "Equivalent to: `a * b`, saturating for integers.\n"
+    "Signature:\n"
+    "    >>> def multiply(a, b, /, dtype, *, out) -> Optional[DistancesTensor]: ...";
+
+static PyObject *api_multiply(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                              PyObject *args_names_tuple) {
+    return implement_elementwise(simsimd_metric_multiply_k, args, positional_args_count, args_names_tuple);
+}
+
+static char const doc_quantize[] = //
+    "Quantize a `float32` vector into a narrower numeric type.\n\n"
+    "Args:\n"
+    "    a (NDArray): Input `float32` vector.\n"
+    "    dtype (Union[IntegralType, FloatType]): Target type - 'f16', 'bf16', 'i8', 'u8', or 'b8'.\n"
+    "    alpha (float, optional): Multiplier applied before rounding, 1.0 by default.\n"
+    "    out (NDArray, optional): Vector for the results.\n\n"
+    "Returns:\n"
+    "    DistancesTensor: The results if `out` is not provided.\n"
+    "    None: If `out` is provided. Operation will per performed in-place.\n\n"
+    "Integers are rounded to nearest and saturated, bits are set for positive `alpha * a`,\n"
+    "packing 8 dimensions per byte, most significant bit first, like `numpy.packbits`.\n"
+    "Signature:\n"
+    "    >>> def quantize(a, /, dtype, *, alpha, out) -> Optional[DistancesTensor]: ...";
+
+static PyObject *api_quantize(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                              PyObject *args_names_tuple) {
+    return implement_elementwise(simsimd_metric_quantize_k, args, positional_args_count, args_names_tuple);
+}
+
+static char const doc_dequantize[] = //
+    "Dequantize a narrow vector into `float32`.\n\n"
+    "Args:\n"
+    "    a (NDArray): Input vector of 'f16', 'bf16', 'i8', or 'u8' scalars.\n"
+    "    dtype (Union[IntegralType, FloatType], optional): Override the presumed numeric type.\n"
+    "    alpha (float, optional): Multiplier applied after conversion, 1.0 by default.\n"
+    "    out (NDArray, optional): Vector of `float32` scalars for the results.\n\n"
+    "Returns:\n"
+    "    DistancesTensor: The results if `out` is not provided.\n"
+    "    None: If `out` is provided. Operation will per performed in-place.\n\n"
+    "Equivalent to: `alpha * a.astype(numpy.float32)`.\n"
+    "Signature:\n"
+    "    >>> def dequantize(a, /, dtype, *, alpha, out) -> Optional[DistancesTensor]: ...";
+
+static PyObject *api_dequantize(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                                PyObject *args_names_tuple) {
+    return implement_elementwise(simsimd_metric_dequantize_k, args, positional_args_count, args_names_tuple);
+}
+
+static PyObject *implement_reduction( //
+    simsimd_metric_kind_t metric_kind, int return_indices,
+    PyObject *const *args, Py_ssize_t const positional_args_count, PyObject *args_names_tuple) {
+
+    PyObject *return_obj = NULL;
+    simsimd_distance_t *values = NULL;
+
+    PyObject *a_obj = NULL;     // Required object, positional-only
+    PyObject *dtype_obj = NULL; // Optional object, "dtype" keyword or positional
+
+    // Once parsed, the arguments will be stored in these variables:
+    char const *dtype_str = NULL;
+    simsimd_datatype_t dtype = simsimd_datatype_unknown_k;
+
+    Py_buffer a_buffer;
+    TensorArgument a_parsed;
+    memset(&a_buffer, 0, sizeof(Py_buffer));
+
+    Py_ssize_t const args_names_count = args_names_tuple ? PyTuple_Size(args_names_tuple) : 0;
+    if (positional_args_count < 1 || positional_args_count > 2) {
+        PyErr_Format(PyExc_TypeError, "Function expects a tensor and an optional 'dtype', got %zd positional arguments",
+                     positional_args_count);
+        return NULL;
+    }
+    a_obj = args[0];
+    if (positional_args_count == 2) dtype_obj = args[1];
+    for (Py_ssize_t args_names_tuple_progress = 0, args_progress = positional_args_count;
+         args_names_tuple_progress < args_names_count; ++args_progress, ++args_names_tuple_progress) {
+        PyObject *const key = PyTuple_GetItem(args_names_tuple, args_names_tuple_progress);
+        PyObject *const value = args[args_progress];
+        if (PyUnicode_CompareWithASCIIString(key, "dtype") == 0 && !dtype_obj) { dtype_obj = value; }
+        else {
+            PyErr_Format(PyExc_TypeError, "Got unexpected keyword argument: %S", key);
+            return NULL;
+        }
+    }
+
+    // Convert `dtype_obj` to `dtype_str` and to `dtype`
+    if (dtype_obj) {
+        dtype_str = PyUnicode_AsUTF8(dtype_obj);
+        if (!dtype_str && PyErr_Occurred()) {
+            PyErr_SetString(PyExc_TypeError, "Expected 'dtype' to be a string");
+            return NULL;
+        }
+        dtype = python_string_to_datatype(dtype_str);
+        if (dtype == simsimd_datatype_unknown_k) {
+            PyErr_SetString(PyExc_ValueError, "Unsupported 'dtype'");
+            return NULL;
+        }
+    }
+
+    if (!parse_tensor(a_obj, &a_buffer, &a_parsed)) return NULL;
+    if (dtype == simsimd_datatype_unknown_k) dtype = a_parsed.datatype;
+
+    simsimd_metric_punned_t kernel = simsimd_dispatch_table_find(&dispatch_table, metric_kind, dtype);
+    if (!kernel) {
+        kernel_usage_record(metric_kind, dtype, 1, 0, 0);
+        PyErr_Format( //
+            PyExc_LookupError,
+            "Unsupported reduction '%c' and datatype combination across tensors ('%s'/'%s') and "
+            "`dtype` override ('%s'/'%s')",
+            metric_kind,                                                                             //
+            a_buffer.format ? a_buffer.format : "nil", datatype_to_python_string(a_parsed.datatype), //
+            dtype_str ? dtype_str : "nil", datatype_to_python_string(dtype));
+        goto cleanup;
+    }
+
+    // Vectors are reduced into scalars, and matrices - into vectors with one entry per row
+    int const is_argreduce = metric_kind == simsimd_metric_reduce_min_k || metric_kind == simsimd_metric_reduce_max_k;
+    simsimd_distance_t value;
+    simsimd_size_t index;
+    simsimd_u64_t const usage_start = kernel_usage_start();
+    if (a_parsed.rank == 1) {
+        Py_BEGIN_ALLOW_THREADS;
+        if (is_argreduce)
+            ((simsimd_kernel_argreduce_punned_t)kernel)(a_parsed.start, 1, 0, a_parsed.dimensions, &value, &index);
+        else
+            ((simsimd_kernel_reduce_punned_t)kernel)(a_parsed.start, 1, 0, a_parsed.dimensions, &value);
+        Py_END_ALLOW_THREADS;
+        kernel_usage_record(metric_kind, dtype, 1, a_buffer.len, usage_start);
+        return_obj = return_indices ? PyLong_FromSize_t(index) : PyFloat_FromDouble(value);
+        goto cleanup;
+    }
+
+    DistancesTensor *result_obj = new_distances_tensor(
+        return_indices ? simsimd_datatype_u64_k : simsimd_datatype_f64_k, 1, a_parsed.count, 1);
+    if (!result_obj) goto cleanup;
+    if (is_argreduce && return_indices) {
+        values = (simsimd_distance_t *)PyMem_Malloc(a_parsed.count * sizeof(simsimd_distance_t));
+        if (!values) {
+            Py_DECREF(result_obj);
+            PyErr_NoMemory();
+            goto cleanup;
+        }
+    }
+    Py_BEGIN_ALLOW_THREADS;
+    if (!is_argreduce) {
+        ((simsimd_kernel_reduce_punned_t)kernel)(a_parsed.start, a_parsed.count, a_parsed.stride, a_parsed.dimensions,
+                                                 (simsimd_distance_t *)result_obj->data);
+    }
+    else if (!return_indices) {
+        ((simsimd_kernel_argreduce_punned_t)kernel)(a_parsed.start, a_parsed.count, a_parsed.stride,
+                                                    a_parsed.dimensions, (simsimd_distance_t *)result_obj->data,
+                                                    NULL);
+    }
+    else {
+        ((simsimd_kernel_argreduce_punned_t)kernel)(a_parsed.start, a_parsed.count, a_parsed.stride,
+                                                    a_parsed.dimensions, values,
+                                                    (simsimd_size_t *)result_obj->data);
+    }
+    Py_END_ALLOW_THREADS;
+    kernel_usage_record(metric_kind, dtype, 1, a_buffer.len, usage_start);
+    return_obj = (PyObject *)result_obj;
+
+cleanup:
+    PyMem_Free(values);
+    PyBuffer_Release(&a_buffer);
+    return return_obj;
+}
+
+#define SIMSIMD_REDUCTION_DOC(name, description, returns)                                          \
+    "Compute the " description " of a vector, or of every row of a matrix.\n\n"                    \
+    "Args:\n"                                                                                      \
+    "    a (NDArray): Input vector or matrix.\n"                                                   \
+    "    dtype (Union[IntegralType, FloatType], optional): Override the presumed numeric type.\n\n" \
+    "Returns:\n"                                                                                   \
+    "    " returns ": For a vector.\n"                                                             \
+    "    DistancesTensor: For a matrix, one entry per row.\n\n"                                    \
+    "Signature:\n"                                                                                 \
+    "    >>> def " name "(a, /, dtype) -> Union[" returns ", DistancesTensor]: ..."
+
+static char const doc_sum[] = SIMSIMD_REDUCTION_DOC("sum", "sum of elements", "float");
+static char const doc_l1norm[] = SIMSIMD_REDUCTION_DOC("l1norm", "sum of absolute values", "float");
+static char const doc_l2norm[] = SIMSIMD_REDUCTION_DOC("l2norm", "Euclidean norm", "float");
+static char const doc_min[] = SIMSIMD_REDUCTION_DOC("min", "minimum, skipping NaNs,", "float");
+static char const doc_max[] = SIMSIMD_REDUCTION_DOC("max", "maximum, skipping NaNs,", "float");
+static char const doc_argmin[] = SIMSIMD_REDUCTION_DOC("argmin", "index of the first minimum", "int");
+static char const doc_argmax[] = SIMSIMD_REDUCTION_DOC("argmax", "index of the first maximum", "int");
+
+static PyObject *api_sum(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                         PyObject *args_names_tuple) {
+    return implement_reduction(simsimd_metric_reduce_sum_k, 0, args, positional_args_count, args_names_tuple);
+}
+
+static PyObject *api_l1norm(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                            PyObject *args_names_tuple) {
+    return implement_reduction(simsimd_metric_reduce_l1_k, 0, args, positional_args_count, args_names_tuple);
+}
+
+static PyObject *api_l2norm(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                            PyObject *args_names_tuple) {
+    return implement_reduction(simsimd_metric_reduce_l2_k, 0, args, positional_args_count, args_names_tuple);
+}
+
+static PyObject *api_min(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                         PyObject *args_names_tuple) {
+    return implement_reduction(simsimd_metric_reduce_min_k, 0, args, positional_args_count, args_names_tuple);
+}
+
+static PyObject *api_max(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                         PyObject *args_names_tuple) {
+    return implement_reduction(simsimd_metric_reduce_max_k, 0, args, positional_args_count, args_names_tuple);
+}
+
+static PyObject *api_argmin(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                            PyObject *args_names_tuple) {
+    return implement_reduction(simsimd_metric_reduce_min_k, 1, args, positional_args_count, args_names_tuple);
+}
+
+static PyObject *api_argmax(PyObject *self, PyObject *const *args, Py_ssize_t const positional_args_count,
+                            PyObject *args_names_tuple) {
+    return implement_reduction(simsimd_metric_reduce_max_k, 1, args, positional_args_count, args_names_tuple);
+}
+
 // There are several flags we can use to define the functions:
 // - `METH_O`: Single object argument
 // - `METH_VARARGS`: Variable number of arguments
@@ -1952,6 +3916,9 @@ static PyMethodDef simsimd_methods[] = {
     {"get_capabilities", (PyCFunction)api_get_capabilities, METH_NOARGS, doc_get_capabilities},
     {"enable_capability", (PyCFunction)api_enable_capability, METH_O, doc_enable_capability},
     {"disable_capability", (PyCFunction)api_disable_capability, METH_O, doc_disable_capability},
+    {"configure_kernel_usage", (PyCFunction)api_configure_kernel_usage, METH_O, doc_configure_kernel_usage},
+    {"get_kernel_usage", (PyCFunction)api_get_kernel_usage, METH_NOARGS, doc_get_kernel_usage},
+    {"reset_kernel_usage", (PyCFunction)api_reset_kernel_usage, METH_NOARGS, doc_reset_kernel_usage},
 
     // NumPy and SciPy compatible interfaces for dense vector representations
     // Each function can compute distances between:
@@ -1978,6 +3945,12 @@ static PyMethodDef simsimd_methods[] = {
 
     // Conventional `cdist` interface for pairwise distances
     {"cdist", (PyCFunction)api_cdist, METH_FASTCALL | METH_KEYWORDS, doc_cdist},
+    {"pdist", (PyCFunction)api_pdist, METH_FASTCALL | METH_KEYWORDS, doc_pdist},
+    {"norms", (PyCFunction)api_norms, METH_O, doc_norms},
+
+    // Fused nearest-neighbors search, with distances never leaving the cache
+    {"topk", (PyCFunction)api_topk, METH_FASTCALL | METH_KEYWORDS, doc_topk},
+    {"topk_file", (PyCFunction)api_topk_file, METH_FASTCALL | METH_KEYWORDS, doc_topk_file},
 
     // Exposing underlying API for USearch `CompiledMetric`
     {"pointer_to_euclidean", (PyCFunction)api_l2_pointer, METH_O, doc_l2_pointer},
@@ -1999,6 +3972,20 @@ static PyMethodDef simsimd_methods[] = {
     // Vectorized operations
     {"fma", (PyCFunction)api_fma, METH_FASTCALL | METH_KEYWORDS, doc_fma},
     {"wsum", (PyCFunction)api_wsum, METH_FASTCALL | METH_KEYWORDS, doc_wsum},
+    {"scale", (PyCFunction)api_scale, METH_FASTCALL | METH_KEYWORDS, doc_scale},
+    {"add", (PyCFunction)api_add, METH_FASTCALL | METH_KEYWORDS, doc_add},
+    {"multiply", (PyCFunction)api_multiply, METH_FASTCALL | METH_KEYWORDS, doc_multiply},
+    {"quantize", (PyCFunction)api_quantize, METH_FASTCALL | METH_KEYWORDS, doc_quantize},
+    {"dequantize", (PyCFunction)api_dequantize, METH_FASTCALL | METH_KEYWORDS, doc_dequantize},
+
+    // Row-wise reductions
+    {"sum", (PyCFunction)api_sum, METH_FASTCALL | METH_KEYWORDS, doc_sum},
+    {"l1norm", (PyCFunction)api_l1norm, METH_FASTCALL | METH_KEYWORDS, doc_l1norm},
+    {"l2norm", (PyCFunction)api_l2norm, METH_FASTCALL | METH_KEYWORDS, doc_l2norm},
+    {"min", (PyCFunction)api_min, METH_FASTCALL | METH_KEYWORDS, doc_min},
+    {"max", (PyCFunction)api_max, METH_FASTCALL | METH_KEYWORDS, doc_max},
+    {"argmin", (PyCFunction)api_argmin, METH_FASTCALL | METH_KEYWORDS, doc_argmin},
+    {"argmax", (PyCFunction)api_argmax, METH_FASTCALL | METH_KEYWORDS, doc_argmax},
 
     // Sentinel
     {NULL, NULL, 0, NULL}};
@@ -2017,8 +4004,10 @@ static char const doc_module[] = //
     " - If you are only interested in relative proximity instead of the absolute distance\n"
     "   prefer simpler kernels, like the Squared Euclidean distance over the Euclidean distance.\n"
     " - Use row-major continuous matrix representations. Strides between rows won't have significant\n"
-    "   impact on performance, but most modern HPC packages explicitly ban non-contiguous rows,\n"
-    "   where the nearby matrix cells within a row have multi-byte gaps.\n"
+    "   impact on performance. Non-contiguous rows, where the nearby matrix cells within a row have\n"
+    "   multi-byte gaps, like column slices and transposed views, are packed into a temporary copy.\n"
+    " - The GIL is released during the computation, so independent calls from a thread pool\n"
+    "   can run concurrently.\n"
     " - The CPython runtime has a noticeable overhead for function calls, so consider batching\n"
     "   kernel invokations. Many kernels can compute not only 1-to-1 distance between vectors,\n"
     "   but also 1-to-N and N-to-N distances between two batches of vectors packed into matrices.\n"
@@ -2043,6 +4032,7 @@ PyMODINIT_FUNC PyInit_simsimd(void) {
     PyObject *m;
 
     if (PyType_Ready(&DistancesTensorType) < 0) return NULL;
+    if (PyType_Ready(&WorkspaceType) < 0) return NULL;
 
     m = PyModule_Create(&simsimd_module);
     if (m == NULL) return NULL;
@@ -2062,6 +4052,14 @@ PyMODINIT_FUNC PyInit_simsimd(void) {
         return NULL;
     }
 
+    Py_INCREF(&WorkspaceType);
+    if (PyModule_AddObject(m, "Workspace", (PyObject *)&WorkspaceType) < 0) {
+        Py_XDECREF(&WorkspaceType);
+        Py_XDECREF(m);
+        return NULL;
+    }
+
     static_capabilities = simsimd_capabilities();
+    simsimd_dispatch_table_init(&dispatch_table, static_capabilities, simsimd_cap_any_k);
     return m;
 }
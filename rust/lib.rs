@@ -46,8 +46,16 @@
 //! - `jensenshannon(a: &[Self], b: &[Self]) -> Option<Distance>`: Computes Jensen-Shannon divergence between two slices.
 //! - `kullbackleibler(a: &[Self], b: &[Self]) -> Option<Distance>`: Computes Kullback-Leibler divergence between two slices.
 //!
+//! The `BatchSimilarity` trait covers following methods, writing into caller-provided buffers:
+//!
+//! - `batch(metric, query, matrix, results) -> Option<()>`: Computes distances between one vector and every row of a matrix.
+//! - `cdist(metric, a, b, dimensions, results) -> Option<()>`: Computes distances between all pairs of rows of two matrices.
+//! - `topk(metric, queries, matrix, dimensions, k, ids, distances) -> Option<()>`: Finds the `k` nearest rows for every query.
+//!
 #![allow(non_camel_case_types)]
 
+use core::ffi::c_void;
+
 type Distance = f64;
 type ComplexProduct = (f64, f64);
 
@@ -93,6 +101,406 @@ extern "C" {
     fn simsimd_kl_f32(a: *const f32, b: *const f32, c: usize, d: *mut Distance);
     fn simsimd_kl_f64(a: *const f64, b: *const f64, c: usize, d: *mut Distance);
 
+    fn simsimd_dot_batch_i8(
+        a: *const i8,
+        b: *const i8,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_dot_batch_f16(
+        a: *const u16,
+        b: *const u16,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_dot_batch_bf16(
+        a: *const u16,
+        b: *const u16,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_dot_batch_f32(
+        a: *const f32,
+        b: *const f32,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_dot_batch_f64(
+        a: *const f64,
+        b: *const f64,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+
+    fn simsimd_cos_batch_i8(
+        a: *const i8,
+        b: *const i8,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_cos_batch_f16(
+        a: *const u16,
+        b: *const u16,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_cos_batch_bf16(
+        a: *const u16,
+        b: *const u16,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_cos_batch_f32(
+        a: *const f32,
+        b: *const f32,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_cos_batch_f64(
+        a: *const f64,
+        b: *const f64,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+
+    fn simsimd_l2sq_batch_i8(
+        a: *const i8,
+        b: *const i8,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_l2sq_batch_f16(
+        a: *const u16,
+        b: *const u16,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_l2sq_batch_bf16(
+        a: *const u16,
+        b: *const u16,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_l2sq_batch_f32(
+        a: *const f32,
+        b: *const f32,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_l2sq_batch_f64(
+        a: *const f64,
+        b: *const f64,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+
+    fn simsimd_l2_batch_i8(
+        a: *const i8,
+        b: *const i8,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_l2_batch_f16(
+        a: *const u16,
+        b: *const u16,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_l2_batch_bf16(
+        a: *const u16,
+        b: *const u16,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_l2_batch_f32(
+        a: *const f32,
+        b: *const f32,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_l2_batch_f64(
+        a: *const f64,
+        b: *const f64,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+
+    fn simsimd_hamming_batch_b8(
+        a: *const u8,
+        b: *const u8,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+    fn simsimd_jaccard_batch_b8(
+        a: *const u8,
+        b: *const u8,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+    );
+
+    fn simsimd_dot_cdist_i8(
+        a: *const i8,
+        b: *const i8,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_dot_cdist_f16(
+        a: *const u16,
+        b: *const u16,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_dot_cdist_bf16(
+        a: *const u16,
+        b: *const u16,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_dot_cdist_f32(
+        a: *const f32,
+        b: *const f32,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+
+    fn simsimd_cos_cdist_i8(
+        a: *const i8,
+        b: *const i8,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_cos_cdist_f16(
+        a: *const u16,
+        b: *const u16,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_cos_cdist_bf16(
+        a: *const u16,
+        b: *const u16,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_cos_cdist_f32(
+        a: *const f32,
+        b: *const f32,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+
+    fn simsimd_l2sq_cdist_i8(
+        a: *const i8,
+        b: *const i8,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_l2sq_cdist_f16(
+        a: *const u16,
+        b: *const u16,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_l2sq_cdist_bf16(
+        a: *const u16,
+        b: *const u16,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_l2sq_cdist_f32(
+        a: *const f32,
+        b: *const f32,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+
+    fn simsimd_l2_cdist_i8(
+        a: *const i8,
+        b: *const i8,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_l2_cdist_f16(
+        a: *const u16,
+        b: *const u16,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_l2_cdist_bf16(
+        a: *const u16,
+        b: *const u16,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_l2_cdist_f32(
+        a: *const f32,
+        b: *const f32,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+
+    fn simsimd_hamming_cdist_b8(
+        a: *const u8,
+        b: *const u8,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+    fn simsimd_jaccard_cdist_b8(
+        a: *const u8,
+        b: *const u8,
+        a_count: usize,
+        a_stride: usize,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        d: *mut Distance,
+        d_stride: usize,
+    );
+
+    fn simsimd_topk_cdist(
+        kind: u32,
+        datatype: u32,
+        queries: *const c_void,
+        queries_count: usize,
+        queries_stride: usize,
+        b: *const c_void,
+        b_count: usize,
+        b_stride: usize,
+        n: usize,
+        k: usize,
+        ids: *mut usize,
+        distances: *mut Distance,
+        counts: *mut usize,
+    ) -> i32;
+
     fn simsimd_uses_neon() -> i32;
     fn simsimd_uses_neon_f16() -> i32;
     fn simsimd_uses_neon_bf16() -> i32;
@@ -707,6 +1115,270 @@ impl ComplexProducts for f64 {
     }
 }
 
+/// Metrics supported by the one-to-many and many-to-many methods of `BatchSimilarity`.
+/// The discriminants match the metric kinds of the C library.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+#[repr(u32)]
+pub enum Metric {
+    /// Cosine distance, as in `SpatialSimilarity::cos`.
+    Cos = b'c' as u32,
+    /// Inner product, as in `SpatialSimilarity::dot`.
+    Dot = b'i' as u32,
+    /// Squared Euclidean distance, as in `SpatialSimilarity::l2sq`.
+    L2sq = b'e' as u32,
+    /// Euclidean distance.
+    L2 = b'2' as u32,
+    /// Hamming distance, as in `BinarySimilarity::hamming`.
+    Hamming = b'h' as u32,
+    /// Jaccard distance, as in `BinarySimilarity::jaccard`.
+    Jaccard = b'j' as u32,
+}
+
+/// `BatchSimilarity` provides one-to-many and many-to-many variants of the spatial and binary metrics.
+/// Matrices are row-major slices of `dimensions`-long vectors, and all results are written into
+/// caller-provided buffers, so that a single call across the FFI boundary covers thousands of distances.
+/// Large inputs are split between the threads of the C library, configured with `simsimd_set_threads`.
+///
+/// Every method returns `None` if the metric isn't defined for the scalar type, like `Metric::Hamming`
+/// for `f32`, if the lengths of the matrices aren't multiples of `dimensions`, or if the outputs are too short.
+pub trait BatchSimilarity
+where
+    Self: Sized,
+{
+    /// Computes the distances between the `query` and every row of the `matrix`,
+    /// exporting as many results as there are rows.
+    fn batch(
+        metric: Metric,
+        query: &[Self],
+        matrix: &[Self],
+        results: &mut [Distance],
+    ) -> Option<()>;
+
+    /// Computes the distances between every row of `a` and every row of `b`,
+    /// exporting them into a row-major `results` matrix with a row per vector of `a`.
+    fn cdist(
+        metric: Metric,
+        a: &[Self],
+        b: &[Self],
+        dimensions: usize,
+        results: &mut [Distance],
+    ) -> Option<()>;
+
+    /// Finds the `k` nearest rows of the `matrix` for every row of `queries`, without materializing
+    /// all the distances. The `ids` and `distances` of every query occupy `k` consecutive entries,
+    /// sorted from the best to the worst, and padded with `usize::MAX` and NaN if there are fewer
+    /// than `k` candidates. Inner products keep the largest scores, all other metrics the smallest.
+    fn topk(
+        metric: Metric,
+        queries: &[Self],
+        matrix: &[Self],
+        dimensions: usize,
+        k: usize,
+        ids: &mut [usize],
+        distances: &mut [Distance],
+    ) -> Option<()>;
+}
+
+type BatchKernel<T> = unsafe extern "C" fn(*const T, *const T, usize, usize, usize, *mut Distance);
+type CdistKernel<T> = unsafe extern "C" fn(
+    *const T,
+    *const T,
+    usize,
+    usize,
+    usize,
+    usize,
+    usize,
+    *mut Distance,
+    usize,
+);
+
+/// Validates the shapes of `a` and `b` matrices, returning their numbers of rows.
+fn batch_shapes<T>(a: &[T], b: &[T], dimensions: usize) -> Option<(usize, usize)> {
+    if dimensions == 0 || a.len() % dimensions != 0 || b.len() % dimensions != 0 {
+        return None;
+    }
+    Some((a.len() / dimensions, b.len() / dimensions))
+}
+
+fn batch_with<T, S>(
+    kernel: BatchKernel<S>,
+    query: &[T],
+    matrix: &[T],
+    results: &mut [Distance],
+) -> Option<()> {
+    let (_, rows) = batch_shapes(query, matrix, query.len())?;
+    if results.len() < rows {
+        return None;
+    }
+    let stride = query.len() * core::mem::size_of::<T>();
+    let (a, b) = (query.as_ptr() as *const S, matrix.as_ptr() as *const S);
+    unsafe { kernel(a, b, rows, stride, query.len(), results.as_mut_ptr()) };
+    Some(())
+}
+
+fn cdist_with<T, S>(
+    cdist: Option<CdistKernel<S>>,
+    batch: BatchKernel<S>,
+    a: &[T],
+    b: &[T],
+    dimensions: usize,
+    results: &mut [Distance],
+) -> Option<()> {
+    let (a_rows, b_rows) = batch_shapes(a, b, dimensions)?;
+    if results.len() < a_rows * b_rows {
+        return None;
+    }
+    let stride = dimensions * core::mem::size_of::<T>();
+    let (a_ptr, b_ptr) = (a.as_ptr() as *const S, b.as_ptr() as *const S);
+    match cdist {
+        Some(kernel) => unsafe {
+            let results_stride = b_rows * core::mem::size_of::<Distance>();
+            kernel(
+                a_ptr,
+                b_ptr,
+                a_rows,
+                stride,
+                b_rows,
+                stride,
+                dimensions,
+                results.as_mut_ptr(),
+                results_stride,
+            )
+        },
+        // Not every datatype has a dedicated many-to-many kernel, so we fall back to one batch per row
+        None => {
+            for (i, row) in results.chunks_mut(b_rows.max(1)).take(a_rows).enumerate() {
+                unsafe {
+                    batch(
+                        a_ptr.add(i * dimensions),
+                        b_ptr,
+                        b_rows,
+                        stride,
+                        dimensions,
+                        row.as_mut_ptr(),
+                    )
+                };
+            }
+        }
+    }
+    Some(())
+}
+
+fn topk_with<T>(
+    metric: Metric,
+    datatype: u32,
+    queries: &[T],
+    matrix: &[T],
+    dimensions: usize,
+    k: usize,
+    ids: &mut [usize],
+    distances: &mut [Distance],
+) -> Option<()> {
+    let (queries_count, rows) = batch_shapes(queries, matrix, dimensions)?;
+    if ids.len() < queries_count * k || distances.len() < queries_count * k {
+        return None;
+    }
+    let stride = dimensions * core::mem::size_of::<T>();
+    let mut counts = vec![0usize; queries_count];
+    let found = unsafe {
+        simsimd_topk_cdist(
+            metric as u32,
+            datatype,
+            queries.as_ptr() as *const c_void,
+            queries_count,
+            stride,
+            matrix.as_ptr() as *const c_void,
+            rows,
+            stride,
+            dimensions,
+            k,
+            ids.as_mut_ptr(),
+            distances.as_mut_ptr(),
+            counts.as_mut_ptr(),
+        )
+    };
+    if found == 0 {
+        return None;
+    }
+    for (query, &count) in counts.iter().enumerate() {
+        ids[query * k + count..(query + 1) * k].fill(usize::MAX);
+        distances[query * k + count..(query + 1) * k].fill(Distance::NAN);
+    }
+    Some(())
+}
+
+/// Implements `BatchSimilarity` for a scalar type, given its datatype in the C library,
+/// the scalar type of its kernels, and the kernels of every supported metric.
+macro_rules! impl_batch_similarity {
+    ($type:ty, $scalar:ty, $datatype:expr, [$($metric:ident => $batch:ident, $cdist:expr);* $(;)?]) => {
+        impl BatchSimilarity for $type {
+            fn batch(metric: Metric, query: &[Self], matrix: &[Self], results: &mut [Distance]) -> Option<()> {
+                match metric {
+                    $(Metric::$metric => batch_with::<Self, $scalar>($batch, query, matrix, results),)*
+                    _ => None,
+                }
+            }
+
+            fn cdist(metric: Metric, a: &[Self], b: &[Self], dimensions: usize, results: &mut [Distance]) -> Option<()> {
+                match metric {
+                    $(Metric::$metric => cdist_with::<Self, $scalar>($cdist, $batch, a, b, dimensions, results),)*
+                    _ => None,
+                }
+            }
+
+            fn topk(
+                metric: Metric,
+                queries: &[Self],
+                matrix: &[Self],
+                dimensions: usize,
+                k: usize,
+                ids: &mut [usize],
+                distances: &mut [Distance],
+            ) -> Option<()> {
+                match metric {
+                    $(Metric::$metric)|* => topk_with(metric, $datatype, queries, matrix, dimensions, k, ids, distances),
+                    _ => None,
+                }
+            }
+        }
+    };
+}
+
+impl_batch_similarity!(i8, i8, 1 << 2, [
+    Dot => simsimd_dot_batch_i8, Some(simsimd_dot_cdist_i8);
+    Cos => simsimd_cos_batch_i8, Some(simsimd_cos_cdist_i8);
+    L2sq => simsimd_l2sq_batch_i8, Some(simsimd_l2sq_cdist_i8);
+    L2 => simsimd_l2_batch_i8, Some(simsimd_l2_cdist_i8);
+]);
+impl_batch_similarity!(f16, u16, 1 << 12, [
+    Dot => simsimd_dot_batch_f16, Some(simsimd_dot_cdist_f16);
+    Cos => simsimd_cos_batch_f16, Some(simsimd_cos_cdist_f16);
+    L2sq => simsimd_l2sq_batch_f16, Some(simsimd_l2sq_cdist_f16);
+    L2 => simsimd_l2_batch_f16, Some(simsimd_l2_cdist_f16);
+]);
+impl_batch_similarity!(bf16, u16, 1 << 13, [
+    Dot => simsimd_dot_batch_bf16, Some(simsimd_dot_cdist_bf16);
+    Cos => simsimd_cos_batch_bf16, Some(simsimd_cos_cdist_bf16);
+    L2sq => simsimd_l2sq_batch_bf16, Some(simsimd_l2sq_cdist_bf16);
+    L2 => simsimd_l2_batch_bf16, Some(simsimd_l2_cdist_bf16);
+]);
+impl_batch_similarity!(f32, f32, 1 << 11, [
+    Dot => simsimd_dot_batch_f32, Some(simsimd_dot_cdist_f32);
+    Cos => simsimd_cos_batch_f32, Some(simsimd_cos_cdist_f32);
+    L2sq => simsimd_l2sq_batch_f32, Some(simsimd_l2sq_cdist_f32);
+    L2 => simsimd_l2_batch_f32, Some(simsimd_l2_cdist_f32);
+]);
+impl_batch_similarity!(f64, f64, 1 << 10, [
+    Dot => simsimd_dot_batch_f64, None;
+    Cos => simsimd_cos_batch_f64, None;
+    L2sq => simsimd_l2sq_batch_f64, None;
+    L2 => simsimd_l2_batch_f64, None;
+]);
+impl_batch_similarity!(u8, u8, 1 << 1, [
+    Hamming => simsimd_hamming_batch_b8, Some(simsimd_hamming_cdist_b8);
+    Jaccard => simsimd_jaccard_batch_b8, Some(simsimd_jaccard_cdist_b8);
+]);
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -990,4 +1662,99 @@ mod tests {
             assert_almost_equal(0.025, result, 0.01);
         }
     }
+
+    #[test]
+    fn test_batch_and_cdist_f32() {
+        let a = vec![1.0, 2.0, 3.0, 0.0, 1.0, 0.0];
+        let b = vec![4.0, 5.0, 6.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0];
+        let mut batch = vec![0.0; 3];
+        let mut cdist = vec![0.0; 6];
+
+        f32::batch(Metric::L2sq, &a[..3], &b, &mut batch).unwrap();
+        f32::cdist(Metric::L2sq, &a, &b, 3, &mut cdist).unwrap();
+        for (row, expected) in b.chunks(3).zip(batch.iter()) {
+            assert_almost_equal(f32::l2sq(&a[..3], row).unwrap(), *expected, 0.01);
+        }
+        for (i, query) in a.chunks(3).enumerate() {
+            for (j, row) in b.chunks(3).enumerate() {
+                assert_almost_equal(f32::l2sq(query, row).unwrap(), cdist[i * 3 + j], 0.01);
+            }
+        }
+
+        // Mismatched shapes and unsupported metrics are rejected
+        assert!(f32::cdist(Metric::Dot, &a, &b[..8], 3, &mut cdist).is_none());
+        assert!(f32::batch(Metric::Hamming, &a[..3], &b, &mut batch).is_none());
+    }
+
+    #[test]
+    fn test_cdist_f64_fallback() {
+        let a = vec![1.0, 2.0, 0.0, 1.0];
+        let b = vec![3.0, 4.0, 1.0, 0.0, 2.0, 2.0];
+        let mut cdist = vec![0.0; 6];
+
+        f64::cdist(Metric::Dot, &a, &b, 2, &mut cdist).unwrap();
+        for (i, query) in a.chunks(2).enumerate() {
+            for (j, row) in b.chunks(2).enumerate() {
+                assert_almost_equal(
+                    SpatialSimilarity::dot(query, row).unwrap(),
+                    cdist[i * 3 + j],
+                    0.01,
+                );
+            }
+        }
+    }
+
+    #[test]
+    fn test_topk_i8() {
+        let queries: Vec<i8> = vec![1, 2, 3, -3, -2, -1];
+        let matrix: Vec<i8> = vec![1, 2, 4, -3, -2, -2, 9, 9, 9, 1, 2, 3];
+        let mut ids = vec![0; 6];
+        let mut distances = vec![0.0; 6];
+
+        i8::topk(
+            Metric::L2sq,
+            &queries,
+            &matrix,
+            3,
+            3,
+            &mut ids,
+            &mut distances,
+        )
+        .unwrap();
+        assert_eq!(&ids, &[3, 0, 1, 1, 3, 0]);
+        for (i, query) in queries.chunks(3).enumerate() {
+            for j in 0..3 {
+                let row = &matrix[ids[i * 3 + j] * 3..ids[i * 3 + j] * 3 + 3];
+                assert_almost_equal(i8::l2sq(query, row).unwrap(), distances[i * 3 + j], 0.01);
+            }
+        }
+
+        // Missing entries are padded, when there are fewer candidates than requested
+        let mut ids = vec![0; 6];
+        let mut distances = vec![0.0; 6];
+        i8::topk(
+            Metric::Dot,
+            &queries[..3],
+            &matrix,
+            3,
+            6,
+            &mut ids,
+            &mut distances,
+        )
+        .unwrap();
+        assert_eq!(ids[0], 2);
+        assert_eq!(&ids[4..], &[usize::MAX, usize::MAX]);
+        assert!(distances[4].is_nan() && distances[5].is_nan());
+    }
+
+    #[test]
+    fn test_cdist_hamming_b8() {
+        let a: Vec<u8> = vec![0b1111_0000, 0b0000_0001];
+        let b: Vec<u8> = vec![0b1111_0000, 0b0000_0000, 0b0000_1111, 0b0000_0001];
+        let mut cdist = vec![0.0; 2];
+
+        u8::cdist(Metric::Hamming, &a, &b, 2, &mut cdist).unwrap();
+        assert_almost_equal(1.0, cdist[0], 0.01);
+        assert_almost_equal(8.0, cdist[1], 0.01);
+    }
 }
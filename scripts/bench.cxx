@@ -1,8 +1,9 @@
+#include <algorithm>     // `std::min`
 #include <cmath>         // `std::sqrt`
 #include <cstdlib>       // `std::aligned_alloc`
 #include <cstring>       // `std::memcpy`
 #include <random>        // `std::uniform_int_distribution`
-#include <thread>        // `std::thread`
+#include <thread>        // `std::thread::hardware_concurrency`
 #include <tuple>         // `std::tuple` for callable introspection
 #include <type_traits>   // ``
 #include <unordered_set> // `std::unordered_set`
@@ -34,6 +35,8 @@ constexpr simsimd_distance_t signaling_distance = std::numeric_limits<simsimd_di
 constexpr std::size_t dense_dimensions = 1536;
 /// Has quadratic impact on the number of operations
 constexpr std::size_t curved_dimensions = 128;
+/// Number of rows in each of the two matrices compared by many-to-many kernels
+constexpr std::size_t cdist_count = 256;
 
 namespace bm = benchmark;
 
@@ -567,6 +570,52 @@ void measure_fma(bm::State &state, kernel_at kernel, kernel_at baseline, l2_metr
     state.counters["pairs"] = bm::Counter(iterations, bm::Counter::kIsRate);
 }
 
+/**
+ *  @brief Measures the performance of a @b many-to-many metric function against a baseline using Google Benchmark.
+ *  @tparam datatype_ak The data type of the matrices elements, represented as a `simsimd_datatype_t`.
+ *  @tparam metric_at The type of the metric function (default is void).
+ *  @param state The benchmark state object provided by Google Benchmark.
+ *  @param metric The metric function to benchmark.
+ *  @param baseline The baseline function to compare against.
+ *  @param count The number of rows in each of the two matrices.
+ *  @param dimensions The number of dimensions in every row.
+ */
+template <simsimd_datatype_t datatype_ak, typename metric_at = void>
+void measure_cdist(bm::State &state, metric_at metric, metric_at baseline, std::size_t count, std::size_t dimensions) {
+
+    using vector_t = vector_gt<datatype_ak>;
+    using scalar_t = typename vector_t::scalar_t;
+    vector_t a(count * dimensions), b(count * dimensions);
+    a.randomize(1), b.randomize(54321u);
+
+    std::size_t const stride = dimensions * sizeof(scalar_t);
+    std::size_t const results_stride = count * sizeof(simsimd_distance_t);
+    std::vector<simsimd_distance_t> results_baseline(count * count, signaling_distance);
+    std::vector<simsimd_distance_t> results_contender(count * count, signaling_distance);
+    baseline(a.data(), b.data(), count, stride, count, stride, dimensions, results_baseline.data(), results_stride);
+
+    // The actual benchmarking loop.
+    std::size_t iterations = 0;
+    for (auto _ : state)
+        metric(a.data(), b.data(), count, stride, count, stride, dimensions, results_contender.data(), results_stride),
+            bm::DoNotOptimize(results_contender.data()), iterations++;
+
+    // Measure the mean absolute delta and relative error.
+    double mean_delta = 0, mean_relative_error = 0;
+    for (std::size_t i = 0; i != results_baseline.size(); ++i) {
+        auto abs_delta = std::abs(results_contender[i] - results_baseline[i]);
+        mean_delta += abs_delta;
+        double error = abs_delta != 0 && results_baseline[i] != 0 ? abs_delta / std::abs(results_baseline[i]) : 0;
+        mean_relative_error += error;
+    }
+    mean_delta /= results_baseline.size();
+    mean_relative_error /= results_baseline.size();
+    state.counters["abs_delta"] = mean_delta;
+    state.counters["relative_error"] = mean_relative_error;
+    state.counters["bytes"] = bm::Counter(iterations * a.size_bytes() * 2, bm::Counter::kIsRate);
+    state.counters["pairs"] = bm::Counter(iterations * count * count, bm::Counter::kIsRate);
+}
+
 template <simsimd_datatype_t datatype_ak, typename metric_at = void>
 void dense_(std::string name, metric_at *distance_func, metric_at *baseline_func) {
     using pair_t = vectors_pair_gt<datatype_ak>;
@@ -623,6 +672,342 @@ void curved_(std::string name, metric_at *distance_func, metric_at *baseline_fun
         ->Threads(default_threads);
 }
 
+template <simsimd_datatype_t datatype_ak, typename metric_at = void>
+void cdist_(std::string name, metric_at *distance_func, metric_at *baseline_func) {
+    std::string bench_name = name + "<" + std::to_string(cdist_count) + "x" + std::to_string(cdist_count) + "x" +
+                             std::to_string(dense_dimensions) + "d>";
+    bm::RegisterBenchmark(bench_name.c_str(), measure_cdist<datatype_ak, metric_at *>, distance_func, baseline_func,
+                          cdist_count, dense_dimensions)
+        ->MinTime(default_seconds)
+        ->Threads(default_threads);
+}
+
+/**
+ *  @brief Working sets of the scaling benchmarks, sized to fit into the L1, L2, and last-level caches
+ *         of most modern CPUs, or to spill into DRAM.
+ */
+struct working_set_t {
+    char const *name;
+    std::size_t bytes;
+};
+constexpr working_set_t scaling_working_sets[] = {
+    {"L1", 16 * 1024}, {"L2", 512 * 1024}, {"LLC", 16 * 1024 * 1024}, {"DRAM", 256 * 1024 * 1024}};
+/// Ranges from image descriptors to OpenAI embeddings
+constexpr std::size_t scaling_dimensions[] = {128, 1536};
+/// Number of queries compared with the working set in a single many-to-many or top-k call
+constexpr std::size_t scaling_queries[] = {16, 256};
+/// Number of nearest neighbors kept for every query
+constexpr std::size_t scaling_topk = 10;
+/// Larger distance matrices would measure the speed of writes rather than the kernels
+constexpr std::size_t scaling_max_output_bytes = 1024 * 1024 * 1024;
+
+/// Powers of two up to the number of hardware threads, followed by that number itself
+std::vector<std::size_t> scaling_threads() {
+    std::size_t const hardware_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    std::vector<std::size_t> threads;
+    for (std::size_t count = 1; count < hardware_threads; count *= 2) threads.push_back(count);
+    threads.push_back(hardware_threads);
+    return threads;
+}
+
+/**
+ *  @brief Library thread pool behind `simsimd_set_threads`, passed as a `simsimd_executor_punned_t` to the parallel
+ *         APIs. The calling thread takes tasks too, so the number of threads is exactly the number of cores doing
+ *         the work, and the workers are pinned to the CPUs of the process node by node.
+ */
+struct executor_t {
+    simsimd_executor_punned_t execute = nullptr;
+    void *state = nullptr;
+};
+
+/// Resizes the library pool, returning its executor, which is null for a single thread
+executor_t scaling_executor(std::size_t threads) {
+    executor_t executor;
+    simsimd_set_threads(threads, 1);
+    simsimd_get_executor(&executor.execute, &executor.state);
+    return executor;
+}
+
+/// Runs `count` tasks on the library pool, or on the calling thread if it has none
+void scaling_execute(executor_t const &executor, simsimd_task_punned_t task, void *context, std::size_t count) {
+    if (executor.execute) executor.execute(executor.state, task, context, count);
+    else
+        for (std::size_t i = 0; i != count; ++i) task(context, i);
+}
+
+/**
+ *  @brief Zero-fills the buffer in page-aligned slices across the pool, so that the OS backs every slice
+ *         with pages on the NUMA node of the worker touching it first, instead of the node of the thread
+ *         that generated the data.
+ */
+void scaling_first_touch(executor_t const &executor, void *data, std::size_t bytes, std::size_t threads) {
+    struct slices_t {
+        char *data;
+        std::size_t bytes, slice;
+    } slices {static_cast<char *>(data), bytes, divide_round_up<4096>(bytes / threads + 1)};
+    scaling_execute(
+        executor,
+        [](void *context, simsimd_size_t task) {
+            slices_t const &slices = *static_cast<slices_t const *>(context);
+            std::size_t const begin = std::min<std::size_t>(task * slices.slice, slices.bytes);
+            std::size_t const end = std::min<std::size_t>(begin + slices.slice, slices.bytes);
+            std::memset(slices.data + begin, 0, end - begin);
+        },
+        &slices, threads);
+}
+
+/**
+ *  @brief Reports the throughput of a scaling benchmark in a form suitable for a roofline chart:
+ *         the @b intensity is the number of arithmetic operations per byte of inputs and outputs,
+ *         and the attainable @b ops rate is the smaller of the compute peak and the product of the intensity
+ *         and the `bytes` rate of the `stream_read` benchmark in the same working set.
+ */
+void report_scaling(bm::State &state, std::size_t iterations, std::size_t pairs, std::size_t bytes,
+                    std::size_t dimensions) {
+    std::size_t const ops = pairs * dimensions * 2;
+    state.counters["bytes"] = bm::Counter(iterations * bytes, bm::Counter::kIsRate);
+    state.counters["pairs"] = bm::Counter(iterations * pairs, bm::Counter::kIsRate);
+    state.counters["ops"] = bm::Counter(iterations * ops, bm::Counter::kIsRate);
+    state.counters["intensity"] = static_cast<double>(ops) / bytes;
+}
+
+/**
+ *  @brief Measures the read bandwidth of a working set, the memory ceiling of the roofline,
+ *         searching one contiguous slice per thread for a missing byte with `std::memchr`,
+ *         which every mainstream C library vectorizes to be bound by the loads alone.
+ *  @param state The benchmark state object provided by Google Benchmark.
+ *  @param working_set The number of bytes to read on every iteration.
+ *  @param threads The number of threads in the pool.
+ */
+void measure_stream(bm::State &state, std::size_t working_set, std::size_t threads) {
+
+    struct stream_t {
+        simsimd_u8_t const *bytes;
+        std::size_t count_bytes, slice_bytes;
+        std::vector<void const *> matches;
+    };
+    executor_t executor = scaling_executor(threads);
+    vector_gt<simsimd_datatype_u8_k> bytes(working_set);
+    scaling_first_touch(executor, bytes.data(), bytes.size_bytes(), threads);
+    stream_t stream {bytes.data(), bytes.size_bytes(), divide_round_up<64>(bytes.size_bytes() / threads + 1),
+                     std::vector<void const *>(threads)};
+
+    simsimd_task_punned_t task = [](void *context, simsimd_size_t task) {
+        stream_t &stream = *static_cast<stream_t *>(context);
+        std::size_t const begin = std::min<std::size_t>(task * stream.slice_bytes, stream.count_bytes);
+        std::size_t const end = std::min<std::size_t>(begin + stream.slice_bytes, stream.count_bytes);
+        stream.matches[task] = std::memchr(stream.bytes + begin, 1, end - begin);
+    };
+
+    std::size_t iterations = 0;
+    for (auto _ : state)
+        scaling_execute(executor, task, &stream, threads), bm::DoNotOptimize(stream.matches.data()), iterations++;
+    state.counters["bytes"] = bm::Counter(iterations * bytes.size_bytes(), bm::Counter::kIsRate);
+}
+
+/**
+ *  @brief Measures a one-to-many @b batch kernel split across a thread pool with `simsimd_batch_parallel`.
+ *  @param state The benchmark state object provided by Google Benchmark.
+ *  @param metric The batch kernel to benchmark.
+ *  @param dimensions The number of dimensions in every row.
+ *  @param working_set The number of bytes in the candidate matrix.
+ *  @param threads The number of threads in the pool.
+ */
+template <simsimd_datatype_t datatype_ak>
+void measure_batch_scaling(bm::State &state, simsimd_metric_batch_punned_t metric, std::size_t dimensions,
+                           std::size_t working_set, std::size_t threads) {
+
+    using vector_t = vector_gt<datatype_ak>;
+    using scalar_t = typename vector_t::scalar_t;
+    std::size_t const stride = dimensions * sizeof(scalar_t);
+    std::size_t const count = std::max<std::size_t>(working_set / stride, 1);
+    executor_t executor = scaling_executor(threads);
+    vector_t a(dimensions), b(count * dimensions);
+    scaling_first_touch(executor, b.data(), b.size_bytes(), threads);
+    a.randomize(1), b.randomize(54321u);
+    std::vector<simsimd_distance_t> results(count, signaling_distance);
+
+    std::size_t iterations = 0;
+    for (auto _ : state)
+        simsimd_batch_parallel(metric, executor.execute, executor.state, a.data(), b.data(), count, stride,
+                               dimensions, results.data()),
+            bm::DoNotOptimize(results.data()), iterations++;
+    report_scaling(state, iterations, count,
+                   a.size_bytes() + b.size_bytes() + results.size() * sizeof(simsimd_distance_t), dimensions);
+}
+
+/**
+ *  @brief Measures a many-to-many @b cdist kernel split into tiles across a thread pool with
+ *         `simsimd_cdist_parallel`, comparing a block of queries with the whole working set.
+ *  @param state The benchmark state object provided by Google Benchmark.
+ *  @param metric The many-to-many kernel to benchmark.
+ *  @param queries The number of rows in the query block.
+ *  @param dimensions The number of dimensions in every row.
+ *  @param working_set The number of bytes in the candidate matrix.
+ *  @param threads The number of threads in the pool.
+ */
+template <simsimd_datatype_t datatype_ak>
+void measure_cdist_scaling(bm::State &state, simsimd_metric_cdist_punned_t metric, std::size_t queries,
+                           std::size_t dimensions, std::size_t working_set, std::size_t threads) {
+
+    using vector_t = vector_gt<datatype_ak>;
+    using scalar_t = typename vector_t::scalar_t;
+    std::size_t const stride = dimensions * sizeof(scalar_t);
+    std::size_t const count = std::max<std::size_t>(working_set / stride, 1);
+    executor_t executor = scaling_executor(threads);
+    vector_t a(queries * dimensions), b(count * dimensions);
+    scaling_first_touch(executor, b.data(), b.size_bytes(), threads);
+    a.randomize(1), b.randomize(54321u);
+    std::size_t const results_stride = count * sizeof(simsimd_distance_t);
+    std::vector<simsimd_distance_t> results(queries * count, signaling_distance);
+
+    std::size_t iterations = 0;
+    for (auto _ : state)
+        simsimd_cdist_parallel(metric, executor.execute, executor.state, a.data(), b.data(), queries, stride,
+                               count, stride, dimensions, results.data(), results_stride),
+            bm::DoNotOptimize(results.data()), iterations++;
+    report_scaling(state, iterations, queries * count,
+                   a.size_bytes() + b.size_bytes() + results.size() * sizeof(simsimd_distance_t), dimensions);
+}
+
+/**
+ *  @brief Measures a @b top-k search, scanning the whole working set for every query in a block,
+ *         with one task per query, like a k-NN query serving loop.
+ *  @param state The benchmark state object provided by Google Benchmark.
+ *  @param metric The pairwise kernel, used only if the batch kernel is missing.
+ *  @param batch The batch kernel, scoring candidates in chunks.
+ *  @param largest Non-zero to keep the largest scores, like for inner products.
+ *  @param queries The number of queries in the block.
+ *  @param dimensions The number of dimensions in every row.
+ *  @param working_set The number of bytes in the candidate matrix.
+ *  @param threads The number of threads in the pool.
+ */
+template <simsimd_datatype_t datatype_ak>
+void measure_topk_scaling(bm::State &state, simsimd_metric_punned_t metric, simsimd_metric_batch_punned_t batch,
+                          int largest, std::size_t queries, std::size_t dimensions, std::size_t working_set,
+                          std::size_t threads) {
+
+    using vector_t = vector_gt<datatype_ak>;
+    using scalar_t = typename vector_t::scalar_t;
+    struct search_t {
+        simsimd_metric_punned_t metric;
+        simsimd_metric_batch_punned_t batch;
+        int largest;
+        scalar_t const *a, *b;
+        std::size_t count, dimensions;
+        std::vector<simsimd_size_t> ids;
+        std::vector<simsimd_distance_t> distances;
+    };
+    std::size_t const stride = dimensions * sizeof(scalar_t);
+    std::size_t const count = std::max<std::size_t>(working_set / stride, 1);
+    executor_t executor = scaling_executor(threads);
+    vector_t a(queries * dimensions), b(count * dimensions);
+    scaling_first_touch(executor, b.data(), b.size_bytes(), threads);
+    a.randomize(1), b.randomize(54321u);
+    search_t search {metric, batch, largest, a.data(), b.data(), count, dimensions,
+                     std::vector<simsimd_size_t>(queries * scaling_topk),
+                     std::vector<simsimd_distance_t>(queries * scaling_topk)};
+
+    simsimd_task_punned_t task = [](void *context, simsimd_size_t query) {
+        search_t &search = *static_cast<search_t *>(context);
+        simsimd_size_t found = 0;
+        simsimd_size_t *ids = search.ids.data() + query * scaling_topk;
+        simsimd_distance_t *distances = search.distances.data() + query * scaling_topk;
+        simsimd_topk_scan(search.metric, search.batch, search.largest, search.a + query * search.dimensions,
+                          search.b, search.count, search.dimensions * sizeof(scalar_t), search.dimensions, 0,
+                          scaling_topk, &found, ids, distances);
+        simsimd_topk_sort(found, ids, distances, search.largest);
+    };
+
+    std::size_t iterations = 0;
+    for (auto _ : state)
+        scaling_execute(executor, task, &search, queries), bm::DoNotOptimize(search.ids.data()), iterations++;
+    report_scaling(state, iterations, queries * count, a.size_bytes() + queries * b.size_bytes(), dimensions);
+}
+
+std::string scaling_name(std::string const &name, working_set_t const &working_set, std::size_t dimensions,
+                         std::size_t queries, std::size_t threads) {
+    std::string bench_name = name + "<" + working_set.name + ",";
+    if (dimensions) bench_name += std::to_string(dimensions) + "d,";
+    if (queries) bench_name += std::to_string(queries) + "q,";
+    return bench_name + std::to_string(threads) + "t>";
+}
+
+void stream_scaling_() {
+    for (auto const &working_set : scaling_working_sets)
+        for (std::size_t threads : scaling_threads()) {
+            std::string bench_name = scaling_name("stream_read", working_set, 0, 0, threads);
+            bm::RegisterBenchmark(bench_name.c_str(), measure_stream, working_set.bytes, threads)
+                ->MinTime(default_seconds)
+                ->UseRealTime();
+        }
+}
+
+template <simsimd_datatype_t datatype_ak>
+void batch_scaling_(std::string name, simsimd_metric_batch_punned_t metric) {
+    for (auto const &working_set : scaling_working_sets)
+        for (std::size_t dimensions : scaling_dimensions)
+            for (std::size_t threads : scaling_threads()) {
+                std::string bench_name = scaling_name(name, working_set, dimensions, 0, threads);
+                bm::RegisterBenchmark(bench_name.c_str(), measure_batch_scaling<datatype_ak>, metric, dimensions,
+                                      working_set.bytes, threads)
+                    ->MinTime(default_seconds)
+                    ->UseRealTime();
+            }
+}
+
+template <simsimd_datatype_t datatype_ak>
+void cdist_scaling_(std::string name, simsimd_metric_cdist_punned_t metric) {
+    using scalar_t = typename vector_gt<datatype_ak>::scalar_t;
+    for (auto const &working_set : scaling_working_sets)
+        for (std::size_t dimensions : scaling_dimensions)
+            for (std::size_t queries : scaling_queries)
+                for (std::size_t threads : scaling_threads()) {
+                    std::size_t const count = working_set.bytes / (dimensions * sizeof(scalar_t));
+                    if (queries * count * sizeof(simsimd_distance_t) > scaling_max_output_bytes) continue;
+                    std::string bench_name = scaling_name(name, working_set, dimensions, queries, threads);
+                    bm::RegisterBenchmark(bench_name.c_str(), measure_cdist_scaling<datatype_ak>, metric, queries,
+                                          dimensions, working_set.bytes, threads)
+                        ->MinTime(default_seconds)
+                        ->UseRealTime();
+                }
+}
+
+template <simsimd_datatype_t datatype_ak>
+void topk_scaling_(std::string name, simsimd_metric_punned_t metric, simsimd_metric_batch_punned_t batch,
+                   int largest) {
+    for (auto const &working_set : scaling_working_sets)
+        for (std::size_t dimensions : scaling_dimensions)
+            for (std::size_t queries : scaling_queries)
+                for (std::size_t threads : scaling_threads()) {
+                    std::string bench_name = scaling_name(name, working_set, dimensions, queries, threads);
+                    bm::RegisterBenchmark(bench_name.c_str(), measure_topk_scaling<datatype_ak>, metric, batch,
+                                          largest, queries, dimensions, working_set.bytes, threads)
+                        ->MinTime(default_seconds)
+                        ->UseRealTime();
+                }
+}
+
+/**
+ *  @brief Registers the multi-threaded batch, many-to-many, and top-k sweeps for the best kernels
+ *         of a metric family available on this machine, as picked by the dynamic dispatch.
+ */
+template <simsimd_datatype_t datatype_ak>
+void scaling_(std::string name, std::string type_name, simsimd_metric_kind_t pairwise_kind,
+              simsimd_metric_kind_t batch_kind, simsimd_metric_kind_t cdist_kind, int largest,
+              simsimd_capability_t capabilities) {
+    simsimd_metric_punned_t metric = nullptr, batch = nullptr, cdist = nullptr;
+    simsimd_capability_t used = simsimd_cap_serial_k;
+    simsimd_find_metric_punned(pairwise_kind, datatype_ak, capabilities, simsimd_cap_any_k, &metric, &used);
+    simsimd_find_metric_punned(batch_kind, datatype_ak, capabilities, simsimd_cap_any_k, &batch, &used);
+    simsimd_find_metric_punned(cdist_kind, datatype_ak, capabilities, simsimd_cap_any_k, &cdist, &used);
+    if (batch) batch_scaling_<datatype_ak>(name + "_batch_" + type_name, (simsimd_metric_batch_punned_t)batch);
+    if (cdist) cdist_scaling_<datatype_ak>(name + "_cdist_" + type_name, (simsimd_metric_cdist_punned_t)cdist);
+    if (metric || batch)
+        topk_scaling_<datatype_ak>(name + "_topk_" + type_name, metric, (simsimd_metric_batch_punned_t)batch,
+                                   largest);
+}
+
 #if SIMSIMD_BUILD_BENCHMARKS_WITH_CBLAS
 
 void dot_f32_blas(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t n, simsimd_distance_t *result) {
@@ -655,6 +1040,20 @@ void vdot_f64c_blas(simsimd_f64_t const *a, simsimd_f64_t const *b, simsimd_size
     cblas_zdotc_sub((int)n / 2, a, 1, b, 1, result);
 }
 
+void dot_cdist_f32_blas(simsimd_f32_t const *a, simsimd_f32_t const *b, simsimd_size_t a_count,
+                        simsimd_size_t a_stride, simsimd_size_t b_count, simsimd_size_t b_stride, simsimd_size_t n,
+                        simsimd_distance_t *results, simsimd_size_t results_stride) {
+    // GEMM outputs single-precision values, so we upcast them into the shared output format
+    thread_local std::vector<simsimd_f32_t> f32_results;
+    f32_results.resize(a_count * b_count);
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasTrans, (int)a_count, (int)b_count, (int)n, 1.0f, a,
+                (int)(a_stride / sizeof(simsimd_f32_t)), b, (int)(b_stride / sizeof(simsimd_f32_t)), 0.0f,
+                f32_results.data(), (int)b_count);
+    for (std::size_t i = 0; i != a_count; ++i)
+        for (std::size_t j = 0; j != b_count; ++j)
+            results[i * results_stride / sizeof(simsimd_distance_t) + j] = f32_results[i * b_count + j];
+}
+
 #endif
 
 int main(int argc, char **argv) {
@@ -676,6 +1075,7 @@ int main(int argc, char **argv) {
     std::printf("- x86 Ice Lake support enabled: %s\n", flags[SIMSIMD_TARGET_ICE]);
     std::printf("- x86 Genoa support enabled: %s\n", flags[SIMSIMD_TARGET_GENOA]);
     std::printf("- x86 Sapphire Rapids support enabled: %s\n", flags[SIMSIMD_TARGET_SAPPHIRE]);
+    std::printf("- x86 Sapphire Rapids AMX support enabled: %s\n", flags[SIMSIMD_TARGET_SAPPHIRE_AMX]);
     std::printf("- x86 Turin support enabled: %s\n", flags[SIMSIMD_TARGET_TURIN]);
     std::printf("\n");
     std::printf("Run-time settings:\n");
@@ -693,6 +1093,8 @@ int main(int argc, char **argv) {
     std::printf("- x86 Ice Lake support enabled: %s\n", flags[(runtime_caps & simsimd_cap_ice_k) != 0]);
     std::printf("- x86 Genoa support enabled: %s\n", flags[(runtime_caps & simsimd_cap_genoa_k) != 0]);
     std::printf("- x86 Sapphire Rapids support enabled: %s\n", flags[(runtime_caps & simsimd_cap_sapphire_k) != 0]);
+    std::printf("- x86 Sapphire Rapids AMX support enabled: %s\n",
+                flags[(runtime_caps & simsimd_cap_sapphire_amx_k) != 0]);
     std::printf("- x86 Turin support enabled: %s\n", flags[(runtime_caps & simsimd_cap_turin_k) != 0]);
     std::printf("- x86 Sierra Forest support enabled: %s\n", flags[(runtime_caps & simsimd_cap_sierra_k) != 0]);
     std::printf("\n");
@@ -728,9 +1130,23 @@ int main(int argc, char **argv) {
     dense_<f64c_k>("dot_f64c_blas", dot_f64c_blas, simsimd_dot_f64c_serial);
     dense_<f32c_k>("vdot_f32c_blas", vdot_f32c_blas, simsimd_vdot_f32c_accurate);
     dense_<f64c_k>("vdot_f64c_blas", vdot_f64c_blas, simsimd_vdot_f64c_serial);
+    cdist_<f32_k>("dot_cdist_f32_blas", dot_cdist_f32_blas, simsimd_dot_cdist_f32_serial);
+    // Every tile is a separate GEMM call, so BLAS should be single-threaded, like `OPENBLAS_NUM_THREADS=1`
+    cdist_scaling_<f32_k>("dot_cdist_f32_blas", (simsimd_metric_cdist_punned_t)&dot_cdist_f32_blas);
 
 #endif
 
+    // Multi-threaded sweeps over thread counts and working sets in every level of the memory hierarchy
+    stream_scaling_();
+    scaling_<f32_k>("dot", "f32", simsimd_metric_dot_k, simsimd_metric_dot_batch_k, simsimd_metric_dot_cdist_k, 1,
+                    runtime_caps);
+    scaling_<f32_k>("l2sq", "f32", simsimd_metric_l2sq_k, simsimd_metric_l2sq_batch_k, simsimd_metric_l2sq_cdist_k, 0,
+                    runtime_caps);
+    scaling_<i8_k>("dot", "i8", simsimd_metric_dot_k, simsimd_metric_dot_batch_k, simsimd_metric_dot_cdist_k, 1,
+                   runtime_caps);
+    scaling_<i8_k>("l2sq", "i8", simsimd_metric_l2sq_k, simsimd_metric_l2sq_batch_k, simsimd_metric_l2sq_cdist_k, 0,
+                   runtime_caps);
+
 #if SIMSIMD_TARGET_NEON
     dense_<f32_k>("dot_f32_neon", simsimd_dot_f32_neon, simsimd_dot_f32_accurate);
     dense_<f32_k>("cos_f32_neon", simsimd_cos_f32_neon, simsimd_cos_f32_accurate);
@@ -770,6 +1186,23 @@ int main(int argc, char **argv) {
     fma_<f32_k>("fma_f32_serial", simsimd_fma_f32_serial, simsimd_fma_f32_accurate, simsimd_l2_f32_accurate);
     fma_<f32_k>("wsum_f32_serial", simsimd_wsum_f32_serial, simsimd_wsum_f32_accurate, simsimd_l2_f32_accurate);
 
+
+    cdist_<f32_k>("dot_cdist_f32_neon", simsimd_dot_cdist_f32_neon, simsimd_dot_cdist_f32_serial);
+    cdist_<f32_k>("cos_cdist_f32_neon", simsimd_cos_cdist_f32_neon, simsimd_cos_cdist_f32_serial);
+    cdist_<f32_k>("l2sq_cdist_f32_neon", simsimd_l2sq_cdist_f32_neon, simsimd_l2sq_cdist_f32_serial);
+    cdist_<f32_k>("l2_cdist_f32_neon", simsimd_l2_cdist_f32_neon, simsimd_l2_cdist_f32_serial);
+    cdist_<f16_k>("dot_cdist_f16_neon", simsimd_dot_cdist_f16_neon, simsimd_dot_cdist_f16_serial);
+    cdist_<f16_k>("cos_cdist_f16_neon", simsimd_cos_cdist_f16_neon, simsimd_cos_cdist_f16_serial);
+    cdist_<f16_k>("l2sq_cdist_f16_neon", simsimd_l2sq_cdist_f16_neon, simsimd_l2sq_cdist_f16_serial);
+    cdist_<f16_k>("l2_cdist_f16_neon", simsimd_l2_cdist_f16_neon, simsimd_l2_cdist_f16_serial);
+    cdist_<bf16_k>("dot_cdist_bf16_neon", simsimd_dot_cdist_bf16_neon, simsimd_dot_cdist_bf16_serial);
+    cdist_<bf16_k>("cos_cdist_bf16_neon", simsimd_cos_cdist_bf16_neon, simsimd_cos_cdist_bf16_serial);
+    cdist_<bf16_k>("l2sq_cdist_bf16_neon", simsimd_l2sq_cdist_bf16_neon, simsimd_l2sq_cdist_bf16_serial);
+    cdist_<bf16_k>("l2_cdist_bf16_neon", simsimd_l2_cdist_bf16_neon, simsimd_l2_cdist_bf16_serial);
+    cdist_<i8_k>("dot_cdist_i8_neon", simsimd_dot_cdist_i8_neon, simsimd_dot_cdist_i8_serial);
+    cdist_<i8_k>("cos_cdist_i8_neon", simsimd_cos_cdist_i8_neon, simsimd_cos_cdist_i8_serial);
+    cdist_<i8_k>("l2sq_cdist_i8_neon", simsimd_l2sq_cdist_i8_neon, simsimd_l2sq_cdist_i8_serial);
+    cdist_<i8_k>("l2_cdist_i8_neon", simsimd_l2_cdist_i8_neon, simsimd_l2_cdist_i8_serial);
 #endif
 
 #if SIMSIMD_TARGET_NEON_F16
@@ -839,6 +1272,19 @@ int main(int argc, char **argv) {
     dense_<f32c_k>("vdot_f32c_sve", simsimd_vdot_f32c_sve, simsimd_vdot_f32c_accurate);
     dense_<f64c_k>("dot_f64c_sve", simsimd_dot_f64c_sve, simsimd_dot_f64c_serial);
     dense_<f64c_k>("vdot_f64c_sve", simsimd_vdot_f64c_sve, simsimd_vdot_f64c_serial);
+
+    cdist_<f32_k>("dot_cdist_f32_sve", simsimd_dot_cdist_f32_sve, simsimd_dot_cdist_f32_serial);
+    cdist_<f32_k>("cos_cdist_f32_sve", simsimd_cos_cdist_f32_sve, simsimd_cos_cdist_f32_serial);
+    cdist_<f32_k>("l2sq_cdist_f32_sve", simsimd_l2sq_cdist_f32_sve, simsimd_l2sq_cdist_f32_serial);
+    cdist_<f32_k>("l2_cdist_f32_sve", simsimd_l2_cdist_f32_sve, simsimd_l2_cdist_f32_serial);
+    cdist_<f16_k>("dot_cdist_f16_sve", simsimd_dot_cdist_f16_sve, simsimd_dot_cdist_f16_serial);
+    cdist_<f16_k>("cos_cdist_f16_sve", simsimd_cos_cdist_f16_sve, simsimd_cos_cdist_f16_serial);
+    cdist_<f16_k>("l2sq_cdist_f16_sve", simsimd_l2sq_cdist_f16_sve, simsimd_l2sq_cdist_f16_serial);
+    cdist_<f16_k>("l2_cdist_f16_sve", simsimd_l2_cdist_f16_sve, simsimd_l2_cdist_f16_serial);
+    cdist_<bf16_k>("dot_cdist_bf16_sve", simsimd_dot_cdist_bf16_sve, simsimd_dot_cdist_bf16_serial);
+    cdist_<bf16_k>("cos_cdist_bf16_sve", simsimd_cos_cdist_bf16_sve, simsimd_cos_cdist_bf16_serial);
+    cdist_<bf16_k>("l2sq_cdist_bf16_sve", simsimd_l2sq_cdist_bf16_sve, simsimd_l2sq_cdist_bf16_serial);
+    cdist_<bf16_k>("l2_cdist_bf16_sve", simsimd_l2_cdist_bf16_sve, simsimd_l2_cdist_bf16_serial);
 #endif
 
 #if SIMSIMD_TARGET_SVE_F16
@@ -910,6 +1356,19 @@ int main(int argc, char **argv) {
     fma_<u8_k>("fma_u8_haswell", simsimd_fma_u8_haswell, simsimd_fma_u8_accurate, simsimd_l2_u8_serial);
     fma_<u8_k>("wsum_u8_haswell", simsimd_wsum_u8_haswell, simsimd_wsum_u8_accurate, simsimd_l2_u8_serial);
 
+
+    cdist_<f32_k>("dot_cdist_f32_haswell", simsimd_dot_cdist_f32_haswell, simsimd_dot_cdist_f32_serial);
+    cdist_<f32_k>("cos_cdist_f32_haswell", simsimd_cos_cdist_f32_haswell, simsimd_cos_cdist_f32_serial);
+    cdist_<f32_k>("l2sq_cdist_f32_haswell", simsimd_l2sq_cdist_f32_haswell, simsimd_l2sq_cdist_f32_serial);
+    cdist_<f32_k>("l2_cdist_f32_haswell", simsimd_l2_cdist_f32_haswell, simsimd_l2_cdist_f32_serial);
+    cdist_<f16_k>("dot_cdist_f16_haswell", simsimd_dot_cdist_f16_haswell, simsimd_dot_cdist_f16_serial);
+    cdist_<f16_k>("cos_cdist_f16_haswell", simsimd_cos_cdist_f16_haswell, simsimd_cos_cdist_f16_serial);
+    cdist_<f16_k>("l2sq_cdist_f16_haswell", simsimd_l2sq_cdist_f16_haswell, simsimd_l2sq_cdist_f16_serial);
+    cdist_<f16_k>("l2_cdist_f16_haswell", simsimd_l2_cdist_f16_haswell, simsimd_l2_cdist_f16_serial);
+    cdist_<bf16_k>("dot_cdist_bf16_haswell", simsimd_dot_cdist_bf16_haswell, simsimd_dot_cdist_bf16_serial);
+    cdist_<bf16_k>("cos_cdist_bf16_haswell", simsimd_cos_cdist_bf16_haswell, simsimd_cos_cdist_bf16_serial);
+    cdist_<bf16_k>("l2sq_cdist_bf16_haswell", simsimd_l2sq_cdist_bf16_haswell, simsimd_l2sq_cdist_bf16_serial);
+    cdist_<bf16_k>("l2_cdist_bf16_haswell", simsimd_l2_cdist_bf16_haswell, simsimd_l2_cdist_bf16_serial);
 #endif
 
 #if SIMSIMD_TARGET_GENOA
@@ -923,6 +1382,11 @@ int main(int argc, char **argv) {
 
     curved_<bf16_k>("bilinear_bf16_genoa", simsimd_bilinear_bf16_genoa, simsimd_bilinear_bf16_accurate);
     curved_<bf16_k>("mahalanobis_bf16_genoa", simsimd_mahalanobis_bf16_genoa, simsimd_mahalanobis_bf16_accurate);
+
+    cdist_<bf16_k>("dot_cdist_bf16_genoa", simsimd_dot_cdist_bf16_genoa, simsimd_dot_cdist_bf16_serial);
+    cdist_<bf16_k>("cos_cdist_bf16_genoa", simsimd_cos_cdist_bf16_genoa, simsimd_cos_cdist_bf16_serial);
+    cdist_<bf16_k>("l2sq_cdist_bf16_genoa", simsimd_l2sq_cdist_bf16_genoa, simsimd_l2sq_cdist_bf16_serial);
+    cdist_<bf16_k>("l2_cdist_bf16_genoa", simsimd_l2_cdist_bf16_genoa, simsimd_l2_cdist_bf16_serial);
 #endif
 
 #if SIMSIMD_TARGET_SAPPHIRE
@@ -942,6 +1406,18 @@ int main(int argc, char **argv) {
     fma_<i8_k>("wsum_i8_sapphire", simsimd_wsum_i8_sapphire, simsimd_wsum_i8_accurate, simsimd_l2_i8_serial);
 #endif
 
+#if SIMSIMD_TARGET_SAPPHIRE_AMX
+    cdist_<bf16_k>("dot_cdist_bf16_sapphire_amx", simsimd_dot_cdist_bf16_sapphire_amx, simsimd_dot_cdist_bf16_serial);
+    cdist_<bf16_k>("cos_cdist_bf16_sapphire_amx", simsimd_cos_cdist_bf16_sapphire_amx, simsimd_cos_cdist_bf16_serial);
+    cdist_<bf16_k>("l2sq_cdist_bf16_sapphire_amx", simsimd_l2sq_cdist_bf16_sapphire_amx,
+                   simsimd_l2sq_cdist_bf16_serial);
+    cdist_<bf16_k>("l2_cdist_bf16_sapphire_amx", simsimd_l2_cdist_bf16_sapphire_amx, simsimd_l2_cdist_bf16_serial);
+    cdist_<i8_k>("dot_cdist_i8_sapphire_amx", simsimd_dot_cdist_i8_sapphire_amx, simsimd_dot_cdist_i8_serial);
+    cdist_<i8_k>("cos_cdist_i8_sapphire_amx", simsimd_cos_cdist_i8_sapphire_amx, simsimd_cos_cdist_i8_serial);
+    cdist_<i8_k>("l2sq_cdist_i8_sapphire_amx", simsimd_l2sq_cdist_i8_sapphire_amx, simsimd_l2sq_cdist_i8_serial);
+    cdist_<i8_k>("l2_cdist_i8_sapphire_amx", simsimd_l2_cdist_i8_sapphire_amx, simsimd_l2_cdist_i8_serial);
+#endif
+
 #if SIMSIMD_TARGET_ICE
     dense_<i8_k>("cos_i8_ice", simsimd_cos_i8_ice, simsimd_cos_i8_serial);
     dense_<i8_k>("l2sq_i8_ice", simsimd_l2sq_i8_ice, simsimd_l2sq_i8_serial);
@@ -963,6 +1439,11 @@ int main(int argc, char **argv) {
 
     sparse_<u16_k>("intersect_u16_ice", simsimd_intersect_u16_ice, simsimd_intersect_u16_accurate);
     sparse_<u32_k>("intersect_u32_ice", simsimd_intersect_u32_ice, simsimd_intersect_u32_accurate);
+
+    cdist_<i8_k>("dot_cdist_i8_ice", simsimd_dot_cdist_i8_ice, simsimd_dot_cdist_i8_serial);
+    cdist_<i8_k>("cos_cdist_i8_ice", simsimd_cos_cdist_i8_ice, simsimd_cos_cdist_i8_serial);
+    cdist_<i8_k>("l2sq_cdist_i8_ice", simsimd_l2sq_cdist_i8_ice, simsimd_l2sq_cdist_i8_serial);
+    cdist_<i8_k>("l2_cdist_i8_ice", simsimd_l2_cdist_i8_ice, simsimd_l2_cdist_i8_serial);
 #endif
 
 #if SIMSIMD_TARGET_SKYLAKE
@@ -985,6 +1466,19 @@ int main(int argc, char **argv) {
     fma_<bf16_k>("fma_bf16_skylake", simsimd_fma_bf16_skylake, simsimd_fma_bf16_accurate, simsimd_l2_bf16_accurate);
     fma_<bf16_k>("wsum_bf16_skylake", simsimd_wsum_bf16_skylake, simsimd_wsum_bf16_accurate, simsimd_l2_bf16_accurate);
 
+
+    cdist_<f32_k>("dot_cdist_f32_skylake", simsimd_dot_cdist_f32_skylake, simsimd_dot_cdist_f32_serial);
+    cdist_<f32_k>("cos_cdist_f32_skylake", simsimd_cos_cdist_f32_skylake, simsimd_cos_cdist_f32_serial);
+    cdist_<f32_k>("l2sq_cdist_f32_skylake", simsimd_l2sq_cdist_f32_skylake, simsimd_l2sq_cdist_f32_serial);
+    cdist_<f32_k>("l2_cdist_f32_skylake", simsimd_l2_cdist_f32_skylake, simsimd_l2_cdist_f32_serial);
+    cdist_<f16_k>("dot_cdist_f16_skylake", simsimd_dot_cdist_f16_skylake, simsimd_dot_cdist_f16_serial);
+    cdist_<f16_k>("cos_cdist_f16_skylake", simsimd_cos_cdist_f16_skylake, simsimd_cos_cdist_f16_serial);
+    cdist_<f16_k>("l2sq_cdist_f16_skylake", simsimd_l2sq_cdist_f16_skylake, simsimd_l2sq_cdist_f16_serial);
+    cdist_<f16_k>("l2_cdist_f16_skylake", simsimd_l2_cdist_f16_skylake, simsimd_l2_cdist_f16_serial);
+    cdist_<bf16_k>("dot_cdist_bf16_skylake", simsimd_dot_cdist_bf16_skylake, simsimd_dot_cdist_bf16_serial);
+    cdist_<bf16_k>("cos_cdist_bf16_skylake", simsimd_cos_cdist_bf16_skylake, simsimd_cos_cdist_bf16_serial);
+    cdist_<bf16_k>("l2sq_cdist_bf16_skylake", simsimd_l2sq_cdist_bf16_skylake, simsimd_l2sq_cdist_bf16_serial);
+    cdist_<bf16_k>("l2_cdist_bf16_skylake", simsimd_l2_cdist_bf16_skylake, simsimd_l2_cdist_bf16_serial);
 #endif
 
     sparse_<u16_k>("intersect_u16_serial", simsimd_intersect_u16_serial, simsimd_intersect_u16_accurate);
@@ -1001,6 +1495,23 @@ int main(int argc, char **argv) {
     curved_<bf16_k>("bilinear_bf16_serial", simsimd_bilinear_bf16_serial, simsimd_bilinear_bf16_accurate);
     curved_<bf16_k>("mahalanobis_bf16_serial", simsimd_mahalanobis_bf16_serial, simsimd_mahalanobis_bf16_accurate);
 
+    cdist_<f32_k>("dot_cdist_f32_serial", simsimd_dot_cdist_f32_serial, simsimd_dot_cdist_f32_serial);
+    cdist_<f32_k>("cos_cdist_f32_serial", simsimd_cos_cdist_f32_serial, simsimd_cos_cdist_f32_serial);
+    cdist_<f32_k>("l2sq_cdist_f32_serial", simsimd_l2sq_cdist_f32_serial, simsimd_l2sq_cdist_f32_serial);
+    cdist_<f32_k>("l2_cdist_f32_serial", simsimd_l2_cdist_f32_serial, simsimd_l2_cdist_f32_serial);
+    cdist_<f16_k>("dot_cdist_f16_serial", simsimd_dot_cdist_f16_serial, simsimd_dot_cdist_f16_serial);
+    cdist_<f16_k>("cos_cdist_f16_serial", simsimd_cos_cdist_f16_serial, simsimd_cos_cdist_f16_serial);
+    cdist_<f16_k>("l2sq_cdist_f16_serial", simsimd_l2sq_cdist_f16_serial, simsimd_l2sq_cdist_f16_serial);
+    cdist_<f16_k>("l2_cdist_f16_serial", simsimd_l2_cdist_f16_serial, simsimd_l2_cdist_f16_serial);
+    cdist_<bf16_k>("dot_cdist_bf16_serial", simsimd_dot_cdist_bf16_serial, simsimd_dot_cdist_bf16_serial);
+    cdist_<bf16_k>("cos_cdist_bf16_serial", simsimd_cos_cdist_bf16_serial, simsimd_cos_cdist_bf16_serial);
+    cdist_<bf16_k>("l2sq_cdist_bf16_serial", simsimd_l2sq_cdist_bf16_serial, simsimd_l2sq_cdist_bf16_serial);
+    cdist_<bf16_k>("l2_cdist_bf16_serial", simsimd_l2_cdist_bf16_serial, simsimd_l2_cdist_bf16_serial);
+    cdist_<i8_k>("dot_cdist_i8_serial", simsimd_dot_cdist_i8_serial, simsimd_dot_cdist_i8_serial);
+    cdist_<i8_k>("cos_cdist_i8_serial", simsimd_cos_cdist_i8_serial, simsimd_cos_cdist_i8_serial);
+    cdist_<i8_k>("l2sq_cdist_i8_serial", simsimd_l2sq_cdist_i8_serial, simsimd_l2sq_cdist_i8_serial);
+    cdist_<i8_k>("l2_cdist_i8_serial", simsimd_l2_cdist_i8_serial, simsimd_l2_cdist_i8_serial);
+
     dense_<bf16_k>("dot_bf16_serial", simsimd_dot_bf16_serial, simsimd_dot_bf16_accurate);
     dense_<bf16_k>("cos_bf16_serial", simsimd_cos_bf16_serial, simsimd_cos_bf16_accurate);
     dense_<bf16_k>("l2sq_bf16_serial", simsimd_l2sq_bf16_serial, simsimd_l2sq_bf16_accurate);
@@ -6,6 +6,7 @@
 #include <assert.h> // `assert`
 #include <math.h>   // `sqrtf`
 #include <stdio.h>  // `printf`
+#include <string.h> // `memcmp`
 
 #define SIMSIMD_NATIVE_F16 0
 #define SIMSIMD_NATIVE_BF16 0
@@ -27,11 +28,13 @@ void print_capabilities(void) {
     printf("- Arm NEON support enabled: %s\n", flags[SIMSIMD_TARGET_NEON]);
     printf("- Arm SVE support enabled: %s\n", flags[SIMSIMD_TARGET_SVE]);
     printf("- Arm SVE2 support enabled: %s\n", flags[SIMSIMD_TARGET_SVE2]);
+    printf("- Arm SVE2.1 support enabled: %s\n", flags[SIMSIMD_TARGET_SVE2P1]);
     printf("- x86 Haswell support enabled: %s\n", flags[SIMSIMD_TARGET_HASWELL]);
     printf("- x86 Skylake support enabled: %s\n", flags[SIMSIMD_TARGET_SKYLAKE]);
     printf("- x86 Ice Lake support enabled: %s\n", flags[SIMSIMD_TARGET_ICE]);
     printf("- x86 Genoa support enabled: %s\n", flags[SIMSIMD_TARGET_GENOA]);
     printf("- x86 Sapphire Rapids support enabled: %s\n", flags[SIMSIMD_TARGET_SAPPHIRE]);
+    printf("- x86 Sapphire Rapids AMX support enabled: %s\n", flags[SIMSIMD_TARGET_SAPPHIRE_AMX]);
     printf("- x86 Turin support enabled: %s\n", flags[SIMSIMD_TARGET_TURIN]);
     printf("- x86 Sierra Forest support enabled: %s\n", flags[SIMSIMD_TARGET_SIERRA]);
     printf("\n");
@@ -45,11 +48,14 @@ void print_capabilities(void) {
     printf("- Arm SVE BF16 support enabled: %s\n", flags[(runtime_caps & simsimd_cap_sve_bf16_k) != 0]);
     printf("- Arm SVE I8 support enabled: %s\n", flags[(runtime_caps & simsimd_cap_sve_i8_k) != 0]);
     printf("- Arm SVE2 support enabled: %s\n", flags[(runtime_caps & simsimd_cap_sve2_k) != 0]);
+    printf("- Arm SVE2.1 support enabled: %s\n", flags[(runtime_caps & simsimd_cap_sve2p1_k) != 0]);
     printf("- x86 Haswell support enabled: %s\n", flags[(runtime_caps & simsimd_cap_haswell_k) != 0]);
     printf("- x86 Skylake support enabled: %s\n", flags[(runtime_caps & simsimd_cap_skylake_k) != 0]);
     printf("- x86 Ice Lake support enabled: %s\n", flags[(runtime_caps & simsimd_cap_ice_k) != 0]);
     printf("- x86 Genoa support enabled: %s\n", flags[(runtime_caps & simsimd_cap_genoa_k) != 0]);
     printf("- x86 Sapphire Rapids support enabled: %s\n", flags[(runtime_caps & simsimd_cap_sapphire_k) != 0]);
+    printf("- x86 Sapphire Rapids AMX support enabled: %s\n",
+           flags[(runtime_caps & simsimd_cap_sapphire_amx_k) != 0]);
     printf("- x86 Turin support enabled: %s\n", flags[(runtime_caps & simsimd_cap_turin_k) != 0]);
     printf("\n");
 }
@@ -67,6 +73,7 @@ void test_utilities(void) {
     int uses_ice = simsimd_uses_ice();
     int uses_genoa = simsimd_uses_genoa();
     int uses_sapphire = simsimd_uses_sapphire();
+    int uses_sapphire_amx = simsimd_uses_sapphire_amx();
     int uses_turin = simsimd_uses_turin();
     int uses_sierra = simsimd_uses_sierra();
 
@@ -77,10 +84,142 @@ void test_utilities(void) {
     assert(uses_ice == ((capabilities & simsimd_cap_ice_k) != 0));
     assert(uses_genoa == ((capabilities & simsimd_cap_genoa_k) != 0));
     assert(uses_sapphire == ((capabilities & simsimd_cap_sapphire_k) != 0));
+    assert(uses_sapphire_amx == ((capabilities & simsimd_cap_sapphire_amx_k) != 0));
     assert(uses_turin == ((capabilities & simsimd_cap_turin_k) != 0));
     assert(uses_sierra == ((capabilities & simsimd_cap_sierra_k) != 0));
 }
 
+/**
+ *  @brief  Tests that the dispatch table resolves the same kernels as `simsimd_find_metric_punned`.
+ */
+void test_dispatch_table(void) {
+    static simsimd_dispatch_table_t table;
+    simsimd_capability_t const capabilities = simsimd_capabilities();
+    simsimd_capability_t used_capability;
+    simsimd_metric_punned_t expected;
+    simsimd_size_t kind, slot;
+
+    simsimd_dispatch_table_init(&table, capabilities, simsimd_cap_any_k);
+    for (kind = 0; kind != simsimd_dispatch_kinds_k; ++kind)
+        for (slot = 1; slot != simsimd_dispatch_datatypes_k; ++slot) {
+            simsimd_datatype_t const datatype = (simsimd_datatype_t)(1 << slot);
+            expected = 0;
+            simsimd_find_metric_punned((simsimd_metric_kind_t)kind, datatype, capabilities, simsimd_cap_any_k,
+                                       &expected, &used_capability);
+            assert(simsimd_dispatch_table_find(&table, (simsimd_metric_kind_t)kind, datatype) == expected);
+            assert(simsimd_dispatch_table_capability(&table, (simsimd_metric_kind_t)kind, datatype) ==
+                   (expected ? used_capability : 0));
+        }
+    assert(simsimd_dispatch_table_find(&table, simsimd_metric_dot_k, simsimd_datatype_f32_k) != 0);
+    assert(simsimd_dispatch_table_find(&table, simsimd_metric_dot_k, simsimd_datatype_unknown_k) == 0);
+
+#if SIMSIMD_DYNAMIC_DISPATCH
+    assert(memcmp(simsimd_dispatch_table()->metrics, table.metrics, sizeof(table.metrics)) == 0);
+#endif
+}
+
+/**
+ *  @brief  Tests the candidate kernels for autotuning, and the calibration round-trip through a file.
+ */
+void test_tuning(void) {
+    simsimd_capability_t const capabilities = simsimd_capabilities();
+    simsimd_metric_punned_t metrics[32], expected = 0;
+    simsimd_capability_t candidates[32], used_capability;
+    simsimd_size_t count, i;
+
+    assert(simsimd_tuning_bucket(1) == 0 && simsimd_tuning_bucket(32) == 0 && simsimd_tuning_bucket(33) == 1);
+    assert(simsimd_tuning_bucket((simsimd_size_t)1 << 30) == simsimd_tuning_buckets_k - 1);
+    assert(simsimd_tuning_kind_slot(simsimd_metric_dot_k) != 0);
+    assert(simsimd_tuning_kind_slot(simsimd_metric_dot_batch_k) == 0);
+
+    // The first candidate is the default choice, and the last one is serial
+    simsimd_find_metric_punned(simsimd_metric_l2sq_k, simsimd_datatype_f32_k, capabilities, simsimd_cap_any_k,
+                               &expected, &used_capability);
+    count = simsimd_find_metric_candidates(simsimd_metric_l2sq_k, simsimd_datatype_f32_k, capabilities,
+                                           simsimd_cap_any_k, metrics, candidates, 32);
+    assert(count >= 1 && metrics[0] == expected && candidates[count - 1] == simsimd_cap_serial_k);
+    for (i = 1; i < count; ++i) assert(candidates[i] < candidates[i - 1]);
+
+#if SIMSIMD_DYNAMIC_DISPATCH
+    static simsimd_tuning_table_t calibrated;
+    simsimd_f32_t f32s[300];
+    simsimd_distance_t tuned, untuned;
+    char const *path = "simsimd_test_tuning.txt";
+    for (i = 0; i != 300; ++i) f32s[i] = (simsimd_f32_t)(i % 7) / 7.0f;
+
+    simsimd_l2sq_f32(f32s, f32s + 150, 150, &untuned);
+    simsimd_tuning_calibrate(simsimd_cap_any_k, 4);
+    calibrated = *simsimd_tuning_table();
+    simsimd_l2sq_f32(f32s, f32s + 150, 150, &tuned);
+    assert(fabs(tuned - untuned) < 1e-3 * fabs(untuned));
+
+    // Winners survive persistence, and are only recorded where there is a choice
+    assert(simsimd_tuning_save(path));
+    simsimd_tuning_reset();
+    assert(simsimd_tuning_table()->winners[simsimd_tuning_kind_slot(simsimd_metric_l2sq_k)]
+                                          [simsimd_dispatch_datatype_slot(simsimd_datatype_f32_k)][0] == 0);
+    assert(simsimd_tuning_load(path));
+    assert(memcmp(simsimd_tuning_table(), &calibrated, sizeof(calibrated)) == 0);
+    assert(simsimd_tuning_table()->winners[simsimd_tuning_kind_slot(simsimd_metric_l2sq_k)]
+                                          [simsimd_dispatch_datatype_slot(simsimd_datatype_f32_k)][0] ==
+           (count > 1 ? calibrated.winners[simsimd_tuning_kind_slot(simsimd_metric_l2sq_k)]
+                                          [simsimd_dispatch_datatype_slot(simsimd_datatype_f32_k)][0]
+                      : 0));
+    assert(!simsimd_tuning_load("simsimd_test_tuning_missing.txt"));
+    remove(path);
+    simsimd_tuning_reset();
+#endif
+}
+
+/**
+ *  @brief  Tests that the instrumented dynamic library counts the served kernels and the missing ones,
+ *          or exports no counters at all, if compiled without `SIMSIMD_INSTRUMENTATION`.
+ */
+void test_instrumentation(void) {
+#if SIMSIMD_DYNAMIC_DISPATCH
+    static simsimd_kernel_usage_t usage[256];
+    simsimd_f32_t f32s[256];
+    simsimd_size_t ids[1], counts[1], count, i;
+    simsimd_distance_t distances[1];
+    int served_found = 0, missing_found = 0;
+    for (i = 0; i != 256; ++i) f32s[i] = (simsimd_f32_t)(i % 5) / 5.0f;
+
+    // No kernel ranks 64-bit unsigned integers, so the second search is rejected
+    assert(!simsimd_dispatch_table_find(simsimd_dispatch_table(), simsimd_metric_dot_k, simsimd_datatype_u64_k));
+    simsimd_instrumentation_configure(simsimd_instrumentation_cycles_k);
+    simsimd_instrumentation_reset();
+    simsimd_l2sq_f32(f32s, f32s + 128, 128, distances);
+    simsimd_l2sq_f32(f32s, f32s + 128, 128, distances);
+    assert(!simsimd_topk_cdist(simsimd_metric_dot_k, simsimd_datatype_u64_k, f32s, 1, 0, f32s, 1, 0, 1, 1, ids,
+                               distances, counts));
+
+    count = simsimd_instrumentation_usage(usage, 256);
+    assert(count <= 256);
+    if (!simsimd_instrumentation_enabled()) {
+        assert(count == 0);
+        return;
+    }
+    for (i = 0; i != count; ++i) {
+        if (usage[i].kind == simsimd_metric_l2sq_k && usage[i].datatype == simsimd_datatype_f32_k) {
+            assert(usage[i].capability == simsimd_dispatch_table_capability(simsimd_dispatch_table(),
+                                                                             simsimd_metric_l2sq_k,
+                                                                             simsimd_datatype_f32_k));
+            assert(usage[i].calls == 2 && usage[i].bytes == 2 * 2 * 128 * sizeof(simsimd_f32_t));
+            served_found = 1;
+        }
+        if (usage[i].kind == simsimd_metric_dot_k && usage[i].datatype == simsimd_datatype_u64_k) {
+            assert(usage[i].capability == 0 && usage[i].calls == 1 && usage[i].bytes == 0);
+            missing_found = 1;
+        }
+    }
+    assert(served_found && missing_found);
+
+    simsimd_instrumentation_reset();
+    assert(simsimd_instrumentation_usage(NULL, 0) == 0);
+    simsimd_instrumentation_configure(0);
+#endif
+}
+
 /**
  *  @brief  A trivial test that calls every implemented distance function and their dispatch versions
  *          on vectors A and B, where A and B are equal.
@@ -146,10 +285,1199 @@ void test_distance_from_itself(void) {
     simsimd_kl_f64(f64s, f64s, 1536, &distance);
 }
 
+/**
+ *  @brief  Checks that the one-to-many batch kernels match the pairwise kernels, using a padded
+ *          row stride and a row count that doesn't divide evenly into the 4-row tiles.
+ */
+void test_batch_matches_pairs(void) {
+    enum { dims = 133, rows = 7, stride = 140 };
+    simsimd_f32_t f32s[rows * stride];
+    simsimd_i8_t i8s[rows * stride];
+    simsimd_b8_t b8s[rows * stride];
+    simsimd_distance_t batch[rows], pair;
+    simsimd_size_t i, j;
+
+    for (i = 0; i != rows * stride; ++i) {
+        f32s[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f - 0.5f;
+        i8s[i] = (simsimd_i8_t)((i * 37) % 101 - 50);
+        b8s[i] = (simsimd_b8_t)((i * 37) % 251);
+    }
+
+#define SIMSIMD_CHECK_BATCH(name, type, vectors)                                                    \
+    simsimd_##name##_batch_##type(vectors, vectors, rows, stride * sizeof(vectors[0]), dims, batch); \
+    for (j = 0; j != rows; ++j) {                                                                   \
+        simsimd_##name##_##type(vectors, vectors + j * stride, dims, &pair);                        \
+        assert(fabs(batch[j] - pair) <= 1e-3 * (1 + fabs(pair)));                                   \
+    }
+
+    SIMSIMD_CHECK_BATCH(dot, f32, f32s);
+    SIMSIMD_CHECK_BATCH(cos, f32, f32s);
+    SIMSIMD_CHECK_BATCH(l2sq, f32, f32s);
+    SIMSIMD_CHECK_BATCH(l2, f32, f32s);
+    SIMSIMD_CHECK_BATCH(dot, i8, i8s);
+    SIMSIMD_CHECK_BATCH(cos, i8, i8s);
+    SIMSIMD_CHECK_BATCH(l2sq, i8, i8s);
+    SIMSIMD_CHECK_BATCH(l2, i8, i8s);
+    SIMSIMD_CHECK_BATCH(hamming, b8, b8s);
+    SIMSIMD_CHECK_BATCH(jaccard, b8, b8s);
+
+#undef SIMSIMD_CHECK_BATCH
+}
+
+/**
+ *  @brief  Tests that the packed many-to-many kernels match the single-pair kernels, covering the tails
+ *          of every block, and multiple blocks along every dimension, including the groups of `a` rows
+ *          sharing the packed panels of `b`.
+ */
+void test_cdist_matches_pairs(void) {
+    enum { dims = 300, a_rows = SIMSIMD_CDIST_MB + 7, b_rows = 35, stride = 304, rows = a_rows + b_rows };
+    static simsimd_f32_t f32s[rows * stride];
+    static simsimd_f16_t f16s[rows * stride];
+    static simsimd_bf16_t bf16s[rows * stride];
+    static simsimd_i8_t i8s[rows * stride];
+    static simsimd_b8_t b8s[rows * stride];
+    static simsimd_distance_t cdist[a_rows * b_rows];
+    simsimd_distance_t pair;
+    simsimd_size_t i, j;
+
+    // The period of the floats is longer than the matrix, so no rows repeat, as the L2 distances between
+    // identical rows can't be precisely derived from the dot-products
+    for (i = 0; i != rows * stride; ++i) {
+        f32s[i] = (simsimd_f32_t)((i * 37) % 1009) / 1009.0f - 0.5f;
+        simsimd_f32_to_f16(f32s[i], f16s + i);
+        simsimd_f32_to_bf16(f32s[i], bf16s + i);
+        i8s[i] = (simsimd_i8_t)((i * 37) % 101 - 50);
+        b8s[i] = (simsimd_b8_t)((i * 37) % 251);
+    }
+
+#define SIMSIMD_CHECK_CDIST(name, type, vectors, tolerance)                                                    \
+    simsimd_##name##_cdist_##type(vectors, vectors + a_rows * stride, a_rows, stride * sizeof(vectors[0]),     \
+                                  b_rows, stride * sizeof(vectors[0]), dims, cdist,                           \
+                                  b_rows * sizeof(simsimd_distance_t));                                        \
+    for (i = 0; i != a_rows; ++i)                                                                              \
+        for (j = 0; j != b_rows; ++j) {                                                                        \
+            simsimd_##name##_##type(vectors + i * stride, vectors + (a_rows + j) * stride, dims, &pair);       \
+            assert(fabs(cdist[i * b_rows + j] - pair) <= tolerance * (1 + fabs(pair)));                        \
+        }
+
+    SIMSIMD_CHECK_CDIST(dot, f32, f32s, 1e-3);
+    SIMSIMD_CHECK_CDIST(cos, f32, f32s, 1e-3);
+    SIMSIMD_CHECK_CDIST(l2sq, f32, f32s, 1e-3);
+    SIMSIMD_CHECK_CDIST(l2, f32, f32s, 1e-3);
+    // Pairwise half-precision kernels may accumulate in 16 bits, while the packed kernels upcast first
+    SIMSIMD_CHECK_CDIST(dot, f16, f16s, 1e-2);
+    SIMSIMD_CHECK_CDIST(cos, f16, f16s, 1e-2);
+    SIMSIMD_CHECK_CDIST(l2sq, f16, f16s, 1e-2);
+    SIMSIMD_CHECK_CDIST(l2, f16, f16s, 1e-2);
+    SIMSIMD_CHECK_CDIST(dot, bf16, bf16s, 1e-2);
+    SIMSIMD_CHECK_CDIST(cos, bf16, bf16s, 1e-2);
+    SIMSIMD_CHECK_CDIST(l2sq, bf16, bf16s, 1e-2);
+    SIMSIMD_CHECK_CDIST(l2, bf16, bf16s, 1e-2);
+    SIMSIMD_CHECK_CDIST(dot, i8, i8s, 1e-3);
+    SIMSIMD_CHECK_CDIST(cos, i8, i8s, 1e-3);
+    SIMSIMD_CHECK_CDIST(l2sq, i8, i8s, 1e-3);
+    SIMSIMD_CHECK_CDIST(l2, i8, i8s, 1e-3);
+    SIMSIMD_CHECK_CDIST(hamming, b8, b8s, 1e-9);
+    SIMSIMD_CHECK_CDIST(jaccard, b8, b8s, 1e-9);
+
+#undef SIMSIMD_CHECK_CDIST
+}
+
+/**
+ *  @brief  Serial executor for tests, counting the submitted tasks.
+ */
+void test_executor(void *executor, simsimd_task_punned_t task, void *context, simsimd_size_t count) {
+    simsimd_size_t i;
+    *(simsimd_size_t *)executor += count;
+    for (i = 0; i != count; ++i) task(context, i);
+}
+
+/**
+ *  @brief  Tests that the many-to-many kernels with a custom output precision match the `f64` ones,
+ *          rounded to that precision, including padded output rows and tiled parallel execution.
+ */
+void test_cdist_typed_matches_f64(void) {
+    enum { dims = 300, a_rows = 37, b_rows = 35, columns = b_rows + 3, stride = 304, rows = a_rows + b_rows };
+    static simsimd_f32_t f32s[rows * stride];
+    static simsimd_f16_t f16s[rows * stride];
+    static simsimd_bf16_t bf16s[rows * stride];
+    static simsimd_i8_t i8s[rows * stride];
+    static simsimd_distance_t expected[a_rows * b_rows], f64s[a_rows * columns];
+    static simsimd_f32_t f32_results[a_rows * columns];
+    static simsimd_f16_t f16_results[a_rows * columns];
+    static simsimd_bf16_t bf16_results[a_rows * columns];
+    simsimd_size_t i, j, tasks = 0;
+
+    for (i = 0; i != rows * stride; ++i) {
+        f32s[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f - 0.5f;
+        simsimd_f32_to_f16(f32s[i], f16s + i);
+        simsimd_f32_to_bf16(f32s[i], bf16s + i);
+        i8s[i] = (simsimd_i8_t)((i * 37) % 101 - 50);
+    }
+
+#define SIMSIMD_CHECK_CDIST_TYPED(name, type, vectors)                                                           \
+    simsimd_##name##_cdist_##type(vectors, vectors + a_rows * stride, a_rows, stride * sizeof(vectors[0]),       \
+                                  b_rows, stride * sizeof(vectors[0]), dims, expected,                           \
+                                  b_rows * sizeof(simsimd_distance_t));                                          \
+    simsimd_##name##_cdist_typed_##type(vectors, vectors + a_rows * stride, a_rows, stride * sizeof(vectors[0]), \
+                                        b_rows, stride * sizeof(vectors[0]), dims, f64s,                         \
+                                        columns * sizeof(simsimd_distance_t), simsimd_datatype_f64_k);           \
+    simsimd_##name##_cdist_typed_##type(vectors, vectors + a_rows * stride, a_rows, stride * sizeof(vectors[0]), \
+                                        b_rows, stride * sizeof(vectors[0]), dims, f32_results,                  \
+                                        columns * sizeof(simsimd_f32_t), simsimd_datatype_f32_k);                \
+    simsimd_##name##_cdist_typed_##type(vectors, vectors + a_rows * stride, a_rows, stride * sizeof(vectors[0]), \
+                                        b_rows, stride * sizeof(vectors[0]), dims, f16_results,                  \
+                                        columns * sizeof(simsimd_f16_t), simsimd_datatype_f16_k);                \
+    simsimd_cdist_typed_parallel((simsimd_metric_cdist_typed_punned_t)&simsimd_##name##_cdist_typed_##type,      \
+                                 &test_executor, &tasks, vectors, vectors + a_rows * stride, a_rows,             \
+                                 stride * sizeof(vectors[0]), b_rows, stride * sizeof(vectors[0]), dims,         \
+                                 bf16_results, columns * sizeof(simsimd_bf16_t), simsimd_datatype_bf16_k);       \
+    for (i = 0; i != a_rows; ++i)                                                                                \
+        for (j = 0; j != b_rows; ++j) {                                                                          \
+            simsimd_distance_t const e = expected[i * b_rows + j];                                               \
+            simsimd_f32_t const f16 = simsimd_f16_to_f32(f16_results + i * columns + j);                         \
+            simsimd_f32_t const bf16 = simsimd_bf16_to_f32(bf16_results + i * columns + j);                      \
+            assert(f64s[i * columns + j] == e);                                                                  \
+            assert(fabs(f32_results[i * columns + j] - e) <= 1e-6 * (1 + fabs(e)));                              \
+            assert(fabs(e) > 65504 ? fabs(f16) >= 65504 : fabs(f16 - e) <= 1e-3 * (1 + fabs(e)));                \
+            assert(fabs(bf16 - e) <= 1e-2 * (1 + fabs(e)));                                                      \
+        }
+
+    SIMSIMD_CHECK_CDIST_TYPED(dot, f32, f32s);
+    SIMSIMD_CHECK_CDIST_TYPED(cos, f32, f32s);
+    SIMSIMD_CHECK_CDIST_TYPED(l2sq, f32, f32s);
+    SIMSIMD_CHECK_CDIST_TYPED(l2, f32, f32s);
+    SIMSIMD_CHECK_CDIST_TYPED(dot, f16, f16s);
+    SIMSIMD_CHECK_CDIST_TYPED(cos, f16, f16s);
+    SIMSIMD_CHECK_CDIST_TYPED(l2sq, f16, f16s);
+    SIMSIMD_CHECK_CDIST_TYPED(l2, f16, f16s);
+    SIMSIMD_CHECK_CDIST_TYPED(dot, bf16, bf16s);
+    SIMSIMD_CHECK_CDIST_TYPED(cos, bf16, bf16s);
+    SIMSIMD_CHECK_CDIST_TYPED(l2sq, bf16, bf16s);
+    SIMSIMD_CHECK_CDIST_TYPED(l2, bf16, bf16s);
+    SIMSIMD_CHECK_CDIST_TYPED(dot, i8, i8s);
+    SIMSIMD_CHECK_CDIST_TYPED(cos, i8, i8s);
+    SIMSIMD_CHECK_CDIST_TYPED(l2sq, i8, i8s);
+    SIMSIMD_CHECK_CDIST_TYPED(l2, i8, i8s);
+
+#undef SIMSIMD_CHECK_CDIST_TYPED
+}
+
+/**
+ *  @brief  Tests that the kernels reusing the cached squared norms match the ones accumulating them on the fly,
+ *          with both sides cached, only one of them, or neither, including the tiled parallel execution.
+ */
+void test_normed_matches_plain(void) {
+    enum { dims = 300, a_rows = 37, b_rows = 35, stride = 304, rows = a_rows + b_rows };
+    static simsimd_f32_t f32s[rows * stride];
+    static simsimd_i8_t i8s[rows * stride];
+    static simsimd_distance_t norms[rows], expected[a_rows * b_rows], results[a_rows * b_rows];
+    simsimd_distance_t pair;
+    simsimd_size_t i, j, tasks = 0;
+
+    for (i = 0; i != rows * stride; ++i) {
+        f32s[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f - 0.5f;
+        i8s[i] = (simsimd_i8_t)((i * 37) % 101 - 50);
+    }
+
+#define SIMSIMD_CHECK_NORMED(name, type, vectors)                                                                    \
+    simsimd_norms_##type(vectors, rows, stride * sizeof(vectors[0]), dims, norms);                                   \
+    for (i = 0; i != rows; ++i) {                                                                                    \
+        simsimd_dot_##type(vectors + i * stride, vectors + i * stride, dims, &pair);                                 \
+        assert(fabs(norms[i] - pair) <= 1e-5 * (1 + pair));                                                          \
+    }                                                                                                                \
+    simsimd_##name##_batch_##type(vectors, vectors + a_rows * stride, b_rows, stride * sizeof(vectors[0]), dims,     \
+                                  expected);                                                                         \
+    simsimd_##name##_batch_normed_##type(vectors, vectors + a_rows * stride, b_rows, stride * sizeof(vectors[0]),    \
+                                         dims, norms, norms + a_rows, results);                                      \
+    for (j = 0; j != b_rows; ++j) assert(fabs(results[j] - expected[j]) <= 1e-3 * (1 + fabs(expected[j])));          \
+    simsimd_##name##_batch_normed_##type(vectors, vectors + a_rows * stride, b_rows, stride * sizeof(vectors[0]),    \
+                                         dims, 0, 0, results);                                                       \
+    for (j = 0; j != b_rows; ++j) assert(results[j] == expected[j]);                                                 \
+    simsimd_##name##_cdist_##type(vectors, vectors + a_rows * stride, a_rows, stride * sizeof(vectors[0]),           \
+                                  b_rows, stride * sizeof(vectors[0]), dims, expected,                               \
+                                  b_rows * sizeof(simsimd_distance_t));                                              \
+    simsimd_##name##_cdist_normed_##type(vectors, vectors + a_rows * stride, a_rows, stride * sizeof(vectors[0]),    \
+                                         b_rows, stride * sizeof(vectors[0]), dims, 0, 0, results,                   \
+                                         b_rows * sizeof(simsimd_distance_t), simsimd_datatype_f64_k);               \
+    for (i = 0; i != a_rows * b_rows; ++i) assert(results[i] == expected[i]);                                        \
+    simsimd_##name##_cdist_normed_##type(vectors, vectors + a_rows * stride, a_rows, stride * sizeof(vectors[0]),    \
+                                         b_rows, stride * sizeof(vectors[0]), dims, 0, norms + a_rows, results,      \
+                                         b_rows * sizeof(simsimd_distance_t), simsimd_datatype_f64_k);               \
+    for (i = 0; i != a_rows * b_rows; ++i) assert(fabs(results[i] - expected[i]) <= 1e-3 * (1 + fabs(expected[i]))); \
+    simsimd_cdist_normed_parallel((simsimd_metric_cdist_normed_punned_t)&simsimd_##name##_cdist_normed_##type,       \
+                                  &test_executor, &tasks, vectors, vectors + a_rows * stride, a_rows,                \
+                                  stride * sizeof(vectors[0]), b_rows, stride * sizeof(vectors[0]), dims, norms,     \
+                                  norms + a_rows, results, b_rows * sizeof(simsimd_distance_t),                      \
+                                  simsimd_datatype_f64_k);                                                           \
+    for (i = 0; i != a_rows * b_rows; ++i) assert(fabs(results[i] - expected[i]) <= 1e-3 * (1 + fabs(expected[i])));
+
+    SIMSIMD_CHECK_NORMED(cos, f32, f32s);
+    SIMSIMD_CHECK_NORMED(l2sq, f32, f32s);
+    SIMSIMD_CHECK_NORMED(l2, f32, f32s);
+    SIMSIMD_CHECK_NORMED(cos, i8, i8s);
+    SIMSIMD_CHECK_NORMED(l2sq, i8, i8s);
+    SIMSIMD_CHECK_NORMED(l2, i8, i8s);
+
+#undef SIMSIMD_CHECK_NORMED
+}
+
+/**
+ *  @brief  Tests that the condensed pairwise distances match the full distance matrix of a set with itself,
+ *          with several tiles along the diagonal, a partial last tile, and narrower outputs.
+ */
+void test_pdist_matches_cdist(void) {
+    enum { dims = 131, count = 2 * SIMSIMD_PARALLEL_PDIST_TILE + 13, pairs = count * (count - 1) / 2 };
+    static simsimd_f32_t f32s[count * dims];
+    static simsimd_distance_t cdist[count * count], pdist[pairs];
+    static simsimd_f32_t pdist_f32[pairs];
+    simsimd_size_t const stride = dims * sizeof(simsimd_f32_t);
+    simsimd_size_t i, j, tasks = 0;
+
+    for (i = 0; i != count * dims; ++i) f32s[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f - 0.5f;
+    simsimd_l2_cdist_f32(f32s, f32s, count, stride, count, stride, dims, cdist, count * sizeof(simsimd_distance_t));
+    assert(simsimd_pdist_offset(count, 0, 1) == 0 && simsimd_pdist_offset(count, count - 2, count - 1) == pairs - 1);
+
+    simsimd_pdist_parallel((simsimd_metric_cdist_punned_t)&simsimd_l2_cdist_f32, &test_executor, &tasks, f32s, count,
+                           stride, dims, pdist, simsimd_datatype_f64_k);
+    assert(tasks == 6);
+    simsimd_pdist_parallel((simsimd_metric_cdist_punned_t)&simsimd_l2_cdist_f32, 0, 0, f32s, count, stride, dims,
+                           pdist_f32, simsimd_datatype_f32_k);
+    for (i = 0; i != count; ++i)
+        for (j = i + 1; j != count; ++j) {
+            simsimd_distance_t const expected = cdist[i * count + j];
+            assert(pdist[simsimd_pdist_offset(count, i, j)] == expected);
+            assert(fabs(pdist_f32[simsimd_pdist_offset(count, i, j)] - expected) <= 1e-6 * (1 + expected));
+        }
+
+#if SIMSIMD_DYNAMIC_DISPATCH
+    for (i = 0; i != pairs; ++i) pdist[i] = 0;
+    assert(simsimd_pdist(simsimd_metric_l2_k, simsimd_datatype_f32_k, f32s, count, stride, dims, pdist,
+                         simsimd_datatype_f64_k));
+    for (i = 0; i != count; ++i)
+        for (j = i + 1; j != count; ++j) assert(pdist[simsimd_pdist_offset(count, i, j)] == cdist[i * count + j]);
+    assert(!simsimd_pdist(simsimd_metric_kl_k, simsimd_datatype_f32_k, f32s, count, stride, dims, pdist,
+                          simsimd_datatype_f64_k));
+#endif
+}
+
+/**
+ *  @brief  Tests that the Mahalanobis distances match the Euclidean distances between the rows whitened by
+ *          the Cholesky factor of the metric tensor, and that the bilinear forms of all pairs match the pairwise
+ *          kernel, with dimensions exceeding a single `SIMSIMD_CURVED_KC` block.
+ */
+void test_curved_batch(void) {
+    enum { dims = SIMSIMD_CURVED_KC + 7, rows = 11, columns = 5 };
+    static simsimd_f32_t c[dims * dims], l[dims * dims], vectors[rows * dims];
+    static simsimd_f32_t whitened[rows * dims], whitened_serial[rows * dims];
+    simsimd_distance_t bilinear[rows * columns], bilinear_serial[rows * columns], expected, distance;
+    simsimd_size_t const stride = dims * sizeof(simsimd_f32_t);
+    simsimd_size_t i, j, k;
+
+    // A symmetric positive-definite metric tensor `m * m^T / dims + I`
+    for (i = 0; i != rows * dims; ++i) vectors[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f - 0.5f;
+    for (i = 0; i != dims; ++i)
+        for (j = 0; j <= i; ++j) {
+            simsimd_f64_t sum = i == j;
+            for (k = 0; k != dims; ++k)
+                sum += (((i * 13 + k * 7) % 29) / 29.0 - 0.5) * (((j * 13 + k * 7) % 29) / 29.0 - 0.5) / dims;
+            c[i * dims + j] = c[j * dims + i] = (simsimd_f32_t)sum;
+        }
+
+    assert(simsimd_cholesky_f32_serial(c, dims, l));
+    simsimd_whiten_f32(vectors, rows, stride, l, dims, whitened, stride);
+    simsimd_whiten_f32_serial(vectors, rows, stride, l, dims, whitened_serial, stride);
+    for (i = 0; i != rows; ++i)
+        for (j = i + 1; j != rows; ++j) {
+            simsimd_mahalanobis_f32_accurate(vectors + i * dims, vectors + j * dims, c, dims, &expected);
+            simsimd_l2_f32(whitened + i * dims, whitened + j * dims, dims, &distance);
+            assert(fabs(distance - expected) <= 1e-3 * (1 + expected));
+            simsimd_l2_f32(whitened_serial + i * dims, whitened_serial + j * dims, dims, &distance);
+            assert(fabs(distance - expected) <= 1e-3 * (1 + expected));
+        }
+
+    simsimd_bilinear_cdist_f32(vectors, vectors + dims, rows, stride, columns, stride, c, dims, bilinear,
+                               columns * sizeof(simsimd_distance_t));
+    simsimd_bilinear_cdist_f32_serial(vectors, vectors + dims, rows, stride, columns, stride, c, dims,
+                                      bilinear_serial, columns * sizeof(simsimd_distance_t));
+    for (i = 0; i != rows; ++i)
+        for (j = 0; j != columns; ++j) {
+            simsimd_bilinear_f32_accurate(vectors + i * dims, vectors + (j + 1) * dims, c, dims, &expected);
+            assert(fabs(bilinear[i * columns + j] - expected) <= 1e-3 * (1 + fabs(expected)));
+            assert(fabs(bilinear_serial[i * columns + j] - expected) <= 1e-3 * (1 + fabs(expected)));
+        }
+
+    // Indefinite metric tensors can't be factorized
+    c[0] = -1;
+    assert(!simsimd_cholesky_f32_serial(c, dims, l));
+}
+
+/**
+ *  @brief  Tests that the fused top-k search returns the best candidates in order, both in one pass
+ *          and when merging the heaps of two disjoint slices, spanning multiple scoring chunks.
+ */
+void test_topk_matches_pairs(void) {
+    enum { dims = 97, rows = 150, stride = 100, k = 10, split = 67 };
+    static simsimd_f32_t f32s[(rows + 1) * stride];
+    static simsimd_b8_t b8s[(rows + 1) * stride];
+    simsimd_size_t ids[k], other_ids[k], count, other_count, i, j, better;
+    simsimd_distance_t distances[k], other_distances[k], pair;
+
+    for (i = 0; i != (rows + 1) * stride; ++i) {
+        f32s[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f - 0.5f;
+        b8s[i] = (simsimd_b8_t)((i * 37) % 251);
+    }
+
+    // The first row is the query, the remaining ones are candidates with identifiers starting from zero.
+    // Every returned distance must match the pairwise kernel, be sorted, and no other candidate may beat the last one.
+#define SIMSIMD_CHECK_TOPK(name, type, vectors, sign)                                                          \
+    for (i = 0; i != count; ++i) {                                                                             \
+        simsimd_##name##_##type(vectors, vectors + (ids[i] + 1) * stride, dims, &pair);                        \
+        assert(fabs(distances[i] - pair) <= 1e-3 * (1 + fabs(pair)));                                          \
+        assert(i == 0 || sign * distances[i - 1] <= sign * distances[i] + 1e-3 * (1 + fabs(pair)));            \
+    }                                                                                                          \
+    for (better = 0, j = 0; j != rows; ++j) {                                                                  \
+        simsimd_##name##_##type(vectors, vectors + (j + 1) * stride, dims, &pair);                             \
+        better += sign * pair < sign * distances[count - 1] - 1e-3 * (1 + fabs(pair));                        \
+    }                                                                                                          \
+    assert(count == k && better < k);
+
+#define SIMSIMD_CHECK_TOPK_KIND(name, type, vectors, kind, datatype, sign)                                     \
+    count = simsimd_topk(kind, datatype, vectors, vectors + stride, rows, stride * sizeof(vectors[0]), dims, k, \
+                         ids, distances);                                                                      \
+    SIMSIMD_CHECK_TOPK(name, type, vectors, sign)
+
+    SIMSIMD_CHECK_TOPK_KIND(dot, f32, f32s, simsimd_metric_dot_k, simsimd_datatype_f32_k, -1);
+    SIMSIMD_CHECK_TOPK_KIND(cos, f32, f32s, simsimd_metric_cos_k, simsimd_datatype_f32_k, 1);
+    SIMSIMD_CHECK_TOPK_KIND(l2sq, f32, f32s, simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 1);
+    SIMSIMD_CHECK_TOPK_KIND(l2, f32, f32s, simsimd_metric_l2_k, simsimd_datatype_f32_k, 1);
+    SIMSIMD_CHECK_TOPK_KIND(hamming, b8, b8s, simsimd_metric_hamming_k, simsimd_datatype_b8_k, 1);
+
+    // Scanning two slices separately and merging their heaps must yield the same guarantees.
+    count = 0, other_count = 0;
+    simsimd_topk_scan((simsimd_metric_punned_t)&simsimd_l2sq_f32, 0, 0, f32s, f32s + stride, split,
+                      stride * sizeof(f32s[0]), dims, 0, k, &count, ids, distances);
+    simsimd_topk_scan((simsimd_metric_punned_t)&simsimd_l2sq_f32,
+                      (simsimd_metric_batch_punned_t)&simsimd_l2sq_batch_f32, 0, f32s, f32s + (split + 1) * stride,
+                      rows - split, stride * sizeof(f32s[0]), dims, split, k, &other_count, other_ids,
+                      other_distances);
+    simsimd_topk_merge(k, &count, ids, distances, other_count, other_ids, other_distances);
+    simsimd_topk_sort(count, ids, distances, 0);
+    SIMSIMD_CHECK_TOPK(l2sq, f32, f32s, 1);
+
+#undef SIMSIMD_CHECK_TOPK_KIND
+#undef SIMSIMD_CHECK_TOPK
+}
+
+/**
+ *  @brief  Tests that streaming candidates from `.npy` and `.fbin` files and searching many queries at once
+ *          match the single-query top-k search, with one and multiple threads.
+ */
+void test_topk_file(void) {
+#if SIMSIMD_DYNAMIC_DISPATCH
+    enum { dims = 97, rows = 150, queries = 2, k = 10 };
+    static simsimd_f32_t f32s[(rows + queries) * dims];
+    simsimd_size_t ids[queries * k], expected_ids[k], counts[queries], count, i, threads;
+    simsimd_distance_t distances[queries * k], expected_distances[k];
+    simsimd_file_matrix_t matrix;
+    char const *npy_path = "simsimd_test_topk.npy", *fbin_path = "simsimd_test_topk.fbin";
+    char npy_header[128];
+    simsimd_u32_t fbin_header[2] = {rows, dims};
+    FILE *file;
+
+    for (i = 0; i != (rows + queries) * dims; ++i) f32s[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f - 0.5f;
+    simsimd_f32_t const *candidates = f32s + queries * dims;
+
+    // The version 1 header is padded with spaces to a multiple of 64 bytes, including the 10-byte prefix
+    memset(npy_header, ' ', sizeof(npy_header));
+    memcpy(npy_header, "\x93NUMPY\x01\x00\x76\x00", 10);
+    i = (simsimd_size_t)sprintf(npy_header + 10, "{'descr': '<f4', 'fortran_order': False, 'shape': (%d, %d), }",
+                                (int)rows, (int)dims);
+    npy_header[10 + i] = ' ', npy_header[127] = '\n';
+    file = fopen(npy_path, "wb");
+    assert(file && fwrite(npy_header, 1, 128, file) == 128 && fwrite(candidates, sizeof(f32s[0]), rows * dims, file));
+    fclose(file);
+    file = fopen(fbin_path, "wb");
+    assert(file && fwrite(fbin_header, 4, 2, file) == 2 && fwrite(candidates, sizeof(f32s[0]), rows * dims, file));
+    fclose(file);
+
+    assert(simsimd_file_matrix_inspect(npy_path, &matrix));
+    assert(matrix.datatype == simsimd_datatype_f32_k && matrix.offset == 128 && matrix.rows == rows &&
+           matrix.dimensions == dims && matrix.stride == dims * sizeof(f32s[0]));
+    assert(simsimd_file_matrix_inspect(fbin_path, &matrix));
+    assert(matrix.datatype == simsimd_datatype_f32_k && matrix.offset == 8 && matrix.rows == rows &&
+           matrix.dimensions == dims && matrix.stride == dims * sizeof(f32s[0]));
+
+#define SIMSIMD_CHECK_TOPK_QUERIES(kind)                                                                         \
+    for (simsimd_size_t query = 0; query != queries; ++query) {                                                 \
+        count = simsimd_topk(kind, simsimd_datatype_f32_k, f32s + query * dims, candidates, rows,                 \
+                             dims * sizeof(f32s[0]), dims, k, expected_ids, expected_distances);                  \
+        assert(counts[query] == count);                                                                          \
+        for (simsimd_size_t j = 0; j != count; ++j)                                                              \
+            assert(fabs(distances[query * k + j] - expected_distances[j]) <=                                     \
+                   1e-6 * (1 + fabs(expected_distances[j])));                                                    \
+    }
+
+    for (threads = 1; threads <= 3; threads += 2) {
+        simsimd_set_threads(threads, 0);
+        for (i = 0; i != 2; ++i) {
+            simsimd_metric_kind_t const kind = i ? simsimd_metric_dot_k : simsimd_metric_l2sq_k;
+            assert(simsimd_file_matrix_inspect(i ? npy_path : fbin_path, &matrix));
+            assert(simsimd_topk_file(kind, f32s, queries, dims * sizeof(f32s[0]), i ? npy_path : fbin_path, &matrix,
+                                     k, ids, distances, counts));
+            SIMSIMD_CHECK_TOPK_QUERIES(kind);
+            assert(simsimd_topk_cdist(kind, simsimd_datatype_f32_k, f32s, queries, dims * sizeof(f32s[0]), candidates,
+                                      rows, dims * sizeof(f32s[0]), dims, k, ids, distances, counts));
+            SIMSIMD_CHECK_TOPK_QUERIES(kind);
+        }
+    }
+    simsimd_set_threads(1, 0);
+#undef SIMSIMD_CHECK_TOPK_QUERIES
+
+    // Layouts exceeding the file are rejected
+    matrix.rows = rows + 1;
+    assert(!simsimd_topk_file(simsimd_metric_l2sq_k, f32s, queries, dims * sizeof(f32s[0]), npy_path, &matrix, k,
+                              ids, distances, counts));
+    assert(!simsimd_file_matrix_inspect("simsimd_test_topk_missing.npy", &matrix));
+    remove(npy_path);
+    remove(fbin_path);
+#endif
+}
+
+/**
+ *  @brief  Validating the dispatched geospatial kernels against the serial ones and the known geodesics.
+ */
+void test_geospatial(void) {
+    enum { count = 37 }; // Not a multiple of any register width, to cover the tails
+    simsimd_f64_t a_lats[count], a_lons[count], b_lats[count], b_lons[count];
+    simsimd_f32_t a_lats32[count], a_lons32[count], b_lats32[count], b_lons32[count];
+    simsimd_distance_t results[count], expected[count];
+    simsimd_f64_t const radians = 3.14159265358979323846 / 180;
+    simsimd_size_t i;
+
+    // Pseudo-random pairs within a few thousand kilometers, plus coincident, equatorial, and polar ones
+    for (i = 0; i != count; ++i) {
+        a_lats[i] = ((simsimd_f64_t)((i * 37) % 101) / 101 - 0.5) * 170 * radians;
+        a_lons[i] = ((simsimd_f64_t)((i * 53) % 103) / 103 - 0.5) * 360 * radians;
+        b_lats[i] = a_lats[i] + ((simsimd_f64_t)((i * 71) % 107) / 107 - 0.5) * 20 * radians;
+        b_lons[i] = a_lons[i] + ((simsimd_f64_t)((i * 29) % 109) / 109 - 0.5) * 40 * radians;
+    }
+    b_lats[0] = a_lats[0], b_lons[0] = a_lons[0];
+    a_lats[1] = b_lats[1] = 0;
+    a_lats[2] = 90 * radians, b_lats[2] = 80 * radians;
+    for (i = 0; i != count; ++i)
+        a_lats32[i] = (simsimd_f32_t)a_lats[i], a_lons32[i] = (simsimd_f32_t)a_lons[i],
+        b_lats32[i] = (simsimd_f32_t)b_lats[i], b_lons32[i] = (simsimd_f32_t)b_lons[i];
+
+#define SIMSIMD_CHECK_GEOSPATIAL(name, absolute)                                                    \
+    simsimd_##name##_f64_serial(a_lats, a_lons, b_lats, b_lons, count, expected);                   \
+    simsimd_##name##_f64(a_lats, a_lons, b_lats, b_lons, count, results);                           \
+    for (i = 0; i != count; ++i) assert(fabs(results[i] - expected[i]) <= 1e-9 * (absolute));       \
+    simsimd_##name##_f32_serial(a_lats32, a_lons32, b_lats32, b_lons32, count, expected);           \
+    simsimd_##name##_f32(a_lats32, a_lons32, b_lats32, b_lons32, count, results);                   \
+    for (i = 0; i != count; ++i) assert(fabs(results[i] - expected[i]) <= 1e-5 * (absolute));
+
+    SIMSIMD_CHECK_GEOSPATIAL(hav, 1);
+    SIMSIMD_CHECK_GEOSPATIAL(haversine, SIMSIMD_EARTH_RADIUS);
+    SIMSIMD_CHECK_GEOSPATIAL(vincenty, SIMSIMD_EARTH_RADIUS);
+    assert(results[0] == 0);
+#undef SIMSIMD_CHECK_GEOSPATIAL
+
+    // Quarter of the equator on a sphere
+    a_lats[0] = a_lons[0] = b_lats[0] = 0, b_lons[0] = 90 * radians;
+    simsimd_haversine_f64(a_lats, a_lons, b_lats, b_lons, 1, results);
+    assert(fabs(results[0] - SIMSIMD_EARTH_RADIUS * 3.14159265358979323846 / 2) < 1e-6);
+
+    // Flinders Peak to Buninyong, the classic example from Vincenty's 1975 paper, quoted to a millimeter
+    a_lats[0] = -(37 + 57 / 60.0 + 3.72030 / 3600) * radians, a_lons[0] = (144 + 25 / 60.0 + 29.52440 / 3600) * radians;
+    b_lats[0] = -(37 + 39 / 60.0 + 10.15610 / 3600) * radians, b_lons[0] = (143 + 55 / 60.0 + 35.38390 / 3600) * radians;
+    simsimd_vincenty_f64(a_lats, a_lons, b_lats, b_lons, 1, results);
+    assert(fabs(results[0] - 54972.271) < 1e-3);
+}
+
+/**
+ *  @brief  Validating the RMSD and Kabsch kernels on rigidly transformed, perturbed, and mirrored point clouds,
+ *          and the one-to-many batches against the pairwise kernels.
+ */
+void test_mesh(void) {
+    enum { points = 37, clouds = 4, stride = points * 3 + 5 }; // Not a multiple of any register width
+    simsimd_f64_t a[points * 3], moved[points * 3], shifted[points * 3], mirrored[points * 3];
+    simsimd_f64_t batch64[clouds * stride], a_centroid[3], b_centroid[3];
+    simsimd_f32_t a32[points * 3], b32[points * 3];
+    simsimd_f16_t a16[points * 3], b16[points * 3];
+    simsimd_bf16_t abf16[points * 3], bbf16[points * 3];
+    simsimd_distance_t result, expected, batch[clouds];
+    simsimd_f64_t const cosine = cos(0.7), sine = sin(0.7);
+    simsimd_size_t i, j;
+
+    // Rotating around the Z axis, translating, and adding small noise, and separately mirroring the X axis
+    for (i = 0; i != points; ++i) {
+        simsimd_f64_t *p = a + i * 3;
+        p[0] = ((simsimd_f64_t)((i * 37) % 101) / 101 - 0.5) * 20;
+        p[1] = ((simsimd_f64_t)((i * 53) % 103) / 103 - 0.5) * 20;
+        p[2] = ((simsimd_f64_t)((i * 71) % 107) / 107 - 0.5) * 20;
+        moved[i * 3 + 0] = cosine * p[0] - sine * p[1] + 3;
+        moved[i * 3 + 1] = sine * p[0] + cosine * p[1] - 2;
+        moved[i * 3 + 2] = p[2] + 1;
+        for (j = 0; j != 3; ++j) shifted[i * 3 + j] = p[j] + 5 + ((simsimd_f64_t)((i * 3 + j) % 7) - 3) * 0.01;
+        mirrored[i * 3 + 0] = -p[0], mirrored[i * 3 + 1] = p[1], mirrored[i * 3 + 2] = p[2];
+    }
+
+    // Rigid transforms are undone by Kabsch, but not by RMSD, which only aligns the centroids
+    simsimd_kabsch_f64(a, moved, points, a_centroid, b_centroid, &result);
+    assert(result < 1e-6);
+    simsimd_rmsd_f64(a, moved, points, 0, 0, &result);
+    assert(result > 1);
+    simsimd_rmsd_f64_serial(a, shifted, points, a_centroid, b_centroid, &expected);
+    simsimd_rmsd_f64(a, shifted, points, a_centroid, b_centroid, &result);
+    assert(fabs(result - expected) < 1e-9 && expected > 1e-3 && expected < 0.1);
+    for (j = 0; j != 3; ++j) assert(fabs(b_centroid[j] - a_centroid[j] - 5) < 0.01);
+
+    // Reflections can't be undone by a proper rotation
+    simsimd_kabsch_f64_serial(a, mirrored, points, 0, 0, &expected);
+    simsimd_kabsch_f64(a, mirrored, points, 0, 0, &result);
+    assert(fabs(result - expected) < 1e-9 && expected > 1);
+
+    // Lower-precision inputs are compared to the double-precision accumulation of the same inputs
+    for (i = 0; i != points * 3; ++i) {
+        a32[i] = (simsimd_f32_t)a[i], b32[i] = (simsimd_f32_t)(moved[i] + shifted[i] - a[i]);
+        SIMSIMD_F32_TO_F16(a32[i], a16 + i), SIMSIMD_F32_TO_F16(b32[i], b16 + i);
+        SIMSIMD_F32_TO_BF16(a32[i], abf16 + i), SIMSIMD_F32_TO_BF16(b32[i], bbf16 + i);
+    }
+
+#define SIMSIMD_CHECK_MESH(name, type, a, b)                              \
+    simsimd_##name##_##type##_accurate(a, b, points, 0, 0, &expected);    \
+    simsimd_##name##_##type(a, b, points, 0, 0, &result);                 \
+    assert(fabs(result - expected) <= 1e-2 * (1 + expected));
+
+    SIMSIMD_CHECK_MESH(rmsd, f32, a32, b32);
+    SIMSIMD_CHECK_MESH(kabsch, f32, a32, b32);
+    SIMSIMD_CHECK_MESH(rmsd, f16, a16, b16);
+    SIMSIMD_CHECK_MESH(kabsch, f16, a16, b16);
+    SIMSIMD_CHECK_MESH(rmsd, bf16, abf16, bbf16);
+    SIMSIMD_CHECK_MESH(kabsch, bf16, abf16, bbf16);
+#undef SIMSIMD_CHECK_MESH
+
+    // Batches of conformers, laid out with padding between them
+    for (i = 0; i != points * 3; ++i)
+        batch64[i] = moved[i], batch64[stride + i] = shifted[i], batch64[2 * stride + i] = mirrored[i],
+        batch64[3 * stride + i] = a[i];
+    simsimd_kabsch_batch_f64(a, batch64, clouds, stride * sizeof(simsimd_f64_t), points, batch);
+    for (j = 0; j != clouds; ++j) {
+        simsimd_kabsch_f64(a, batch64 + j * stride, points, 0, 0, &result);
+        assert(fabs(batch[j] - result) < 1e-12);
+    }
+    simsimd_rmsd_batch_f64(a, batch64, clouds, stride * sizeof(simsimd_f64_t), points, batch);
+    for (j = 0; j != clouds; ++j) {
+        simsimd_rmsd_f64(a, batch64 + j * stride, points, 0, 0, &result);
+        assert(fabs(batch[j] - result) < 1e-12);
+    }
+    assert(batch[3] < 1e-6);
+}
+
+/**
+ *  @brief  Validating the 4-bit kernels against a plain nibble-by-nibble computation,
+ *          and the dispatched ones against the serial backend, covering every tail length.
+ */
+void test_i4x2(void) {
+    enum { max_words = 263 };
+    simsimd_i4x2_t a[max_words], b[max_words];
+    simsimd_distance_t result, expected;
+    simsimd_size_t i, n;
+    for (i = 0; i != max_words; ++i) a[i] = (simsimd_i4x2_t)(i * 37 + 11), b[i] = (simsimd_i4x2_t)(i * 101 + 7);
+
+    // The low nibble is the first scalar, and both ends of the [-8, 7] range must survive the sign extension
+    assert(SIMSIMD_I4X2_LOW(0x87) == 7 && SIMSIMD_I4X2_HIGH(0x87) == -8);
+    assert(SIMSIMD_I4X2_LOW(0xF0) == 0 && SIMSIMD_I4X2_HIGH(0xF0) == -1);
+
+    for (n = 0; n <= max_words; n += 1 + n / 8) {
+        simsimd_i64_t ab = 0, a2 = 0, b2 = 0, d2 = 0;
+        for (i = 0; i != n * 2; ++i) {
+            simsimd_i32_t ai = (i % 2 ? a[i / 2] >> 4 : a[i / 2]) & 0x0F;
+            simsimd_i32_t bi = (i % 2 ? b[i / 2] >> 4 : b[i / 2]) & 0x0F;
+            ai = ai > 7 ? ai - 16 : ai, bi = bi > 7 ? bi - 16 : bi;
+            ab += ai * bi, a2 += ai * ai, b2 += bi * bi, d2 += (ai - bi) * (ai - bi);
+        }
+
+        simsimd_dot_i4x2_serial(a, b, n, &expected);
+        assert(expected == ab);
+        simsimd_dot_i4x2(a, b, n, &result);
+        assert(result == expected);
+        simsimd_l2sq_i4x2_serial(a, b, n, &expected);
+        assert(expected == d2);
+        simsimd_l2sq_i4x2(a, b, n, &result);
+        assert(result == expected);
+        simsimd_l2_i4x2_serial(a, b, n, &expected);
+        simsimd_l2_i4x2(a, b, n, &result);
+        assert(fabs(result - expected) <= 1e-3 * (1 + expected));
+        simsimd_cos_i4x2_serial(a, b, n, &expected);
+        if (a2 && b2) assert(fabs(expected - (1 - ab / sqrt((simsimd_f64_t)a2 * b2))) <= 1e-9);
+        simsimd_cos_i4x2(a, b, n, &result);
+        assert(fabs(result - expected) <= 1e-2);
+    }
+}
+
+/**
+ *  @brief  Tests the asymmetric kernels against the symmetric `f32` ones on manually dequantized rows,
+ *          with both per-vector and per-dimension parameters, and odd lengths for the packed `i4x2` rows.
+ */
+void test_quantized(void) {
+    enum { max_dims = 131 };
+    simsimd_f32_t a[max_dims], a_rounded[max_dims], dequantized[max_dims], scales[max_dims], zero_points[max_dims];
+    simsimd_f16_t a_f16[max_dims];
+    simsimd_i8_t i8s[max_dims];
+    simsimd_u8_t u8s[max_dims];
+    simsimd_i4x2_t i4s[(max_dims + 1) / 2] = {0};
+    simsimd_distance_t result, expected;
+    simsimd_size_t i, n, params_stride;
+
+    for (i = 0; i != max_dims; ++i) {
+        a[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f - 0.5f;
+        simsimd_f32_to_f16(a[i], a_f16 + i);
+        a_rounded[i] = simsimd_f16_to_f32(a_f16 + i);
+        scales[i] = 0.01f + (simsimd_f32_t)(i % 7) / 256.0f;
+        zero_points[i] = (simsimd_f32_t)(i % 5) - 2.0f;
+        i8s[i] = (simsimd_i8_t)(i * 101 + 7), u8s[i] = (simsimd_u8_t)(i * 53 + 3);
+        i4s[i / 2] |= (simsimd_i4x2_t)(((i * 11 + 5) & 0x0F) << (i % 2 * 4));
+    }
+
+#define SIMSIMD_CHECK_QUANTIZED(metric, query, reference, query_type, database, database_type, dequantize)           \
+    for (i = 0; i != n; ++i)                                                                                         \
+        dequantized[i] = SIMSIMD_DEQUANTIZE(dequantize, scales, zero_points, i * params_stride);                     \
+    simsimd_##metric##_f32_serial(reference, dequantized, n, &expected);                                             \
+    simsimd_##metric##_##query_type##database_type##_serial(query, database, n, scales, zero_points,                 \
+                                                             params_stride, &result);                                \
+    assert(fabs(result - expected) <= 1e-3 * (1 + fabs(expected)));                                                  \
+    simsimd_##metric##_##query_type##database_type(query, database, n, scales, zero_points, params_stride, &result); \
+    assert(fabs(result - expected) <= 1e-3 * (1 + fabs(expected)));
+
+#define SIMSIMD_CHECK_QUANTIZED_ALL(metric)                                           \
+    SIMSIMD_CHECK_QUANTIZED(metric, a, a, f32, i8s, i8, i8s[i])                       \
+    SIMSIMD_CHECK_QUANTIZED(metric, a, a, f32, u8s, u8, u8s[i])                       \
+    SIMSIMD_CHECK_QUANTIZED(metric, a, a, f32, i4s, i4x2, SIMSIMD_I4X2_INDEX(i4s, i)) \
+    SIMSIMD_CHECK_QUANTIZED(metric, a_f16, a_rounded, f16, i8s, i8, i8s[i])           \
+    SIMSIMD_CHECK_QUANTIZED(metric, a_f16, a_rounded, f16, u8s, u8, u8s[i])           \
+    SIMSIMD_CHECK_QUANTIZED(metric, a_f16, a_rounded, f16, i4s, i4x2, SIMSIMD_I4X2_INDEX(i4s, i))
+
+    for (params_stride = 0; params_stride != 2; ++params_stride) {
+        for (n = 0; n <= max_dims; n += 1 + n / 8) {
+            SIMSIMD_CHECK_QUANTIZED_ALL(dot)
+            SIMSIMD_CHECK_QUANTIZED_ALL(cos)
+            SIMSIMD_CHECK_QUANTIZED_ALL(l2sq)
+            SIMSIMD_CHECK_QUANTIZED_ALL(l2)
+        }
+    }
+
+#undef SIMSIMD_CHECK_QUANTIZED_ALL
+#undef SIMSIMD_CHECK_QUANTIZED
+}
+
+/**
+ *  @brief  Tests the Product Quantization scans against the sums of floating-point ADC tables, built from
+ *          random codebooks with the `l2sq` kernel, for an odd number of subspaces and a partial last block.
+ */
+void test_pq(void) {
+    enum { subspaces = 7, subspace_dims = 3, count = 83 };
+    static simsimd_f32_t centroids[subspaces * 256 * subspace_dims], table[subspaces * 256];
+    static simsimd_u8_t codes[count * subspaces], packed[(count + 31) / 32 * 32 * subspaces];
+    static simsimd_u8_t quantized[subspaces * 256];
+    simsimd_f32_t query[subspaces * subspace_dims];
+    simsimd_distance_t results[count], expected[count], scale, bias, distance;
+    simsimd_size_t i, j, centroids_count;
+
+    for (i = 0; i != subspaces * 256 * subspace_dims; ++i) centroids[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f;
+    for (i = 0; i != subspaces * subspace_dims; ++i) query[i] = (simsimd_f32_t)((i * 53) % 97) / 97.0f;
+
+    for (centroids_count = 16; centroids_count <= 256; centroids_count *= 16) {
+        for (i = 0; i != count * subspaces; ++i) codes[i] = (simsimd_u8_t)((i * 131 + 17) % centroids_count);
+        simsimd_pq_table_f32((simsimd_metric_punned_t)&simsimd_l2sq_f32, query, centroids, subspaces,
+                             centroids_count, subspace_dims, table);
+        simsimd_l2sq_f32(query + subspace_dims, centroids + (centroids_count + 5) * subspace_dims, subspace_dims,
+                         &distance);
+        assert(fabs(table[centroids_count + 5] - distance) <= 1e-6);
+
+        simsimd_pq_quantize_table(table, subspaces, centroids_count, quantized, &scale, &bias);
+        for (i = 0; i != count; ++i) {
+            expected[i] = 0;
+            for (j = 0; j != subspaces; ++j)
+                expected[i] += table[j * centroids_count + codes[i * subspaces + j]];
+        }
+
+        // Rounding every entry to the nearest integer loses at most half of the `scale` per subspace
+        if (centroids_count == 16) {
+            simsimd_pq_pack_u4x2(codes, count, subspaces, packed);
+            simsimd_pq_scan_u4x2_serial(packed, count, subspaces, quantized, scale, bias, results);
+            for (i = 0; i != count; ++i) assert(fabs(results[i] - expected[i]) <= scale * subspaces / 2 + 1e-6);
+            simsimd_pq_scan_u4x2(packed, count, subspaces, quantized, scale, bias, expected);
+        }
+        else {
+            simsimd_pq_pack_u8(codes, count, subspaces, packed);
+            simsimd_pq_scan_u8_serial(packed, count, subspaces, quantized, scale, bias, results);
+            for (i = 0; i != count; ++i) assert(fabs(results[i] - expected[i]) <= scale * subspaces / 2 + 1e-6);
+            simsimd_pq_scan_u8(packed, count, subspaces, quantized, scale, bias, expected);
+        }
+
+        // The integer sums are exact, so all backends must agree bit-for-bit
+        for (i = 0; i != count; ++i) assert(results[i] == expected[i]);
+    }
+}
+
+/**
+ *  @brief  Tests that the threshold searches over bit-vectors report exactly the rows within the radius,
+ *          in ascending order, for codes short enough to fit a register and for longer ones,
+ *          spanning multiple blocks of `SIMSIMD_BINARY_BLOCK` rows.
+ */
+void test_binary_radius(void) {
+    enum { rows = 300, stride = 100 };
+    static simsimd_b8_t b8s[(rows + 1) * stride];
+    simsimd_size_t ids[rows], found = 0, expected_found, i, j, n_words;
+    simsimd_distance_t distances[rows], pair, radius;
+
+    for (i = 0; i != (rows + 1) * stride; ++i) b8s[i] = (simsimd_b8_t)((i * 37) % 251);
+    // Plant a few near-duplicates of the query, differing in a single bit
+    for (i = 17; i < rows; i += 97) {
+        for (j = 0; j != stride; ++j) b8s[(i + 1) * stride + j] = b8s[j];
+        b8s[(i + 1) * stride + i % stride] ^= 0x10;
+    }
+
+    for (n_words = 32; n_words <= stride; n_words += stride - 32) {
+        for (radius = 1; radius <= n_words * 4; radius += n_words * 4 - 1) {
+            simsimd_hamming_radius_b8(b8s, b8s + stride, rows, stride, n_words, radius, ids, distances, &found);
+            for (i = 0, expected_found = 0; i != rows; ++i) {
+                simsimd_hamming_b8_serial(b8s, b8s + (i + 1) * stride, n_words, &pair);
+                if (pair > radius) continue;
+                assert(expected_found < found && ids[expected_found] == i && distances[expected_found] == pair);
+                ++expected_found;
+            }
+            assert(found == expected_found);
+        }
+        assert(found > 0 && found < rows);
+
+        // Without the distances, just the identifiers are exported
+        simsimd_jaccard_radius_b8(b8s, b8s + stride, rows, stride, n_words, 0.5, ids, NULL, &found);
+        for (i = 0, expected_found = 0; i != rows; ++i) {
+            simsimd_jaccard_b8_serial(b8s, b8s + (i + 1) * stride, n_words, &pair);
+            if (pair > 0.5) continue;
+            assert(expected_found < found && ids[expected_found] == i);
+            ++expected_found;
+        }
+        assert(found == expected_found);
+    }
+}
+
+/**
+ *  @brief  Tests that intersecting one query with a CSR block of documents, some long enough to be galloped
+ *          through, matches the pairwise kernels.
+ */
+void test_sparse_batch(void) {
+    enum { docs = 120, max_length = 4000, queries_count = 5 };
+    static simsimd_u16_t u16s[docs * max_length];
+    static simsimd_u32_t u32s[docs * max_length];
+    static simsimd_bf16_t weights[docs * max_length];
+    simsimd_u16_t query_u16[100];
+    simsimd_u32_t query_u32[100];
+    simsimd_bf16_t query_weights[100];
+    simsimd_size_t const query_lengths[queries_count] = {0, 5, 16, 32, 100};
+    simsimd_size_t offsets[docs + 1], i, d, q, length;
+    simsimd_distance_t results[docs], pair[2];
+
+    // Documents are arithmetic progressions with different starts and steps, and a few very long ones
+    for (d = 0, offsets[0] = 0; d != docs; ++d) {
+        length = d % 40 == 7 ? max_length : (d * 37) % 200;
+        for (i = 0; i != length; ++i) {
+            u16s[offsets[d] + i] = (simsimd_u16_t)((d * 101) % 500 + i * (1 + d % 5));
+            u32s[offsets[d] + i] = (simsimd_u32_t)u16s[offsets[d] + i] * 100000u;
+            simsimd_f32_to_bf16((simsimd_f32_t)((offsets[d] + i) % 7) / 4.0f, &weights[offsets[d] + i]);
+        }
+        offsets[d + 1] = offsets[d] + length;
+    }
+    for (i = 0; i != 100; ++i) {
+        query_u16[i] = (simsimd_u16_t)(60 + i * 3);
+        query_u32[i] = (simsimd_u32_t)query_u16[i] * 100000u;
+        simsimd_f32_to_bf16((simsimd_f32_t)(i % 5) / 2.0f, &query_weights[i]);
+    }
+
+    for (q = 0; q != queries_count; ++q) {
+        length = query_lengths[q];
+        simsimd_intersect_batch_u16(query_u16, length, u16s, offsets, docs, results);
+        for (d = 0; d != docs; ++d) {
+            simsimd_intersect_u16_accurate(query_u16, u16s + offsets[d], length, offsets[d + 1] - offsets[d], pair);
+            assert(results[d] == pair[0]);
+        }
+        simsimd_intersect_batch_u32(query_u32, length, u32s, offsets, docs, results);
+        for (d = 0; d != docs; ++d) {
+            simsimd_intersect_u32_accurate(query_u32, u32s + offsets[d], length, offsets[d + 1] - offsets[d], pair);
+            assert(results[d] == pair[0]);
+        }
+        simsimd_spdot_weights_batch_u16(query_u16, query_weights, length, u16s, weights, offsets, docs, results);
+        for (d = 0; d != docs; ++d) {
+            simsimd_spdot_weights_u16_accurate(query_u16, u16s + offsets[d], query_weights, weights + offsets[d],
+                                               length, offsets[d + 1] - offsets[d], pair);
+            assert(fabs(results[d] - pair[1]) < 1e-3);
+        }
+    }
+}
+
+/**
+ *  @brief  Tests that weighted intersections of `u32` sparse vectors, long enough to take the SIMD paths,
+ *          match the accurate kernels for both `bf16` and `f32` weights.
+ */
+void test_sparse_weighted(void) {
+    enum { max_length = 300 };
+    simsimd_u32_t a[max_length], b[max_length];
+    simsimd_f32_t a_f32s[max_length], b_f32s[max_length];
+    simsimd_bf16_t a_bf16s[max_length], b_bf16s[max_length];
+    simsimd_size_t const lengths[] = {0, 7, 31, 64, 150, 300};
+    simsimd_size_t i, j, k;
+    simsimd_distance_t result[2], expected[2];
+
+    for (i = 0; i != max_length; ++i) {
+        a[i] = (simsimd_u32_t)(i * 3) * 70000u, b[i] = (simsimd_u32_t)(i * 2 + 40) * 70000u;
+        a_f32s[i] = (simsimd_f32_t)(i % 9) / 4.0f, b_f32s[i] = (simsimd_f32_t)(i % 5) / 2.0f;
+        simsimd_f32_to_bf16(a_f32s[i], &a_bf16s[i]);
+        simsimd_f32_to_bf16(b_f32s[i], &b_bf16s[i]);
+    }
+
+    for (i = 0; i != sizeof(lengths) / sizeof(lengths[0]); ++i)
+        for (j = 0; j != sizeof(lengths) / sizeof(lengths[0]); ++j) {
+            simsimd_spdot_weights_f32_u32(a, b, a_f32s, b_f32s, lengths[i], lengths[j], result);
+            simsimd_spdot_weights_f32_u32_accurate(a, b, a_f32s, b_f32s, lengths[i], lengths[j], expected);
+            assert(result[0] == expected[0] && fabs(result[1] - expected[1]) < 1e-3);
+            simsimd_spdot_weights_u32(a, b, a_bf16s, b_bf16s, lengths[i], lengths[j], result);
+            simsimd_spdot_weights_u32_accurate(a, b, a_bf16s, b_bf16s, lengths[i], lengths[j], expected);
+            assert(result[0] == expected[0] && fabs(result[1] - expected[1]) < 1e-3);
+            // Shifted windows of the same arrays produce unaligned overlaps
+            k = lengths[i] / 3;
+            simsimd_spdot_weights_f32_u32(a + k, b, a_f32s + k, b_f32s, lengths[i] - k, lengths[j], result);
+            simsimd_spdot_weights_f32_u32_accurate(a + k, b, a_f32s + k, b_f32s, lengths[i] - k, lengths[j], expected);
+            assert(result[0] == expected[0] && fabs(result[1] - expected[1]) < 1e-3);
+        }
+}
+
+/**
+ *  @brief  Tests the element-wise kernels against their serial versions and scalar expressions, including
+ *          the in-place mode, the saturation of integers, and the bit order of the binarized vectors.
+ */
+void test_elementwise(void) {
+    enum { max_dims = 131 };
+    simsimd_f32_t a[max_dims], b[max_dims], result[max_dims], expected[max_dims];
+    simsimd_f64_t a_f64[max_dims], result_f64[max_dims], expected_f64[max_dims];
+    simsimd_f16_t a_f16[max_dims], result_f16[max_dims], expected_f16[max_dims];
+    simsimd_bf16_t a_bf16[max_dims], result_bf16[max_dims], expected_bf16[max_dims];
+    simsimd_i8_t result_i8[max_dims], expected_i8[max_dims];
+    simsimd_u8_t result_u8[max_dims], expected_u8[max_dims];
+    simsimd_b8_t result_b8[(max_dims + 7) / 8], expected_b8[(max_dims + 7) / 8];
+    simsimd_distance_t alpha;
+    simsimd_size_t i, n;
+
+    for (i = 0; i != max_dims; ++i) {
+        a[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f - 0.5f, b[i] = (simsimd_f32_t)((i * 53) % 97) / 97.0f;
+        a_f64[i] = a[i];
+        simsimd_f32_to_f16(a[i], a_f16 + i);
+        simsimd_f32_to_bf16(a[i], a_bf16 + i);
+    }
+
+    for (n = 0; n <= max_dims; n += 1 + n / 8) {
+        simsimd_scale_f32(a, n, 3, 0.25, result);
+        for (i = 0; i != n; ++i) assert(fabsf(result[i] - (3 * a[i] + 0.25f)) <= 1e-6f);
+        simsimd_scale_f64(a_f64, n, 3, 0.25, result_f64);
+        for (i = 0; i != n; ++i) assert(fabs(result_f64[i] - (3 * a_f64[i] + 0.25)) <= 1e-12);
+        simsimd_add_f32(a, b, n, result);
+        for (i = 0; i != n; ++i) assert(result[i] == a[i] + b[i]);
+        simsimd_multiply_f32(a, b, n, result);
+        for (i = 0; i != n; ++i) assert(result[i] == a[i] * b[i]);
+
+        // In-place updates must match the out-of-place ones
+        memcpy(expected, a, sizeof(a));
+        simsimd_scale_f32(expected, n, -2, 1, expected);
+        simsimd_scale_f32(a, n, -2, 1, result);
+        assert(memcmp(result, expected, n * sizeof(simsimd_f32_t)) == 0);
+        memcpy(expected_f64, a_f64, sizeof(a_f64));
+        simsimd_multiply_f64(expected_f64, a_f64, n, expected_f64);
+        simsimd_multiply_f64(a_f64, a_f64, n, result_f64);
+        assert(memcmp(result_f64, expected_f64, n * sizeof(simsimd_f64_t)) == 0);
+
+        // Half-precision kernels compute in `f32`, but may round the outputs differently
+        simsimd_add_f16_serial(a_f16, a_f16, n, expected_f16);
+        simsimd_add_f16(a_f16, a_f16, n, result_f16);
+        for (i = 0; i != n; ++i)
+            assert(fabsf(simsimd_f16_to_f32(result_f16 + i) - simsimd_f16_to_f32(expected_f16 + i)) <= 1e-3f);
+        simsimd_scale_bf16_serial(a_bf16, n, 2, 1, expected_bf16);
+        simsimd_scale_bf16(a_bf16, n, 2, 1, result_bf16);
+        for (i = 0; i != n; ++i)
+            assert(fabsf(simsimd_bf16_to_f32(result_bf16 + i) - simsimd_bf16_to_f32(expected_bf16 + i)) <= 1e-2f);
+
+        // Conversions into integers must round, saturate, and match the serial kernels exactly
+        for (alpha = 100.3; alpha < 2000; alpha *= 10) {
+            simsimd_quantize_i8_serial(a, n, alpha, expected_i8);
+            simsimd_quantize_i8(a, n, alpha, result_i8);
+            assert(memcmp(result_i8, expected_i8, n) == 0);
+            simsimd_quantize_u8_serial(a, n, alpha, expected_u8);
+            simsimd_quantize_u8(a, n, alpha, result_u8);
+            assert(memcmp(result_u8, expected_u8, n) == 0);
+            for (i = 0; i != n; ++i) {
+                simsimd_f32_t scaled = (simsimd_f32_t)alpha * a[i];
+                assert(expected_i8[i] == (scaled > 127 ? 127 : scaled < -128 ? -128 : (simsimd_i8_t)roundf(scaled)));
+                assert(expected_u8[i] == (scaled > 255 ? 255 : scaled < 0 ? 0 : (simsimd_u8_t)roundf(scaled)));
+            }
+        }
+        simsimd_dequantize_i8(expected_i8, n, 0.5, result);
+        for (i = 0; i != n; ++i) assert(result[i] == 0.5f * expected_i8[i]);
+        simsimd_dequantize_u8(expected_u8, n, 0.5, result);
+        for (i = 0; i != n; ++i) assert(result[i] == 0.5f * expected_u8[i]);
+
+        // Floating-point conversions must round-trip within the precision of the narrower type
+        simsimd_quantize_f16(a, n, 1, result_f16);
+        simsimd_dequantize_f16(result_f16, n, 1, result);
+        for (i = 0; i != n; ++i) assert(fabsf(result[i] - a[i]) <= 1e-3f);
+        simsimd_quantize_bf16_serial(a, n, 1, expected_bf16);
+        simsimd_quantize_bf16(a, n, 1, result_bf16);
+        assert(memcmp(result_bf16, expected_bf16, n * sizeof(simsimd_bf16_t)) == 0);
+        simsimd_dequantize_bf16(result_bf16, n, 1, result);
+        for (i = 0; i != n; ++i) assert(fabsf(result[i] - a[i]) <= 1e-2f);
+
+        // The first scalar goes into the most significant bit, and the padding bits of the last byte are zeros
+        memset(expected_b8, 0, sizeof(expected_b8));
+        for (i = 0; i != n; ++i) expected_b8[i / 8] |= (simsimd_b8_t)((a[i] > 0) << (7 - i % 8));
+        simsimd_quantize_b8(a, n, 1, result_b8);
+        assert(memcmp(result_b8, expected_b8, (n + 7) / 8) == 0);
+        simsimd_quantize_b8(a, n, -1, result_b8);
+        for (i = 0; i != n; ++i) assert(((result_b8[i / 8] >> (7 - i % 8)) & 1) == (a[i] < 0));
+    }
+}
+
+/**
+ *  @brief  Tests that the row-wise reductions match the serial kernels, locating the first of the tied extremums,
+ *          skipping NaNs, and accumulating long integer rows exactly.
+ */
+void test_reduce(void) {
+    enum { rows = 3, max_dims = 131, long_dims = 20000 };
+    simsimd_f64_t f64s[rows * max_dims];
+    simsimd_f32_t f32s[rows * max_dims];
+    simsimd_f16_t f16s[rows * max_dims];
+    simsimd_bf16_t bf16s[rows * max_dims];
+    simsimd_i8_t i8s[rows * max_dims];
+    simsimd_u8_t u8s[rows * max_dims];
+    static simsimd_i8_t long_i8s[long_dims];
+    simsimd_distance_t expected[rows], results[rows];
+    simsimd_size_t expected_indices[rows], indices[rows];
+    simsimd_size_t i, n;
+
+    for (i = 0; i != rows * max_dims; ++i) {
+        f32s[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f - 0.5f;
+        f64s[i] = f32s[i];
+        simsimd_f32_to_f16(f32s[i], f16s + i);
+        simsimd_f32_to_bf16(f32s[i], bf16s + i);
+        i8s[i] = (simsimd_i8_t)((i * 37) % 256 - 128), u8s[i] = (simsimd_u8_t)((i * 53) % 256);
+    }
+
+#define SIMSIMD_CHECK_REDUCE(name, type, tolerance)                                                            \
+    simsimd_reduce_##name##_##type##_serial(type##s, rows, max_dims * sizeof(*type##s), n, expected);          \
+    simsimd_reduce_##name##_##type(type##s, rows, max_dims * sizeof(*type##s), n, results);                    \
+    for (i = 0; i != rows; ++i) assert(fabs(expected[i] - results[i]) <= tolerance * (1 + fabs(expected[i])));
+#define SIMSIMD_CHECK_ARGREDUCE(name, type)                                                             \
+    simsimd_reduce_##name##_##type##_serial(type##s, rows, max_dims * sizeof(*type##s), n, expected,    \
+                                            expected_indices);                                          \
+    simsimd_reduce_##name##_##type(type##s, rows, max_dims * sizeof(*type##s), n, results, indices);    \
+    for (i = 0; i != rows; ++i) assert(expected[i] == results[i] && expected_indices[i] == indices[i]);
+
+    for (n = 0; n <= max_dims; n += 1 + n / 8) {
+        SIMSIMD_CHECK_REDUCE(sum, f64, 1e-12);
+        SIMSIMD_CHECK_REDUCE(l1, f64, 1e-12);
+        SIMSIMD_CHECK_REDUCE(l2, f64, 1e-12);
+        SIMSIMD_CHECK_REDUCE(sum, f32, 1e-5);
+        SIMSIMD_CHECK_REDUCE(l1, f32, 1e-5);
+        SIMSIMD_CHECK_REDUCE(l2, f32, 1e-5);
+        SIMSIMD_CHECK_REDUCE(sum, f16, 1e-5);
+        SIMSIMD_CHECK_REDUCE(l1, f16, 1e-5);
+        SIMSIMD_CHECK_REDUCE(l2, f16, 1e-5);
+        SIMSIMD_CHECK_REDUCE(sum, bf16, 1e-5);
+        SIMSIMD_CHECK_REDUCE(l1, bf16, 1e-5);
+        SIMSIMD_CHECK_REDUCE(l2, bf16, 1e-5);
+        SIMSIMD_CHECK_REDUCE(sum, i8, 0);
+        SIMSIMD_CHECK_REDUCE(l1, i8, 0);
+        SIMSIMD_CHECK_REDUCE(l2, i8, 1e-12);
+        SIMSIMD_CHECK_REDUCE(sum, u8, 0);
+        SIMSIMD_CHECK_REDUCE(l1, u8, 0);
+        SIMSIMD_CHECK_REDUCE(l2, u8, 1e-12);
+
+        // Every extremum repeats after 101 elements, so the ties must resolve to the first occurrence
+        SIMSIMD_CHECK_ARGREDUCE(min, f64);
+        SIMSIMD_CHECK_ARGREDUCE(max, f64);
+        SIMSIMD_CHECK_ARGREDUCE(min, f32);
+        SIMSIMD_CHECK_ARGREDUCE(max, f32);
+        SIMSIMD_CHECK_ARGREDUCE(min, f16);
+        SIMSIMD_CHECK_ARGREDUCE(max, f16);
+        SIMSIMD_CHECK_ARGREDUCE(min, bf16);
+        SIMSIMD_CHECK_ARGREDUCE(max, bf16);
+        SIMSIMD_CHECK_ARGREDUCE(min, i8);
+        SIMSIMD_CHECK_ARGREDUCE(max, i8);
+        SIMSIMD_CHECK_ARGREDUCE(min, u8);
+        SIMSIMD_CHECK_ARGREDUCE(max, u8);
+    }
+
+#undef SIMSIMD_CHECK_REDUCE
+#undef SIMSIMD_CHECK_ARGREDUCE
+
+    // Empty rows have no extremums, and NaNs are never chosen
+    simsimd_reduce_min_f32(f32s, 1, 0, 0, results, indices);
+    assert(results[0] == HUGE_VAL && indices[0] == 0);
+    simsimd_reduce_max_u8(u8s, 1, 0, 0, results, indices);
+    assert(results[0] == -HUGE_VAL && indices[0] == 0);
+    for (i = 0; i != max_dims; ++i) f32s[i] = i % 2 ? (simsimd_f32_t)NAN : (simsimd_f32_t)i;
+    simsimd_reduce_min_f32(f32s, 1, 0, max_dims, results, indices);
+    assert(results[0] == 0 && indices[0] == 0);
+    simsimd_reduce_max_f32(f32s, 1, 0, max_dims, results, 0);
+    assert(results[0] == max_dims - 1);
+
+    // Long rows of the largest magnitudes must not overflow the integer accumulators
+    for (i = 0; i != long_dims; ++i) long_i8s[i] = -128;
+    simsimd_reduce_sum_i8(long_i8s, 1, 0, long_dims, results);
+    assert(results[0] == -128.0 * long_dims);
+    simsimd_reduce_l1_i8(long_i8s, 1, 0, long_dims, results);
+    assert(results[0] == 128.0 * long_dims);
+    simsimd_reduce_l2_i8(long_i8s, 1, 0, long_dims, results);
+    assert(fabs(results[0] - sqrt(128.0 * 128.0 * long_dims)) <= 1e-6);
+}
+
+/**
+ *  @brief  Tests the one-to-many string kernels on known pairs, and against the serial backends on random
+ *          sequences, long enough to span several 64-byte blocks and to exceed the edit distance bounds.
+ */
+void test_strings(void) {
+    enum { rows = 64, stride = 300 };
+    static simsimd_u8_t sequences[(rows + 1) * stride];
+    simsimd_size_t lengths[rows], i, bound;
+    simsimd_distance_t results[rows], expected[rows];
+    simsimd_u8_t const *kitten = (simsimd_u8_t const *)"kitten";
+    simsimd_u8_t const *gattaca = (simsimd_u8_t const *)"GATTACA";
+    simsimd_size_t const sitting_length = 7, empty_length = 0;
+
+    simsimd_levenshtein_batch_u8(kitten, 6, (simsimd_u8_t const *)"sitting", &sitting_length, 1, 7, 100, results);
+    assert(results[0] == 3);
+    simsimd_levenshtein_batch_u8(kitten, 6, (simsimd_u8_t const *)"sitting", &sitting_length, 1, 7, 2, results);
+    assert(results[0] == 3); // Clipped to `bound + 1`
+    simsimd_levenshtein_batch_u8(kitten, 6, kitten, &empty_length, 1, 6, 100, results);
+    assert(results[0] == 6);
+    simsimd_needleman_wunsch_batch_u8(gattaca, 7, (simsimd_u8_t const *)"GCATGCU", &sitting_length, 1, 7, 1, -1, -1,
+                                      results);
+    assert(results[0] == 0);
+    lengths[0] = 4;
+    simsimd_smith_waterman_batch_u8(gattaca, 7, (simsimd_u8_t const *)"TTAC", &lengths[0], 1, 4, 3, -3, -2, results);
+    assert(results[0] == 12);
+
+    // Rows are mutations of the query over a small alphabet, so that the distances vary a lot
+    for (i = 0; i != (rows + 1) * stride; ++i)
+        sequences[i] = i % 3 == 0 ? sequences[i % stride] : (simsimd_u8_t)("ACGT"[(i * 7 + i / 5) % 4]);
+    for (i = 0; i != rows; ++i) lengths[i] = (i * 37) % stride;
+
+    for (bound = 0; bound <= 200; bound += 50) {
+        simsimd_levenshtein_batch_u8(sequences, 250, sequences + stride, lengths, rows, stride, bound, results);
+        simsimd_levenshtein_batch_u8_serial(sequences, 250, sequences + stride, lengths, rows, stride, bound, expected);
+        for (i = 0; i != rows; ++i) assert(results[i] == expected[i] && results[i] <= bound + 1);
+    }
+    simsimd_needleman_wunsch_batch_u8(sequences, 250, sequences + stride, lengths, rows, stride, 2, -1, -2, results);
+    simsimd_needleman_wunsch_batch_u8_serial(sequences, 250, sequences + stride, lengths, rows, stride, 2, -1, -2,
+                                             expected);
+    for (i = 0; i != rows; ++i) assert(results[i] == expected[i]);
+    simsimd_smith_waterman_batch_u8(sequences, 250, sequences + stride, lengths, rows, stride, 2, -1, -2, results);
+    simsimd_smith_waterman_batch_u8_serial(sequences, 250, sequences + stride, lengths, rows, stride, 2, -1, -2,
+                                           expected);
+    for (i = 0; i != rows; ++i) assert(results[i] == expected[i] && results[i] >= 0);
+
+    // Pairs, where even the shorter sequence exceeds the row kept on the stack, report a NaN
+    static simsimd_u8_t long_sequences[2][SIMSIMD_STRINGS_MAX_LENGTH + 1];
+    simsimd_size_t const long_lengths[2] = {SIMSIMD_STRINGS_MAX_LENGTH, SIMSIMD_STRINGS_MAX_LENGTH + 1};
+    simsimd_size_t const long_stride = SIMSIMD_STRINGS_MAX_LENGTH + 1;
+    simsimd_u8_t const *query = long_sequences[1];
+    memset(long_sequences, 'A', sizeof(long_sequences));
+    simsimd_levenshtein_batch_u8(query, long_stride, long_sequences[0], long_lengths, 2, long_stride, 10, results);
+    assert(results[0] == 1 && isnan(results[1]));
+    simsimd_needleman_wunsch_batch_u8(query, long_stride, long_sequences[0], long_lengths, 2, long_stride, 1, -1,
+                                      -1, results);
+    assert(results[0] == SIMSIMD_STRINGS_MAX_LENGTH - 1 && isnan(results[1]));
+    simsimd_smith_waterman_batch_u8(query, long_stride, long_sequences[0], long_lengths, 2, long_stride, 1, -1,
+                                    -1, results);
+    assert(results[0] == SIMSIMD_STRINGS_MAX_LENGTH && isnan(results[1]));
+}
+
+/**
+ *  @brief  Tests that splitting one-to-many and many-to-many kernels into tiles, with a custom executor
+ *          and with the built-in thread pool, matches the direct calls.
+ */
+void test_parallel_matches_serial(void) {
+    enum { dims = 256, a_rows = 70, b_rows = 600, batch_rows = 5003 };
+    static simsimd_f32_t f32s[(a_rows + batch_rows) * dims];
+    static simsimd_distance_t cdist[a_rows * b_rows], batch[batch_rows], parallel[a_rows * b_rows];
+    simsimd_size_t const stride = dims * sizeof(simsimd_f32_t), results_stride = b_rows * sizeof(simsimd_distance_t);
+    simsimd_size_t i, tasks = 0;
+
+    for (i = 0; i != (a_rows + batch_rows) * dims; ++i) f32s[i] = (simsimd_f32_t)((i * 37) % 101) / 101.0f - 0.5f;
+    simsimd_l2sq_cdist_f32(f32s, f32s + a_rows * dims, a_rows, stride, b_rows, stride, dims, cdist, results_stride);
+    simsimd_dot_batch_f32(f32s, f32s + a_rows * dims, batch_rows, stride, dims, batch);
+
+#define SIMSIMD_CHECK_PARALLEL(expected, count)                                                                \
+    for (i = 0; i != count; ++i) assert(fabs(expected[i] - parallel[i]) <= 1e-9 * (1 + fabs(expected[i])));
+
+    simsimd_cdist_parallel((simsimd_metric_cdist_punned_t)&simsimd_l2sq_cdist_f32, &test_executor, &tasks, f32s,
+                           f32s + a_rows * dims, a_rows, stride, b_rows, stride, dims, parallel, results_stride);
+    assert(tasks == 9);
+    SIMSIMD_CHECK_PARALLEL(cdist, a_rows * b_rows);
+    simsimd_batch_parallel((simsimd_metric_batch_punned_t)&simsimd_dot_batch_f32, &test_executor, &tasks, f32s,
+                           f32s + a_rows * dims, batch_rows, stride, dims, parallel);
+    assert(tasks == 9 + (batch_rows + SIMSIMD_PARALLEL_BATCH_ROWS - 1) / SIMSIMD_PARALLEL_BATCH_ROWS);
+    SIMSIMD_CHECK_PARALLEL(batch, batch_rows);
+
+#if SIMSIMD_DYNAMIC_DISPATCH
+    // The built-in pool is used implicitly by the dynamic dispatch library, and can be resized repeatedly
+    simsimd_executor_punned_t pool_executor;
+    void *pool_state;
+    assert(simsimd_get_threads() == 1);
+    for (simsimd_size_t threads = 2; threads <= 4; threads += 2) {
+        assert(simsimd_set_threads(threads, threads == 4) == threads && simsimd_get_threads() == threads);
+        simsimd_get_executor(&pool_executor, &pool_state);
+        assert(pool_executor == &simsimd_pool_execute && pool_state);
+        simsimd_l2sq_cdist_f32(f32s, f32s + a_rows * dims, a_rows, stride, b_rows, stride, dims, parallel,
+                               results_stride);
+        SIMSIMD_CHECK_PARALLEL(cdist, a_rows * b_rows);
+        simsimd_dot_batch_f32(f32s, f32s + a_rows * dims, batch_rows, stride, dims, parallel);
+        SIMSIMD_CHECK_PARALLEL(batch, batch_rows);
+    }
+    assert(simsimd_set_threads(1, 0) == 1 && simsimd_get_threads() == 1);
+    simsimd_get_executor(&pool_executor, &pool_state);
+    assert(!pool_executor);
+#endif
+
+#undef SIMSIMD_CHECK_PARALLEL
+}
+
 int main(int argc, char **argv) {
 
     print_capabilities();
     test_utilities();
+    test_dispatch_table();
+    test_tuning();
+    test_instrumentation();
     test_distance_from_itself();
+    test_batch_matches_pairs();
+    test_cdist_matches_pairs();
+    test_cdist_typed_matches_f64();
+    test_normed_matches_plain();
+    test_pdist_matches_cdist();
+    test_curved_batch();
+    test_topk_matches_pairs();
+    test_topk_file();
+    test_geospatial();
+    test_mesh();
+    test_i4x2();
+    test_quantized();
+    test_pq();
+    test_binary_radius();
+    test_sparse_batch();
+    test_sparse_weighted();
+    test_elementwise();
+    test_reduce();
+    test_strings();
+    test_parallel_matches_serial();
     return 0;
 }
@@ -0,0 +1,71 @@
+/**
+ *  @file   test.cxx
+ *  @brief  Test comparing the C++ fixed-dimension templates against the C API.
+ */
+
+#include <cassert> // `assert`
+#include <cmath>   // `std::fabs`
+#include <cstdio>  // `std::printf`
+#include <cstdlib> // `std::rand`
+
+#define SIMSIMD_NATIVE_F16 0
+#define SIMSIMD_NATIVE_BF16 0
+#include <simsimd/simsimd.hpp>
+
+template <typename scalar_> void fill_random(scalar_ *values, std::size_t n) {
+    for (std::size_t i = 0; i != n; ++i)
+        if constexpr (std::is_same_v<scalar_, simsimd_i8_t>) values[i] = (scalar_)(std::rand() % 201 - 100);
+        else values[i] = (scalar_)(std::rand() % 2001 - 1000) / 1000;
+}
+
+void expect_close(simsimd_distance_t expected, simsimd_distance_t result, char const *name, std::size_t n) {
+    simsimd_distance_t const tolerance = 1e-3 * (1 + std::fabs(expected));
+    if (std::fabs(expected - result) <= tolerance) return;
+    std::printf("- %s with %zu dimensions: expected %f, got %f\n", name, n, expected, result);
+    assert(0 && "Fixed-dimension kernel diverged from the C API");
+}
+
+template <typename scalar_, std::size_t dimensions_, typename c_kernels_>
+void test_fixed_metrics(char const *type_name, c_kernels_ const &kernels) {
+    scalar_ a[dimensions_], b[dimensions_];
+    fill_random(a, dimensions_);
+    fill_random(b, dimensions_);
+    simsimd_distance_t expected;
+
+    kernels.dot(a, b, dimensions_, &expected);
+    expect_close(expected, simsimd::fixed_metric<simsimd_metric_dot_k, scalar_, dimensions_>(a, b), type_name,
+                 dimensions_);
+    kernels.cos(a, b, dimensions_, &expected);
+    expect_close(expected, simsimd::fixed_metric<simsimd_metric_cos_k, scalar_, dimensions_>(a, b), type_name,
+                 dimensions_);
+    kernels.l2sq(a, b, dimensions_, &expected);
+    expect_close(expected, simsimd::fixed_metric<simsimd_metric_l2sq_k, scalar_, dimensions_>(a, b), type_name,
+                 dimensions_);
+    kernels.l2(a, b, dimensions_, &expected);
+    expect_close(expected, simsimd::fixed_metric<simsimd_metric_l2_k, scalar_, dimensions_>(a, b), type_name,
+                 dimensions_);
+}
+
+template <typename scalar_> struct c_kernels_t {
+    using kernel_t = void (*)(scalar_ const *, scalar_ const *, simsimd_size_t, simsimd_distance_t *);
+    kernel_t dot, cos, l2sq, l2;
+};
+
+template <typename scalar_> void test_fixed_metrics_all(char const *type_name, c_kernels_t<scalar_> kernels) {
+    test_fixed_metrics<scalar_, 1>(type_name, kernels);
+    test_fixed_metrics<scalar_, 7>(type_name, kernels);
+    test_fixed_metrics<scalar_, 16>(type_name, kernels);
+    test_fixed_metrics<scalar_, 33>(type_name, kernels);
+    test_fixed_metrics<scalar_, 384>(type_name, kernels);
+    test_fixed_metrics<scalar_, 768>(type_name, kernels);
+    test_fixed_metrics<scalar_, 1536>(type_name, kernels);
+}
+
+int main(int argc, char **argv) {
+    (void)argc, (void)argv;
+    test_fixed_metrics_all<simsimd_f64_t>("f64", {simsimd_dot_f64, simsimd_cos_f64, simsimd_l2sq_f64, simsimd_l2_f64});
+    test_fixed_metrics_all<simsimd_f32_t>("f32", {simsimd_dot_f32, simsimd_cos_f32, simsimd_l2sq_f32, simsimd_l2_f32});
+    test_fixed_metrics_all<simsimd_i8_t>("i8", {simsimd_dot_i8, simsimd_cos_i8, simsimd_l2sq_i8, simsimd_l2_i8});
+    std::printf("All fixed-dimension tests passed.\n");
+    return 0;
+}
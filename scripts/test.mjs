@@ -177,3 +177,31 @@ test("Jensen-Shannon C vs JS", () => {
   const resultjs = fallback.jensenshannon(f32sDistribution, f32sDistribution);
   assertAlmostEqual(resultjs, result, 0.01);
 });
+
+test("Batch and Cdist C vs JS", () => {
+  const queries = new Float32Array([1.0, 2.0, 3.0, 0.0, 1.0, 0.0]);
+  const matrix = new Float32Array([4.0, 5.0, 6.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0]);
+
+  for (const metric of ["dot", "cosine", "sqeuclidean", "euclidean"]) {
+    const result = new Float32Array(3);
+    const resultjs = new Float32Array(3);
+    simsimd.batch(queries.subarray(0, 3), matrix, result, metric);
+    fallback.batch(queries.subarray(0, 3), matrix, resultjs, metric);
+    result.forEach((value, i) => assertAlmostEqual(resultjs[i], value, 0.01));
+
+    const pairs = new Float64Array(6);
+    const pairsjs = new Float64Array(6);
+    simsimd.cdist(queries, matrix, 3, pairs, metric);
+    fallback.cdist(queries, matrix, 3, pairsjs, metric);
+    pairs.forEach((value, i) => assertAlmostEqual(pairsjs[i], value, 0.01));
+  }
+
+  const u8s = new Uint8Array([1, 2, 3, 4, 5, 6]);
+  const hammings = new Float64Array(4);
+  simsimd.cdist(u8s, u8s, 3, hammings, "hamming");
+  assertAlmostEqual(hammings[0], 0.0, 0.01);
+  assertAlmostEqual(hammings[1], fallback.hamming(u8s.subarray(0, 3), u8s.subarray(3)), 0.01);
+
+  assert.throws(() => simsimd.batch(queries, matrix.subarray(0, 8), new Float64Array(3), "dot"));
+  assert.throws(() => simsimd.cdist(queries, matrix, 3, new Float64Array(5), "dot"));
+});
@@ -44,6 +44,7 @@ import math
 import time
 import platform
 import collections
+import concurrent.futures
 from typing import Dict, List
 
 import tabulate
@@ -400,7 +401,16 @@ SIMSIMD_ATOL = 0.1
 
 # We will run all the tests many times using different instruction sets under the hood.
 available_capabilities: Dict[str, str] = simd.get_capabilities()
-possible_x86_capabilities: List[str] = ["haswell", "ice", "skylake", "sapphire", "turin", "genoa", "sierra"]
+possible_x86_capabilities: List[str] = [
+    "haswell",
+    "ice",
+    "skylake",
+    "sapphire",
+    "sapphire_amx",
+    "turin",
+    "genoa",
+    "sierra",
+]
 possible_arm_capabilities: List[str] = [
     "neon",
     "neon_f16",
@@ -528,6 +538,7 @@ def test_capabilities_list():
     assert "skylake" in simd.get_capabilities()
     assert "genoa" in simd.get_capabilities()
     assert "sapphire" in simd.get_capabilities()
+    assert "sapphire_amx" in simd.get_capabilities()
     assert "turin" in simd.get_capabilities()
     assert simd.get_capabilities().get("serial") == 1
 
@@ -539,6 +550,37 @@ def test_capabilities_list():
         simd.disable_capability("neon")
 
 
+
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+def test_kernel_usage():
+    """Tests the per-kernel counters, that stay empty unless compiled with `SIMSIMD_INSTRUMENTATION=1`."""
+    with pytest.raises(ValueError):
+        simd.configure_kernel_usage("unknown")
+    enabled = simd.configure_kernel_usage("cycles")
+    simd.reset_kernel_usage()
+
+    a = np.random.randn(128).astype(np.float32)
+    simd.sqeuclidean(a, a)
+    simd.sqeuclidean(a, a)
+    with pytest.raises(LookupError):
+        simd.jensenshannon(np.zeros(8, dtype=np.int16), np.zeros(8, dtype=np.int16))
+
+    usage = simd.get_kernel_usage()
+    simd.configure_kernel_usage("")
+    if not enabled:
+        assert usage == []
+        return
+
+    served = [u for u in usage if u["metric"] == "e" and u["dtype"] == "f32"]
+    assert len(served) == 1 and served[0]["calls"] == 2 and served[0]["bytes"] == 2 * 2 * a.nbytes
+    assert served[0]["capability"] in simd.get_capabilities()
+    missing = [u for u in usage if u["metric"] == "s" and u["dtype"] == "i16"]
+    assert len(missing) == 1 and missing[0]["capability"] is None
+
+    simd.reset_kernel_usage()
+    assert simd.get_kernel_usage() == []
+
+
 def to_array(x, dtype=None):
     if numpy_available:
         y = np.array(x)
@@ -839,6 +881,33 @@ def test_dense_bits(ndim, metric, capability, stats_fixture):
     collect_errors(metric, ndim, "bits", accurate, accurate_dt, expected, expected_dt, result, result_dt, stats_fixture)
 
 
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+@pytest.mark.repeat(50)
+@pytest.mark.parametrize("ndim", [12, 98, 1536])
+@pytest.mark.parametrize("metric", ["inner", "euclidean", "sqeuclidean", "cosine"])
+@pytest.mark.parametrize("capability", possible_capabilities)
+def test_dense_i4(ndim, metric, capability, stats_fixture):
+    """Compares various SIMD kernels for 4-bit signed integers, packed in pairs into bytes with the low
+    nibble holding the first scalar, with their NumPy or baseline counterparts on unpacked vectors."""
+    np.random.seed()
+    a = np.random.randint(-8, 8, size=ndim).astype(np.int8)
+    b = np.random.randint(-8, 8, size=ndim).astype(np.int8)
+    pack = lambda x: ((x[0::2] & 0x0F) | ((x[1::2] & 0x0F) << 4)).astype(np.uint8)
+
+    keep_one_capability(capability)
+    baseline_kernel, simd_kernel = name_to_kernels(metric)
+    accurate_dt, accurate = profile(baseline_kernel, a.astype(np.float64), b.astype(np.float64))
+    expected_dt, expected = profile(baseline_kernel, a.astype(np.int64), b.astype(np.int64))
+    result_dt, result = profile(simd_kernel, pack(a), pack(b), "i4x2")
+    result = np.array(result)
+
+    if metric == "inner":
+        assert round(float(result)) == round(float(expected)), f"Expected {expected}, but got {result}"
+    else:
+        np.testing.assert_allclose(result, expected, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+    collect_errors(metric, ndim, "i4x2", accurate, accurate_dt, expected, expected_dt, result, result_dt, stats_fixture)
+
+
 @pytest.mark.skip(reason="Problems inferring the tolerance bounds for numerical errors")
 @pytest.mark.repeat(50)
 @pytest.mark.parametrize("ndim", [11, 97, 1536])
@@ -1040,6 +1109,32 @@ def test_intersect(dtype, first_length_bound, second_length_bound, capability):
     assert round(float(expected)) == round(float(result)), f"Missing {np.intersect1d(a, b)} from {a} and {b}"
 
 
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+@pytest.mark.repeat(20)
+@pytest.mark.parametrize("first_length_bound", [10, 100, 1000])
+@pytest.mark.parametrize("second_length_bound", [10, 100, 1000])
+@pytest.mark.parametrize("capability", possible_capabilities)
+def test_intersect_weighted(first_length_bound, second_length_bound, capability):
+    """Compares the weighted simd.intersect() of `uint32` indices and `float32` weights with a NumPy baseline."""
+
+    if is_running_under_qemu() and (platform.machine() == "aarch64" or platform.machine() == "arm64"):
+        pytest.skip("In QEMU `aarch64` emulation on `x86_64` the `intersect` function is not reliable")
+
+    np.random.seed()
+    a = np.unique(np.random.randint(first_length_bound * 2, size=np.random.randint(1, first_length_bound)))
+    b = np.unique(np.random.randint(second_length_bound * 2, size=np.random.randint(1, second_length_bound)))
+    a, b = a.astype(np.uint32), b.astype(np.uint32)
+    a_weights = np.random.rand(len(a)).astype(np.float32)
+    b_weights = np.random.rand(len(b)).astype(np.float32)
+
+    keep_one_capability(capability)
+    _, a_indices, b_indices = np.intersect1d(a, b, return_indices=True)
+    expected = np.dot(a_weights[a_indices].astype(np.float64), b_weights[b_indices].astype(np.float64))
+    result = simd.intersect(a, b, a_weights, b_weights)
+
+    np.testing.assert_allclose(result, expected, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+
+
 @pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
 @pytest.mark.repeat(50)
 @pytest.mark.parametrize("ndim", [11, 97, 1536])
@@ -1159,6 +1254,109 @@ def test_wsum(ndim, dtype, kernel, capability, stats_fixture):
     )
 
 
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+@pytest.mark.parametrize("ndim", [11, 97, 1536])
+@pytest.mark.parametrize("dtype", ["float64", "float32", "float16", "int8", "uint8"])
+@pytest.mark.parametrize("capability", possible_capabilities)
+def test_elementwise(ndim, dtype, capability):
+    """Compares the scale, add, and multiply kernels against NumPy, including the in-place mode."""
+
+    if dtype == "float16" and is_running_under_qemu():
+        pytest.skip("Testing low-precision math isn't reliable in QEMU")
+
+    np.random.seed()
+    if np.issubdtype(np.dtype(dtype), np.integer):
+        dtype_info = np.iinfo(np.dtype(dtype))
+        a = np.random.randint(dtype_info.min, dtype_info.max, size=ndim, dtype=dtype)
+        b = np.random.randint(dtype_info.min, dtype_info.max, size=ndim, dtype=dtype)
+        saturate = lambda x: np.clip(np.round(x), dtype_info.min, dtype_info.max)
+        atol, rtol = 1, 0  # ? Allow at most one rounding error per element
+    else:
+        a = np.random.randn(ndim).astype(dtype)
+        b = np.random.randn(ndim).astype(dtype)
+        saturate = lambda x: x
+        atol, rtol = SIMSIMD_ATOL, SIMSIMD_RTOL
+
+    keep_one_capability(capability)
+    alpha, beta = 0.5, 3.0
+    a64, b64 = a.astype(np.float64), b.astype(np.float64)
+    result = np.array(simd.scale(a, alpha=alpha, beta=beta))
+    np.testing.assert_allclose(result, saturate(alpha * a64 + beta), atol=atol, rtol=rtol)
+    np.testing.assert_allclose(np.array(simd.add(a, b)), saturate(a64 + b64), atol=atol, rtol=rtol)
+    np.testing.assert_allclose(np.array(simd.multiply(a, b)), saturate(a64 * b64), atol=atol, rtol=rtol)
+
+    # The output may alias any of the inputs
+    expected = np.array(simd.add(a, b))
+    assert simd.add(a, b, out=a) is None
+    np.testing.assert_array_equal(a, expected)
+
+
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+@pytest.mark.parametrize("ndim", [11, 97, 1536])
+@pytest.mark.parametrize("dtype", ["float16", "int8", "uint8", "b8"])
+@pytest.mark.parametrize("capability", possible_capabilities)
+def test_quantize(ndim, dtype, capability):
+    """Compares the quantization kernels against NumPy rounding and bit-packing."""
+
+    np.random.seed()
+    a = (np.random.randn(ndim) * 100).astype(np.float32)
+    alpha = 0.5
+
+    keep_one_capability(capability)
+    if dtype == "b8":
+        result = np.array(simd.quantize(a, "b8", alpha=alpha)).view(np.uint8)
+        np.testing.assert_array_equal(result, np.packbits(alpha * a > 0))
+        return
+
+    result = np.array(simd.quantize(a, dtype, alpha=alpha))
+    if dtype == "float16":
+        np.testing.assert_allclose(result, (alpha * a).astype(np.float16), atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+    else:
+        dtype_info = np.iinfo(np.dtype(dtype))
+        scaled = alpha * a.astype(np.float64)
+        expected = np.clip(np.sign(scaled) * np.floor(np.abs(scaled) + 0.5), dtype_info.min, dtype_info.max)
+        np.testing.assert_array_equal(result, expected)
+
+    # Dequantization is exact for integers and must round-trip `f16` losslessly
+    dequantized = np.array(simd.dequantize(result.astype(dtype), alpha=2))
+    np.testing.assert_allclose(dequantized, 2 * result.astype(np.float32), atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+
+
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+@pytest.mark.parametrize("ndim", [11, 97, 1536])
+@pytest.mark.parametrize("dtype", ["float64", "float32", "float16", "int8", "uint8"])
+@pytest.mark.parametrize("capability", possible_capabilities)
+def test_reduce(ndim, dtype, capability):
+    """Compares the row-wise reductions against NumPy, for single vectors and every row of a strided matrix."""
+
+    if dtype == "float16" and is_running_under_qemu():
+        pytest.skip("Testing low-precision math isn't reliable in QEMU")
+
+    np.random.seed()
+    if np.issubdtype(np.dtype(dtype), np.integer):
+        dtype_info = np.iinfo(np.dtype(dtype))
+        a = np.random.randint(dtype_info.min, dtype_info.max, size=(5, ndim + 3), dtype=dtype)[:, :ndim]
+    else:
+        a = np.random.randn(5, ndim + 3).astype(dtype)[:, :ndim]
+
+    keep_one_capability(capability)
+    a64 = a.astype(np.float64)
+    np.testing.assert_allclose(simd.sum(a[0]), a64[0].sum(), atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+    np.testing.assert_allclose(np.array(simd.sum(a)), a64.sum(axis=1), atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+    np.testing.assert_allclose(np.array(simd.l1norm(a)), np.abs(a64).sum(axis=1), atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+    np.testing.assert_allclose(
+        np.array(simd.l2norm(a)), np.linalg.norm(a64, axis=1), atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL
+    )
+
+    # Extremums are exact, and the ties resolve to the first occurrence, like in NumPy
+    assert simd.min(a[0]) == a64[0].min() and simd.argmin(a[0]) == a[0].argmin()
+    assert simd.max(a[0]) == a64[0].max() and simd.argmax(a[0]) == a[0].argmax()
+    np.testing.assert_array_equal(np.array(simd.min(a)), a64.min(axis=1))
+    np.testing.assert_array_equal(np.array(simd.max(a)), a64.max(axis=1))
+    np.testing.assert_array_equal(np.array(simd.argmin(a)), a.argmin(axis=1))
+    np.testing.assert_array_equal(np.array(simd.argmax(a)), a.argmax(axis=1))
+
+
 @pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
 @pytest.mark.skipif(not scipy_available, reason="SciPy is not installed")
 @pytest.mark.parametrize("ndim", [11, 97, 1536])
@@ -1219,9 +1417,9 @@ def test_batch(ndim, dtype, capability):
     assert np.allclose(result_simd, result_np, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
 
     # Distance between matrixes A (N x D scalars) and B (N x D scalars) in a transposed matrix.
-    #! This requires calling `np.ascontiguousarray()` to ensure the matrix is in the right format.
     A = np.random.randn(10, ndim).astype(dtype)
-    B = np.ascontiguousarray(np.random.randn(ndim, 10).astype(dtype).T)
+    B = np.random.randn(ndim, 10).astype(dtype).T
+    assert not B.flags.c_contiguous
     result_np = [spd.sqeuclidean(A[i], B[i]) for i in range(10)]
     result_simd = np.array(simd.sqeuclidean(A, B)).astype(np.float64)
     assert np.allclose(result_simd, result_np, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
@@ -1321,6 +1519,219 @@ def test_cdist_itself(ndim, input_dtype, out_dtype, metric):
     np.testing.assert_allclose(result, expected, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
 
 
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+@pytest.mark.skipif(not scipy_available, reason="SciPy is not installed")
+@pytest.mark.parametrize("ndim", [11, 97, 1536])
+@pytest.mark.parametrize("input_dtype", ["float32", "float16", "int8"])
+@pytest.mark.parametrize("out_dtype", [None, "float32"])
+@pytest.mark.parametrize("metric", ["cosine", "sqeuclidean", "euclidean"])
+def test_cdist_norms(ndim, input_dtype, out_dtype, metric):
+    """Compares the simd.cdist(A, B) function reusing the cached simd.norms() of either side with the one
+    computing them on the fly, and with scipy.spatial.distance.cdist(A, B)."""
+
+    if input_dtype == "float16" and is_running_under_qemu():
+        pytest.skip("Testing low-precision math isn't reliable in QEMU")
+
+    np.random.seed()
+    if input_dtype == "int8":
+        A = np.random.randint(-100, 100, size=(20, ndim)).astype(np.int8)
+        B = np.random.randint(-100, 100, size=(30, ndim)).astype(np.int8)
+    else:
+        A = np.random.randn(20, ndim).astype(input_dtype)
+        B = np.random.randn(30, ndim).astype(input_dtype)
+
+    a_norms, b_norms = simd.norms(A), simd.norms(B)
+    np.testing.assert_allclose(a_norms, (A.astype(np.float64) ** 2).sum(axis=1), rtol=1e-2)
+
+    kwargs = {} if out_dtype is None else {"out_dtype": out_dtype}
+    expected = simd.cdist(A, B, metric=metric, **kwargs)
+    baseline = spd.cdist(A.astype(np.float64), B.astype(np.float64), metric)
+    for norms in [{"a_norms": a_norms}, {"b_norms": b_norms}, {"a_norms": a_norms, "b_norms": b_norms}]:
+        result = simd.cdist(A, B, metric=metric, **kwargs, **norms)
+        np.testing.assert_allclose(result, expected, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+        np.testing.assert_allclose(result, baseline, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+
+    with pytest.raises(ValueError):
+        simd.cdist(A, B, metric="dot", a_norms=a_norms)
+    with pytest.raises(ValueError):
+        simd.cdist(A, B, metric=metric, a_norms=b_norms)
+
+
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+@pytest.mark.skipif(not scipy_available, reason="SciPy is not installed")
+@pytest.mark.parametrize("ndim", [11, 97, 1536])
+@pytest.mark.parametrize("input_dtype", ["float32", "float16", "int8"])
+@pytest.mark.parametrize("metric", ["cosine", "sqeuclidean", "dot"])
+def test_cdist_strided(ndim, input_dtype, metric):
+    """Compares the simd.cdist(A, B) function on column slices, transposed, and reversed views,
+    that are packed internally, with the same calls on contiguous copies, also from a pool of Python threads."""
+
+    if input_dtype == "float16" and is_running_under_qemu():
+        pytest.skip("Testing low-precision math isn't reliable in QEMU")
+
+    np.random.seed()
+    if input_dtype == "int8":
+        A_extended = np.random.randint(-100, 100, size=(20, 2 * ndim)).astype(np.int8)
+        B_transposed = np.random.randint(-100, 100, size=(ndim, 30)).astype(np.int8)
+    else:
+        A_extended = np.random.randn(20, 2 * ndim).astype(input_dtype)
+        B_transposed = np.random.randn(ndim, 30).astype(input_dtype)
+
+    A, B = A_extended[:, ::2], B_transposed.T
+    assert not A.flags.c_contiguous and not B.flags.c_contiguous
+    expected = np.array(simd.cdist(np.ascontiguousarray(A), np.ascontiguousarray(B), metric=metric))
+    np.testing.assert_allclose(simd.cdist(A, B, metric=metric), expected, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+    np.testing.assert_allclose(
+        simd.cdist(A[:, ::-1], B[:, ::-1], metric=metric), expected, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL
+    )
+
+    # The views are packed and the distances computed without holding the GIL
+    with concurrent.futures.ThreadPoolExecutor(max_workers=4) as pool:
+        futures = [pool.submit(simd.cdist, A, B, metric=metric, threads=1) for _ in range(16)]
+        for future in futures:
+            np.testing.assert_allclose(future.result(), expected, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+
+    # Outputs are written in-place, so they must remain contiguous
+    with pytest.raises(ValueError):
+        simd.cdist(A, B, metric=metric, out=np.zeros((30, 20)).T)
+
+
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+@pytest.mark.parametrize("ndim", [11, 97, 1536])
+@pytest.mark.parametrize("out_dtype", ["float64", "float32", "float16", "int32"])
+def test_cdist_workspace(ndim, out_dtype):
+    """Checks that simd.cdist() and simd.pdist() results placed into a reused simd.Workspace match the freshly
+    allocated ones, that the arena doesn't move while they are referenced, and that DLPack exports are zero-copy."""
+
+    np.random.seed()
+    A = np.random.randn(20, ndim).astype(np.float32)
+    B = np.random.randn(30, ndim).astype(np.float32)
+    expected = np.array(simd.cdist(A, B, metric="sqeuclidean", out_dtype=out_dtype))
+
+    workspace = simd.Workspace()
+    assert workspace.capacity == 0
+    result = simd.cdist(A, B, metric="sqeuclidean", out_dtype=out_dtype, workspace=workspace)
+    assert workspace.capacity >= expected.nbytes
+    np.testing.assert_array_equal(result, expected)
+
+    # Exports share the memory of the arena
+    if hasattr(np, "from_dlpack"):
+        assert result.__dlpack_device__() == (1, 0)
+        exported = np.from_dlpack(result)
+        assert exported.dtype == expected.dtype and exported.shape == expected.shape
+        assert exported.__array_interface__["data"][0] == np.asarray(result).__array_interface__["data"][0]
+        np.testing.assert_array_equal(exported, expected)
+        del exported
+
+    # Smaller results reuse the arena, but it can't grow while previous results are alive
+    capacity = workspace.capacity
+    pairs = simd.pdist(A, metric="sqeuclidean", out_dtype=out_dtype, workspace=workspace)
+    assert workspace.capacity == capacity
+    assert np.asarray(pairs).__array_interface__["data"][0] == np.asarray(result).__array_interface__["data"][0]
+    C = np.random.randn(math.isqrt(capacity // expected.itemsize) + 1, 1).astype(np.float32)
+    with pytest.raises(BufferError):
+        simd.cdist(C, C, metric="sqeuclidean", out_dtype=out_dtype, workspace=workspace)
+    del result, pairs
+    simd.cdist(C, C, metric="sqeuclidean", out_dtype=out_dtype, workspace=workspace)
+    assert workspace.capacity > capacity
+
+    with pytest.raises(ValueError):
+        simd.cdist(A, B, out=np.zeros((20, 30)), workspace=workspace)
+    with pytest.raises(TypeError):
+        simd.cdist(A, B, workspace=bytearray(16))
+
+
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+@pytest.mark.skipif(not scipy_available, reason="SciPy is not installed")
+@pytest.mark.parametrize("ndim", [11, 97, 1536])
+@pytest.mark.parametrize("count", [1, 10, 150])
+@pytest.mark.parametrize("input_dtype", ["float32", "float16"])
+@pytest.mark.parametrize("out_dtype", [None, "float32", "int32"])
+@pytest.mark.parametrize("metric", ["cosine", "sqeuclidean", "euclidean"])
+@pytest.mark.parametrize("threads", [1, 4])
+def test_pdist(ndim, count, input_dtype, out_dtype, metric, threads):
+    """Compares the simd.pdist(A) function with scipy.spatial.distance.pdist(A), checking the condensed layout
+    for both the tiled kernels and the pairwise fallback."""
+
+    if input_dtype == "float16" and is_running_under_qemu():
+        pytest.skip("Testing low-precision math isn't reliable in QEMU")
+
+    np.random.seed()
+
+    A = np.random.randn(count, ndim).astype(input_dtype)
+    if out_dtype is None:
+        expected = spd.pdist(A, metric)
+        result = simd.pdist(A, metric, threads=threads)
+    else:
+        expected = spd.pdist(A, metric).astype(out_dtype)
+        result = simd.pdist(A, metric, threads=threads, out_dtype=out_dtype)
+
+    result = np.array(result)
+    assert result.shape == expected.shape
+    np.testing.assert_allclose(result, expected, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+
+
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+@pytest.mark.skipif(not scipy_available, reason="SciPy is not installed")
+@pytest.mark.parametrize("ndim", [11, 97, 1536])
+@pytest.mark.parametrize("input_dtype", ["float32", "float16"])
+@pytest.mark.parametrize("metric", ["cosine", "sqeuclidean", "dot"])
+@pytest.mark.parametrize("threads", [1, 4])
+@pytest.mark.parametrize("capability", possible_capabilities)
+def test_topk(ndim, input_dtype, metric, threads, capability):
+    """Compares the simd.topk() function with sorted scipy.spatial.distance.cdist() rows, checking that the returned
+    distances match the reference ones for the same indices, and that no other candidate beats the last one."""
+
+    if input_dtype == "float16" and is_running_under_qemu():
+        pytest.skip("Testing low-precision math isn't reliable in QEMU")
+
+    np.random.seed()
+    keep_one_capability(capability)
+
+    M, N, K = 5, 300, 10
+    A = np.random.randn(M, ndim).astype(input_dtype)
+    B = np.random.randn(N, ndim).astype(input_dtype)
+    if metric == "dot":
+        expected = -(A.astype(np.float64) @ B.astype(np.float64).T)
+    else:
+        expected = spd.cdist(A.astype(np.float64), B.astype(np.float64), metric)
+
+    ids, distances = simd.topk(A, B, K, metric=metric, threads=threads)
+    ids, distances = np.array(ids), np.array(distances)
+    assert ids.shape == (M, K) and distances.shape == (M, K)
+    sign = -1 if metric == "dot" else 1
+
+    for i in range(M):
+        np.testing.assert_allclose(sign * distances[i], expected[i, ids[i]], atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+        assert np.all(np.diff(sign * distances[i]) >= 0)
+        assert np.count_nonzero(expected[i] < sign * distances[i, -1] - SIMSIMD_ATOL) < K
+
+
+@pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
+@pytest.mark.skipif(platform.system() == "Windows", reason="Streaming requires POSIX memory mapping")
+@pytest.mark.parametrize("ndim", [11, 97, 1536])
+@pytest.mark.parametrize("input_dtype", ["float32", "float16", "int8"])
+@pytest.mark.parametrize("metric", ["cosine", "sqeuclidean", "dot"])
+def test_topk_file(ndim, input_dtype, metric, tmp_path):
+    """Compares the simd.topk_file() function over `.npy` and raw files with the in-memory simd.topk()."""
+
+    np.random.seed()
+    M, N, K = 3, 500, 10
+    A = (np.random.randn(M, ndim) * 10).astype(input_dtype)
+    B = (np.random.randn(N, ndim) * 10).astype(input_dtype)
+    np.save(tmp_path / "b.npy", B)
+    with open(tmp_path / "b.raw", "wb") as file:
+        file.write(b"header")
+        B.tofile(file)
+
+    expected_ids, expected_distances = simd.topk(A, B, K, metric=metric)
+    ids, distances = simd.topk_file(A, tmp_path / "b.npy", K, metric=metric)
+    np.testing.assert_allclose(distances, expected_distances, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+    ids, distances = simd.topk_file(A, str(tmp_path / "b.raw"), K, metric, dtype=input_dtype, offset=6)
+    np.testing.assert_allclose(distances, expected_distances, atol=SIMSIMD_ATOL, rtol=SIMSIMD_RTOL)
+    assert np.array(ids).shape == (M, K)
+
+
 @pytest.mark.skipif(not numpy_available, reason="NumPy is not installed")
 @pytest.mark.parametrize("ndim", [11, 97, 1536])
 @pytest.mark.parametrize("input_dtype", ["complex128", "complex64"])
@@ -54,6 +54,10 @@ def get_bool_env_w_name(name: str, preference: bool) -> tuple:
     return name, "1" if get_bool_env(name, preference) else "0"
 
 
+# Per-kernel call counters are opt-in, as every call pays for a few atomic increments
+macros_args.append(get_bool_env_w_name("SIMSIMD_INSTRUMENTATION", False))
+
+
 if sys.platform == "linux":
     compile_args.append("-std=c11")
     compile_args.append("-O3")
@@ -82,12 +86,15 @@ if sys.platform == "linux":
             get_bool_env_w_name("SIMSIMD_TARGET_SVE", True),
             get_bool_env_w_name("SIMSIMD_TARGET_SVE_F16", True),
             get_bool_env_w_name("SIMSIMD_TARGET_SVE_BF16", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_SVE_I8", True),
             get_bool_env_w_name("SIMSIMD_TARGET_SVE2", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_SVE2P1", False),  # Requires GCC 14 or Clang 18
             get_bool_env_w_name("SIMSIMD_TARGET_HASWELL", True),
             get_bool_env_w_name("SIMSIMD_TARGET_SKYLAKE", True),
             get_bool_env_w_name("SIMSIMD_TARGET_ICE", True),
             get_bool_env_w_name("SIMSIMD_TARGET_GENOA", True),
             get_bool_env_w_name("SIMSIMD_TARGET_SAPPHIRE", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_SAPPHIRE_AMX", True),
             get_bool_env_w_name("SIMSIMD_TARGET_TURIN", True),
             get_bool_env_w_name("SIMSIMD_TARGET_SIERRA", False),  # TODO: Add target spec to GCC & Clang
         ]
@@ -114,6 +121,7 @@ if sys.platform == "darwin":
             get_bool_env_w_name("SIMSIMD_TARGET_ICE", False),
             get_bool_env_w_name("SIMSIMD_TARGET_GENOA", False),
             get_bool_env_w_name("SIMSIMD_TARGET_SAPPHIRE", False),
+            get_bool_env_w_name("SIMSIMD_TARGET_SAPPHIRE_AMX", False),
             get_bool_env_w_name("SIMSIMD_TARGET_TURIN", False),
             get_bool_env_w_name("SIMSIMD_TARGET_SIERRA", False),
         ]
@@ -143,6 +151,7 @@ if sys.platform == "win32":
             get_bool_env_w_name("SIMSIMD_TARGET_ICE", True),
             get_bool_env_w_name("SIMSIMD_TARGET_GENOA", False),
             get_bool_env_w_name("SIMSIMD_TARGET_SAPPHIRE", False),
+            get_bool_env_w_name("SIMSIMD_TARGET_SAPPHIRE_AMX", False),
             get_bool_env_w_name("SIMSIMD_TARGET_TURIN", False),
             get_bool_env_w_name("SIMSIMD_TARGET_SIERRA", False),
         ]